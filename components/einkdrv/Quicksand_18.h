@@ -1,830 +1,742 @@
 #pragma once
 #include "epd_driver.h"
-const uint8_t Quicksand_18Bitmaps[11627] = {
-    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0x53, 0x60, 0xFA, 0xEA, 0xFF, 0x73,
-    0xFE, 0xCF, 0xF9, 0x3F, 0xFA, 0xBF, 0xD7, 0x7F, 0xAF, 0xFF, 0x96, 0xFF, 0x35, 0xFE, 0x6B, 0xFC,
-    0x17, 0xFF, 0xCF, 0xF6, 0x9F, 0xED, 0x3F, 0xE9, 0x7F, 0x92, 0xFF, 0x28, 0xFF, 0x81, 0xFF, 0x03,
-    0xFF, 0x03, 0x3E, 0x05, 0x26, 0x06, 0x20, 0x10, 0x60, 0xFC, 0x5E, 0xFF, 0xE7, 0xFC, 0x9F, 0xF3,
-    0x5F, 0xE3, 0x01, 0x62, 0xD1, 0x1D, 0x7F, 0x78, 0x9C, 0x35, 0xC8, 0xD1, 0x0D, 0x40, 0x30, 0x14,
-    0x40, 0xD1, 0x5B, 0xA4, 0x12, 0x44, 0xED, 0x62, 0x04, 0x03, 0x74, 0x04, 0x2B, 0xD8, 0xC8, 0x08,
-    0x6C, 0xC0, 0x28, 0x36, 0x28, 0x29, 0x8D, 0x10, 0x79, 0xFC, 0x38, 0x9F, 0x87, 0x46, 0x51, 0xD5,
-    0x74, 0x52, 0xB2, 0x88, 0x1E, 0xA5, 0xC0, 0x4B, 0x3C, 0x4B, 0xCA, 0xEE, 0xBE, 0x88, 0x08, 0x03,
-    0xAB, 0x83, 0xB3, 0x65, 0xEB, 0xE1, 0x32, 0x78, 0x0B, 0x77, 0xCE, 0x61, 0xE0, 0xD1, 0x84, 0x0C,
-    0x44, 0x11, 0x12, 0x98, 0xF8, 0xBD, 0x72, 0x80, 0x1C, 0xA0, 0x78, 0x9C, 0x4D, 0x90, 0xCB, 0x0D,
-    0x82, 0x40, 0x14, 0x45, 0xAF, 0x11, 0x11, 0xE3, 0xC2, 0x16, 0xE8, 0xC0, 0x16, 0xEC, 0x40, 0xAD,
-    0x00, 0x57, 0xB3, 0x15, 0x57, 0xB3, 0x52, 0xEC, 0x40, 0x76, 0x2E, 0xB5, 0x03, 0x2C, 0x81, 0x0E,
-    0xB0, 0x02, 0xB5, 0x00, 0x03, 0xF8, 0x89, 0x06, 0x83, 0x79, 0xCE, 0x7B, 0x04, 0x22, 0x8B, 0x7B,
-    0x4E, 0x26, 0x21, 0x73, 0x32, 0x00, 0xD0, 0x46, 0x3D, 0x08, 0x13, 0x33, 0x71, 0x24, 0x7E, 0x21,
-    0x33, 0xB7, 0xB3, 0x78, 0xCE, 0x78, 0x54, 0xE7, 0x82, 0x57, 0x20, 0x2E, 0x28, 0x3C, 0xF1, 0x62,
-    0x6C, 0xA6, 0x1C, 0x02, 0xEE, 0x35, 0xA5, 0x2C, 0x4D, 0xCD, 0x9C, 0xBA, 0x3E, 0x35, 0xDF, 0xC0,
-    0xFD, 0xD6, 0x9A, 0x39, 0xC0, 0x88, 0x7A, 0x80, 0x4F, 0x5D, 0xFE, 0x55, 0x10, 0x92, 0x25, 0x09,
-    0x8C, 0x98, 0x5A, 0xEC, 0x82, 0x9C, 0xAA, 0x84, 0x8C, 0x73, 0x12, 0xF1, 0x3B, 0xE3, 0xB9, 0x13,
-    0x17, 0xBC, 0xE7, 0x66, 0xA6, 0xEA, 0x13, 0x29, 0xA5, 0xCA, 0x8D, 0xB2, 0xD0, 0x5C, 0x45, 0xDE,
-    0x9F, 0x07, 0x58, 0x68, 0x5A, 0x69, 0xBD, 0xA5, 0xA5, 0xB6, 0x4D, 0x28, 0xF5, 0x81, 0x09, 0x77,
-    0x30, 0x1C, 0xEE, 0xB0, 0xD9, 0xD7, 0xD4, 0x01, 0xF6, 0x24, 0x4F, 0x72, 0x60, 0x1C, 0xEB, 0x9C,
-    0xBA, 0x03, 0x98, 0xF1, 0xB5, 0xA1, 0xBC, 0xC2, 0x0F, 0x21, 0x1D, 0x78, 0xD9, 0x78, 0x9C, 0x75,
-    0xD0, 0x41, 0x0E, 0xC1, 0x40, 0x14, 0x06, 0xE0, 0xD7, 0x62, 0x16, 0x42, 0xD2, 0xAD, 0xB0, 0xE8,
-    0xCA, 0x52, 0x1C, 0xC1, 0x0D, 0x70, 0x03, 0x17, 0x90, 0xF4, 0x28, 0x16, 0xF6, 0xED, 0x0D, 0x2A,
-    0xD8, 0x4B, 0x5C, 0xC0, 0xCA, 0xFA, 0x85, 0x03, 0xB0, 0x51, 0xAA, 0xA4, 0xBF, 0x99, 0xE9, 0x6B,
-    0x10, 0xF1, 0xAF, 0xBE, 0x4C, 0xE6, 0xCD, 0xFC, 0x33, 0x44, 0x44, 0x41, 0x8B, 0x24, 0x97, 0xB0,
-    0x54, 0x12, 0xFF, 0x68, 0xFC, 0xE0, 0xAE, 0xC5, 0x0A, 0x3A, 0x53, 0x33, 0x08, 0x9B, 0x0E, 0xD1,
-    0x15, 0x61, 0xC6, 0x19, 0xD8, 0xF1, 0x10, 0x3B, 0x49, 0xEC, 0xA5, 0x50, 0x01, 0x1A, 0x66, 0xB6,
-    0x7F, 0x72, 0x22, 0xD4, 0xE4, 0x94, 0x05, 0xAA, 0xA2, 0x08, 0x4A, 0x14, 0xA0, 0x29, 0xF2, 0xC1,
-    0xAE, 0xDC, 0x96, 0x22, 0xBE, 0x17, 0x9A, 0xE9, 0x0B, 0x76, 0xAE, 0xE5, 0xDE, 0x50, 0x59, 0xCE,
-    0x73, 0x80, 0x2B, 0x45, 0x3F, 0xBD, 0x3A, 0x94, 0xA6, 0x4B, 0x9C, 0xCB, 0xCE, 0x37, 0x28, 0xD1,
-    0x02, 0x75, 0xD1, 0x48, 0x57, 0x2A, 0x34, 0x40, 0x63, 0xDB, 0xB6, 0x0A, 0x50, 0x4F, 0xD9, 0x35,
-    0x3A, 0x42, 0x5D, 0x10, 0xEA, 0x06, 0x93, 0x9C, 0xF5, 0x56, 0xF0, 0xF3, 0x9C, 0xA3, 0x47, 0xB4,
-    0xB5, 0x8F, 0x64, 0xD3, 0x61, 0xFD, 0x6E, 0xE0, 0xA7, 0x1B, 0xE7, 0xFF, 0x5F, 0x7D, 0xE8, 0x30,
-    0xA4, 0xAF, 0xBC, 0x00, 0x50, 0x2C, 0x86, 0x5B, 0x78, 0x9C, 0x45, 0x90, 0x4D, 0x4E, 0x02, 0x61,
-    0x0C, 0x86, 0x5F, 0x44, 0x21, 0xA8, 0x23, 0xB3, 0x22, 0x21, 0x90, 0xC8, 0x0D, 0x64, 0xE5, 0x52,
-    0xBC, 0x01, 0x24, 0x6E, 0x60, 0x47, 0xC2, 0x01, 0xE0, 0x06, 0x13, 0x16, 0xAC, 0xF1, 0x08, 0x2C,
-    0xBD, 0x05, 0xF1, 0x04, 0x63, 0xA2, 0x7B, 0x35, 0x1E, 0x00, 0x27, 0x4E, 0x18, 0x86, 0x9F, 0x79,
-    0x6D, 0xFB, 0x0D, 0xA1, 0x8B, 0x26, 0x4F, 0xFB, 0x7C, 0x4D, 0xFB, 0x01, 0xB3, 0x3E, 0x2C, 0x7A,
-    0x9A, 0x7E, 0xC8, 0x07, 0xA3, 0xDD, 0x15, 0xE0, 0x67, 0xAB, 0x6C, 0x55, 0x10, 0x18, 0xF2, 0x12,
-    0x58, 0xB0, 0x34, 0x61, 0x45, 0x28, 0xA2, 0xD4, 0xA2, 0x25, 0xB0, 0xAF, 0xAA, 0x38, 0x96, 0x14,
-    0x4B, 0x4A, 0xBA, 0x2A, 0xCA, 0x33, 0x24, 0x1D, 0x57, 0x89, 0x78, 0xA6, 0x74, 0x07, 0xFC, 0x05,
-    0xB9, 0x88, 0xB5, 0xEB, 0xF5, 0x78, 0x8D, 0xE3, 0xBB, 0x0E, 0xBE, 0x4D, 0xC4, 0x6F, 0x28, 0x33,
-    0x6F, 0xB0, 0x0D, 0x6C, 0x83, 0x67, 0xD6, 0xA7, 0x2C, 0xE7, 0x22, 0xFC, 0x03, 0x19, 0x1E, 0x45,
-    0xE0, 0x95, 0x6C, 0xA8, 0xD8, 0x7E, 0x19, 0x28, 0x8E, 0xEE, 0x6D, 0xE2, 0x86, 0x6C, 0xBA, 0xBE,
-    0x88, 0x13, 0x86, 0x59, 0xE8, 0x48, 0xC4, 0xE8, 0xB3, 0xB0, 0xE0, 0x85, 0xC2, 0xA3, 0x88, 0xEB,
-    0x2E, 0x7C, 0x5B, 0xD5, 0x26, 0x6E, 0xE5, 0x8E, 0x5D, 0xD5, 0xC4, 0x39, 0x70, 0xF0, 0x80, 0xF4,
-    0xD6, 0x44, 0xCF, 0xD1, 0x46, 0xE9, 0x8B, 0x45, 0xDB, 0x0E, 0xA9, 0x9A, 0xE9, 0x1C, 0xCE, 0xDA,
-    0x7B, 0xB9, 0x88, 0x38, 0x40, 0x4B, 0xFF, 0xC7, 0x44, 0xBC, 0xB1, 0xF6, 0xA1, 0xCB, 0x26, 0x2A,
-    0xA2, 0x4D, 0x52, 0xAF, 0x8A, 0xDD, 0x31, 0xEF, 0x64, 0x09, 0xA7, 0x78, 0x3A, 0x07, 0xFE, 0x01,
-    0x77, 0xFB, 0x76, 0x0C, 0x78, 0x9C, 0x45, 0x90, 0xBF, 0x0E, 0xC1, 0x50, 0x14, 0xC6, 0xBF, 0x46,
-    0x05, 0x11, 0x9E, 0xC1, 0x0B, 0x48, 0x2C, 0x66, 0xDD, 0x0D, 0x2C, 0x56, 0x7F, 0x9E, 0x80, 0xD5,
-    0x66, 0xB5, 0x60, 0xB4, 0x15, 0x93, 0x8D, 0x37, 0x68, 0x07, 0x7B, 0x49, 0xEC, 0xF5, 0x06, 0x84,
-    0x10, 0xDA, 0xF2, 0x39, 0xB7, 0xA5, 0x3D, 0xC3, 0xC9, 0x2F, 0xDF, 0xB9, 0xF7, 0x3B, 0xDF, 0xBD,
-    0x00, 0xD0, 0x9B, 0x0F, 0x75, 0x44, 0xB5, 0x24, 0x79, 0xCE, 0x84, 0x58, 0xFA, 0x08, 0xD3, 0x09,
-    0x79, 0xCF, 0xB6, 0x56, 0x79, 0x31, 0xA7, 0xF8, 0x71, 0xD6, 0x00, 0x83, 0x45, 0xC5, 0xDE, 0x54,
-    0xF5, 0x63, 0x56, 0xF5, 0xA0, 0x83, 0xB8, 0x82, 0x7E, 0xC2, 0x2F, 0x2B, 0xE1, 0x1B, 0x53, 0x31,
-    0x2F, 0x58, 0x88, 0x79, 0xC7, 0x4D, 0x22, 0x93, 0xD9, 0xBF, 0x0D, 0xC7, 0xFC, 0x39, 0xCD, 0x58,
-    0xC6, 0x93, 0x69, 0xD9, 0x5C, 0xC7, 0x95, 0x9A, 0x1C, 0x6B, 0x00, 0xB6, 0x8B, 0xA7, 0x29, 0x43,
-    0x9F, 0x3A, 0x2E, 0x0E, 0x7C, 0x91, 0x60, 0xCB, 0xE0, 0x6E, 0xE2, 0x5D, 0x8B, 0x0C, 0xD2, 0x22,
-    0xBE, 0x95, 0x8E, 0x2D, 0x4D, 0x09, 0xED, 0x87, 0x89, 0xE1, 0x91, 0x99, 0xE8, 0x25, 0xC0, 0x88,
-    0xE2, 0x77, 0x62, 0xFE, 0xC7, 0x65, 0x34, 0xE9, 0x48, 0x4C, 0x23, 0x90, 0x24, 0xBA, 0x2C, 0x75,
-    0xC7, 0xEB, 0x0F, 0xFB, 0x07, 0x49, 0xD2, 0x55, 0x3F, 0x42, 0x37, 0x05, 0xCF, 0x05, 0x56, 0x82,
-    0x96, 0x04, 0x1A, 0x4C, 0xE4, 0x5E, 0xA5, 0x55, 0x8D, 0x72, 0x7E, 0x01, 0x23, 0x54, 0x70, 0x06,
-    0x78, 0x9C, 0x63, 0x70, 0x66, 0x2A, 0xF8, 0xCF, 0xBF, 0xE1, 0x3F, 0xCF, 0x81, 0xFF, 0xEC, 0x0F,
-    0xFE, 0x33, 0x7D, 0x78, 0xCF, 0xF0, 0x71, 0x3E, 0xC3, 0x67, 0x7F, 0x86, 0xAF, 0xFC, 0x0C, 0xDF,
-    0xB8, 0x18, 0xBE, 0xB1, 0x30, 0x00, 0x01, 0x00, 0x36, 0xD9, 0x0E, 0xD5, 0x78, 0x9C, 0x63, 0x60,
-    0x00, 0x02, 0x55, 0x10, 0x71, 0xF9, 0x3E, 0x90, 0x48, 0xF8, 0x7F, 0x1E, 0x48, 0x7E, 0xFF, 0xCF,
-    0x09, 0x62, 0xE6, 0x03, 0x99, 0x5F, 0xFE, 0xB3, 0x31, 0x30, 0x08, 0xFC, 0xAB, 0x07, 0x32, 0x17,
-    0xFC, 0xE7, 0x01, 0x92, 0x9F, 0xFF, 0x33, 0x01, 0xC9, 0x5F, 0xF3, 0x81, 0x84, 0xC0, 0x7F, 0x7D,
-    0xB0, 0x16, 0x6E, 0x20, 0xB9, 0x01, 0xA4, 0x8E, 0xE1, 0x03, 0x58, 0xF2, 0xE3, 0x7F, 0x90, 0x79,
-    0x9F, 0x41, 0xE6, 0x31, 0x7C, 0x39, 0x0F, 0x26, 0xF7, 0x23, 0xD8, 0x10, 0x71, 0x88, 0x9A, 0x07,
-    0xFF, 0x99, 0xC1, 0x06, 0xB3, 0x83, 0xCD, 0xE1, 0x81, 0x9B, 0xC9, 0xF0, 0x6B, 0x3D, 0x88, 0xFC,
-    0x04, 0x96, 0x9E, 0xF0, 0x9F, 0x17, 0x24, 0xF1, 0x0F, 0x2C, 0xF4, 0xF9, 0x3F, 0x07, 0x90, 0x0C,
-    0xF8, 0x0F, 0xE6, 0x7C, 0xFD, 0x6F, 0x0B, 0x24, 0x0D, 0xFE, 0xBD, 0x07, 0x71, 0x26, 0x80, 0x85,
-    0x18, 0x18, 0x00, 0x43, 0xD7, 0x3A, 0x48, 0x78, 0x9C, 0x33, 0x60, 0x65, 0x00, 0x81, 0x8F, 0xF7,
-    0x99, 0x41, 0xD4, 0x83, 0xFF, 0xF9, 0x20, 0x4A, 0xE0, 0xD7, 0x7F, 0x0E, 0x10, 0x5D, 0xF0, 0xBF,
-    0x1E, 0x2C, 0xFB, 0xF5, 0x3F, 0x0B, 0x84, 0x2B, 0x07, 0xE6, 0xFE, 0x99, 0x0F, 0xA6, 0x3E, 0xFD,
-    0x67, 0x02, 0x51, 0x0B, 0xFE, 0x73, 0x82, 0x28, 0x83, 0xFF, 0x7C, 0x60, 0xD1, 0xBF, 0xFE, 0x60,
-    0xEA, 0x47, 0x3F, 0x98, 0xFA, 0x72, 0x1E, 0x62, 0xFC, 0x7B, 0x30, 0xF5, 0xE1, 0x3F, 0x03, 0xC4,
-    0x16, 0x46, 0x24, 0xEA, 0x03, 0x8C, 0x02, 0xCB, 0x7D, 0xBE, 0x0F, 0xA6, 0xBE, 0xAD, 0x07, 0x53,
-    0xBF, 0x21, 0xCE, 0xF9, 0x2F, 0x0F, 0xB1, 0x9E, 0x1B, 0xA2, 0x0D, 0xEC, 0xE4, 0x1F, 0xF7, 0x21,
-    0xB6, 0xDA, 0x83, 0xA8, 0x87, 0x60, 0x37, 0x08, 0xFC, 0x05, 0xDB, 0x76, 0xE9, 0xBF, 0x2C, 0x90,
-    0x4C, 0xF8, 0x7F, 0x1F, 0x64, 0xEE, 0xC7, 0xFF, 0x5C, 0x20, 0xB1, 0x03, 0x79, 0x0C, 0x48, 0x00,
-    0x00, 0x4F, 0x73, 0x3A, 0x1E, 0x78, 0x9C, 0x63, 0x60, 0x10, 0x60, 0x66, 0x00, 0x82, 0x0D, 0xF2,
-    0x60, 0x92, 0x9F, 0x81, 0xE1, 0x80, 0xCE, 0x02, 0xFE, 0x09, 0x7A, 0x07, 0xFE, 0xB7, 0xD9, 0xFE,
-    0xD5, 0x67, 0x38, 0xFA, 0xFE, 0x7F, 0x1D, 0x23, 0x03, 0xC3, 0xAF, 0xFB, 0x40, 0xE2, 0xD9, 0xFB,
-    0xFF, 0xF3, 0x99, 0x2E, 0xBC, 0x6F, 0xD1, 0xFB, 0x63, 0xBF, 0x40, 0x6A, 0x01, 0x7F, 0x81, 0x0C,
-    0x44, 0x3D, 0x8C, 0x14, 0x00, 0x2A, 0x01, 0x00, 0xA9, 0xC3, 0x17, 0x5A, 0x78, 0x9C, 0x63, 0x60,
-    0x60, 0x60, 0xB8, 0x22, 0xCD, 0x00, 0x05, 0x7F, 0xF2, 0x61, 0xAC, 0xBF, 0x64, 0xB2, 0x36, 0xBC,
-    0x7B, 0xF7, 0xEE, 0xFF, 0xFF, 0x77, 0xEF, 0xEE, 0xB1, 0x7F, 0xF9, 0x0F, 0x05, 0xFC, 0x07, 0xA0,
-    0x8C, 0xF7, 0x1C, 0x94, 0x98, 0x0C, 0x76, 0x5F, 0x3C, 0x8C, 0xB5, 0x99, 0x13, 0x44, 0x02, 0x00,
-    0xD1, 0x78, 0x2F, 0x66, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x58, 0xF0, 0x9F, 0xFD, 0xC7, 0x7F, 0xFF,
+const uint8_t Quicksand_18Bitmaps[9154] = {
+    0x03, 0x00, 0x53, 0x60, 0xFA, 0xEA, 0xFF, 0x73, 0xFE, 0xCF, 0xF9, 0x3F, 0xFA, 0xBF, 0xD7, 0x7F,
+    0xAF, 0xFF, 0x96, 0xFF, 0x35, 0xFE, 0x6B, 0xFC, 0x17, 0xFF, 0xCF, 0xF6, 0x9F, 0xED, 0x3F, 0xE9,
+    0x7F, 0x92, 0xFF, 0x28, 0xFF, 0x81, 0xFF, 0x03, 0xFF, 0x03, 0x3E, 0x05, 0xB0, 0xB9, 0x02, 0x8C,
+    0xDF, 0xEB, 0xFF, 0x9C, 0xFF, 0x73, 0xFE, 0x6B, 0x3C, 0x00, 0x63, 0x70, 0x66, 0x64, 0x10, 0x30,
+    0x06, 0x5A, 0xC4, 0x07, 0x0A, 0x9B, 0x0D, 0x40, 0xAF, 0x01, 0xD3, 0xE5, 0x01, 0xA0, 0x55, 0x5F,
+    0xDE, 0x03, 0x05, 0x98, 0x40, 0x11, 0xF3, 0x01, 0xE8, 0xD8, 0x1F, 0xF1, 0x0C, 0x1F, 0x81, 0xA1,
+    0xFD, 0x8B, 0x9F, 0xE1, 0x33, 0xD0, 0x3F, 0xC0, 0x4C, 0xFD, 0x15, 0x98, 0xE4, 0xFF, 0xB2, 0x31,
+    0x7C, 0x03, 0xBA, 0x05, 0xE8, 0xBE, 0x6F, 0xC0, 0x60, 0xDA, 0x0F, 0x0F, 0x4F, 0x00, 0x03, 0x51,
+    0xCC, 0x70, 0x82, 0x61, 0x02, 0xC8, 0x7D, 0x07, 0xD6, 0x43, 0xC3, 0x0A, 0xE4, 0x26, 0x88, 0xE3,
+    0x3E, 0x80, 0xA8, 0xCF, 0x10, 0x71, 0x30, 0xF5, 0x0D, 0x12, 0x23, 0x60, 0xEA, 0x27, 0x24, 0xC1,
+    0xFD, 0x04, 0xF9, 0xF4, 0x0F, 0x30, 0xEC, 0x14, 0xDE, 0xBC, 0xFB, 0xFF, 0xFE, 0xDD, 0x3B, 0x20,
+    0x71, 0x8F, 0x1D, 0x9A, 0xD5, 0x40, 0x80, 0x5F, 0x01, 0x96, 0x2D, 0xFF, 0xBF, 0xE7, 0x00, 0xF9,
+    0x83, 0x13, 0x56, 0x78, 0x40, 0xA8, 0x09, 0x90, 0xD8, 0x05, 0x53, 0x07, 0xFE, 0x43, 0xD3, 0x3F,
+    0x23, 0x2C, 0x94, 0x18, 0x3E, 0x80, 0xC2, 0xEC, 0x23, 0x24, 0xFC, 0x3E, 0x81, 0xA8, 0x2F, 0x90,
+    0x4C, 0x03, 0xA6, 0xBE, 0x83, 0x82, 0x3B, 0x30, 0xED, 0xD7, 0xFA, 0xB4, 0xB4, 0xB4, 0x3F, 0xFD,
+    0x69, 0x2C, 0xF0, 0x12, 0xE0, 0x3F, 0x30, 0x37, 0x20, 0xD8, 0xF5, 0x0C, 0x85, 0xE5, 0xFF, 0xEB,
+    0xCA, 0xCB, 0xA7, 0xFF, 0xAF, 0x2D, 0x67, 0x83, 0x06, 0x61, 0x00, 0x24, 0xF4, 0x02, 0x40, 0xB1,
+    0x57, 0x00, 0x09, 0xA1, 0x06, 0x50, 0xF8, 0x2F, 0x80, 0x04, 0xD2, 0x06, 0x10, 0x75, 0x01, 0xE6,
+    0x1C, 0x98, 0x3B, 0x80, 0xA1, 0x09, 0xB2, 0x76, 0x02, 0x38, 0x14, 0x00, 0x03, 0xDB, 0x22, 0x09,
+    0xF3, 0xC4, 0x97, 0xF9, 0x30, 0xD6, 0xD7, 0xF5, 0x18, 0x2C, 0xBC, 0xF9, 0xE8, 0xFF, 0xFC, 0x5F,
+    0xF7, 0x7F, 0xFD, 0xBF, 0xCF, 0x28, 0xF0, 0x7F, 0x3D, 0xE3, 0xD7, 0xF5, 0x02, 0x3F, 0x40, 0x99,
+    0x9C, 0x07, 0xA4, 0xD7, 0xE0, 0x1D, 0xE3, 0x02, 0xA0, 0x77, 0x20, 0xA6, 0x6C, 0x00, 0x46, 0x20,
+    0x84, 0x05, 0x2A, 0x1E, 0x20, 0x2C, 0x50, 0xDC, 0x40, 0x58, 0x0A, 0xC0, 0xCC, 0x05, 0xB5, 0xED,
+    0xC7, 0xFF, 0xF5, 0x3F, 0xD7, 0x43, 0xBD, 0x0D, 0xCC, 0x6A, 0x4C, 0xD0, 0x6C, 0x02, 0xCF, 0x75,
+    0x53, 0xFE, 0x01, 0x73, 0x22, 0x33, 0x34, 0x51, 0x40, 0x73, 0x0D, 0xD0, 0x94, 0x4D, 0xFF, 0xDF,
+    0xC3, 0xDC, 0xFC, 0x1D, 0xE2, 0x59, 0x20, 0x6B, 0x03, 0x24, 0xC0, 0x80, 0xAC, 0x00, 0x48, 0xCC,
+    0x01, 0x59, 0x0E, 0xFF, 0x79, 0x0E, 0x49, 0x83, 0x59, 0x05, 0xFF, 0xB9, 0x7E, 0x00, 0xF3, 0x34,
+    0x90, 0xF5, 0xE8, 0x3F, 0xDB, 0x97, 0xFF, 0xF3, 0x81, 0x2E, 0x48, 0x00, 0x96, 0x38, 0x04, 0xF3,
+    0xBD, 0xC2, 0x8F, 0xFD, 0x8C, 0xB8, 0xC3, 0x0A, 0x89, 0xF5, 0xD0, 0x9F, 0x01, 0x05, 0x00, 0x00,
+    0x63, 0x60, 0x68, 0x8D, 0x80, 0x08, 0x06, 0x40, 0xF2, 0xD7, 0x7F, 0x3B, 0x48, 0x58, 0x10, 0xC8,
+    0xB7, 0x1F, 0x81, 0x36, 0xFC, 0xE1, 0x87, 0x45, 0xD9, 0x17, 0x20, 0xF1, 0xDD, 0x1F, 0x96, 0x87,
+    0xBF, 0xDB, 0x43, 0x44, 0x3E, 0x82, 0x9D, 0xF3, 0x1D, 0x18, 0x9A, 0x9F, 0xEB, 0x61, 0x71, 0xFB,
+    0x0D, 0x22, 0x17, 0x00, 0x09, 0x43, 0xB0, 0x3E, 0x7B, 0x60, 0x04, 0x80, 0xDD, 0xFD, 0x01, 0x18,
+    0x38, 0x7F, 0xF8, 0x18, 0x7E, 0xD5, 0x43, 0xFD, 0x2B, 0xD9, 0xF8, 0x9F, 0x1D, 0xAA, 0x90, 0x41,
+    0x00, 0x98, 0xA5, 0xCF, 0xC3, 0x14, 0x32, 0x30, 0x1C, 0xFC, 0xFF, 0x5F, 0x1A, 0xA4, 0xD0, 0x60,
+    0x45, 0x24, 0x88, 0x9B, 0x6C, 0x06, 0x36, 0xF1, 0x07, 0x38, 0x4F, 0x43, 0xA2, 0x94, 0xA9, 0xE0,
+    0xFF, 0xF9, 0x7F, 0xB0, 0x6C, 0x5D, 0xCF, 0xF0, 0xF1, 0x3E, 0xE3, 0x02, 0x48, 0xA8, 0x3A, 0x00,
+    0x15, 0x7E, 0xF3, 0x07, 0x06, 0x0D, 0x37, 0x54, 0x21, 0xC3, 0x2F, 0xA0, 0x3F, 0x7E, 0x83, 0xB3,
+    0xF0, 0x2F, 0x60, 0x2C, 0xFD, 0x05, 0x26, 0x95, 0x9F, 0xF2, 0x60, 0x85, 0xBC, 0x10, 0xDE, 0x0F,
+    0x79, 0x70, 0xCA, 0x61, 0x06, 0xBB, 0x8E, 0xE1, 0x27, 0x48, 0xE5, 0x4F, 0x50, 0x74, 0x82, 0x54,
+    0xFD, 0xE1, 0x85, 0x2A, 0x64, 0xF8, 0x52, 0x0F, 0x8C, 0x12, 0x4E, 0xA8, 0x42, 0x60, 0x14, 0x8A,
+    0x5D, 0x01, 0x39, 0x16, 0x52, 0x2A, 0x19, 0x80, 0xB2, 0x0F, 0x48, 0x0D, 0xC4, 0x33, 0x97, 0xE1,
+    0x31, 0x01, 0x06, 0xC1, 0xC0, 0x44, 0x06, 0x00, 0x03, 0x47, 0xFC, 0x8C, 0x4A, 0xA8, 0x37, 0x19,
+    0x16, 0x82, 0x52, 0x1B, 0xC4, 0x1E, 0x85, 0x7F, 0xE0, 0x1C, 0x0F, 0x75, 0x50, 0x1C, 0xA3, 0xC1,
+    0x4F, 0x88, 0x35, 0xDF, 0x40, 0x59, 0xD9, 0x01, 0x92, 0xD2, 0x7F, 0x81, 0x7D, 0x75, 0x05, 0xEC,
+    0xEF, 0x3F, 0xF1, 0x88, 0x10, 0xFD, 0x93, 0x8F, 0x60, 0xC3, 0xDC, 0x02, 0x09, 0x52, 0x78, 0x9A,
+    0x07, 0x06, 0x18, 0x2F, 0x9C, 0x7D, 0x84, 0x60, 0x38, 0x4E, 0xF8, 0xAF, 0xCB, 0xF0, 0x03, 0x14,
+    0x2C, 0x0E, 0xDE, 0x40, 0x6F, 0x32, 0x02, 0x95, 0x01, 0xC3, 0xF5, 0xC0, 0x7D, 0x86, 0x1F, 0xF3,
+    0xC1, 0x89, 0x8E, 0x85, 0xE1, 0xC3, 0x79, 0x86, 0xDF, 0xFE, 0xE0, 0xE8, 0xF7, 0x67, 0xF8, 0x3A,
+    0x9F, 0xE1, 0xAF, 0x3D, 0xC4, 0x00, 0x56, 0xA0, 0x20, 0x24, 0x0A, 0x36, 0xFC, 0x9F, 0x0F, 0x74,
+    0xF4, 0x6F, 0x48, 0x3C, 0xFC, 0x02, 0x65, 0x17, 0xB0, 0x4F, 0xC0, 0xA1, 0xC0, 0x08, 0x4C, 0x18,
+    0xDC, 0x50, 0xB6, 0x2E, 0x30, 0xE5, 0x80, 0xCA, 0x39, 0x50, 0x49, 0x08, 0x34, 0xF7, 0xC7, 0xFF,
+    0xFB, 0x9D, 0x2B, 0xFE, 0xFD, 0xCF, 0xBF, 0x08, 0x74, 0x49, 0x02, 0xA4, 0x04, 0x60, 0x06, 0xA7,
+    0xB5, 0x45, 0xA0, 0x32, 0x10, 0xE8, 0xA0, 0x82, 0x3E, 0x50, 0xFA, 0x08, 0x35, 0x85, 0xB8, 0x13,
+    0x00, 0x63, 0x70, 0x66, 0x2A, 0xF8, 0xCF, 0xBF, 0xE1, 0x3F, 0xCF, 0x81, 0xFF, 0xEC, 0x0F, 0xFE,
+    0x33, 0x7D, 0x78, 0xCF, 0xF0, 0x71, 0x3E, 0xC3, 0x67, 0x7F, 0x86, 0xAF, 0xFC, 0x0C, 0xDF, 0xB8,
+    0x18, 0xBE, 0x81, 0xBD, 0x0F, 0x00, 0x03, 0xD3, 0xAA, 0x20, 0xE2, 0xF2, 0x7D, 0xB0, 0x9A, 0xF3,
+    0x60, 0x1F, 0x72, 0x82, 0x98, 0x20, 0x2F, 0x7C, 0x01, 0xE9, 0x11, 0xF8, 0x57, 0x0F, 0xF6, 0x21,
+    0x0F, 0x38, 0x54, 0x40, 0x76, 0xFC, 0x22, 0x9C, 0x6F, 0x21, 0xDE, 0x82, 0x78, 0x18, 0x12, 0xD7,
+    0x10, 0x36, 0x44, 0x1C, 0xA2, 0xE6, 0x01, 0xD8, 0x21, 0x0B, 0xC0, 0x3E, 0x4B, 0x00, 0x1B, 0x0F,
+    0x31, 0x93, 0xE1, 0xD7, 0x7A, 0x88, 0x7F, 0x98, 0xC1, 0x1E, 0xE7, 0x05, 0xA7, 0xC5, 0xF5, 0x90,
+    0x48, 0xE1, 0x00, 0xC7, 0xED, 0x7A, 0x48, 0x7A, 0xB0, 0x05, 0xC5, 0xCD, 0x3F, 0x70, 0x68, 0x4E,
+    0x80, 0x46, 0x05, 0x00, 0x33, 0x80, 0xD8, 0xF4, 0xF1, 0x3E, 0x33, 0x24, 0x78, 0xF2, 0xA1, 0x09,
+    0x8D, 0x50, 0xB8, 0x23, 0x6C, 0x5B, 0x00, 0xB1, 0xDD, 0x00, 0x9A, 0xF6, 0x09, 0xFB, 0x17, 0x68,
+    0x0B, 0x23, 0x12, 0xF5, 0x01, 0x46, 0x31, 0x10, 0x93, 0x1E, 0x40, 0xDA, 0xC0, 0x4E, 0xFE, 0x71,
+    0x1F, 0x62, 0xAB, 0x3D, 0x22, 0x06, 0x05, 0xFE, 0x9E, 0x87, 0xE4, 0x0C, 0x59, 0xB0, 0x6F, 0x41,
+    0x09, 0x14, 0x18, 0xA6, 0xE0, 0xD0, 0x3A, 0x90, 0x87, 0x94, 0x1F, 0x19, 0x00, 0x03, 0xAA, 0x01,
+    0xB3, 0x37, 0x80, 0x83, 0x7C, 0x03, 0x30, 0x21, 0x1F, 0xD0, 0x59, 0xC0, 0x3F, 0x41, 0xEF, 0xC0,
+    0xFF, 0x36, 0xDB, 0xBF, 0xFA, 0x0C, 0x47, 0xDF, 0x03, 0x23, 0x1C, 0x14, 0xB6, 0x40, 0xE2, 0xD9,
+    0xFB, 0xFF, 0xF3, 0x99, 0x2E, 0xBC, 0x6F, 0xD1, 0xFB, 0x63, 0xBF, 0x40, 0x6A, 0x01, 0x7F, 0x81,
+    0x0C, 0x44, 0x3D, 0x8C, 0x14, 0x00, 0x2A, 0x01, 0x00, 0x03, 0x51, 0x57, 0xA4, 0x61, 0x9E, 0xF8,
+    0x03, 0x73, 0x35, 0xC3, 0x5F, 0x32, 0x59, 0x1B, 0xDE, 0xBD, 0x7B, 0xF7, 0xFF, 0xFF, 0xBB, 0x77,
+    0xF7, 0xD8, 0xBF, 0x40, 0x53, 0xC2, 0x7F, 0xFE, 0x03, 0x50, 0xC6, 0x7B, 0x0E, 0x4A, 0x4C, 0x06,
+    0xBB, 0x2F, 0x1E, 0xC6, 0xDA, 0x0C, 0xF6, 0x32, 0x00, 0x03, 0xBB, 0x9C, 0xFD, 0xC7, 0x7F, 0xFF,
     0xEB, 0xFF, 0xE6, 0x33, 0x7C, 0x58, 0xCF, 0xF0, 0x31, 0x3F, 0xE0, 0x2F, 0xEF, 0xB7, 0xF7, 0x4C,
-    0x0B, 0x25, 0x18, 0x00, 0xBA, 0xFC, 0x0D, 0x5A, 0x78, 0x9C, 0x53, 0x50, 0x52, 0x52, 0x12, 0x62,
-    0xF8, 0xF5, 0x1F, 0x08, 0x58, 0xFF, 0x81, 0x48, 0xCE, 0xAB, 0x77, 0xEF, 0xDE, 0x3D, 0xCB, 0x04,
-    0x00, 0x9F, 0xD2, 0x0E, 0xD2, 0x78, 0x9C, 0x53, 0x60, 0xFC, 0x15, 0xFF, 0x7F, 0xFE, 0xFF, 0xF9,
-    0xDF, 0xED, 0x00, 0x1C, 0xD6, 0x05, 0xEC, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x80, 0x8B, 0x7A, 0x50,
-    0x06, 0xC3, 0x8F, 0x78, 0x28, 0x43, 0xE0, 0x3F, 0x1F, 0x94, 0xD5, 0xF0, 0x9F, 0x1D, 0xCA, 0xFA,
-    0xF8, 0x1E, 0xAE, 0xAC, 0x7E, 0x60, 0x95, 0xF1, 0xC3, 0x95, 0x71, 0xC0, 0x94, 0xFD, 0x67, 0x84,
-    0x29, 0xEB, 0x87, 0x2B, 0x93, 0xA7, 0x5C, 0xD9, 0x4F, 0x4C, 0x65, 0x13, 0xB0, 0x28, 0xFB, 0x0A,
-    0x53, 0xC6, 0x70, 0x90, 0x1B, 0xC6, 0x02, 0x00, 0x0F, 0xC6, 0x33, 0xBD, 0x78, 0x9C, 0x4D, 0x8F,
-    0xBF, 0x0E, 0xC1, 0x60, 0x14, 0xC5, 0x8F, 0xFF, 0x44, 0x85, 0xC5, 0x5C, 0x8F, 0xD0, 0x27, 0xC0,
-    0x62, 0x36, 0x78, 0x10, 0x76, 0x83, 0x4E, 0x12, 0x93, 0xD1, 0xD8, 0xBE, 0x81, 0xBE, 0x41, 0x13,
-    0xA3, 0x45, 0xE3, 0x05, 0x74, 0x34, 0x22, 0x69, 0xA4, 0x54, 0x8F, 0xEF, 0x5E, 0x69, 0xE2, 0x4E,
-    0xBF, 0xDC, 0xEF, 0x9C, 0xF3, 0xDD, 0x03, 0xC0, 0xD9, 0x6D, 0xFA, 0x90, 0x71, 0x32, 0x92, 0x4D,
-    0xA1, 0xC4, 0x00, 0x4F, 0x25, 0xB3, 0x22, 0x97, 0xEB, 0x9C, 0x16, 0x10, 0x71, 0x08, 0xB8, 0x5C,
-    0x01, 0x4F, 0x56, 0x8C, 0x24, 0x65, 0x09, 0xB9, 0x27, 0xE2, 0x98, 0x0D, 0x87, 0xB6, 0x90, 0x4B,
-    0xCB, 0x15, 0xAD, 0xF8, 0xEC, 0xE0, 0x17, 0x05, 0x4E, 0x63, 0xD6, 0x94, 0xB2, 0xD5, 0x4D, 0xAD,
-    0xC0, 0x6B, 0x7B, 0x67, 0x59, 0x29, 0xF5, 0xEE, 0x26, 0x48, 0x69, 0xFF, 0x4F, 0xC5, 0x6B, 0xE1,
-    0x78, 0x6F, 0x23, 0xD6, 0x95, 0x3E, 0x73, 0x9F, 0xAD, 0x5F, 0xF2, 0x68, 0xC1, 0x8E, 0xC0, 0x98,
-    0xDD, 0x01, 0x47, 0x42, 0x3E, 0xDB, 0xC8, 0x42, 0xA1, 0x87, 0xF9, 0x34, 0x51, 0x4B, 0x76, 0x01,
-    0x02, 0x39, 0xFC, 0xC0, 0x29, 0xD0, 0xCB, 0x19, 0x1E, 0xA9, 0x09, 0x67, 0x69, 0xA9, 0x15, 0x70,
-    0x35, 0x75, 0xAB, 0x4A, 0x98, 0x4D, 0xE4, 0x8A, 0x2F, 0xCA, 0xF0, 0x64, 0x7C, 0x78, 0x9C, 0x63,
-    0x60, 0x60, 0x60, 0x10, 0x06, 0x62, 0x86, 0xCB, 0xFF, 0x19, 0x19, 0x18, 0x26, 0xFC, 0xFF, 0xCF,
-    0xC2, 0x60, 0xF0, 0x17, 0x44, 0xFE, 0xFC, 0x0F, 0x24, 0x2F, 0xFC, 0x7F, 0xFF, 0xF5, 0x3F, 0xCB,
-    0xC7, 0xFF, 0xD2, 0x1F, 0xFE, 0xB3, 0x14, 0xE4, 0x32, 0x00, 0x49, 0xA0, 0x4A, 0xFA, 0x90, 0x0F,
-    0xC0, 0x64, 0xC1, 0x7E, 0x06, 0x00, 0x3F, 0x10, 0x3B, 0x5B, 0x78, 0x9C, 0x63, 0x60, 0x10, 0x98,
-    0xD6, 0x29, 0xC6, 0x00, 0x04, 0x02, 0xBF, 0xFE, 0xFF, 0xFF, 0x2F, 0x05, 0x64, 0x7C, 0x05, 0xD2,
-    0xFF, 0xDF, 0x33, 0x31, 0x04, 0xFC, 0x7F, 0x6F, 0x1E, 0xFC, 0xEB, 0x3F, 0x1F, 0xC3, 0xE7, 0xFF,
-    0x9C, 0x0C, 0x40, 0x5E, 0x3D, 0xC3, 0xEF, 0xF9, 0x20, 0x85, 0x3F, 0xEE, 0x33, 0xFC, 0xE0, 0x01,
-    0x31, 0x3E, 0xFE, 0x67, 0x14, 0x00, 0xD1, 0x0C, 0x0F, 0xFE, 0x33, 0x83, 0x69, 0x86, 0x0B, 0x30,
-    0xC6, 0x87, 0xFF, 0x10, 0x9A, 0xE1, 0xDB, 0x79, 0x28, 0xE3, 0x6F, 0x3D, 0x84, 0x6E, 0x00, 0x1A,
-    0x08, 0x06, 0x9F, 0xFF, 0xB3, 0x81, 0x69, 0x85, 0x7F, 0x50, 0x25, 0x17, 0xFF, 0xCB, 0x41, 0x18,
-    0x7F, 0xA0, 0xA6, 0x6C, 0xF8, 0x1F, 0x0F, 0x11, 0xF8, 0x05, 0x55, 0x3A, 0xE1, 0x7F, 0x3F, 0x44,
-    0xE0, 0x07, 0xC8, 0x45, 0x40, 0x90, 0xF0, 0x7F, 0x3F, 0x44, 0xE0, 0xEB, 0x7F, 0xB0, 0x8B, 0x18,
-    0x1C, 0xFE, 0xDF, 0x67, 0x04, 0x33, 0x3E, 0xFD, 0x7F, 0x7F, 0x17, 0x08, 0xCE, 0xB2, 0xFD, 0xF8,
-    0x0F, 0x01, 0xFC, 0x8F, 0xA1, 0x0C, 0x4E, 0x00, 0xF9, 0x08, 0x52, 0x0D, 0x78, 0x9C, 0x63, 0x10,
-    0x04, 0x03, 0x06, 0x86, 0x87, 0xFF, 0xC1, 0xA0, 0x9F, 0xE1, 0x0B, 0x84, 0xF1, 0x9E, 0x61, 0xC2,
-    0x19, 0x20, 0x78, 0xF3, 0x3F, 0x9F, 0x01, 0x0C, 0x3E, 0xFF, 0xE7, 0x00, 0xD3, 0x0A, 0xFF, 0xE7,
-    0x43, 0x04, 0x1E, 0xFD, 0xE7, 0x02, 0xD3, 0x02, 0x7F, 0xF7, 0x43, 0x04, 0x2E, 0xFE, 0xE7, 0x81,
-    0x30, 0xFE, 0xDC, 0x67, 0x04, 0xD3, 0x1B, 0xFE, 0xEF, 0x37, 0x07, 0x33, 0xBE, 0x03, 0xCD, 0xF3,
-    0x05, 0x31, 0x7E, 0x82, 0x4C, 0x66, 0x07, 0x32, 0x1A, 0xCD, 0x82, 0x7F, 0xFD, 0x8F, 0x87, 0x28,
-    0x57, 0xF8, 0xFB, 0x1E, 0xC2, 0x60, 0xF8, 0xF4, 0x9F, 0x0D, 0xC2, 0x68, 0x80, 0x9A, 0xCD, 0xE0,
-    0xF0, 0x9F, 0x17, 0xAA, 0xE8, 0x3F, 0x1F, 0x84, 0x61, 0x00, 0x13, 0x49, 0xF8, 0xCF, 0x0D, 0x61,
-    0x5C, 0x00, 0x9A, 0x28, 0x02, 0x62, 0xFC, 0xF8, 0xCF, 0x38, 0xE1, 0x3D, 0x2B, 0x03, 0xC3, 0x84,
-    0xFF, 0xF5, 0x0C, 0x07, 0xFE, 0x9F, 0x4F, 0x9F, 0xF6, 0x0F, 0x68, 0x8C, 0xC1, 0x5F, 0x88, 0xB7,
-    0x80, 0x86, 0xFE, 0xFB, 0xFF, 0x7F, 0x3E, 0x13, 0xD8, 0xB0, 0x50, 0x53, 0x10, 0x05, 0x00, 0x59,
-    0x7C, 0x52, 0x63, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x01, 0x01, 0x26, 0x06, 0x28, 0xF8, 0x12, 0x0F,
-    0x65, 0x28, 0xFC, 0xEF, 0x87, 0xB2, 0x2E, 0xFC, 0x9F, 0x0F, 0x65, 0xFD, 0x82, 0xB1, 0x12, 0xFE,
-    0xC3, 0x58, 0x9F, 0xFF, 0xFF, 0x84, 0xB0, 0x04, 0xFE, 0xE5, 0x7F, 0x87, 0xB0, 0x36, 0xFC, 0xE7,
-    0x84, 0xB2, 0x7E, 0xDC, 0x67, 0x80, 0xB0, 0x1C, 0xFE, 0xEB, 0x43, 0x59, 0x9F, 0xFE, 0xB3, 0x42,
-    0x59, 0x7F, 0x81, 0xE6, 0x83, 0x59, 0x0B, 0xFE, 0xF3, 0x40, 0x59, 0xDF, 0xDE, 0x33, 0x42, 0x58,
-    0x06, 0xFF, 0xFD, 0x19, 0x20, 0xAC, 0x87, 0xFF, 0xE7, 0xCD, 0x9C, 0x39, 0xF3, 0xCF, 0xFD, 0x99,
-    0xEC, 0xDF, 0xFF, 0x43, 0x41, 0xFE, 0x67, 0x18, 0xCB, 0x5F, 0xC0, 0x18, 0x04, 0x7E, 0xAC, 0x37,
-    0x66, 0x84, 0xB8, 0xE6, 0x3B, 0xCC, 0xA5, 0x44, 0xB3, 0xBE, 0xC1, 0x7C, 0xC9, 0x70, 0xD1, 0x8E,
-    0x81, 0x01, 0x00, 0x52, 0x76, 0x52, 0xBA, 0x78, 0x9C, 0x63, 0x60, 0x10, 0x04, 0x01, 0x06, 0x06,
-    0x86, 0x9F, 0xFF, 0x41, 0x60, 0x3F, 0x83, 0xC0, 0x7F, 0x08, 0x60, 0x30, 0xF8, 0x7F, 0xEE, 0x0C,
-    0x10, 0xD4, 0x30, 0x24, 0xFC, 0x67, 0x67, 0x00, 0x83, 0x86, 0xFF, 0x2C, 0x10, 0xC6, 0x82, 0xFF,
-    0x4C, 0x10, 0xC6, 0x85, 0xFF, 0x10, 0x9A, 0xE1, 0xC3, 0x7D, 0x28, 0xE3, 0xD3, 0x7A, 0x85, 0xB2,
-    0x0C, 0x66, 0x20, 0xE3, 0xCB, 0xF9, 0xBF, 0xFF, 0xFF, 0xDF, 0x67, 0x63, 0x60, 0xF8, 0x06, 0x35,
-    0x98, 0xE1, 0xFB, 0xFF, 0xF5, 0x6E, 0xAD, 0x7F, 0xFF, 0x73, 0x33, 0x1C, 0xAC, 0x65, 0x64, 0x60,
-    0x28, 0xF8, 0x5F, 0x0F, 0xD5, 0xF2, 0x1D, 0x66, 0xC8, 0x85, 0xFF, 0xAC, 0x30, 0x8B, 0x38, 0x20,
-    0x8C, 0x80, 0xFF, 0x5C, 0x68, 0x8C, 0x82, 0xFF, 0x9C, 0x10, 0xC6, 0x81, 0xFF, 0x6C, 0x10, 0xC6,
-    0xE7, 0xFF, 0x8C, 0x09, 0x20, 0x77, 0x29, 0xFC, 0x5B, 0xCF, 0xF0, 0x7D, 0x3D, 0x13, 0xC8, 0x3C,
-    0x39, 0xA0, 0xA5, 0xE7, 0x57, 0xFD, 0xF9, 0xFF, 0x9E, 0x19, 0x68, 0x14, 0x08, 0x68, 0x03, 0xE5,
-    0x27, 0xFD, 0xFD, 0xFF, 0xDE, 0x0B, 0xA2, 0x45, 0x89, 0x11, 0x44, 0x02, 0x00, 0x04, 0x54, 0x56,
-    0x87, 0x78, 0x9C, 0x35, 0x8E, 0xB1, 0x0E, 0x01, 0x51, 0x10, 0x45, 0x67, 0xC9, 0x66, 0x6D, 0x44,
-    0x76, 0x7F, 0x41, 0x2D, 0xAC, 0x52, 0x27, 0xBE, 0xC0, 0x36, 0x5A, 0xAB, 0xD6, 0xF0, 0x07, 0x8A,
-    0x2D, 0x54, 0xC2, 0x1F, 0xF0, 0x11, 0xD4, 0xAB, 0xA0, 0x52, 0xD0, 0xA8, 0xC5, 0x17, 0xBC, 0x10,
-    0x11, 0x8F, 0xF5, 0xAE, 0xF7, 0xE6, 0xC5, 0x14, 0x73, 0x4F, 0x31, 0x73, 0xEF, 0x25, 0xD2, 0xB3,
-    0xA9, 0x11, 0xCF, 0x19, 0x4B, 0xD6, 0x15, 0xD0, 0x35, 0x1A, 0xE6, 0x98, 0x3B, 0x06, 0xB6, 0xC8,
-    0x58, 0xE9, 0x8D, 0x12, 0xEB, 0x00, 0x13, 0xFB, 0x72, 0x85, 0x6F, 0xE1, 0x75, 0xB4, 0x1A, 0xA2,
-    0x6D, 0x61, 0x0C, 0x3F, 0x3D, 0x0C, 0xF9, 0x79, 0x0D, 0xA0, 0x4F, 0x74, 0x13, 0x4A, 0x03, 0x3C,
-    0x7A, 0x02, 0xAD, 0xEA, 0x1E, 0x09, 0x49, 0xD4, 0x8D, 0xA9, 0x70, 0x72, 0x14, 0xF8, 0xD2, 0x53,
-    0xDC, 0x20, 0x46, 0x45, 0x71, 0x03, 0x42, 0xA0, 0x22, 0x06, 0x15, 0xE5, 0x7F, 0x90, 0x89, 0x0D,
-    0x0A, 0x1E, 0x99, 0x0D, 0x2A, 0x9F, 0xE0, 0x6A, 0xB8, 0xC3, 0x8D, 0x31, 0x22, 0x6A, 0x7E, 0x75,
-    0x17, 0x89, 0xD9, 0xF4, 0x83, 0x06, 0xD1, 0xC2, 0x64, 0x5E, 0x8C, 0xFD, 0x0E, 0x10, 0x1E, 0x7B,
-    0x74, 0x7A, 0x45, 0xBD, 0x7F, 0xEE, 0x5E, 0x57, 0x78, 0x78, 0x9C, 0x63, 0x10, 0x04, 0x03, 0x46,
-    0x86, 0xEF, 0xFF, 0x21, 0x80, 0xF5, 0x0F, 0x94, 0xC1, 0xB5, 0xE5, 0x0C, 0x08, 0xFC, 0xF9, 0xCF,
-    0xCA, 0x00, 0x06, 0xDF, 0xDE, 0x43, 0x68, 0x86, 0xBF, 0xF5, 0x10, 0xDA, 0xE1, 0xBF, 0x3C, 0x84,
-    0xB1, 0xE1, 0x3F, 0x27, 0x84, 0xF1, 0xE9, 0x3F, 0x13, 0x84, 0xF1, 0x73, 0x3F, 0x84, 0x16, 0xF8,
-    0xEF, 0x0F, 0x61, 0x14, 0xFC, 0xE7, 0x85, 0x30, 0x1E, 0xFC, 0x67, 0x43, 0x37, 0xAE, 0x9F, 0x1A,
-    0xC6, 0x7D, 0x85, 0x19, 0xF7, 0x07, 0x6A, 0x9C, 0x01, 0xCC, 0xB8, 0x86, 0xFF, 0x5C, 0x50, 0x0B,
-    0xDE, 0x43, 0x8D, 0x83, 0x01, 0x00, 0x94, 0xF1, 0x3C, 0x55, 0x78, 0x9C, 0x3D, 0x4F, 0x4D, 0x0E,
-    0xC1, 0x60, 0x10, 0x7D, 0x94, 0x08, 0x1A, 0xF9, 0x96, 0x16, 0x84, 0xD8, 0xD9, 0x49, 0x1C, 0xA0,
-    0xBD, 0x01, 0x37, 0xC0, 0x09, 0x74, 0x67, 0xC9, 0x0D, 0xAC, 0x5D, 0xC1, 0xCA, 0x0D, 0x1A, 0x27,
-    0xE0, 0x06, 0x1F, 0x27, 0xA8, 0x46, 0x24, 0x68, 0xF5, 0x99, 0xA9, 0x9F, 0xB7, 0x99, 0x97, 0x37,
-    0x33, 0x6F, 0xDE, 0x00, 0x30, 0xC3, 0x22, 0x14, 0xD3, 0x94, 0x51, 0x53, 0xAA, 0x49, 0x49, 0x46,
-    0x0E, 0x70, 0xA4, 0xDD, 0x24, 0xF4, 0x80, 0x07, 0xCB, 0xE8, 0xA6, 0x16, 0x86, 0x23, 0xE9, 0x9F,
-    0x59, 0x1E, 0xD3, 0x15, 0x12, 0xB0, 0x16, 0xB0, 0x2A, 0xC4, 0xA7, 0xFB, 0x27, 0xFE, 0xAF, 0x85,
-    0xEC, 0x33, 0x5C, 0xC2, 0x2D, 0x2A, 0x89, 0x69, 0x08, 0xAC, 0x18, 0x2E, 0x9E, 0xAC, 0x8B, 0x7C,
-    0x97, 0x13, 0x07, 0xA8, 0xA2, 0x68, 0xA9, 0xD0, 0xC7, 0x2C, 0xB3, 0xE2, 0xA0, 0x5B, 0x7B, 0x56,
-    0x77, 0xAC, 0x08, 0xE9, 0xB2, 0x73, 0x61, 0x41, 0xD3, 0x25, 0x93, 0x38, 0xCA, 0x63, 0x3E, 0x96,
-    0x31, 0x73, 0xF2, 0x9C, 0x9F, 0xC4, 0x5C, 0x90, 0x79, 0x2B, 0xB6, 0x73, 0xB3, 0x86, 0xC9, 0xAC,
-    0x03, 0xA3, 0x79, 0xAF, 0xB4, 0xDB, 0x94, 0x6B, 0x60, 0xF0, 0xD2, 0x13, 0x95, 0xEF, 0x83, 0xFD,
-    0x7C, 0x15, 0x3D, 0xF5, 0x7C, 0x03, 0x06, 0x32, 0x64, 0x29, 0x78, 0x9C, 0x2D, 0x8E, 0x21, 0x0E,
-    0xC2, 0x50, 0x10, 0x44, 0xB7, 0x29, 0x82, 0x26, 0xA4, 0xF4, 0x02, 0xA4, 0xDF, 0x23, 0x3E, 0xC1,
-    0x54, 0x52, 0x85, 0x04, 0x12, 0x0E, 0x80, 0xC1, 0x73, 0x05, 0x1C, 0x86, 0xA4, 0x47, 0x00, 0x87,
-    0x40, 0xC0, 0x0D, 0xE0, 0x08, 0x28, 0x1C, 0x8A, 0x10, 0x64, 0x13, 0x8A, 0x69, 0x4B, 0xFF, 0xB0,
-    0xBF, 0xDB, 0x35, 0xF3, 0x32, 0x9B, 0xDD, 0x19, 0x22, 0x75, 0x38, 0x46, 0xC4, 0x13, 0x94, 0x00,
-    0xFA, 0x0C, 0x4F, 0xD8, 0x69, 0x91, 0x32, 0x69, 0x34, 0x7C, 0x43, 0xD3, 0x15, 0x3D, 0xB6, 0xCB,
-    0x0B, 0x7D, 0xE1, 0x30, 0xDC, 0xE0, 0xE6, 0x89, 0xBD, 0x98, 0xC1, 0xAB, 0x46, 0x16, 0x08, 0xBE,
-    0x09, 0x6B, 0x30, 0x5D, 0xA3, 0xC5, 0xD1, 0xBF, 0xA9, 0x55, 0x05, 0x9D, 0x9F, 0x2C, 0xAC, 0x11,
-    0x66, 0x70, 0x19, 0x32, 0xF8, 0x67, 0x4C, 0x88, 0x62, 0x83, 0x8E, 0x02, 0xB6, 0x9B, 0x0A, 0x68,
-    0x4B, 0xE8, 0x83, 0x53, 0x83, 0x02, 0x48, 0x3E, 0xA9, 0x2D, 0xB4, 0x1C, 0x93, 0x04, 0x11, 0x0D,
-    0x20, 0x6F, 0x39, 0xDC, 0x13, 0x28, 0x52, 0xA7, 0xD6, 0x3D, 0x16, 0xD4, 0xD4, 0x97, 0xCD, 0x0B,
-    0x75, 0x1E, 0xDD, 0x21, 0x46, 0x0C, 0xAC, 0x9A, 0x1F, 0x3B, 0x39, 0xA1, 0xB9, 0xC8, 0x1F, 0xFB,
-    0x5C, 0x57, 0x8B, 0x78, 0x9C, 0x4B, 0x10, 0xFB, 0xB9, 0xFF, 0xCF, 0xFD, 0x5F, 0xE7, 0x17, 0x59,
-    0x31, 0x60, 0x01, 0x02, 0x8C, 0xDF, 0xFA, 0x7F, 0xDF, 0xFF, 0x7D, 0xFF, 0x4B, 0x3E, 0x00, 0x0B,
-    0x97, 0x0D, 0x5C, 0x78, 0x9C, 0x63, 0x28, 0x64, 0x63, 0x60, 0xF8, 0xDB, 0xCF, 0xC0, 0xF0, 0x7F,
-    0x3F, 0x03, 0xC3, 0xBF, 0xF5, 0x0C, 0x0C, 0x4B, 0x24, 0x19, 0x48, 0x05, 0x06, 0x7F, 0x6D, 0x19,
-    0x1E, 0xFC, 0x7F, 0xCF, 0x70, 0xE1, 0xCF, 0x7F, 0x66, 0x86, 0x04, 0x20, 0x6E, 0xF8, 0xCF, 0x20,
-    0xF0, 0xA3, 0x9E, 0xE1, 0xC0, 0x7F, 0x2E, 0x86, 0x80, 0x28, 0x06, 0x06, 0x00, 0x33, 0x5F, 0x14,
-    0x0D, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x01, 0x81, 0x70, 0x06, 0x08, 0xF8, 0xFE, 0x9F, 0x19, 0x4C,
-    0x5F, 0xF9, 0xFF, 0x9F, 0x09, 0x44, 0x6F, 0xFA, 0xFF, 0x5F, 0x0B, 0x44, 0x4F, 0xFC, 0xFF, 0xDF,
-    0x06, 0x44, 0x17, 0xFC, 0xFB, 0x1F, 0x07, 0xA2, 0x1D, 0xFE, 0xFE, 0xEF, 0x07, 0xD1, 0x0A, 0xBF,
-    0xFF, 0xAF, 0x67, 0x04, 0x31, 0xBE, 0xFD, 0x3F, 0x0F, 0xD1, 0xF9, 0xF7, 0x3F, 0x07, 0xC4, 0xA8,
-    0x1F, 0xFF, 0xE7, 0x83, 0x65, 0x40, 0x6A, 0xEB, 0x21, 0x42, 0x09, 0xFF, 0xFE, 0xFB, 0x42, 0x58,
-    0x40, 0xF3, 0xB4, 0x21, 0x2C, 0xA0, 0x0D, 0x92, 0x0C, 0x50, 0x3B, 0xDF, 0xB3, 0xC1, 0x5C, 0x71,
-    0x1F, 0xA2, 0x55, 0xE0, 0xE7, 0x7F, 0x56, 0x88, 0x90, 0xC1, 0x6E, 0x06, 0x00, 0x69, 0x46, 0x2E,
-    0x1A, 0x78, 0x9C, 0x13, 0x70, 0x76, 0x01, 0x03, 0xE6, 0x07, 0xFF, 0x21, 0x60, 0xFD, 0x47, 0x28,
-    0xE3, 0xBC, 0xC3, 0x8C, 0x99, 0x60, 0xA0, 0xC1, 0x80, 0x07, 0x18, 0x43, 0x00, 0x36, 0xED, 0x33,
-    0xA1, 0xDA, 0x01, 0xF3, 0x1D, 0x2F, 0x06, 0x78, 0x9C, 0x3B, 0x2C, 0xC1, 0x00, 0x01, 0xBF, 0xDE,
-    0xB3, 0x41, 0x18, 0x5F, 0xFF, 0xDF, 0x67, 0x01, 0x33, 0x14, 0x7E, 0xFD, 0xDF, 0xCF, 0x04, 0x66,
-    0x39, 0xFC, 0xFD, 0x3F, 0x9F, 0x11, 0xCC, 0x4A, 0xF8, 0xF7, 0x3F, 0x0F, 0xA2, 0xAC, 0xE1, 0xFF,
-    0x7F, 0x5F, 0x08, 0x6B, 0xD3, 0xFF, 0xFF, 0xDA, 0x10, 0xD6, 0x95, 0xFF, 0xFF, 0x21, 0x5A, 0x19,
-    0x7E, 0xFF, 0xE7, 0x42, 0x11, 0xD9, 0xFC, 0xFF, 0xBF, 0x16, 0x88, 0x5E, 0xF8, 0xFF, 0xBF, 0x0D,
-    0x54, 0x77, 0x2C, 0xD4, 0xBC, 0x3A, 0x14, 0x1B, 0x7E, 0xC0, 0xEC, 0xFC, 0x75, 0x9E, 0x19, 0x62,
-    0x54, 0x23, 0x2B, 0xD4, 0x85, 0x00, 0x02, 0xDC, 0x2E, 0xCB, 0x78, 0x9C, 0x63, 0x60, 0x70, 0x58,
-    0xD1, 0xC5, 0xCA, 0x00, 0x04, 0x09, 0xFF, 0xFE, 0xFF, 0x7F, 0xCF, 0x0E, 0x64, 0xFC, 0xFE, 0x0F,
-    0x04, 0xFB, 0x19, 0x18, 0x0E, 0xFC, 0xBF, 0x1F, 0x51, 0xF2, 0xF7, 0x3F, 0x17, 0xC3, 0x97, 0xFF,
-    0x1C, 0x0C, 0x0C, 0x0D, 0xFF, 0xE3, 0x19, 0x2E, 0xC6, 0x83, 0x14, 0xFE, 0xBA, 0xCF, 0x00, 0x01,
-    0x1F, 0xFF, 0x33, 0x42, 0x18, 0x17, 0xFE, 0xB3, 0x40, 0x18, 0x1B, 0xFE, 0xB3, 0x42, 0x18, 0x07,
-    0x60, 0x22, 0x1F, 0xFE, 0x33, 0x41, 0x18, 0xDF, 0xA1, 0xBA, 0x02, 0xFE, 0x83, 0x0D, 0x61, 0x30,
-    0xF8, 0x05, 0x34, 0x19, 0x08, 0xAE, 0xFF, 0xFF, 0xBF, 0x1E, 0x2C, 0x00, 0xB4, 0x9D, 0x0D, 0xC2,
-    0xA8, 0x87, 0xEA, 0xFD, 0xCF, 0xCF, 0x80, 0xCE, 0xE0, 0x83, 0x32, 0x7E, 0x71, 0x42, 0x19, 0x02,
-    0x0C, 0xE8, 0x40, 0x01, 0xC6, 0xF8, 0x2B, 0x07, 0xA1, 0x0D, 0xA0, 0x36, 0x22, 0x18, 0x0C, 0xBF,
-    0x79, 0x40, 0x24, 0x00, 0x99, 0x8D, 0x38, 0x48, 0x78, 0x9C, 0x5D, 0x51, 0xBF, 0x4F, 0xC2, 0x60,
-    0x10, 0x3D, 0x7E, 0x58, 0xA2, 0x22, 0xE2, 0xE6, 0x60, 0x60, 0x30, 0x31, 0x71, 0x30, 0x30, 0x39,
-    0xB8, 0x68, 0x5C, 0x1C, 0x65, 0x76, 0x29, 0x6C, 0x3A, 0xC9, 0xE0, 0xEE, 0xEA, 0x56, 0x8D, 0x0B,
-    0xBA, 0x94, 0x98, 0x38, 0xB7, 0xFE, 0x05, 0x25, 0x12, 0x13, 0x27, 0xCA, 0x62, 0x4C, 0x1C, 0x2C,
-    0x71, 0x31, 0x71, 0x29, 0x56, 0xA0, 0x15, 0x6C, 0xCF, 0xBB, 0xAF, 0xD0, 0x04, 0x6E, 0xF8, 0xEE,
-    0xEE, 0xF5, 0xEE, 0xDD, 0xBB, 0x1E, 0x80, 0xB0, 0xEC, 0x59, 0xED, 0xE6, 0x38, 0x01, 0x91, 0x5D,
-    0xFB, 0xC8, 0xB6, 0x39, 0xC9, 0x5F, 0x10, 0x5B, 0xB7, 0xB5, 0x37, 0xC4, 0xF9, 0x30, 0x6F, 0xA2,
-    0xB1, 0xC1, 0xBE, 0xE2, 0x5B, 0x71, 0xF6, 0x55, 0x54, 0x62, 0xE1, 0x97, 0x2A, 0xE6, 0xD8, 0x0D,
-    0x8D, 0xF8, 0xA4, 0xB7, 0x67, 0xD0, 0xA3, 0x63, 0x2A, 0x22, 0x2F, 0xE1, 0x1C, 0xC0, 0xAF, 0x2C,
-    0xE6, 0x86, 0xC8, 0x28, 0x4D, 0xA0, 0x44, 0xC1, 0x13, 0x9A, 0x89, 0xC7, 0x2D, 0x80, 0x9F, 0x02,
-    0x74, 0x34, 0xCA, 0x1F, 0x48, 0xC4, 0xA1, 0x4B, 0xA5, 0x9D, 0x53, 0xF0, 0x88, 0x38, 0xEB, 0x5B,
-    0x07, 0xF7, 0xF6, 0x70, 0x97, 0x08, 0x55, 0x60, 0x4A, 0x9D, 0x15, 0xF5, 0x70, 0x19, 0xE0, 0x52,
-    0x2B, 0x23, 0x75, 0x0C, 0x34, 0x31, 0x2D, 0xC3, 0x80, 0x4E, 0x71, 0x36, 0xC8, 0x08, 0x55, 0x8B,
-    0x00, 0x75, 0xB5, 0x2B, 0x73, 0x98, 0x12, 0x00, 0xF5, 0x35, 0x14, 0x27, 0x0F, 0xD0, 0x46, 0x96,
-    0x5E, 0xE7, 0xF9, 0x5D, 0xB9, 0x4F, 0x4C, 0x8E, 0xC9, 0x9A, 0x1A, 0x98, 0x24, 0x1D, 0xF9, 0xC1,
-    0x12, 0x40, 0x5F, 0x65, 0xE0, 0x9B, 0xEB, 0xBC, 0xB4, 0x9B, 0xA6, 0x21, 0xE7, 0x0C, 0x78, 0x3C,
-    0x2F, 0x90, 0x18, 0xE8, 0x2B, 0x14, 0x16, 0x91, 0x1A, 0xAB, 0x36, 0xB8, 0xD4, 0xE2, 0x58, 0x04,
-    0x7C, 0x20, 0x09, 0x70, 0x64, 0x60, 0xD2, 0x36, 0x8D, 0x2D, 0x05, 0x23, 0x8D, 0x56, 0x58, 0x00,
-    0xA7, 0x00, 0xB0, 0x87, 0xE6, 0x85, 0xAF, 0xF4, 0x70, 0xFB, 0xD3, 0x10, 0xEB, 0x01, 0xB8, 0xB4,
-    0xAC, 0xA4, 0xA3, 0xF8, 0xC9, 0x75, 0xD6, 0x50, 0xFC, 0x6A, 0xAD, 0x02, 0xBC, 0xBE, 0xEF, 0x08,
-    0xF2, 0x24, 0x4C, 0xDB, 0x5F, 0x6E, 0x06, 0x70, 0x8C, 0x19, 0xA0, 0x8C, 0x6B, 0xE3, 0xA8, 0x32,
-    0xF6, 0x9E, 0x2D, 0x09, 0x7F, 0xC7, 0x27, 0x08, 0x4B, 0xEC, 0x93, 0xF5, 0x95, 0xFD, 0x67, 0x56,
-    0x1A, 0xDA, 0x95, 0xB8, 0x3C, 0xAA, 0xD1, 0xFD, 0xA0, 0x42, 0x77, 0xB7, 0x8E, 0xA6, 0xA9, 0x63,
-    0x51, 0xF4, 0x0F, 0xDE, 0xDC, 0xAA, 0x42, 0x78, 0x9C, 0x4D, 0x90, 0xDB, 0x19, 0xC1, 0x40, 0x10,
-    0x85, 0xD7, 0x2D, 0x6E, 0x41, 0x07, 0xE8, 0x80, 0x0E, 0xA2, 0x83, 0x4D, 0x07, 0x74, 0x42, 0x07,
-    0x74, 0x40, 0x07, 0x74, 0x20, 0x1D, 0x24, 0x1D, 0xD0, 0x41, 0xC4, 0x17, 0x71, 0x77, 0xCC, 0x5E,
-    0x66, 0x39, 0x0F, 0xFB, 0xFD, 0x0F, 0x73, 0xCE, 0x9C, 0x59, 0x21, 0x48, 0xE3, 0xAA, 0x70, 0xCA,
-    0xE7, 0x3F, 0x7E, 0xA6, 0x0E, 0x87, 0x40, 0x8D, 0x79, 0x01, 0xB4, 0x99, 0x8F, 0xC0, 0x88, 0xF9,
-    0xB2, 0x7E, 0x2C, 0x99, 0x5F, 0x41, 0x9E, 0x3A, 0xAB, 0x9F, 0xC0, 0x33, 0xBC, 0x82, 0x37, 0x83,
-    0x6F, 0xF8, 0x44, 0x03, 0x08, 0x0C, 0x17, 0x64, 0xBC, 0x6F, 0x0D, 0xBF, 0x29, 0xF0, 0x8C, 0x92,
-    0x2E, 0xA6, 0x16, 0x45, 0xA8, 0x2B, 0xDE, 0xA8, 0x02, 0x21, 0x3A, 0x8A, 0x33, 0x9D, 0xFD, 0x91,
-    0xEA, 0xBD, 0xEA, 0x9D, 0xB7, 0xBD, 0xB6, 0xC2, 0x88, 0xCC, 0x13, 0x8B, 0x68, 0x08, 0xB1, 0x63,
-    0xEE, 0x52, 0xF2, 0xC1, 0x6E, 0x99, 0x92, 0xC9, 0xDE, 0x5A, 0xC4, 0x14, 0x36, 0xB0, 0xAD, 0x50,
-    0x0E, 0xD1, 0xE2, 0xB6, 0xCD, 0x08, 0x15, 0xBE, 0xA2, 0x97, 0xC5, 0xEE, 0x3A, 0x99, 0x48, 0xF7,
-    0x61, 0x7D, 0xF1, 0xA7, 0x2F, 0xEE, 0xD9, 0x5A, 0xD9, 0x78, 0x9C, 0x33, 0x70, 0x01, 0x02, 0x13,
-    0x61, 0x06, 0x06, 0x86, 0xEF, 0xFF, 0xC1, 0x20, 0x97, 0x81, 0xE1, 0x37, 0x84, 0xF5, 0x9F, 0x8B,
-    0xE1, 0xF7, 0xFB, 0xDD, 0x40, 0xF0, 0xEF, 0x7F, 0x3F, 0xC3, 0xEF, 0x7E, 0xA0, 0x12, 0x06, 0x87,
-    0x7F, 0xFF, 0xA1, 0x2C, 0x86, 0x2F, 0xFF, 0x59, 0xA0, 0xAC, 0x07, 0xFF, 0xD9, 0xA0, 0xAC, 0x03,
-    0xFF, 0xD9, 0xA1, 0xAC, 0x0B, 0xFF, 0x59, 0xA1, 0xAC, 0x8F, 0xFF, 0x19, 0xA1, 0xAC, 0x5F, 0xF3,
-    0x19, 0x7E, 0xCF, 0x17, 0x14, 0x14, 0x54, 0x3C, 0xFA, 0x9F, 0x07, 0x66, 0x47, 0x3F, 0xDC, 0xB6,
-    0xF7, 0xEC, 0x40, 0xD6, 0x3B, 0x20, 0xF8, 0xFF, 0xFF, 0x3C, 0xD4, 0x0E, 0x85, 0x1F, 0xFF, 0xB9,
-    0xA0, 0x7A, 0x03, 0xFE, 0xDB, 0x43, 0x59, 0x40, 0x33, 0x60, 0xAC, 0x1F, 0xFB, 0x61, 0xAC, 0x6F,
-    0xE7, 0x31, 0xC5, 0xFE, 0xC0, 0xD4, 0x25, 0xFC, 0xF7, 0x87, 0xB0, 0x0C, 0x7E, 0xFE, 0xE7, 0x81,
-    0xD9, 0xF1, 0x9E, 0xE9, 0x17, 0xD4, 0x97, 0x3A, 0x40, 0xAF, 0x80, 0xC0, 0x7D, 0x2F, 0x06, 0x06,
-    0x00, 0x4C, 0x96, 0x81, 0xA0, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0xC0, 0xF6, 0x0A, 0x51, 0x06,
-    0x08, 0x38, 0xF6, 0x1F, 0x08, 0x72, 0xC0, 0xCC, 0xA7, 0xFF, 0xC1, 0xC0, 0x0F, 0xC8, 0x9C, 0xF0,
-    0xFF, 0xFF, 0xFE, 0x8C, 0xB6, 0xDF, 0xFF, 0xDF, 0x03, 0xD9, 0xBF, 0xFE, 0xE7, 0x81, 0x64, 0x9F,
-    0xED, 0x67, 0x60, 0x68, 0xF8, 0xBF, 0x1E, 0xA2, 0x8B, 0x99, 0x81, 0xE1, 0xF3, 0x7F, 0x4E, 0x06,
-    0x18, 0xF8, 0x73, 0x1E, 0xCE, 0x74, 0xF8, 0x6F, 0x0F, 0x67, 0x2F, 0xF8, 0xCF, 0x0D, 0x67, 0x3F,
-    0xF8, 0xCF, 0x0A, 0x67, 0x7F, 0xFA, 0xCF, 0x04, 0x67, 0x7F, 0xF9, 0xCF, 0x80, 0x60, 0xBF, 0xC7,
-    0xCE, 0xFE, 0x8C, 0xA4, 0xE6, 0x23, 0x92, 0xDE, 0x07, 0xFF, 0xD9, 0xE0, 0xEC, 0x09, 0xFF, 0x79,
-    0xE0, 0x6C, 0x83, 0xFF, 0xFE, 0x08, 0x0D, 0xBF, 0xEF, 0x23, 0xD8, 0x9F, 0x90, 0x1C, 0x54, 0xF0,
-    0xFF, 0x3C, 0xD8, 0x24, 0x05, 0x31, 0x20, 0xF1, 0xE3, 0x7F, 0x3F, 0x90, 0xA3, 0xF0, 0xF3, 0x3C,
-    0x58, 0xE2, 0xFF, 0xFD, 0xD9, 0x3B, 0xFF, 0x81, 0xFD, 0xCE, 0x70, 0x18, 0x12, 0x26, 0xDA, 0x60,
-    0x2D, 0x4B, 0xFE, 0xFD, 0xFF, 0xFF, 0xDE, 0x12, 0xAA, 0x5F, 0x21, 0xC4, 0x15, 0xA4, 0x1F, 0x00,
-    0x8F, 0xA7, 0x53, 0x36, 0x78, 0x9C, 0x33, 0x70, 0x01, 0x02, 0x13, 0x26, 0x06, 0x10, 0xF8, 0xFE,
-    0x1F, 0x0C, 0x6A, 0x40, 0xEC, 0xDF, 0x10, 0xF6, 0x7F, 0x3F, 0x10, 0xFB, 0xFC, 0x2A, 0x20, 0xF8,
-    0xF3, 0xFF, 0x3F, 0x1B, 0x90, 0x9D, 0x0F, 0x92, 0x15, 0xF8, 0xFE, 0x3F, 0x1E, 0xC6, 0x66, 0x50,
-    0xF8, 0xFB, 0x9F, 0x11, 0xC6, 0x66, 0xF8, 0xF4, 0x9F, 0x13, 0xCE, 0x2E, 0xF8, 0x2F, 0x0F, 0x67,
-    0x33, 0xFC, 0xCB, 0x47, 0xB0, 0x7F, 0xEE, 0x47, 0xB0, 0xBF, 0xBE, 0x47, 0xB0, 0x3F, 0xFD, 0x67,
-    0x84, 0xB3, 0x3F, 0xFC, 0x67, 0x42, 0x62, 0x33, 0x63, 0x65, 0x7F, 0x44, 0x52, 0xF3, 0xF9, 0x3F,
-    0xC2, 0x9C, 0x6F, 0x48, 0x66, 0xFE, 0x5A, 0x0F, 0x67, 0x0B, 0x00, 0x1D, 0x0D, 0x63, 0x4F, 0xF8,
-    0xCF, 0x07, 0x67, 0x7F, 0xF9, 0xCF, 0x01, 0x63, 0x07, 0xFC, 0xBF, 0x0F, 0xF3, 0x97, 0xE3, 0xEF,
-    0xFF, 0xF6, 0xA0, 0x70, 0x78, 0xF7, 0xEE, 0xDD, 0x3F, 0x60, 0x40, 0xB0, 0x00, 0x8D, 0x82, 0x86,
-    0x89, 0x36, 0x58, 0x0F, 0x08, 0x9C, 0xB3, 0x04, 0xA9, 0x04, 0x00, 0x1A, 0xAE, 0x72, 0xB1, 0x78,
-    0x9C, 0x33, 0x70, 0x01, 0x03, 0x15, 0x86, 0xEF, 0xFF, 0x21, 0x80, 0xFD, 0x37, 0x94, 0xC1, 0xF9,
-    0xFB, 0xFC, 0x2A, 0x10, 0x98, 0xC5, 0xF8, 0x3B, 0x9F, 0x01, 0x02, 0x28, 0x65, 0xFC, 0x7F, 0x07,
-    0x02, 0xEC, 0x0C, 0x50, 0x2B, 0xF8, 0x61, 0x0C, 0x0E, 0x8A, 0x4D, 0xC6, 0x65, 0xD7, 0x3D, 0xE6,
-    0x5F, 0x50, 0xEF, 0x70, 0x7D, 0x81, 0xD0, 0xEF, 0x59, 0x00, 0x2C, 0x53, 0x5B, 0xA9, 0x78, 0x9C,
-    0x33, 0x70, 0x01, 0x03, 0x15, 0x86, 0xEF, 0xFF, 0x21, 0x80, 0xE5, 0x37, 0x94, 0xC1, 0xF6, 0xFB,
-    0xFC, 0x2A, 0x10, 0xE8, 0x62, 0xF8, 0x9D, 0xCF, 0x00, 0x01, 0x94, 0x32, 0xFE, 0xBF, 0x03, 0x82,
-    0x7B, 0x2C, 0x0C, 0x50, 0x2B, 0x78, 0x60, 0x0C, 0x36, 0xEA, 0x59, 0x81, 0xC1, 0xF8, 0x15, 0x0F,
-    0x65, 0x7C, 0x91, 0x81, 0x32, 0x00, 0x04, 0xB3, 0x47, 0xEE, 0x78, 0x9C, 0x3D, 0xD0, 0xAD, 0x0E,
-    0xC2, 0x30, 0x10, 0x07, 0xF0, 0x1B, 0xE3, 0x23, 0x01, 0xB2, 0xED, 0x11, 0xF6, 0x04, 0x84, 0x47,
-    0x98, 0x43, 0x92, 0x10, 0x50, 0xF8, 0x05, 0x03, 0x41, 0x61, 0x99, 0xC2, 0x92, 0xA0, 0x36, 0x37,
-    0x82, 0x45, 0xA0, 0x31, 0x73, 0x58, 0x50, 0x24, 0x28, 0x20, 0xC1, 0x2F, 0x7C, 0x09, 0x08, 0xF0,
-    0xE7, 0xBA, 0x6E, 0x3D, 0xD1, 0xFE, 0x72, 0xED, 0x5D, 0x2F, 0x25, 0xE2, 0x68, 0xF9, 0x41, 0x83,
-    0x64, 0xEC, 0xC1, 0x11, 0xE9, 0x82, 0x17, 0x24, 0x31, 0x65, 0x7A, 0x9C, 0xEB, 0x8D, 0x0E, 0x38,
-    0xB2, 0x5F, 0x18, 0x6B, 0xBC, 0x2D, 0xFA, 0x44, 0x43, 0x6C, 0x73, 0x69, 0x1D, 0xDD, 0x51, 0xC9,
-    0x48, 0x9F, 0x58, 0xCB, 0xE8, 0xA0, 0xA9, 0xD2, 0x21, 0xAA, 0xCA, 0x27, 0x14, 0x95, 0x6F, 0x50,
-    0x5D, 0xB8, 0x8D, 0x22, 0x3D, 0x62, 0xB1, 0xDA, 0x7E, 0x10, 0x04, 0xBA, 0xF4, 0x4A, 0x0C, 0x64,
-    0xC8, 0x3B, 0xA1, 0xB0, 0x79, 0x45, 0x32, 0xAB, 0xEB, 0x4E, 0x60, 0xEE, 0x50, 0x92, 0x85, 0x75,
-    0x98, 0x1E, 0x0C, 0x65, 0x1B, 0x63, 0x65, 0x7A, 0xA7, 0x8F, 0x09, 0x9F, 0x51, 0x53, 0x76, 0x10,
-    0x17, 0x32, 0xD3, 0x13, 0x51, 0x9E, 0xC8, 0xDA, 0x08, 0x3B, 0x3F, 0x60, 0xB9, 0xFE, 0x02, 0x65,
-    0x3E, 0x9D, 0xCB, 0x3F, 0x19, 0x24, 0x65, 0x33, 0x3E, 0x41, 0x37, 0x1D, 0xD6, 0x6A, 0x77, 0xC4,
-    0x24, 0x7F, 0x86, 0x09, 0x69, 0xE8, 0x78, 0x9C, 0x53, 0x60, 0x64, 0x80, 0x00, 0x43, 0x86, 0xEF,
-    0xF6, 0x10, 0x96, 0xC2, 0x7F, 0xF6, 0xDF, 0xF9, 0x10, 0x66, 0xC2, 0x7F, 0x6E, 0x7A, 0x30, 0xDF,
-    0xDF, 0x05, 0x83, 0xB7, 0x40, 0xE6, 0x7F, 0x18, 0x40, 0x61, 0xD6, 0x0B, 0x82, 0x41, 0x21, 0x7D,
-    0x9C, 0x03, 0x67, 0x72, 0x7D, 0x91, 0x85, 0x30, 0x05, 0xDE, 0xB2, 0x00, 0x00, 0x6B, 0xE8, 0x5D,
-    0xB4, 0x78, 0x9C, 0x53, 0x60, 0xFC, 0x6E, 0xFF, 0x3B, 0x9F, 0x34, 0xF8, 0x45, 0x16, 0x00, 0xD1,
-    0xFE, 0x24, 0x59, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x01, 0x01, 0x66, 0x30, 0xC5, 0xF0, 0x70, 0x3D,
-    0x84, 0xFE, 0xFC, 0x7E, 0xB0, 0xD0, 0x0A, 0x60, 0xFA, 0xDB, 0xFD, 0x1F, 0xB2, 0x20, 0xFA, 0xCF,
-    0xFC, 0x3F, 0x20, 0x17, 0x26, 0xFC, 0xB7, 0xFF, 0xFA, 0x5F, 0x9A, 0x81, 0xE1, 0xFB, 0x7F, 0xEE,
-    0x09, 0xFF, 0xFF, 0xAF, 0xFE, 0xFD, 0xFF, 0x3D, 0x23, 0xC3, 0xCF, 0xFF, 0x40, 0x00, 0x54, 0xE4,
-    0xF0, 0xE7, 0xFF, 0xFF, 0x3A, 0x90, 0x5A, 0x85, 0x50, 0x55, 0x20, 0x09, 0x00, 0x7B, 0x3B, 0x3F,
-    0x0D, 0x78, 0x9C, 0x3D, 0xD0, 0xC1, 0x0D, 0x82, 0x40, 0x10, 0x05, 0xD0, 0x11, 0x8D, 0x4A, 0xF4,
-    0x40, 0xE2, 0x55, 0x12, 0x2A, 0x30, 0xDB, 0x01, 0x74, 0x60, 0x09, 0x96, 0x40, 0x29, 0xDA, 0x01,
-    0x74, 0x60, 0x09, 0x6A, 0x05, 0x84, 0x0A, 0x88, 0x5A, 0x00, 0x89, 0x21, 0x72, 0x58, 0xE1, 0x9B,
-    0xF5, 0xCF, 0x3A, 0xA7, 0x77, 0x99, 0x99, 0x3F, 0x93, 0x04, 0xC2, 0xDA, 0x48, 0x9F, 0x52, 0x65,
-    0x23, 0x36, 0x27, 0x2D, 0x3C, 0xAF, 0x38, 0x28, 0xA3, 0x0F, 0x66, 0xCA, 0x1B, 0xF6, 0x42, 0x46,
-    0x43, 0x3B, 0x55, 0xD6, 0xD8, 0x09, 0x99, 0x8C, 0x6D, 0xA0, 0x7C, 0x20, 0x16, 0xD2, 0x8C, 0xCD,
-    0x44, 0xF9, 0xC4, 0x96, 0x5B, 0x72, 0x03, 0xAC, 0x95, 0x1D, 0x50, 0x90, 0x17, 0x9C, 0x2D, 0xE6,
-    0x8C, 0x81, 0xB0, 0x46, 0x4A, 0x16, 0x62, 0xF0, 0x1B, 0x61, 0xB1, 0x14, 0x79, 0x63, 0xE5, 0xE8,
-    0x5A, 0x4E, 0x38, 0xEA, 0x36, 0x11, 0x97, 0x51, 0x79, 0x77, 0x79, 0xC8, 0x0C, 0x95, 0xA7, 0xF4,
-    0x08, 0x3D, 0x4B, 0xE4, 0xFF, 0x8B, 0x07, 0x04, 0x9E, 0x2F, 0x2C, 0xBA, 0x98, 0xCC, 0x5A, 0xFF,
-    0x26, 0x57, 0x5F, 0xF5, 0xFC, 0x5F, 0x1B, 0x78, 0x9C, 0x53, 0x60, 0x64, 0x80, 0x80, 0xEF, 0xF6,
-    0x50, 0xC6, 0xEF, 0xFC, 0x61, 0xC1, 0xF8, 0x0F, 0x06, 0xFB, 0x19, 0x7E, 0x41, 0x18, 0xFF, 0x59,
-    0xBE, 0x40, 0xE8, 0xF3, 0x0C, 0x00, 0x62, 0xEF, 0x37, 0xDC, 0x78, 0x9C, 0x9D, 0xCA, 0xC1, 0x0D,
-    0xC2, 0x30, 0x10, 0x44, 0xD1, 0x45, 0xC8, 0x11, 0x81, 0x0B, 0x15, 0x04, 0x3A, 0x60, 0x45, 0x03,
-    0x4E, 0x07, 0xD0, 0x01, 0x2D, 0x50, 0x02, 0x17, 0xDA, 0xA0, 0x85, 0x94, 0x40, 0x0B, 0xE9, 0xC0,
-    0x72, 0x01, 0x28, 0x17, 0x24, 0x30, 0x91, 0x18, 0xBC, 0xB1, 0x37, 0x70, 0x66, 0x4E, 0xF3, 0xA4,
-    0xCF, 0x13, 0xD2, 0x6D, 0xE9, 0xB1, 0xD3, 0xCF, 0x28, 0xFA, 0x4E, 0xD1, 0x62, 0xDE, 0xA3, 0xCC,
-    0x08, 0x02, 0xAB, 0x95, 0xC0, 0x69, 0x15, 0xD1, 0xE5, 0x2E, 0x08, 0x0E, 0xA9, 0x63, 0x5C, 0x22,
-    0xEC, 0xD3, 0xA5, 0xEA, 0x2C, 0x68, 0x31, 0x93, 0xAA, 0x39, 0x09, 0x58, 0x3A, 0x46, 0x35, 0x80,
-    0x82, 0x93, 0xCA, 0x24, 0x48, 0x17, 0x1A, 0x4A, 0xA8, 0x61, 0x6B, 0x54, 0x19, 0xB1, 0xF3, 0x30,
-    0x0A, 0x8F, 0xF7, 0x95, 0x14, 0x7B, 0x60, 0x35, 0x82, 0x5E, 0x28, 0xBE, 0xF0, 0xB1, 0x1A, 0xB1,
-    0x34, 0x3F, 0x18, 0xF6, 0x2F, 0x36, 0x8A, 0x23, 0xCA, 0xFB, 0x42, 0xB1, 0xBE, 0x4D, 0x3F, 0x77,
-    0x85, 0x75, 0x34, 0x78, 0x9C, 0x45, 0xD0, 0xD1, 0x0D, 0x82, 0x30, 0x18, 0xC4, 0xF1, 0xAF, 0x91,
-    0x44, 0x02, 0x84, 0x38, 0x81, 0x1D, 0x81, 0x6E, 0xC0, 0x08, 0xAE, 0xE0, 0x08, 0x6C, 0xC0, 0x08,
-    0xAC, 0xC0, 0x08, 0x6E, 0xE0, 0x08, 0xC6, 0x09, 0x08, 0x13, 0x90, 0x48, 0xB4, 0x91, 0x46, 0xCE,
-    0x40, 0x7B, 0xE9, 0x3D, 0xFD, 0x9E, 0xFE, 0x0F, 0x67, 0x94, 0xF8, 0x19, 0x65, 0xEB, 0x40, 0x5B,
-    0xBA, 0x21, 0x70, 0xD1, 0x0E, 0x59, 0x64, 0x1B, 0x89, 0x03, 0xF9, 0xC0, 0x99, 0xAC, 0xD6, 0x3B,
-    0xA9, 0x67, 0x1C, 0xC9, 0x06, 0x35, 0x29, 0x6E, 0x52, 0xE4, 0x88, 0x9C, 0x34, 0x7B, 0x7A, 0xA7,
-    0x58, 0x24, 0xE4, 0x6D, 0x4B, 0x7B, 0x9E, 0xB6, 0xB4, 0xA7, 0xCC, 0x48, 0xC9, 0x06, 0x17, 0x52,
-    0x96, 0x49, 0x91, 0x4F, 0x14, 0xA4, 0x41, 0x47, 0xCA, 0x07, 0x2B, 0xD9, 0x03, 0xA4, 0xFC, 0x22,
-    0x5F, 0x91, 0x57, 0xE8, 0x77, 0x1E, 0x7E, 0xF8, 0x66, 0x7F, 0x9C, 0x1F, 0x5F, 0xE4, 0x78, 0x9C,
-    0x55, 0x50, 0xBB, 0x0E, 0x41, 0x51, 0x10, 0x5C, 0xEF, 0x10, 0x41, 0xA9, 0xA3, 0xD7, 0x68, 0xD4,
-    0xF8, 0x02, 0x1A, 0xB5, 0x4E, 0x89, 0x56, 0xA5, 0xD2, 0x49, 0x88, 0x46, 0x54, 0xD4, 0x1A, 0x7C,
-    0x01, 0x7F, 0x70, 0x13, 0x8D, 0x42, 0x41, 0x22, 0xD1, 0x5E, 0x8F, 0xEB, 0x11, 0x57, 0xCE, 0x38,
-    0x4F, 0x61, 0x8A, 0xB3, 0x33, 0xD9, 0xD9, 0x3D, 0xBB, 0x4B, 0x44, 0x94, 0xE8, 0x8C, 0x5A, 0x3E,
-    0x52, 0xC8, 0xBA, 0x00, 0xEC, 0xA4, 0xE4, 0x89, 0x17, 0x24, 0x82, 0x42, 0xAC, 0x81, 0x6E, 0x6D,
-    0xC8, 0x30, 0x13, 0x09, 0x86, 0x0C, 0x0F, 0x65, 0x86, 0x08, 0xD1, 0x0A, 0x6D, 0xE9, 0x5E, 0xA0,
-    0x41, 0x74, 0x57, 0x66, 0xA2, 0x37, 0x3C, 0xC4, 0x66, 0xBA, 0xE9, 0x19, 0xE1, 0x32, 0x52, 0x5A,
-    0x34, 0x11, 0x9F, 0x8B, 0x3A, 0x05, 0x54, 0x4F, 0x08, 0x18, 0xE1, 0x8E, 0x2F, 0xBC, 0x4C, 0xE3,
-    0x61, 0x39, 0x30, 0x9C, 0x6E, 0xB6, 0x63, 0x7F, 0x85, 0x83, 0x3F, 0x71, 0xFD, 0xB5, 0x9D, 0xE1,
-    0x35, 0xE2, 0xB9, 0xDC, 0x9B, 0x69, 0xF8, 0x3C, 0xBD, 0x3E, 0xA2, 0x9A, 0xA7, 0x51, 0x2A, 0x20,
-    0xAF, 0x45, 0x1F, 0x31, 0x7A, 0x5B, 0x5A, 0x5C, 0x11, 0xE2, 0x0D, 0xD5, 0x70, 0x69, 0xB6, 0x13,
-    0x59, 0xB5, 0xC3, 0x41, 0xFA, 0x5D, 0xD4, 0xF9, 0x3B, 0x50, 0x17, 0x99, 0x00, 0xD6, 0x74, 0x0B,
-    0xB1, 0x35, 0xC7, 0x51, 0x5E, 0xCA, 0xD2, 0x67, 0xDC, 0x70, 0xBE, 0xF4, 0x9B, 0xBF, 0x8B, 0x95,
-    0x9C, 0x8C, 0x1F, 0x64, 0x42, 0x73, 0xE0, 0x78, 0x9C, 0x33, 0x70, 0x01, 0x02, 0x63, 0x06, 0x06,
-    0x86, 0xEF, 0xFF, 0x41, 0x60, 0x3D, 0x13, 0xC3, 0x6F, 0x30, 0xE3, 0xBF, 0x3F, 0xC3, 0xEF, 0xFD,
-    0xAB, 0x56, 0xAD, 0x3A, 0xF5, 0xFF, 0x3F, 0xF3, 0x6F, 0x7B, 0xA0, 0x3C, 0xC3, 0xA5, 0xFF, 0xBC,
-    0x10, 0x86, 0xC2, 0x7F, 0x7F, 0x08, 0x83, 0xE1, 0xE7, 0x7C, 0x28, 0xE3, 0xCB, 0x79, 0x28, 0xE3,
-    0xF3, 0x7D, 0x74, 0x91, 0x1F, 0xEB, 0x21, 0x0C, 0x81, 0x7F, 0xF1, 0x10, 0xC6, 0xC6, 0xFF, 0x7C,
-    0xBF, 0xFB, 0xD3, 0xD2, 0xD2, 0xDA, 0xFE, 0xFD, 0x67, 0x81, 0xDA, 0x95, 0x0F, 0xB5, 0xF4, 0x3E,
-    0x0B, 0xC3, 0xEF, 0xF9, 0xE5, 0xE5, 0xE5, 0xE9, 0xCC, 0x0C, 0x0C, 0x50, 0xED, 0xD4, 0x63, 0x7C,
-    0xE1, 0x86, 0x32, 0x00, 0x54, 0x7F, 0x52, 0xE8, 0x78, 0x9C, 0x5D, 0x91, 0x3F, 0x2F, 0x44, 0x41,
-    0x14, 0xC5, 0x0F, 0x8B, 0x5D, 0x22, 0xBC, 0x52, 0x67, 0x7B, 0xCD, 0xEA, 0x74, 0xDE, 0x37, 0xA0,
-    0xD6, 0xD8, 0x4A, 0x69, 0xB5, 0x2A, 0x95, 0x4E, 0x62, 0xA3, 0xD9, 0x6C, 0x22, 0x21, 0xD1, 0x69,
-    0x96, 0x4E, 0xF7, 0x7C, 0x00, 0xC9, 0x4B, 0x34, 0x0A, 0x12, 0x12, 0x89, 0xF6, 0x59, 0xEB, 0xCF,
-    0x66, 0x1F, 0x73, 0xDC, 0x99, 0x3B, 0x33, 0x09, 0xB7, 0x98, 0xC9, 0x6F, 0xE6, 0xDE, 0x33, 0xE7,
-    0x9D, 0x07, 0x00, 0xC9, 0x7E, 0x77, 0xB7, 0x82, 0x50, 0x8D, 0x92, 0x64, 0xB1, 0xE0, 0x29, 0x19,
-    0xD1, 0xD5, 0x94, 0xE2, 0x2D, 0x79, 0xB0, 0xD5, 0x31, 0xEC, 0xE9, 0xA5, 0xE1, 0x92, 0x6C, 0xEB,
-    0x86, 0x33, 0x16, 0xAF, 0xB9, 0xE7, 0x8E, 0x2F, 0xD9, 0xB2, 0xDB, 0x67, 0x18, 0xFA, 0xE6, 0x98,
-    0xAC, 0xA6, 0xE7, 0x25, 0xFB, 0x9C, 0x96, 0x19, 0x2E, 0x7A, 0xDC, 0xE1, 0x3C, 0x70, 0xA1, 0x0A,
-    0xB6, 0xB8, 0x09, 0xBC, 0x72, 0x32, 0x60, 0x79, 0x02, 0xBC, 0x39, 0x01, 0x57, 0x5F, 0x39, 0xF0,
-    0xCE, 0x68, 0xF6, 0xA3, 0x10, 0x2C, 0x22, 0xDA, 0x9B, 0x7F, 0x38, 0xF8, 0xDB, 0xDC, 0xE7, 0x78,
-    0xC0, 0x61, 0x06, 0x3C, 0x05, 0x8F, 0xE2, 0xF2, 0x10, 0x68, 0x73, 0xD6, 0x53, 0x9D, 0x6B, 0x40,
-    0xCA, 0x55, 0x8F, 0x6D, 0xCE, 0xD9, 0x96, 0xDC, 0xE3, 0x80, 0x55, 0x27, 0xAF, 0xA6, 0xEB, 0xE6,
-    0x51, 0x7B, 0xF4, 0x0B, 0x9F, 0xFD, 0x54, 0xC9, 0x6D, 0x59, 0x8F, 0x42, 0x76, 0xA7, 0x64, 0x7E,
-    0x7E, 0x4F, 0xCD, 0x46, 0xEA, 0xC5, 0xE5, 0x9A, 0xC7, 0xE0, 0xEF, 0x84, 0xB2, 0x89, 0x68, 0x36,
-    0x19, 0x72, 0x23, 0x02, 0x9A, 0x25, 0x33, 0x8D, 0x64, 0xD9, 0x79, 0xB5, 0xBF, 0xC8, 0x5A, 0x48,
-    0x9D, 0xB8, 0xE1, 0x8D, 0xF0, 0x0A, 0x1A, 0x23, 0xD6, 0x04, 0xCF, 0xAA, 0x68, 0xFE, 0xC8, 0x81,
-    0xA8, 0x87, 0xDC, 0x2C, 0xEB, 0x84, 0x56, 0x7A, 0xF5, 0x70, 0x2C, 0x6F, 0xFD, 0x02, 0xF9, 0x2A,
-    0x96, 0x9E, 0x78, 0x9C, 0x33, 0x70, 0x01, 0x01, 0x65, 0x06, 0x20, 0xF8, 0xFE, 0x1F, 0x0C, 0xFA,
-    0x80, 0xCC, 0xDF, 0x10, 0xE6, 0x7F, 0x5D, 0x20, 0xF3, 0xFC, 0x2A, 0x20, 0x78, 0xF5, 0xFF, 0x3D,
-    0x23, 0xC3, 0xEF, 0x7C, 0x90, 0x32, 0x86, 0x6F, 0xFF, 0xB9, 0x61, 0xCC, 0x82, 0xFF, 0xFA, 0x30,
-    0x26, 0xC3, 0xBF, 0x7C, 0x38, 0xF3, 0xD7, 0x7C, 0x38, 0xF3, 0x27, 0x82, 0xF9, 0xBB, 0x1E, 0xCE,
-    0xFC, 0x6F, 0x0F, 0x63, 0x36, 0xFC, 0xE7, 0x81, 0x31, 0xBF, 0xFE, 0x67, 0x66, 0xF8, 0xBD, 0x3E,
-    0x14, 0x08, 0xB6, 0xFD, 0x8F, 0x87, 0xBB, 0xE1, 0x3E, 0x33, 0xC2, 0x39, 0xEC, 0x0C, 0x50, 0x05,
-    0xDB, 0xFF, 0xD7, 0x33, 0x20, 0xB4, 0x31, 0xC1, 0x98, 0x0B, 0xFE, 0x73, 0xC0, 0x98, 0x01, 0x08,
-    0x47, 0x3A, 0x20, 0xAC, 0x30, 0xF8, 0xCF, 0x0B, 0x63, 0x2A, 0xFC, 0xE7, 0xC7, 0xE2, 0x1C, 0x86,
-    0x5F, 0xF7, 0x99, 0x7E, 0x41, 0x99, 0x9F, 0xFE, 0x73, 0x3E, 0x96, 0x85, 0x30, 0x0D, 0xDE, 0xB2,
-    0x00, 0x00, 0x07, 0xAF, 0x6A, 0x73, 0x78, 0x9C, 0x45, 0x8F, 0x2D, 0x0E, 0xC2, 0x50, 0x10, 0x84,
-    0xB7, 0xFC, 0x54, 0x34, 0x25, 0xA9, 0x07, 0x51, 0x85, 0x24, 0x1C, 0x01, 0x03, 0x16, 0x48, 0x38,
-    0x00, 0x02, 0x47, 0x48, 0xDE, 0x35, 0x70, 0x88, 0x0A, 0x82, 0x69, 0x6F, 0xD0, 0x06, 0x30, 0xD8,
-    0x1A, 0x24, 0x0A, 0xFD, 0x12, 0x0E, 0x00, 0x86, 0x40, 0x83, 0x78, 0xC3, 0xB6, 0x6F, 0x03, 0xA3,
-    0xBE, 0x6C, 0x66, 0x32, 0x3B, 0x44, 0x34, 0xDD, 0xAE, 0xBB, 0x54, 0xEA, 0x00, 0xD6, 0x8A, 0x41,
-    0xA1, 0x52, 0x87, 0xE8, 0x85, 0x78, 0xB4, 0xF8, 0x40, 0x3B, 0x01, 0x52, 0x87, 0x28, 0x28, 0xE0,
-    0x2A, 0xF8, 0xA5, 0xB9, 0x7F, 0x77, 0x12, 0x34, 0xC9, 0x2A, 0x43, 0x43, 0x28, 0x81, 0x2B, 0xA4,
-    0xD0, 0x12, 0x0A, 0xA1, 0x6B, 0x82, 0x05, 0x52, 0x71, 0x6E, 0xB8, 0x60, 0x69, 0xCF, 0x57, 0xC6,
-    0x8B, 0x8D, 0x45, 0x06, 0xD0, 0x75, 0x9B, 0x3A, 0x03, 0x63, 0x89, 0xED, 0xF1, 0x10, 0xA2, 0xF7,
-    0xAF, 0x20, 0x83, 0x27, 0x34, 0xB1, 0x2F, 0xB1, 0x06, 0xF0, 0xF3, 0xB6, 0xD4, 0x7B, 0x85, 0xAD,
-    0xBD, 0xC1, 0x7D, 0x22, 0x66, 0x9C, 0x1B, 0xCD, 0x56, 0xE8, 0xDD, 0xC9, 0xA0, 0x47, 0x94, 0x57,
-    0x23, 0x2B, 0xCF, 0xF1, 0xFF, 0x41, 0x38, 0x1B, 0xF2, 0x50, 0xFA, 0x02, 0x0B, 0x34, 0x5B, 0x8C,
-    0x78, 0x9C, 0x33, 0x70, 0x81, 0x02, 0x13, 0x86, 0x1F, 0xFF, 0x61, 0x80, 0xE3, 0x37, 0x9C, 0xC9,
-    0xD5, 0x34, 0x73, 0xE6, 0xCC, 0x5F, 0xFF, 0x81, 0x44, 0x27, 0x23, 0x03, 0x10, 0x7C, 0xFA, 0xCF,
-    0x00, 0x03, 0xC3, 0x99, 0xF9, 0x11, 0xC1, 0x5C, 0x30, 0x1F, 0x4C, 0x01, 0x00, 0x4F, 0x4E, 0x49,
-    0x07, 0x78, 0x9C, 0x33, 0x60, 0x62, 0x80, 0x00, 0x65, 0x86, 0xEF, 0xFA, 0x10, 0x56, 0xC0, 0x7F,
-    0xA6, 0xDF, 0xF9, 0x10, 0x66, 0xC3, 0x7F, 0xD6, 0x21, 0xC1, 0xFC, 0xD9, 0x0F, 0x61, 0x2E, 0xF8,
-    0xCF, 0xF2, 0xFD, 0x3C, 0x84, 0xF9, 0xE0, 0x3F, 0xE3, 0xE7, 0xFF, 0xCC, 0x60, 0xE6, 0xD7, 0xFB,
-    0x0C, 0x07, 0xFE, 0xF3, 0x80, 0x58, 0x02, 0xFF, 0xEA, 0x19, 0x1C, 0xFE, 0xEF, 0x07, 0x31, 0x2F,
-    0xFD, 0xE7, 0x65, 0x60, 0xF8, 0xF9, 0x3F, 0x96, 0x81, 0xA1, 0xF0, 0x3F, 0x48, 0xDD, 0x82, 0xFF,
-    0xFF, 0xCF, 0xDF, 0xF9, 0xFF, 0x3F, 0x1E, 0x24, 0xF7, 0xFD, 0x3F, 0x10, 0xDC, 0x07, 0x6B, 0x16,
-    0x78, 0x01, 0x14, 0x67, 0x83, 0x86, 0x91, 0xA1, 0x09, 0x98, 0x02, 0x00, 0x4B, 0x5D, 0x58, 0xED,
-    0x78, 0x9C, 0x3D, 0x8F, 0xED, 0x0D, 0x82, 0x40, 0x10, 0x44, 0x17, 0x09, 0xD1, 0xA0, 0x12, 0x3B,
-    0xA0, 0x04, 0xEC, 0x40, 0xAC, 0x80, 0x16, 0xEC, 0x00, 0x3A, 0xD0, 0x0E, 0xB4, 0x83, 0x2B, 0x41,
-    0x3B, 0xC0, 0x0E, 0xA0, 0x04, 0x3A, 0x20, 0x8A, 0x04, 0xC1, 0x8F, 0xF1, 0xF6, 0xF6, 0x70, 0x7E,
-    0xBD, 0xE4, 0x6E, 0xF6, 0xED, 0xC6, 0x13, 0xB2, 0xD9, 0x52, 0x1F, 0x8E, 0xFC, 0x9D, 0xBF, 0x8E,
-    0x16, 0x77, 0x58, 0xB6, 0xB5, 0xE5, 0x2B, 0xA6, 0x15, 0x3C, 0xE1, 0x3B, 0x9C, 0x0C, 0x0B, 0xE1,
-    0x5E, 0xD1, 0x0A, 0x1B, 0x61, 0x44, 0x44, 0xC3, 0xD9, 0x56, 0xF5, 0x7B, 0x03, 0x47, 0xAA, 0x9E,
-    0xE9, 0x33, 0x37, 0xB5, 0xCC, 0x35, 0xD5, 0xBD, 0xF1, 0x25, 0xA6, 0x6A, 0xFC, 0xCF, 0xDC, 0xBC,
-    0xFA, 0x22, 0xD1, 0xEB, 0x95, 0x70, 0x99, 0x2F, 0x98, 0xE9, 0x6A, 0x61, 0x26, 0xC7, 0x08, 0xB4,
-    0x25, 0x15, 0xE3, 0x27, 0xD5, 0xF6, 0x40, 0xB8, 0x2B, 0x28, 0xE3, 0x7F, 0x9C, 0x1B, 0xDC, 0x12,
-    0xF6, 0xBC, 0x13, 0xFC, 0x47, 0x6E, 0xAF, 0x58, 0x23, 0x1C, 0x92, 0xF1, 0xD2, 0xB7, 0x92, 0x3D,
-    0x38, 0x2D, 0x64, 0x3F, 0x4E, 0x05, 0xD9, 0x9B, 0x73, 0x80, 0x1A, 0x51, 0x9B, 0xA2, 0x3F, 0x53,
-    0x27, 0xA6, 0x1F, 0xC5, 0x64, 0x4B, 0xC8, 0x78, 0x9C, 0x55, 0x90, 0xCD, 0x55, 0xC2, 0x50, 0x10,
-    0x85, 0x47, 0x51, 0x51, 0x44, 0xE2, 0xC6, 0x8D, 0x1B, 0xD8, 0xB8, 0x8E, 0x1D, 0x98, 0x0E, 0x94,
-    0x0A, 0xB4, 0x03, 0x2C, 0xC0, 0x73, 0xA0, 0x03, 0xE9, 0x40, 0x3A, 0x30, 0x3B, 0x97, 0xA6, 0x83,
-    0xD8, 0x01, 0x76, 0x10, 0xE2, 0x0F, 0x89, 0x1A, 0x72, 0x9D, 0x3B, 0x03, 0xE7, 0x84, 0xB7, 0xC8,
-    0xCC, 0xF9, 0xDE, 0xE4, 0xDE, 0xFB, 0x46, 0xCE, 0x64, 0xEB, 0x0C, 0x25, 0xC9, 0xB6, 0xC0, 0x29,
-    0xBA, 0x0B, 0xEC, 0x37, 0xC9, 0x1D, 0x82, 0x18, 0xC7, 0x4D, 0x12, 0xA3, 0x73, 0x83, 0xA0, 0x49,
-    0x72, 0xFD, 0x05, 0xB7, 0x4D, 0xB2, 0x84, 0xC8, 0xEF, 0xAB, 0xB5, 0xB3, 0x73, 0x2B, 0x7F, 0xCF,
-    0x22, 0xDF, 0xD8, 0x61, 0x5B, 0x3C, 0xB9, 0xD5, 0xB5, 0xC8, 0x02, 0x07, 0xEC, 0x57, 0x70, 0xAB,
-    0x9E, 0x8E, 0x9B, 0x59, 0x04, 0xBB, 0x48, 0x70, 0xC4, 0xBE, 0x4F, 0x19, 0xA0, 0x6B, 0x56, 0x7B,
-    0xFA, 0xAD, 0x47, 0x6C, 0xB3, 0x3A, 0xA4, 0x95, 0xBD, 0xE0, 0x87, 0x66, 0xC5, 0xB8, 0xA4, 0x74,
-    0x65, 0xFA, 0x5F, 0x34, 0xAB, 0xFB, 0x39, 0x68, 0x75, 0x45, 0xF2, 0xAE, 0x9A, 0x11, 0x3A, 0xB1,
-    0x96, 0x7B, 0x5A, 0x89, 0x4C, 0x55, 0x33, 0x46, 0x2B, 0xD2, 0x92, 0xE0, 0x90, 0xE4, 0x52, 0xCD,
-    0xF2, 0xB9, 0x26, 0x0A, 0xD5, 0xAA, 0x65, 0xC9, 0xD5, 0xAC, 0x1C, 0x59, 0xEA, 0x62, 0xEE, 0xAF,
-    0x2B, 0x53, 0xA9, 0x03, 0x06, 0x90, 0xEA, 0xD1, 0xC9, 0x27, 0x86, 0x8C, 0x3A, 0xC3, 0x05, 0x42,
-    0x27, 0x6F, 0x78, 0xC1, 0x2E, 0xF5, 0x1E, 0x70, 0xE2, 0x64, 0x82, 0x55, 0xCA, 0x5A, 0x65, 0x68,
-    0x3B, 0x19, 0xC0, 0xB7, 0xB6, 0x04, 0x47, 0xC5, 0x37, 0xD1, 0xF3, 0xA8, 0xE9, 0x66, 0x95, 0x85,
-    0x07, 0x9B, 0x60, 0xBC, 0x21, 0x1F, 0xBE, 0xC6, 0x81, 0xED, 0xC5, 0xCE, 0x74, 0x7D, 0x57, 0xDA,
-    0xE8, 0x3F, 0xD5, 0x82, 0x83, 0x68, 0x78, 0x9C, 0x35, 0x8F, 0xED, 0x0D, 0x82, 0x40, 0x10, 0x44,
-    0x17, 0xF1, 0x23, 0x28, 0x24, 0x54, 0x40, 0xE8, 0x40, 0x3A, 0xD0, 0x0E, 0xA4, 0x03, 0x4B, 0x50,
-    0x2B, 0x90, 0x0E, 0xB4, 0x03, 0xEC, 0xC0, 0x12, 0xB4, 0x03, 0xED, 0xC0, 0x50, 0x01, 0x89, 0x8A,
-    0x27, 0x01, 0x1C, 0x97, 0xBB, 0xDB, 0xFD, 0x71, 0x79, 0xB9, 0x6C, 0x66, 0xDE, 0x26, 0x2E, 0x99,
-    0x49, 0x9D, 0x6A, 0x6D, 0xB1, 0xF5, 0x15, 0x06, 0x9A, 0x32, 0xF8, 0x77, 0x04, 0x1A, 0xDF, 0x70,
-    0x63, 0xE4, 0x3D, 0x85, 0xBF, 0x0D, 0xD1, 0x07, 0x23, 0xC6, 0x2B, 0xA6, 0x44, 0x27, 0xCC, 0x19,
-    0x55, 0xE9, 0xF0, 0xDB, 0xDD, 0x88, 0x12, 0x2C, 0xFA, 0xB5, 0x17, 0x3C, 0x2A, 0x30, 0xE9, 0x71,
-    0x8B, 0x15, 0x35, 0x17, 0x13, 0xDE, 0x94, 0x3B, 0x44, 0x06, 0x0B, 0x74, 0x18, 0x1A, 0x4C, 0x80,
-    0x83, 0x6D, 0x27, 0x05, 0x5F, 0xB0, 0x96, 0x55, 0x4A, 0x01, 0x1B, 0x40, 0x4F, 0xD4, 0x26, 0x96,
-    0x4D, 0xF3, 0xCC, 0x94, 0xB1, 0x69, 0x40, 0xAD, 0x56, 0x60, 0xD3, 0x01, 0x47, 0xCF, 0xC4, 0x74,
-    0x89, 0xBD, 0x98, 0x72, 0x1E, 0x9F, 0xAB, 0x1E, 0xA4, 0x3F, 0x22, 0x31, 0x8D, 0x71, 0x16, 0x53,
-    0xAA, 0x30, 0xFE, 0xDA, 0xA2, 0x23, 0x82, 0x4A, 0xEA, 0x5B, 0x2F, 0x14, 0xA7, 0x90, 0xFE, 0xE7,
-    0x34, 0x56, 0xB2, 0x78, 0x9C, 0x53, 0x60, 0x65, 0x80, 0x80, 0x20, 0x86, 0x4F, 0xEB, 0x21, 0x2C,
-    0x85, 0xFF, 0x9C, 0x9F, 0xFF, 0xB3, 0x81, 0x99, 0x07, 0xFE, 0x73, 0x2F, 0xF8, 0xAF, 0x0F, 0x66,
-    0xFE, 0xF8, 0xCF, 0xCC, 0xF0, 0xF7, 0x3E, 0x88, 0x65, 0xF0, 0xBF, 0x9E, 0x81, 0xE1, 0xF3, 0x7F,
-    0x4E, 0x20, 0xF3, 0xC2, 0x7F, 0x1E, 0x06, 0x86, 0x82, 0xFF, 0xFE, 0x40, 0xE6, 0xAF, 0xF7, 0x8C,
-    0x40, 0xF2, 0x37, 0x90, 0x0C, 0xF8, 0x1F, 0x0F, 0x52, 0xF6, 0xF0, 0x3F, 0x37, 0x10, 0x73, 0xC2,
-    0x74, 0xFC, 0xBE, 0x0F, 0x31, 0xFD, 0xFB, 0xFF, 0xE2, 0xFF, 0xF6, 0x10, 0xE6, 0x86, 0xFF, 0xFF,
-    0xFE, 0xB3, 0x43, 0x98, 0x02, 0xFF, 0xFE, 0xEF, 0x87, 0x3A, 0x84, 0xE1, 0xCB, 0x7F, 0x39, 0x18,
-    0x73, 0x03, 0xD4, 0x1D, 0x60, 0x26, 0x0B, 0x1D, 0x99, 0x0B, 0x10, 0x4C, 0x87, 0xF3, 0x60, 0x0A,
-    0x00, 0xA5, 0x5C, 0x42, 0x64, 0x78, 0x9C, 0x63, 0x30, 0x70, 0x81, 0x02, 0x26, 0x86, 0xBF, 0xFF,
-    0xA1, 0x20, 0x9E, 0x01, 0xC6, 0xFA, 0xDF, 0xCF, 0x30, 0x79, 0x26, 0x18, 0xFC, 0xFA, 0x2F, 0xC7,
-    0x00, 0x05, 0x3F, 0xFF, 0xB3, 0x40, 0x59, 0x09, 0x40, 0x79, 0x28, 0xF8, 0xF4, 0x9F, 0x1B, 0xC6,
-    0xFC, 0xFB, 0x9E, 0x11, 0xCA, 0x5A, 0xF0, 0xDF, 0x1E, 0x26, 0xF8, 0xED, 0x3F, 0x3B, 0x94, 0x65,
-    0xF0, 0x7F, 0x3F, 0x4C, 0xF0, 0xE2, 0x7F, 0x59, 0x18, 0xF3, 0xF7, 0x7F, 0x66, 0x28, 0xAB, 0xE0,
-    0x7F, 0x3E, 0x4C, 0xF0, 0xF3, 0x7F, 0x2E, 0x28, 0x4B, 0xE0, 0xDF, 0x7D, 0x98, 0xE0, 0x86, 0xFF,
-    0xFA, 0x30, 0xE6, 0xF7, 0xFF, 0x6C, 0x50, 0x96, 0xC3, 0xFF, 0xF9, 0x30, 0xC1, 0x87, 0xFF, 0x79,
-    0x61, 0xCC, 0x3F, 0xFF, 0x99, 0xA0, 0xAC, 0x06, 0xA0, 0xA7, 0xA0, 0xE0, 0xCB, 0x7F, 0x4E, 0xB8,
-    0xA1, 0xE7, 0x61, 0x82, 0x07, 0xFE, 0xFF, 0x7F, 0x07, 0x01, 0xDC, 0x9F, 0xE0, 0x9E, 0xF7, 0x5F,
-    0x00, 0x67, 0xCA, 0x02, 0x00, 0xF0, 0x8E, 0x5F, 0x49, 0x78, 0x9C, 0x33, 0x74, 0x71, 0x71, 0x31,
-    0x61, 0xF8, 0xFB, 0x1F, 0x08, 0xB8, 0xFF, 0x43, 0x48, 0x7B, 0x63, 0x63, 0x63, 0x86, 0xFF, 0x7C,
-    0x0C, 0x40, 0x30, 0xA8, 0xC9, 0xFC, 0xB4, 0xB4, 0x34, 0x46, 0xB0, 0x9B, 0x79, 0xFE, 0x80, 0x48,
-    0x2E, 0x01, 0x25, 0x25, 0x25, 0x21, 0x06, 0x00, 0xDC, 0x96, 0x36, 0xA4, 0x78, 0x9C, 0x63, 0x60,
-    0x80, 0x81, 0x47, 0x7A, 0x30, 0xD6, 0x97, 0xF5, 0x30, 0xD6, 0x85, 0xFF, 0x4C, 0x50, 0x56, 0xC0,
-    0x7F, 0x2E, 0x98, 0xE0, 0x5F, 0x7D, 0x18, 0xEB, 0xEB, 0xE0, 0x52, 0x98, 0x80, 0x4D, 0xE1, 0xB7,
-    0x01, 0x54, 0xD8, 0x0F, 0x63, 0x6D, 0xF0, 0x03, 0x00, 0xB1, 0xE0, 0x33, 0xA6, 0x78, 0x9C, 0x33,
-    0x70, 0x71, 0x71, 0x31, 0x61, 0xFC, 0xFD, 0x1F, 0x08, 0x78, 0xC1, 0x24, 0xBF, 0x03, 0x50, 0xE4,
-    0x1F, 0x3F, 0x03, 0x10, 0x0C, 0x6E, 0x32, 0x31, 0x2D, 0x2D, 0xED, 0x3F, 0xFF, 0x1F, 0xB0, 0x9B,
-    0x7F, 0x81, 0x48, 0x1E, 0x01, 0x25, 0x25, 0x25, 0x21, 0x06, 0x00, 0x95, 0xD1, 0x36, 0xE6, 0x78,
-    0x9C, 0x63, 0x60, 0x60, 0x68, 0xCC, 0x62, 0x80, 0x80, 0x3F, 0xFF, 0xD9, 0xC1, 0x74, 0xC0, 0xFF,
-    0xFF, 0xF2, 0x60, 0xC6, 0x83, 0xFF, 0xFF, 0xD7, 0x83, 0x19, 0x3F, 0xDE, 0x7F, 0xFD, 0xCF, 0x0C,
-    0xA4, 0x05, 0xFE, 0xE7, 0x6F, 0xF8, 0xCF, 0x03, 0x64, 0x2C, 0xF8, 0xCF, 0xAB, 0xF0, 0x3F, 0x1E,
-    0xC8, 0xF8, 0xFC, 0x9F, 0x85, 0xE1, 0xE7, 0x7B, 0x90, 0x66, 0xA0, 0xCA, 0x87, 0x40, 0x03, 0x02,
-    0xFE, 0xEB, 0x33, 0x30, 0x14, 0x00, 0x0D, 0x78, 0xF0, 0x9F, 0x03, 0x28, 0xFC, 0x77, 0x3E, 0x50,
-    0x33, 0xC8, 0x08, 0xA0, 0x01, 0xFF, 0xF2, 0x41, 0x8C, 0x03, 0xFF, 0x39, 0x7F, 0x70, 0x83, 0x18,
-    0x06, 0xFF, 0x59, 0x04, 0xA0, 0x36, 0x33, 0x00, 0x00, 0x66, 0x56, 0x2A, 0x81, 0x78, 0x9C, 0x6B,
-    0xEE, 0x80, 0x01, 0xB6, 0x7F, 0xFF, 0x61, 0x20, 0xFE, 0x27, 0x9C, 0xA9, 0x07, 0x00, 0x8A, 0xD7,
-    0x19, 0xC4, 0x78, 0x9C, 0x9B, 0xC4, 0xC2, 0xC0, 0xF0, 0x3B, 0x9E, 0x81, 0xE1, 0xC7, 0x7F, 0x16,
-    0x86, 0x84, 0xFF, 0xFA, 0x0C, 0x0C, 0x8F, 0xEF, 0x33, 0x30, 0x08, 0xDC, 0x62, 0x00, 0x00, 0x66,
-    0x14, 0x08, 0x26, 0x78, 0x9C, 0x25, 0xCE, 0x41, 0x0E, 0xC1, 0x50, 0x14, 0x85, 0xE1, 0xD3, 0x44,
-    0x91, 0x30, 0x78, 0x2B, 0x30, 0x33, 0x66, 0x07, 0xBA, 0x83, 0x6B, 0x60, 0x2A, 0xB1, 0x0D, 0x13,
-    0xAD, 0x3D, 0x88, 0xB1, 0x0D, 0x88, 0xEE, 0x40, 0x62, 0x03, 0xB5, 0x00, 0x49, 0x63, 0x62, 0x5A,
-    0xAA, 0x48, 0xEB, 0xA5, 0x47, 0xAF, 0x77, 0x46, 0xDF, 0xE4, 0x24, 0x3F, 0x80, 0xCD, 0x65, 0xDF,
-    0xC6, 0xDA, 0x07, 0x4E, 0x24, 0x33, 0xBF, 0x1A, 0x21, 0xA0, 0x2E, 0xB4, 0x82, 0x9C, 0x2B, 0xCF,
-    0xDC, 0x58, 0x0B, 0x6C, 0xEA, 0x01, 0xC6, 0x52, 0xA6, 0x1C, 0xA0, 0xD9, 0x95, 0x12, 0xB3, 0xA3,
-    0x5A, 0x50, 0xEE, 0xF4, 0x54, 0xA0, 0xE4, 0xE9, 0x1F, 0xB0, 0x52, 0x1C, 0x9D, 0x2A, 0x29, 0x0E,
-    0x4E, 0xA5, 0x3C, 0x13, 0xA7, 0xAF, 0x3C, 0x32, 0xA7, 0x5A, 0xCE, 0x6C, 0x29, 0xC6, 0x94, 0x88,
-    0x7D, 0x55, 0x4C, 0x31, 0x0C, 0x55, 0x6F, 0x0A, 0x3E, 0xEC, 0x02, 0x11, 0x1B, 0xED, 0x98, 0x2D,
-    0xB7, 0x75, 0xD2, 0x54, 0xA1, 0xD4, 0xBE, 0xDE, 0x77, 0x02, 0x04, 0x96, 0x9C, 0xE3, 0xA5, 0x47,
-    0x33, 0x1B, 0xEA, 0xE9, 0x07, 0xD1, 0x5C, 0x54, 0x74, 0x78, 0x9C, 0xA5, 0xCE, 0xB1, 0x0E, 0xC1,
-    0x60, 0x14, 0x05, 0xE0, 0x53, 0x4A, 0x1A, 0x8D, 0xE8, 0x13, 0xF0, 0x02, 0x06, 0xBB, 0xA1, 0x5D,
-    0x0C, 0x26, 0x89, 0x07, 0x91, 0xAE, 0xA6, 0x7A, 0x0B, 0xA3, 0x47, 0xE0, 0x0D, 0x78, 0x01, 0xF9,
-    0x27, 0x8B, 0x05, 0x8B, 0xB5, 0x89, 0x2B, 0x91, 0x50, 0x3D, 0xFE, 0xAB, 0x6D, 0x62, 0x77, 0xA6,
-    0xEF, 0x26, 0xF7, 0xDE, 0x9C, 0x78, 0x88, 0x32, 0xB7, 0x6D, 0x25, 0x31, 0x7F, 0x29, 0x3A, 0xEE,
-    0xC7, 0x5F, 0x0D, 0xDE, 0x24, 0xFB, 0xAA, 0x3B, 0x35, 0x2E, 0x24, 0xE5, 0xCC, 0x09, 0xAE, 0x0C,
-    0x21, 0x34, 0x0E, 0x10, 0x64, 0x27, 0xAB, 0xAE, 0x1E, 0x5E, 0xD8, 0x10, 0x36, 0x55, 0x31, 0x7D,
-    0x61, 0xF1, 0x8D, 0x9D, 0xEA, 0x73, 0x16, 0xCA, 0xBA, 0xD0, 0x73, 0xF2, 0xA3, 0xB2, 0xF3, 0x2B,
-    0x94, 0xB4, 0x50, 0xDE, 0x13, 0xD6, 0x15, 0x11, 0xDB, 0x42, 0x5F, 0xB5, 0xA3, 0x27, 0x4C, 0x54,
-    0x0F, 0x3A, 0x42, 0x7A, 0xC0, 0xC2, 0xCE, 0x62, 0xB2, 0x74, 0xBE, 0xCC, 0xD9, 0xB2, 0xDA, 0x68,
-    0xBD, 0x15, 0x70, 0x4E, 0x70, 0x20, 0x8D, 0x6B, 0x77, 0x6B, 0xC0, 0x74, 0x64, 0x2B, 0xE2, 0x03,
-    0xFB, 0xE2, 0x65, 0xD2, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x28, 0xBA, 0x7D, 0xB7, 0x9B, 0x85, 0x81,
-    0x81, 0x61, 0xC2, 0x7F, 0x20, 0xB8, 0xCF, 0xC4, 0xA0, 0xF0, 0xF7, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xF3, 0x31, 0x3C, 0xFC, 0xBF, 0x9E, 0x99, 0x21, 0xF0, 0x9F, 0x3E, 0xC3, 0xEF, 0xFF, 0x20, 0xF9,
-    0x89, 0xEC, 0x06, 0xFF, 0xFD, 0x19, 0xC0, 0x60, 0xC1, 0x7F, 0x2E, 0x08, 0xE3, 0xC3, 0x7F, 0x66,
-    0x08, 0xE3, 0xD3, 0x7B, 0x08, 0xCD, 0xF0, 0xE5, 0x3C, 0x8C, 0xB1, 0x1F, 0xCA, 0xF8, 0x7C, 0x1F,
-    0xCA, 0xF8, 0xF8, 0x1F, 0xCA, 0xB8, 0xF0, 0x9F, 0x15, 0xC2, 0x28, 0xF8, 0xCF, 0x0B, 0x61, 0x08,
-    0xFC, 0x5F, 0x0F, 0xA2, 0x14, 0x98, 0x18, 0xBE, 0xFD, 0xD7, 0x06, 0x32, 0x7E, 0xE8, 0x83, 0x9C,
-    0x53, 0x5D, 0xF6, 0xF2, 0xBF, 0x3D, 0x90, 0x03, 0x72, 0xD8, 0x7F, 0x36, 0x06, 0x06, 0x83, 0x5F,
-    0xFF, 0xFF, 0xBF, 0xD7, 0x04, 0x6B, 0x08, 0x76, 0x65, 0x62, 0x60, 0x00, 0x00, 0x1B, 0xBB, 0x3C,
-    0x14, 0x78, 0x9C, 0x9D, 0xCF, 0x3D, 0x0A, 0xC2, 0x40, 0x10, 0x05, 0xE0, 0x09, 0x18, 0xFC, 0xC1,
-    0x62, 0x2F, 0x61, 0xAD, 0x37, 0x30, 0x37, 0x18, 0x0B, 0x5B, 0xC1, 0x23, 0xD8, 0xDA, 0xA8, 0x37,
-    0xB0, 0x11, 0xEB, 0x5C, 0x40, 0x14, 0x3C, 0x40, 0xC0, 0x0B, 0xE8, 0x01, 0x84, 0x60, 0x63, 0x1B,
-    0x8D, 0x51, 0x89, 0xAE, 0x79, 0xEE, 0x64, 0xDD, 0x0B, 0x38, 0xD5, 0xC7, 0xC0, 0x7B, 0xCC, 0x10,
-    0xD9, 0xD9, 0xD6, 0x7E, 0xA0, 0x77, 0xD7, 0x49, 0xF3, 0x5F, 0x5A, 0x1C, 0x57, 0x7E, 0xA9, 0x1D,
-    0x80, 0xC4, 0x37, 0x0A, 0x20, 0x33, 0x35, 0x4A, 0x31, 0xF1, 0xD4, 0x19, 0x05, 0x93, 0x8E, 0x3D,
-    0x22, 0xA5, 0xC1, 0x3D, 0xB4, 0x25, 0x7A, 0x02, 0x6F, 0x50, 0x15, 0x0D, 0xC1, 0x17, 0x78, 0x65,
-    0x1F, 0x38, 0x8D, 0x5D, 0x73, 0x16, 0x59, 0xBD, 0x38, 0x5B, 0x5B, 0xE5, 0x7C, 0xDB, 0xBB, 0xDD,
-    0x35, 0xB1, 0xFA, 0xF0, 0x01, 0x15, 0x41, 0x07, 0x3C, 0x43, 0x53, 0x14, 0x82, 0x15, 0xE6, 0xA2,
-    0x07, 0x98, 0x9E, 0xA8, 0x13, 0x8D, 0x60, 0x14, 0x22, 0x19, 0x2F, 0x8B, 0x48, 0x2E, 0xCD, 0xE5,
-    0xBE, 0x86, 0x7C, 0x1E, 0x68, 0x60, 0x40, 0x77, 0x09, 0xAA, 0x7E, 0x4B, 0x42, 0x5F, 0xD2, 0xDD,
-    0x5F, 0x00, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x68, 0xBE, 0xB3, 0x57, 0x9C, 0x01, 0x04, 0x36, 0xFE,
-    0x07, 0x02, 0x0E, 0x20, 0xC3, 0xE0, 0x1F, 0x88, 0x75, 0x1E, 0xC8, 0x7A, 0xF4, 0x3F, 0x96, 0xD1,
-    0xE0, 0xE7, 0x7F, 0x6E, 0x06, 0x86, 0x3F, 0xFB, 0xC1, 0x12, 0xF9, 0x0C, 0x0E, 0xFF, 0x79, 0x41,
-    0x8A, 0xBF, 0xBC, 0x67, 0xD8, 0xF0, 0x9F, 0x15, 0xC4, 0x02, 0x52, 0x1F, 0xFE, 0x83, 0x0D, 0x28,
-    0xF8, 0xCF, 0xF9, 0xE9, 0xFF, 0x5D, 0x10, 0x78, 0xFB, 0x9F, 0xFB, 0xF3, 0x7F, 0x28, 0xE0, 0xFE,
-    0xF2, 0xFE, 0x0C, 0x18, 0xEC, 0x61, 0xFE, 0xBC, 0x9F, 0x01, 0x0A, 0x3E, 0xBE, 0x87, 0xB1, 0x1E,
-    0xFC, 0x67, 0x81, 0xB2, 0x1A, 0xFE, 0xF3, 0x40, 0x59, 0x02, 0xFF, 0xE7, 0x83, 0xA8, 0x80, 0x75,
-    0x0C, 0x0C, 0xDF, 0xFE, 0x4B, 0x01, 0x59, 0x3F, 0x80, 0x16, 0x4C, 0xF8, 0xFF, 0xBF, 0xBB, 0xEC,
-    0xD7, 0xFF, 0x78, 0x20, 0xF7, 0x3B, 0xC8, 0xDC, 0xF7, 0x20, 0x7D, 0x0A, 0x2F, 0x81, 0x0C, 0x09,
-    0x88, 0xAE, 0xA0, 0x50, 0x66, 0x20, 0x09, 0x00, 0x16, 0x6A, 0x55, 0x7A, 0x78, 0x9C, 0x63, 0x60,
-    0x60, 0x08, 0x58, 0x91, 0xC5, 0xC0, 0xC0, 0xA0, 0xF0, 0xF7, 0xFF, 0x7F, 0x1E, 0x06, 0x86, 0x87,
-    0xFF, 0xC1, 0xD4, 0xCF, 0xFB, 0x4C, 0x41, 0x8C, 0x0C, 0x0C, 0x7F, 0xED, 0x19, 0x40, 0xE0, 0x3F,
-    0x3F, 0x06, 0x25, 0x20, 0xF8, 0x5F, 0x5F, 0x90, 0x91, 0xE1, 0x27, 0x50, 0xF9, 0xFF, 0xF7, 0x8C,
-    0x7F, 0x41, 0xD4, 0x7F, 0x96, 0x25, 0xBB, 0xFF, 0xEF, 0xDF, 0xDD, 0x8D, 0x5D, 0x03, 0x6D, 0xA8,
-    0x1F, 0x9C, 0x40, 0x02, 0x00, 0x9C, 0x28, 0x31, 0x7F, 0x78, 0x9C, 0x2D, 0xCF, 0xBB, 0x4A, 0x03,
-    0x41, 0x14, 0x06, 0xE0, 0x7F, 0x83, 0xE0, 0x0A, 0x16, 0x16, 0x01, 0xC5, 0x26, 0xBE, 0x81, 0xDB,
-    0x58, 0x09, 0xB2, 0x8F, 0x60, 0x11, 0xB0, 0xB5, 0x13, 0xAB, 0x54, 0x69, 0x52, 0x6D, 0x08, 0x58,
-    0x1A, 0xDF, 0xC4, 0x04, 0xD2, 0xCA, 0x3C, 0x42, 0xB4, 0x17, 0x0E, 0x58, 0xA5, 0xCB, 0xDE, 0x37,
-    0x64, 0x2F, 0xBF, 0x73, 0xD9, 0xD3, 0xCC, 0xC7, 0x99, 0xE1, 0xFC, 0x67, 0x00, 0x2C, 0x7E, 0xBF,
-    0x2E, 0xF1, 0x78, 0x05, 0xAC, 0xA9, 0xCB, 0x4F, 0x14, 0x82, 0x8E, 0xEC, 0xA8, 0x32, 0xC1, 0x1F,
-    0x97, 0x03, 0x6C, 0xD8, 0x0A, 0xEA, 0xFD, 0x00, 0x40, 0x45, 0x09, 0x79, 0xAB, 0x81, 0x88, 0xB2,
-    0xA2, 0x6F, 0x84, 0x56, 0x62, 0x7A, 0x56, 0x95, 0xA4, 0x62, 0x81, 0x4C, 0x72, 0xE5, 0x94, 0x48,
-    0xFE, 0xE9, 0x14, 0x4B, 0xB6, 0x75, 0x4A, 0x25, 0xA1, 0x53, 0x21, 0xDF, 0x3C, 0xB1, 0x3A, 0x4A,
-    0xC4, 0x73, 0x83, 0x80, 0x72, 0xC1, 0xA5, 0xD1, 0x0F, 0x05, 0x25, 0xAF, 0x75, 0xAB, 0xED, 0x04,
-    0x1F, 0xE4, 0xEC, 0xAD, 0x61, 0xA1, 0x13, 0x0E, 0x66, 0xD3, 0x07, 0x33, 0x2D, 0xA8, 0xC9, 0x77,
-    0xCF, 0xCD, 0x1D, 0xDF, 0x01, 0x65, 0x9F, 0x05, 0x34, 0x93, 0x1E, 0xCF, 0x1C, 0x21, 0x7C, 0xF5,
-    0xEC, 0xF6, 0xA7, 0x58, 0x51, 0x3D, 0x8D, 0x77, 0x54, 0x26, 0xC7, 0xD6, 0x99, 0xBE, 0x98, 0xEB,
-    0x0F, 0xF3, 0xDE, 0xBE, 0xBE, 0x99, 0xBE, 0x0C, 0xF5, 0xF1, 0x0F, 0x10, 0x04, 0x76, 0x7E, 0x78,
-    0x9C, 0x2B, 0xB0, 0x66, 0x80, 0x80, 0x4F, 0xFB, 0xA1, 0x8C, 0xCF, 0xE7, 0xC9, 0x64, 0x28, 0x2C,
-    0x9F, 0xC5, 0x0A, 0x62, 0x08, 0xFC, 0xFA, 0xFF, 0xFF, 0x3D, 0x0B, 0x90, 0xF1, 0xE8, 0x3F, 0x10,
-    0xD8, 0x33, 0x7C, 0xBE, 0xFF, 0x37, 0x57, 0xA8, 0xF9, 0xFF, 0x79, 0x86, 0xCF, 0xFF, 0xFB, 0x81,
-    0x2A, 0xBF, 0xFC, 0x67, 0xFE, 0xFC, 0x9F, 0x0B, 0xC8, 0xD8, 0xF0, 0x9F, 0xFD, 0xF3, 0x7F, 0x46,
-    0x20, 0x23, 0xE1, 0x3F, 0xD7, 0xE7, 0xFB, 0x20, 0x43, 0x1C, 0xFE, 0x73, 0x43, 0x0C, 0x74, 0xF8,
-    0xCF, 0x43, 0x23, 0x86, 0xC1, 0x7F, 0xEE, 0x0D, 0xF1, 0x60, 0x17, 0xFF, 0x61, 0x05, 0x00, 0xB3,
-    0x5F, 0x54, 0x7B, 0x78, 0x9C, 0xDB, 0x94, 0xF3, 0xEB, 0xFF, 0xAF, 0xFF, 0x9B, 0x72, 0x18, 0x80,
-    0xA0, 0x41, 0xF2, 0xCB, 0xFC, 0xAF, 0xEB, 0x09, 0xC1, 0x8B, 0x7E, 0x00, 0xA3, 0x7C, 0x25, 0x5E,
-    0x78, 0x9C, 0x63, 0x60, 0x38, 0xA6, 0xCD, 0xC0, 0xF0, 0x7F, 0x3E, 0x04, 0x83, 0xD8, 0x30, 0x10,
-    0xC0, 0xCC, 0xC0, 0xF0, 0x43, 0x9F, 0x81, 0xE1, 0xB7, 0x3F, 0xF5, 0xF0, 0x1F, 0x7F, 0x06, 0x81,
-    0xFF, 0xF6, 0x0C, 0x07, 0xFF, 0xF3, 0x4D, 0xFA, 0xFF, 0x9F, 0xFD, 0xF7, 0xFF, 0xFD, 0x0C, 0x3F,
-    0xFF, 0x73, 0x30, 0x04, 0x88, 0x30, 0x30, 0x00, 0x00, 0x2A, 0xC4, 0x2B, 0x32, 0x78, 0x9C, 0xDB,
-    0xC2, 0xC6, 0x00, 0x06, 0xFF, 0xF8, 0xA1, 0xB4, 0x3C, 0x39, 0x74, 0x00, 0x2B, 0x84, 0xFE, 0x15,
-    0x0F, 0xA6, 0x37, 0xFC, 0xF7, 0x07, 0xD1, 0x02, 0x7F, 0xFE, 0xB3, 0x81, 0xE8, 0x4B, 0xFF, 0xFD,
-    0x41, 0xEA, 0x0C, 0xFE, 0xBD, 0x67, 0x06, 0xD1, 0x5F, 0xFE, 0xCB, 0x82, 0xF4, 0x25, 0xFC, 0xDF,
-    0x0F, 0xD6, 0xFF, 0xFD, 0x3F, 0x27, 0x88, 0x5E, 0xFF, 0xFF, 0x3F, 0x33, 0x88, 0xFE, 0xFF, 0xFF,
-    0xBF, 0x1E, 0x98, 0xAE, 0xFF, 0xFF, 0x9E, 0x11, 0x48, 0xBF, 0x67, 0x82, 0xA8, 0xD7, 0x67, 0x70,
-    0xF8, 0x7F, 0x1E, 0x62, 0xDF, 0xD7, 0xFF, 0x3C, 0x60, 0x1A, 0x64, 0x02, 0xD8, 0xBE, 0xEF, 0xFF,
-    0xB9, 0xC0, 0x74, 0xC3, 0xFF, 0x7E, 0x88, 0x3F, 0x7E, 0xBE, 0xFF, 0x0E, 0x32, 0x94, 0x61, 0x42,
-    0x1D, 0x00, 0x17, 0xF6, 0x47, 0xC4, 0x78, 0x9C, 0xDB, 0xC2, 0xF6, 0x8F, 0xFF, 0x9F, 0x3C, 0x89,
-    0x90, 0xFF, 0x3B, 0x27, 0x00, 0x6B, 0xCA, 0x1E, 0x8D, 0x78, 0x9C, 0x53, 0x60, 0x65, 0x30, 0x58,
-    0xD1, 0xC5, 0xC2, 0xC0, 0xC0, 0xD0, 0xBC, 0x2A, 0x92, 0x81, 0xE1, 0xE3, 0x7A, 0x81, 0xDF, 0xFF,
-    0xFF, 0xDF, 0x67, 0x62, 0x38, 0xFC, 0xFF, 0xFF, 0x7F, 0x5D, 0x86, 0xCF, 0xE7, 0x1F, 0x03, 0xE9,
-    0xFF, 0x72, 0x09, 0x20, 0xF2, 0x3D, 0xE3, 0xE7, 0xFB, 0xFF, 0x72, 0x84, 0x26, 0xFF, 0x5F, 0xFF,
-    0x75, 0xBF, 0xAA, 0xE3, 0xAF, 0xFF, 0x5C, 0x9F, 0xFF, 0xF7, 0x03, 0xF5, 0x7D, 0xFF, 0xFF, 0x8F,
-    0x95, 0x81, 0xA1, 0xE1, 0xBF, 0xFC, 0xE7, 0xFF, 0x5C, 0x40, 0xEE, 0x83, 0xFF, 0xF9, 0x40, 0x92,
-    0xE1, 0x9F, 0xFF, 0xE7, 0xFF, 0x8C, 0x40, 0x7A, 0xC2, 0x7F, 0x3E, 0x10, 0xF7, 0x67, 0xFD, 0xE7,
-    0xFB, 0x20, 0xBA, 0x00, 0xAC, 0x86, 0xE1, 0x7B, 0xFF, 0xE7, 0xF3, 0x10, 0x2E, 0x27, 0x88, 0xFA,
-    0x36, 0x7F, 0x50, 0x71, 0x13, 0xFE, 0x73, 0x80, 0xB9, 0xFD, 0x1B, 0xE2, 0x41, 0xB4, 0xC0, 0x5B,
-    0x66, 0x10, 0x75, 0xD1, 0x0E, 0x00, 0xD8, 0x02, 0x70, 0xAA, 0x78, 0x9C, 0x53, 0x60, 0x65, 0x70,
-    0x38, 0x79, 0x37, 0x8A, 0x81, 0xE1, 0xE3, 0x7A, 0x85, 0x3F, 0xFF, 0xFF, 0xFF, 0x97, 0x66, 0xF8,
-    0x7C, 0xFE, 0xF1, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0x67, 0xF8, 0x7C, 0xFF, 0x9F, 0x37, 0x83, 0xC1,
-    0x9F, 0xFF, 0x2C, 0x9F, 0xFF, 0xE7, 0x33, 0x30, 0x30, 0x1C, 0xF8, 0xCF, 0xF5, 0xF9, 0x3F, 0x07,
-    0x90, 0xE1, 0xF0, 0x9F, 0xEF, 0xF3, 0x7F, 0x46, 0x20, 0x83, 0xE1, 0x3F, 0xFF, 0xE7, 0xFB, 0x20,
-    0x9A, 0xE1, 0x9F, 0xFC, 0xE7, 0xF3, 0x10, 0x86, 0x3E, 0xAD, 0x18, 0x7F, 0xE5, 0x37, 0xC4, 0x83,
-    0x19, 0xDF, 0xB8, 0x00, 0x67, 0x9F, 0x44, 0x78, 0x78, 0x9C, 0x3D, 0xCE, 0x3D, 0x0A, 0xC2, 0x40,
-    0x10, 0x05, 0xE0, 0x97, 0x1F, 0x44, 0x0B, 0xC1, 0xD2, 0xC2, 0xC2, 0xDE, 0x42, 0x6F, 0xA2, 0x20,
-    0xD6, 0xC1, 0xD6, 0xCA, 0xDE, 0x42, 0x2B, 0x5B, 0x8F, 0xA0, 0xE0, 0x01, 0xF4, 0x06, 0x39, 0x42,
-    0x62, 0x2B, 0x48, 0x2C, 0xED, 0xE2, 0xCF, 0x8A, 0x10, 0x43, 0x9E, 0xB3, 0xB3, 0xE0, 0x14, 0xBB,
-    0x1F, 0xB3, 0x33, 0xCB, 0x03, 0x30, 0x3D, 0x5F, 0x66, 0x1E, 0x6C, 0xAD, 0x28, 0xB5, 0xB4, 0x6A,
-    0x95, 0x64, 0x45, 0x76, 0x84, 0x27, 0x6E, 0x03, 0xEC, 0x99, 0x08, 0x0B, 0x86, 0x72, 0x1A, 0xD6,
-    0x31, 0xE0, 0xD0, 0x8E, 0x8D, 0xD8, 0xC7, 0x8E, 0x0D, 0x5D, 0x2E, 0x36, 0xB8, 0xD3, 0x57, 0x9A,
-    0x0C, 0xCF, 0x5C, 0x25, 0x2D, 0x98, 0xC4, 0x31, 0xA5, 0x6F, 0xE2, 0x3F, 0x5F, 0x99, 0xE3, 0x95,
-    0xDE, 0x83, 0x8E, 0x72, 0xA7, 0xAC, 0x29, 0x3F, 0x31, 0xE6, 0x6C, 0x6A, 0x92, 0x2A, 0x02, 0xAA,
-    0x83, 0xE5, 0xD1, 0x76, 0x0C, 0x7B, 0x40, 0xB7, 0x64, 0x00, 0x99, 0xE0, 0x62, 0xFD, 0x65, 0x64,
-    0xDF, 0xDE, 0x36, 0x7A, 0x1E, 0xEA, 0xC6, 0x4D, 0xD4, 0x76, 0x5F, 0x62, 0x3C, 0xD1, 0x48, 0x3F,
-    0xEA, 0xBE, 0x51, 0x53, 0x78, 0x9C, 0x8D, 0xCE, 0xB1, 0x0A, 0x82, 0x50, 0x14, 0xC6, 0xF1, 0xCF,
-    0x14, 0x92, 0x24, 0x6A, 0x4A, 0x68, 0x28, 0x87, 0x76, 0x0D, 0xDA, 0x93, 0x5E, 0xA0, 0x47, 0xAA,
-    0xB9, 0xA9, 0xB9, 0xC5, 0xB6, 0xDA, 0x6C, 0x68, 0xF7, 0x11, 0x7C, 0x94, 0x8B, 0x9C, 0x20, 0x4A,
-    0xF1, 0xEB, 0x5E, 0x4D, 0x68, 0xEC, 0x2C, 0xE7, 0x77, 0xE0, 0x0C, 0xFF, 0xD8, 0x47, 0x70, 0x39,
-    0x4D, 0x00, 0x14, 0x69, 0x50, 0x92, 0x9C, 0x02, 0x92, 0x3F, 0x34, 0xA8, 0x7A, 0x10, 0xC5, 0x64,
-    0xB1, 0x79, 0x71, 0x06, 0xA1, 0xB2, 0x81, 0xA8, 0xCE, 0xB4, 0x42, 0xFD, 0xAD, 0x97, 0x23, 0xEC,
-    0x1B, 0xED, 0xE9, 0x09, 0x2D, 0xA3, 0x31, 0x47, 0x92, 0xA3, 0x99, 0x2A, 0x94, 0xB4, 0xD5, 0x7B,
-    0xFB, 0xA3, 0xAC, 0x55, 0xB9, 0x16, 0xD5, 0xAA, 0x9E, 0x0B, 0x6D, 0x83, 0x88, 0x43, 0xA1, 0x67,
-    0x74, 0xA3, 0x2B, 0xDC, 0x19, 0x3D, 0x69, 0x09, 0xE9, 0x02, 0x47, 0x7D, 0x4B, 0x5E, 0xF1, 0x70,
-    0x25, 0x07, 0x5A, 0x67, 0xD3, 0x97, 0x98, 0x52, 0xDC, 0xC9, 0xCC, 0x69, 0x84, 0xE5, 0xAA, 0x09,
-    0xFB, 0x16, 0xFC, 0xAF, 0x22, 0xED, 0x14, 0xFB, 0x9D, 0x3E, 0x1D, 0x4D, 0x63, 0xD1, 0x78, 0x9C,
-    0x95, 0xCE, 0xB1, 0x09, 0xC2, 0x50, 0x14, 0x85, 0xE1, 0x13, 0x48, 0x10, 0xC5, 0xE2, 0x2D, 0x61,
-    0x1D, 0x47, 0xC8, 0x06, 0xD7, 0xC2, 0x56, 0x70, 0x04, 0x53, 0xDA, 0xA8, 0x1B, 0xD8, 0x88, 0x75,
-    0x16, 0x10, 0xDD, 0x20, 0xE0, 0x02, 0x3A, 0x80, 0x10, 0x6C, 0x6C, 0xA3, 0x31, 0x28, 0x09, 0xCF,
-    0x1C, 0x73, 0x8D, 0x0E, 0xE0, 0xA9, 0x3E, 0x4E, 0xF5, 0x03, 0x58, 0x9D, 0x36, 0x1E, 0x42, 0x17,
-    0xD8, 0x93, 0x4C, 0xBD, 0xD2, 0x47, 0x40, 0xDD, 0xDC, 0x0A, 0x32, 0xCE, 0x1C, 0x73, 0x61, 0x25,
-    0xB0, 0x89, 0x03, 0x18, 0x4B, 0x19, 0xD0, 0x47, 0xBD, 0x33, 0x65, 0xC7, 0x96, 0x6A, 0x4C, 0xB9,
-    0xD2, 0x51, 0x81, 0x92, 0x25, 0x1F, 0xC0, 0x4A, 0x1E, 0x37, 0x2A, 0x25, 0xDF, 0x36, 0x2A, 0xE4,
-    0x7E, 0xF8, 0x7D, 0xB7, 0xB4, 0xD1, 0x4B, 0x8E, 0x74, 0x15, 0x7D, 0xCA, 0x82, 0x5D, 0x55, 0x44,
-    0x31, 0x5C, 0xAA, 0x1E, 0x14, 0x3C, 0xD9, 0x06, 0x26, 0xAC, 0x15, 0x31, 0x9D, 0xAE, 0xAB, 0xB8,
-    0xAE, 0x42, 0xA1, 0x7D, 0x1D, 0x55, 0x60, 0xC9, 0x11, 0x54, 0x30, 0xC3, 0x1E, 0x1A, 0x7D, 0x0B,
-    0xFE, 0x55, 0xE9, 0xFF, 0x14, 0xBA, 0x6F, 0x6E, 0x70, 0x5E, 0x0C, 0x78, 0x9C, 0x53, 0x60, 0x65,
-    0x70, 0xB8, 0x35, 0x97, 0xE1, 0xE3, 0x7A, 0x86, 0xDF, 0xFF, 0xFF, 0xB3, 0x7D, 0x3E, 0x7F, 0xE0,
-    0xFF, 0xD9, 0xFF, 0xCC, 0x9F, 0xCF, 0xFF, 0xD0, 0x66, 0x10, 0x64, 0xF8, 0xFC, 0x7E, 0x3D, 0x03,
-    0x10, 0x7C, 0xFE, 0xCF, 0x07, 0xA1, 0xD8, 0x20, 0x14, 0x03, 0x98, 0xBA, 0x0F, 0xA1, 0xCE, 0x53,
-    0x83, 0xDA, 0x10, 0x0F, 0xA6, 0x00, 0x59, 0xA7, 0x2B, 0xB2, 0x78, 0x9C, 0x63, 0x60, 0x68, 0xBA,
-    0x7D, 0xD6, 0x92, 0x81, 0x81, 0xA1, 0xE1, 0x3F, 0x10, 0xE8, 0x30, 0x30, 0xFC, 0xFA, 0xBF, 0xF7,
-    0xF6, 0xFF, 0xF7, 0x4C, 0x0E, 0xFF, 0xED, 0x18, 0x18, 0x36, 0xFD, 0xE7, 0x9E, 0xF0, 0x9F, 0x15,
-    0x28, 0xF9, 0x93, 0x6D, 0xC3, 0x7F, 0x26, 0x06, 0x10, 0x58, 0xF0, 0x9F, 0x0D, 0x4C, 0x27, 0xFC,
-    0xF7, 0x07, 0xD3, 0x0C, 0x7F, 0xFF, 0xD7, 0x82, 0x65, 0x0E, 0xFE, 0xFF, 0xFF, 0x1E, 0x64, 0x0E,
-    0xC3, 0x51, 0xA0, 0x39, 0xDA, 0x20, 0x46, 0xE2, 0x6F, 0xA0, 0x39, 0x60, 0x35, 0xCF, 0xFE, 0x73,
-    0x83, 0x69, 0x81, 0x7F, 0xF2, 0x06, 0x8C, 0x20, 0xC6, 0x4F, 0xFB, 0xEF, 0x7A, 0x60, 0x5A, 0xFF,
-    0xFB, 0x7B, 0x16, 0x90, 0x38, 0xDF, 0x81, 0xFF, 0xFB, 0x55, 0x0D, 0x9F, 0x03, 0x0D, 0xFF, 0x05,
-    0x72, 0x47, 0x3F, 0x03, 0x83, 0xC3, 0xEF, 0xFF, 0xFF, 0xCF, 0xB3, 0x80, 0x14, 0x05, 0xBB, 0x02,
-    0xF5, 0x00, 0x00, 0xCB, 0x40, 0x3D, 0xBB, 0x78, 0x9C, 0x63, 0x60, 0x70, 0x60, 0x66, 0x00, 0x81,
-    0x6F, 0xFE, 0x60, 0xEA, 0x67, 0x3E, 0x06, 0xA5, 0xE0, 0xF2, 0x7B, 0xBE, 0x8B, 0x08, 0xC3, 0xE7,
-    0xFF, 0x20, 0xC0, 0xF8, 0x05, 0x4C, 0x31, 0x05, 0x74, 0xFC, 0xD9, 0xDF, 0xE1, 0x81, 0x5D, 0x03,
-    0x05, 0x54, 0x3D, 0x98, 0xFA, 0xB1, 0x1E, 0x4C, 0x7D, 0xF9, 0xBF, 0xC6, 0x16, 0x48, 0x1D, 0xF8,
-    0xFF, 0xBF, 0x1F, 0x48, 0x09, 0xBC, 0xFC, 0x2F, 0xC5, 0x00, 0x00, 0x6C, 0x66, 0x32, 0x2C, 0x78,
-    0x9C, 0x53, 0x60, 0x65, 0x00, 0x81, 0x20, 0x86, 0x8F, 0xEB, 0x41, 0xB4, 0xC0, 0x7F, 0xAE, 0xCF,
-    0xE7, 0x41, 0x0C, 0x83, 0xFF, 0x3C, 0xB4, 0x63, 0x7C, 0xBA, 0x0F, 0x62, 0x38, 0xFC, 0xE7, 0xFE,
-    0xF0, 0x9F, 0x11, 0xC8, 0x68, 0xF8, 0xCF, 0x79, 0xE0, 0x3F, 0x07, 0x90, 0xF1, 0xF0, 0x3F, 0x6B,
-    0xC0, 0xFF, 0x7A, 0xA0, 0x2B, 0xFE, 0xBC, 0x67, 0x60, 0xF8, 0xFD, 0x7F, 0x6E, 0xFB, 0xAF, 0xFF,
-    0xFE, 0x0C, 0x0C, 0x1B, 0xFE, 0x83, 0x00, 0xC8, 0x9D, 0x47, 0x81, 0xB4, 0x16, 0xD8, 0xBD, 0x86,
-    0x2E, 0x4C, 0x40, 0x12, 0x00, 0x68, 0x74, 0x41, 0x91, 0x78, 0x9C, 0x5B, 0xC4, 0xC1, 0x00, 0x02,
-    0x0E, 0xD1, 0xBF, 0xE2, 0xC1, 0x8C, 0x07, 0xEF, 0xBF, 0x9F, 0x07, 0x33, 0xBE, 0xEE, 0xFF, 0xF8,
-    0x9F, 0x19, 0xC4, 0xF8, 0xE3, 0x3F, 0xE1, 0x3F, 0x17, 0x90, 0x56, 0xF8, 0xCF, 0x6B, 0xF0, 0x5F,
-    0x1E, 0xC8, 0x98, 0xF0, 0x9F, 0x8D, 0xE1, 0x4F, 0x3D, 0x90, 0xF1, 0xF1, 0x3F, 0x50, 0xD9, 0x7B,
-    0x20, 0xE3, 0x7B, 0x3F, 0x03, 0xC3, 0x85, 0xFF, 0xAC, 0x0C, 0x0C, 0x7F, 0xF5, 0x19, 0x18, 0x0A,
-    0xFE, 0xF3, 0x30, 0x38, 0xFC, 0xE7, 0x06, 0x0A, 0xFF, 0xB7, 0x67, 0xD8, 0xF0, 0x9F, 0x05, 0xC8,
-    0xF8, 0x39, 0x9F, 0xE1, 0xD3, 0x7D, 0x90, 0x59, 0x9F, 0xFE, 0x33, 0xFE, 0xCC, 0x07, 0x31, 0x36,
-    0xFC, 0x67, 0xFF, 0xCF, 0x07, 0xB6, 0xF8, 0x7F, 0xDD, 0x7F, 0x88, 0x13, 0xFE, 0xFE, 0xFF, 0xCF,
-    0x08, 0x66, 0x7C, 0xFB, 0xBF, 0x9E, 0x01, 0xE2, 0x16, 0xA0, 0x01, 0x60, 0xD0, 0x00, 0x34, 0x12,
-    0x0C, 0x04, 0xDE, 0x32, 0x33, 0x20, 0x01, 0x00, 0x80, 0x3D, 0x36, 0xEC, 0x78, 0x9C, 0x65, 0x8F,
-    0xCB, 0x11, 0x82, 0x40, 0x10, 0x44, 0x1B, 0x3F, 0xF8, 0x43, 0x21, 0x03, 0x35, 0x02, 0x0D, 0xC1,
-    0x0C, 0x08, 0x01, 0xAE, 0x96, 0x17, 0x33, 0xD0, 0x0C, 0x30, 0x03, 0x2D, 0x13, 0xD0, 0x0C, 0x0C,
-    0x01, 0x22, 0x50, 0x33, 0xF0, 0x03, 0x6A, 0x41, 0x51, 0xDB, 0xCE, 0x42, 0xC9, 0xC5, 0x39, 0x6C,
-    0xCD, 0xAB, 0xE9, 0xED, 0x99, 0xDE, 0xB7, 0xF1, 0xAB, 0xD9, 0x02, 0x99, 0x5B, 0x51, 0x44, 0x23,
-    0xDD, 0x56, 0x14, 0x13, 0xF1, 0x4D, 0x37, 0x63, 0xFD, 0xC8, 0x20, 0x62, 0x03, 0x70, 0x94, 0x29,
-    0xA4, 0x5C, 0xAC, 0xD9, 0x05, 0x96, 0xEC, 0x03, 0x53, 0x0E, 0x30, 0xA2, 0xAD, 0xFF, 0x8B, 0xD7,
-    0x86, 0x1D, 0x20, 0xF7, 0x80, 0x84, 0x07, 0xE0, 0xCA, 0x3A, 0xF0, 0x91, 0x26, 0x3B, 0xD3, 0x40,
-    0xA2, 0xFD, 0x1E, 0x84, 0xC3, 0x39, 0x5B, 0x48, 0x03, 0xA1, 0x23, 0x9B, 0x3E, 0xEB, 0x62, 0xA3,
-    0x26, 0x42, 0x3E, 0xBB, 0xD1, 0x45, 0x4E, 0x9A, 0x69, 0x5F, 0x91, 0xD9, 0x71, 0x80, 0xF8, 0xB4,
-    0x13, 0xB1, 0x54, 0xE6, 0xA5, 0x13, 0xD9, 0xF1, 0x64, 0x4D, 0xD3, 0x2B, 0xA4, 0x25, 0xFA, 0x3C,
-    0x2C, 0x8E, 0xBD, 0x93, 0xA6, 0xE8, 0xB9, 0x2A, 0x68, 0x43, 0x59, 0x86, 0x8C, 0xC3, 0x32, 0xA4,
-    0x3E, 0x44, 0xE2, 0x58, 0x65, 0x2E, 0xE5, 0x15, 0x51, 0xCD, 0x92, 0xDE, 0x3D, 0xAD, 0x08, 0xF1,
-    0x57, 0x5F, 0x91, 0x03, 0x5B, 0xAA, 0x78, 0x9C, 0x2D, 0x8D, 0xDD, 0x0D, 0x02, 0x31, 0x0C, 0x83,
-    0x5D, 0xFE, 0x24, 0xB8, 0x17, 0x16, 0x00, 0xB1, 0x41, 0x47, 0xE0, 0x99, 0x37, 0x36, 0x80, 0x11,
-    0x6E, 0x03, 0xD8, 0x00, 0x89, 0x09, 0xD8, 0x04, 0x36, 0x28, 0x1B, 0x74, 0x84, 0x93, 0xE0, 0x10,
-    0x27, 0x44, 0x31, 0x4E, 0x20, 0x52, 0x1A, 0xA7, 0xB5, 0xFB, 0x1D, 0x07, 0x50, 0x2D, 0x56, 0x28,
-    0xD1, 0xC4, 0x95, 0x78, 0xE7, 0x20, 0xF1, 0x4A, 0xB8, 0xB1, 0x02, 0xB6, 0x8C, 0x58, 0xF3, 0x00,
-    0xDC, 0x29, 0x67, 0xA7, 0xA3, 0x68, 0xC1, 0x85, 0xF1, 0x64, 0xCF, 0x98, 0x7E, 0xF2, 0xB3, 0xB1,
-    0x80, 0x0C, 0x5C, 0xDA, 0x54, 0x84, 0x23, 0x17, 0x28, 0xEC, 0xFB, 0xDC, 0x93, 0x73, 0x17, 0x0F,
-    0x32, 0x39, 0x8F, 0xBB, 0x96, 0x63, 0xE7, 0x4D, 0x6A, 0x6E, 0x8C, 0x97, 0xD5, 0xEC, 0xA1, 0x16,
-    0x4F, 0xB7, 0x33, 0xB4, 0x1C, 0x9A, 0xEF, 0xFC, 0xE3, 0x29, 0x19, 0xBA, 0xCA, 0xFF, 0x4A, 0xF8,
-    0x57, 0xC0, 0x17, 0x78, 0xE1, 0x40, 0x2B, 0x78, 0x9C, 0x4B, 0xD0, 0x62, 0x00, 0x81, 0xE5, 0x4C,
-    0x9F, 0xF6, 0x83, 0x68, 0x85, 0xFF, 0xDC, 0x9F, 0xCF, 0x83, 0x18, 0x06, 0xFF, 0x79, 0x68, 0xC8,
-    0xB8, 0x0F, 0x62, 0x04, 0xFC, 0xE7, 0xF9, 0xF8, 0x1F, 0xC4, 0x58, 0xF0, 0x9F, 0xE7, 0xC1, 0x7F,
-    0x36, 0x20, 0xE3, 0xCB, 0x7F, 0x9E, 0x09, 0xFF, 0xED, 0x40, 0x32, 0xFF, 0x79, 0x14, 0xFE, 0xFF,
-    0xAF, 0x6E, 0xFB, 0x73, 0xFE, 0x3F, 0x0F, 0xC3, 0xD7, 0xFF, 0x40, 0xE0, 0x09, 0x64, 0x18, 0xFC,
-    0xF9, 0xFF, 0x3F, 0xC6, 0xE1, 0x3F, 0x37, 0xD0, 0x99, 0xA1, 0x22, 0x0C, 0x05, 0xFF, 0x39, 0xC1,
-    0x4E, 0x67, 0xB8, 0xF0, 0x9F, 0x15, 0xC2, 0xF8, 0x06, 0x34, 0x2D, 0x02, 0x48, 0x27, 0xFC, 0xAF,
-    0x67, 0x68, 0xF8, 0xDF, 0x67, 0x5A, 0xF2, 0x07, 0xA8, 0xB6, 0x00, 0xA4, 0xFB, 0x3F, 0xC8, 0x73,
-    0xD7, 0x80, 0xF4, 0x79, 0xB0, 0xD2, 0xA0, 0xF2, 0x70, 0x46, 0x20, 0x05, 0x00, 0x5E, 0x05, 0x5D,
-    0x79, 0x78, 0x9C, 0x13, 0x68, 0xEF, 0x00, 0x01, 0xB6, 0x0D, 0xFF, 0xC1, 0x20, 0x7F, 0x02, 0x94,
-    0x66, 0x70, 0x01, 0x82, 0x27, 0xFF, 0x79, 0x18, 0x40, 0xE0, 0xC7, 0x7F, 0x26, 0x10, 0xE5, 0xF0,
-    0x3F, 0x1E, 0xCC, 0x7D, 0xF8, 0x9F, 0x13, 0x4C, 0xFF, 0xBE, 0x0F, 0xA6, 0x0A, 0xFE, 0xEB, 0x83,
-    0xE9, 0xCF, 0xFF, 0xD9, 0x40, 0x94, 0xC0, 0xBF, 0xF5, 0x60, 0xEE, 0x86, 0xFF, 0xBC, 0x60, 0xFA,
-    0x3B, 0x44, 0xB3, 0x01, 0xD0, 0x4C, 0x10, 0xB8, 0xF0, 0x9F, 0x0B, 0x4C, 0xFF, 0x82, 0x68, 0x4E,
-    0xF8, 0x6F, 0x0F, 0xA6, 0x3F, 0xFD, 0x3F, 0x7F, 0x06, 0x08, 0xA4, 0xBF, 0x43, 0xEC, 0xAF, 0x7F,
-    0x04, 0xA1, 0xF5, 0x00, 0x87, 0xE6, 0x40, 0x2B, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x14, 0x30,
-    0xA9, 0xF0, 0xF3, 0x3F, 0x1B, 0x88, 0xFE, 0xF1, 0xFF, 0x3E, 0x13, 0x90, 0x5A, 0xF0, 0x7F, 0x3E,
-    0x88, 0x62, 0xF8, 0xF2, 0x9E, 0x19, 0x2C, 0xFD, 0x3B, 0x1E, 0x4C, 0x31, 0xFC, 0xE3, 0x87, 0xD0,
-    0xFF, 0x79, 0x89, 0xA2, 0x05, 0xFE, 0xF3, 0x80, 0x69, 0x87, 0xFF, 0x5C, 0x60, 0x7A, 0x03, 0xC4,
-    0x12, 0x86, 0xEF, 0xF7, 0x41, 0x64, 0xC3, 0xEB, 0xFF, 0x7A, 0x60, 0x4B, 0xFE, 0x9F, 0x67, 0x04,
-    0xD1, 0x0B, 0xFE, 0xFC, 0x97, 0x85, 0x68, 0xFF, 0x75, 0x1F, 0x42, 0x1F, 0xF8, 0xCF, 0x0A, 0xA6,
-    0x03, 0xA0, 0xFA, 0x61, 0xE6, 0x11, 0x6B, 0x3F, 0xC3, 0x7F, 0xA8, 0x7B, 0xFF, 0xF8, 0x43, 0xE8,
-    0x6F, 0xEF, 0xC1, 0xDE, 0x62, 0xB8, 0xF0, 0xBF, 0x1F, 0x6C, 0xA5, 0xC0, 0x9F, 0xFF, 0xFB, 0xC1,
-    0x8C, 0x80, 0x3F, 0x50, 0xA7, 0x09, 0x94, 0x31, 0x00, 0x00, 0xE3, 0xB0, 0x36, 0xB4, 0x78, 0x9C,
-    0x2B, 0x90, 0xFC, 0xD2, 0xFF, 0x6D, 0x3D, 0x65, 0xF0, 0xEB, 0xFC, 0x87, 0xFE, 0x0C, 0x0C, 0x00,
-    0x90, 0x56, 0x39, 0x71, 0x78, 0x9C, 0x4B, 0x62, 0x66, 0x00, 0x83, 0xDF, 0xFF, 0xAD, 0xC0, 0xF4,
-    0xD3, 0xFF, 0xFF, 0x39, 0xC0, 0x8C, 0x2D, 0xFF, 0xFB, 0x21, 0x32, 0xDF, 0xFE, 0x33, 0x82, 0xE9,
-    0x09, 0xFF, 0xD9, 0xC1, 0xB4, 0xC3, 0x7F, 0x2E, 0x30, 0xAD, 0xF0, 0x9F, 0x1B, 0x4C, 0x0B, 0xA0,
-    0xD1, 0x0A, 0x68, 0xB4, 0xC0, 0x7F, 0x1E, 0x88, 0x41, 0xFF, 0xF9, 0x21, 0xF4, 0xAF, 0x7C, 0x08,
-    0xFD, 0xE9, 0x3F, 0x2B, 0x98, 0x0E, 0xF8, 0x7F, 0x3F, 0x1B, 0xCC, 0x78, 0xFC, 0xFF, 0x3F, 0xC4,
-    0x82, 0xF7, 0x35, 0xC8, 0xF2, 0xBF, 0xEA, 0x51, 0xF4, 0x0B, 0xFC, 0xE7, 0xC5, 0x61, 0x0F, 0x76,
-    0x77, 0xC0, 0xDC, 0x3B, 0xE1, 0x3F, 0x1B, 0x98, 0xFE, 0xFA, 0x1E, 0x4C, 0x2D, 0xFE, 0xEF, 0x0F,
-    0xA2, 0xAE, 0xFC, 0x3F, 0xCF, 0x04, 0xF6, 0xFF, 0x79, 0x88, 0x65, 0x45, 0x4C, 0x10, 0xCB, 0x00,
-    0xBE, 0x7B, 0x36, 0xDF, 0x78, 0x9C, 0x63, 0x68, 0x9A, 0xC5, 0xCA, 0xC0, 0xB0, 0x40, 0x36, 0xE0,
-    0xFF, 0xFF, 0xFF, 0x96, 0x0C, 0x1F, 0xEA, 0x1F, 0x00, 0xE9, 0xFF, 0xBD, 0xBF, 0xF2, 0x3F, 0xCE,
-    0x77, 0xFA, 0x05, 0x64, 0xC9, 0x7F, 0xB0, 0x67, 0x60, 0x38, 0xF6, 0xFF, 0x3F, 0xAB, 0x01, 0x1B,
-    0x03, 0x03, 0x83, 0x23, 0x33, 0x03, 0x00, 0x7B, 0xFC, 0x18, 0x00,
+    0x0B, 0x25, 0x18, 0x00, 0x53, 0x50, 0x52, 0x52, 0x12, 0x62, 0x00, 0x27, 0x2C, 0xD6, 0x7F, 0x20,
+    0x92, 0xF3, 0xEA, 0xDD, 0xBB, 0x77, 0xCF, 0x32, 0x01, 0x00, 0x53, 0x60, 0xFC, 0x15, 0xFF, 0x7F,
+    0xFE, 0xFF, 0xF9, 0xDF, 0xED, 0x00, 0x83, 0x39, 0xFF, 0xA2, 0x1E, 0x8C, 0xF5, 0x03, 0x9A, 0x7C,
+    0x80, 0x9A, 0x61, 0xA9, 0xB9, 0x01, 0x6A, 0x35, 0xDC, 0xE1, 0x20, 0x65, 0xF5, 0x03, 0xAB, 0x8C,
+    0x1F, 0xAE, 0x8C, 0x03, 0x1E, 0x7C, 0x8C, 0x30, 0x65, 0xFD, 0x70, 0x65, 0xF2, 0x94, 0x2B, 0xFB,
+    0x89, 0xA9, 0x6C, 0x02, 0x16, 0x65, 0x5F, 0xE1, 0x09, 0xE4, 0x20, 0x2C, 0x62, 0x18, 0x00, 0x03,
+    0xF9, 0x6D, 0x7A, 0xA7, 0x28, 0xC4, 0x93, 0x7F, 0x60, 0x7E, 0xF8, 0x0A, 0xCE, 0xEC, 0x8C, 0x60,
+    0x7F, 0x57, 0xB7, 0xFD, 0x03, 0x79, 0xF8, 0xC2, 0x7F, 0x3B, 0x90, 0x86, 0x7A, 0x90, 0xFF, 0x99,
+    0xC1, 0x5E, 0x67, 0x64, 0xF8, 0x37, 0x1F, 0x12, 0xA6, 0xEC, 0x06, 0x90, 0x18, 0x6B, 0xF8, 0xCF,
+    0xD3, 0x00, 0x09, 0x1C, 0xA0, 0xC0, 0x06, 0x68, 0x70, 0xFC, 0xF7, 0x7F, 0x00, 0xF5, 0xCE, 0x9F,
+    0xFA, 0x0F, 0x50, 0x8B, 0x7F, 0xF5, 0x7F, 0x84, 0x3A, 0xF5, 0xE7, 0xFC, 0x8F, 0x50, 0xFF, 0xFD,
+    0x5C, 0x8F, 0xCC, 0x82, 0xC9, 0xC2, 0x74, 0xFC, 0xEE, 0xBF, 0x00, 0x75, 0xFD, 0xDF, 0xFC, 0x05,
+    0x50, 0xFF, 0xFE, 0xB7, 0x87, 0xC6, 0xAB, 0xC3, 0x7F, 0x7E, 0x05, 0x88, 0x27, 0x17, 0x00, 0x03,
+    0xE5, 0xCF, 0x7E, 0x48, 0x58, 0xB0, 0x02, 0xBD, 0x01, 0xD2, 0xF2, 0xE7, 0x3E, 0x28, 0x88, 0xEA,
+    0x41, 0x19, 0xD8, 0x1F, 0x94, 0xA6, 0xFF, 0xEF, 0x3F, 0xF5, 0x1F, 0x6C, 0xC2, 0x25, 0x90, 0x2F,
+    0x21, 0x39, 0xEF, 0x05, 0xD0, 0xBB, 0xD0, 0xA8, 0x0E, 0x76, 0x05, 0xB9, 0x02, 0x00, 0x03, 0x51,
+    0xC2, 0x20, 0xE2, 0x32, 0xC8, 0x9A, 0x09, 0xFF, 0x81, 0x21, 0x6C, 0xF0, 0x17, 0x44, 0x82, 0x92,
+    0x14, 0xCB, 0x85, 0xFF, 0xEF, 0x81, 0x61, 0xFE, 0xF1, 0xBF, 0xF4, 0x87, 0xFF, 0x2C, 0x05, 0xB9,
+    0x40, 0xF7, 0xB2, 0x80, 0x5D, 0x4D, 0x0F, 0xF2, 0x01, 0x98, 0x2C, 0xD8, 0xCF, 0x00, 0x00, 0x03,
+    0xAA, 0x99, 0xD6, 0x29, 0x06, 0x4F, 0x5D, 0x52, 0xE0, 0x50, 0x06, 0x25, 0x39, 0x26, 0x60, 0x00,
+    0xBE, 0x37, 0x07, 0xA6, 0x26, 0x3E, 0xA0, 0x09, 0x9C, 0xA0, 0xE0, 0xAC, 0x67, 0xF8, 0x0D, 0x4E,
+    0xA6, 0x3F, 0xEE, 0x33, 0xFC, 0xE0, 0x81, 0xB8, 0x97, 0x51, 0x00, 0x1A, 0xAA, 0xCC, 0x30, 0x87,
+    0x43, 0x19, 0x1F, 0x60, 0x5E, 0xF9, 0x76, 0x1E, 0x16, 0x0E, 0x90, 0x28, 0x04, 0xDA, 0x09, 0xCD,
+    0x23, 0x9F, 0xA1, 0xAE, 0x51, 0xF8, 0x07, 0x55, 0x72, 0x11, 0x1A, 0xAD, 0xC0, 0xE0, 0x63, 0x86,
+    0xFA, 0x0B, 0x9A, 0x92, 0x7F, 0x41, 0x95, 0x4E, 0x80, 0x45, 0xC2, 0x0F, 0xA8, 0x8F, 0x13, 0xFE,
+    0x43, 0x3D, 0xFA, 0x15, 0x1A, 0x27, 0x0E, 0xFF, 0xEF, 0x33, 0x42, 0x83, 0xE2, 0xFD, 0x5D, 0x20,
+    0x38, 0xCB, 0xF6, 0x03, 0x9A, 0x20, 0xF9, 0x1F, 0x43, 0x19, 0x9C, 0x00, 0x63, 0x10, 0x04, 0x03,
+    0x50, 0x20, 0x80, 0x41, 0x3F, 0xC3, 0x17, 0x08, 0xE3, 0x3D, 0xC3, 0x84, 0x33, 0x40, 0xF0, 0x06,
+    0xE6, 0x91, 0xCF, 0x50, 0xDF, 0x29, 0x40, 0xD3, 0x2A, 0xC3, 0x23, 0xA8, 0x3B, 0x04, 0xFE, 0x42,
+    0x2D, 0xBB, 0x08, 0x0B, 0x17, 0x70, 0xD2, 0x00, 0xBB, 0x6B, 0xBF, 0x39, 0x03, 0x2C, 0x81, 0x10,
+    0x48, 0xA7, 0x50, 0xF7, 0x43, 0x1D, 0xD8, 0x00, 0x8B, 0x3B, 0x07, 0x58, 0xC4, 0x29, 0xC0, 0xB2,
+    0x96, 0x01, 0x4C, 0x24, 0x01, 0xE6, 0xFF, 0x0B, 0x40, 0x13, 0x45, 0xC0, 0x61, 0xFC, 0x9F, 0x71,
+    0xC2, 0x7B, 0x56, 0x50, 0x48, 0xD5, 0x03, 0x53, 0xC1, 0xF9, 0xF4, 0x69, 0xFF, 0x80, 0xC6, 0x18,
+    0xFC, 0x85, 0x78, 0x0B, 0x68, 0xE8, 0xBF, 0xFF, 0xFF, 0xE7, 0x83, 0x03, 0x48, 0x21, 0xD4, 0x14,
+    0x44, 0x01, 0x00, 0x83, 0xAA, 0x63, 0x82, 0x79, 0xE3, 0x0B, 0x34, 0xF1, 0x00, 0x8D, 0xEF, 0x87,
+    0xBB, 0x66, 0x3E, 0x2C, 0x21, 0xC3, 0x58, 0x40, 0xA3, 0xA0, 0xAC, 0xCF, 0xFF, 0x7F, 0xCE, 0x87,
+    0xA6, 0x95, 0xFC, 0xEF, 0xF3, 0x61, 0xCE, 0x81, 0xB2, 0x7E, 0xDC, 0x67, 0x80, 0xB0, 0x1C, 0x80,
+    0x41, 0x0A, 0x61, 0x7D, 0x02, 0x7A, 0x0D, 0xC2, 0xFA, 0x0B, 0x34, 0x1F, 0xCC, 0x5A, 0x00, 0x0A,
+    0x4F, 0x30, 0xEB, 0x1B, 0xA8, 0x94, 0x00, 0xB1, 0x0C, 0xC0, 0xF9, 0x00, 0xC4, 0x7A, 0xF8, 0x7F,
+    0xDE, 0xCC, 0x99, 0x33, 0xFF, 0xDC, 0x9F, 0xC9, 0x0E, 0x4D, 0x65, 0xC0, 0x02, 0xE9, 0x33, 0x8C,
+    0xE5, 0x2F, 0x60, 0x0C, 0x02, 0x3F, 0xD6, 0x1B, 0x33, 0x42, 0xA3, 0x66, 0x3E, 0x3C, 0x92, 0x88,
+    0x64, 0x7D, 0x83, 0x47, 0xEB, 0x45, 0x3B, 0x06, 0x06, 0x00, 0x63, 0x60, 0x10, 0x04, 0x01, 0x58,
+    0x1A, 0xFA, 0xBF, 0x1F, 0xA8, 0x07, 0x02, 0x80, 0x7E, 0x3E, 0x77, 0x06, 0x08, 0x6A, 0x80, 0x1A,
+    0x21, 0x36, 0x03, 0xD5, 0xB3, 0xC0, 0x3C, 0xCB, 0x04, 0x73, 0x29, 0xD4, 0x0D, 0x1F, 0x60, 0x9E,
+    0xF8, 0xB4, 0x5E, 0xA1, 0x2C, 0x83, 0x19, 0xEC, 0x55, 0x60, 0x2E, 0xBC, 0xCF, 0x06, 0xF2, 0x00,
+    0xC4, 0x60, 0x60, 0xC0, 0xAD, 0x77, 0x6B, 0xFD, 0x0B, 0x74, 0xF6, 0xC1, 0x5A, 0x46, 0x44, 0xA4,
+    0x82, 0xC4, 0xD1, 0xFD, 0xDD, 0x00, 0x0B, 0x4A, 0x78, 0x24, 0xC2, 0x19, 0x05, 0x30, 0xCF, 0x1E,
+    0x80, 0xF9, 0xE6, 0xF3, 0x7F, 0xC6, 0x04, 0x16, 0x70, 0x41, 0xB1, 0x9E, 0xE1, 0xFB, 0x7A, 0x26,
+    0x90, 0x79, 0x72, 0x40, 0x4B, 0xCF, 0xAF, 0xFA, 0xF3, 0xFF, 0x3D, 0x33, 0xC8, 0x8F, 0xD0, 0x04,
+    0x3E, 0xE9, 0xEF, 0xFF, 0xF7, 0x5E, 0x10, 0x2D, 0x4A, 0xE0, 0x20, 0x05, 0x00, 0x03, 0xD3, 0x5B,
+    0xB5, 0x09, 0xA6, 0xC3, 0xFD, 0x10, 0x47, 0xFC, 0x82, 0xFA, 0x31, 0x01, 0x1A, 0x23, 0xF0, 0xB0,
+    0x63, 0xF8, 0x71, 0x1E, 0x66, 0xA5, 0x3D, 0xCC, 0xED, 0x9C, 0xCD, 0xA7, 0xB3, 0xC0, 0x9A, 0x41,
+    0xD9, 0x25, 0x0E, 0xE4, 0xEB, 0x7F, 0x90, 0x74, 0xFA, 0xED, 0xFF, 0x7F, 0x0B, 0xC5, 0xA3, 0xC0,
+    0x74, 0xFA, 0xF3, 0xBF, 0x2E, 0xC8, 0xD0, 0xF7, 0x8C, 0x7F, 0xC0, 0x2E, 0x3F, 0xF0, 0x9F, 0xFD,
+    0xDF, 0x7C, 0x48, 0xDC, 0xF1, 0x42, 0x32, 0x35, 0x30, 0x6B, 0xFD, 0x83, 0xC4, 0xC6, 0x3F, 0xFD,
+    0x3F, 0x30, 0xC6, 0xCF, 0x78, 0x88, 0x45, 0xFC, 0x90, 0x24, 0x04, 0x4C, 0x27, 0x90, 0x00, 0xFB,
+    0xF4, 0x9F, 0x35, 0x00, 0x14, 0xEE, 0x06, 0x7F, 0xCF, 0x83, 0xA2, 0xA6, 0xB7, 0xFD, 0x37, 0x28,
+    0xDB, 0x4E, 0x80, 0xE7, 0xDA, 0x23, 0xC0, 0x9C, 0x04, 0x09, 0x43, 0xC7, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x63, 0x10, 0x04, 0x03, 0x46, 0x58, 0x24, 0xFE, 0x67, 0xFD, 0x03, 0x65, 0x70, 0x6D, 0x39,
+    0x03, 0x02, 0x7F, 0x60, 0x6E, 0xF9, 0x06, 0x0B, 0xB1, 0xBF, 0x90, 0xC8, 0x00, 0x3A, 0x44, 0x9E,
+    0xB0, 0xFD, 0xFE, 0xB8, 0x22, 0x00, 0x61, 0x5C, 0x3F, 0x35, 0x8C, 0x83, 0xC7, 0xE7, 0x9F, 0x7E,
+    0x58, 0x8C, 0x41, 0x8D, 0x6B, 0x80, 0xA5, 0x03, 0x07, 0x68, 0xEA, 0x86, 0x03, 0x00, 0x03, 0x29,
+    0x32, 0x86, 0xE8, 0x4A, 0xF8, 0x03, 0x49, 0x68, 0xC0, 0xD4, 0x07, 0x4C, 0x72, 0xCC, 0x20, 0x67,
+    0xDC, 0x9F, 0xF9, 0x1B, 0xA4, 0xF9, 0x27, 0xD0, 0x3D, 0x0A, 0x7F, 0xEE, 0x03, 0x8D, 0xF3, 0x07,
+    0x07, 0x17, 0x6B, 0x00, 0x38, 0x08, 0x0A, 0xFE, 0x73, 0x41, 0x72, 0xB2, 0xC3, 0x7F, 0x1E, 0x38,
+    0xC3, 0x01, 0x26, 0x05, 0xC9, 0x96, 0x0F, 0x81, 0x51, 0xF6, 0xF5, 0x3D, 0x0B, 0xD0, 0xD0, 0xFD,
+    0x20, 0xFB, 0xF6, 0x97, 0xFF, 0x02, 0x3B, 0xFB, 0x07, 0x28, 0x03, 0x41, 0x5C, 0x00, 0xC9, 0x88,
+    0x3F, 0xFE, 0x6B, 0x32, 0x24, 0x02, 0x73, 0xBA, 0x03, 0xD8, 0x8A, 0x83, 0xFF, 0x39, 0x37, 0x80,
+    0xBD, 0xAB, 0xF0, 0x5F, 0x1E, 0x9A, 0x76, 0x7E, 0xC7, 0x43, 0x03, 0xED, 0x67, 0x3D, 0x34, 0x9C,
+    0x7E, 0xE5, 0x3F, 0x80, 0xA4, 0x87, 0x7F, 0xF6, 0x0D, 0xE0, 0x44, 0xD0, 0xF0, 0x9F, 0x4F, 0xE0,
+    0xDF, 0x7D, 0x66, 0x06, 0x01, 0x90, 0x7B, 0x3F, 0xFF, 0xBF, 0xBF, 0xEA, 0x0F, 0x28, 0xD2, 0x0C,
+    0xFE, 0xC2, 0x32, 0x07, 0xC8, 0x83, 0x9A, 0x90, 0x10, 0x50, 0x02, 0x99, 0x09, 0x00, 0x03, 0x9A,
+    0xB3, 0x7C, 0xB5, 0x39, 0x58, 0xED, 0x6F, 0x68, 0x42, 0x78, 0x0C, 0x8E, 0x40, 0x16, 0x60, 0xC6,
+    0x7B, 0x6F, 0x6E, 0xF4, 0x1C, 0x18, 0x18, 0x07, 0xC0, 0x41, 0xFC, 0x7B, 0x3F, 0xC3, 0x17, 0xB0,
+    0x53, 0x2E, 0xFC, 0x67, 0xFE, 0xD9, 0x0F, 0x09, 0x61, 0xCE, 0xBF, 0xF6, 0xD0, 0x74, 0xFF, 0x4F,
+    0x1E, 0x92, 0xAC, 0xF9, 0xFF, 0x41, 0x02, 0xEF, 0xBF, 0xFE, 0x1F, 0x7F, 0x88, 0x2B, 0xF5, 0x7F,
+    0xAE, 0x87, 0xD8, 0x05, 0x4D, 0xF1, 0x9F, 0xFF, 0xF3, 0x6D, 0x00, 0x25, 0x0F, 0x87, 0x7F, 0xFF,
+    0x79, 0x14, 0x80, 0x89, 0xB8, 0xFD, 0x2F, 0x28, 0xE0, 0xC0, 0x96, 0xDE, 0x05, 0xDA, 0x0A, 0x4A,
+    0xE4, 0xFD, 0x9F, 0x40, 0xE1, 0x23, 0x90, 0xE2, 0xC6, 0xF0, 0xB3, 0x1F, 0x16, 0xFE, 0xFA, 0xB0,
+    0xA0, 0x81, 0xFA, 0xF5, 0xD7, 0x7B, 0x46, 0x68, 0xB8, 0x43, 0x92, 0x3B, 0xD0, 0xF9, 0x10, 0x99,
+    0xA7, 0xD0, 0x38, 0xB9, 0xF6, 0x1F, 0x22, 0xE0, 0x00, 0x2B, 0xC2, 0x0C, 0xFE, 0xCF, 0x87, 0x68,
+    0x61, 0x08, 0x86, 0x50, 0x00, 0x4B, 0x10, 0xFB, 0xB9, 0xFF, 0xCF, 0xFD, 0x5F, 0xE7, 0x17, 0x59,
+    0x31, 0x60, 0x01, 0x02, 0x8C, 0xDF, 0xFA, 0x7F, 0xDF, 0xFF, 0x7D, 0xFF, 0x4B, 0x3E, 0x00, 0x63,
+    0x28, 0x04, 0x8A, 0xFD, 0x05, 0x3A, 0xEE, 0x3F, 0x50, 0xCB, 0x3F, 0xA0, 0x6F, 0x96, 0x48, 0x32,
+    0x90, 0x0A, 0x0C, 0xFE, 0xDA, 0x02, 0x03, 0xF6, 0x3D, 0xC3, 0x85, 0x3F, 0x40, 0x73, 0x13, 0x80,
+    0xB8, 0xE1, 0x3F, 0x83, 0xC0, 0x8F, 0x7A, 0x60, 0x4C, 0x70, 0x31, 0x04, 0x44, 0x31, 0x30, 0x00,
+    0x00, 0x83, 0xAA, 0x0B, 0x87, 0xFB, 0x0D, 0x22, 0x73, 0xE5, 0x3F, 0xC4, 0xA8, 0x4D, 0xFF, 0xFF,
+    0x6B, 0x81, 0xE8, 0x89, 0xFF, 0xFF, 0xDB, 0x80, 0x1D, 0xF4, 0xEF, 0x7F, 0x1C, 0xD8, 0x11, 0x7F,
+    0x21, 0xE1, 0xA1, 0xF0, 0xFB, 0xFF, 0x7A, 0x46, 0x48, 0x12, 0x83, 0x96, 0x0D, 0x7F, 0x61, 0xA1,
+    0xF0, 0xE3, 0xFF, 0x7C, 0x88, 0xC3, 0x81, 0x6A, 0x21, 0xD1, 0xC7, 0x90, 0x00, 0x4D, 0xAE, 0x60,
+    0xF3, 0xB4, 0x21, 0x2C, 0xA0, 0x0D, 0x92, 0x0C, 0x50, 0x3B, 0xDF, 0xB3, 0xC1, 0x5C, 0x71, 0x1F,
+    0xA2, 0x55, 0xE0, 0x27, 0x2C, 0x24, 0x0C, 0x76, 0x33, 0x00, 0x00, 0x13, 0x70, 0x76, 0x01, 0x03,
+    0xE6, 0x07, 0xD0, 0x88, 0x5B, 0xFF, 0x11, 0xCA, 0x38, 0xEF, 0x30, 0x63, 0x26, 0x18, 0x68, 0x30,
+    0xE0, 0x01, 0xC6, 0x10, 0x80, 0x4D, 0xFB, 0x4C, 0xA8, 0x76, 0x00, 0x3B, 0x2C, 0x01, 0x4B, 0xA4,
+    0xEF, 0x61, 0x21, 0xF3, 0xFF, 0x3E, 0xC4, 0xD3, 0x0A, 0xBF, 0xFE, 0xEF, 0x87, 0x98, 0xE7, 0xF0,
+    0xF7, 0xFF, 0x7C, 0x88, 0x23, 0x12, 0xFE, 0x81, 0xB3, 0x1E, 0x44, 0xAF, 0x2F, 0x84, 0xB5, 0x09,
+    0x9A, 0x7E, 0x18, 0x18, 0xAE, 0xFC, 0xFF, 0x0F, 0x0D, 0xAF, 0xDF, 0x50, 0x47, 0xC2, 0x44, 0x80,
+    0x59, 0x4F, 0x0B, 0x44, 0x2F, 0xFC, 0xFF, 0xDF, 0x06, 0xAA, 0x3B, 0x16, 0x6A, 0x5E, 0x1D, 0x8A,
+    0x0D, 0x3F, 0x60, 0x76, 0xFE, 0x82, 0x95, 0x35, 0x8D, 0xD0, 0xB0, 0x60, 0x00, 0x00, 0x03, 0x9A,
+    0xB7, 0xA2, 0x0B, 0x6C, 0x5B, 0xC2, 0x3F, 0x60, 0x42, 0x63, 0x87, 0x45, 0xE1, 0x7E, 0x50, 0x40,
+    0xDE, 0x8F, 0x28, 0xF9, 0x0B, 0xB4, 0xED, 0x0B, 0xC8, 0x63, 0x0D, 0xC0, 0x64, 0x75, 0x31, 0x1E,
+    0x39, 0xA0, 0x21, 0x19, 0x18, 0xE2, 0x5E, 0x16, 0x98, 0x4B, 0x58, 0x61, 0x91, 0x00, 0x15, 0xF9,
+    0x00, 0x73, 0xD2, 0x77, 0xA8, 0xAE, 0x00, 0x68, 0xF2, 0x34, 0xF8, 0x05, 0xF1, 0x07, 0xB0, 0x28,
+    0x81, 0x84, 0x21, 0xD0, 0x76, 0x88, 0xF3, 0xFE, 0xD7, 0xB3, 0xA0, 0x67, 0x2B, 0xDC, 0xF9, 0x4B,
+    0x80, 0x01, 0x1D, 0x28, 0xC0, 0x18, 0x7F, 0xE5, 0x60, 0x71, 0x17, 0x8F, 0xC6, 0x60, 0xF8, 0x0D,
+    0x8E, 0x41, 0x00, 0x83, 0x1A, 0x21, 0x50, 0x32, 0x63, 0x66, 0x06, 0x33, 0x22, 0x48, 0x26, 0x43,
+    0x72, 0x90, 0x26, 0x22, 0x85, 0xFE, 0x3F, 0x37, 0x6B, 0xC6, 0xAD, 0xFF, 0x30, 0x9B, 0x0E, 0xFF,
+    0xDF, 0x0F, 0xCE, 0x53, 0x89, 0x7F, 0xC1, 0xF9, 0x01, 0xE8, 0x50, 0x48, 0x82, 0x85, 0x47, 0xCE,
+    0xAF, 0xFD, 0x4C, 0x30, 0xBD, 0xE0, 0x88, 0xDE, 0x00, 0x75, 0x3D, 0x24, 0x66, 0x80, 0xDE, 0xFB,
+    0x09, 0x4E, 0xA5, 0x02, 0xD0, 0x7C, 0xC1, 0x03, 0x14, 0x04, 0x39, 0xEE, 0x28, 0xB0, 0x88, 0x39,
+    0xA4, 0x0B, 0x74, 0xB4, 0x3E, 0xC3, 0x03, 0x50, 0xD0, 0x6E, 0x04, 0x3A, 0xC2, 0xFF, 0x3B, 0x50,
+    0xE9, 0x83, 0x7C, 0x86, 0x1F, 0x40, 0x83, 0x05, 0xFE, 0xDE, 0x77, 0x5F, 0xFA, 0xFE, 0x17, 0xD0,
+    0x43, 0x1B, 0xE6, 0x33, 0x80, 0x8C, 0x04, 0xFB, 0xFD, 0x0B, 0x28, 0x03, 0x4E, 0x58, 0x9F, 0xF0,
+    0x1F, 0x96, 0x92, 0x36, 0x80, 0x32, 0xE2, 0x84, 0xF5, 0x1B, 0xD6, 0x83, 0xD2, 0x30, 0x1F, 0x2C,
+    0x2D, 0x2D, 0x98, 0xFF, 0x21, 0x9E, 0x50, 0x79, 0xF5, 0x15, 0x68, 0xD2, 0xA7, 0xF3, 0x90, 0x74,
+    0x04, 0x8C, 0xFB, 0xCF, 0xF2, 0xDF, 0x80, 0x29, 0xE7, 0xEB, 0x7C, 0x06, 0x58, 0x79, 0xF5, 0x83,
+    0xE7, 0x3B, 0x30, 0xF6, 0xBF, 0x81, 0xD3, 0xE3, 0x0F, 0x90, 0x7D, 0xFF, 0xD8, 0x40, 0x02, 0x5F,
+    0xFB, 0xC1, 0x89, 0x04, 0xA8, 0xB1, 0xE0, 0x3D, 0xC3, 0x77, 0xA0, 0x16, 0x70, 0x3A, 0x7F, 0x04,
+    0x4A, 0x1E, 0x9F, 0xE2, 0x19, 0x40, 0x86, 0x5E, 0x00, 0x5A, 0x1B, 0xF0, 0xEF, 0xF7, 0x7A, 0xA0,
+    0x17, 0xB8, 0x18, 0x3E, 0xE9, 0x83, 0xE2, 0xF1, 0x7C, 0xC7, 0xDF, 0xFE, 0x2F, 0xFF, 0xCD, 0x9E,
+    0xEF, 0x07, 0x7B, 0x0F, 0x92, 0x8F, 0xD8, 0x36, 0xFC, 0x07, 0x07, 0xF2, 0x02, 0x90, 0x1B, 0x0C,
+    0x5E, 0x9D, 0x03, 0xE6, 0xFC, 0xEB, 0xF7, 0xAC, 0xC0, 0x86, 0xB3, 0x30, 0xA0, 0x82, 0x3F, 0x72,
+    0x68, 0x02, 0x9F, 0xF6, 0xA3, 0x09, 0x24, 0x80, 0x8A, 0x38, 0x30, 0x48, 0x84, 0xD2, 0x3F, 0xDE,
+    0x43, 0x92, 0xC0, 0x22, 0x58, 0x0A, 0x4B, 0xF8, 0xFF, 0x3E, 0x53, 0x59, 0xD0, 0xE9, 0x04, 0x22,
+    0x21, 0x4F, 0x84, 0x64, 0xE0, 0xF9, 0xF0, 0xF8, 0x63, 0x48, 0x04, 0xC6, 0xFB, 0xFD, 0x28, 0x54,
+    0xA3, 0x19, 0xE1, 0x2C, 0x00, 0x83, 0xF8, 0x8E, 0x05, 0x11, 0x18, 0x5F, 0xEA, 0x11, 0xEC, 0xDF,
+    0x88, 0x40, 0x52, 0xF8, 0x0F, 0x73, 0x13, 0x58, 0x1B, 0xCC, 0x6A, 0x60, 0x80, 0x42, 0x43, 0x0B,
+    0x14, 0xA6, 0xF3, 0x7F, 0xC1, 0x03, 0xE9, 0x8F, 0xFD, 0x97, 0xF7, 0x70, 0xAD, 0x3C, 0x17, 0x60,
+    0x36, 0x4F, 0xF8, 0xCF, 0x96, 0x00, 0x0B, 0xBE, 0x0F, 0x40, 0x05, 0x50, 0xA7, 0x31, 0x7C, 0x03,
+    0x6A, 0xFC, 0x09, 0x0D, 0xCB, 0xBF, 0xFA, 0x20, 0x9F, 0x30, 0x42, 0x82, 0x9D, 0x1B, 0x14, 0xA1,
+    0xEC, 0x90, 0x00, 0x66, 0x05, 0x45, 0x2A, 0x2F, 0x22, 0xFC, 0xF0, 0xE6, 0x7B, 0x07, 0x28, 0x13,
+    0x14, 0x29, 0x1B, 0x60, 0x6C, 0x60, 0xF6, 0x84, 0x25, 0xC0, 0xBF, 0xC0, 0x5C, 0xF2, 0x03, 0xEA,
+    0xD7, 0x6F, 0xE7, 0x41, 0x19, 0x12, 0xEA, 0xAA, 0xFF, 0x4C, 0xF0, 0x94, 0x33, 0xE1, 0x3F, 0xE7,
+    0x01, 0x58, 0x2E, 0x55, 0xF8, 0xCF, 0xFF, 0xF1, 0x3C, 0xDC, 0x77, 0xFE, 0x17, 0xFC, 0xE1, 0x01,
+    0x26, 0x87, 0x94, 0xD5, 0x19, 0x00, 0x33, 0x70, 0x01, 0x02, 0x13, 0x61, 0x44, 0x2C, 0xE6, 0x22,
+    0xE2, 0x90, 0x8B, 0xE1, 0xF7, 0xFB, 0xDD, 0x40, 0xF0, 0x0F, 0xE8, 0xF7, 0xDF, 0x60, 0xF7, 0x3B,
+    0xFC, 0xFB, 0x0F, 0x65, 0x31, 0x7C, 0xF9, 0xCF, 0x02, 0x65, 0x01, 0xC3, 0x14, 0xCA, 0x3A, 0xF0,
+    0x9F, 0x1D, 0xCA, 0x02, 0xFA, 0x00, 0xCA, 0x02, 0xE6, 0x72, 0x28, 0xEB, 0xD7, 0x7C, 0x86, 0xDF,
+    0xF3, 0x05, 0x05, 0x05, 0x15, 0x8F, 0x02, 0x03, 0x10, 0x6A, 0x47, 0x3F, 0xDC, 0xB6, 0xF7, 0xEC,
+    0x40, 0xD6, 0x3B, 0x20, 0x00, 0xE6, 0x2C, 0xA8, 0x1D, 0x0A, 0x3F, 0xFE, 0x73, 0x41, 0xF5, 0x06,
+    0xFC, 0xB7, 0x87, 0xB2, 0x80, 0x66, 0xC0, 0x58, 0x3F, 0xF6, 0xC3, 0x58, 0xDF, 0xCE, 0x63, 0x8A,
+    0xFD, 0x81, 0xA9, 0x03, 0xA6, 0x3F, 0x08, 0xCB, 0xE0, 0xE7, 0x7F, 0x1E, 0x98, 0x1D, 0xEF, 0x99,
+    0xA0, 0x99, 0xE9, 0xBF, 0x0E, 0xD0, 0x2B, 0xE0, 0x8C, 0xED, 0xC5, 0xC0, 0x00, 0x00, 0x03, 0xD3,
+    0x81, 0xED, 0x15, 0xA2, 0x50, 0xB3, 0x8E, 0x81, 0x22, 0x2F, 0x07, 0xCC, 0x7C, 0x8A, 0x88, 0xC9,
+    0x09, 0xC0, 0xEC, 0x9E, 0xD1, 0x06, 0x4C, 0x1F, 0xA0, 0x70, 0x06, 0x67, 0x3E, 0x86, 0x67, 0xFB,
+    0x41, 0xFA, 0xA1, 0xDE, 0x67, 0x06, 0x59, 0x83, 0x48, 0xF2, 0x7F, 0xCE, 0xC3, 0x99, 0x0E, 0x50,
+    0xCB, 0x21, 0x41, 0xC4, 0x0D, 0x67, 0x3F, 0x80, 0x79, 0x11, 0xD9, 0xD9, 0xA0, 0x00, 0xFA, 0x8F,
+    0x88, 0x97, 0x2F, 0xEF, 0xB1, 0xB3, 0x3F, 0x23, 0xA9, 0xF9, 0x88, 0xA4, 0x17, 0x1E, 0xB9, 0x60,
+    0x17, 0xC3, 0x23, 0x09, 0x18, 0x79, 0xFE, 0x08, 0x0D, 0xBF, 0xEF, 0x33, 0x20, 0x59, 0xCC, 0x8D,
+    0x94, 0x44, 0xCE, 0x83, 0x4D, 0x52, 0x10, 0x03, 0xC5, 0xD6, 0xFF, 0x7E, 0x20, 0x47, 0xE1, 0xE7,
+    0x79, 0x48, 0x61, 0x71, 0x7F, 0xF6, 0xCE, 0x7F, 0x60, 0xBF, 0x33, 0x1C, 0x86, 0x84, 0x09, 0x38,
+    0xBF, 0x30, 0x2C, 0xF9, 0x07, 0xCC, 0x9A, 0x96, 0x50, 0xFD, 0x0A, 0x21, 0xAE, 0x20, 0xFD, 0x00,
+    0x33, 0x70, 0x01, 0x02, 0x13, 0x26, 0x06, 0x42, 0xF1, 0xB8, 0x6A, 0xD5, 0x1F, 0xB0, 0x76, 0x68,
+    0x0C, 0x7D, 0x07, 0x25, 0x32, 0x08, 0x1B, 0x98, 0xCE, 0x80, 0x2E, 0x84, 0xB2, 0x81, 0x4E, 0xE0,
+    0x84, 0xB3, 0x0B, 0x80, 0xF1, 0x08, 0x63, 0x33, 0xFC, 0xCB, 0x47, 0xB0, 0x81, 0xCE, 0x83, 0xB3,
+    0x81, 0x11, 0x01, 0x67, 0x7F, 0xFA, 0xCF, 0x08, 0x67, 0x03, 0x8B, 0x00, 0x24, 0x36, 0x33, 0x56,
+    0xF6, 0x47, 0x24, 0x35, 0x9F, 0xFF, 0x23, 0xCC, 0xF9, 0x86, 0x64, 0xE6, 0xAF, 0xF5, 0x70, 0xB6,
+    0x00, 0xD0, 0xD1, 0x30, 0xF6, 0x04, 0x60, 0x56, 0x85, 0xB1, 0xBF, 0x00, 0x23, 0x0E, 0xCA, 0x0E,
+    0xF8, 0x7F, 0x1F, 0xE6, 0x2F, 0xC7, 0xDF, 0xA0, 0x70, 0xFB, 0xFD, 0xFF, 0xDD, 0xBB, 0x77, 0xFF,
+    0x80, 0x01, 0x01, 0x4C, 0x08, 0xD0, 0xEC, 0x07, 0xCE, 0x2D, 0x5F, 0xC0, 0xAC, 0x73, 0x96, 0x20,
+    0x95, 0x00, 0x33, 0x70, 0x01, 0x03, 0x15, 0x58, 0x24, 0xFE, 0x67, 0x87, 0xC5, 0x20, 0x27, 0x28,
+    0xFA, 0x80, 0x60, 0x16, 0xE3, 0x6F, 0x98, 0x5F, 0x28, 0x65, 0xFC, 0x7F, 0x07, 0x02, 0xEC, 0xB0,
+    0x44, 0xC2, 0x0F, 0x63, 0x70, 0x30, 0x50, 0xCD, 0x0A, 0x34, 0xBB, 0xEE, 0x31, 0x43, 0xF3, 0xCC,
+    0x7F, 0xAE, 0x2F, 0x10, 0xFA, 0x3D, 0x0B, 0x00, 0x33, 0x70, 0x01, 0x03, 0x15, 0x58, 0x24, 0xFE,
+    0x67, 0x81, 0xC5, 0x20, 0x1B, 0x28, 0xFA, 0x80, 0xA0, 0x0B, 0x1A, 0x2B, 0xF0, 0xE8, 0x21, 0x9F,
+    0xF1, 0xFF, 0x1D, 0x10, 0xDC, 0x63, 0x81, 0x25, 0x12, 0x1E, 0x18, 0x83, 0x8D, 0x7A, 0x56, 0x60,
+    0x30, 0x7E, 0x41, 0x73, 0x03, 0xC3, 0x17, 0x19, 0x28, 0x03, 0x00, 0x03, 0xD3, 0x41, 0x33, 0x66,
+    0xBA, 0x43, 0xCD, 0xBA, 0x06, 0x8A, 0xBC, 0xFD, 0x60, 0xE9, 0x27, 0x90, 0x98, 0xEC, 0x87, 0x28,
+    0xDC, 0x9F, 0x51, 0x76, 0xF3, 0xFF, 0x7D, 0xB0, 0x9F, 0xEB, 0x41, 0x0E, 0x5A, 0x9C, 0x0B, 0x72,
+    0xDE, 0x79, 0x26, 0x98, 0xFF, 0x3F, 0xC3, 0x9D, 0x03, 0xF4, 0xFF, 0x7B, 0x46, 0x18, 0xD3, 0x01,
+    0x92, 0xA2, 0xA1, 0x41, 0x04, 0x0F, 0x38, 0x44, 0x44, 0x20, 0x3B, 0x1B, 0x6C, 0x0C, 0x22, 0x5E,
+    0xBE, 0x80, 0x43, 0x49, 0x61, 0xC6, 0xCC, 0x99, 0x33, 0x99, 0x21, 0xEC, 0x0D, 0x20, 0x07, 0xF1,
+    0x41, 0xD4, 0x80, 0x02, 0xFC, 0x3F, 0xFF, 0x47, 0x88, 0x57, 0xD2, 0xD2, 0xDA, 0xFE, 0xF3, 0x5F,
+    0x80, 0x86, 0x10, 0x30, 0xB6, 0xF8, 0x1B, 0x60, 0x59, 0x11, 0xC8, 0x56, 0x80, 0x26, 0x1F, 0x10,
+    0x9B, 0xE1, 0x17, 0xD4, 0x32, 0x10, 0xFB, 0x21, 0x28, 0x5B, 0x43, 0xD9, 0x0E, 0xFF, 0xDF, 0xB3,
+    0xC2, 0xD8, 0xC0, 0x84, 0x06, 0x2A, 0xDD, 0x04, 0x8E, 0x81, 0xD8, 0x0E, 0xFF, 0xFE, 0xFF, 0x5F,
+    0xB3, 0x0B, 0x58, 0xA2, 0x80, 0x82, 0x7D, 0x21, 0x24, 0x4C, 0xF2, 0xC0, 0xDA, 0x26, 0x01, 0x65,
+    0xFE, 0x47, 0x43, 0x1D, 0x2B, 0x10, 0x12, 0x0A, 0x72, 0x09, 0x00, 0x53, 0x60, 0x84, 0x1A, 0x62,
+    0xC8, 0xF0, 0xDD, 0x1E, 0x9A, 0x6E, 0xFE, 0xB3, 0xFF, 0x86, 0xBA, 0x1E, 0x98, 0x27, 0xE9, 0xC1,
+    0x7C, 0x7F, 0x17, 0x0C, 0xDE, 0x02, 0x99, 0xFF, 0x61, 0x00, 0x85, 0x59, 0x2F, 0x08, 0x06, 0x85,
+    0xF4, 0x71, 0x0E, 0x9C, 0xC9, 0xF5, 0x05, 0x9A, 0xB6, 0x04, 0xDE, 0xB2, 0x00, 0x00, 0x53, 0x60,
+    0xFC, 0x6E, 0xFF, 0x3B, 0x9F, 0x34, 0xF8, 0x45, 0x16, 0x00, 0x83, 0xAA, 0x83, 0x26, 0xC5, 0x87,
+    0x50, 0xEF, 0xC0, 0x52, 0xE9, 0xC0, 0xD3, 0x0A, 0x90, 0xE4, 0x71, 0xFF, 0x87, 0x2C, 0x24, 0xC6,
+    0xFF, 0xAC, 0x07, 0xFB, 0xC4, 0xFE, 0xEB, 0x7F, 0x69, 0x50, 0x4C, 0x70, 0x4F, 0xF8, 0xFF, 0x7F,
+    0x35, 0x30, 0xDD, 0x32, 0x42, 0xB2, 0x80, 0x2C, 0xA4, 0x00, 0xAB, 0x03, 0x87, 0x4F, 0x28, 0xB0,
+    0xF8, 0x62, 0x00, 0x00, 0x4D, 0x93, 0xCB, 0x09, 0x83, 0x50, 0x10, 0x45, 0x8D, 0x2E, 0x44, 0x70,
+    0x11, 0xB0, 0x01, 0x4B, 0xB0, 0x03, 0xED, 0x30, 0x25, 0x68, 0x07, 0x29, 0x21, 0x49, 0x05, 0xC1,
+    0x0A, 0x24, 0x5A, 0x80, 0x10, 0x24, 0x59, 0x8C, 0x3A, 0x99, 0xCF, 0x7D, 0xC1, 0xDD, 0x81, 0xC7,
+    0x1B, 0x66, 0xEE, 0xA7, 0xC4, 0x8F, 0xA8, 0x88, 0xBE, 0x35, 0x2E, 0x19, 0xE0, 0x83, 0xBA, 0x19,
+    0xF0, 0x2E, 0xA9, 0x82, 0x3B, 0xAB, 0xB8, 0xE0, 0xF8, 0xD0, 0xB8, 0x1A, 0x9E, 0xB7, 0x39, 0x01,
+    0xF6, 0xDA, 0x15, 0xC3, 0x72, 0xB7, 0x3C, 0x29, 0x8E, 0xEE, 0x92, 0x60, 0xB5, 0x0F, 0x27, 0xE0,
+    0xA4, 0x0D, 0x34, 0x14, 0x79, 0x73, 0xE0, 0xC2, 0x28, 0x03, 0xDD, 0xF8, 0x4A, 0xBE, 0xB1, 0x84,
+    0x2A, 0xEB, 0xFD, 0x0A, 0x92, 0xD7, 0x8A, 0x6D, 0x04, 0xA9, 0xDE, 0x1F, 0x53, 0x81, 0x5A, 0x13,
+    0xE8, 0xF2, 0x8F, 0x90, 0xEE, 0x08, 0x7C, 0xE9, 0x3E, 0x8E, 0x0D, 0x3F, 0x03, 0x5A, 0x1F, 0x80,
+    0x9D, 0x98, 0x15, 0x2E, 0xDE, 0x38, 0x0E, 0xF8, 0xE6, 0x74, 0x41, 0xB6, 0x9A, 0x39, 0x3E, 0xF4,
+    0xF9, 0x07, 0x53, 0x60, 0x84, 0xF9, 0xCA, 0x1E, 0xCA, 0xF8, 0x9D, 0x3F, 0x2C, 0x18, 0x90, 0x64,
+    0xB8, 0x9F, 0x01, 0x9A, 0x67, 0xFE, 0xB3, 0x7C, 0x81, 0xD0, 0xE7, 0x19, 0x00, 0x33, 0x60, 0x84,
+    0x07, 0x83, 0x11, 0xC3, 0x77, 0x7F, 0x18, 0xDB, 0xE0, 0x3F, 0xDB, 0x6F, 0x78, 0x08, 0x5D, 0xF8,
+    0xCF, 0xF5, 0x1B, 0x66, 0x05, 0xD0, 0xCB, 0x40, 0x8E, 0x3D, 0x3C, 0x54, 0x80, 0x9C, 0xFB, 0x30,
+    0x55, 0x40, 0xCE, 0x7B, 0xA8, 0xBA, 0x9F, 0x20, 0x4E, 0x3C, 0x44, 0x9D, 0xC1, 0xFF, 0x79, 0x40,
+    0x8E, 0xFD, 0x8F, 0xFB, 0x10, 0x55, 0xAD, 0x20, 0xCE, 0x05, 0x70, 0x58, 0xFD, 0x5C, 0xDF, 0x00,
+    0xE2, 0x18, 0x80, 0xD4, 0x19, 0xFC, 0x97, 0x03, 0x73, 0x18, 0x7E, 0xDE, 0x07, 0x07, 0x00, 0x84,
+    0x03, 0x52, 0xF7, 0x73, 0x3D, 0x03, 0x84, 0xE3, 0xF0, 0xDF, 0xDE, 0x01, 0x18, 0xF5, 0x10, 0x0E,
+    0x50, 0xDD, 0x43, 0x60, 0x30, 0x41, 0x39, 0x0F, 0xFF, 0xFF, 0xDB, 0xCF, 0x00, 0xE3, 0x00, 0xF3,
+    0xAC, 0x3C, 0x9C, 0xC3, 0xF0, 0x0B, 0xE4, 0x6B, 0x18, 0xE7, 0xE1, 0x7E, 0x06, 0x04, 0x47, 0x80,
+    0x15, 0x89, 0x03, 0x0D, 0x10, 0xF2, 0x38, 0xFA, 0x88, 0x84, 0xC6, 0xF9, 0x05, 0x16, 0x2D, 0x0C,
+    0x0A, 0x6F, 0x99, 0x01, 0x45, 0xD4, 0x61, 0x09, 0x80, 0x30, 0x10, 0x05, 0x60, 0x07, 0x82, 0x22,
+    0x22, 0x36, 0x30, 0x82, 0x6B, 0x60, 0x15, 0x23, 0xD8, 0xC0, 0x08, 0x56, 0xB1, 0x81, 0x11, 0xC4,
+    0x08, 0x26, 0x10, 0x04, 0x11, 0x1D, 0x38, 0xDF, 0x6E, 0x7B, 0xFA, 0xEF, 0xFB, 0xF5, 0xD8, 0xBD,
+    0x3B, 0xA6, 0x55, 0x08, 0xD1, 0xEA, 0x6C, 0x38, 0x60, 0x61, 0xF8, 0xA4, 0xBB, 0x32, 0xAC, 0xD1,
+    0xB1, 0xFF, 0x19, 0x22, 0xC0, 0x39, 0xAC, 0x03, 0xAC, 0x9F, 0x89, 0xC4, 0x7D, 0x27, 0x64, 0xE7,
+    0x5F, 0xE0, 0x18, 0x19, 0xF9, 0x09, 0x84, 0xAB, 0x4C, 0x20, 0xD4, 0x12, 0x2D, 0x44, 0xBF, 0x31,
+    0x39, 0xBA, 0x68, 0xCF, 0xD2, 0x45, 0x7B, 0x62, 0xA4, 0x94, 0xEC, 0x70, 0xD0, 0x81, 0xD1, 0xBD,
+    0x29, 0x72, 0xB1, 0x39, 0xA9, 0xED, 0x40, 0xA2, 0xCB, 0x87, 0xC4, 0xBE, 0x48, 0xF4, 0xF1, 0x71,
+    0xFF, 0xD9, 0xDA, 0xEA, 0x60, 0xC5, 0x57, 0xF6, 0x02, 0x03, 0xAB, 0x6A, 0x9D, 0x59, 0x09, 0x4B,
+    0x8B, 0x04, 0xD3, 0xDB, 0x7A, 0x70, 0xBA, 0x00, 0xA7, 0x98, 0x80, 0x7F, 0x20, 0xA7, 0x1C, 0x80,
+    0x46, 0xCE, 0x46, 0x90, 0x97, 0xBF, 0xC1, 0xAC, 0xF8, 0x03, 0x74, 0xF5, 0xBF, 0xF5, 0x70, 0x8F,
+    0x71, 0x06, 0x40, 0xE2, 0x14, 0xEC, 0x27, 0xFE, 0x0D, 0x88, 0xA8, 0xF9, 0x1F, 0xFF, 0x01, 0xE6,
+    0x59, 0x60, 0x04, 0xCC, 0xFF, 0x04, 0xF5, 0x2C, 0x28, 0x98, 0xCF, 0x7F, 0xF9, 0x0F, 0x8F, 0xA2,
+    0xAF, 0xEF, 0xBF, 0x20, 0x22, 0xEC, 0xCB, 0x7F, 0x14, 0xCE, 0x67, 0x64, 0x65, 0x1F, 0x61, 0x41,
+    0x00, 0x2A, 0x0A, 0xE0, 0xB1, 0x0D, 0x74, 0x4F, 0xFF, 0x04, 0x78, 0xB4, 0x29, 0xFC, 0xF7, 0x77,
+    0x80, 0x86, 0x09, 0x28, 0x58, 0xF9, 0x18, 0xFE, 0x40, 0xB3, 0x3F, 0x30, 0xAC, 0xD8, 0x81, 0x06,
+    0x42, 0xC3, 0x97, 0x40, 0xB9, 0x03, 0x8C, 0xF0, 0xF3, 0xAB, 0x6E, 0x13, 0x2E, 0x1F, 0x19, 0x18,
+    0x1C, 0x43, 0x4D, 0xC1, 0x34, 0x00, 0x33, 0x70, 0x01, 0x02, 0x63, 0x78, 0x24, 0xAE, 0x67, 0x82,
+    0xC5, 0xA0, 0x3F, 0xC3, 0xEF, 0xFD, 0xAB, 0x56, 0xAD, 0x3A, 0xF5, 0xFF, 0x3F, 0xF3, 0x6F, 0x7B,
+    0x48, 0x82, 0xE3, 0x85, 0x30, 0x14, 0xFE, 0xFB, 0x43, 0x18, 0x0C, 0x3F, 0xE7, 0x43, 0x19, 0x5F,
+    0xCE, 0x43, 0x19, 0x9F, 0xEF, 0xA3, 0x8B, 0xFC, 0x58, 0x0F, 0x61, 0x08, 0xFC, 0x8B, 0x87, 0x30,
+    0x36, 0xFE, 0xE7, 0xFB, 0xDD, 0x9F, 0x96, 0x96, 0xD6, 0xF6, 0xEF, 0x3F, 0x0B, 0xD4, 0xAE, 0x7C,
+    0xA8, 0xA5, 0xF7, 0x59, 0x18, 0x7E, 0xCF, 0x2F, 0x2F, 0x2F, 0x4F, 0x67, 0x06, 0x65, 0x15, 0x06,
+    0x58, 0x9E, 0xA1, 0x0E, 0xE3, 0x0B, 0x2C, 0xB8, 0x00, 0x03, 0xAB, 0x6A, 0x9D, 0x59, 0x09, 0x4F,
+    0x8B, 0x0C, 0xC8, 0x29, 0x0E, 0x2D, 0xCD, 0x21, 0x52, 0xDD, 0x7A, 0x68, 0xFA, 0x00, 0xA7, 0x9C,
+    0x80, 0x7F, 0x10, 0x27, 0x1D, 0x80, 0x46, 0xD3, 0x46, 0x88, 0xE7, 0xBF, 0xC1, 0x34, 0xFD, 0x01,
+    0xFB, 0xE0, 0xDF, 0x7A, 0xB8, 0x37, 0x39, 0x41, 0xB1, 0x23, 0x0F, 0x8F, 0x1B, 0x7E, 0x90, 0x17,
+    0xE0, 0x91, 0x05, 0x4A, 0xBE, 0x1F, 0x60, 0x01, 0x00, 0x8C, 0x94, 0xF9, 0x20, 0x7F, 0x31, 0xC2,
+    0x03, 0x1F, 0x18, 0x80, 0x5F, 0xFE, 0xC3, 0x1D, 0x0B, 0x8A, 0xC6, 0x2F, 0x88, 0xA8, 0x04, 0xC9,
+    0xA0, 0x71, 0x3F, 0xA3, 0x2A, 0xFE, 0x08, 0x0B, 0x22, 0x48, 0x51, 0x01, 0x4F, 0x0F, 0x40, 0x57,
+    0xF6, 0x83, 0xC2, 0x18, 0x16, 0xB5, 0x0A, 0xA0, 0x9C, 0xE8, 0x00, 0x0D, 0x39, 0x90, 0x04, 0x28,
+    0x67, 0xFF, 0x81, 0x16, 0x13, 0x40, 0x43, 0xD9, 0xC1, 0xC6, 0x43, 0x63, 0xE2, 0xDF, 0x7D, 0x88,
+    0x1A, 0xE4, 0x32, 0x0A, 0xA3, 0x94, 0x02, 0x26, 0x90, 0xF3, 0xAB, 0x6E, 0xFF, 0x87, 0x27, 0x0C,
+    0xD4, 0x12, 0x15, 0xB5, 0x4C, 0x05, 0x85, 0xED, 0x8F, 0xFF, 0x51, 0x88, 0x24, 0x9A, 0xF0, 0xFB,
+    0xFF, 0x7E, 0x48, 0x90, 0x18, 0x42, 0x42, 0x14, 0x18, 0x45, 0xEC, 0xE0, 0xC4, 0x00, 0x32, 0xFC,
+    0xDF, 0xFF, 0x33, 0x40, 0xBE, 0x05, 0x83, 0xC1, 0x2F, 0x70, 0x12, 0x5C, 0xCC, 0xCE, 0x90, 0x00,
+    0x2C, 0x01, 0xDF, 0x03, 0x4D, 0x87, 0x85, 0x1B, 0x88, 0x0F, 0xD1, 0x01, 0x01, 0x0E, 0x3B, 0xEE,
+    0xCC, 0x01, 0xDA, 0x05, 0x00, 0x33, 0x70, 0x01, 0x01, 0x65, 0xA4, 0x68, 0xEC, 0x43, 0x8A, 0x45,
+    0x5D, 0x48, 0x24, 0xAE, 0x5A, 0xF5, 0xEA, 0x3F, 0x30, 0x03, 0x43, 0x62, 0x07, 0xE8, 0x20, 0x6E,
+    0x18, 0x13, 0x14, 0x54, 0x50, 0x26, 0xC3, 0xBF, 0x7C, 0x38, 0xF3, 0xD7, 0x7C, 0x38, 0xF3, 0x27,
+    0x82, 0xF9, 0xBB, 0x1E, 0xCE, 0x04, 0xBA, 0x08, 0xCA, 0x6C, 0x00, 0x06, 0x26, 0x94, 0xF9, 0x15,
+    0xE8, 0xAA, 0xDF, 0xEB, 0x43, 0x81, 0x60, 0x1B, 0x28, 0x09, 0x43, 0xDD, 0x70, 0x9F, 0x19, 0xE1,
+    0x1C, 0x60, 0x00, 0x40, 0x14, 0x6C, 0x07, 0x25, 0x08, 0xB8, 0x36, 0x26, 0x18, 0x73, 0x01, 0x30,
+    0x06, 0xA0, 0xCC, 0x00, 0x84, 0x23, 0x1D, 0x10, 0x56, 0x18, 0x00, 0xD3, 0x01, 0x94, 0xA9, 0x00,
+    0xCC, 0xB4, 0x98, 0xCE, 0x01, 0xA6, 0x22, 0xA6, 0x5F, 0xF9, 0xB0, 0xD0, 0xE4, 0x7C, 0x0C, 0x4D,
+    0x5B, 0x06, 0x6F, 0x59, 0x00, 0x03, 0xE5, 0x8F, 0x19, 0x9D, 0xB8, 0xF3, 0xC7, 0xFF, 0xF9, 0x6E,
+    0x29, 0xBF, 0xFE, 0xDF, 0x67, 0x14, 0xF8, 0xBF, 0x1E, 0x14, 0xDF, 0x3F, 0x40, 0x99, 0x17, 0xEC,
+    0x7D, 0x83, 0x77, 0x8C, 0x0B, 0x60, 0xCE, 0x04, 0xBA, 0x80, 0x05, 0x1E, 0x0C, 0x6C, 0xE8, 0x61,
+    0x0E, 0x74, 0xE9, 0x7D, 0xA8, 0xBB, 0x18, 0x7E, 0xFC, 0x5F, 0x0F, 0x55, 0x39, 0x01, 0x68, 0x41,
+    0x36, 0x13, 0x34, 0xF9, 0xC3, 0x73, 0xD3, 0x94, 0x7F, 0xC0, 0x1C, 0x06, 0x71, 0x9C, 0xC2, 0x71,
+    0x68, 0x6E, 0x00, 0x82, 0x4D, 0xFF, 0xDF, 0x23, 0x42, 0x9F, 0x0D, 0x6E, 0x29, 0x2C, 0x82, 0x03,
+    0xE0, 0x31, 0xE2, 0xF0, 0x9F, 0xE7, 0x90, 0x34, 0xD4, 0x7A, 0xAE, 0x1F, 0x10, 0x6B, 0x1F, 0xFD,
+    0x67, 0xFB, 0xF2, 0x7F, 0x3E, 0x90, 0x99, 0x00, 0x2C, 0x49, 0x40, 0xF9, 0x79, 0xD6, 0x4E, 0x3C,
+    0xF9, 0x59, 0x21, 0xC4, 0x15, 0x14, 0xDE, 0x00, 0x33, 0x70, 0x81, 0x02, 0x13, 0x86, 0x1F, 0xFF,
+    0x61, 0x80, 0xE3, 0x37, 0x9C, 0xC9, 0xD5, 0x34, 0x73, 0xE6, 0xCC, 0x5F, 0xFF, 0x81, 0x44, 0x27,
+    0x23, 0xC4, 0x0A, 0x78, 0xB0, 0x0D, 0x67, 0xE6, 0x47, 0x04, 0x73, 0x01, 0x24, 0x6F, 0x02, 0x00,
+    0x33, 0x80, 0xEA, 0x60, 0x50, 0x66, 0xF8, 0x0E, 0xF1, 0x36, 0x30, 0xE0, 0x98, 0x7E, 0x43, 0x5D,
+    0xDF, 0xF0, 0x9F, 0x75, 0x48, 0x30, 0x7F, 0xF6, 0xC3, 0x22, 0x81, 0xE5, 0xFB, 0x79, 0x58, 0x4C,
+    0x33, 0xC2, 0x72, 0xD8, 0xD7, 0xFB, 0xC0, 0x44, 0xC1, 0x03, 0x49, 0xD0, 0xF5, 0xC0, 0xF0, 0xDB,
+    0x0F, 0xC9, 0x3F, 0xBC, 0xA0, 0xF8, 0x8B, 0x65, 0x60, 0x28, 0xFC, 0x0F, 0x52, 0x07, 0x8C, 0xBF,
+    0xF3, 0x77, 0xFE, 0x43, 0xF2, 0x0E, 0x38, 0x41, 0xDF, 0x07, 0x6B, 0x16, 0x78, 0x81, 0x94, 0xD3,
+    0x0D, 0x4D, 0xC0, 0x14, 0x00, 0x73, 0x60, 0x82, 0x79, 0xC0, 0x91, 0xE1, 0xA7, 0x3C, 0x8C, 0xFD,
+    0x8F, 0xFB, 0x37, 0xCC, 0xBB, 0x09, 0xFF, 0x79, 0xE1, 0x61, 0x75, 0xE0, 0x3F, 0xFB, 0x03, 0x98,
+    0xD3, 0x3E, 0xFD, 0x67, 0x2C, 0x80, 0x05, 0xC4, 0xCF, 0xF9, 0x40, 0x9B, 0xEC, 0xA1, 0x59, 0x00,
+    0x18, 0x78, 0xBF, 0xD6, 0x43, 0xB5, 0xF2, 0x80, 0xAC, 0x67, 0x84, 0xC7, 0xCA, 0x01, 0x88, 0x17,
+    0xC0, 0x79, 0x20, 0x01, 0x12, 0x25, 0x3F, 0xEB, 0x11, 0x39, 0x18, 0x12, 0xED, 0xE0, 0x1C, 0x9C,
+    0x00, 0xF1, 0x24, 0xD8, 0x43, 0x17, 0x20, 0xAE, 0xDD, 0x00, 0x0A, 0x5E, 0x68, 0x46, 0x75, 0x00,
+    0x65, 0xB4, 0x5F, 0xD0, 0x20, 0xFE, 0x9B, 0x0F, 0xB4, 0x1D, 0x9A, 0xF1, 0xBE, 0x9F, 0x07, 0x86,
+    0x19, 0x07, 0x2C, 0x38, 0x99, 0x2F, 0xC0, 0x02, 0x64, 0xC2, 0x7F, 0xAE, 0x2F, 0xD0, 0x30, 0x01,
+    0xC6, 0xA5, 0xFC, 0x2F, 0x7F, 0x98, 0x4F, 0xFF, 0xCC, 0x87, 0x25, 0x0D, 0x50, 0xF2, 0x82, 0x06,
+    0x31, 0x38, 0xA1, 0x40, 0x83, 0x1D, 0x1C, 0x4C, 0xF3, 0xE1, 0x69, 0x45, 0x00, 0x9A, 0x38, 0x20,
+    0xB6, 0x41, 0x6C, 0x02, 0x00, 0x55, 0x94, 0xCB, 0x0D, 0x82, 0x40, 0x18, 0x84, 0x37, 0x31, 0x1A,
+    0xA3, 0x04, 0xB8, 0x78, 0xF1, 0xA2, 0x17, 0xCF, 0x52, 0x02, 0x1D, 0x28, 0x95, 0x60, 0x01, 0x26,
+    0x58, 0x82, 0x1D, 0x40, 0x07, 0x72, 0xF3, 0x4A, 0x07, 0x94, 0x82, 0x8F, 0x04, 0x36, 0x06, 0x76,
+    0xFD, 0x5F, 0x8B, 0x91, 0x0B, 0xC9, 0x02, 0x3B, 0xF3, 0x7F, 0x33, 0x8B, 0x5A, 0xA9, 0xBF, 0x2B,
+    0x51, 0x55, 0xF3, 0xB7, 0x10, 0x5A, 0xEF, 0xE1, 0xEC, 0x28, 0xD9, 0x27, 0x28, 0x47, 0x6D, 0x31,
+    0xB0, 0x38, 0x8E, 0x67, 0x40, 0x46, 0x99, 0x2A, 0xD7, 0x43, 0xBE, 0x5A, 0xB0, 0xF2, 0x61, 0x5B,
+    0xC5, 0x9A, 0x71, 0xDF, 0x30, 0x51, 0x1A, 0xAE, 0xCB, 0x59, 0xEA, 0x80, 0x4C, 0x66, 0x6C, 0x91,
+    0xA5, 0x7C, 0x24, 0xBB, 0xA4, 0xB1, 0xE9, 0x41, 0x85, 0xB3, 0xC6, 0x54, 0x10, 0x20, 0xEE, 0x91,
+    0x14, 0x66, 0x64, 0x52, 0xC2, 0x6A, 0x30, 0xBA, 0xB6, 0x19, 0x19, 0x74, 0x99, 0xCE, 0xA5, 0x29,
+    0x00, 0x1F, 0xC5, 0xCC, 0x06, 0x31, 0x87, 0xCC, 0x04, 0xEB, 0x00, 0x3C, 0xF1, 0xA7, 0x73, 0xE2,
+    0xB3, 0x7B, 0x85, 0x3D, 0x4B, 0x3B, 0x89, 0xE1, 0x56, 0x71, 0x9E, 0x11, 0x88, 0x3D, 0x21, 0xA2,
+    0x61, 0x0F, 0x52, 0xCC, 0x0D, 0xC4, 0x74, 0x4A, 0xAE, 0x3B, 0xC9, 0x4E, 0xD7, 0xCA, 0x04, 0x94,
+    0x6B, 0x2F, 0x3D, 0x79, 0xDB, 0x04, 0xAD, 0x16, 0x76, 0x27, 0x75, 0x82, 0x54, 0xEF, 0x98, 0x4F,
+    0x64, 0xCF, 0xAE, 0x8D, 0x17, 0x3B, 0x50, 0x1F, 0xFA, 0x46, 0xB2, 0x85, 0x50, 0x99, 0x5A, 0x6B,
+    0x5D, 0x94, 0x40, 0xC2, 0x67, 0xAB, 0xF5, 0xAF, 0x80, 0x73, 0xFE, 0x3A, 0x73, 0x2B, 0x2F, 0xC6,
+    0xB8, 0xE5, 0x83, 0x43, 0x73, 0xC8, 0x33, 0x4D, 0xAF, 0x7E, 0x01, 0x33, 0x80, 0x25, 0xC2, 0x00,
+    0xC6, 0xAF, 0xF1, 0x30, 0xE7, 0xF3, 0x7C, 0x87, 0x1A, 0xD4, 0xF0, 0x9F, 0xE7, 0x02, 0x34, 0xE8,
+    0xBE, 0xFC, 0x67, 0x56, 0x80, 0x24, 0x53, 0x81, 0x7F, 0xF9, 0x20, 0x57, 0xB1, 0x82, 0xC3, 0x1A,
+    0x9C, 0xA1, 0x41, 0xE1, 0xF5, 0x1D, 0x9C, 0xC3, 0xFF, 0x9E, 0x07, 0x85, 0x95, 0x3D, 0x24, 0xF8,
+    0x38, 0x81, 0x21, 0xCB, 0x0E, 0xF1, 0x86, 0x3F, 0xC3, 0x6F, 0x58, 0x16, 0x78, 0x5F, 0x08, 0x8D,
+    0x3E, 0xA0, 0xEC, 0xDF, 0xFF, 0x84, 0xC2, 0x57, 0x0E, 0xE6, 0x3C, 0x60, 0x81, 0xC3, 0x00, 0xF3,
+    0xE5, 0x4F, 0x68, 0x50, 0x00, 0x53, 0x40, 0x03, 0xD4, 0x73, 0x0D, 0x40, 0x67, 0xFE, 0x01, 0x3B,
+    0x01, 0xE8, 0x52, 0x26, 0xA0, 0xD1, 0xDC, 0x30, 0x97, 0x3A, 0x80, 0x13, 0x0F, 0xD8, 0xA5, 0x40,
+    0xF3, 0x80, 0xDE, 0xFD, 0x7E, 0x1F, 0x92, 0x4C, 0xE4, 0x60, 0x2E, 0x55, 0x00, 0xC6, 0x22, 0xD4,
+    0xA5, 0xC0, 0x24, 0xC6, 0xF6, 0x03, 0x6A, 0xD1, 0x84, 0xFF, 0xBC, 0x5F, 0x61, 0xD6, 0xFF, 0xE1,
+    0x14, 0x80, 0xB9, 0x49, 0x80, 0x01, 0x00, 0x53, 0x80, 0xDA, 0xC4, 0x10, 0xC4, 0xF0, 0x09, 0xEA,
+    0x17, 0x85, 0xFF, 0x9C, 0x9F, 0xA1, 0x2A, 0x0F, 0xFC, 0xE7, 0x5E, 0x00, 0x0D, 0x8D, 0x1F, 0x40,
+    0x3D, 0x7F, 0xEF, 0x43, 0xC2, 0xA2, 0x1E, 0x64, 0x2A, 0x27, 0xD8, 0xA1, 0x3C, 0x20, 0x47, 0x82,
+    0xBC, 0xF8, 0x0B, 0x9C, 0xC3, 0x7F, 0x03, 0xC9, 0x00, 0x48, 0x02, 0x7C, 0x08, 0x74, 0x1F, 0x34,
+    0x64, 0x41, 0x3A, 0xA0, 0x81, 0x0B, 0x0C, 0xBD, 0x62, 0xA8, 0x7B, 0x80, 0xEE, 0xFE, 0x07, 0xF5,
+    0x13, 0x30, 0xA5, 0xFD, 0xDF, 0x0F, 0x0B, 0xC9, 0x2F, 0xD0, 0xE8, 0x85, 0x97, 0x06, 0x50, 0x26,
+    0x0B, 0x1D, 0x99, 0x0B, 0x10, 0x4C, 0x07, 0x48, 0x94, 0x01, 0x00, 0x63, 0x30, 0x70, 0x81, 0x02,
+    0x26, 0x78, 0xAE, 0x01, 0x26, 0x20, 0x18, 0x0B, 0xE8, 0xEB, 0xC9, 0x33, 0xC1, 0xE0, 0x17, 0x34,
+    0xD0, 0xC1, 0xBE, 0x86, 0x86, 0x0A, 0xD0, 0x48, 0x78, 0xA8, 0x7C, 0x82, 0x3B, 0x87, 0xE1, 0xEF,
+    0x7B, 0x46, 0x78, 0xA0, 0xD8, 0xC3, 0x04, 0xBF, 0x41, 0x9D, 0x0F, 0x0A, 0xCB, 0xFD, 0x30, 0xC1,
+    0x8B, 0xB0, 0xC8, 0x03, 0x25, 0x1C, 0x66, 0x78, 0x64, 0xC1, 0xC2, 0x0E, 0xE8, 0x76, 0x58, 0x1C,
+    0x0A, 0xFC, 0x83, 0x85, 0x12, 0xD0, 0xBB, 0xFA, 0x88, 0xA8, 0x80, 0x65, 0x42, 0x07, 0x68, 0x16,
+    0x02, 0x47, 0x27, 0x2F, 0x03, 0x3C, 0x22, 0xA0, 0x01, 0x02, 0xF4, 0x6A, 0x3C, 0x4C, 0xF0, 0x0B,
+    0x2C, 0xB8, 0x80, 0x86, 0x9E, 0x87, 0x09, 0x1E, 0xF8, 0xFF, 0xFF, 0x1D, 0x04, 0x70, 0x7F, 0x82,
+    0x7B, 0xDE, 0x7F, 0x01, 0x9C, 0x29, 0x0B, 0x00, 0x33, 0x74, 0x71, 0x71, 0x31, 0x81, 0xE4, 0x17,
+    0xEE, 0xFF, 0x10, 0xD2, 0xDE, 0xD8, 0xD8, 0x18, 0x9A, 0x92, 0x07, 0x35, 0x99, 0x9F, 0x96, 0x96,
+    0xC6, 0x08, 0x76, 0x33, 0xCF, 0x1F, 0x10, 0xC9, 0x25, 0xA0, 0xA4, 0xA4, 0x24, 0xC4, 0x00, 0x00,
+    0x43, 0x84, 0xC2, 0x23, 0x3D, 0x18, 0xEB, 0x0B, 0xDC, 0x53, 0x17, 0x60, 0x06, 0x22, 0x87, 0xE6,
+    0x5F, 0x7D, 0x18, 0xEB, 0xEB, 0xE0, 0x52, 0x98, 0x80, 0x4D, 0xE1, 0xB7, 0x01, 0x54, 0x08, 0x4F,
+    0x32, 0x1B, 0xFC, 0x00, 0x33, 0x70, 0x71, 0x71, 0x31, 0x61, 0x04, 0xC7, 0x1A, 0x2F, 0x98, 0xE4,
+    0x77, 0x00, 0x8A, 0xFC, 0x03, 0x27, 0xE8, 0xC1, 0x4D, 0x26, 0xA6, 0xA5, 0xA5, 0xFD, 0xE7, 0xFF,
+    0x03, 0x76, 0x33, 0x38, 0x63, 0xF0, 0x08, 0x28, 0x29, 0x29, 0x09, 0x31, 0x00, 0x00, 0x03, 0xA5,
+    0x99, 0x2C, 0xB8, 0xB3, 0xD9, 0xA1, 0x21, 0x07, 0x89, 0x00, 0x60, 0x68, 0x41, 0xFD, 0xF7, 0xE3,
+    0xFD, 0x57, 0xB0, 0x16, 0x81, 0xFF, 0xF9, 0x1B, 0xC0, 0xBE, 0x5F, 0xF0, 0x9F, 0x57, 0x01, 0x9C,
+    0xCE, 0x3E, 0x03, 0xA3, 0xE4, 0x27, 0xC8, 0x37, 0x7F, 0xD6, 0x83, 0x02, 0x92, 0x1D, 0xA8, 0x59,
+    0x1F, 0xE4, 0x6E, 0x79, 0xA0, 0x66, 0x50, 0x70, 0xFC, 0x9D, 0x0F, 0xD4, 0x0C, 0x89, 0x3B, 0xE6,
+    0x7F, 0xF9, 0x90, 0xF8, 0xE1, 0xFC, 0xC1, 0x0D, 0x09, 0x53, 0x16, 0x01, 0x58, 0xE8, 0x01, 0x00,
+    0x6B, 0xEE, 0x80, 0x01, 0xB6, 0x7F, 0xFF, 0x61, 0x20, 0xFE, 0x27, 0x9C, 0xA9, 0x07, 0x00, 0x9B,
+    0x04, 0xF4, 0xE0, 0x6F, 0x60, 0x82, 0xF9, 0x01, 0x0C, 0xDA, 0x04, 0x90, 0xC7, 0x1F, 0x03, 0x5D,
+    0x23, 0x70, 0x8B, 0x01, 0x00, 0x03, 0x92, 0x53, 0xEE, 0xAC, 0x65, 0x63, 0x68, 0x64, 0x85, 0x24,
+    0x70, 0x42, 0xF1, 0xFD, 0xDF, 0x3F, 0x00, 0x12, 0xFA, 0x0F, 0xFF, 0xFB, 0x6F, 0x80, 0xB8, 0x08,
+    0x6F, 0xFC, 0x82, 0x52, 0xFF, 0x17, 0x68, 0x20, 0x21, 0xF2, 0xD9, 0x6F, 0x78, 0x3E, 0xFB, 0x07,
+    0xCD, 0x67, 0xC0, 0x10, 0xF6, 0x6F, 0x80, 0x04, 0xEC, 0x86, 0xFF, 0xFE, 0x02, 0x90, 0x08, 0x87,
+    0xA4, 0x5B, 0x0E, 0xB0, 0x43, 0x61, 0xE9, 0x96, 0x40, 0x79, 0xC5, 0xC0, 0x00, 0x00, 0x2B, 0xB0,
+    0x86, 0x79, 0xE0, 0xD3, 0x7E, 0x18, 0x0B, 0x96, 0x1B, 0xC8, 0x64, 0x39, 0xDC, 0x3A, 0xEB, 0x09,
+    0x66, 0x19, 0x80, 0xB2, 0xA1, 0x0E, 0x88, 0xF5, 0x05, 0x9C, 0x26, 0x58, 0x18, 0x3E, 0xBF, 0xFF,
+    0x9F, 0x07, 0x4A, 0x3F, 0xF6, 0x40, 0x57, 0x9D, 0x07, 0xA7, 0x9F, 0xFB, 0x40, 0x96, 0x1C, 0x24,
+    0x12, 0x58, 0x3F, 0x43, 0xDC, 0x07, 0x8C, 0xF7, 0xCF, 0xFF, 0x61, 0x19, 0x0B, 0x66, 0xF2, 0x1F,
+    0xFB, 0xCF, 0xEB, 0xE1, 0xB9, 0x69, 0x3D, 0x11, 0xF9, 0xCA, 0xE1, 0x3F, 0xEF, 0x67, 0x48, 0x08,
+    0x1D, 0xF8, 0xCF, 0xF1, 0x19, 0x92, 0x80, 0xBE, 0xFF, 0x67, 0xFC, 0x0C, 0x8E, 0xA5, 0x06, 0x20,
+    0xFF, 0xF3, 0xF9, 0x3F, 0xEF, 0x2B, 0x81, 0x19, 0x88, 0x0B, 0xC8, 0xDA, 0x00, 0x72, 0x1E, 0x30,
+    0x35, 0x3D, 0xA8, 0x07, 0xE6, 0xC5, 0xFF, 0xE7, 0x41, 0x91, 0x0E, 0x0C, 0xC9, 0x20, 0x57, 0x50,
+    0xC8, 0x03, 0x00, 0x03, 0x92, 0x45, 0xB7, 0xEF, 0x76, 0xB3, 0x80, 0x2D, 0x80, 0x24, 0x6F, 0x05,
+    0x60, 0xEE, 0xF9, 0xF7, 0x1F, 0x98, 0x94, 0x1F, 0xFE, 0x5F, 0xCF, 0xCC, 0x10, 0xF8, 0x4F, 0x1F,
+    0x18, 0xA9, 0x20, 0xF9, 0x89, 0xEC, 0x06, 0x90, 0xE4, 0x09, 0xF2, 0x2C, 0x34, 0x6C, 0x3F, 0xC0,
+    0x12, 0xF1, 0x27, 0x58, 0x78, 0x42, 0x7D, 0x08, 0x64, 0x40, 0xDD, 0x80, 0xDF, 0x7F, 0xBC, 0x30,
+    0x87, 0x82, 0x03, 0x52, 0x81, 0x09, 0xE8, 0x5D, 0x50, 0x62, 0xFC, 0xA1, 0x0F, 0x72, 0x4E, 0x75,
+    0xD9, 0x4B, 0x90, 0xDB, 0x7F, 0xC0, 0x52, 0xBD, 0x01, 0x30, 0x03, 0xBC, 0xD7, 0x04, 0x6B, 0x08,
+    0x76, 0x05, 0x7A, 0x15, 0x00, 0x83, 0x39, 0x7F, 0x33, 0xCC, 0xED, 0x0C, 0xBF, 0xED, 0x61, 0xAC,
+    0x3F, 0xFE, 0x64, 0xB1, 0xA6, 0xDC, 0x59, 0xCB, 0x0A, 0x66, 0x81, 0x32, 0xCC, 0x7B, 0x56, 0x20,
+    0x0B, 0x4F, 0xFA, 0xF9, 0xEF, 0x1F, 0x00, 0x09, 0xEE, 0x87, 0xFF, 0xFD, 0x37, 0x40, 0x7C, 0x88,
+    0x37, 0xBD, 0x80, 0x72, 0xD3, 0x17, 0x68, 0xA0, 0xE3, 0xCB, 0xB7, 0xC0, 0x18, 0xF3, 0x6F, 0x80,
+    0x44, 0xD4, 0x82, 0xFF, 0xFE, 0x02, 0xFF, 0x09, 0xE5, 0x03, 0x20, 0xE0, 0xC2, 0x56, 0xFE, 0x31,
+    0x30, 0x00, 0x00, 0x03, 0x92, 0xCD, 0x77, 0xF6, 0x8A, 0x83, 0xB9, 0x1B, 0xFF, 0x43, 0xFD, 0x60,
+    0xF0, 0x0F, 0x9C, 0xD9, 0x81, 0xAC, 0x47, 0xFF, 0x63, 0x19, 0x0D, 0x7E, 0x82, 0x6C, 0xFA, 0xB3,
+    0x1F, 0x2C, 0x91, 0x0F, 0xB4, 0x1F, 0x1C, 0x96, 0x5F, 0xDE, 0x03, 0xED, 0x65, 0x85, 0x58, 0xCF,
+    0x0A, 0xF1, 0x08, 0xA8, 0x10, 0xF8, 0xF4, 0xFF, 0x2E, 0x08, 0xBC, 0xFD, 0xCF, 0xFD, 0x19, 0x9A,
+    0x12, 0xFE, 0x73, 0x7F, 0x79, 0x7F, 0x06, 0x0C, 0xF6, 0x30, 0xC3, 0xF2, 0x01, 0x3C, 0x04, 0xC0,
+    0x51, 0x02, 0x0D, 0x63, 0xA0, 0x73, 0x60, 0x01, 0x2B, 0x00, 0xC9, 0x10, 0x01, 0xEB, 0x40, 0xDE,
+    0x97, 0x02, 0x05, 0xDF, 0x7F, 0x50, 0x00, 0xFC, 0xEF, 0x2E, 0x83, 0xA4, 0x6E, 0x70, 0x8A, 0x7B,
+    0x0F, 0xD2, 0xA7, 0xF0, 0x12, 0x9E, 0x3D, 0x18, 0x82, 0x42, 0x41, 0xDE, 0x02, 0x00, 0x03, 0x05,
+    0xD4, 0x8A, 0x2C, 0x70, 0x6A, 0xF9, 0x0F, 0xF2, 0xD7, 0xC3, 0xFF, 0x60, 0xEA, 0xE7, 0x7D, 0xA6,
+    0x20, 0xA0, 0xB5, 0x7F, 0xED, 0x91, 0xD3, 0x37, 0x32, 0x25, 0x20, 0xF8, 0x5F, 0x5F, 0x90, 0x11,
+    0x92, 0xF0, 0xDE, 0x33, 0x42, 0xF2, 0x1B, 0xCB, 0x92, 0xDD, 0xFF, 0xF7, 0xEF, 0xEE, 0xC6, 0xAE,
+    0x81, 0x36, 0xD4, 0x0F, 0x90, 0xCF, 0x01, 0x03, 0x92, 0xCD, 0x77, 0xF6, 0x8A, 0x33, 0x04, 0x00,
+    0x93, 0xD8, 0x46, 0x50, 0xC4, 0x71, 0x7C, 0xDC, 0xCF, 0x60, 0xF0, 0xEF, 0xFF, 0xFF, 0x7F, 0xFF,
+    0xF7, 0x03, 0x1D, 0xF6, 0xE8, 0x7F, 0x3F, 0x13, 0x30, 0xB5, 0xFF, 0xBD, 0xCF, 0xF0, 0x1B, 0x9C,
+    0x36, 0xBE, 0xFF, 0xBF, 0xEF, 0x00, 0x09, 0x9E, 0x86, 0xFF, 0xF7, 0x37, 0x40, 0x3D, 0xFC, 0xF7,
+    0x3E, 0x2C, 0x7E, 0xBF, 0xDF, 0x87, 0xC5, 0xEF, 0xE7, 0xFB, 0x5F, 0xA0, 0x6E, 0xF8, 0x78, 0xFF,
+    0x0B, 0x34, 0x90, 0x3E, 0xDC, 0x87, 0xE5, 0xB3, 0x4F, 0xF7, 0x61, 0x7E, 0xFD, 0x7A, 0x1F, 0x92,
+    0xCF, 0x40, 0xF1, 0xD7, 0x00, 0x09, 0x58, 0x83, 0xFF, 0xF7, 0x05, 0x20, 0xA1, 0x7D, 0xF1, 0xFF,
+    0x7D, 0xA0, 0xF7, 0xA5, 0x80, 0x42, 0x7F, 0x81, 0x85, 0xC0, 0x84, 0xFF, 0xFF, 0xAB, 0xDA, 0xFE,
+    0xFC, 0xFF, 0x0A, 0xB4, 0xE1, 0x07, 0xC8, 0xA5, 0x76, 0x20, 0xD3, 0x40, 0xF9, 0xA3, 0x8F, 0x11,
+    0x62, 0x6E, 0x88, 0x29, 0x3C, 0x21, 0x81, 0x22, 0x01, 0x16, 0x03, 0x09, 0xC0, 0xE4, 0xE4, 0x90,
+    0xC9, 0x08, 0x76, 0x3D, 0x3B, 0x30, 0xB0, 0xF6, 0x87, 0x87, 0xBC, 0xF8, 0xBF, 0x1F, 0x1C, 0xA7,
+    0x20, 0x00, 0x0A, 0xBB, 0x46, 0xA0, 0x87, 0xFF, 0x5B, 0x43, 0x82, 0xB5, 0x34, 0x5D, 0x04, 0x48,
+    0x01, 0x00, 0x2B, 0xB0, 0x86, 0x1A, 0xF2, 0x09, 0xAA, 0x85, 0x01, 0x96, 0x17, 0x48, 0x66, 0x28,
+    0x2C, 0x9F, 0xC5, 0x0A, 0x62, 0x80, 0x92, 0xE9, 0x7B, 0x16, 0x20, 0xE3, 0x11, 0x28, 0x21, 0xD8,
+    0x03, 0xFD, 0xF7, 0x37, 0x57, 0xA8, 0xF9, 0xFF, 0x79, 0xA0, 0x4B, 0x40, 0x81, 0xF0, 0xE5, 0x3F,
+    0xF3, 0x67, 0xB0, 0x17, 0x36, 0xFC, 0x67, 0xFF, 0xFC, 0x1F, 0x5A, 0x2C, 0x40, 0xC2, 0xC0, 0xE1,
+    0x3F, 0x37, 0xC4, 0x40, 0x87, 0xFF, 0x3C, 0x34, 0x62, 0x18, 0xFC, 0xE7, 0xDE, 0x00, 0xC9, 0x1F,
+    0x7F, 0x58, 0x01, 0xDB, 0x94, 0xF3, 0xEB, 0xFF, 0x2F, 0x20, 0x09, 0xE6, 0x4A, 0x7E, 0x99, 0xFF,
+    0x75, 0x3D, 0x21, 0x78, 0xD1, 0x0F, 0x00, 0x63, 0x60, 0x38, 0x06, 0x8C, 0x7C, 0x50, 0xFA, 0x03,
+    0xE1, 0x63, 0xDA, 0x88, 0x50, 0x09, 0x00, 0xAA, 0xF9, 0x01, 0x0C, 0x89, 0xDF, 0xFE, 0xD4, 0xC3,
+    0xC0, 0x14, 0x24, 0x00, 0x74, 0xCD, 0xC1, 0xFF, 0x7C, 0xC0, 0xCC, 0xCB, 0xFE, 0xFB, 0xFF, 0x7E,
+    0x60, 0x08, 0x72, 0x30, 0x04, 0x88, 0x30, 0x30, 0x00, 0x00, 0xDB, 0x02, 0x15, 0xFA, 0xC7, 0x0F,
+    0x4B, 0x97, 0xE4, 0xD0, 0x01, 0xAC, 0x10, 0xFA, 0x57, 0x3C, 0x98, 0xDE, 0xF0, 0xDF, 0x1F, 0x44,
+    0x03, 0x93, 0x31, 0x1B, 0x88, 0xBE, 0x04, 0x4C, 0x74, 0x40, 0xDA, 0xE0, 0xDF, 0x7B, 0x66, 0x10,
+    0xFD, 0x05, 0x14, 0x63, 0xFF, 0xE4, 0x13, 0xFE, 0xEF, 0x07, 0xEB, 0x07, 0x27, 0x4C, 0x86, 0x7F,
+    0xEB, 0xFF, 0x83, 0x1D, 0xF5, 0x0F, 0x18, 0x8C, 0x7A, 0x60, 0xBA, 0xFE, 0x3F, 0xA8, 0xCC, 0xF8,
+    0xF7, 0x9E, 0x09, 0xA2, 0x1E, 0x94, 0x0A, 0xCF, 0x43, 0xEC, 0xFB, 0x0A, 0x8C, 0x00, 0x10, 0x0D,
+    0x32, 0x01, 0x6C, 0xDF, 0xF7, 0xFF, 0x5C, 0x60, 0xBA, 0xE1, 0x7F, 0x3F, 0xC4, 0x1F, 0x3F, 0xDF,
+    0x7F, 0x07, 0x07, 0xC9, 0x84, 0x3A, 0x00, 0xDB, 0xC2, 0xF6, 0x8F, 0xFF, 0x9F, 0x3C, 0x89, 0x90,
+    0xFF, 0x3B, 0x27, 0x00, 0x53, 0x60, 0x65, 0x30, 0x58, 0xD1, 0x05, 0xF2, 0x65, 0xF3, 0xAA, 0x48,
+    0xA0, 0x13, 0xD6, 0x0B, 0xFC, 0x06, 0xA7, 0xF1, 0xC3, 0x40, 0xEF, 0xE8, 0x32, 0x7C, 0x3E, 0xFF,
+    0x18, 0x14, 0x99, 0x72, 0x09, 0x20, 0xF2, 0x3D, 0xE3, 0xE7, 0xFB, 0xFF, 0x72, 0x84, 0x26, 0xFF,
+    0x5F, 0xFF, 0x75, 0xBF, 0xAA, 0xE3, 0xAF, 0xFF, 0x5C, 0x9F, 0xC1, 0x61, 0xF2, 0xFD, 0xFF, 0x3F,
+    0x56, 0x90, 0x51, 0xC0, 0x04, 0xCD, 0x05, 0x0E, 0xE1, 0x7C, 0x48, 0x9E, 0xFC, 0x0C, 0x76, 0xF7,
+    0x04, 0x48, 0x96, 0xF8, 0x59, 0x0F, 0xF1, 0x65, 0x01, 0xC4, 0xF1, 0xDF, 0xFB, 0x21, 0x39, 0x0E,
+    0x52, 0x10, 0x30, 0x7C, 0x9B, 0x3F, 0xA8, 0xB8, 0x09, 0x90, 0x88, 0xFC, 0xD6, 0xBF, 0x01, 0x9C,
+    0x93, 0x04, 0xDE, 0x82, 0x43, 0xEB, 0xA2, 0x1D, 0x00, 0x53, 0x60, 0x65, 0x70, 0x38, 0x79, 0x37,
+    0x0A, 0x68, 0xF9, 0x7A, 0x05, 0x60, 0xD6, 0xFF, 0x2F, 0xCD, 0xF0, 0xF9, 0xFC, 0xE3, 0xFF, 0xEF,
+    0x81, 0xD9, 0x1B, 0xE8, 0xAE, 0x7F, 0xDE, 0x0C, 0x06, 0x7F, 0xFE, 0xB3, 0x7C, 0x06, 0x7B, 0xE6,
+    0xC0, 0x7F, 0xAE, 0xCF, 0x60, 0x1F, 0x3A, 0xFC, 0xE7, 0xFB, 0x0C, 0x71, 0xD3, 0x7F, 0x7E, 0xA8,
+    0xDB, 0x81, 0xA9, 0x19, 0xE2, 0xB1, 0x7F, 0xFA, 0xB4, 0x62, 0xFC, 0x95, 0xDF, 0x00, 0x49, 0xD7,
+    0xDF, 0xB8, 0x00, 0x03, 0xC5, 0xFB, 0xAD, 0xBB, 0x59, 0x8C, 0x30, 0xFE, 0x7F, 0x48, 0x50, 0x03,
+    0x53, 0xE0, 0xFF, 0x7F, 0xE0, 0x1C, 0xC2, 0x70, 0xF1, 0xFF, 0x7C, 0x66, 0x86, 0xC5, 0xFF, 0x41,
+    0x0E, 0xFF, 0x05, 0x0E, 0xFF, 0x2F, 0x40, 0x7F, 0x1A, 0x40, 0x12, 0x6A, 0x00, 0x30, 0xA8, 0x16,
+    0x40, 0x6D, 0xFF, 0xD5, 0x0F, 0xCD, 0xB6, 0x40, 0x15, 0xF7, 0x19, 0x3E, 0x41, 0xC3, 0x17, 0xE8,
+    0x45, 0xA8, 0x9F, 0x81, 0xBE, 0x62, 0xFA, 0xB2, 0x1F, 0xCE, 0x84, 0xF9, 0xFA, 0xC1, 0x7F, 0x46,
+    0x98, 0xBF, 0x81, 0xF4, 0x05, 0xA8, 0x13, 0xBF, 0xEF, 0x87, 0xC5, 0x99, 0xC0, 0x3F, 0x60, 0x72,
+    0xFE, 0xB7, 0x1E, 0xE2, 0x4F, 0x5E, 0x90, 0xED, 0xC0, 0xC4, 0xAA, 0xF0, 0x07, 0xE4, 0x03, 0x60,
+    0x6A, 0xAE, 0x6E, 0xFB, 0x0D, 0x49, 0xEE, 0x5F, 0x41, 0x4E, 0x7F, 0x0F, 0x8E, 0x2D, 0x81, 0x17,
+    0xF0, 0x1C, 0xC3, 0xC0, 0x10, 0x1C, 0x0A, 0x76, 0x12, 0x00, 0x73, 0x10, 0x67, 0x50, 0x58, 0x3E,
+    0x4B, 0x0C, 0x64, 0xFB, 0x7A, 0x05, 0x50, 0xE4, 0x49, 0x01, 0x75, 0x9C, 0xFF, 0x02, 0x8A, 0x42,
+    0x60, 0x62, 0xF8, 0xFC, 0xFE, 0xFF, 0x7C, 0x15, 0xA7, 0x9F, 0xC0, 0xF0, 0xFE, 0xFC, 0xFF, 0x3D,
+    0x50, 0x8F, 0xC1, 0xBF, 0xFD, 0x40, 0x96, 0x3E, 0x24, 0x74, 0x58, 0x3E, 0x43, 0x5C, 0xD4, 0xF0,
+    0x9F, 0xFB, 0x33, 0xC4, 0x8D, 0x02, 0xFF, 0xF9, 0x61, 0x39, 0xE9, 0x8F, 0xFE, 0xE7, 0xF5, 0xF0,
+    0xD4, 0xBF, 0x9E, 0x88, 0x7C, 0x60, 0xF0, 0x9F, 0xF7, 0x33, 0xC4, 0x47, 0x1B, 0xFE, 0x73, 0x7C,
+    0x86, 0x44, 0xF8, 0xF7, 0xFF, 0x8C, 0x9F, 0xC1, 0xA1, 0x3A, 0x01, 0xC8, 0xFF, 0x7C, 0xFE, 0xCF,
+    0xFF, 0xAE, 0x15, 0xFF, 0x81, 0xBE, 0xFF, 0x7C, 0x1E, 0x14, 0xD8, 0xA0, 0x3C, 0x03, 0xB4, 0x6D,
+    0x0B, 0xA4, 0x24, 0x02, 0xD9, 0x6B, 0x68, 0x02, 0x76, 0xD8, 0x79, 0x58, 0x94, 0x10, 0xCB, 0xFA,
+    0x08, 0x8F, 0x44, 0x60, 0x68, 0x40, 0x01, 0x00, 0x03, 0x92, 0x53, 0xEE, 0xAC, 0x65, 0x65, 0x28,
+    0x64, 0x81, 0x24, 0x70, 0x42, 0xF1, 0xFD, 0xDF, 0x3F, 0x00, 0x12, 0x3C, 0x0F, 0xFF, 0xFB, 0x6F,
+    0x80, 0xB8, 0x08, 0x6F, 0xFC, 0x82, 0x52, 0xFF, 0x17, 0x68, 0x20, 0xE1, 0xCB, 0x67, 0xC0, 0x10,
+    0xF6, 0x6F, 0x80, 0x04, 0xEC, 0x82, 0xFF, 0xFE, 0x02, 0xFF, 0x09, 0xA5, 0x5B, 0x20, 0xE0, 0x02,
+    0xB1, 0x20, 0xE5, 0x15, 0x88, 0x05, 0x29, 0xAF, 0xFE, 0xF8, 0xC3, 0x22, 0x84, 0x74, 0xD6, 0x2F,
+    0x7D, 0x18, 0xAB, 0x90, 0x05, 0x00, 0x53, 0x60, 0x65, 0x70, 0xB8, 0x35, 0x97, 0xE1, 0xE3, 0x7A,
+    0x50, 0xCC, 0xB1, 0x7D, 0x3E, 0x7F, 0xE0, 0xFF, 0xD9, 0xFF, 0xCC, 0x9F, 0xCF, 0xFF, 0xD0, 0x66,
+    0x10, 0x64, 0xF8, 0xFC, 0x7E, 0x3D, 0x24, 0x1C, 0xF8, 0xE0, 0xC1, 0x01, 0xA2, 0x18, 0x90, 0x1C,
+    0x0D, 0xCD, 0x38, 0x14, 0x52, 0x1B, 0x20, 0x29, 0x16, 0x00, 0x63, 0x60, 0x68, 0xBA, 0x7D, 0xD6,
+    0x12, 0xC2, 0xFE, 0xFF, 0x5F, 0x07, 0x18, 0x8C, 0xFF, 0xF7, 0xDE, 0x06, 0xA6, 0x03, 0x87, 0xFF,
+    0x76, 0x0C, 0x0C, 0x9B, 0xFE, 0x73, 0x4F, 0x00, 0x3B, 0xE5, 0x27, 0xDB, 0x06, 0xA8, 0xD1, 0x0B,
+    0xA0, 0x66, 0x24, 0x40, 0x52, 0x2A, 0xC8, 0xAC, 0x5A, 0xB0, 0xCC, 0x41, 0x60, 0x32, 0x05, 0x99,
+    0x43, 0x20, 0x3D, 0x19, 0x80, 0x3D, 0xF3, 0xD3, 0xFE, 0xBB, 0x1E, 0x98, 0xD6, 0xFF, 0xFE, 0x9E,
+    0x05, 0x24, 0xCE, 0x77, 0xE0, 0xFF, 0x7E, 0x55, 0xC3, 0xE7, 0x40, 0xC3, 0xC1, 0x69, 0x1C, 0x18,
+    0x58, 0x0E, 0xC0, 0x94, 0x74, 0x1E, 0x1C, 0xFA, 0xC1, 0xAE, 0x40, 0x3D, 0x00, 0x03, 0x9A, 0x07,
+    0x61, 0x7F, 0x83, 0xB8, 0xF3, 0x67, 0x3E, 0x06, 0xA5, 0xE0, 0xF2, 0x7B, 0xBE, 0x8B, 0x08, 0xC8,
+    0x1C, 0x50, 0x8E, 0xFA, 0x02, 0xA6, 0x98, 0x02, 0x3A, 0xFE, 0xEC, 0xEF, 0xF0, 0xC0, 0xAE, 0x81,
+    0x02, 0x0A, 0x12, 0xCF, 0x3F, 0x20, 0xA1, 0xFA, 0xE5, 0xFF, 0x1A, 0x5B, 0x70, 0x84, 0x82, 0xC3,
+    0x5E, 0xE0, 0xE5, 0x7F, 0x29, 0x06, 0x00, 0x53, 0x80, 0xD8, 0x14, 0xC4, 0xF0, 0x71, 0x3D, 0x44,
+    0x03, 0x17, 0x24, 0x2F, 0x18, 0xFC, 0xE7, 0xA1, 0x1D, 0x03, 0x92, 0x08, 0x1C, 0xFE, 0x73, 0x43,
+    0xD2, 0x45, 0xC3, 0x7F, 0xCE, 0x03, 0xE0, 0xB0, 0x7B, 0xF8, 0x9F, 0x35, 0x00, 0x14, 0xD5, 0x02,
+    0x7F, 0xDE, 0x83, 0x52, 0xD2, 0xDC, 0xF6, 0x5F, 0xA0, 0xFC, 0xB0, 0x01, 0x9C, 0xA0, 0x40, 0xEE,
+    0x04, 0x25, 0x55, 0x2D, 0xB0, 0x7B, 0x0D, 0x5D, 0x40, 0x3E, 0x05, 0x00, 0x5B, 0x04, 0x71, 0xB3,
+    0x43, 0xF4, 0x2F, 0x48, 0xAA, 0x79, 0xF0, 0xFE, 0x3B, 0xC4, 0x89, 0x5F, 0xF7, 0x7F, 0x84, 0xA8,
+    0xFA, 0xE3, 0x3F, 0x01, 0x6C, 0xA3, 0xC2, 0x7F, 0x5E, 0x03, 0x70, 0xC4, 0x4C, 0x00, 0x1A, 0xF3,
+    0xA7, 0x1E, 0xEA, 0x5E, 0x70, 0x38, 0x82, 0xB2, 0x1E, 0xD8, 0xCD, 0x7F, 0xF5, 0x41, 0x6E, 0xE6,
+    0x01, 0xBA, 0x11, 0xE4, 0x36, 0xA0, 0xBD, 0x1B, 0xC0, 0x31, 0xF6, 0x73, 0x3E, 0x03, 0x24, 0xDE,
+    0x3F, 0xFD, 0x67, 0xFC, 0x99, 0x0F, 0x71, 0x32, 0x3B, 0x24, 0xAF, 0x38, 0xFC, 0xAF, 0x83, 0x06,
+    0xDB, 0x5F, 0x68, 0x76, 0x05, 0x7A, 0x78, 0x3D, 0x2C, 0xB2, 0x20, 0x0E, 0x07, 0xBA, 0x13, 0x1A,
+    0xE2, 0x02, 0x6F, 0x99, 0x91, 0xF2, 0x15, 0x03, 0x00, 0x5B, 0xC4, 0x01, 0x0F, 0x06, 0x87, 0x6C,
+    0x60, 0x4A, 0x85, 0xF3, 0x80, 0xB9, 0xF8, 0xE7, 0x7C, 0x38, 0xEF, 0xF3, 0x7F, 0x06, 0x48, 0xCA,
+    0x55, 0x04, 0x1B, 0x3F, 0x9F, 0x01, 0x9C, 0x3B, 0x04, 0xFE, 0xB1, 0x41, 0xB2, 0x5F, 0x03, 0xC8,
+    0x4D, 0xE0, 0x40, 0x36, 0x00, 0x66, 0x01, 0x05, 0x50, 0x7E, 0xB8, 0x00, 0x4A, 0xCA, 0x13, 0x40,
+    0x2E, 0xFB, 0x03, 0x4C, 0x8F, 0x5F, 0x40, 0x01, 0xF5, 0x00, 0x64, 0xED, 0x77, 0x20, 0xE3, 0xD7,
+    0x3D, 0xA0, 0x9F, 0xBE, 0xBC, 0x87, 0x78, 0x59, 0xE0, 0x7F, 0x26, 0xD0, 0x67, 0x3F, 0xFB, 0xC1,
+    0x1E, 0x61, 0x4D, 0xF8, 0xCF, 0x0C, 0x34, 0xE6, 0x1F, 0xA4, 0x40, 0xE0, 0xBA, 0x70, 0x1F, 0xE8,
+    0x24, 0x07, 0x70, 0xE4, 0x09, 0xFC, 0xE7, 0xFF, 0xDC, 0xCF, 0xF0, 0x79, 0xFF, 0x02, 0x48, 0x30,
+    0xFC, 0x8A, 0xFF, 0xA9, 0x0F, 0xB4, 0x03, 0xEA, 0xE3, 0xAF, 0xE7, 0x81, 0x71, 0x92, 0xF0, 0xFF,
+    0xCF, 0x79, 0x68, 0xB0, 0x02, 0x3D, 0x2A, 0xF0, 0x1F, 0x9A, 0x68, 0x26, 0x80, 0x8B, 0x81, 0x5F,
+    0x90, 0x34, 0x05, 0x0C, 0xBD, 0xF5, 0x60, 0xEF, 0x40, 0xA3, 0xF0, 0x5F, 0x3C, 0xD8, 0xAB, 0xD0,
+    0x70, 0xF9, 0x06, 0x0A, 0x51, 0x87, 0xF3, 0x0C, 0x18, 0x00, 0x00, 0x9B, 0x04, 0xF6, 0xA0, 0x82,
+    0x27, 0xC3, 0x5F, 0x7D, 0x88, 0xCD, 0x90, 0x88, 0x65, 0xF8, 0x75, 0x1E, 0x68, 0x1A, 0x37, 0x48,
+    0x93, 0x3E, 0x30, 0x24, 0xFB, 0x41, 0xC6, 0x00, 0x55, 0xFE, 0x00, 0x12, 0x7F, 0xFB, 0xC1, 0x81,
+    0xAC, 0xBF, 0x00, 0x6C, 0xBF, 0xC0, 0xBF, 0xFB, 0xDF, 0xC1, 0x79, 0x9B, 0x80, 0x3D, 0x72, 0xD0,
+    0x08, 0xFC, 0x7F, 0x1E, 0xE2, 0xF6, 0xFA, 0x2F, 0x60, 0x47, 0x5F, 0xF8, 0xCF, 0x55, 0x00, 0x4E,
+    0xAF, 0xA0, 0xD8, 0xFB, 0x05, 0x74, 0x3E, 0x38, 0xF0, 0x2F, 0x00, 0xE3, 0xF4, 0x0B, 0x28, 0x0C,
+    0x14, 0xFE, 0xEF, 0x87, 0xD8, 0x07, 0xD4, 0xC9, 0xF8, 0x03, 0xEC, 0xDF, 0x86, 0xF3, 0xB0, 0x10,
+    0x67, 0x64, 0x00, 0x00, 0x4B, 0xD0, 0x02, 0xB3, 0x96, 0x33, 0x7D, 0xDA, 0x0F, 0x35, 0x14, 0x92,
+    0x17, 0x0C, 0xFE, 0xF3, 0xD0, 0x90, 0x71, 0x1F, 0x12, 0x41, 0x3C, 0x10, 0x1F, 0x2F, 0xF8, 0xCF,
+    0x03, 0x89, 0x97, 0x2F, 0xFF, 0x79, 0x26, 0xFC, 0xB7, 0x03, 0x67, 0x3A, 0x1E, 0x85, 0xFF, 0xFF,
+    0xAB, 0xDB, 0xFE, 0x9C, 0x07, 0x86, 0xF5, 0x57, 0x50, 0x7A, 0xF2, 0x04, 0x32, 0x0C, 0x80, 0x65,
+    0x53, 0x8C, 0x03, 0xC8, 0xDB, 0x0A, 0xA1, 0x22, 0x90, 0x12, 0x07, 0x25, 0xB4, 0xBE, 0x01, 0x4D,
+    0x8B, 0x00, 0x7B, 0xB4, 0x1E, 0xE8, 0xB5, 0x3E, 0xD3, 0x92, 0x3F, 0x40, 0xB5, 0x90, 0xBC, 0x0E,
+    0xF2, 0xDC, 0x35, 0x50, 0xA6, 0x05, 0x2B, 0x0D, 0x2A, 0x0F, 0x07, 0x85, 0x29, 0x00, 0x13, 0x68,
+    0xEF, 0x00, 0x01, 0xB6, 0x0D, 0x90, 0x68, 0xCB, 0x9F, 0x00, 0xA5, 0x19, 0x5C, 0x80, 0xE0, 0x09,
+    0xD4, 0xA7, 0x3F, 0x20, 0xE6, 0x3A, 0x40, 0x53, 0x16, 0xBE, 0xF0, 0x02, 0x25, 0x9A, 0xF5, 0x50,
+    0x57, 0xF1, 0x42, 0x83, 0x8B, 0x09, 0x12, 0x82, 0xF9, 0x50, 0xBF, 0x71, 0x21, 0x47, 0x57, 0x02,
+    0xD4, 0x71, 0x9F, 0xFE, 0x9F, 0x3F, 0x03, 0x04, 0xD2, 0xD0, 0xB4, 0x54, 0xFF, 0x08, 0x42, 0xEB,
+    0x01, 0x00, 0x83, 0x08, 0xA4, 0x40, 0x4C, 0xFC, 0x09, 0x51, 0xF0, 0x03, 0x92, 0xC8, 0x17, 0xFC,
+    0x9F, 0x0F, 0x36, 0xEE, 0xCB, 0x7B, 0x88, 0xEA, 0xDF, 0xD0, 0x74, 0xF5, 0x0F, 0x9A, 0xDA, 0x61,
+    0x61, 0x4A, 0x80, 0x16, 0x80, 0x06, 0x17, 0xCC, 0xDD, 0x1B, 0xA0, 0xAE, 0xF8, 0x0E, 0xF6, 0x76,
+    0xC3, 0x6B, 0x50, 0xD6, 0x02, 0x5A, 0xF2, 0xFF, 0x3C, 0xD8, 0x9B, 0x84, 0xE3, 0x13, 0x66, 0x1E,
+    0xB1, 0xF6, 0xC3, 0x73, 0xE7, 0x1F, 0x48, 0x4C, 0x30, 0x7C, 0x83, 0xA6, 0xF2, 0x0B, 0xD0, 0x4C,
+    0x06, 0xCC, 0x6D, 0xFB, 0xC1, 0x8C, 0x80, 0x3F, 0x50, 0xA7, 0x09, 0x94, 0x31, 0x00, 0x00, 0x2B,
+    0x90, 0xFC, 0xD2, 0xFF, 0x6D, 0x3D, 0x65, 0xF0, 0xEB, 0xFC, 0x87, 0x40, 0x4F, 0x02, 0x00, 0x4B,
+    0x82, 0x26, 0xC2, 0xDF, 0xFF, 0xAD, 0xC0, 0xF4, 0x53, 0x98, 0x2F, 0xB6, 0xC0, 0x3C, 0x4C, 0xC8,
+    0x7E, 0x01, 0x34, 0x5A, 0x01, 0x8D, 0x16, 0x80, 0x05, 0x17, 0x2C, 0x97, 0xFC, 0xCA, 0x87, 0xB9,
+    0x16, 0x16, 0x51, 0xF7, 0xB3, 0xA1, 0x99, 0xFB, 0x3F, 0xC4, 0x82, 0xF7, 0x35, 0xC8, 0xF2, 0xBF,
+    0xEA, 0x51, 0xF4, 0x0B, 0x40, 0xE3, 0x12, 0xD3, 0x1E, 0xEC, 0xEE, 0x80, 0xB9, 0x77, 0x02, 0xD4,
+    0xF7, 0xD0, 0x98, 0x5F, 0x0C, 0xC9, 0x6A, 0x57, 0xFE, 0x9F, 0x07, 0x87, 0xD9, 0xEF, 0xF3, 0x10,
+    0xCB, 0x8A, 0xA0, 0x21, 0x08, 0x00, 0x63, 0x68, 0x9A, 0x05, 0xB4, 0x6B, 0x81, 0x2C, 0x30, 0x9D,
+    0xFF, 0xB7, 0x64, 0xF8, 0x50, 0xFF, 0x00, 0x14, 0x79, 0xBD, 0xBF, 0xF2, 0x3F, 0xCE, 0x77, 0x02,
+    0xA5, 0x36, 0xF9, 0x0F, 0x40, 0xBD, 0xC7, 0xFE, 0xFF, 0x67, 0x35, 0x00, 0x69, 0x75, 0x64, 0x66,
+    0x00, 0x00,
+};
+const uint8_t Quicksand_18Dictionary[1024] = {
+    0xFE, 0xCF, 0xFC, 0x4F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFB, 0x3F, 0x00, 0x00,
+    0x40, 0xFC, 0xFF, 0xFF, 0x5D, 0x00, 0xF5, 0x0C, 0x00, 0x00, 0x00, 0x10, 0x54, 0x25, 0x00, 0x00,
+    0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x09, 0x00, 0x00, 0xC0, 0x8F, 0xF2,
+    0x1F, 0x00, 0x00, 0xD0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x06, 0x00, 0x00, 0xF0, 0x5F,
+    0xFB, 0x0B, 0x00, 0x00, 0x10, 0xFE, 0xEF, 0xFE, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x0A,
+    0x00, 0x00, 0xA0, 0xFF, 0x06, 0x70, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x01, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0xB0, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFE, 0xDF, 0x00, 0x00, 0x90, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+    0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x51, 0xFB, 0xDF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6D, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x4F, 0xF3, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x4F,
+    0xF1, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x4F, 0xD0, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xDF, 0xFC, 0xEF, 0xFE, 0xFF, 0x2E, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xCF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0x4F, 0xF3, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x3F,
+    0xF3, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xF3, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
+    0x30, 0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0x8C, 0x66, 0x97, 0xFE,
+    0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x81,
+    0x36, 0x53, 0xFA, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xEF, 0x00, 0x00,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0x09, 0x00, 0x00, 0x70, 0xFF,
+    0xFF, 0x4F, 0x00, 0xA0, 0xFF, 0xEF, 0x79, 0x96, 0xFE, 0xBF, 0xFC, 0x4F, 0x00, 0x00, 0xF9, 0xFF,
+    0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFB, 0xFF, 0xEF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0x1F,
+    0xEF, 0x05, 0xFA, 0x2F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0x4F, 0x00, 0xF2,
+    0xFF, 0x7E, 0x01, 0x10, 0xE6, 0xFF, 0xFE, 0x4F, 0x00, 0xFC, 0xDF, 0x01, 0x00, 0x00, 0x10, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0xFB, 0xCF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0x4F, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x4F,
+    0xF2, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x4F, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x0B, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9F, 0x00, 0x00,
+    0xA0, 0xFC, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x06, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x89, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x00, 0x00, 0xF6, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
 };
 const GFXglyph Quicksand_18Glyphs[] = {
-    { 0, 0, 10, 0, 0, 8, 0 }, //  
-    { 4, 27, 8, 2, 27, 63, 8 }, // !
-    { 13, 12, 15, 1, 27, 83, 71 }, // "
-    { 23, 27, 25, 1, 27, 195, 154 }, // #
-    { 19, 37, 22, 1, 31, 203, 349 }, // $
-    { 28, 28, 30, 1, 27, 252, 552 }, // %
-    { 24, 28, 26, 1, 27, 220, 804 }, // &
-    { 6, 12, 8, 1, 27, 44, 1024 }, // '
-    { 12, 35, 14, 1, 27, 139, 1068 }, // (
-    { 13, 35, 14, 0, 27, 142, 1207 }, // )
-    { 12, 13, 12, 0, 27, 71, 1349 }, // *
-    { 19, 19, 21, 1, 22, 56, 1420 }, // +
-    { 6, 9, 8, 1, 4, 36, 1476 }, // ,
-    { 11, 4, 15, 2, 14, 29, 1512 }, // -
-    { 4, 5, 8, 2, 5, 18, 1541 }, // .
-    { 20, 35, 20, 0, 30, 69, 1559 }, // /
-    { 20, 28, 23, 1, 27, 193, 1628 }, // 0
-    { 11, 27, 14, 0, 27, 61, 1821 }, // 1
-    { 18, 27, 21, 2, 27, 162, 1882 }, // 2
-    { 17, 28, 20, 1, 27, 167, 2044 }, // 3
-    { 20, 27, 21, 0, 27, 132, 2211 }, // 4
-    { 17, 28, 21, 2, 27, 170, 2343 }, // 5
-    { 18, 28, 20, 2, 27, 184, 2513 }, // 6
-    { 17, 28, 20, 2, 27, 97, 2697 }, // 7
-    { 18, 28, 20, 1, 27, 192, 2794 }, // 8
-    { 18, 28, 21, 2, 27, 185, 2986 }, // 9
-    { 4, 20, 8, 2, 20, 32, 3171 }, // :
-    { 7, 25, 9, 1, 20, 62, 3203 }, // ;
-    { 17, 19, 20, 1, 22, 112, 3265 }, // <
-    { 18, 11, 21, 1, 18, 38, 3377 }, // =
-    { 17, 19, 20, 2, 22, 99, 3415 }, // >
-    { 17, 28, 19, 1, 28, 142, 3514 }, // ?
-    { 34, 34, 36, 1, 27, 367, 3656 }, // @
-    { 24, 28, 24, 0, 27, 178, 4023 }, // A
-    { 20, 27, 24, 3, 27, 156, 4201 }, // B
-    { 23, 28, 24, 1, 27, 175, 4357 }, // C
-    { 23, 27, 27, 3, 27, 155, 4532 }, // D
-    { 17, 27, 21, 3, 27, 63, 4687 }, // E
-    { 17, 27, 21, 3, 27, 60, 4750 }, // F
-    { 23, 28, 26, 1, 27, 204, 4810 }, // G
-    { 21, 27, 27, 3, 27, 59, 5014 }, // H
-    { 4, 27, 10, 3, 27, 18, 5073 }, // I
-    { 16, 28, 21, 2, 27, 78, 5091 }, // J
-    { 21, 28, 25, 3, 27, 166, 5169 }, // K
-    { 17, 27, 20, 3, 27, 35, 5335 }, // L
-    { 25, 27, 31, 3, 27, 153, 5370 }, // M
-    { 22, 27, 27, 3, 27, 139, 5523 }, // N
-    { 26, 28, 29, 1, 27, 217, 5662 }, // O
-    { 18, 27, 22, 3, 27, 113, 5879 }, // P
-    { 29, 34, 29, 1, 27, 282, 5992 }, // Q
-    { 21, 27, 25, 3, 27, 148, 6274 }, // R
-    { 19, 28, 22, 1, 27, 186, 6422 }, // S
-    { 21, 27, 23, 1, 27, 49, 6608 }, // T
-    { 21, 28, 27, 3, 27, 111, 6657 }, // U
-    { 23, 27, 25, 1, 27, 183, 6768 }, // V
-    { 35, 27, 36, 0, 27, 271, 6951 }, // W
-    { 21, 28, 23, 1, 27, 189, 7222 }, // X
-    { 21, 27, 21, 0, 27, 130, 7411 }, // Y
-    { 22, 27, 24, 1, 27, 148, 7541 }, // Z
-    { 11, 35, 15, 3, 27, 51, 7689 }, // [
-    { 20, 36, 20, 0, 31, 49, 7740 }, // <backslash>
-    { 11, 35, 15, 1, 27, 50, 7789 }, // ]
-    { 17, 15, 21, 2, 28, 110, 7839 }, // ^
-    { 22, 3, 25, 2, -3, 21, 7949 }, // _
-    { 7, 6, 9, 1, 27, 33, 7970 }, // `
-    { 20, 21, 23, 1, 20, 166, 8003 }, // a
-    { 20, 29, 23, 2, 28, 171, 8169 }, // b
-    { 18, 21, 19, 1, 20, 141, 8340 }, // c
-    { 20, 29, 23, 1, 28, 177, 8481 }, // d
-    { 19, 21, 21, 1, 20, 154, 8658 }, // e
-    { 13, 28, 14, 1, 28, 77, 8812 }, // f
-    { 20, 28, 24, 1, 20, 214, 8889 }, // g
-    { 17, 28, 22, 2, 28, 100, 9103 }, // h
-    { 4, 26, 8, 2, 26, 29, 9203 }, // i
-    { 8, 34, 10, -1, 26, 61, 9232 }, // j
-    { 16, 28, 21, 3, 28, 121, 9293 }, // k
-    { 4, 28, 9, 3, 28, 19, 9414 }, // l
-    { 30, 20, 34, 2, 20, 145, 9433 }, // m
-    { 18, 20, 22, 2, 20, 94, 9578 }, // n
-    { 21, 21, 23, 1, 20, 172, 9672 }, // o
-    { 20, 28, 23, 2, 20, 170, 9844 }, // p
-    { 20, 28, 23, 1, 20, 173, 10014 }, // q
-    { 13, 20, 15, 2, 20, 63, 10187 }, // r
-    { 16, 21, 18, 1, 20, 141, 10250 }, // s
-    { 13, 25, 14, 0, 25, 72, 10391 }, // t
-    { 17, 21, 22, 2, 20, 90, 10463 }, // u
-    { 18, 21, 20, 1, 20, 147, 10553 }, // v
-    { 27, 21, 28, 1, 20, 202, 10700 }, // w
-    { 17, 21, 18, 1, 20, 145, 10902 }, // x
-    { 17, 28, 22, 2, 20, 138, 11047 }, // y
-    { 16, 20, 18, 1, 20, 103, 11185 }, // z
-    { 15, 35, 16, 0, 27, 134, 11288 }, // {
-    { 4, 37, 8, 2, 30, 22, 11422 }, // |
-    { 15, 35, 16, 1, 27, 128, 11444 }, // }
-    { 16, 6, 18, 1, 15, 55, 11572 }, // ~
+    { 0, 0, 10, 0, 0, 2, 0 }, //  
+    { 4, 27, 8, 2, 27, 56, 2 }, // !
+    { 13, 12, 15, 1, 27, 68, 58 }, // "
+    { 23, 27, 25, 1, 27, 174, 126 }, // #
+    { 19, 37, 22, 1, 31, 164, 300 }, // $
+    { 28, 28, 30, 1, 27, 216, 464 }, // %
+    { 24, 28, 26, 1, 27, 185, 680 }, // &
+    { 6, 12, 8, 1, 27, 37, 865 }, // '
+    { 12, 35, 14, 1, 27, 94, 902 }, // (
+    { 13, 35, 14, 0, 27, 73, 996 }, // )
+    { 12, 13, 12, 0, 27, 60, 1069 }, // *
+    { 19, 19, 21, 1, 22, 48, 1129 }, // +
+    { 6, 9, 8, 1, 4, 27, 1177 }, // ,
+    { 11, 4, 15, 2, 14, 22, 1204 }, // -
+    { 4, 5, 8, 2, 5, 12, 1226 }, // .
+    { 20, 35, 20, 0, 30, 57, 1238 }, // /
+    { 20, 28, 23, 1, 27, 159, 1295 }, // 0
+    { 11, 27, 14, 0, 27, 49, 1454 }, // 1
+    { 18, 27, 21, 2, 27, 125, 1503 }, // 2
+    { 17, 28, 20, 1, 27, 119, 1628 }, // 3
+    { 20, 27, 21, 0, 27, 119, 1747 }, // 4
+    { 17, 28, 21, 2, 27, 131, 1866 }, // 5
+    { 18, 28, 20, 2, 27, 132, 1997 }, // 6
+    { 17, 28, 20, 2, 27, 61, 2129 }, // 7
+    { 18, 28, 20, 1, 27, 160, 2190 }, // 8
+    { 18, 28, 21, 2, 27, 151, 2350 }, // 9
+    { 4, 20, 8, 2, 20, 26, 2501 }, // :
+    { 7, 25, 9, 1, 20, 50, 2527 }, // ;
+    { 17, 19, 20, 1, 22, 90, 2577 }, // <
+    { 18, 11, 21, 1, 18, 32, 2667 }, // =
+    { 17, 19, 20, 2, 22, 83, 2699 }, // >
+    { 17, 28, 19, 1, 28, 101, 2782 }, // ?
+    { 34, 34, 36, 1, 27, 322, 2883 }, // @
+    { 24, 28, 24, 0, 27, 145, 3205 }, // A
+    { 20, 27, 24, 3, 27, 136, 3350 }, // B
+    { 23, 28, 24, 1, 27, 146, 3486 }, // C
+    { 23, 27, 27, 3, 27, 130, 3632 }, // D
+    { 17, 27, 21, 3, 27, 54, 3762 }, // E
+    { 17, 27, 21, 3, 27, 51, 3816 }, // F
+    { 23, 28, 26, 1, 27, 176, 3867 }, // G
+    { 21, 27, 27, 3, 27, 51, 4043 }, // H
+    { 4, 27, 10, 3, 27, 12, 4094 }, // I
+    { 16, 28, 21, 2, 27, 58, 4106 }, // J
+    { 21, 28, 25, 3, 27, 158, 4164 }, // K
+    { 17, 27, 20, 3, 27, 27, 4322 }, // L
+    { 25, 27, 31, 3, 27, 151, 4349 }, // M
+    { 22, 27, 27, 3, 27, 133, 4500 }, // N
+    { 26, 28, 29, 1, 27, 141, 4633 }, // O
+    { 18, 27, 22, 3, 27, 99, 4774 }, // P
+    { 29, 34, 29, 1, 27, 220, 4873 }, // Q
+    { 21, 27, 25, 3, 27, 128, 5093 }, // R
+    { 19, 28, 22, 1, 27, 131, 5221 }, // S
+    { 21, 27, 23, 1, 27, 40, 5352 }, // T
+    { 21, 28, 27, 3, 27, 85, 5392 }, // U
+    { 23, 27, 25, 1, 27, 160, 5477 }, // V
+    { 35, 27, 36, 0, 27, 246, 5637 }, // W
+    { 21, 28, 23, 1, 27, 156, 5883 }, // X
+    { 21, 27, 21, 0, 27, 100, 6039 }, // Y
+    { 22, 27, 24, 1, 27, 125, 6139 }, // Z
+    { 11, 35, 15, 3, 27, 40, 6264 }, // [
+    { 20, 36, 20, 0, 31, 36, 6304 }, // <backslash>
+    { 11, 35, 15, 1, 27, 42, 6340 }, // ]
+    { 17, 15, 21, 2, 28, 82, 6382 }, // ^
+    { 22, 3, 25, 2, -3, 15, 6464 }, // _
+    { 7, 6, 9, 1, 27, 22, 6479 }, // `
+    { 20, 21, 23, 1, 20, 73, 6501 }, // a
+    { 20, 29, 23, 2, 28, 133, 6574 }, // b
+    { 18, 21, 19, 1, 20, 98, 6707 }, // c
+    { 20, 29, 23, 1, 28, 78, 6805 }, // d
+    { 19, 21, 21, 1, 20, 123, 6883 }, // e
+    { 13, 28, 14, 1, 28, 57, 7006 }, // f
+    { 20, 28, 24, 1, 20, 187, 7063 }, // g
+    { 17, 28, 22, 2, 28, 81, 7250 }, // h
+    { 4, 26, 8, 2, 26, 20, 7331 }, // i
+    { 8, 34, 10, -1, 26, 51, 7351 }, // j
+    { 16, 28, 21, 3, 28, 109, 7402 }, // k
+    { 4, 28, 9, 3, 28, 13, 7511 }, // l
+    { 30, 20, 34, 2, 20, 117, 7524 }, // m
+    { 18, 20, 22, 2, 20, 74, 7641 }, // n
+    { 21, 21, 23, 1, 20, 135, 7715 }, // o
+    { 20, 28, 23, 2, 20, 142, 7850 }, // p
+    { 20, 28, 23, 1, 20, 78, 7992 }, // q
+    { 13, 20, 15, 2, 20, 52, 8070 }, // r
+    { 16, 21, 18, 1, 20, 99, 8122 }, // s
+    { 13, 25, 14, 0, 25, 58, 8221 }, // t
+    { 17, 21, 22, 2, 20, 69, 8279 }, // u
+    { 18, 21, 20, 1, 20, 109, 8348 }, // v
+    { 27, 21, 28, 1, 20, 178, 8457 }, // w
+    { 17, 21, 18, 1, 20, 105, 8635 }, // x
+    { 17, 28, 22, 2, 20, 106, 8740 }, // y
+    { 16, 20, 18, 1, 20, 68, 8846 }, // z
+    { 15, 35, 16, 0, 27, 93, 8914 }, // {
+    { 4, 37, 8, 2, 30, 16, 9007 }, // |
+    { 15, 35, 16, 1, 27, 87, 9023 }, // }
+    { 16, 6, 18, 1, 15, 44, 9110 }, // ~
 };
 const UnicodeInterval Quicksand_18Intervals[] = {
     { 0x20, 0x7E, 0x0 },
@@ -838,4 +750,10 @@ const GFXfont Quicksand_18 = {
     47,
     38,
     -10,
+    GLYPH_FORMAT_RAW_DEFLATE,
+    (uint8_t*)Quicksand_18Dictionary,
+    1024,
+    NULL,
+    0,
+    { 23, 0, 0, 27, 21, 1 },
 };
@@ -1,1259 +1,647 @@
 #pragma once
 #include "epd_driver.h"
-const uint8_t Quicksand_28Bitmaps[18306] = {
-    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0x33, 0x38, 0xCD, 0xFE, 0xE0, 0x7F,
-    0xFC, 0xE7, 0xFF, 0xEB, 0xBF, 0xFC, 0x5F, 0x0F, 0x24, 0x3F, 0xFD, 0x9F, 0xFF, 0xE9, 0x7F, 0xFF,
-    0xC7, 0xFF, 0xFD, 0x1F, 0xFE, 0xD7, 0x7F, 0xF8, 0x9F, 0x0F, 0x44, 0x40, 0x59, 0x20, 0xBA, 0xF0,
-    0xDF, 0xFF, 0xC0, 0x7F, 0x7B, 0x20, 0xDA, 0xF0, 0x5F, 0x7F, 0xC3, 0x7F, 0xF9, 0x05, 0xFF, 0xE5,
-    0x27, 0xFC, 0xE7, 0x07, 0xA2, 0x86, 0xFF, 0xFC, 0x05, 0xFF, 0xF9, 0x0A, 0xFE, 0xF3, 0x26, 0xFC,
-    0xE7, 0x0D, 0xF8, 0xCF, 0x13, 0xF0, 0x9F, 0xDB, 0xE1, 0x3F, 0x37, 0xC3, 0x3F, 0x36, 0x06, 0x54,
-    0xA0, 0x50, 0xC6, 0x02, 0x34, 0xF6, 0xFB, 0xFF, 0xF7, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xE7, 0x27, 0xFC, 0xD7, 0x05, 0x00, 0x4D, 0x94, 0x48, 0x7B, 0x78, 0x9C, 0x1D, 0xCD,
-    0xCD, 0x0D, 0x01, 0x51, 0x14, 0x86, 0xE1, 0x6F, 0x82, 0x89, 0x21, 0x46, 0x07, 0x28, 0x81, 0x0A,
-    0x94, 0x40, 0x07, 0x5A, 0xD0, 0x01, 0x1D, 0xD0, 0x01, 0x1D, 0x50, 0xC2, 0xAC, 0xEC, 0xC4, 0xDA,
-    0x42, 0xE8, 0xC0, 0x3F, 0x43, 0xC4, 0xEB, 0xBB, 0x16, 0x27, 0x79, 0xF2, 0xE6, 0xDE, 0x73, 0xB4,
-    0xDA, 0x55, 0x24, 0x6D, 0xD7, 0x71, 0x0B, 0x7A, 0xD2, 0x18, 0xD2, 0x3E, 0x34, 0xA5, 0x25, 0x54,
-    0x87, 0x50, 0x93, 0x32, 0x88, 0xA7, 0x50, 0x96, 0x0E, 0x10, 0xCD, 0xA1, 0x20, 0x9D, 0xD8, 0xBB,
-    0x1F, 0xFD, 0xF5, 0xC2, 0xC4, 0x7D, 0x66, 0x5D, 0xE9, 0xBA, 0x7B, 0x89, 0xEE, 0xA4, 0x3A, 0x53,
-    0xB7, 0x9E, 0x24, 0xEE, 0xE1, 0xC4, 0x8B, 0xA2, 0x6E, 0x94, 0xAC, 0x37, 0xD2, 0x83, 0xC8, 0xFA,
-    0x2C, 0xA4, 0x7C, 0x63, 0xE8, 0x3B, 0xF0, 0x8B, 0x51, 0x50, 0xB8, 0x9D, 0x37, 0xFE, 0x2D, 0x91,
-    0xDA, 0x01, 0xEA, 0x78, 0x7E, 0x05, 0x94, 0x43, 0x79, 0x78, 0x9C, 0x85, 0x92, 0x3B, 0x4E, 0xC3,
-    0x40, 0x14, 0x45, 0x27, 0xFC, 0xCC, 0x9F, 0x54, 0xB4, 0x78, 0x03, 0x08, 0xFA, 0x14, 0x64, 0x07,
-    0x78, 0x03, 0x88, 0x25, 0x40, 0x83, 0x4C, 0x07, 0x3B, 0xA0, 0xC5, 0x15, 0xEC, 0x20, 0x74, 0x94,
-    0x49, 0x43, 0x81, 0x28, 0xC2, 0x02, 0xB0, 0xC8, 0x02, 0xD0, 0x38, 0x09, 0x01, 0x25, 0x01, 0x7C,
-    0xF0, 0x4C, 0xE6, 0xE1, 0x4F, 0xC3, 0x6D, 0xAE, 0x7C, 0x2C, 0xDD, 0x79, 0x73, 0xDF, 0x28, 0x65,
-    0xF4, 0xD0, 0xB0, 0xE6, 0x3F, 0x2D, 0x29, 0xA7, 0x3A, 0x89, 0xF5, 0x0E, 0x07, 0x82, 0x9A, 0x50,
-    0x33, 0xDE, 0xE7, 0x44, 0xD0, 0x29, 0x58, 0x7F, 0xE7, 0x50, 0xD0, 0x2D, 0xAF, 0xD6, 0x3F, 0xD8,
-    0x13, 0xF4, 0x4C, 0xCB, 0xFA, 0x98, 0x2D, 0x41, 0x7D, 0x2E, 0xAC, 0x7F, 0xB1, 0x2E, 0x68, 0xC8,
-    0xB1, 0xF5, 0x94, 0x15, 0x41, 0x92, 0x01, 0x9E, 0x20, 0x97, 0xB1, 0x0F, 0x0B, 0x76, 0xA6, 0x37,
-    0xAD, 0x21, 0xD1, 0x99, 0x52, 0xD0, 0xFA, 0x48, 0xA9, 0x1E, 0x15, 0xD5, 0xB2, 0xD3, 0x2A, 0x9A,
-    0xCF, 0xC6, 0x2C, 0xCB, 0x0C, 0x7D, 0x16, 0xDE, 0xC3, 0x79, 0x98, 0x69, 0x4C, 0x2B, 0x0C, 0xB7,
-    0xED, 0x81, 0x97, 0xAE, 0x88, 0x51, 0x5E, 0xC4, 0x1D, 0x5D, 0xEB, 0x9F, 0xEC, 0x08, 0xEA, 0x71,
-    0x63, 0x7D, 0xC2, 0xA6, 0xA0, 0x81, 0xAB, 0xE9, 0x9B, 0x35, 0x41, 0x92, 0x01, 0xCB, 0x82, 0x5C,
-    0x46, 0x1D, 0xFE, 0xAA, 0x77, 0x19, 0x4D, 0x33, 0xA6, 0x93, 0xCB, 0x90, 0xBA, 0x0B, 0x19, 0x52,
-    0x77, 0x21, 0xA3, 0x43, 0x5B, 0x90, 0x64, 0xF4, 0xB9, 0xB2, 0xDF, 0xFE, 0x75, 0xF4, 0x08, 0x91,
-    0xD1, 0x94, 0x6E, 0x14, 0x79, 0x66, 0xCC, 0xB2, 0xDA, 0xA6, 0xF6, 0x8A, 0xCC, 0x72, 0xCA, 0xCA,
-    0x3A, 0x09, 0x5E, 0xE2, 0x94, 0x24, 0x36, 0xCA, 0xEA, 0x8B, 0xE3, 0xC6, 0x3F, 0x2B, 0xF3, 0x61,
-    0x51, 0xD0, 0x94, 0x0D, 0x63, 0x01, 0xCC, 0x09, 0xFA, 0x61, 0x75, 0x56, 0x77, 0xF1, 0x8A, 0x5E,
-    0xE5, 0x8A, 0xB2, 0x76, 0x79, 0x51, 0x85, 0x0C, 0x79, 0x51, 0x85, 0x9A, 0x86, 0xF9, 0xAB, 0x0C,
-    0x5C, 0x27, 0x83, 0x7C, 0x65, 0x6A, 0xB2, 0x3B, 0xFB, 0xA5, 0x5D, 0xF3, 0xBF, 0x82, 0xBF, 0x1B,
-    0x1F, 0x78, 0x9C, 0x95, 0x92, 0x3D, 0x4E, 0xC3, 0x40, 0x10, 0x85, 0xD7, 0x06, 0x8B, 0x9F, 0x50,
-    0xB8, 0xA3, 0x41, 0x28, 0x35, 0x15, 0x17, 0x00, 0xD2, 0xD3, 0x20, 0x3A, 0x84, 0x40, 0x2E, 0xD2,
-    0x51, 0x90, 0x23, 0x70, 0x01, 0x44, 0x24, 0x0E, 0x90, 0x82, 0x03, 0x84, 0x1B, 0x04, 0x29, 0x05,
-    0xA5, 0x11, 0x34, 0xE9, 0x82, 0x44, 0x47, 0x63, 0x64, 0x14, 0x02, 0x26, 0xF6, 0x63, 0x76, 0x76,
-    0xBD, 0x3B, 0xD0, 0x00, 0xAF, 0x59, 0x7D, 0xB2, 0x66, 0xF7, 0xBD, 0x79, 0x56, 0x8A, 0x15, 0x2B,
-    0xA9, 0x16, 0xD6, 0x24, 0x3E, 0xE2, 0x42, 0xE2, 0x0B, 0xFA, 0x7F, 0xC6, 0xF8, 0x15, 0x83, 0xD0,
-    0xD1, 0x65, 0x09, 0xD2, 0x49, 0x60, 0x68, 0x08, 0xA3, 0x1E, 0xF3, 0x19, 0x6A, 0x9D, 0x6A, 0xFC,
-    0x70, 0x88, 0x45, 0xA5, 0x3A, 0x74, 0x9C, 0x4F, 0x90, 0x8E, 0xE8, 0x24, 0x2F, 0x39, 0x70, 0xCC,
-    0x0F, 0x5D, 0x11, 0x07, 0xAA, 0x40, 0x1A, 0x98, 0x77, 0x1F, 0x80, 0x50, 0x01, 0xEB, 0xD6, 0x46,
-    0x3C, 0xEB, 0x53, 0x16, 0x7D, 0x81, 0x71, 0x95, 0x44, 0x2A, 0x01, 0xE6, 0x85, 0xC9, 0x8E, 0x1E,
-    0xF8, 0x86, 0xF2, 0xEB, 0x9E, 0x98, 0x25, 0x35, 0xFD, 0xCD, 0xAC, 0xCA, 0xBD, 0xCB, 0x9A, 0x02,
-    0x5B, 0x02, 0xEF, 0xC8, 0xDB, 0xAE, 0xC7, 0xA6, 0x8E, 0x52, 0xF9, 0xE5, 0x3C, 0x71, 0xB6, 0xB4,
-    0x5E, 0x4E, 0x5C, 0x30, 0x8F, 0x57, 0x2D, 0x6F, 0x7E, 0x9A, 0xF0, 0x1B, 0xF5, 0xF8, 0xC8, 0x2D,
-    0xC3, 0x28, 0x67, 0x1C, 0xF8, 0xB5, 0x67, 0x15, 0x71, 0xC3, 0xB7, 0x90, 0x94, 0x76, 0x95, 0xB6,
-    0x94, 0x2E, 0x90, 0xC9, 0x8E, 0xDE, 0x39, 0xAB, 0xC3, 0x6B, 0x77, 0x37, 0x23, 0xAD, 0x6D, 0x59,
-    0x16, 0x0A, 0xAC, 0xFC, 0xC4, 0x50, 0x62, 0xE3, 0x7E, 0x1C, 0x8A, 0xD9, 0xA5, 0x02, 0xDB, 0x35,
-    0xDE, 0x00, 0x11, 0xA5, 0x59, 0xB0, 0x58, 0x90, 0x8D, 0x37, 0x4A, 0x1A, 0x31, 0x0E, 0xB5, 0x49,
-    0xDD, 0x7D, 0x76, 0x90, 0x23, 0xBD, 0x35, 0x11, 0x26, 0xBE, 0xFC, 0x54, 0x67, 0x9F, 0x39, 0x64,
-    0x4F, 0x49, 0x69, 0xE9, 0xC8, 0x58, 0x6A, 0x3D, 0x33, 0x1D, 0xD6, 0xBB, 0x50, 0xFB, 0x53, 0xA4,
-    0x73, 0xCA, 0xEB, 0x3F, 0x7F, 0xEC, 0xAF, 0xD8, 0x93, 0xD8, 0xC5, 0x8E, 0x44, 0xD5, 0xB6, 0x7D,
-    0x7E, 0x01, 0x7A, 0x8B, 0x45, 0x7F, 0x78, 0x9C, 0x5D, 0x93, 0x39, 0x52, 0x02, 0x41, 0x14, 0x86,
-    0x1B, 0xC5, 0x02, 0x15, 0x75, 0x62, 0x13, 0xBD, 0x81, 0x44, 0x46, 0x56, 0x41, 0xA0, 0xB1, 0x1A,
-    0x18, 0x43, 0x62, 0x19, 0xCA, 0x0D, 0x34, 0xA3, 0x8C, 0xD0, 0x13, 0xE0, 0x0D, 0xA4, 0xBC, 0xC0,
-    0x70, 0x03, 0xB9, 0xC1, 0x60, 0x64, 0x26, 0x88, 0xB2, 0x3B, 0xFC, 0xBE, 0xAD, 0xBB, 0xA6, 0xEC,
-    0xA0, 0x97, 0x7F, 0xE6, 0x7B, 0xFD, 0xB6, 0x76, 0xCE, 0x95, 0xAF, 0xD6, 0xDD, 0xFF, 0xF1, 0x04,
-    0x0C, 0x8A, 0xFE, 0x50, 0xFD, 0xDC, 0xE0, 0xA5, 0xBC, 0x02, 0xF0, 0x96, 0x33, 0xF1, 0x1D, 0x7B,
-    0xBC, 0x8C, 0xC0, 0xA3, 0x64, 0xE2, 0x52, 0xC5, 0x5F, 0xC4, 0xCD, 0x14, 0x2D, 0xD5, 0x2E, 0x80,
-    0x82, 0x2E, 0x79, 0xF7, 0x08, 0xE4, 0x8C, 0x4E, 0x78, 0xE9, 0xA2, 0x4D, 0x73, 0x0A, 0xBD, 0x6A,
-    0x81, 0x0A, 0x2F, 0x5F, 0x38, 0xA0, 0x79, 0x8A, 0x1D, 0xA3, 0xE5, 0xE3, 0x58, 0x8E, 0x23, 0xF9,
-    0xE4, 0x69, 0x37, 0xC3, 0x26, 0xCD, 0x43, 0xC5, 0x8C, 0xA6, 0x95, 0x81, 0x1E, 0x6A, 0x19, 0x9A,
-    0xC4, 0x82, 0x5C, 0x57, 0xCB, 0xD0, 0xF6, 0xA7, 0x8A, 0x9E, 0x36, 0x9B, 0x7D, 0x3E, 0x56, 0x21,
-    0x7B, 0x1A, 0x13, 0x89, 0x50, 0x1C, 0x0B, 0xB4, 0x39, 0x23, 0x8E, 0xCD, 0x3D, 0x4D, 0xF7, 0xB6,
-    0x24, 0x01, 0xC5, 0x0C, 0xED, 0xEA, 0x1C, 0x7B, 0x9D, 0x63, 0xEF, 0x63, 0x10, 0x72, 0x9C, 0xA2,
-    0x7D, 0xBD, 0xE0, 0xDF, 0xE7, 0x38, 0x0F, 0xE2, 0xB7, 0xE5, 0x33, 0x43, 0x8B, 0x23, 0x92, 0x79,
-    0xA5, 0xA3, 0x53, 0xAD, 0xD7, 0x2B, 0x24, 0x3A, 0xA1, 0xEB, 0x29, 0xB0, 0x2F, 0xEA, 0xE5, 0x4D,
-    0x9E, 0x4A, 0x05, 0x6C, 0x71, 0x35, 0xC0, 0x17, 0xFB, 0xD1, 0xC3, 0x20, 0xE7, 0x3A, 0x62, 0xBF,
-    0x12, 0xC4, 0x39, 0x47, 0x3F, 0x45, 0xF2, 0xB0, 0x0C, 0x71, 0x19, 0xCD, 0x93, 0xD5, 0x2E, 0xD0,
-    0x0D, 0x71, 0x60, 0xA6, 0xA5, 0x91, 0x5D, 0x8D, 0x13, 0x78, 0x27, 0xC9, 0xA9, 0x64, 0xE9, 0x21,
-    0x8E, 0x9C, 0xFF, 0xE4, 0x69, 0x0A, 0x8E, 0xDB, 0xE3, 0x5E, 0x8A, 0xEE, 0x69, 0xF7, 0x23, 0xD6,
-    0x1A, 0x88, 0x3D, 0xBD, 0x2D, 0x59, 0x2D, 0x49, 0xDE, 0x62, 0xA3, 0xA5, 0x6D, 0xB4, 0x07, 0xBC,
-    0x38, 0xC3, 0xAD, 0x26, 0x6C, 0x57, 0x6C, 0xBE, 0x64, 0x68, 0x6B, 0xA1, 0x67, 0xBD, 0xBD, 0x6B,
-    0x4D, 0xD7, 0x13, 0xA0, 0xAF, 0x7E, 0x4E, 0x95, 0x26, 0x30, 0x11, 0xCB, 0x6C, 0xE4, 0xD0, 0x68,
-    0x17, 0x71, 0x62, 0xA3, 0x95, 0xF5, 0x0C, 0xD6, 0xBC, 0xBB, 0xF1, 0xD9, 0x87, 0xD6, 0x6F, 0x6C,
-    0xB4, 0xB8, 0x46, 0x43, 0xEA, 0x37, 0x09, 0xCF, 0x20, 0x4A, 0x59, 0x94, 0x47, 0xD3, 0x49, 0xFC,
-    0x83, 0xE1, 0xE6, 0xC7, 0x89, 0x6E, 0x83, 0x46, 0xF5, 0x6A, 0x1E, 0xD3, 0xFC, 0x07, 0x8E, 0x08,
-    0x23, 0xE1, 0x78, 0x9C, 0x65, 0x92, 0x2D, 0x4F, 0x03, 0x41, 0x10, 0x86, 0xF7, 0x1A, 0x68, 0x29,
-    0x90, 0x50, 0x81, 0x84, 0xE4, 0x0C, 0x06, 0x55, 0x83, 0x05, 0x7E, 0x01, 0x1F, 0x09, 0x9E, 0x2A,
-    0x2C, 0x95, 0xB8, 0x82, 0x00, 0x45, 0xC2, 0x87, 0xC3, 0x70, 0xFD, 0x07, 0xAD, 0x46, 0x70, 0x40,
-    0xF0, 0x87, 0xC0, 0xB7, 0x12, 0x57, 0x1A, 0x68, 0x8E, 0x8F, 0xB6, 0x2F, 0x33, 0x73, 0xB3, 0xDB,
-    0xBB, 0x63, 0xC4, 0xED, 0xEE, 0xD3, 0x9D, 0x7D, 0xA7, 0xEF, 0x8C, 0x31, 0x12, 0x95, 0xBD, 0x83,
-    0x35, 0x93, 0x89, 0x93, 0x11, 0x80, 0xA8, 0x98, 0x22, 0xC7, 0x90, 0xE8, 0x95, 0x1C, 0xA9, 0x0C,
-    0x13, 0x84, 0xC8, 0xB3, 0xE8, 0x81, 0x4E, 0xF7, 0x77, 0xCC, 0xE7, 0x2D, 0xFA, 0x02, 0x56, 0x69,
-    0x79, 0x06, 0x2E, 0x6C, 0x1E, 0xD0, 0x90, 0x4D, 0x8C, 0x9E, 0xA2, 0x3A, 0x30, 0x27, 0x9B, 0x1A,
-    0xA0, 0xA8, 0x0D, 0x4C, 0xE9, 0x0B, 0x0D, 0x45, 0x5D, 0xF7, 0x63, 0xC5, 0x2A, 0xBE, 0x3B, 0xE4,
-    0xA2, 0xFB, 0x1F, 0x4D, 0xDE, 0x72, 0xE1, 0x14, 0x27, 0x41, 0x75, 0x6D, 0xE4, 0x33, 0xBF, 0x11,
-    0xE5, 0x51, 0x1F, 0x98, 0xC9, 0xA1, 0x57, 0x60, 0x3B, 0x4B, 0x9E, 0xD8, 0xAA, 0x42, 0x9A, 0xD4,
-    0xC4, 0xAA, 0xE5, 0x34, 0x22, 0x6B, 0x22, 0x64, 0x04, 0xA8, 0xAA, 0x56, 0xE1, 0x23, 0x53, 0x1A,
-    0x9D, 0xA6, 0xCD, 0x0E, 0x10, 0xC8, 0xA9, 0x79, 0x4E, 0x9F, 0xA1, 0xA8, 0xC5, 0x5A, 0x47, 0x8C,
-    0xA2, 0xD9, 0x04, 0x66, 0x69, 0x7B, 0xA9, 0x26, 0xFF, 0xA0, 0x6C, 0x9A, 0x40, 0x21, 0xD9, 0xCB,
-    0xB5, 0x31, 0x4A, 0xE4, 0x4C, 0x47, 0x1E, 0x69, 0xCB, 0x35, 0x9F, 0x4D, 0xE9, 0xA3, 0x95, 0xC8,
-    0x50, 0xCF, 0xCA, 0x2C, 0xCF, 0x82, 0xDA, 0x28, 0x6A, 0x66, 0xCB, 0xBC, 0x20, 0x64, 0x14, 0x68,
-    0x35, 0xBF, 0x54, 0xDB, 0x00, 0x87, 0x8C, 0x42, 0x45, 0x24, 0x14, 0x8D, 0xB0, 0xC0, 0xC6, 0xD8,
-    0x76, 0x92, 0x6D, 0xE0, 0xF7, 0x28, 0xDB, 0x19, 0x5F, 0x67, 0xE4, 0xC9, 0x1C, 0xB9, 0xD9, 0x18,
-    0x40, 0xE4, 0x7D, 0x3B, 0x10, 0x89, 0x28, 0x27, 0xF2, 0x0B, 0x3A, 0x7D, 0xFE, 0x48, 0x47, 0x8C,
-    0x1A, 0x1B, 0x78, 0xD6, 0x38, 0x8A, 0x75, 0x63, 0xAA, 0xB4, 0x04, 0x8B, 0xC6, 0xEC, 0xB2, 0xE0,
-    0x29, 0x24, 0xE7, 0x53, 0xC6, 0x74, 0xCC, 0xDF, 0x2D, 0x56, 0xD8, 0xA7, 0x6B, 0x63, 0x9D, 0x54,
-    0x84, 0x1E, 0x1F, 0xB8, 0xF4, 0x2B, 0x25, 0x1D, 0x2E, 0xF0, 0x31, 0xF9, 0x83, 0xD7, 0x72, 0xEF,
-    0x36, 0x29, 0xF9, 0x6D, 0x49, 0x96, 0xEA, 0xD9, 0xCD, 0xD1, 0x8A, 0xEB, 0xC6, 0x1F, 0x57, 0x71,
-    0x12, 0xF4, 0x78, 0x9C, 0x05, 0xC1, 0xC1, 0x09, 0x40, 0x00, 0x00, 0x40, 0xD1, 0x2F, 0x29, 0x29,
-    0xD9, 0x00, 0x23, 0xD8, 0x84, 0x51, 0x6C, 0x60, 0x05, 0x1B, 0x30, 0x8A, 0x93, 0xAB, 0x09, 0x94,
-    0x0D, 0x10, 0x89, 0xD3, 0xF7, 0x1E, 0xF3, 0x9A, 0x94, 0x5A, 0x37, 0x5A, 0xB4, 0x9A, 0xF6, 0x1A,
-    0x8F, 0x1A, 0x4E, 0xEE, 0x6C, 0x0E, 0x1C, 0xD6, 0x9C, 0x66, 0x5C, 0x26, 0xDC, 0x46, 0x3C, 0x06,
-    0xBC, 0x0B, 0x7C, 0x1D, 0xBC, 0x39, 0x54, 0xC0, 0x0F, 0x3F, 0x19, 0x22, 0x12, 0x78, 0x9C, 0x6D,
-    0x91, 0xCD, 0x11, 0xC1, 0x50, 0x14, 0x85, 0x2F, 0x26, 0x0C, 0xC1, 0xE8, 0x40, 0x0B, 0x4A, 0x50,
-    0x82, 0x0E, 0xA8, 0x40, 0x74, 0xA0, 0x04, 0x3A, 0xA0, 0x84, 0xA8, 0x40, 0x09, 0x6C, 0xAC, 0x63,
-    0x2C, 0x6C, 0x63, 0x48, 0x86, 0x0C, 0x72, 0x24, 0x79, 0xF7, 0x9D, 0xCC, 0x20, 0xAB, 0x6F, 0xDE,
-    0x7D, 0xE7, 0x27, 0xF7, 0x89, 0x7C, 0x7D, 0xE7, 0x85, 0xC2, 0x06, 0xA8, 0x14, 0x30, 0x48, 0x2D,
-    0xC5, 0x80, 0x57, 0xC0, 0x04, 0x08, 0x6A, 0xF6, 0xC8, 0x2D, 0x60, 0x08, 0xAC, 0x8C, 0xF0, 0x04,
-    0x34, 0x0D, 0xBD, 0xB0, 0x35, 0x30, 0x03, 0x3A, 0x86, 0xAE, 0x80, 0x11, 0xCA, 0x13, 0x9A, 0x34,
-    0xE0, 0xD0, 0x07, 0x1C, 0x7B, 0x2D, 0xD0, 0x1A, 0x0F, 0x8D, 0x14, 0x49, 0xD1, 0xA7, 0xC0, 0xA5,
-    0x6F, 0x9D, 0xD2, 0xAA, 0xA1, 0x23, 0x42, 0x15, 0x5C, 0x6C, 0x7C, 0x66, 0xA7, 0xDD, 0x24, 0xC2,
-    0x5C, 0x29, 0xA6, 0x71, 0x8C, 0xF1, 0x1F, 0xF2, 0x7E, 0x14, 0xA5, 0x4B, 0xE9, 0x5C, 0xA6, 0xF9,
-    0x76, 0x4B, 0x79, 0x2B, 0x87, 0x4D, 0x5B, 0x6C, 0xDF, 0x55, 0x4A, 0x18, 0x72, 0xC3, 0x4E, 0x69,
-    0xCF, 0xB5, 0x8C, 0x80, 0xB6, 0x1E, 0xBE, 0x79, 0x31, 0x42, 0xA8, 0xDE, 0x6B, 0xFE, 0x7B, 0x2F,
-    0xB5, 0x0B, 0xCC, 0xC6, 0x68, 0x30, 0xDA, 0xB6, 0x4D, 0x98, 0xBD, 0xE4, 0x6B, 0xC9, 0x9D, 0xF3,
-    0x21, 0x5F, 0x35, 0x7F, 0x69, 0xD5, 0xC8, 0x61, 0x2A, 0x1F, 0xA2, 0xB0, 0x88, 0x94, 0x78, 0x9C,
-    0x5D, 0x90, 0xE1, 0x4D, 0x02, 0x41, 0x10, 0x85, 0x57, 0x50, 0x88, 0x67, 0x94, 0x2B, 0x80, 0x1F,
-    0x54, 0x20, 0x34, 0x60, 0x28, 0xC1, 0x12, 0xB4, 0x03, 0xA9, 0xC4, 0xA3, 0x03, 0x4B, 0xA0, 0x04,
-    0xB8, 0x0A, 0x90, 0x0A, 0x30, 0xD7, 0x00, 0x20, 0x48, 0xEE, 0x4E, 0xF0, 0xD3, 0xEC, 0x9B, 0xC1,
-    0x84, 0xFD, 0xB3, 0x5F, 0x76, 0xDE, 0xBC, 0x79, 0x3B, 0xE1, 0x22, 0xE8, 0x14, 0xD3, 0x86, 0xA0,
-    0x22, 0x13, 0x94, 0xD0, 0x8D, 0x90, 0xC3, 0xAA, 0x19, 0x69, 0x0F, 0x8F, 0x11, 0x7A, 0x47, 0x68,
-    0x7A, 0xF1, 0x5E, 0xFA, 0x03, 0x4B, 0xC1, 0x02, 0xAE, 0xA5, 0x82, 0x61, 0xB0, 0x46, 0xAB, 0xCD,
-    0xA0, 0x15, 0x61, 0x00, 0xB7, 0x7A, 0xAA, 0x79, 0x12, 0x6C, 0x99, 0x9E, 0x44, 0x8A, 0xF5, 0x0C,
-    0xED, 0x08, 0x29, 0xDC, 0xF8, 0x94, 0x8E, 0xC7, 0x33, 0xEF, 0x2F, 0x5E, 0x04, 0x9F, 0x9E, 0x7C,
-    0xCD, 0x44, 0xF0, 0xC1, 0x5C, 0xF0, 0xFE, 0x0F, 0xCB, 0x33, 0x38, 0x69, 0xD6, 0x3E, 0x7E, 0xE3,
-    0xED, 0x5B, 0x37, 0xDC, 0x7B, 0xC4, 0x9A, 0xBE, 0xE0, 0x87, 0x3B, 0xFF, 0x46, 0x12, 0x61, 0x0C,
-    0x57, 0xE6, 0x87, 0x37, 0xBD, 0x09, 0x8E, 0xD6, 0x34, 0x72, 0xED, 0x06, 0xB4, 0xEC, 0x6F, 0x93,
-    0xFC, 0x55, 0x64, 0xB7, 0x83, 0x4B, 0xB3, 0xCD, 0xFC, 0x21, 0xB1, 0x4D, 0xC4, 0x74, 0x69, 0x6D,
-    0x9B, 0x28, 0xB0, 0x94, 0x95, 0xEF, 0xA8, 0xE4, 0x41, 0xF3, 0xF2, 0x57, 0xDD, 0xE1, 0x17, 0x9F,
-    0x1A, 0x87, 0xA6, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x48, 0x98, 0xC7, 0x00, 0x01, 0x0F, 0xFE, 0x43,
-    0x19, 0x17, 0xC0, 0x0C, 0x05, 0x66, 0x86, 0x0D, 0xEF, 0x19, 0x18, 0x8C, 0x18, 0x3E, 0xCF, 0x67,
-    0x58, 0x70, 0x9E, 0xA1, 0xE0, 0x3F, 0xEB, 0xD7, 0xFF, 0xB6, 0x0D, 0xFB, 0x15, 0xFE, 0xFC, 0xE7,
-    0x9C, 0xF0, 0xFF, 0x7F, 0xF9, 0xFA, 0xAF, 0xFF, 0xF7, 0x33, 0x32, 0x4C, 0xFC, 0x0F, 0x04, 0xEB,
-    0x99, 0x81, 0xCA, 0x1B, 0xFF, 0xFF, 0x9F, 0xCF, 0x04, 0xD2, 0x97, 0xF0, 0xEF, 0x7F, 0x3F, 0x23,
-    0x48, 0xE0, 0xDF, 0x7F, 0xB0, 0x10, 0x50, 0x71, 0xC5, 0xFA, 0x6F, 0xFF, 0xD7, 0x33, 0x7E, 0x03,
-    0x6B, 0xFF, 0xFB, 0x9F, 0xF3, 0xF3, 0x7A, 0x90, 0x81, 0x0D, 0xFF, 0xD9, 0xE0, 0x56, 0xC0, 0x2D,
-    0x45, 0x76, 0x46, 0xC1, 0x7C, 0x06, 0x64, 0x00, 0x00, 0x40, 0x7B, 0x3E, 0xB2, 0x78, 0x9C, 0x63,
-    0x60, 0xC0, 0x02, 0x36, 0xFC, 0x67, 0x47, 0xE6, 0xFE, 0xF8, 0xAF, 0x8F, 0xCC, 0xFD, 0xFD, 0xDF,
-    0x1F, 0x95, 0x1B, 0x3F, 0xB0, 0x5C, 0x85, 0x19, 0x33, 0x81, 0xE0, 0xDF, 0xFF, 0xFD, 0x20, 0xAA,
-    0x92, 0xE1, 0xE3, 0x7F, 0x64, 0xC0, 0xF3, 0x15, 0x85, 0x2B, 0xFF, 0x09, 0x85, 0xCB, 0x17, 0x70,
-    0xFA, 0x0C, 0x10, 0xFC, 0xFF, 0x7F, 0x1F, 0x44, 0xAD, 0x61, 0x1A, 0x24, 0x3E, 0x82, 0x71, 0x51,
-    0xC2, 0xF9, 0xFB, 0x7F, 0x79, 0x64, 0xEE, 0x84, 0xF7, 0xAC, 0x10, 0x06, 0x00, 0xD6, 0xCB, 0x73,
-    0xEF, 0x78, 0x9C, 0x63, 0x58, 0x56, 0xCD, 0xC8, 0x70, 0xF1, 0xFF, 0x7F, 0x3D, 0x86, 0xDF, 0xFF,
-    0xFF, 0x9F, 0x67, 0xF8, 0xF7, 0xFF, 0xFF, 0x7F, 0xA6, 0x17, 0xB7, 0xFE, 0xFF, 0x67, 0x65, 0x60,
-    0xF8, 0x0B, 0x22, 0x7E, 0xFD, 0x67, 0x66, 0x10, 0xF8, 0x77, 0x9F, 0x81, 0xE1, 0xD0, 0xFF, 0x7C,
-    0x86, 0x4D, 0xFF, 0xFF, 0x73, 0x33, 0xFC, 0x00, 0x2A, 0x63, 0xF8, 0xFA, 0x9F, 0x83, 0x81, 0x41,
-    0x81, 0x85, 0x81, 0x81, 0x01, 0x00, 0x89, 0x3B, 0x1F, 0x65, 0x78, 0x9C, 0x33, 0x28, 0x07, 0x03,
-    0x75, 0x86, 0xAF, 0xFF, 0x21, 0x80, 0xF9, 0x0F, 0x94, 0xC1, 0xF9, 0x0B, 0xC6, 0x78, 0x04, 0xA1,
-    0xEF, 0x33, 0x32, 0x18, 0x19, 0x83, 0x00, 0x13, 0x03, 0x00, 0x1D, 0xA4, 0x23, 0xFC, 0x78, 0x9C,
-    0x01, 0x15, 0x00, 0xEA, 0xFF, 0x40, 0x88, 0x03, 0xF6, 0xFF, 0x5F, 0xFC, 0xFF, 0xAF, 0xFD, 0xFF,
-    0xCF, 0xFD, 0xFF, 0xBF, 0xF9, 0xFF, 0x8F, 0xA1, 0xEE, 0x0A, 0xA3, 0xC5, 0x0F, 0x70, 0x78, 0x9C,
-    0x63, 0x60, 0x40, 0x02, 0x8D, 0x9A, 0x0C, 0x28, 0xE0, 0xCF, 0x7B, 0x14, 0x6E, 0xC0, 0xFF, 0xFF,
-    0x4C, 0xC8, 0xFC, 0x03, 0xFF, 0xEF, 0xA3, 0xC8, 0x7F, 0xFD, 0x9F, 0x8F, 0xAA, 0xFD, 0x3F, 0x2F,
-    0x9A, 0x76, 0xB6, 0x51, 0xED, 0x30, 0xED, 0xA8, 0x41, 0x8B, 0xAE, 0xFD, 0xEF, 0x7F, 0x3E, 0x7C,
-    0xDA, 0x2F, 0x8C, 0x6A, 0x1F, 0x24, 0xDA, 0x3F, 0xA0, 0x69, 0x3F, 0x80, 0x1A, 0xEF, 0x0C, 0x02,
-    0x33, 0x18, 0x51, 0xF8, 0x00, 0x0D, 0x3B, 0x7D, 0xB1, 0x78, 0x9C, 0x85, 0x92, 0xBD, 0x4E, 0xC3,
-    0x50, 0x0C, 0x85, 0xDD, 0x82, 0xF8, 0xFF, 0xE9, 0x88, 0x3A, 0x00, 0x12, 0x0F, 0x40, 0x76, 0x06,
-    0xC4, 0xC0, 0x0A, 0x48, 0x95, 0x98, 0xBB, 0x74, 0x62, 0x28, 0x03, 0x03, 0x1B, 0x4C, 0xAC, 0x74,
-    0x64, 0x02, 0xDE, 0x00, 0xDE, 0xA0, 0xF4, 0x09, 0xDA, 0x8D, 0x31, 0x11, 0x2F, 0x50, 0x22, 0x94,
-    0xD2, 0x16, 0x92, 0x83, 0xAF, 0x7D, 0x1D, 0xD2, 0x32, 0xE0, 0xC5, 0xF9, 0x94, 0x6B, 0xDF, 0xE3,
-    0xE3, 0x4B, 0xE4, 0xE2, 0xA0, 0x71, 0x58, 0xA2, 0x3C, 0x2A, 0xAF, 0x00, 0xC2, 0x8D, 0x9C, 0x07,
-    0x90, 0x58, 0xF0, 0xF8, 0xA8, 0x88, 0xAE, 0x2F, 0xF9, 0xF2, 0x8C, 0x15, 0xC1, 0x16, 0x7F, 0xDD,
-    0x9F, 0xDE, 0xA4, 0x40, 0x5B, 0x38, 0x01, 0x9A, 0x9C, 0x4E, 0x32, 0x60, 0xCE, 0x71, 0x86, 0xFE,
-    0x8C, 0xCB, 0x6F, 0xC0, 0x16, 0xA7, 0x73, 0x60, 0x5F, 0xCE, 0x6D, 0x03, 0xB7, 0x9C, 0xA2, 0xFC,
-    0xA2, 0x4F, 0x40, 0xCB, 0xFD, 0x3D, 0x91, 0x34, 0x18, 0xCB, 0x29, 0xD2, 0xCA, 0x65, 0x22, 0x2B,
-    0x67, 0xD9, 0xC0, 0x3A, 0x05, 0xC0, 0x9A, 0xE9, 0xFE, 0xC6, 0x31, 0xD5, 0x81, 0x25, 0xE3, 0x11,
-    0xAE, 0x9C, 0xBA, 0x79, 0xE3, 0x04, 0x4F, 0xF4, 0x02, 0xCC, 0x1A, 0x7F, 0x20, 0xA4, 0x1E, 0x50,
-    0x36, 0x8E, 0xD1, 0xA7, 0x77, 0x11, 0xA1, 0xE1, 0xBE, 0x8B, 0xCC, 0x82, 0x4A, 0xD3, 0x1C, 0x4F,
-    0x72, 0x39, 0xFE, 0xE7, 0xFC, 0x74, 0xFF, 0x68, 0xE2, 0x7E, 0xFC, 0xD1, 0xD7, 0xF2, 0x2E, 0xAA,
-    0xFE, 0xB6, 0x33, 0x61, 0xD1, 0x78, 0xC8, 0xD6, 0xF0, 0xFC, 0xAB, 0xC5, 0xF9, 0xD9, 0x9F, 0xDD,
-    0xA2, 0x3F, 0x05, 0xFF, 0xEA, 0xB2, 0xB1, 0x84, 0x87, 0xD4, 0xE8, 0x49, 0xEB, 0x28, 0x37, 0x68,
-    0x20, 0xCE, 0x5F, 0x5B, 0x83, 0x4A, 0x86, 0x07, 0xED, 0x12, 0xCA, 0x42, 0x3A, 0xFE, 0x07, 0x1F,
-    0x3B, 0xE2, 0x14, 0xA4, 0x7E, 0x71, 0xCF, 0xBC, 0xFF, 0xB3, 0x9D, 0x1A, 0xBF, 0x8A, 0xAE, 0xD6,
-    0xA5, 0xF6, 0x3E, 0x36, 0xB5, 0x6F, 0xC7, 0x63, 0x68, 0x83, 0x8E, 0x94, 0xAB, 0xA6, 0x3B, 0x18,
-    0x3B, 0xDC, 0xA3, 0xDF, 0xB8, 0xB8, 0xBB, 0xF4, 0x2E, 0xFC, 0x00, 0xC2, 0xE7, 0xF9, 0x3A, 0x78,
-    0x9C, 0x63, 0x60, 0x00, 0x82, 0x45, 0x6B, 0x99, 0x40, 0x54, 0xC1, 0xFF, 0xFF, 0x3C, 0x40, 0x4A,
-    0xE1, 0xCF, 0xFF, 0xFF, 0xFC, 0x40, 0xFA, 0xFB, 0x7F, 0x30, 0x7D, 0xF9, 0x3F, 0x98, 0x6E, 0xF8,
-    0x0F, 0xA6, 0x0D, 0xFE, 0x42, 0xE8, 0xCF, 0x40, 0x42, 0x1B, 0x48, 0xFF, 0xFC, 0xFF, 0x3F, 0x9F,
-    0x01, 0x48, 0xFF, 0xF8, 0x7F, 0x9E, 0x09, 0x44, 0x1F, 0xFC, 0xCF, 0xCE, 0x00, 0xA2, 0x19, 0x84,
-    0x18, 0x20, 0x34, 0xC3, 0x30, 0xA6, 0xFF, 0x82, 0xC3, 0x8B, 0x81, 0xE1, 0xD2, 0x79, 0x26, 0x00,
-    0x9E, 0x6D, 0x6D, 0x04, 0x78, 0x9C, 0x55, 0x91, 0x4D, 0x4E, 0x02, 0x41, 0x10, 0x85, 0x4B, 0x50,
-    0x20, 0x88, 0x32, 0x1B, 0x96, 0x24, 0xDE, 0x40, 0x37, 0xAE, 0x89, 0x27, 0x40, 0x4F, 0x20, 0x2B,
-    0x56, 0x26, 0x78, 0x03, 0xB8, 0x09, 0x47, 0x18, 0x6F, 0x00, 0x9C, 0x40, 0x5D, 0xB9, 0x34, 0xE8,
-    0x01, 0x08, 0x60, 0xFC, 0x77, 0x3E, 0x6A, 0xEC, 0xA1, 0xAB, 0x78, 0xBB, 0x6F, 0xAA, 0xE7, 0xBD,
-    0xD7, 0xD5, 0x22, 0xAA, 0x8B, 0xFE, 0xB9, 0x6C, 0x95, 0x3C, 0x01, 0xF7, 0x95, 0x82, 0x3E, 0xC9,
-    0xB5, 0x08, 0xF8, 0x4A, 0x50, 0x9A, 0x43, 0x8F, 0xAD, 0xEA, 0x4A, 0xEF, 0x30, 0x69, 0xC9, 0xD5,
-    0x2F, 0x0C, 0x44, 0xCE, 0xD4, 0xA0, 0xAC, 0x1F, 0x2F, 0xF5, 0x4F, 0x91, 0x79, 0x38, 0x21, 0xB2,
-    0x86, 0xAA, 0x1A, 0x4E, 0x82, 0xF3, 0x2D, 0x34, 0x94, 0x8E, 0x8B, 0x20, 0x68, 0xCA, 0x8C, 0xFD,
-    0x82, 0x7E, 0xE8, 0x88, 0xEC, 0x49, 0x2C, 0xD1, 0x15, 0xD3, 0x07, 0xD7, 0x3B, 0xE4, 0x67, 0xDF,
-    0x9C, 0x3A, 0xCA, 0xA2, 0x7B, 0x28, 0x53, 0x37, 0x9A, 0x12, 0xB3, 0xFE, 0xDB, 0x3F, 0x1B, 0x24,
-    0x99, 0x0F, 0xB8, 0x83, 0x23, 0x9F, 0x46, 0xD9, 0x3B, 0x8E, 0x6D, 0xB4, 0xF6, 0x07, 0x75, 0x03,
-    0x94, 0x22, 0xBD, 0xE0, 0x4A, 0x26, 0x7F, 0x70, 0x10, 0xE9, 0x11, 0x86, 0xE6, 0xA1, 0xEB, 0xAB,
-    0xF9, 0xE4, 0xD4, 0x46, 0x5F, 0x70, 0x18, 0x61, 0xA4, 0x0B, 0xDE, 0x29, 0xD5, 0x8E, 0xA0, 0xCF,
-    0xB2, 0xB0, 0xE4, 0x37, 0xF2, 0x45, 0xBA, 0x52, 0x76, 0xE9, 0x15, 0xEE, 0x9A, 0x27, 0x19, 0xDC,
-    0xF4, 0x83, 0x5A, 0xF2, 0x80, 0x53, 0x69, 0xE5, 0xA9, 0xB6, 0xF4, 0x54, 0xED, 0x65, 0x06, 0xA9,
-    0x6C, 0x00, 0xA5, 0x5A, 0xC2, 0xDB, 0x78, 0x9C, 0x4D, 0x91, 0x3D, 0x4E, 0x02, 0x51, 0x14, 0x85,
-    0x1F, 0x0E, 0x14, 0x86, 0x98, 0x4C, 0x67, 0x0C, 0x31, 0xCC, 0x06, 0x74, 0x0B, 0x5A, 0xDA, 0xE1,
-    0x12, 0xB0, 0xB3, 0x30, 0x18, 0x0B, 0x6A, 0xE9, 0xB4, 0xC3, 0x92, 0xC4, 0x02, 0x17, 0x60, 0x02,
-    0x0D, 0xA5, 0x91, 0x1D, 0xB0, 0x00, 0x30, 0x68, 0x28, 0x28, 0x07, 0x45, 0x83, 0x3F, 0xCC, 0x7C,
-    0xCE, 0x1B, 0xE6, 0xDD, 0xB9, 0xB7, 0x3A, 0x5F, 0xCE, 0xE4, 0xDE, 0xF3, 0xCE, 0x04, 0x37, 0xB7,
-    0x6E, 0x76, 0xCD, 0x3B, 0x32, 0x53, 0xF3, 0x95, 0x03, 0xC5, 0x0F, 0x05, 0x5B, 0xA7, 0x93, 0x97,
-    0x74, 0x22, 0x68, 0x1B, 0x37, 0x4B, 0xD8, 0x76, 0x3A, 0x88, 0xE9, 0x89, 0xF1, 0x06, 0x65, 0xA7,
-    0xFD, 0x88, 0x91, 0x18, 0x43, 0xD8, 0x17, 0xF8, 0x23, 0x2C, 0x38, 0xDD, 0x87, 0x43, 0x31, 0x7E,
-    0xC0, 0x73, 0xBA, 0x05, 0x35, 0x31, 0x56, 0x50, 0x72, 0xBA, 0x9E, 0xC4, 0x7A, 0x3A, 0xC9, 0xE0,
-    0x33, 0x4D, 0xD9, 0xD8, 0xC0, 0xEF, 0x26, 0xF3, 0x81, 0x86, 0x30, 0x5D, 0x38, 0x0B, 0xEF, 0x3B,
-    0x6B, 0xDC, 0xA9, 0xE4, 0xB8, 0x3F, 0x47, 0xA5, 0xF3, 0xD7, 0x6A, 0xBF, 0xCD, 0xBA, 0x93, 0x5B,
-    0x70, 0x24, 0x60, 0xBE, 0xB9, 0xCE, 0x61, 0xA9, 0x1E, 0x6E, 0x16, 0x6A, 0x9D, 0x79, 0x4D, 0x2A,
-    0x55, 0x30, 0xD2, 0x9F, 0x3D, 0xEB, 0x05, 0x5D, 0xBD, 0xFA, 0x32, 0x87, 0x98, 0xAA, 0xE8, 0x3B,
-    0xDB, 0xE9, 0x60, 0x4F, 0x8A, 0xF0, 0x8E, 0x99, 0x7A, 0x99, 0xD1, 0x33, 0x0F, 0xD0, 0x4D, 0xE8,
-    0x2C, 0xB2, 0xA1, 0x5B, 0xF6, 0xC1, 0x8F, 0x63, 0xFB, 0x4B, 0x0B, 0xD2, 0x00, 0x54, 0x6C, 0x6B,
-    0x31, 0xAA, 0xAA, 0xAB, 0xC8, 0xEA, 0x8B, 0xEC, 0x42, 0xD0, 0xEC, 0x9C, 0x17, 0x53, 0xF5, 0x0F,
-    0x00, 0xFB, 0xC8, 0x4D, 0x78, 0x9C, 0xCD, 0xD1, 0x3D, 0x0A, 0xC2, 0x40, 0x10, 0x86, 0xE1, 0x51,
-    0x03, 0x82, 0x58, 0xA4, 0xB2, 0x13, 0x3C, 0x81, 0xD8, 0x5B, 0xE8, 0x09, 0x24, 0x17, 0x11, 0xD3,
-    0x05, 0x4F, 0xA1, 0x37, 0xD0, 0x23, 0xD8, 0x59, 0x6A, 0x65, 0x1B, 0x6F, 0x10, 0xED, 0x65, 0x03,
-    0xFE, 0x10, 0x45, 0x93, 0xCF, 0x0D, 0x1A, 0xFC, 0x26, 0x27, 0xF0, 0x2D, 0x96, 0x7D, 0xD8, 0x6A,
-    0x66, 0x45, 0x8A, 0x76, 0x7D, 0xE1, 0x3C, 0xC4, 0xCA, 0x67, 0xA0, 0xC6, 0x4E, 0xB5, 0x97, 0xD0,
-    0x4E, 0xB4, 0x87, 0xD0, 0x3E, 0x96, 0xFC, 0x42, 0xC8, 0x9E, 0x03, 0x53, 0xF6, 0x0D, 0xA1, 0x4F,
-    0xEE, 0x00, 0x5D, 0xF6, 0x1E, 0x70, 0xD8, 0x4F, 0xCC, 0x84, 0x6C, 0xAF, 0x4D, 0xF6, 0x15, 0x71,
-    0x85, 0xEC, 0x66, 0x18, 0x08, 0x79, 0x0B, 0xD4, 0xD9, 0x0F, 0x6C, 0x84, 0xEC, 0x01, 0x6D, 0xF6,
-    0x77, 0x31, 0x85, 0xDD, 0x14, 0x13, 0x21, 0xAF, 0x80, 0x06, 0x3B, 0x41, 0x24, 0x64, 0xBB, 0x98,
-    0x45, 0x90, 0xB7, 0xB6, 0x23, 0x07, 0x2D, 0x39, 0x80, 0x8B, 0xE4, 0xA2, 0x0C, 0x47, 0xBF, 0xA3,
-    0xDA, 0x3B, 0x99, 0x4F, 0x19, 0x60, 0xCC, 0xF8, 0xB7, 0x51, 0xBF, 0xF4, 0x5F, 0xFF, 0x66, 0x3B,
-    0xB8, 0xA8, 0xEE, 0xA3, 0xFC, 0x7C, 0x03, 0x5E, 0x10, 0xC9, 0x08, 0x78, 0x9C, 0x7D, 0x91, 0x3F,
-    0x4E, 0x02, 0x41, 0x18, 0xC5, 0x1F, 0x06, 0x34, 0x91, 0x88, 0x68, 0xA1, 0x74, 0x60, 0x4C, 0x28,
-    0x4C, 0x0C, 0x04, 0x2E, 0xE0, 0x11, 0x08, 0x17, 0x70, 0x4B, 0x12, 0x1A, 0x0E, 0x40, 0x42, 0x63,
-    0x61, 0xE7, 0x15, 0xB0, 0xD1, 0x12, 0x4E, 0xE0, 0xEE, 0x09, 0x0C, 0x2D, 0x15, 0x36, 0x14, 0x5A,
-    0xA0, 0x6C, 0x08, 0x91, 0x40, 0x78, 0xCE, 0x9F, 0xDD, 0x9D, 0x6F, 0x1B, 0x5F, 0x33, 0xF3, 0xCB,
-    0x37, 0xF3, 0xCD, 0xFB, 0xDE, 0x00, 0x0F, 0x8F, 0x91, 0x3A, 0x00, 0x3C, 0x26, 0xCA, 0x03, 0x13,
-    0x47, 0x65, 0xE0, 0xC7, 0x51, 0x01, 0x08, 0xF9, 0xBD, 0xB0, 0x7A, 0xCF, 0x02, 0x2B, 0xD6, 0xE0,
-    0xB4, 0xE6, 0xA9, 0xA0, 0x0D, 0x4F, 0x04, 0x6D, 0x79, 0x2C, 0x68, 0xCF, 0x23, 0x41, 0x64, 0xCE,
-    0x41, 0x9D, 0x3C, 0x70, 0xD4, 0x22, 0xC5, 0xC1, 0x1E, 0x67, 0xC0, 0x55, 0x33, 0xAA, 0x0F, 0x39,
-    0x6A, 0x7D, 0x29, 0x57, 0xFD, 0x8C, 0xA6, 0x80, 0xB3, 0xBD, 0x31, 0xF9, 0xA4, 0xC9, 0x99, 0xBE,
-    0x55, 0xB4, 0x74, 0x23, 0x64, 0x6D, 0xAD, 0x7B, 0xDD, 0x78, 0x51, 0x8B, 0x72, 0x3F, 0x26, 0x4B,
-    0xFA, 0xC6, 0x33, 0x75, 0x73, 0xBC, 0x5E, 0xC6, 0xB3, 0x48, 0x8B, 0x3D, 0x33, 0x7B, 0xA2, 0x1D,
-    0xEF, 0x05, 0xAD, 0x38, 0x12, 0xF4, 0x61, 0xDA, 0xC4, 0x1A, 0xA7, 0xFC, 0x0F, 0xFF, 0xA1, 0xF4,
-    0xC9, 0x74, 0x97, 0x90, 0xBE, 0xA0, 0x5F, 0x0E, 0x1C, 0x14, 0xCD, 0x1F, 0xC5, 0x0A, 0xA8, 0x62,
-    0xF6, 0x16, 0x87, 0xB6, 0xB4, 0xD5, 0x51, 0x2E, 0xE9, 0x9B, 0xBC, 0xE6, 0x26, 0x99, 0x90, 0xF4,
-    0xAB, 0x67, 0xED, 0x4F, 0xFB, 0xD1, 0x41, 0x12, 0x8B, 0x9E, 0xA0, 0xB8, 0x8B, 0xC9, 0x4C, 0xEE,
-    0xD9, 0x38, 0x79, 0x63, 0x5B, 0xDF, 0x4D, 0xD5, 0xFE, 0xED, 0x22, 0x79, 0xAA, 0xD2, 0x3C, 0x8F,
-    0x76, 0x7F, 0xAB, 0xC8, 0xCF, 0x2A, 0x78, 0x9C, 0x55, 0x91, 0xBF, 0x32, 0x43, 0x51, 0x10, 0xC6,
-    0x4F, 0xE4, 0xFA, 0x33, 0x92, 0x21, 0x85, 0x4A, 0x41, 0xDE, 0x80, 0x5E, 0xC1, 0x1B, 0x44, 0xA7,
-    0x65, 0xD2, 0xD3, 0xEA, 0xA8, 0xB4, 0x99, 0x49, 0x65, 0x34, 0x14, 0xB4, 0x19, 0x95, 0x36, 0x3C,
-    0x80, 0x89, 0x37, 0x50, 0xA9, 0xEF, 0xC4, 0x48, 0x24, 0x9C, 0x7B, 0x3F, 0xDF, 0x9E, 0x3F, 0x7B,
-    0xAE, 0x6D, 0x92, 0xDF, 0xDD, 0xB3, 0xBB, 0xDF, 0x7E, 0x6B, 0x8C, 0x8F, 0x93, 0x9B, 0xBA, 0xD1,
-    0xE8, 0x03, 0xDB, 0x0A, 0x97, 0x00, 0xF6, 0x23, 0xB4, 0x0B, 0x54, 0x72, 0x13, 0xC2, 0x7B, 0xAC,
-    0x3B, 0x26, 0x0C, 0xB3, 0x98, 0x9A, 0x02, 0xB9, 0xC2, 0x01, 0x53, 0xAB, 0xDA, 0xF0, 0x13, 0xB8,
-    0x48, 0xB3, 0xD8, 0x70, 0xB1, 0x3A, 0xEB, 0xCC, 0x54, 0x1F, 0xAE, 0x24, 0xFA, 0xC5, 0x30, 0xC1,
-    0x2E, 0xB0, 0x95, 0xE8, 0xB1, 0xDA, 0x83, 0x65, 0xF2, 0xB0, 0x16, 0x68, 0x46, 0xF1, 0x0F, 0x25,
-    0x06, 0x5E, 0x4C, 0x89, 0xC6, 0x07, 0x44, 0x75, 0xE6, 0x9B, 0x3C, 0xC1, 0x45, 0xCF, 0xCF, 0x2E,
-    0x3C, 0x89, 0xD6, 0x37, 0xF9, 0x1D, 0x1C, 0x5D, 0x59, 0xE0, 0xD6, 0x98, 0x31, 0xE1, 0x54, 0x2A,
-    0xAC, 0x4C, 0xFA, 0x62, 0xBD, 0x6B, 0x7F, 0x07, 0xAC, 0x99, 0x6F, 0x95, 0x62, 0xB9, 0xD7, 0x1C,
-    0xC8, 0xA2, 0x8C, 0x9C, 0x9A, 0x47, 0x41, 0x06, 0x9F, 0x66, 0x56, 0x97, 0x3B, 0xE4, 0x66, 0x16,
-    0x3B, 0x81, 0x5A, 0x9C, 0x68, 0xB1, 0x1E, 0xF5, 0x03, 0xCD, 0x9F, 0x44, 0x25, 0x9A, 0xB3, 0x7F,
-    0xB9, 0x89, 0x5E, 0xA3, 0xCD, 0xBA, 0xB1, 0x7A, 0x49, 0xFF, 0x97, 0x9F, 0x39, 0xD3, 0x07, 0xF5,
-    0x2F, 0xC8, 0x17, 0x4F, 0x53, 0xD1, 0x51, 0xA2, 0x13, 0xBD, 0xEB, 0xB8, 0xDB, 0x2D, 0x09, 0x71,
-    0x99, 0x86, 0x93, 0x37, 0xA2, 0x85, 0xF7, 0xBC, 0x5A, 0xCD, 0x6D, 0x02, 0xBC, 0x16, 0xF1, 0xF0,
-    0x2F, 0xC1, 0x96, 0xBC, 0x1E, 0x1C, 0x75, 0xB1, 0x19, 0x44, 0xCC, 0x05, 0xF6, 0xD4, 0xFD, 0xEE,
-    0xF5, 0xF9, 0x86, 0xFB, 0xF3, 0x07, 0x30, 0xAD, 0xD6, 0xED, 0x78, 0x9C, 0x8D, 0xD1, 0xCD, 0x0D,
-    0x01, 0x51, 0x18, 0x85, 0xE1, 0xCF, 0x4F, 0xC6, 0x5F, 0xC8, 0x74, 0x40, 0x07, 0x33, 0x25, 0xE8,
-    0x40, 0x09, 0x74, 0x40, 0x07, 0x66, 0x69, 0xA7, 0x04, 0x3A, 0xA0, 0x03, 0x25, 0x98, 0x06, 0x84,
-    0x0E, 0x84, 0x8C, 0x89, 0x49, 0x46, 0x8E, 0xD9, 0x70, 0xBE, 0xB3, 0x90, 0x38, 0xBB, 0x37, 0x37,
-    0xF7, 0x3E, 0x8B, 0x1B, 0xAF, 0xB8, 0xC0, 0x32, 0x70, 0x3B, 0x2B, 0x5C, 0xC1, 0x72, 0x17, 0x57,
-    0x4B, 0x4E, 0x9F, 0x01, 0x4B, 0xFB, 0x2E, 0x04, 0x86, 0xAC, 0x04, 0xE8, 0xB0, 0x2E, 0x40, 0x9D,
-    0x95, 0xE3, 0xC0, 0xB0, 0x17, 0x26, 0x8C, 0x31, 0xD0, 0x67, 0xED, 0x81, 0x80, 0x75, 0xAF, 0x6C,
-    0xAE, 0xC0, 0xFA, 0x97, 0xBD, 0x00, 0xBA, 0x62, 0x37, 0x58, 0x0F, 0x1C, 0xDD, 0x23, 0x25, 0xA6,
-    0x62, 0x0F, 0xC4, 0x6E, 0x79, 0x1B, 0x35, 0x6F, 0x6F, 0xC4, 0x8E, 0xC4, 0xEE, 0x89, 0xDD, 0xF4,
-    0xF6, 0x59, 0xEC, 0x39, 0x23, 0x16, 0x7B, 0x2B, 0xF6, 0x4D, 0xEC, 0xA7, 0xB7, 0x4D, 0xEC, 0x99,
-    0xD8, 0xA9, 0xD8, 0xD9, 0xBF, 0x76, 0xF5, 0x71, 0x6D, 0x29, 0x67, 0x87, 0xA5, 0xBB, 0x66, 0x36,
-    0xE2, 0xD1, 0x1B, 0x69, 0xF0, 0x92, 0x12, 0x78, 0x9C, 0x5D, 0x51, 0x3D, 0x2F, 0x43, 0x61, 0x18,
-    0x3D, 0x4D, 0x2B, 0x14, 0xE1, 0xC6, 0xA8, 0x89, 0x18, 0x8D, 0x24, 0xAC, 0x48, 0x2C, 0xB6, 0x76,
-    0x36, 0x88, 0xC1, 0x5E, 0xAB, 0xC9, 0x2F, 0xF0, 0x31, 0x19, 0x2C, 0x0C, 0x12, 0xA3, 0xAE, 0x12,
-    0x89, 0xCD, 0x7A, 0x11, 0xA3, 0xE4, 0xD6, 0xC7, 0x5E, 0xDF, 0x69, 0x2B, 0x7A, 0x3C, 0x5F, 0xA5,
-    0x71, 0x96, 0xF7, 0x9E, 0xBC, 0xE7, 0x39, 0xEF, 0x39, 0xCF, 0x05, 0x80, 0x64, 0xFF, 0xEE, 0x7C,
-    0x19, 0x81, 0xC9, 0x36, 0x05, 0x3B, 0xC1, 0x9A, 0x34, 0xCC, 0x1B, 0xA9, 0x31, 0xD0, 0xA7, 0x4C,
-    0x74, 0xD9, 0xC1, 0x99, 0xB0, 0x05, 0x21, 0x15, 0x32, 0xCD, 0x03, 0x6B, 0x64, 0x43, 0x58, 0x9D,
-    0x1C, 0x54, 0xC9, 0x03, 0x39, 0x00, 0x7C, 0x32, 0xB5, 0xF1, 0x69, 0x72, 0x14, 0xF8, 0x32, 0xBD,
-    0xCD, 0x97, 0x81, 0x0E, 0x47, 0x9C, 0xBD, 0x73, 0x17, 0x20, 0x87, 0x9C, 0xBD, 0xF0, 0x14, 0x49,
-    0x98, 0x00, 0xCF, 0xBC, 0xF8, 0x77, 0xD7, 0x3B, 0xB7, 0x05, 0xB4, 0xD4, 0xCA, 0x3D, 0xC5, 0xFC,
-    0x8D, 0x99, 0x91, 0x45, 0x72, 0x18, 0x38, 0x0A, 0x9B, 0x47, 0x52, 0x02, 0x26, 0xDF, 0x96, 0x73,
-    0x83, 0x3A, 0x06, 0x5C, 0x4B, 0x87, 0xCD, 0x93, 0x8E, 0xC5, 0xF4, 0x4A, 0x8A, 0x55, 0x37, 0x6B,
-    0xF5, 0xB2, 0x9B, 0x6E, 0xF7, 0xA2, 0xEE, 0x48, 0x26, 0xB6, 0xE7, 0xD6, 0x45, 0x20, 0xC1, 0x70,
-    0x1F, 0x9A, 0xA6, 0x5D, 0xB6, 0x99, 0xE6, 0xE2, 0xF5, 0xB2, 0x56, 0x9E, 0x70, 0xB3, 0x0F, 0x59,
-    0xC2, 0x5E, 0x6C, 0xCE, 0x42, 0xE5, 0xAF, 0x6C, 0x55, 0x21, 0xED, 0xB7, 0x8E, 0x06, 0xED, 0x6D,
-    0x1D, 0x1D, 0xD2, 0xFB, 0xEF, 0x4E, 0x59, 0xFD, 0x77, 0x4E, 0xDC, 0x8B, 0x35, 0xAB, 0xA5, 0x50,
-    0xF7, 0x8A, 0x55, 0x56, 0xBC, 0x92, 0x39, 0xD9, 0x92, 0xDB, 0x48, 0xEB, 0x43, 0x8D, 0xC0, 0x92,
-    0xB2, 0x27, 0x0B, 0x25, 0x72, 0xAE, 0x8C, 0xCD, 0x5C, 0xCA, 0x51, 0x80, 0xFE, 0x96, 0x40, 0x35,
-    0xBC, 0x0C, 0x8D, 0x82, 0xCD, 0xDF, 0x3A, 0x1B, 0x8F, 0x77, 0x8F, 0xA5, 0x7E, 0x36, 0xD5, 0x8D,
-    0x84, 0x64, 0x69, 0xD6, 0x3F, 0x7E, 0x00, 0x4D, 0x25, 0xF3, 0x59, 0x78, 0x9C, 0x55, 0x91, 0xBB,
-    0x4E, 0xC3, 0x50, 0x10, 0x44, 0xD7, 0x51, 0x4C, 0x02, 0x09, 0xE0, 0x92, 0x8E, 0xF4, 0x20, 0x91,
-    0x3F, 0x80, 0x3F, 0x80, 0x0A, 0x44, 0x95, 0x48, 0xF4, 0x88, 0x1E, 0x89, 0x47, 0x47, 0xC7, 0x27,
-    0x40, 0x47, 0x4B, 0x47, 0x47, 0x68, 0xA8, 0x11, 0x48, 0xB4, 0x3C, 0x0A, 0x6A, 0x2B, 0x52, 0x1E,
-    0x0E, 0x06, 0x0F, 0xB3, 0xEB, 0x7B, 0x6D, 0x33, 0x85, 0xE5, 0xE3, 0x7B, 0x77, 0x77, 0x76, 0x2C,
-    0x42, 0x1D, 0x5C, 0xEC, 0xD5, 0xC4, 0xA9, 0xFB, 0x0D, 0x20, 0x5E, 0x71, 0x34, 0x83, 0xA9, 0x61,
-    0xF0, 0x92, 0x03, 0x06, 0x0A, 0x9D, 0x8C, 0x6F, 0x6F, 0xFA, 0x68, 0x93, 0x3E, 0xF9, 0x35, 0x94,
-    0xE8, 0x11, 0xB8, 0x22, 0xB1, 0x45, 0xA8, 0x77, 0xA6, 0x40, 0x5D, 0xB6, 0x80, 0x6D, 0x2B, 0xDF,
-    0x01, 0x16, 0xE5, 0xD6, 0x37, 0x93, 0x04, 0x3D, 0x19, 0xE2, 0xDD, 0x0D, 0xFA, 0xC0, 0x93, 0x4C,
-    0x70, 0xEA, 0xE8, 0x08, 0x08, 0x66, 0xD8, 0xF0, 0x96, 0xD8, 0x2E, 0xC5, 0xB2, 0x77, 0x08, 0x34,
-    0x7F, 0xAA, 0xD4, 0xFA, 0x47, 0xED, 0x14, 0xAB, 0x0E, 0x3A, 0xA4, 0xC4, 0x0D, 0x17, 0xE9, 0x93,
-    0xC6, 0x66, 0x4F, 0xF5, 0xC0, 0xBA, 0x21, 0xA7, 0xE4, 0x34, 0x02, 0xE6, 0xE9, 0x6C, 0xC1, 0x20,
-    0xE2, 0x52, 0x0D, 0xCE, 0xBC, 0x34, 0x7A, 0x86, 0x2E, 0xC1, 0x8D, 0xD6, 0xB4, 0x87, 0xEE, 0x1B,
-    0xE8, 0xB6, 0x38, 0xDE, 0xBD, 0x51, 0xA0, 0xFF, 0x6E, 0xE6, 0x72, 0xF9, 0xB5, 0xEE, 0x2E, 0xA5,
-    0xC1, 0x38, 0x9F, 0x6C, 0x09, 0xC6, 0x73, 0x29, 0x96, 0xAC, 0xF7, 0x5D, 0x86, 0xFB, 0x90, 0xC6,
-    0x9A, 0x52, 0xE8, 0x1A, 0xA8, 0x95, 0x34, 0xCA, 0xE3, 0x15, 0x6F, 0x65, 0xB3, 0x24, 0x3A, 0x6C,
-    0x95, 0x94, 0x54, 0xCB, 0xFA, 0xDE, 0xAE, 0x69, 0xA2, 0x49, 0x7B, 0x9D, 0xA1, 0x72, 0x31, 0x4A,
-    0x51, 0x04, 0x22, 0xF2, 0x05, 0xF7, 0xA3, 0x54, 0xAF, 0x84, 0x5E, 0xF5, 0x24, 0xAE, 0xFB, 0x22,
-    0x5D, 0x61, 0xDD, 0x1F, 0x31, 0x19, 0x1C, 0x96, 0xB3, 0x32, 0x9C, 0x04, 0x25, 0x9D, 0xEF, 0x17,
-    0xAF, 0x7F, 0x5A, 0x92, 0xD7, 0x81, 0x78, 0x9C, 0x63, 0x70, 0x66, 0x64, 0x38, 0xF0, 0xBF, 0x9E,
-    0xE1, 0xDB, 0xFF, 0xFF, 0x0C, 0xDF, 0xFF, 0xFF, 0x67, 0x04, 0xE1, 0xAF, 0xFF, 0xDF, 0x33, 0x6C,
-    0xF8, 0x9F, 0xCF, 0xC0, 0x60, 0xC4, 0xC8, 0x40, 0x29, 0x10, 0x28, 0x63, 0x65, 0x78, 0xF8, 0x7F,
-    0x3D, 0xD8, 0xFC, 0x1F, 0x50, 0xF3, 0xBF, 0x00, 0xCD, 0x6F, 0xF8, 0x67, 0xCB, 0x00, 0x00, 0xFC,
-    0x31, 0x21, 0x2F, 0x78, 0x9C, 0xB5, 0x8E, 0xB1, 0x09, 0x83, 0x40, 0x00, 0x00, 0x4F, 0x13, 0x10,
-    0x4C, 0x23, 0xA4, 0x0E, 0x58, 0x38, 0x80, 0x9B, 0xE8, 0x06, 0x8E, 0x90, 0x01, 0xDC, 0x27, 0x6D,
-    0x0A, 0x07, 0x70, 0x07, 0xBB, 0x54, 0x81, 0x94, 0xF6, 0x81, 0x68, 0x42, 0xCE, 0x17, 0x67, 0xF0,
-    0x8A, 0xEB, 0x0E, 0x8E, 0xBC, 0x00, 0x66, 0x4F, 0x94, 0xDA, 0x50, 0xEB, 0x75, 0x53, 0xAE, 0x15,
-    0x7C, 0x4C, 0x21, 0x3B, 0xB3, 0x27, 0xB7, 0x36, 0xE2, 0xA5, 0x17, 0x7E, 0x7A, 0xC7, 0x40, 0xF4,
-    0x18, 0xF5, 0x08, 0xFF, 0x55, 0x5F, 0x63, 0x32, 0x9F, 0x30, 0x84, 0xBF, 0xCE, 0x30, 0x34, 0xD9,
-    0xC3, 0xDB, 0x04, 0xCA, 0x43, 0xE8, 0x17, 0xC0, 0x3F, 0x2E, 0x26, 0x78, 0x9C, 0x63, 0x60, 0x80,
-    0x83, 0x62, 0x56, 0x04, 0x7B, 0xE1, 0xFF, 0x7A, 0x38, 0xBB, 0xE1, 0xFF, 0xFF, 0xF7, 0x30, 0x76,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xCF, 0x43, 0xD9, 0x06, 0x7F, 0xFE, 0xFF, 0xFF, 0x2F, 0x05, 0x61, 0x0B,
-    0xFC, 0x02, 0xB2, 0x6D, 0xA1, 0x12, 0x3F, 0x80, 0xEC, 0x3C, 0x28, 0xFB, 0x29, 0x90, 0xDD, 0x0F,
-    0x65, 0x1F, 0x06, 0xB2, 0xD7, 0x33, 0x41, 0xD8, 0x8B, 0x80, 0xEC, 0xF3, 0xCC, 0x70, 0x0B, 0xFE,
-    0xBF, 0x87, 0x5A, 0x9E, 0x00, 0xB4, 0xE0, 0x3F, 0x07, 0x84, 0xAD, 0x80, 0x64, 0x01, 0xC3, 0x03,
-    0x20, 0xDB, 0x06, 0xE6, 0x8C, 0xCF, 0xFF, 0xFF, 0xE7, 0xC3, 0xDD, 0xF7, 0x11, 0xA8, 0x9B, 0x0D,
-    0xC6, 0x49, 0x00, 0x2A, 0xBB, 0xCF, 0x8C, 0xF0, 0x06, 0xC2, 0x46, 0x88, 0xFD, 0xFD, 0x70, 0x6D,
-    0xCF, 0x80, 0xBC, 0x38, 0x38, 0xEF, 0x07, 0xB2, 0xF1, 0x0A, 0xBF, 0x91, 0x2C, 0x66, 0x70, 0xF8,
-    0x0B, 0xE4, 0xB1, 0xC3, 0x2D, 0xF8, 0x87, 0x70, 0x2C, 0x03, 0xC3, 0x44, 0x24, 0x6F, 0x30, 0x30,
-    0x6C, 0x02, 0xF2, 0x10, 0xE1, 0x76, 0x05, 0xC8, 0x83, 0x73, 0x18, 0xBE, 0xFF, 0xBF, 0x8F, 0xE0,
-    0x08, 0xFC, 0xF4, 0x67, 0x40, 0xE2, 0x31, 0x02, 0x00, 0x9F, 0x9E, 0x6F, 0x70, 0x78, 0x9C, 0x53,
-    0xB8, 0x7D, 0x17, 0x0E, 0xCE, 0xB2, 0x3C, 0xF8, 0x8F, 0x04, 0xF4, 0x3F, 0x20, 0xF3, 0xE2, 0x37,
-    0x20, 0xF3, 0xE4, 0x18, 0xDA, 0x3A, 0xE0, 0xA0, 0x82, 0x91, 0x81, 0x06, 0xC0, 0xE0, 0xCD, 0x3B,
-    0x38, 0xB8, 0xC7, 0x86, 0xE2, 0x32, 0x7B, 0x14, 0x97, 0xF9, 0x4F, 0x40, 0xE6, 0xF1, 0x32, 0x94,
-    0x96, 0xC3, 0x41, 0x3A, 0x03, 0x00, 0x3E, 0x00, 0x6F, 0x6B, 0x78, 0x9C, 0x2B, 0x38, 0xC7, 0xC2,
-    0x80, 0x00, 0x9F, 0xFF, 0xEF, 0x67, 0x42, 0xF0, 0xBE, 0xFE, 0xFF, 0xDF, 0x8F, 0xE0, 0x3D, 0xFC,
-    0xFF, 0xFF, 0x7F, 0x1E, 0x9C, 0x27, 0xF0, 0x0B, 0xC8, 0xF5, 0x85, 0x73, 0x0D, 0xFE, 0x00, 0xB9,
-    0xDA, 0x70, 0x6E, 0xC0, 0x3F, 0x20, 0x97, 0x03, 0xCE, 0x6D, 0x00, 0xF2, 0xDE, 0xB3, 0xC1, 0xB9,
-    0x0B, 0x81, 0xDC, 0xFB, 0x08, 0x6B, 0x0F, 0x03, 0xB9, 0x48, 0xD6, 0x3E, 0xFD, 0x8F, 0x62, 0xED,
-    0x0F, 0x4C, 0x6B, 0x75, 0x51, 0xAC, 0xBD, 0x8F, 0x50, 0x3B, 0x01, 0x28, 0x09, 0xE7, 0x28, 0xFC,
-    0x46, 0x92, 0x13, 0xF8, 0x09, 0x94, 0xB2, 0x85, 0xF1, 0xBE, 0x03, 0x39, 0x75, 0x28, 0xF6, 0x31,
-    0x42, 0x39, 0x47, 0x80, 0x9C, 0xF5, 0x30, 0xB7, 0x6C, 0x02, 0x72, 0xCE, 0x33, 0x43, 0x39, 0x13,
-    0x41, 0x7E, 0x60, 0x85, 0x72, 0x0A, 0x80, 0x9C, 0xFF, 0xEC, 0xC8, 0x9E, 0x95, 0x84, 0xB9, 0xE8,
-    0x2F, 0x72, 0x40, 0x7C, 0x46, 0x09, 0xA4, 0xEF, 0xC8, 0x3E, 0x61, 0xF8, 0x84, 0xEC, 0x4B, 0x06,
-    0x83, 0x2E, 0x46, 0x24, 0x1E, 0x00, 0x24, 0xF2, 0x71, 0x6C, 0x78, 0x9C, 0x95, 0x91, 0x29, 0x0E,
-    0xC2, 0x50, 0x14, 0x45, 0x1F, 0x0D, 0x0D, 0x21, 0x4C, 0xD5, 0x18, 0x2A, 0xD1, 0x78, 0x48, 0x77,
-    0x42, 0x97, 0x80, 0xC2, 0xD2, 0x1D, 0x20, 0x10, 0x08, 0x56, 0x80, 0x20, 0x6C, 0x01, 0x4B, 0x82,
-    0x20, 0x6C, 0xA0, 0x41, 0x23, 0x08, 0x65, 0x0A, 0x49, 0xF9, 0x97, 0x3F, 0xB4, 0xEF, 0x17, 0x81,
-    0xE0, 0x9A, 0xDE, 0x93, 0xBC, 0xE1, 0xBE, 0x5F, 0xA2, 0x6F, 0x05, 0x5B, 0x60, 0xE5, 0x1A, 0x1F,
-    0xBE, 0x21, 0x75, 0xAE, 0x28, 0xEF, 0xA7, 0xD0, 0x8A, 0x1D, 0x09, 0x37, 0x64, 0x1A, 0xC8, 0x06,
-    0x55, 0xB2, 0x58, 0x0A, 0xF9, 0x71, 0xE8, 0x22, 0x0B, 0x64, 0x73, 0x20, 0x8B, 0x1B, 0xF4, 0x00,
-    0x74, 0x6B, 0x04, 0x4C, 0x28, 0xC1, 0xD0, 0x0C, 0x7D, 0xE1, 0x4C, 0xC1, 0xAE, 0x6C, 0x60, 0x0F,
-    0xB8, 0xBC, 0x3A, 0x04, 0xAA, 0x0C, 0x9E, 0x9A, 0xC0, 0x12, 0x68, 0x59, 0x48, 0x7F, 0x82, 0x40,
-    0x93, 0xBD, 0x0F, 0xD4, 0x18, 0xA2, 0x2C, 0x8A, 0x56, 0xA2, 0x92, 0xDA, 0xFE, 0x35, 0xFB, 0x03,
-    0xD0, 0xC9, 0xFD, 0x0C, 0x1C, 0x6D, 0x7E, 0x82, 0xBA, 0x40, 0x6B, 0xA3, 0xCF, 0x76, 0x79, 0x10,
-    0xD0, 0xB6, 0x53, 0xE3, 0xAE, 0x5D, 0x31, 0x2D, 0x15, 0xF6, 0x4D, 0xE8, 0x5F, 0xB8, 0xE4, 0xCF,
-    0x65, 0xD2, 0xD7, 0x2D, 0x50, 0x8F, 0xFE, 0x96, 0x37, 0xB6, 0xAF, 0x4C, 0xC7, 0xC2, 0xC5, 0x74,
-    0x07, 0x2C, 0x3C, 0x01, 0x9B, 0xFA, 0x51, 0x84, 0xAB, 0xFC, 0x69, 0xAC, 0x91, 0xE8, 0x1B, 0xF3,
-    0x01, 0x8B, 0x9D, 0x8C, 0xCC, 0x78, 0x9C, 0x6D, 0x54, 0x3D, 0x68, 0x53, 0x51, 0x14, 0xBE, 0x31,
-    0x26, 0xAD, 0x5A, 0x35, 0x08, 0x0A, 0x45, 0xC4, 0x37, 0x08, 0x22, 0x28, 0xC6, 0xC1, 0xB9, 0x45,
-    0x70, 0x70, 0xB1, 0x0A, 0xB5, 0xD0, 0xC9, 0x8A, 0xA0, 0xA3, 0xD1, 0xC1, 0x41, 0x0A, 0x51, 0x8A,
-    0xAB, 0x7D, 0xE0, 0x24, 0x0E, 0x09, 0x38, 0xB8, 0x08, 0x51, 0x97, 0x0E, 0x0E, 0x6D, 0x5D, 0x3B,
-    0x24, 0xAB, 0xD3, 0xB3, 0xBB, 0xF0, 0x8C, 0xAD, 0x69, 0xD2, 0xF4, 0xBD, 0xCF, 0xF3, 0x73, 0xEF,
-    0xCB, 0xCB, 0x7B, 0x1E, 0x48, 0xEE, 0xB9, 0xF7, 0xCB, 0x39, 0xE7, 0x3B, 0xDF, 0x3D, 0x37, 0xC6,
-    0xA4, 0xEC, 0xDA, 0xFC, 0xA3, 0x85, 0x0B, 0x26, 0x67, 0x95, 0xD7, 0xBF, 0xC0, 0x16, 0xDC, 0xCA,
-    0x00, 0x0F, 0x0E, 0xE0, 0xEC, 0x4D, 0x21, 0x0D, 0x7C, 0x40, 0xCA, 0x56, 0x53, 0xC0, 0x57, 0xDA,
-    0x87, 0x2F, 0xAE, 0xD3, 0x8F, 0x6F, 0xAC, 0x91, 0x7B, 0x25, 0x01, 0x7C, 0xDA, 0x2D, 0x1F, 0xB2,
-    0x9B, 0xA5, 0x08, 0x38, 0x6C, 0xFD, 0x2A, 0xF9, 0x97, 0x46, 0x09, 0x96, 0x80, 0x39, 0xEB, 0xF6,
-    0x80, 0xE9, 0x74, 0xD1, 0x4D, 0xA0, 0xE8, 0x72, 0x5D, 0x1E, 0x27, 0x3A, 0xC4, 0x71, 0x59, 0x07,
-    0x63, 0x64, 0xD8, 0x36, 0xF4, 0xC4, 0x1F, 0x15, 0x4C, 0xBA, 0x8E, 0x51, 0x90, 0x2A, 0x33, 0x26,
-    0x6B, 0x3D, 0x4C, 0x12, 0x31, 0x57, 0xCE, 0xFB, 0xF8, 0x6D, 0x91, 0x7E, 0x7E, 0x8F, 0xFD, 0x0E,
-    0x4E, 0xF0, 0xD7, 0x7D, 0xA5, 0xCE, 0xF2, 0xDC, 0x36, 0xDB, 0x98, 0xA2, 0x4D, 0x8D, 0xF3, 0xF4,
-    0x39, 0xD0, 0xF0, 0xCA, 0x56, 0xEE, 0xE1, 0x24, 0xC7, 0xA3, 0x4E, 0x9F, 0x40, 0x80, 0xCF, 0x2A,
-    0xD9, 0x4C, 0x9F, 0xF3, 0x18, 0x13, 0xB7, 0x4C, 0xD3, 0xD6, 0x1F, 0x22, 0xBC, 0x68, 0xEE, 0x46,
-    0xED, 0x21, 0x8E, 0xC9, 0xB6, 0x6D, 0xFE, 0xA8, 0xD7, 0x04, 0xCE, 0x5A, 0x01, 0x8F, 0x48, 0x8F,
-    0x21, 0xB5, 0x59, 0x54, 0x9A, 0x0D, 0x09, 0x25, 0x1A, 0x65, 0xED, 0xDE, 0xC4, 0x6D, 0x69, 0x0D,
-    0x1A, 0x6A, 0x76, 0x6D, 0xDB, 0x03, 0xCC, 0x2A, 0xE7, 0x26, 0x42, 0xBD, 0xC8, 0xDF, 0x90, 0xEE,
-    0x29, 0x9B, 0x2F, 0x24, 0xA9, 0xDA, 0x13, 0x6D, 0xFE, 0x27, 0xA0, 0x84, 0xDA, 0x1D, 0xCD, 0x32,
-    0x50, 0xAE, 0x1C, 0x23, 0xD9, 0x4D, 0xD4, 0xEA, 0x6A, 0x9F, 0xB0, 0xED, 0x9A, 0x2E, 0x5A, 0xB2,
-    0x62, 0x75, 0x47, 0x0A, 0xDE, 0x01, 0xEC, 0x5D, 0xEF, 0x50, 0xF3, 0x2C, 0x15, 0xE6, 0x7A, 0x72,
-    0xE4, 0x23, 0x4C, 0x44, 0x16, 0x46, 0x35, 0x9C, 0xDF, 0x83, 0xDE, 0x54, 0xCB, 0x22, 0xFB, 0xB8,
-    0xAA, 0x07, 0x53, 0x83, 0x50, 0xEB, 0xBA, 0x5B, 0x85, 0xE3, 0x5A, 0xDE, 0x0F, 0x14, 0xA9, 0x2B,
-    0x50, 0x83, 0x4E, 0x40, 0x1F, 0x85, 0x0C, 0xD2, 0x05, 0x8E, 0x8A, 0x24, 0x0D, 0xE3, 0x10, 0x9B,
-    0x6D, 0xA8, 0xF4, 0x7D, 0xAA, 0xA6, 0x75, 0x3A, 0xB6, 0x3F, 0x96, 0xBA, 0x24, 0xDC, 0x27, 0x29,
-    0xA1, 0x3D, 0x29, 0xAA, 0x14, 0x22, 0x68, 0x25, 0x0E, 0x98, 0x3F, 0xF7, 0xE3, 0x01, 0xE7, 0x68,
-    0xF9, 0x8E, 0x86, 0xC4, 0x6C, 0xF2, 0x6D, 0xEE, 0x4A, 0x34, 0xB5, 0x11, 0x96, 0xCC, 0x5B, 0x60,
-    0x01, 0x34, 0x20, 0xB3, 0x11, 0x1F, 0x76, 0xF5, 0x0A, 0xB7, 0x75, 0x0A, 0xEA, 0x74, 0x4F, 0xE1,
-    0xBB, 0x48, 0x84, 0xEF, 0x28, 0x7F, 0x2F, 0x16, 0xA4, 0x64, 0xF6, 0x78, 0x09, 0x59, 0xCB, 0x97,
-    0x76, 0x40, 0xBE, 0xF0, 0xC9, 0xB4, 0xB4, 0x6A, 0x1F, 0x46, 0xD5, 0x29, 0xB6, 0xB2, 0xF5, 0xFE,
-    0x34, 0xAF, 0xCF, 0xB6, 0x3E, 0x9D, 0xD1, 0x93, 0x03, 0xA7, 0x7F, 0xCE, 0xFE, 0xDA, 0xD1, 0xC8,
-    0x5B, 0xC7, 0x49, 0x96, 0xB3, 0x6A, 0xFE, 0xF5, 0x38, 0xEB, 0x27, 0xCF, 0x35, 0x6B, 0x1B, 0x76,
-    0x2A, 0xAD, 0x3D, 0x9D, 0x48, 0xDC, 0x4A, 0x84, 0xF5, 0x11, 0xBD, 0x57, 0x6E, 0xF0, 0xD8, 0xE8,
-    0x8D, 0x37, 0x8A, 0xD6, 0x27, 0xE9, 0x52, 0x08, 0x6B, 0x1F, 0x2C, 0x9E, 0xA2, 0xE8, 0x87, 0x3F,
-    0x48, 0x80, 0x89, 0x14, 0x52, 0x1D, 0xFD, 0x4D, 0x21, 0x4C, 0x03, 0x34, 0x88, 0x09, 0xB4, 0x5E,
-    0xCA, 0xF0, 0xF3, 0xD6, 0x14, 0x58, 0xFE, 0x8F, 0x52, 0xDE, 0xFC, 0xF3, 0xC7, 0x37, 0xC7, 0xCE,
-    0xFF, 0x01, 0xE7, 0x98, 0x98, 0x7D, 0x78, 0x9C, 0x75, 0x92, 0xCB, 0x55, 0x02, 0x41, 0x10, 0x45,
-    0x5B, 0xFC, 0xA3, 0x8E, 0xB8, 0x70, 0xAD, 0x19, 0x60, 0x06, 0x98, 0x81, 0x46, 0xA0, 0x64, 0x30,
-    0xEC, 0x5C, 0xB8, 0x90, 0x0C, 0x34, 0x03, 0xCD, 0x40, 0x32, 0xD0, 0x0C, 0x20, 0x03, 0x3F, 0x09,
-    0x28, 0x88, 0xC0, 0xA0, 0x70, 0xED, 0xEA, 0xE9, 0x9E, 0xA9, 0x9E, 0x73, 0xAC, 0x4D, 0xCD, 0xB9,
-    0xDD, 0xF3, 0xBA, 0xEA, 0x55, 0x19, 0xF3, 0x5F, 0xCC, 0x2F, 0x2A, 0xA0, 0x0D, 0x2B, 0x31, 0x19,
-    0xC0, 0x66, 0x4C, 0xC6, 0xB0, 0x57, 0x91, 0x81, 0xB3, 0x08, 0x34, 0x80, 0xA7, 0x88, 0x74, 0x2C,
-    0xA1, 0xA6, 0xC9, 0xAB, 0x90, 0xAD, 0x58, 0x38, 0x85, 0x44, 0x93, 0x1F, 0x92, 0x39, 0x97, 0x0A,
-    0x1C, 0xDB, 0x5F, 0xBE, 0xE8, 0x2B, 0xD2, 0xB5, 0x15, 0xDB, 0x1A, 0x57, 0xB5, 0xF0, 0xA3, 0xF4,
-    0xB1, 0x5D, 0x92, 0x6F, 0x29, 0x0F, 0xF6, 0x4B, 0xF2, 0x2B, 0x2D, 0x64, 0xA4, 0x05, 0x38, 0x71,
-    0x6D, 0x8E, 0x78, 0x29, 0xC8, 0x9D, 0xB3, 0xA2, 0x07, 0x6B, 0x81, 0x7C, 0x5A, 0x61, 0x63, 0xCE,
-    0xA1, 0x1E, 0xC8, 0x84, 0x96, 0xA4, 0x25, 0x47, 0x81, 0x2C, 0xD8, 0x95, 0x34, 0xE5, 0xB6, 0x14,
-    0xDE, 0x90, 0x3C, 0xE4, 0xC3, 0x93, 0x07, 0x08, 0x79, 0x3D, 0x27, 0x43, 0xEE, 0xC3, 0xDD, 0x9D,
-    0x9C, 0x4C, 0x69, 0x06, 0x3D, 0xFF, 0xB1, 0x0C, 0x47, 0x13, 0x7F, 0xF9, 0x14, 0xAE, 0xAF, 0x5C,
-    0xCC, 0xBC, 0x60, 0x0F, 0x15, 0xEE, 0xD1, 0x91, 0x26, 0xAE, 0xB0, 0x99, 0x26, 0xBE, 0x78, 0x15,
-    0xBE, 0xC1, 0xC3, 0x03, 0x1F, 0x6F, 0xCE, 0x84, 0x67, 0x65, 0x4B, 0xD7, 0x1B, 0x75, 0x53, 0x90,
-    0x06, 0xB9, 0x99, 0x85, 0x07, 0xB2, 0x10, 0xCE, 0xF0, 0x7A, 0x49, 0xC6, 0x76, 0x1F, 0xDA, 0xD1,
-    0x98, 0xEC, 0xD0, 0x6A, 0x03, 0x25, 0xEC, 0x96, 0xCF, 0x0E, 0x37, 0x55, 0xC4, 0x6A, 0x24, 0x99,
-    0x9E, 0x9B, 0xBC, 0xD3, 0xCA, 0xF4, 0x6C, 0xA5, 0x96, 0xE6, 0x7B, 0x3F, 0xDA, 0xDA, 0x8E, 0xDD,
-    0xAB, 0xCA, 0x1A, 0x1B, 0xF3, 0x07, 0x5A, 0x2B, 0xDA, 0x79, 0x78, 0x9C, 0x65, 0x92, 0xB1, 0x0E,
-    0xC1, 0x50, 0x14, 0x86, 0x6F, 0x55, 0x6B, 0xB3, 0x19, 0x2C, 0xD2, 0x78, 0x01, 0x1E, 0xA1, 0x4F,
-    0xC0, 0x60, 0x32, 0x79, 0x94, 0x1A, 0x6D, 0xFA, 0x00, 0x12, 0xDE, 0xA0, 0x56, 0x89, 0xA1, 0x76,
-    0x89, 0xD5, 0x22, 0x35, 0x98, 0x2C, 0x15, 0x09, 0x42, 0xE8, 0x71, 0x4E, 0x5B, 0x7A, 0xEE, 0xE9,
-    0xBF, 0x7D, 0x37, 0xF7, 0xFE, 0xE7, 0x3F, 0x7F, 0xAE, 0x7F, 0xC8, 0xB5, 0x1E, 0x1A, 0x0A, 0xF5,
-    0x84, 0xBF, 0x02, 0x3A, 0xF8, 0x14, 0x0C, 0x3D, 0xC1, 0x60, 0x12, 0x47, 0xDB, 0x54, 0x09, 0x72,
-    0x9D, 0xB8, 0xA3, 0x52, 0x39, 0xE8, 0xE4, 0x31, 0x56, 0x2E, 0x40, 0xC4, 0x59, 0x3D, 0x00, 0x0C,
-    0xCE, 0x17, 0x32, 0x64, 0x1C, 0x02, 0x58, 0x9C, 0x17, 0x65, 0xAE, 0x8A, 0xFB, 0x15, 0xDD, 0x4F,
-    0xCE, 0xD3, 0xF2, 0x74, 0xF5, 0xBC, 0xEA, 0x9E, 0xEF, 0x33, 0x9F, 0xA4, 0x3A, 0x97, 0xF6, 0x95,
-    0x7D, 0xEC, 0x2C, 0xD1, 0x47, 0x64, 0x8A, 0x7E, 0x46, 0xC4, 0xFD, 0x76, 0xAA, 0xC1, 0x1E, 0x44,
-    0xDE, 0x13, 0x40, 0x8B, 0xB3, 0x93, 0xC0, 0x94, 0xB3, 0xBA, 0x41, 0xAC, 0xF1, 0x11, 0x13, 0x72,
-    0x5E, 0x62, 0x21, 0x9C, 0x7D, 0x80, 0x1A, 0xE7, 0xB1, 0x60, 0x2C, 0xCC, 0xE6, 0x1C, 0x8A, 0xF7,
-    0x57, 0x2C, 0x90, 0xF3, 0x4B, 0x9F, 0x8F, 0x76, 0x3C, 0x9F, 0xFB, 0xCE, 0xF2, 0x07, 0x59, 0x5F,
-    0x2B, 0xFA, 0x00, 0x96, 0xBE, 0xBF, 0x27, 0xFA, 0xB0, 0xC9, 0xB3, 0x50, 0x13, 0x5D, 0x36, 0x3F,
-    0x88, 0x67, 0x0D, 0x72, 0xFD, 0x02, 0xFB, 0x98, 0x33, 0x39, 0x78, 0x9C, 0x95, 0x92, 0x3D, 0x2F,
-    0x04, 0x41, 0x18, 0xC7, 0xE7, 0xEE, 0x70, 0x27, 0x12, 0x51, 0x6A, 0xC4, 0x4A, 0x4E, 0x7F, 0x3E,
-    0x81, 0x93, 0x68, 0xBD, 0x34, 0x3A, 0x09, 0xA5, 0x9C, 0x46, 0x23, 0xD1, 0x11, 0x12, 0x2D, 0x8D,
-    0x44, 0xC7, 0x27, 0x20, 0x3E, 0xC1, 0xB6, 0x4A, 0x95, 0x84, 0x06, 0x85, 0x7A, 0x38, 0x36, 0xE2,
-    0x6D, 0x7E, 0x9E, 0x99, 0xBD, 0xB5, 0xFB, 0xAC, 0xCA, 0x3F, 0x99, 0xCC, 0xFE, 0x7F, 0x33, 0xF3,
-    0xBC, 0xCC, 0xAC, 0x31, 0x3D, 0x4D, 0xCD, 0x36, 0x4D, 0x41, 0x7B, 0x5F, 0x80, 0xED, 0x54, 0x32,
-    0x7F, 0x4D, 0xAA, 0xB8, 0x96, 0xFA, 0x47, 0x32, 0xC5, 0x55, 0xEF, 0x2F, 0xC8, 0xB5, 0x20, 0xBE,
-    0xE5, 0xFC, 0xD2, 0xDA, 0xD2, 0xE6, 0x8D, 0xCC, 0xE7, 0x02, 0x5E, 0x65, 0x5E, 0x0E, 0x47, 0x77,
-    0x1D, 0x07, 0xB2, 0x41, 0xFC, 0x5C, 0x2F, 0xF8, 0x86, 0x1B, 0x33, 0xE6, 0x01, 0x4E, 0x7E, 0xD3,
-    0x47, 0x32, 0xA4, 0x82, 0x7A, 0xB1, 0xA4, 0x55, 0xFC, 0xB9, 0x82, 0xEE, 0x61, 0x48, 0x81, 0x37,
-    0xA8, 0x28, 0xE0, 0xD8, 0x56, 0xBE, 0x0D, 0xE3, 0x0A, 0x1C, 0xC2, 0xA0, 0x02, 0x57, 0xD0, 0xA7,
-    0xC0, 0x53, 0x39, 0x66, 0x17, 0xAB, 0xBC, 0x74, 0x16, 0x6B, 0x90, 0x84, 0x86, 0xFF, 0x05, 0xFE,
-    0xC4, 0x78, 0xE1, 0x4E, 0x83, 0x67, 0xD0, 0x40, 0xBA, 0xAF, 0x29, 0x70, 0x0A, 0x0D, 0x05, 0x16,
-    0x61, 0x58, 0x81, 0x11, 0x58, 0xD1, 0x41, 0xDE, 0xCB, 0x69, 0xBA, 0xA5, 0x4B, 0xF7, 0x37, 0x34,
-    0xAD, 0x83, 0x38, 0x6C, 0x55, 0x91, 0x04, 0xE6, 0x15, 0xD8, 0x21, 0x2F, 0x25, 0xBA, 0x6D, 0x84,
-    0x3C, 0xD8, 0x81, 0xE0, 0x5B, 0x1F, 0xE1, 0x4D, 0xFC, 0x16, 0xD6, 0x9B, 0x66, 0xE2, 0xE8, 0x9B,
-    0xB4, 0xF7, 0xA4, 0xF0, 0x07, 0x85, 0x57, 0x8B, 0x3E, 0x73, 0x90, 0xD6, 0xD4, 0xCE, 0x88, 0x1D,
-    0xCD, 0xA2, 0x5F, 0x06, 0x7F, 0xD6, 0x9F, 0x27, 0x9F, 0xD9, 0x3F, 0xDE, 0x9A, 0xF4, 0x1F, 0x3F,
-    0x97, 0x4C, 0xC6, 0x2B, 0x78, 0x9C, 0x95, 0xD2, 0x3D, 0x4E, 0x42, 0x41, 0x18, 0x85, 0xE1, 0xB9,
-    0x80, 0x12, 0x03, 0x82, 0x3B, 0x80, 0x1D, 0xB8, 0x15, 0x4B, 0x3A, 0xE3, 0x0A, 0x70, 0x09, 0x94,
-    0x24, 0x14, 0x90, 0xD0, 0xD8, 0xD1, 0x13, 0x93, 0x9B, 0x50, 0xDA, 0x28, 0x2B, 0x80, 0xDA, 0x84,
-    0xE0, 0x0E, 0x00, 0xD1, 0x80, 0xFC, 0xE4, 0x65, 0x66, 0x2E, 0x0A, 0x67, 0x6E, 0xE5, 0xE9, 0xE6,
-    0xC9, 0xCC, 0x37, 0x7F, 0x5F, 0x67, 0x72, 0xCC, 0x73, 0x2D, 0x32, 0x3E, 0x3F, 0xFC, 0x25, 0xCE,
-    0x7A, 0xD9, 0x9F, 0x84, 0xD7, 0x4C, 0x28, 0xDC, 0x27, 0x12, 0xF7, 0x5D, 0x5E, 0x76, 0x8E, 0x2E,
-    0xBD, 0x94, 0x93, 0x82, 0xA6, 0x7B, 0x9C, 0x74, 0x12, 0x33, 0xB0, 0x94, 0x11, 0x31, 0x6B, 0x28,
-    0xAA, 0x34, 0xA0, 0xAE, 0x62, 0xB6, 0xCC, 0x02, 0xF9, 0x84, 0x0B, 0x95, 0x0E, 0x14, 0x54, 0xAA,
-    0x50, 0x51, 0x31, 0x3B, 0x7B, 0x22, 0x95, 0x35, 0xBD, 0x40, 0xBE, 0x18, 0x05, 0xB2, 0x80, 0x40,
-    0xE6, 0x10, 0xA9, 0x8C, 0xED, 0xCD, 0x54, 0xDE, 0x20, 0xFB, 0x7F, 0x49, 0xD7, 0xF9, 0x48, 0xED,
-    0x95, 0x3E, 0xCF, 0x92, 0x69, 0x20, 0x2B, 0xE2, 0x40, 0xB6, 0xF6, 0x59, 0x45, 0x6E, 0xE0, 0x56,
-    0xE5, 0x11, 0xAE, 0x55, 0xEC, 0xE6, 0x79, 0x15, 0xDB, 0x28, 0x91, 0xC8, 0x1D, 0xB4, 0xF5, 0x77,
-    0xBE, 0xA1, 0x24, 0x62, 0xBF, 0x94, 0xDC, 0xB9, 0x3C, 0xEC, 0xFD, 0x22, 0x2B, 0xED, 0xA6, 0xCB,
-    0xD3, 0xBB, 0xEB, 0x9F, 0x2B, 0x13, 0xF4, 0x98, 0x9B, 0x22, 0x32, 0xCB, 0x39, 0xD9, 0x9C, 0x41,
-    0xDE, 0xD7, 0x1B, 0xFE, 0x8E, 0xA7, 0xAD, 0xA4, 0x79, 0xCD, 0x01, 0x99, 0x42, 0x0D, 0x98, 0x78,
-    0x9C, 0x9B, 0x70, 0x17, 0x0E, 0xCE, 0xB2, 0xFF, 0xFC, 0x8F, 0x00, 0xF9, 0x7F, 0x91, 0x38, 0xF3,
-    0x91, 0x39, 0xF1, 0x7F, 0xFF, 0xAF, 0x5F, 0x05, 0x03, 0x2C, 0x7F, 0xFF, 0xF3, 0x33, 0xC0, 0xC1,
-    0xA0, 0xE3, 0xD8, 0x1B, 0x43, 0x80, 0x30, 0x88, 0x03, 0x07, 0xAC, 0xC8, 0x1C, 0x3E, 0x9C, 0x1C,
-    0x36, 0x20, 0xC7, 0xDF, 0x05, 0x02, 0x44, 0x06, 0x87, 0x7F, 0x88, 0xE4, 0xF4, 0x77, 0xC0, 0x00,
-    0x13, 0x72, 0xCC, 0xD9, 0xA3, 0xC4, 0xE9, 0x2F, 0x24, 0x4E, 0xFD, 0x41, 0x24, 0x0E, 0x17, 0x00,
-    0x47, 0x11, 0xD7, 0x28, 0x78, 0x9C, 0x9B, 0x70, 0x17, 0x0E, 0xF6, 0xB2, 0xFC, 0xFC, 0x8F, 0x00,
-    0xFA, 0x7F, 0x91, 0x38, 0xFE, 0xC8, 0x1C, 0xB9, 0xBF, 0xFF, 0xD7, 0xAF, 0x82, 0x82, 0x59, 0x4C,
-    0x7F, 0xFF, 0xF3, 0x31, 0xC0, 0xC1, 0xA0, 0xE3, 0xE8, 0x2B, 0x41, 0x00, 0x13, 0x88, 0x03, 0x03,
-    0xF7, 0x19, 0x91, 0x38, 0xFF, 0x39, 0x91, 0x39, 0x5C, 0xC8, 0x1C, 0x66, 0x20, 0x27, 0x3F, 0x0D,
-    0x02, 0x44, 0x07, 0x87, 0x7F, 0xA8, 0xC9, 0xF9, 0xF5, 0x9F, 0x1B, 0xC1, 0x39, 0x78, 0x9E, 0x11,
-    0xC1, 0x01, 0x00, 0x06, 0x01, 0xA7, 0xCE, 0x78, 0x9C, 0x5D, 0xD2, 0xB9, 0x4B, 0x03, 0x41, 0x14,
-    0x06, 0xF0, 0x59, 0x0F, 0x08, 0x1E, 0x10, 0xC5, 0x3E, 0x58, 0x99, 0x32, 0x95, 0x8D, 0x82, 0x22,
-    0x62, 0x13, 0xC4, 0x14, 0x62, 0x25, 0xAC, 0x8D, 0x90, 0x46, 0xD2, 0x68, 0xAD, 0x90, 0x26, 0x56,
-    0xDA, 0x69, 0xA5, 0xA5, 0x65, 0x48, 0x61, 0x5A, 0xC5, 0x7F, 0x60, 0x53, 0x59, 0x6B, 0xC4, 0xDA,
-    0x90, 0xC3, 0x44, 0xE3, 0xE6, 0xF3, 0xCD, 0xB1, 0x33, 0xF3, 0xF2, 0x15, 0xBB, 0xB3, 0xBF, 0x3D,
-    0xDE, 0x9B, 0xC7, 0x0A, 0x61, 0xB2, 0x75, 0x7C, 0xB0, 0x24, 0xBC, 0x94, 0xFF, 0x40, 0x79, 0x5A,
-    0xB1, 0xF0, 0x0A, 0x93, 0x35, 0x03, 0x9F, 0xB0, 0x99, 0x51, 0x50, 0x73, 0x80, 0x73, 0x09, 0xB9,
-    0x11, 0xAD, 0xA2, 0xE2, 0xF6, 0xFE, 0x03, 0x2D, 0xEE, 0xA5, 0x74, 0x08, 0x4E, 0x02, 0x75, 0xEF,
-    0x07, 0x7B, 0xF2, 0x44, 0x50, 0x32, 0x1F, 0x4C, 0xDF, 0x4C, 0xD1, 0xF1, 0x9D, 0x5E, 0x09, 0xFC,
-    0x4E, 0xC4, 0x30, 0x29, 0x90, 0xA4, 0x40, 0x8D, 0x31, 0x10, 0x6F, 0xC0, 0x3C, 0x97, 0x6F, 0x60,
-    0x92, 0x4B, 0xAC, 0x5B, 0x70, 0xA1, 0xDA, 0x19, 0x2E, 0x17, 0xC0, 0x2C, 0x97, 0x67, 0x60, 0x9A,
-    0x4B, 0x0B, 0xE0, 0xED, 0x89, 0x36, 0xBE, 0x38, 0x88, 0x2E, 0xA2, 0x31, 0xE9, 0xA1, 0x9A, 0x2C,
-    0x17, 0x64, 0x02, 0x4F, 0x3E, 0xF4, 0xC8, 0x52, 0x4E, 0x62, 0x2D, 0x1B, 0x5D, 0xBB, 0xCF, 0x91,
-    0x96, 0xB0, 0x63, 0x6B, 0x0D, 0x8C, 0xB8, 0x7E, 0x0A, 0x15, 0x4A, 0x8C, 0xB0, 0xC1, 0x7B, 0xFE,
-    0x45, 0x78, 0xCD, 0x27, 0x48, 0xB2, 0xC9, 0xF7, 0x4E, 0x42, 0x25, 0xAE, 0xC6, 0xA4, 0x0F, 0x4C,
-    0x70, 0xA1, 0x39, 0xCF, 0x71, 0x39, 0x82, 0x3F, 0x56, 0x29, 0x82, 0xFE, 0x9C, 0x14, 0x97, 0x26,
-    0xDC, 0xF6, 0xB5, 0x50, 0x7D, 0xEC, 0x32, 0xA1, 0xA1, 0x01, 0x79, 0x0D, 0x8F, 0x50, 0x22, 0x1F,
-    0xC2, 0xDD, 0xEA, 0xE2, 0xF2, 0xE9, 0x50, 0x4E, 0x43, 0xDE, 0x79, 0xF1, 0xFE, 0x31, 0x53, 0xA5,
-    0xEF, 0x60, 0x5D, 0xBF, 0x9E, 0x1E, 0x24, 0x70, 0x68, 0xAB, 0xD6, 0xD5, 0x75, 0x94, 0xF5, 0xB6,
-    0x98, 0x3B, 0xBB, 0xBD, 0xDC, 0x51, 0xB3, 0xFB, 0x07, 0x65, 0x44, 0x01, 0x93, 0x78, 0x9C, 0x9B,
-    0xB0, 0x86, 0x91, 0x01, 0x0E, 0x04, 0x4E, 0x72, 0xFE, 0xFC, 0xCF, 0x8D, 0xE0, 0x6F, 0xF8, 0x3F,
-    0xFF, 0xEF, 0x7F, 0x7E, 0x04, 0xFF, 0xC3, 0xFF, 0xFB, 0x23, 0x8F, 0x8F, 0x02, 0xC8, 0xE0, 0xF7,
-    0x77, 0xC0, 0xC1, 0x8F, 0xC1, 0xE0, 0x9F, 0x81, 0xE5, 0xFF, 0xFA, 0xCF, 0x83, 0xE0, 0x1F, 0xF8,
-    0xBF, 0xFE, 0xE0, 0x79, 0x26, 0x04, 0x5F, 0xE1, 0x8F, 0x34, 0x00, 0xB3, 0xB5, 0xF2, 0xB6, 0x78,
-    0x9C, 0x9B, 0xB0, 0x86, 0xF1, 0xE7, 0x7F, 0xEE, 0xBF, 0xFF, 0xF9, 0xE9, 0x89, 0x7E, 0xFD, 0xE7,
-    0x39, 0x78, 0x9E, 0x09, 0x00, 0x09, 0x7D, 0x52, 0x6F, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x81, 0x85,
-    0x73, 0x18, 0x10, 0xE0, 0xCF, 0x7F, 0x2E, 0x04, 0xE7, 0xFF, 0x7F, 0x5E, 0x64, 0x0E, 0xDF, 0x28,
-    0x87, 0xCA, 0x1C, 0x44, 0xF0, 0x2A, 0xFC, 0xFF, 0xCF, 0x63, 0x90, 0x09, 0xE5, 0x24, 0xFC, 0xFF,
-    0xCF, 0xF9, 0xE5, 0x3F, 0x37, 0x84, 0x73, 0xE1, 0xFF, 0x7F, 0xD6, 0x9F, 0xFF, 0xF3, 0x21, 0x9C,
-    0xEF, 0xFF, 0xFF, 0x33, 0x7C, 0xFB, 0xFF, 0x9F, 0x05, 0xC4, 0x76, 0xF8, 0xFF, 0x7F, 0x3E, 0x48,
-    0x36, 0x1F, 0x2A, 0x21, 0xC7, 0x60, 0xF0, 0xFF, 0xFF, 0xFF, 0x5C, 0x21, 0xC3, 0xEB, 0x40, 0x8A,
-    0x95, 0x01, 0xA4, 0x0E, 0x02, 0xFA, 0x21, 0x46, 0x42, 0x00, 0x3B, 0x48, 0xF5, 0x65, 0x08, 0xDB,
-    0x17, 0x62, 0xE8, 0x35, 0x10, 0x3B, 0x07, 0xE6, 0x92, 0xA4, 0x19, 0x15, 0xA2, 0x60, 0x06, 0x00,
-    0xA9, 0x61, 0x7F, 0x7E, 0x78, 0x9C, 0x7D, 0xD2, 0xDD, 0x4D, 0x42, 0x41, 0x10, 0x86, 0xE1, 0x39,
-    0xA8, 0x04, 0xFC, 0xA5, 0x01, 0x0D, 0x15, 0x28, 0x1D, 0x68, 0x07, 0xD8, 0x81, 0x76, 0x20, 0x1D,
-    0x40, 0x07, 0xDA, 0x81, 0x14, 0x60, 0x02, 0x0D, 0x98, 0x48, 0x05, 0x68, 0x05, 0x26, 0x36, 0x70,
-    0x12, 0x15, 0xA3, 0x28, 0xBC, 0xCC, 0xEE, 0x72, 0x76, 0x26, 0x5C, 0x38, 0x77, 0x4F, 0x36, 0xD9,
-    0x9D, 0xF9, 0x66, 0xEF, 0x1E, 0x0A, 0xC9, 0xD5, 0x7B, 0x2C, 0x7E, 0xD8, 0x33, 0x2B, 0x16, 0x1C,
-    0x65, 0x0E, 0xE1, 0xD0, 0xFB, 0x17, 0x9A, 0xCE, 0x63, 0x18, 0x89, 0xF3, 0x9F, 0x1E, 0x3B, 0x4F,
-    0xE0, 0x56, 0xCC, 0x2D, 0x3D, 0x6E, 0x38, 0xBF, 0x40, 0x5F, 0xCC, 0xAD, 0x05, 0xD4, 0x9D, 0xDF,
-    0xE0, 0x4A, 0xCC, 0xED, 0x25, 0x6C, 0x3B, 0xEB, 0x71, 0x57, 0xCC, 0x9D, 0x25, 0xE5, 0x96, 0xF3,
-    0x07, 0x9C, 0x8A, 0xF9, 0x02, 0xCA, 0x9A, 0xF3, 0x27, 0x1C, 0x8B, 0xF9, 0x12, 0x28, 0x9C, 0x67,
-    0xC4, 0x56, 0x2B, 0x5F, 0x2B, 0xD7, 0xAF, 0x45, 0x7F, 0x05, 0x93, 0xEF, 0xEB, 0x6B, 0x0C, 0xDF,
-    0x70, 0x50, 0x59, 0xAB, 0x19, 0xA3, 0xC9, 0xBE, 0xCF, 0xD3, 0x25, 0xEB, 0xDD, 0xEF, 0x70, 0x5E,
-    0x39, 0xC4, 0xA0, 0x2D, 0x94, 0xC5, 0xDA, 0xF5, 0xB4, 0x0A, 0xF6, 0x93, 0x63, 0x0C, 0xF2, 0x14,
-    0xD3, 0x74, 0x79, 0x69, 0x20, 0x3B, 0xCE, 0x61, 0xE4, 0x33, 0xEF, 0x1E, 0xBC, 0x7A, 0xCB, 0x1C,
-    0x76, 0xBD, 0x9F, 0xE3, 0xCB, 0xE6, 0x36, 0x21, 0x62, 0xB7, 0x4F, 0x4D, 0xE9, 0xC4, 0x7B, 0x00,
-    0x53, 0xF9, 0xE7, 0x3F, 0x84, 0x95, 0x76, 0xBD, 0x3B, 0xDA, 0xF3, 0x3C, 0x8D, 0x91, 0x6A, 0xC6,
-    0xCD, 0x64, 0x5A, 0x33, 0x0F, 0xF4, 0xC3, 0x6C, 0xD4, 0x0A, 0x42, 0x11, 0xDF, 0xEC, 0x78, 0x9C,
-    0x9B, 0xB0, 0x86, 0x91, 0x01, 0x0E, 0x7E, 0xFE, 0xE7, 0x46, 0x70, 0xFE, 0xFE, 0xE7, 0x1F, 0xE5,
-    0x0C, 0x51, 0xCE, 0xFC, 0x99, 0x50, 0x90, 0x09, 0xE4, 0x20, 0x00, 0x17, 0x32, 0x87, 0xFF, 0x17,
-    0x12, 0x87, 0xF7, 0x20, 0x82, 0x7D, 0x9F, 0x19, 0x00, 0xC6, 0x70, 0x80, 0x15, 0x78, 0x9C, 0xCD,
-    0xD0, 0xBD, 0x0D, 0xC2, 0x40, 0x0C, 0x86, 0x61, 0x03, 0x52, 0xF8, 0x8D, 0x14, 0x5A, 0x2A, 0x06,
-    0x40, 0x62, 0x04, 0x46, 0xA2, 0xA7, 0x09, 0x1B, 0x90, 0x9E, 0x86, 0x05, 0x10, 0x6C, 0x80, 0xC4,
-    0x02, 0x19, 0x01, 0x2A, 0x24, 0xEA, 0xF0, 0x23, 0x44, 0xC2, 0x87, 0xEF, 0x2E, 0x39, 0x6C, 0x58,
-    0x00, 0x37, 0x27, 0x3D, 0xD6, 0x7B, 0x85, 0x57, 0xEB, 0x1A, 0xA9, 0x39, 0x0F, 0x1E, 0x08, 0x95,
-    0x24, 0x48, 0x0B, 0x2C, 0x14, 0x65, 0x40, 0x01, 0x34, 0x24, 0x15, 0x96, 0x42, 0xD5, 0x59, 0x8A,
-    0x75, 0x67, 0x08, 0x75, 0xD5, 0x59, 0xEA, 0xA9, 0xCE, 0x52, 0xAC, 0x3A, 0xA6, 0x5C, 0x94, 0x85,
-    0xA3, 0xD9, 0xA7, 0xE4, 0xEE, 0x64, 0xA8, 0x93, 0xFB, 0xF2, 0x82, 0xDD, 0xD1, 0x52, 0xE6, 0xCB,
-    0x17, 0xC6, 0x8E, 0xE6, 0x55, 0xC9, 0x5D, 0xE0, 0x88, 0x3F, 0x8D, 0xCB, 0x2E, 0xA5, 0x92, 0xAA,
-    0x92, 0xBB, 0x8A, 0x12, 0x57, 0xF2, 0xD3, 0xAC, 0x88, 0xD7, 0xD3, 0xB2, 0xF3, 0x74, 0xB1, 0xA5,
-    0xE9, 0x3C, 0xAD, 0x80, 0xAE, 0xEB, 0x3C, 0x45, 0xA6, 0xB4, 0x9D, 0x27, 0xBA, 0x02, 0xB5, 0x17,
-    0x26, 0x92, 0xB6, 0xC0, 0x12, 0x68, 0x49, 0x8A, 0xCC, 0x05, 0x0E, 0x24, 0x89, 0x6E, 0x4C, 0x13,
-    0x4D, 0x5C, 0xDA, 0x4E, 0xD0, 0xB0, 0xEC, 0x04, 0xD1, 0xDD, 0x75, 0x92, 0x12, 0x04, 0xDF, 0x44,
-    0x7D, 0xFA, 0x21, 0xFA, 0x37, 0x6A, 0x7F, 0xD3, 0xD3, 0x1C, 0x5C, 0xCC, 0x16, 0xE9, 0x7E, 0xA3,
-    0x84, 0xA2, 0x7C, 0xF4, 0x06, 0x6A, 0x96, 0x30, 0x09, 0x78, 0x9C, 0x5D, 0xD2, 0xCD, 0x4D, 0x02,
-    0x51, 0x14, 0x86, 0xE1, 0xC3, 0xE0, 0x38, 0x28, 0x98, 0x58, 0x81, 0xA1, 0x03, 0xE9, 0x82, 0xA5,
-    0x76, 0xA0, 0x1D, 0x60, 0x07, 0x34, 0x40, 0x32, 0xBA, 0x37, 0x01, 0x2A, 0x80, 0x0E, 0x2C, 0x01,
-    0x12, 0x0A, 0x30, 0xBA, 0x30, 0xEE, 0x48, 0x34, 0x6A, 0x1C, 0x66, 0xE6, 0xF5, 0x66, 0xC6, 0xF9,
-    0xF9, 0xEE, 0x59, 0xDD, 0x3C, 0xAB, 0x37, 0xF7, 0x9C, 0x87, 0xC7, 0x8E, 0x35, 0xB3, 0x9C, 0x59,
-    0x42, 0xBF, 0x05, 0x09, 0x61, 0xC6, 0xB4, 0x05, 0x29, 0x51, 0x06, 0xDD, 0x06, 0x32, 0x7A, 0x0E,
-    0x2E, 0x7C, 0x78, 0xF2, 0x81, 0x9E, 0x0F, 0x57, 0x3E, 0xEC, 0x3B, 0x02, 0xEF, 0x30, 0x10, 0x18,
-    0x43, 0x2C, 0x10, 0xFD, 0xC0, 0x91, 0xC0, 0xBA, 0x49, 0x29, 0xE1, 0x3C, 0x67, 0x23, 0x60, 0x9F,
-    0x75, 0xCA, 0x3F, 0xDC, 0xC1, 0x8D, 0x80, 0x1D, 0xD8, 0x07, 0x02, 0x2F, 0x55, 0x4A, 0x05, 0x23,
-    0x98, 0x0B, 0x98, 0x4B, 0x09, 0x05, 0x16, 0x70, 0x29, 0xE0, 0x5E, 0xCF, 0x0A, 0x2E, 0xE5, 0x44,
-    0xE0, 0xB6, 0x4C, 0x69, 0xC0, 0x2D, 0x80, 0x40, 0x60, 0x0B, 0x67, 0x02, 0x43, 0x58, 0x09, 0xD8,
-    0x37, 0x1C, 0x0B, 0x14, 0x29, 0x6D, 0x28, 0x52, 0x04, 0x3E, 0xE0, 0x54, 0xE0, 0x1A, 0x26, 0x02,
-    0xF6, 0x0B, 0xB9, 0x80, 0x4B, 0x41, 0x60, 0xE8, 0x83, 0x7D, 0xF9, 0x70, 0xEF, 0x83, 0xBB, 0x28,
-    0x0F, 0x5E, 0x21, 0x4A, 0xCB, 0xCF, 0xAC, 0x53, 0xC2, 0xDD, 0xDC, 0x5A, 0xF3, 0x16, 0xDB, 0x1F,
-    0x13, 0xAF, 0xFD, 0x6B, 0x78, 0x9C, 0x8D, 0x92, 0x2D, 0x4F, 0x03, 0x41, 0x10, 0x86, 0xA7, 0x94,
-    0xAF, 0x42, 0x20, 0x17, 0x0C, 0x41, 0x90, 0x1C, 0x09, 0x92, 0x84, 0x60, 0x11, 0x5C, 0x05, 0x18,
-    0x0C, 0x28, 0xC0, 0x10, 0x2E, 0x69, 0xD0, 0x04, 0x8D, 0x28, 0x12, 0x1C, 0x18, 0x2C, 0xFD, 0x07,
-    0xE5, 0x1F, 0x94, 0x7F, 0x50, 0x90, 0xA8, 0x43, 0x61, 0x4B, 0xBF, 0xF8, 0xB8, 0x6B, 0x79, 0x99,
-    0xB9, 0xBD, 0xDD, 0xDB, 0x0D, 0x15, 0xBC, 0xE6, 0x66, 0x9F, 0x9B, 0x9D, 0x7D, 0x77, 0x76, 0x88,
-    0x94, 0x36, 0x4E, 0x0F, 0x56, 0xC9, 0x51, 0xF9, 0x05, 0xAC, 0xC6, 0xA2, 0x85, 0xC2, 0x21, 0x94,
-    0x36, 0xF3, 0x2C, 0x8D, 0x80, 0x25, 0xCD, 0xBE, 0x0C, 0x42, 0xAB, 0xA8, 0xD0, 0x83, 0x2C, 0x2E,
-    0x76, 0xB6, 0xEF, 0x24, 0xFD, 0x44, 0xB1, 0x04, 0x88, 0x26, 0x25, 0xF0, 0xBF, 0x19, 0x4E, 0x48,
-    0x54, 0xE3, 0x60, 0x4A, 0xFD, 0xF5, 0x07, 0x40, 0x20, 0xC1, 0x07, 0xB0, 0xA5, 0x2B, 0xDF, 0x70,
-    0xC5, 0x02, 0x91, 0xC7, 0x9F, 0x31, 0xB2, 0x8E, 0x9B, 0x49, 0xB7, 0x06, 0xB9, 0x53, 0xB5, 0xEA,
-    0x98, 0x6A, 0xA9, 0x7E, 0xD0, 0x20, 0x8A, 0x11, 0xD9, 0xB7, 0xEC, 0x03, 0x45, 0x32, 0x96, 0x94,
-    0x1E, 0x81, 0xD2, 0x3E, 0x30, 0x6F, 0x33, 0x59, 0x73, 0xD1, 0x69, 0xA7, 0x45, 0x7C, 0xC8, 0x13,
-    0x30, 0xEE, 0xB0, 0x04, 0x67, 0xEF, 0x80, 0x83, 0xE8, 0x13, 0xF7, 0x5D, 0xF7, 0x58, 0xA2, 0x1E,
-    0x9A, 0x3D, 0xF1, 0x63, 0xAB, 0x83, 0xA8, 0x8F, 0xBA, 0xCB, 0xDA, 0x68, 0xFD, 0x97, 0x8D, 0xAA,
-    0x37, 0xEA, 0xDC, 0xF6, 0x5F, 0x7F, 0xF5, 0x57, 0xE9, 0x83, 0xAD, 0x18, 0xD5, 0x9A, 0xDB, 0x3E,
-    0x69, 0x60, 0x10, 0x02, 0x73, 0x36, 0x2A, 0x73, 0x5F, 0xF8, 0x39, 0xF6, 0x6C, 0xC6, 0x8F, 0x5D,
-    0xE2, 0xFD, 0x4D, 0x9B, 0x75, 0xA5, 0x7E, 0x37, 0x7B, 0xE6, 0x4C, 0x43, 0x49, 0xE1, 0xE4, 0xF5,
-    0x1C, 0x5D, 0xA6, 0xA5, 0x7C, 0x9E, 0x8C, 0x82, 0x61, 0x3C, 0x00, 0xB3, 0xA9, 0x49, 0x2C, 0x6B,
-    0x14, 0xAA, 0x39, 0x90, 0xCD, 0x2D, 0xDD, 0xFE, 0x38, 0x73, 0xE1, 0xF1, 0x88, 0x35, 0xD4, 0x5D,
-    0xDE, 0xCC, 0x38, 0x3D, 0x73, 0x14, 0x1D, 0x2D, 0xAC, 0x54, 0x38, 0x0B, 0x55, 0xB5, 0xC1, 0x4B,
-    0xF2, 0x39, 0x35, 0xBE, 0xC2, 0x1C, 0xAD, 0x19, 0x07, 0xB7, 0x1A, 0x1D, 0x5B, 0xEE, 0xCF, 0x07,
-    0xE9, 0x80, 0xEF, 0x3A, 0x1D, 0xA2, 0xCA, 0xD5, 0xF5, 0xA1, 0x1E, 0xCD, 0x5F, 0x44, 0xFE, 0x15,
-    0x1D, 0x78, 0x9C, 0xD5, 0xD0, 0x3F, 0x0E, 0x01, 0x41, 0x14, 0xC7, 0xF1, 0x97, 0x6D, 0xB0, 0x44,
-    0x34, 0x4A, 0xE1, 0x02, 0xE2, 0x00, 0x0E, 0x41, 0xAB, 0xDA, 0x23, 0xB8, 0x81, 0x5E, 0xA7, 0xD5,
-    0xD0, 0x2B, 0x44, 0xB6, 0x97, 0x4D, 0x1C, 0x43, 0xA2, 0x50, 0x68, 0x4D, 0xE5, 0xCF, 0x66, 0xAD,
-    0x9F, 0x37, 0xBB, 0x31, 0xEF, 0x4D, 0xE1, 0x00, 0xBE, 0xDD, 0xA7, 0x9A, 0xDF, 0x9B, 0xC5, 0xA9,
-    0x6C, 0x3F, 0x21, 0x2E, 0xC5, 0xB7, 0x19, 0x2B, 0x77, 0x42, 0xDF, 0x93, 0x09, 0x58, 0xDB, 0x8D,
-    0xED, 0xC8, 0xEC, 0xB0, 0xEA, 0x54, 0x14, 0x03, 0x6B, 0x11, 0x3D, 0x81, 0x40, 0xB4, 0x03, 0x6A,
-    0xA2, 0x1E, 0xD0, 0x14, 0x51, 0x86, 0x81, 0xD2, 0x03, 0x91, 0xD2, 0x0D, 0xD3, 0x9F, 0xBA, 0x7B,
-    0x4A, 0x31, 0x52, 0xCA, 0xD1, 0x15, 0x8D, 0x81, 0x86, 0xE8, 0x0C, 0x54, 0x9C, 0x5A, 0x2F, 0x18,
-    0x59, 0x7D, 0x01, 0x22, 0x96, 0xB9, 0xDA, 0xDE, 0x7C, 0x5F, 0xA8, 0x6F, 0x4F, 0xBC, 0x9F, 0xA8,
-    0x6A, 0x0D, 0x8B, 0x27, 0x57, 0x4B, 0xDB, 0xBC, 0x5D, 0x0E, 0x70, 0x5B, 0xFE, 0x4A, 0xA1, 0x52,
-    0x66, 0x8F, 0x74, 0x1D, 0x12, 0x05, 0xFA, 0x00, 0xB8, 0x26, 0xCA, 0xB8, 0x78, 0x9C, 0x95, 0x94,
-    0xBB, 0x4A, 0x43, 0x41, 0x10, 0x86, 0x37, 0x89, 0x26, 0x5E, 0x50, 0x82, 0x8D, 0x58, 0x08, 0x11,
-    0x2C, 0x04, 0x05, 0x49, 0xA9, 0x85, 0x39, 0x85, 0x36, 0x36, 0xC6, 0x46, 0xD2, 0x88, 0x81, 0x60,
-    0x1D, 0xAC, 0x2D, 0xF4, 0x05, 0x84, 0x88, 0x20, 0x5A, 0xC5, 0xDA, 0x42, 0x03, 0x3E, 0xC0, 0xF1,
-    0x09, 0x8C, 0x96, 0x56, 0xB1, 0x10, 0x1B, 0x91, 0xDC, 0x8C, 0x97, 0xDC, 0x7E, 0xE7, 0xEC, 0xED,
-    0xEC, 0x26, 0xA4, 0x70, 0x8A, 0x3D, 0xBB, 0x1F, 0xBB, 0x33, 0xFF, 0xEC, 0xCE, 0x1C, 0xC6, 0x84,
-    0xC5, 0xF7, 0x77, 0xE6, 0x59, 0xAF, 0x39, 0xCF, 0x20, 0x73, 0xA7, 0x6D, 0x9A, 0xEE, 0x40, 0xD8,
-    0xAA, 0xB5, 0x57, 0x51, 0x60, 0xC6, 0xC0, 0x3F, 0x9A, 0xA2, 0x1C, 0xD2, 0xB4, 0xE0, 0xAD, 0x0F,
-    0x37, 0xD6, 0xCF, 0xBD, 0x43, 0x7B, 0x1A, 0xB7, 0x80, 0x52, 0xD8, 0x9B, 0xC4, 0x7E, 0x89, 0x0F,
-    0x4B, 0x7A, 0x45, 0xF3, 0x88, 0x98, 0xC6, 0xDA, 0x40, 0x42, 0xE2, 0x2F, 0x60, 0x4D, 0x1D, 0xCC,
-    0x91, 0xF7, 0x00, 0x9F, 0x45, 0x69, 0x16, 0x34, 0xA3, 0x8F, 0x29, 0x1F, 0x09, 0x4D, 0xFD, 0x55,
-    0x4D, 0x7B, 0xE6, 0xD6, 0x85, 0xCB, 0xBF, 0x4D, 0x94, 0xCC, 0xD4, 0x1A, 0x00, 0x97, 0x6E, 0x4A,
-    0x25, 0xBB, 0x07, 0x46, 0xE9, 0x93, 0x04, 0x26, 0x4D, 0x2C, 0xD7, 0x14, 0x63, 0xC4, 0xC4, 0x4C,
-    0xC4, 0x7C, 0x04, 0x86, 0x2C, 0xDC, 0x42, 0x96, 0xC6, 0x0A, 0x60, 0x51, 0xF6, 0x8D, 0x3C, 0x8D,
-    0x75, 0x5B, 0x08, 0x63, 0x9F, 0x28, 0xF2, 0xD1, 0xB5, 0x71, 0x8D, 0xEF, 0x6B, 0xE0, 0xD6, 0xC6,
-    0x55, 0x94, 0xFF, 0x8D, 0x07, 0xF8, 0x1E, 0xA0, 0xA4, 0xDA, 0xAF, 0xDB, 0xF3, 0xFA, 0x22, 0x6F,
-    0x4C, 0x5B, 0x13, 0x47, 0x8C, 0xDF, 0x49, 0xC4, 0xC2, 0x5D, 0x7E, 0x27, 0x69, 0x60, 0xC2, 0xA4,
-    0x8E, 0xB8, 0x41, 0x7A, 0xCA, 0x2D, 0x13, 0x17, 0xC4, 0x7D, 0x93, 0xAF, 0xA2, 0x89, 0xEB, 0x32,
-    0x56, 0xDD, 0xAF, 0x18, 0xCF, 0x3A, 0x72, 0x17, 0x9D, 0x5A, 0xF6, 0xE9, 0xB1, 0xF2, 0x19, 0xA3,
-    0x52, 0x0B, 0x68, 0x4C, 0xB5, 0x34, 0xAE, 0xF4, 0x63, 0x56, 0xD1, 0xB4, 0xAE, 0x2A, 0xCF, 0x4B,
-    0x59, 0xBD, 0x5B, 0xD3, 0xD7, 0x15, 0xA5, 0xFA, 0x75, 0x45, 0xA6, 0x6F, 0x30, 0x92, 0x7B, 0xA2,
-    0x45, 0x29, 0x35, 0x35, 0x97, 0xA1, 0xBD, 0x3C, 0x73, 0xB9, 0xBD, 0xE5, 0x77, 0x83, 0x29, 0x36,
-    0xED, 0xD3, 0x25, 0x33, 0xB5, 0x53, 0x45, 0x77, 0x99, 0x65, 0x07, 0x6D, 0xDE, 0x4F, 0x9B, 0xAC,
-    0xC7, 0xA2, 0xD4, 0x36, 0x27, 0xA1, 0x5E, 0xEA, 0x90, 0x88, 0x95, 0x5E, 0xC8, 0xCE, 0xBA, 0xE4,
-    0xE2, 0x46, 0x8B, 0x70, 0x44, 0xD3, 0xE4, 0x64, 0xAB, 0x86, 0xA5, 0xC3, 0xB6, 0x10, 0x5F, 0x51,
-    0x2D, 0x2C, 0x32, 0x7C, 0x95, 0xAF, 0x4E, 0xB8, 0xFC, 0xC1, 0xF9, 0x02, 0xAD, 0xEE, 0xC0, 0x0B,
-    0xC8, 0x4B, 0x27, 0x1F, 0x64, 0xDB, 0x5C, 0xE3, 0xC3, 0xF5, 0x3B, 0x8D, 0x59, 0xE1, 0x2D, 0xCE,
-    0x03, 0xB5, 0x75, 0xAE, 0x61, 0x53, 0x4F, 0x52, 0xFD, 0x3F, 0x16, 0xFB, 0xD5, 0xCB, 0x00, 0xB6,
-    0x65, 0x2E, 0x2E, 0x53, 0x5C, 0xF4, 0x1F, 0xFA, 0xCC, 0x6A, 0x51, 0x78, 0x9C, 0x6D, 0xD1, 0x3D,
-    0x4E, 0x02, 0x41, 0x18, 0xC6, 0xF1, 0x81, 0x15, 0x09, 0x44, 0xC0, 0x1E, 0x12, 0xB9, 0x81, 0x9E,
-    0x40, 0x38, 0x0A, 0x37, 0x90, 0x8E, 0x84, 0x86, 0x23, 0xC0, 0x11, 0xB0, 0x33, 0x36, 0xEB, 0x0D,
-    0x28, 0xE8, 0x88, 0x66, 0xB9, 0x80, 0x59, 0x63, 0x4D, 0xB2, 0x20, 0x84, 0xF0, 0xFD, 0x67, 0x76,
-    0x21, 0xF0, 0xBE, 0x13, 0x9F, 0x6A, 0x7E, 0x93, 0xCC, 0xD7, 0x33, 0xBD, 0xEF, 0x73, 0xBE, 0xDA,
-    0x9E, 0xB1, 0x59, 0x73, 0x49, 0x70, 0x63, 0xBD, 0xBF, 0x1A, 0xDF, 0x31, 0x95, 0xD8, 0xFE, 0x7B,
-    0x92, 0x51, 0xBC, 0x22, 0x76, 0xC9, 0x9C, 0xD2, 0xB0, 0x13, 0x59, 0x61, 0xF3, 0x0B, 0x0F, 0xD2,
-    0x55, 0xE8, 0x48, 0xDB, 0xB3, 0x03, 0xE5, 0x3F, 0x50, 0x9E, 0x42, 0x4A, 0x7A, 0x0C, 0x69, 0xE9,
-    0x1F, 0xC7, 0x53, 0x67, 0xFD, 0x9C, 0x50, 0x79, 0x45, 0x57, 0xFA, 0x1E, 0x1E, 0xA5, 0xFB, 0x90,
-    0x93, 0x5E, 0x13, 0xA5, 0x84, 0x87, 0xF0, 0x1C, 0xBF, 0x37, 0xF8, 0x4C, 0x32, 0x81, 0x30, 0xAD,
-    0xFB, 0xC9, 0xE9, 0xBE, 0xA2, 0xDB, 0x7F, 0xFB, 0xEC, 0xB4, 0x92, 0xBC, 0x1D, 0x20, 0x2F, 0xFB,
-    0x6B, 0xC2, 0x8B, 0xB4, 0x59, 0x10, 0x29, 0xF7, 0x20, 0xE3, 0xF4, 0xA9, 0xEE, 0x6B, 0x0E, 0xDC,
-    0x29, 0xEF, 0x29, 0x38, 0x2E, 0x2A, 0xEF, 0xEC, 0x58, 0x7A, 0xAB, 0xFF, 0xCB, 0x16, 0x50, 0x53,
-    0x5E, 0xEA, 0xFE, 0xCC, 0x0C, 0x3C, 0xE9, 0x0F, 0xA8, 0x49, 0x3F, 0xC1, 0x60, 0x63, 0xEF, 0x24,
-    0x36, 0xF0, 0x5F, 0x43, 0xEF, 0xEA, 0xFA, 0xAE, 0x7C, 0x04, 0x5A, 0xB2, 0x01, 0xBB, 0x78, 0x9C,
-    0x5D, 0x91, 0x3D, 0x4B, 0xC3, 0x50, 0x14, 0x86, 0x4F, 0x63, 0x83, 0xDA, 0x3A, 0xC4, 0xC9, 0x4D,
-    0x5C, 0xBA, 0x38, 0xE9, 0x0F, 0x50, 0x44, 0x70, 0x72, 0x11, 0x9D, 0xA4, 0x58, 0x82, 0x83, 0x08,
-    0x0E, 0x76, 0xEF, 0x22, 0x38, 0x38, 0x89, 0x05, 0x27, 0x17, 0x1D, 0xFC, 0x01, 0xFA, 0x0F, 0x14,
-    0x3A, 0x38, 0x56, 0x74, 0xE9, 0xD6, 0xA1, 0x9B, 0x4B, 0x41, 0xB0, 0xD5, 0xD8, 0xF6, 0xF5, 0xDC,
-    0x73, 0x3F, 0xE3, 0xB3, 0xDC, 0x3C, 0x24, 0xE7, 0xE3, 0xBD, 0x21, 0x62, 0x92, 0xBD, 0xA3, 0xAD,
-    0x88, 0x2C, 0xD7, 0x63, 0x30, 0x27, 0x05, 0x6D, 0x2D, 0x68, 0xEE, 0xC4, 0xCF, 0x60, 0x39, 0x55,
-    0xFA, 0xE3, 0x14, 0x33, 0x44, 0x75, 0x3E, 0x2E, 0x2B, 0xF3, 0x9B, 0x1D, 0x3E, 0xAF, 0x88, 0x3E,
-    0x81, 0x9A, 0xB4, 0xB8, 0x67, 0x2F, 0x50, 0x86, 0xB6, 0x69, 0xF9, 0x0E, 0x44, 0x04, 0x2C, 0x9A,
-    0x79, 0xC9, 0xE8, 0x81, 0x36, 0xA4, 0x81, 0x26, 0x8D, 0x29, 0x05, 0x8A, 0xE4, 0xA9, 0xAB, 0x82,
-    0x9C, 0x86, 0x6F, 0x77, 0x82, 0x5A, 0x66, 0xC9, 0x77, 0x16, 0x26, 0x6E, 0xAE, 0x30, 0x04, 0xD6,
-    0x02, 0x7D, 0xE5, 0xDD, 0xB6, 0x73, 0xC5, 0xC0, 0xAD, 0xEF, 0xDE, 0x93, 0x6C, 0x0D, 0x3B, 0x3D,
-    0xC9, 0xC4, 0xBB, 0x0B, 0xC6, 0x57, 0x7E, 0x75, 0xF8, 0x65, 0x5B, 0xDE, 0x71, 0x97, 0xA1, 0x39,
-    0xFC, 0x50, 0xFA, 0xE4, 0x07, 0x9C, 0x4F, 0xD8, 0xCB, 0xDE, 0xD3, 0xB1, 0xB9, 0x4A, 0x43, 0x13,
-    0xE8, 0x87, 0xDB, 0x7F, 0xE7, 0xB3, 0x3E, 0xE6, 0xB3, 0xF2, 0xB5, 0x95, 0xC2, 0xAF, 0x81, 0xB9,
-    0xFF, 0x1A, 0x85, 0x5A, 0x7E, 0xEB, 0x3A, 0xE7, 0xDA, 0xD9, 0x0C, 0xEB, 0x56, 0x9F, 0x81, 0x98,
-    0xD3, 0x4C, 0x1B, 0xCD, 0x78, 0x8D, 0x01, 0x27, 0x8D, 0xC5, 0x5A, 0x6A, 0x49, 0xF5, 0xEF, 0xFB,
-    0xFB, 0x11, 0xAD, 0xBE, 0xE8, 0x08, 0x5F, 0xFE, 0xE7, 0xB7, 0x55, 0xF6, 0x91, 0xD3, 0x92, 0x4D,
-    0x26, 0x1C, 0x98, 0x79, 0x72, 0x15, 0xA8, 0xBA, 0x75, 0x76, 0x2F, 0x6E, 0x8E, 0xA7, 0xE4, 0xE9,
-    0x0F, 0x40, 0xC3, 0xDB, 0xEF, 0x78, 0x9C, 0x53, 0xB8, 0x7D, 0x17, 0x19, 0xCC, 0x65, 0x78, 0xF0,
-    0x1F, 0x15, 0x70, 0x7E, 0x40, 0x13, 0xE0, 0x3E, 0x80, 0x26, 0xC0, 0xCE, 0x30, 0x7D, 0x26, 0x08,
-    0xFC, 0xFB, 0xBF, 0x1F, 0x4C, 0x47, 0x32, 0x40, 0xC1, 0xAF, 0xFF, 0xFE, 0x0C, 0x28, 0x60, 0x54,
-    0x60, 0x54, 0x80, 0x24, 0x81, 0xEF, 0xFF, 0xE5, 0x51, 0x05, 0x16, 0xBC, 0x67, 0x85, 0xB2, 0x00,
-    0xF7, 0x09, 0x97, 0x2F, 0x78, 0x9C, 0x5B, 0xB8, 0x96, 0x91, 0x01, 0x0E, 0x1C, 0xEE, 0xB0, 0xFE,
-    0xFA, 0xCF, 0x8D, 0xE0, 0x3F, 0xF8, 0xAF, 0xFF, 0xF7, 0x3F, 0x3F, 0x82, 0xFF, 0xE9, 0x7F, 0xFC,
-    0x28, 0x7F, 0x00, 0xF9, 0x9F, 0xFF, 0xC7, 0xFF, 0xF9, 0x2F, 0x8F, 0xE0, 0x7F, 0xF9, 0x6F, 0xFF,
-    0xEB, 0xBF, 0x3F, 0x82, 0xFF, 0xE3, 0xBF, 0xFC, 0xF7, 0xFF, 0xF3, 0x11, 0xFC, 0x3F, 0xFF, 0xF9,
-    0x3E, 0xFD, 0x7F, 0x0F, 0xE7, 0x1A, 0xFC, 0xFF, 0xCF, 0x75, 0xE1, 0xFF, 0x7F, 0x0E, 0x18, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xAC, 0x09, 0xFF, 0xFF, 0xDB, 0xC3, 0xF8, 0xDF, 0x41, 0x6A, 0xFF, 0xFD, 0x7F,
-    0xCF, 0x04, 0xE1, 0x02, 0xA5, 0xF2, 0x19, 0x18, 0xBE, 0xFE, 0xFF, 0xEF, 0x07, 0x33, 0xFD, 0x3F,
-    0x0F, 0x03, 0xC3, 0x84, 0xFF, 0xFF, 0xFF, 0x6B, 0x81, 0xB8, 0x57, 0xFF, 0x43, 0x54, 0xFE, 0x06,
-    0x0A, 0xF4, 0xB8, 0xA6, 0xBC, 0xFC, 0x0F, 0x35, 0x69, 0xC3, 0x7F, 0x38, 0x60, 0x81, 0xE9, 0x83,
-    0x00, 0x1D, 0xA8, 0x33, 0x7E, 0x43, 0xB8, 0x75, 0x70, 0x77, 0x81, 0xF4, 0xFE, 0xCF, 0x46, 0xB8,
-    0x9B, 0xC1, 0x31, 0x35, 0x8C, 0x19, 0xC2, 0x02, 0x00, 0x24, 0x3E, 0xCF, 0x95, 0x78, 0x9C, 0x5D,
-    0x92, 0xDD, 0x4D, 0x02, 0x41, 0x14, 0x85, 0x2F, 0x46, 0x34, 0xFC, 0x44, 0xB7, 0x83, 0xA5, 0x03,
-    0x2C, 0xC0, 0x44, 0x4B, 0xB0, 0x03, 0xEC, 0x40, 0xA8, 0x40, 0x3B, 0xC0, 0x0E, 0x2C, 0x41, 0xAC,
-    0x00, 0x3B, 0x60, 0xDF, 0x7C, 0x94, 0x37, 0x5F, 0x48, 0x56, 0xFE, 0x82, 0x6C, 0xD0, 0xE3, 0x9D,
-    0x33, 0xBB, 0x33, 0x97, 0x3D, 0x09, 0xDC, 0xCD, 0x81, 0x39, 0x73, 0xE6, 0x9B, 0xED, 0x2D, 0x5A,
-    0x62, 0xF5, 0x71, 0x2D, 0x73, 0x3C, 0x58, 0xE7, 0x0E, 0xB9, 0x7C, 0xE3, 0xD3, 0x5A, 0xEF, 0x40,
-    0x43, 0x3F, 0xA7, 0xC6, 0x5A, 0xE9, 0x3F, 0xEE, 0x81, 0x8E, 0xB1, 0xF6, 0x78, 0x14, 0xF9, 0x43,
-    0xDF, 0x58, 0x40, 0x2A, 0xF2, 0x83, 0x71, 0x74, 0x74, 0x4D, 0xCB, 0xAD, 0xCE, 0x8F, 0xD2, 0x4F,
-    0x44, 0x26, 0xC0, 0x59, 0xB0, 0xD6, 0x98, 0xE9, 0xF7, 0x2D, 0xD0, 0x35, 0xE9, 0x03, 0x37, 0x7E,
-    0x71, 0x63, 0xD2, 0x2F, 0xDC, 0xD8, 0xE1, 0xD5, 0xA4, 0x9F, 0xBB, 0xB9, 0xD4, 0xC2, 0xA6, 0xBB,
-    0x9B, 0xCF, 0xE5, 0x4F, 0x4C, 0xF7, 0x0B, 0xAE, 0xCA, 0x00, 0xA6, 0x97, 0xB1, 0x07, 0xBF, 0x8D,
-    0x48, 0x12, 0x36, 0xDF, 0x62, 0x1A, 0xD2, 0xCB, 0x8A, 0x73, 0x56, 0x56, 0x65, 0xE1, 0x20, 0x4F,
-    0x3C, 0x18, 0xD3, 0xAB, 0xE3, 0x6A, 0xC4, 0x25, 0x1F, 0x8A, 0x08, 0xA5, 0xF0, 0xB0, 0x13, 0x83,
-    0x6E, 0xED, 0x61, 0x0F, 0x0D, 0xE0, 0xCC, 0x3F, 0x67, 0xE6, 0x1A, 0x74, 0xF3, 0xB6, 0x8E, 0x8D,
-    0x83, 0x1C, 0x01, 0xA4, 0x8C, 0x4C, 0xA3, 0x45, 0xD8, 0x49, 0xD5, 0x85, 0x22, 0xEC, 0x61, 0xD5,
-    0x98, 0x52, 0xD8, 0x4D, 0x4D, 0x9F, 0x45, 0xC7, 0xC3, 0xDE, 0x54, 0xA7, 0xF7, 0x72, 0xB0, 0x8B,
-    0xC0, 0x88, 0xDA, 0xE1, 0x25, 0x89, 0x24, 0x29, 0x85, 0x3D, 0x8A, 0xBC, 0x29, 0x85, 0xFD, 0x15,
-    0x6F, 0x85, 0x52, 0xD8, 0x30, 0x77, 0x47, 0x1D, 0x60, 0x6F, 0x98, 0xDA, 0xC2, 0xBE, 0x07, 0x94,
-    0xC2, 0xCE, 0x8F, 0x1D, 0x07, 0x7B, 0x5C, 0xB3, 0xB4, 0x55, 0xBF, 0x66, 0x69, 0xF7, 0x76, 0xDD,
-    0x7A, 0x9B, 0x86, 0xA2, 0xFF, 0x0F, 0x10, 0xB9, 0x4D, 0x78, 0x9C, 0x6D, 0x93, 0xDB, 0x55, 0x02,
-    0x31, 0x10, 0x86, 0x83, 0x0A, 0xAE, 0x82, 0x48, 0x07, 0xD0, 0x81, 0x1C, 0x1B, 0xC0, 0x73, 0x2C,
-    0x40, 0x3A, 0x80, 0x0E, 0xA0, 0x03, 0xE8, 0x00, 0x3A, 0x90, 0x57, 0x9F, 0xB4, 0x03, 0xEC, 0x80,
-    0xED, 0x00, 0x3A, 0x00, 0xB9, 0xC3, 0xC2, 0xFE, 0xCE, 0x24, 0x93, 0xCB, 0x43, 0xE6, 0x85, 0x84,
-    0xB9, 0xE4, 0x9B, 0x99, 0x7F, 0xBB, 0x79, 0xA2, 0x62, 0x36, 0x5C, 0x96, 0xB6, 0xF8, 0x88, 0xBA,
-    0x76, 0x68, 0x1D, 0xF0, 0x1D, 0x75, 0x65, 0xE8, 0x6D, 0x81, 0xA8, 0x0B, 0x68, 0x2D, 0x80, 0xBB,
-    0x88, 0xA7, 0x0D, 0x54, 0xC7, 0xC0, 0x63, 0xC4, 0xF5, 0x03, 0x24, 0x6F, 0xC0, 0x73, 0xC4, 0xF5,
-    0x07, 0xDC, 0xAA, 0x1C, 0x9D, 0x88, 0x6B, 0x8F, 0xB9, 0x52, 0xA7, 0x00, 0xF1, 0x3D, 0x00, 0x1C,
-    0x29, 0xB5, 0xF1, 0x88, 0x13, 0x54, 0xE4, 0x54, 0x03, 0x5E, 0x94, 0x22, 0xC4, 0xA2, 0xFC, 0xB1,
-    0x41, 0x4F, 0x4E, 0x5D, 0xE0, 0x89, 0x26, 0xE2, 0x11, 0xCF, 0x98, 0x79, 0xC0, 0x7B, 0xA5, 0x9A,
-    0x0E, 0x91, 0xAA, 0xE0, 0xC6, 0x01, 0xF2, 0xE9, 0x6A, 0x11, 0xFB, 0xE4, 0x7A, 0xB0, 0x80, 0x3A,
-    0xFF, 0x88, 0xA9, 0xB9, 0xA7, 0x70, 0x05, 0x32, 0x0C, 0xF8, 0x67, 0x6D, 0x11, 0x69, 0x9C, 0xC2,
-    0x41, 0xA5, 0xEB, 0x12, 0x5C, 0x12, 0x0A, 0x08, 0x07, 0x01, 0x56, 0xE4, 0x89, 0xB2, 0x84, 0x7E,
-    0x09, 0xC7, 0xAF, 0x44, 0x37, 0x24, 0x9B, 0x42, 0x5E, 0x85, 0x83, 0x00, 0x0B, 0x3A, 0xFD, 0x62,
-    0x5E, 0x48, 0xA9, 0xDA, 0x15, 0x55, 0x03, 0x28, 0x64, 0x07, 0x73, 0xD8, 0x52, 0x13, 0x7B, 0xD3,
-    0xC8, 0xC5, 0x8E, 0x45, 0xD2, 0xCF, 0x94, 0xB1, 0xD2, 0x1C, 0x16, 0xD0, 0x3E, 0x4A, 0xF7, 0x44,
-    0x8D, 0x35, 0x87, 0x05, 0xD3, 0xA8, 0x65, 0x7D, 0x2F, 0x30, 0x52, 0xA2, 0x63, 0x8B, 0x6E, 0x76,
-    0x75, 0xDE, 0xC0, 0x54, 0xBF, 0x52, 0x0D, 0x86, 0xA0, 0x85, 0xC5, 0x14, 0x2C, 0xC8, 0x1D, 0x73,
-    0x04, 0x02, 0xD4, 0xC3, 0xCC, 0x78, 0x43, 0x94, 0x3B, 0xE3, 0x54, 0xA7, 0x09, 0x46, 0xAC, 0xE9,
-    0x0D, 0xF1, 0xF6, 0x6E, 0x1A, 0x81, 0x92, 0x78, 0x71, 0x43, 0xD3, 0x01, 0x73, 0xF6, 0x03, 0xFD,
-    0x91, 0x1E, 0x2B, 0x0B, 0x7C, 0xCA, 0x8C, 0xAB, 0x69, 0xA8, 0x5A, 0x42, 0x24, 0xF9, 0xCB, 0x66,
-    0x3A, 0x6B, 0x2C, 0x9D, 0x87, 0x42, 0x07, 0x99, 0xA8, 0x29, 0xC5, 0xF4, 0x20, 0x05, 0xB4, 0xED,
-    0x30, 0xB7, 0x4B, 0xA3, 0x87, 0xF2, 0xF0, 0xBB, 0x5A, 0xD1, 0x12, 0x97, 0xAE, 0x7F, 0x98, 0xF1,
-    0x1B, 0x9B, 0xD0, 0x75, 0x24, 0xE7, 0x93, 0x17, 0x0F, 0x1B, 0x7D, 0x13, 0xAC, 0x56, 0x6D, 0xA4,
-    0x66, 0xFA, 0x12, 0xBC, 0xE5, 0x6E, 0xD6, 0x3C, 0xDB, 0x00, 0x50, 0x57, 0xB1, 0xAD, 0xB4, 0x7D,
-    0x6D, 0xE9, 0xC6, 0x47, 0xE6, 0xD2, 0xA1, 0xD8, 0xC2, 0x48, 0x52, 0xDB, 0x51, 0xCF, 0xD9, 0x59,
-    0xF3, 0xEA, 0xA1, 0x26, 0x73, 0xA1, 0xF8, 0x07, 0x1C, 0xD6, 0x3D, 0x26, 0x78, 0x9C, 0x5D, 0x52,
-    0xEB, 0x51, 0x02, 0x31, 0x10, 0xDE, 0x03, 0xDF, 0x8F, 0x99, 0xAB, 0x80, 0xB1, 0x03, 0xAF, 0x03,
-    0xAD, 0x40, 0xED, 0x40, 0x3B, 0xC0, 0x0E, 0xB4, 0x04, 0x3B, 0x80, 0x0E, 0xA4, 0x03, 0xE9, 0xE0,
-    0xE8, 0x00, 0xA9, 0x80, 0x19, 0xC0, 0x03, 0xEE, 0x38, 0x3F, 0x77, 0x93, 0x6C, 0xB2, 0xDE, 0xFE,
-    0xB8, 0x24, 0x9B, 0xE4, 0xBE, 0x57, 0xC6, 0x65, 0x8F, 0x52, 0x55, 0x0F, 0xB4, 0xC3, 0x75, 0x5A,
-    0xDF, 0x03, 0xD4, 0xE0, 0x33, 0x35, 0x16, 0x40, 0x56, 0x01, 0x27, 0xB1, 0xD1, 0x60, 0x44, 0x13,
-    0xE0, 0x56, 0xD7, 0xAF, 0xE0, 0xFB, 0xF9, 0x2F, 0xE6, 0xDA, 0x58, 0x03, 0x3D, 0xF7, 0xBD, 0xF0,
-    0x6B, 0xDE, 0x1B, 0xFA, 0x73, 0xCF, 0xBE, 0x31, 0x0E, 0x5B, 0x8D, 0x3B, 0x28, 0x24, 0xC2, 0xE5,
-    0x05, 0x3C, 0x95, 0x02, 0xB8, 0x53, 0x36, 0x23, 0x19, 0x67, 0xC0, 0xA9, 0xBF, 0xBB, 0x03, 0x8E,
-    0x79, 0xA8, 0xF1, 0x15, 0xD0, 0xA6, 0x8E, 0xCA, 0x0B, 0x30, 0xA0, 0x08, 0x57, 0x12, 0xAD, 0x80,
-    0xBE, 0x12, 0xDA, 0x00, 0xE7, 0xD4, 0xE2, 0x2D, 0x4A, 0x78, 0x67, 0x2A, 0x1F, 0xC0, 0x65, 0x52,
-    0x79, 0xC0, 0x72, 0x8B, 0x65, 0xF6, 0x4F, 0x36, 0xF0, 0x68, 0x8C, 0x7A, 0x92, 0xC6, 0x99, 0x69,
-    0xD0, 0x1E, 0x02, 0x64, 0xEA, 0x5B, 0x69, 0x6B, 0xFD, 0x74, 0x4E, 0xDC, 0x74, 0xFF, 0x31, 0xED,
-    0xA2, 0xEC, 0x51, 0xB6, 0x96, 0x07, 0xA3, 0x0E, 0x56, 0x96, 0x29, 0xF3, 0x3A, 0x62, 0xB1, 0x49,
-    0xCB, 0x41, 0x1C, 0xAA, 0x93, 0x5A, 0xD6, 0x76, 0xE5, 0x0C, 0x53, 0x3F, 0x36, 0xCE, 0x65, 0x86,
-    0x0E, 0x8E, 0xB1, 0x3F, 0x2E, 0x87, 0x4A, 0x3D, 0x9D, 0x88, 0x3D, 0xE4, 0x62, 0xF1, 0xF4, 0xB7,
-    0x9A, 0x65, 0xEB, 0x27, 0x45, 0x4C, 0x3B, 0x84, 0x3A, 0x8B, 0xEF, 0x81, 0x43, 0x95, 0x6C, 0xEB,
-    0xF4, 0x62, 0x5C, 0xA8, 0x26, 0x0E, 0x1F, 0xAA, 0x8D, 0xA3, 0x90, 0x50, 0x6B, 0x23, 0x81, 0x01,
-    0xE5, 0xD1, 0x99, 0x38, 0x98, 0x12, 0xAD, 0xE7, 0x26, 0x8E, 0xBC, 0x1D, 0x52, 0xDE, 0x27, 0x53,
-    0x45, 0x46, 0x7F, 0xFB, 0x5A, 0xD3, 0xF4, 0x78, 0x9C, 0xE5, 0x90, 0xDB, 0x0D, 0x01, 0x51, 0x10,
-    0x86, 0xC7, 0xC6, 0x25, 0x11, 0x12, 0x15, 0xA0, 0x03, 0x3A, 0xD0, 0x01, 0xDB, 0x01, 0x1D, 0x50,
-    0x82, 0x0E, 0x94, 0x40, 0x07, 0x74, 0x80, 0x0A, 0x56, 0x07, 0x9B, 0xAD, 0xC0, 0xC3, 0xBA, 0x86,
-    0xF5, 0x39, 0x97, 0x5D, 0xE7, 0x6C, 0x0D, 0xE6, 0x65, 0xE6, 0x4B, 0x66, 0xE6, 0xFF, 0x67, 0x44,
-    0xCA, 0x71, 0x8C, 0x03, 0x07, 0x33, 0xEA, 0x2F, 0x5A, 0x8E, 0x53, 0x06, 0x19, 0x2B, 0xC7, 0x19,
-    0x93, 0x07, 0x54, 0x0B, 0xDC, 0x40, 0xEF, 0x04, 0xDD, 0x82, 0xAF, 0x50, 0xEF, 0xC3, 0x3E, 0x47,
-    0x55, 0x6E, 0x45, 0x6E, 0xD0, 0xB0, 0x7C, 0x30, 0xAD, 0x6A, 0x68, 0x64, 0xF9, 0x6E, 0x57, 0x65,
-    0xC4, 0x06, 0x87, 0x58, 0xA9, 0x14, 0x9A, 0x3A, 0xAB, 0xCD, 0xC6, 0xCA, 0x02, 0xE6, 0x3A, 0x3F,
-    0xC1, 0x5A, 0x7D, 0x99, 0x22, 0x84, 0xA9, 0xDD, 0x93, 0x98, 0xC6, 0x24, 0x1F, 0x33, 0x8B, 0xD6,
-    0xBA, 0x2B, 0x2E, 0x7C, 0x69, 0xA1, 0xC5, 0x4F, 0x56, 0x64, 0xA7, 0x8C, 0xA4, 0x3F, 0x5B, 0x22,
-    0x9D, 0x0F, 0x51, 0x46, 0xE4, 0xEE, 0xBC, 0x80, 0x77, 0x96, 0xC8, 0x52, 0x73, 0xCD, 0xFB, 0xDA,
-    0xDB, 0x48, 0xB8, 0x50, 0xE2, 0x6D, 0x9F, 0x97, 0xDE, 0x97, 0x72, 0x0E, 0xFE, 0x9C, 0x2B, 0x3E,
-    0x87, 0x9C, 0xA5, 0x14, 0x8F, 0x71, 0x5E, 0x7C, 0x01, 0x91, 0x33, 0x9D, 0x07, 0x78, 0x9C, 0x8D,
-    0x92, 0x3D, 0x0E, 0x41, 0x41, 0x14, 0x85, 0x07, 0xF1, 0xFF, 0x13, 0x2B, 0x10, 0x3B, 0xA0, 0x53,
-    0xB2, 0x03, 0x76, 0x60, 0x09, 0x74, 0x74, 0xEC, 0x80, 0x92, 0x4E, 0xAB, 0x10, 0x76, 0xC0, 0x0E,
-    0xD0, 0x13, 0xAC, 0x40, 0x3C, 0x3C, 0x21, 0xF8, 0xBC, 0x57, 0x90, 0x7B, 0x9F, 0x44, 0x9C, 0xEE,
-    0x3B, 0x39, 0x33, 0x73, 0x73, 0xEE, 0x98, 0xCA, 0x6A, 0x2D, 0x34, 0xF2, 0x9B, 0x23, 0x4A, 0x29,
-    0x73, 0xD6, 0x46, 0xCE, 0x1C, 0xB4, 0x91, 0x34, 0xD9, 0x5E, 0xFF, 0xAD, 0xA1, 0x63, 0x04, 0x8C,
-    0x50, 0x1B, 0x6A, 0x92, 0xDD, 0xEB, 0x62, 0x92, 0xB3, 0xB0, 0x51, 0x81, 0x99, 0xFB, 0x86, 0xD4,
-    0x15, 0x42, 0x92, 0x2B, 0x30, 0x56, 0x01, 0xCB, 0x1D, 0x42, 0xEA, 0x01, 0x7E, 0xC9, 0x03, 0xA8,
-    0xAA, 0x80, 0x0D, 0x51, 0xC9, 0x79, 0x98, 0xAB, 0xC0, 0xD2, 0x3B, 0xC4, 0x0D, 0x82, 0x92, 0xEB,
-    0xD0, 0x51, 0x01, 0xA7, 0xB7, 0x84, 0xE4, 0xF4, 0x93, 0xBD, 0x4F, 0x1A, 0x13, 0x28, 0xAB, 0x13,
-    0x17, 0x88, 0x48, 0x2E, 0xC1, 0x54, 0x05, 0x76, 0x90, 0x51, 0xC6, 0xFD, 0xBB, 0xDC, 0x96, 0x0A,
-    0x9C, 0x20, 0xFE, 0x73, 0x08, 0xA7, 0xDC, 0xA2, 0x3A, 0xE1, 0x94, 0x1B, 0x96, 0xFC, 0x57, 0xB9,
-    0x6A, 0x88, 0xAE, 0x77, 0xC3, 0xF6, 0xF7, 0x86, 0x69, 0x36, 0x3E, 0x2A, 0x98, 0x85, 0xFE, 0x40,
-    0x04, 0x2D, 0x8F, 0x11, 0xDF, 0x7A, 0x8C, 0x68, 0xE9, 0xA1, 0x78, 0xEA, 0x7B, 0x01, 0xEA, 0x8B,
-    0xE6, 0x6A, 0x78, 0x9C, 0x4B, 0xB8, 0x73, 0x17, 0x0C, 0x38, 0x3F, 0xFF, 0x87, 0x80, 0xFA, 0xAF,
-    0x50, 0x46, 0x3F, 0x8C, 0x21, 0xF3, 0xF5, 0xBF, 0x3D, 0x03, 0x18, 0x8C, 0x32, 0x06, 0x01, 0xE3,
-    0xFD, 0x3B, 0x10, 0xE0, 0x82, 0xC5, 0x4E, 0xFD, 0x17, 0x58, 0x7C, 0x2D, 0x80, 0x32, 0x64, 0x19,
-    0x04, 0x04, 0xC1, 0x80, 0x01, 0x00, 0x21, 0xE4, 0xA0, 0xD2, 0x78, 0x9C, 0x53, 0xD8, 0xC5, 0xC2,
-    0x80, 0x0C, 0x2E, 0xFC, 0xD7, 0x47, 0xE1, 0x7F, 0xF8, 0xBF, 0x1E, 0x85, 0x3F, 0xE1, 0xFF, 0x7F,
-    0x26, 0x64, 0xBE, 0xC0, 0xFF, 0xFF, 0x5C, 0x28, 0x0A, 0x7E, 0xA2, 0x19, 0xF0, 0x91, 0x72, 0x03,
-    0xE6, 0x13, 0x32, 0x80, 0x73, 0xD4, 0x00, 0x0C, 0x03, 0xE4, 0x09, 0x19, 0xC0, 0x48, 0x92, 0x01,
-    0x9F, 0x08, 0x18, 0xA0, 0x30, 0x6A, 0x00, 0xC8, 0x00, 0x76, 0x34, 0x03, 0x58, 0x51, 0xF8, 0x0D,
-    0xD9, 0x0C, 0x00, 0x72, 0x93, 0x7D, 0x65, 0x78, 0x9C, 0x0B, 0xB8, 0x73, 0x17, 0x0C, 0xA4, 0x3E,
-    0xFD, 0x87, 0x80, 0x7E, 0x18, 0x63, 0xFD, 0x04, 0x18, 0x83, 0x41, 0x40, 0x10, 0x08, 0x2E, 0x02,
-    0x19, 0x60, 0x70, 0x61, 0x94, 0x31, 0x70, 0x8C, 0x00, 0x70, 0x7C, 0xFD, 0xFD, 0xBF, 0x1E, 0x1E,
-    0x4D, 0x9F, 0xA1, 0x8C, 0xF9, 0xB0, 0xF8, 0xD2, 0x83, 0xC4, 0x97, 0xA0, 0x20, 0x03, 0x00, 0x01,
-    0x59, 0xAE, 0x5B, 0x78, 0x9C, 0x3D, 0x90, 0xBD, 0x0D, 0xC2, 0x30, 0x10, 0x46, 0x4F, 0x10, 0x01,
-    0x05, 0x91, 0xB2, 0x01, 0x15, 0x35, 0x6B, 0x50, 0x22, 0x7A, 0x94, 0x11, 0xBC, 0x0A, 0x1B, 0xC0,
-    0x06, 0x8C, 0x40, 0xC3, 0x00, 0x6C, 0x10, 0x36, 0xB0, 0x44, 0x0A, 0x22, 0x19, 0xE9, 0xCB, 0x97,
-    0xFB, 0xC9, 0x35, 0xF6, 0xB3, 0xEF, 0xDE, 0x9D, 0x2D, 0xC2, 0x78, 0xE1, 0x22, 0x11, 0x0D, 0x80,
-    0x2A, 0xE0, 0x4E, 0xA8, 0x03, 0x7A, 0x42, 0x0A, 0xF8, 0x13, 0xB2, 0xEF, 0x4F, 0x40, 0x07, 0x6C,
-    0x0C, 0x3E, 0xC0, 0x11, 0x38, 0x18, 0xFC, 0x98, 0x53, 0xF0, 0x0C, 0x71, 0x2B, 0x5F, 0x97, 0x53,
-    0xBC, 0x95, 0xAB, 0xCB, 0x29, 0x5E, 0x4E, 0xD7, 0xC9, 0xC4, 0x0F, 0x2F, 0x54, 0xF1, 0x8E, 0xCB,
-    0x5B, 0xE5, 0x14, 0xAF, 0xED, 0x8C, 0xF2, 0x01, 0x9D, 0x44, 0xB6, 0x8A, 0xDD, 0x53, 0xA9, 0xD8,
-    0x3B, 0xD4, 0x2A, 0xF6, 0xDE, 0xA9, 0xE0, 0xE6, 0xF3, 0x0E, 0xC8, 0x45, 0xC5, 0x36, 0x6F, 0xEE,
-    0xB1, 0x9A, 0x5F, 0xD2, 0x36, 0xFB, 0xF9, 0x2B, 0xCE, 0x8B, 0x11, 0x18, 0x76, 0x66, 0xCF, 0x78,
-    0x9C, 0x4B, 0x98, 0x89, 0x0A, 0x58, 0x7E, 0xFE, 0x47, 0x05, 0xF6, 0x7F, 0xD0, 0x04, 0xE2, 0xBF,
-    0xA1, 0x09, 0xC8, 0x29, 0x84, 0xA2, 0x00, 0x57, 0x46, 0x00, 0x3B, 0x67, 0x3E, 0xE2, 0x78, 0x9C,
-    0x63, 0x08, 0x65, 0x00, 0x82, 0x0D, 0xFF, 0x75, 0x81, 0xE4, 0xC7, 0xFF, 0xF7, 0x19, 0x19, 0x18,
-    0x1E, 0xFC, 0xFF, 0xCF, 0xC3, 0xC0, 0x60, 0xF0, 0xEF, 0xFF, 0x7A, 0xA0, 0xD0, 0xC1, 0xFF, 0xFF,
-    0x39, 0x80, 0xD4, 0x8F, 0xFF, 0xF9, 0x40, 0x32, 0xE0, 0xFF, 0x7F, 0x90, 0xE2, 0x43, 0xF7, 0x41,
-    0x24, 0x03, 0x13, 0x03, 0x00, 0x84, 0x78, 0x13, 0xE6, 0x78, 0x9C, 0x55, 0xD0, 0xBD, 0x4E, 0x02,
-    0x41, 0x10, 0x07, 0xF0, 0x21, 0x18, 0x31, 0x21, 0x21, 0xB4, 0x36, 0xC6, 0x47, 0xB0, 0xB2, 0x85,
-    0x27, 0x10, 0xDE, 0x00, 0x1A, 0x63, 0x29, 0x4F, 0x20, 0x56, 0x26, 0x26, 0x84, 0x91, 0xC4, 0x92,
-    0x04, 0x4A, 0x4B, 0x1F, 0x80, 0x04, 0x28, 0xE8, 0x35, 0xB6, 0x46, 0x4A, 0x4B, 0x60, 0x81, 0x33,
-    0xF2, 0x71, 0x7F, 0x67, 0x66, 0xD7, 0x4D, 0x98, 0xE2, 0x76, 0x7F, 0xB7, 0x7B, 0x37, 0x1F, 0x44,
-    0x12, 0xCF, 0x9F, 0x5F, 0xDD, 0x23, 0x59, 0xAF, 0x33, 0xAA, 0x6F, 0x48, 0xCC, 0x72, 0xF4, 0x8A,
-    0x33, 0xD1, 0x07, 0x2C, 0x66, 0x59, 0x87, 0x26, 0x51, 0x15, 0x21, 0x6A, 0x0E, 0x4C, 0xB4, 0x96,
-    0x5D, 0xEB, 0xE6, 0x45, 0x9E, 0x3F, 0xC2, 0x73, 0x59, 0x4F, 0xE5, 0x93, 0x7A, 0x2A, 0x1B, 0xA6,
-    0x11, 0x70, 0xA5, 0xFF, 0xA3, 0xB1, 0x31, 0x01, 0xB2, 0x46, 0xDA, 0x29, 0xF7, 0xA8, 0x79, 0xD1,
-    0x42, 0x58, 0x06, 0xF2, 0x81, 0x75, 0xE1, 0x53, 0xBC, 0x4B, 0x94, 0x82, 0xDF, 0x30, 0xFD, 0x17,
-    0xFD, 0x82, 0xE7, 0xE8, 0x45, 0xAE, 0xC0, 0x0E, 0xB7, 0x91, 0x0B, 0xF0, 0x0A, 0x95, 0xC8, 0xB9,
-    0xB2, 0x74, 0xC8, 0x83, 0xD3, 0x65, 0xAC, 0xC2, 0x68, 0x3D, 0x86, 0x70, 0x9A, 0x68, 0x18, 0x99,
-    0x80, 0xA5, 0xA1, 0xC8, 0x2D, 0xB8, 0x01, 0x1C, 0x07, 0x49, 0xE7, 0x5C, 0x04, 0x0A, 0x81, 0x7D,
-    0x6D, 0x70, 0x13, 0xAB, 0x5C, 0x2B, 0x1D, 0x90, 0x33, 0x5D, 0xD8, 0x34, 0xEE, 0x11, 0x8E, 0x13,
-    0xA3, 0xCE, 0xE4, 0x4E, 0xA6, 0x3F, 0x01, 0xB6, 0xCA, 0x77, 0x79, 0x3B, 0x1D, 0xEC, 0x81, 0xE1,
-    0x52, 0x59, 0xDC, 0x85, 0xB1, 0xE7, 0x7D, 0x85, 0x0D, 0xAF, 0xA6, 0xD4, 0x6C, 0xED, 0x74, 0x74,
-    0xE2, 0xED, 0x0C, 0x55, 0xD3, 0x13, 0x9F, 0xE3, 0xE1, 0xF1, 0xD2, 0xE7, 0xFE, 0x03, 0x73, 0x3E,
-    0xD1, 0xDD, 0x78, 0x9C, 0xCD, 0xD2, 0xBB, 0x4E, 0x02, 0x41, 0x14, 0x06, 0xE0, 0x41, 0x60, 0xBD,
-    0x71, 0xB1, 0xB4, 0x30, 0x61, 0x0B, 0x7B, 0x2C, 0xED, 0xB0, 0xB6, 0x30, 0xBE, 0x80, 0xC1, 0xD2,
-    0xD2, 0xC2, 0x58, 0xD0, 0xF0, 0x08, 0xB4, 0x74, 0xFA, 0x06, 0x1A, 0x7B, 0x63, 0x4D, 0x2C, 0x0C,
-    0x4F, 0x80, 0xF1, 0x01, 0xDC, 0x42, 0x83, 0x0B, 0x03, 0xFC, 0xFE, 0xE7, 0xCC, 0xEC, 0x30, 0xBE,
-    0x81, 0x53, 0x6C, 0xF6, 0x9B, 0xD9, 0x3D, 0x7B, 0x2E, 0x6B, 0x36, 0x4C, 0xBC, 0xC6, 0xA8, 0xC4,
-    0xCC, 0x51, 0x8F, 0x39, 0x47, 0x33, 0xA6, 0xFD, 0x47, 0x3C, 0x19, 0x7D, 0x3E, 0x1F, 0x07, 0x5E,
-    0xAF, 0xC0, 0x75, 0xE1, 0x99, 0x2E, 0xA1, 0xEB, 0xC0, 0xF1, 0xDB, 0x09, 0x59, 0x59, 0xD8, 0xE6,
-    0x4D, 0xEF, 0x76, 0x44, 0x77, 0x84, 0x13, 0x4C, 0xAA, 0x7C, 0xEC, 0x89, 0xBB, 0x25, 0x12, 0xD8,
-    0xD6, 0xA0, 0x53, 0x60, 0x47, 0x78, 0xE7, 0x3E, 0x79, 0x2E, 0x4F, 0x93, 0x35, 0x9F, 0x42, 0x8E,
-    0x17, 0x61, 0xD9, 0xF3, 0x1D, 0x28, 0x59, 0x6E, 0xF9, 0x75, 0x09, 0x24, 0x16, 0xDD, 0x82, 0x7B,
-    0x8C, 0x65, 0xD1, 0x0A, 0xF9, 0x2F, 0x50, 0xB7, 0x68, 0x04, 0xCE, 0xD0, 0xB4, 0x21, 0xB0, 0x31,
-    0x3F, 0x68, 0xC5, 0x9C, 0xFE, 0xA5, 0x9E, 0xAE, 0x67, 0x94, 0xCB, 0xBB, 0xEB, 0xE6, 0xCC, 0x85,
-    0x9D, 0xC0, 0x15, 0x6A, 0x16, 0x83, 0x42, 0x47, 0xC0, 0x96, 0x45, 0x56, 0xF0, 0x1E, 0xA8, 0xB0,
-    0x84, 0x4D, 0xCF, 0x2F, 0x9E, 0x90, 0x6D, 0xCF, 0x25, 0xFA, 0xC2, 0xCC, 0xFD, 0x2D, 0x8F, 0x60,
-    0xBE, 0xD2, 0x9C, 0x33, 0xAD, 0x67, 0x01, 0x54, 0xB5, 0x75, 0x38, 0x35, 0x26, 0xCD, 0xB5, 0x4B,
-    0x2C, 0x90, 0x33, 0x78, 0x7B, 0x95, 0x41, 0xEC, 0x6A, 0xDB, 0xC7, 0xBE, 0xED, 0x0F, 0x5A, 0x63,
-    0x83, 0xB9, 0xEA, 0x10, 0x12, 0xF2, 0x03, 0x89, 0x49, 0x67, 0xA2, 0x7D, 0x8D, 0x7F, 0x28, 0x97,
-    0x9B, 0xE1, 0x95, 0xEB, 0xE7, 0x2F, 0xED, 0xDE, 0xE2, 0x0F, 0x78, 0x9C, 0x75, 0x90, 0x41, 0x0E,
-    0x01, 0x41, 0x10, 0x45, 0x8B, 0x91, 0x60, 0xE7, 0x00, 0x12, 0x36, 0x5C, 0xC3, 0x19, 0x6C, 0x45,
-    0xC2, 0xD2, 0x0A, 0x1B, 0x62, 0xC7, 0x0D, 0xB0, 0x93, 0x48, 0x48, 0x5C, 0x60, 0xDC, 0x60, 0x6C,
-    0x45, 0xC4, 0x0D, 0x4C, 0x1C, 0x40, 0x22, 0x46, 0x44, 0x66, 0x62, 0xBE, 0xEA, 0xEA, 0x19, 0x3D,
-    0x16, 0xFE, 0xA6, 0xFB, 0x75, 0xF7, 0xAF, 0xFE, 0x55, 0x44, 0xAC, 0xFA, 0xFE, 0x7A, 0x5E, 0x56,
-    0x49, 0x6B, 0x03, 0x51, 0x53, 0x60, 0x86, 0x48, 0x45, 0x86, 0xC2, 0x3B, 0x26, 0x97, 0xE9, 0xC2,
-    0xAB, 0xD3, 0x19, 0xEE, 0x79, 0xB1, 0x88, 0xF8, 0xAA, 0xAB, 0x0C, 0x73, 0x45, 0xEC, 0x72, 0x52,
-    0xE2, 0x7F, 0xDA, 0x44, 0x1E, 0x90, 0x8F, 0x6A, 0xF3, 0x61, 0x00, 0x87, 0xBE, 0x2A, 0x03, 0x25,
-    0x43, 0x13, 0x20, 0x67, 0x68, 0x07, 0xA4, 0x0C, 0xDD, 0x70, 0x32, 0x40, 0x77, 0x4C, 0x13, 0xF4,
-    0x40, 0xEF, 0x87, 0x5A, 0x7F, 0xC9, 0xC3, 0xF8, 0xA7, 0xCA, 0x3A, 0x41, 0x37, 0xE9, 0x2A, 0xD6,
-    0x16, 0x48, 0x1B, 0xEA, 0x9B, 0x16, 0x58, 0x05, 0xA0, 0x96, 0x78, 0xEA, 0xC3, 0x4D, 0x04, 0xBD,
-    0xEB, 0x59, 0x29, 0x53, 0x43, 0x8C, 0xAE, 0x25, 0x9E, 0x40, 0x4D, 0x29, 0x00, 0xEC, 0x0C, 0xB7,
-    0xFD, 0x02, 0xB2, 0xD2, 0x21, 0x70, 0x3C, 0x84, 0xD0, 0x7F, 0xF9, 0xF1, 0x74, 0x25, 0x71, 0x3B,
-    0xD4, 0xE0, 0xE8, 0x18, 0x7D, 0x99, 0xFD, 0xCA, 0x8A, 0x23, 0x0C, 0x16, 0xA3, 0x8A, 0xDA, 0x7C,
-    0x00, 0xC8, 0x12, 0x90, 0x6A, 0x78, 0x9C, 0xCD, 0xD1, 0x3F, 0x4E, 0x02, 0x41, 0x14, 0x06, 0xF0,
-    0x21, 0x90, 0x40, 0x94, 0x02, 0x2E, 0x40, 0x68, 0xED, 0xAC, 0x6C, 0xF5, 0x06, 0x70, 0x03, 0xE8,
-    0xE8, 0x84, 0x13, 0x08, 0x95, 0x09, 0x89, 0x71, 0x30, 0xB1, 0x34, 0xA1, 0xB5, 0xE3, 0x02, 0x24,
-    0x40, 0x41, 0x0F, 0xB1, 0x35, 0x1A, 0x2B, 0x4B, 0x96, 0x65, 0x21, 0xE1, 0xDF, 0x7E, 0x7E, 0xF3,
-    0x76, 0x98, 0x0C, 0x37, 0xF0, 0x15, 0xBB, 0xF3, 0xCB, 0xEE, 0xCE, 0xBC, 0xF7, 0xAD, 0x52, 0x5E,
-    0x15, 0x7D, 0xA8, 0x16, 0x2E, 0x7D, 0x2E, 0xD1, 0xF4, 0x19, 0x42, 0xFF, 0x27, 0xBE, 0x7E, 0x7E,
-    0xBD, 0x65, 0x1C, 0x7F, 0xC1, 0x5A, 0x64, 0x2D, 0x3F, 0x20, 0xF5, 0x9D, 0x16, 0x56, 0x61, 0xAB,
-    0x22, 0x5C, 0x73, 0xF5, 0xD4, 0x78, 0xE7, 0x75, 0x43, 0x96, 0x79, 0xBF, 0xE2, 0x27, 0xF5, 0x98,
-    0x0B, 0xAD, 0xC6, 0x7C, 0x4B, 0xB6, 0x9F, 0x08, 0x37, 0x40, 0x3A, 0x39, 0xF6, 0x60, 0x78, 0x74,
-    0x89, 0xFC, 0x90, 0x77, 0x40, 0xDE, 0xB2, 0x4E, 0xF6, 0x80, 0xCC, 0xA9, 0xC9, 0x18, 0x7A, 0x86,
-    0x85, 0xEB, 0x79, 0x0B, 0x1D, 0xA0, 0xEF, 0x18, 0x41, 0x87, 0x5E, 0xB6, 0x4B, 0xE8, 0xC8, 0x9E,
-    0x6A, 0x2A, 0x30, 0xBC, 0x3D, 0xE7, 0xD9, 0xD3, 0x15, 0x6A, 0x3E, 0x43, 0xB4, 0xFD, 0x70, 0x02,
-    0x8C, 0x1C, 0x39, 0x20, 0x07, 0x4A, 0x9D, 0xB8, 0x87, 0x6E, 0x01, 0x59, 0xAB, 0x02, 0x7B, 0xE6,
-    0xF4, 0x25, 0xCB, 0x9E, 0x19, 0x70, 0x8F, 0x81, 0xEB, 0x91, 0x0C, 0x81, 0x9C, 0xE8, 0x5A, 0xD2,
-    0xE8, 0x00, 0x03, 0xD9, 0x6C, 0x2D, 0x34, 0x99, 0x3C, 0xD0, 0x53, 0x60, 0x67, 0x38, 0x37, 0xBF,
-    0x60, 0x78, 0xE4, 0x4B, 0x92, 0x73, 0xE1, 0x60, 0x63, 0xBF, 0x48, 0x3A, 0xEC, 0x24, 0xBA, 0x67,
-    0xCF, 0x32, 0xCE, 0x8B, 0x49, 0xFC, 0x39, 0xA5, 0xAA, 0xB1, 0x3D, 0xE3, 0xB1, 0x7B, 0x93, 0x9C,
-    0xFD, 0x07, 0x1F, 0x30, 0xF1, 0xC5, 0x78, 0x9C, 0x7D, 0x91, 0x3B, 0x4E, 0x03, 0x31, 0x10, 0x86,
-    0x67, 0x09, 0xCA, 0x12, 0x68, 0xA8, 0xA8, 0xC2, 0xE3, 0x02, 0x88, 0x54, 0x34, 0x34, 0xDC, 0x80,
-    0x9E, 0x16, 0x89, 0x36, 0x88, 0x02, 0x5A, 0x4A, 0x10, 0x12, 0xC9, 0x29, 0x52, 0x20, 0xA4, 0x04,
-    0x71, 0x80, 0xA5, 0xA1, 0x44, 0x9B, 0x16, 0xC1, 0x19, 0x48, 0x14, 0x96, 0x67, 0x20, 0x1F, 0x33,
-    0xB6, 0x37, 0xB8, 0xE2, 0x2F, 0x3C, 0xFE, 0xE4, 0x79, 0x5B, 0x44, 0x75, 0xF8, 0xF8, 0x7C, 0xB5,
-    0x24, 0xA5, 0xEE, 0x30, 0x6D, 0x05, 0xBA, 0xC6, 0xAB, 0xE6, 0xA8, 0x31, 0x09, 0x98, 0x27, 0x86,
-    0x2F, 0x7A, 0x3B, 0x3F, 0x7E, 0xD0, 0x73, 0x59, 0x69, 0x71, 0xC2, 0x20, 0x55, 0x7B, 0x03, 0x99,
-    0x9A, 0x1E, 0xD4, 0x5D, 0xD0, 0x1B, 0x54, 0x45, 0x5E, 0xC9, 0x7D, 0xC6, 0x6D, 0x58, 0x15, 0xF9,
-    0x61, 0x23, 0x54, 0x78, 0xA7, 0x25, 0x0D, 0x98, 0x0B, 0xD8, 0x67, 0x20, 0x6D, 0x48, 0x02, 0x1E,
-    0x40, 0xA5, 0xEF, 0xF2, 0x95, 0xC1, 0xE9, 0x90, 0x6C, 0x3F, 0xE8, 0x48, 0x1B, 0x1B, 0x11, 0x6B,
-    0xA1, 0xF8, 0x0F, 0xAB, 0x05, 0xD9, 0xE5, 0x54, 0xBB, 0x52, 0xB0, 0x23, 0x91, 0x46, 0x34, 0x63,
-    0x1C, 0xD2, 0x8D, 0xF1, 0x16, 0x62, 0x3C, 0xD1, 0x56, 0x22, 0x5C, 0x83, 0x95, 0xF8, 0x79, 0xFC,
-    0xD7, 0x74, 0x27, 0xB5, 0xD4, 0xCC, 0x7B, 0x6A, 0x5B, 0x11, 0x1D, 0x2B, 0x9F, 0x71, 0x61, 0x63,
-    0x1D, 0xDF, 0xBC, 0xE9, 0xCE, 0xEA, 0x7E, 0x3F, 0x71, 0x7B, 0xE9, 0x59, 0xB3, 0xF7, 0x4F, 0x76,
-    0x56, 0xCC, 0xEB, 0xA3, 0x1C, 0x60, 0xDD, 0x7F, 0xC3, 0xB7, 0xA7, 0x56, 0xB9, 0x95, 0x2F, 0xA3,
-    0x8B, 0x64, 0x5A, 0x7C, 0xEF, 0xF4, 0x6C, 0xD3, 0x5D, 0x7E, 0x01, 0x27, 0xA0, 0xC9, 0xCC, 0x78,
-    0x9C, 0x63, 0x60, 0x40, 0x05, 0x06, 0x37, 0xFF, 0xBF, 0xB7, 0x02, 0xB3, 0x04, 0x7E, 0xFF, 0x07,
-    0x02, 0x16, 0x10, 0xF3, 0x11, 0x88, 0xF5, 0x9F, 0x13, 0xC4, 0xFC, 0x0B, 0x66, 0xB2, 0x01, 0x59,
-    0x09, 0xFF, 0xFF, 0xD7, 0x0B, 0x35, 0x77, 0x83, 0x04, 0x0F, 0x40, 0xD5, 0x01, 0xC1, 0x87, 0xFF,
-    0xE7, 0x61, 0x46, 0x7D, 0xFA, 0xDF, 0x8F, 0x60, 0xD6, 0xC3, 0x98, 0x9F, 0x89, 0x65, 0x1A, 0xEC,
-    0xDA, 0xFD, 0xE7, 0xFF, 0xFD, 0xDD, 0xBB, 0x57, 0xB3, 0x33, 0x7C, 0xFC, 0x0F, 0x05, 0xFD, 0x0C,
-    0x5F, 0x60, 0xCC, 0xFD, 0x0C, 0x0F, 0x61, 0xCC, 0x7A, 0x06, 0x85, 0x95, 0xAB, 0x7E, 0xFF, 0x3F,
-    0xBF, 0x6A, 0xD5, 0x2C, 0x36, 0x92, 0xAC, 0x18, 0x36, 0x4C, 0xA4, 0xF0, 0xFD, 0xF0, 0xDF, 0x1F,
-    0xC6, 0x0C, 0xF8, 0xC7, 0x01, 0xA6, 0x01, 0xB9, 0x2F, 0x91, 0x5E, 0x78, 0x9C, 0x5D, 0xD1, 0xAF,
-    0x4F, 0xC3, 0x50, 0x10, 0x07, 0xF0, 0xDB, 0xC6, 0x0A, 0x59, 0x20, 0x99, 0xC2, 0x52, 0x8F, 0xA9,
-    0xC2, 0x20, 0x28, 0x82, 0x04, 0x07, 0x0E, 0x43, 0xB2, 0x39, 0x24, 0x0B, 0x04, 0x3D, 0x14, 0x02,
-    0xB3, 0x39, 0x42, 0x02, 0x19, 0x06, 0x03, 0x21, 0xE3, 0x0F, 0x20, 0x19, 0x68, 0xC4, 0x66, 0x50,
-    0x13, 0x23, 0x08, 0x14, 0xA1, 0x64, 0x3F, 0x42, 0x06, 0xEB, 0xBE, 0xDC, 0xDD, 0x7B, 0x7D, 0xD9,
-    0x38, 0xD1, 0xF5, 0xB3, 0xB6, 0xDF, 0x77, 0xEF, 0x1E, 0x11, 0xD7, 0x61, 0xFB, 0xF3, 0x6E, 0x91,
-    0x7F, 0x8B, 0x9E, 0x88, 0x5E, 0x20, 0xB5, 0x4C, 0x14, 0x77, 0x84, 0x4F, 0x30, 0x35, 0x17, 0x00,
-    0x59, 0xA2, 0x60, 0x6C, 0xDD, 0x5C, 0x07, 0xF8, 0x83, 0x1E, 0xDF, 0x5E, 0xEE, 0x9D, 0x8D, 0x80,
-    0x5D, 0x71, 0x9E, 0x1F, 0xAF, 0xF2, 0x57, 0xFE, 0x10, 0x91, 0xF8, 0x1E, 0xD8, 0xD7, 0xD4, 0x50,
-    0xBE, 0xF3, 0x68, 0x00, 0xCC, 0xA8, 0xE9, 0x4D, 0x1D, 0xA3, 0x6C, 0x48, 0xA1, 0x98, 0xD7, 0x98,
-    0xB7, 0xA6, 0x21, 0xBB, 0xEA, 0x5E, 0x27, 0xEA, 0xB2, 0x5B, 0x88, 0x12, 0x4A, 0xB4, 0xF7, 0x85,
-    0x9A, 0x73, 0x89, 0xDD, 0xB5, 0xAB, 0x49, 0x71, 0x96, 0xD7, 0xC7, 0x96, 0xB3, 0xAF, 0x5E, 0x73,
-    0xCE, 0xFF, 0x7B, 0x2E, 0xEE, 0xA1, 0x30, 0xF5, 0x7E, 0xD7, 0xB5, 0xA7, 0x0D, 0xF2, 0x7A, 0x0D,
-    0xE7, 0x63, 0x36, 0xF7, 0x90, 0x4A, 0xDC, 0x62, 0x73, 0x0F, 0xB3, 0x89, 0xFB, 0x6C, 0xCE, 0x5C,
-    0x4A, 0x1C, 0xCB, 0x7E, 0x7F, 0x5C, 0x40, 0x55, 0xF7, 0xCF, 0x9B, 0xCA, 0x19, 0x7F, 0xAB, 0x39,
-    0xA0, 0xA9, 0x89, 0x57, 0x50, 0xD3, 0x2F, 0x50, 0xCB, 0x10, 0x1D, 0x8C, 0x51, 0x56, 0x3F, 0xF2,
-    0xDF, 0xD1, 0xC3, 0x07, 0x5F, 0x37, 0xD4, 0x9C, 0x68, 0xAA, 0x10, 0xEA, 0xF9, 0x50, 0xD1, 0x1C,
-    0x50, 0x33, 0xBD, 0x6D, 0x4C, 0x25, 0x5E, 0x18, 0x8D, 0x2C, 0x15, 0x93, 0x59, 0xFA, 0x47, 0xE7,
-    0x3B, 0x29, 0x6D, 0x20, 0x4D, 0x13, 0xF5, 0x3A, 0x31, 0x5B, 0xA9, 0x01, 0xEA, 0x53, 0x8E, 0x27,
-    0x66, 0x45, 0x3A, 0xFE, 0x05, 0xD9, 0xC6, 0x45, 0xC6, 0x4C, 0x6F, 0x64, 0xE2, 0x07, 0x88, 0x36,
-    0x65, 0xF8, 0x7C, 0x7A, 0x15, 0x3B, 0x05, 0x74, 0x6E, 0x9F, 0xA5, 0xA5, 0x9C, 0x9D, 0x9A, 0xAD,
-    0x8A, 0xC9, 0x79, 0xB7, 0xEC, 0x64, 0x6C, 0xF0, 0xB5, 0xB2, 0xEE, 0xCE, 0x9D, 0x82, 0x93, 0x9B,
-    0xD3, 0x15, 0x73, 0xFB, 0x07, 0x49, 0xA2, 0x11, 0x06, 0x78, 0x9C, 0xDD, 0xD2, 0xB1, 0x0D, 0xC2,
-    0x30, 0x10, 0x05, 0xD0, 0x53, 0x62, 0x24, 0x24, 0x02, 0x66, 0x03, 0x36, 0x20, 0xD9, 0x84, 0x35,
-    0x18, 0x83, 0x86, 0x9A, 0x9A, 0x0E, 0xB1, 0x40, 0x18, 0x80, 0x86, 0x09, 0x10, 0x35, 0x45, 0x46,
-    0x70, 0x83, 0xE4, 0x24, 0x16, 0x7C, 0x7E, 0x6C, 0x83, 0x57, 0x40, 0xFC, 0xEE, 0xC9, 0xFA, 0x77,
-    0x2E, 0x4E, 0x32, 0x49, 0xB9, 0x61, 0x94, 0xD0, 0x61, 0x9A, 0xE0, 0xA0, 0x7F, 0x01, 0xF3, 0xED,
-    0x7E, 0x9D, 0x45, 0x54, 0x0E, 0xC0, 0x55, 0x05, 0x74, 0x18, 0xB2, 0xF3, 0xB8, 0x20, 0x64, 0x4C,
-    0x2C, 0x9E, 0x30, 0xE7, 0x3B, 0xB1, 0x22, 0x6A, 0xD4, 0xB9, 0xC8, 0x91, 0x2D, 0x02, 0x46, 0x0D,
-    0x63, 0x2D, 0x90, 0x13, 0x4B, 0xBF, 0xE3, 0xC4, 0x12, 0xE1, 0x1F, 0xA4, 0x02, 0x26, 0xEC, 0xC4,
-    0xF5, 0x2F, 0xCC, 0x1C, 0x87, 0x84, 0xF4, 0xD0, 0x1C, 0x1D, 0xD1, 0xA2, 0x4C, 0x1F, 0xFD, 0x0F,
-    0xF4, 0x5F, 0x58, 0x94, 0x16, 0x45, 0xC4, 0x03, 0xFA, 0xD0, 0x7C, 0xEE, 0x65, 0x63, 0xD4, 0x1B,
-    0xEE, 0x09, 0xB4, 0x33, 0x78, 0x9C, 0x63, 0x10, 0x60, 0x60, 0x98, 0xF0, 0x7F, 0x3E, 0xC3, 0x97,
-    0xFF, 0xFF, 0x99, 0xBF, 0xFE, 0xFF, 0xCF, 0x0A, 0xC4, 0x2C, 0x0F, 0xFF, 0xDF, 0x67, 0x10, 0x28,
-    0x63, 0x65, 0x40, 0x01, 0xD3, 0x58, 0x19, 0x1A, 0xFE, 0xD7, 0x33, 0x5C, 0xF8, 0x7F, 0x1E, 0x88,
-    0xEF, 0xD3, 0x01, 0x9F, 0x67, 0x58, 0xF0, 0x7F, 0x3D, 0x83, 0xC0, 0x1F, 0x69, 0x06, 0x00, 0x89,
-    0x35, 0x5C, 0xB5, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x10, 0x60, 0x00, 0x81, 0x09, 0xFF, 0xE7,
-    0x83, 0xA8, 0x2F, 0xFF, 0xFF, 0x33, 0x03, 0xA9, 0x6F, 0xFF, 0xFF, 0xB3, 0x00, 0xA9, 0xAF, 0x10,
-    0xEA, 0xE1, 0xFF, 0xFB, 0x20, 0x39, 0x81, 0x32, 0x56, 0x06, 0x9C, 0xC0, 0x00, 0x42, 0xFE, 0xB3,
-    0x03, 0x51, 0x1B, 0xFE, 0xEF, 0x07, 0x51, 0x17, 0xFE, 0x9F, 0x1F, 0x2E, 0xD4, 0x03, 0x08, 0xF5,
-    0x01, 0x42, 0x7D, 0x81, 0xF8, 0xEF, 0xCF, 0xFF, 0x7E, 0x20, 0xB9, 0xE0, 0xFF, 0x7F, 0x7B, 0x06,
-    0x86, 0xC2, 0xBF, 0xFF, 0xFF, 0xF3, 0x30, 0x34, 0xFC, 0xFF, 0x0F, 0x0A, 0xC0, 0x8F, 0x40, 0x32,
-    0x9F, 0x81, 0xE1, 0x13, 0x90, 0x02, 0x06, 0xD9, 0x81, 0xFF, 0xFF, 0xB5, 0x40, 0xCA, 0xCB, 0x44,
-    0x41, 0x24, 0x00, 0xDD, 0xFA, 0x7F, 0x9D, 0x78, 0x9C, 0xCD, 0xD0, 0xDB, 0x0D, 0x41, 0x41, 0x10,
-    0xC6, 0x71, 0xF7, 0xDB, 0x79, 0x21, 0xF1, 0x86, 0x44, 0x05, 0xA8, 0x80, 0xD3, 0x01, 0x1D, 0xD0,
-    0x81, 0x12, 0x9C, 0x0E, 0x74, 0x20, 0x3A, 0xA0, 0x03, 0x51, 0x81, 0x28, 0x40, 0x24, 0x14, 0x20,
-    0xE2, 0x12, 0xE2, 0xF2, 0xB7, 0xEB, 0xEC, 0xCC, 0x51, 0x82, 0x7D, 0xFB, 0x25, 0x9B, 0x6F, 0x66,
-    0xBE, 0x58, 0x29, 0x16, 0xBD, 0x00, 0x2F, 0xC2, 0x91, 0x7E, 0x84, 0x13, 0xA3, 0xBF, 0x41, 0xB1,
-    0xFC, 0x83, 0x0B, 0x49, 0xC5, 0x00, 0x0A, 0x8A, 0x1B, 0xE4, 0x05, 0x53, 0xD8, 0xC6, 0x05, 0x0F,
-    0xA8, 0x4A, 0xC0, 0x12, 0x66, 0x12, 0x5D, 0x7F, 0x43, 0x4E, 0xB0, 0x87, 0xA1, 0x0C, 0xF5, 0x81,
-    0x94, 0xE0, 0x0A, 0x6D, 0x59, 0x27, 0x30, 0xB1, 0x09, 0xC1, 0xDD, 0xC6, 0x3A, 0xCC, 0xBF, 0xB1,
-    0x21, 0xC6, 0x4F, 0xE8, 0x08, 0xEC, 0x3B, 0x24, 0x7E, 0x40, 0x43, 0x31, 0xB1, 0x4B, 0x3A, 0x6C,
-    0xE3, 0x26, 0xAE, 0xE6, 0x50, 0xB1, 0xFB, 0xAF, 0x42, 0x2C, 0xC2, 0x03, 0x3C, 0x2D, 0xC4, 0x8D,
-    0x72, 0xF7, 0x98, 0x59, 0x79, 0xC5, 0x1A, 0xC6, 0x8A, 0xE2, 0x0B, 0xB2, 0xDA, 0xDB, 0xCE, 0x9E,
-    0x27, 0xB0, 0x87, 0xA7, 0xB5, 0x37, 0x33, 0xB0, 0xA9, 0x68, 0x99, 0x7F, 0x47, 0xBA, 0xAE, 0xEB,
-    0x33, 0xDD, 0xDE, 0x3B, 0xE7, 0xE0, 0x6F, 0x32, 0x1F, 0xE2, 0x2B, 0xC8, 0x6E, 0x78, 0x9C, 0x63,
-    0x10, 0x64, 0x28, 0xF8, 0xCF, 0xFD, 0xF1, 0x7F, 0xFC, 0xE7, 0xFF, 0xF5, 0xF4, 0x47, 0x1F, 0xFF,
-    0xFB, 0x07, 0xFC, 0x63, 0x07, 0x00, 0x36, 0xBA, 0x66, 0xA6, 0x78, 0x9C, 0xED, 0x8E, 0x41, 0x0E,
-    0xC1, 0x60, 0x10, 0x85, 0x47, 0xDB, 0xC4, 0x82, 0xAA, 0x13, 0xA8, 0x13, 0x88, 0x1B, 0x70, 0x03,
-    0x5B, 0x3B, 0x5B, 0x4B, 0x97, 0x60, 0xCB, 0xB6, 0xAB, 0xBA, 0x41, 0xC3, 0x96, 0x84, 0xC4, 0x01,
-    0x1A, 0x2E, 0x40, 0x62, 0x69, 0xD1, 0x44, 0x22, 0xD4, 0x5F, 0x9E, 0x99, 0xF6, 0x57, 0x2E, 0x60,
-    0x67, 0x56, 0xDF, 0xFB, 0x32, 0x79, 0x33, 0x64, 0x10, 0x51, 0x7D, 0xE4, 0x75, 0x0B, 0x24, 0x53,
-    0x1D, 0x7A, 0x7D, 0x31, 0x5B, 0x58, 0xD4, 0x56, 0x00, 0x02, 0x49, 0x4D, 0xA1, 0xD0, 0x22, 0x8A,
-    0x61, 0x57, 0xEF, 0x90, 0xE9, 0xF1, 0x6E, 0x46, 0x63, 0x22, 0x05, 0x67, 0x87, 0x6C, 0x2C, 0x3A,
-    0x6A, 0x2A, 0xB2, 0x76, 0x9F, 0x88, 0x16, 0x27, 0x0E, 0xB5, 0x36, 0x10, 0x2D, 0x85, 0x5A, 0xAC,
-    0x43, 0x04, 0x26, 0xD1, 0x06, 0xF0, 0xCF, 0xF0, 0x99, 0xE6, 0xC0, 0x8A, 0x35, 0x22, 0x4B, 0x7E,
-    0xE0, 0xDA, 0x24, 0x32, 0x85, 0x62, 0xC0, 0x60, 0xDD, 0x48, 0x5F, 0x3B, 0x48, 0x4D, 0x4A, 0x6B,
-    0x2E, 0x57, 0x72, 0x4A, 0x66, 0xC0, 0x3A, 0x5D, 0x26, 0x3E, 0x51, 0x52, 0x08, 0x52, 0xA6, 0x3A,
-    0x97, 0x67, 0x44, 0x80, 0xAD, 0xD0, 0xC9, 0x43, 0x4B, 0x53, 0x02, 0x87, 0x1F, 0xD4, 0xE1, 0x01,
-    0x47, 0x53, 0x0C, 0x57, 0xE5, 0x21, 0x41, 0x45, 0xD3, 0xED, 0xAF, 0x7F, 0xA6, 0xEF, 0x5F, 0xDA,
-    0xFE, 0xE8, 0x2B, 0xCA, 0x3A, 0xC4, 0x28, 0x69, 0xBA, 0xA0, 0x32, 0xDD, 0x1B, 0x3A, 0xCC, 0xC2,
-    0x37, 0x4D, 0xF6, 0xE6, 0x0B, 0xEE, 0xD9, 0xF5, 0x1B, 0x78, 0x9C, 0x63, 0x60, 0x62, 0x60, 0x60,
-    0x30, 0x38, 0xF1, 0xF6, 0xAC, 0x27, 0x90, 0xBE, 0xF8, 0x9F, 0x85, 0x21, 0xE0, 0xEF, 0x7F, 0x20,
-    0xF0, 0x65, 0x60, 0xF8, 0xF9, 0x9F, 0x57, 0xE0, 0xF7, 0x7F, 0x30, 0x60, 0x67, 0xF8, 0xFD, 0x9F,
-    0xFF, 0x11, 0x84, 0xFD, 0x3F, 0x1F, 0xC8, 0x91, 0xFF, 0xF7, 0x7F, 0x7F, 0x46, 0x1B, 0x48, 0x96,
-    0xF1, 0xF7, 0xFF, 0xF3, 0xFF, 0xEB, 0x19, 0x19, 0x18, 0x40, 0x6A, 0x39, 0x80, 0xF8, 0x3E, 0xC8,
-    0x40, 0x86, 0x0D, 0xFF, 0xFF, 0xF3, 0x01, 0x39, 0xB2, 0x20, 0x36, 0x83, 0xC0, 0xBF, 0xFF, 0xF6,
-    0x40, 0x0E, 0x58, 0x82, 0x81, 0xE1, 0xC7, 0xFF, 0xFC, 0xDF, 0xFF, 0xE7, 0x43, 0xD8, 0x0C, 0x5F,
-    0xFE, 0xCF, 0xFF, 0xFD, 0xDF, 0x1E, 0xCA, 0xF9, 0xF8, 0x7F, 0x3D, 0xD0, 0x1E, 0x28, 0xE7, 0xC3,
-    0xFF, 0xFD, 0x08, 0xCE, 0x83, 0xFF, 0xE7, 0x87, 0x01, 0xE7, 0x17, 0x12, 0x67, 0xFF, 0xF7, 0xFF,
-    0x3C, 0x50, 0xCE, 0x86, 0xFF, 0xFD, 0x0B, 0xEE, 0x43, 0x03, 0x87, 0x41, 0xE1, 0x8F, 0x34, 0x00,
-    0x78, 0x15, 0xA6, 0x02, 0x78, 0x9C, 0x5D, 0x91, 0x31, 0x4E, 0x42, 0x41, 0x10, 0x86, 0x47, 0x50,
-    0x40, 0x42, 0xF0, 0x1D, 0xC0, 0x90, 0xD7, 0x50, 0x9A, 0x70, 0x03, 0xB9, 0x08, 0x51, 0x63, 0x61,
-    0x09, 0x2D, 0xB1, 0x80, 0x8A, 0x12, 0x62, 0x47, 0xC7, 0x0D, 0xD4, 0xD2, 0xC6, 0xA0, 0x27, 0xE0,
-    0x02, 0xC6, 0xE7, 0x05, 0x0C, 0x08, 0x2F, 0x40, 0x7C, 0xC8, 0xCF, 0xCC, 0xEE, 0xCC, 0x16, 0xFE,
-    0xC9, 0x7B, 0xBB, 0xDF, 0xEE, 0xEC, 0xEC, 0x3F, 0xB3, 0x44, 0xAC, 0xE6, 0xCB, 0xF7, 0xE7, 0x7D,
-    0x9E, 0x4C, 0x0F, 0x10, 0x25, 0x05, 0xC5, 0x0E, 0xBC, 0x12, 0x1F, 0x11, 0x65, 0xCA, 0xE8, 0x39,
-    0x7E, 0xE7, 0xD9, 0xE3, 0xDD, 0x40, 0x56, 0x4B, 0xC2, 0x3B, 0xA0, 0x25, 0x61, 0x1B, 0xA0, 0xCD,
-    0x63, 0x1F, 0x98, 0xB8, 0xB8, 0x98, 0x37, 0x38, 0xC3, 0x12, 0x28, 0xFA, 0xBC, 0x6F, 0x40, 0x85,
-    0x28, 0xC3, 0x93, 0xDE, 0x13, 0xED, 0x71, 0x45, 0x31, 0x50, 0x33, 0x1F, 0x29, 0x66, 0x72, 0xBC,
-    0x68, 0xCC, 0x07, 0x72, 0xFC, 0x1D, 0x19, 0x5F, 0xF3, 0xDE, 0x02, 0xD3, 0xE0, 0x3B, 0x02, 0xCA,
-    0x4B, 0x8C, 0x02, 0xD3, 0x1E, 0x95, 0xD4, 0x99, 0x50, 0xED, 0x50, 0x4D, 0xF9, 0x8E, 0xA0, 0x0C,
-    0x67, 0xFF, 0xB8, 0xBA, 0xD2, 0xAA, 0x2C, 0xFE, 0x47, 0xDD, 0x3B, 0xB1, 0xE1, 0x05, 0x92, 0x80,
-    0x0D, 0xE0, 0xF4, 0x99, 0x3D, 0x19, 0xB3, 0xD7, 0x13, 0xF6, 0x54, 0x36, 0xFE, 0x12, 0xAF, 0xC0,
-    0xA5, 0xF1, 0x56, 0x4A, 0xDD, 0x22, 0xD1, 0x02, 0x9A, 0x6E, 0x8B, 0x83, 0xCE, 0x3D, 0xAF, 0x38,
-    0x9D, 0x5B, 0x9D, 0xE7, 0xB5, 0xBA, 0xB9, 0x8C, 0xDC, 0xC7, 0xE9, 0x31, 0xD1, 0xCD, 0x9F, 0x66,
-    0xEA, 0x4B, 0xEB, 0x5F, 0x3F, 0xE4, 0xEF, 0x1F, 0x64, 0x6D, 0xEF, 0x71, 0xE1, 0xF3, 0xC4, 0xFA,
-    0x40, 0xA1, 0x11, 0x8D, 0x5F, 0xC1, 0x61, 0xE8, 0x1B, 0xD1, 0xED, 0xB8, 0x5B, 0xF7, 0xB3, 0x03,
-    0xC5, 0x7A, 0xBB, 0x38, 0x78, 0x9C, 0xBD, 0xD1, 0xBD, 0x32, 0x04, 0x41, 0x14, 0x05, 0xE0, 0x3B,
-    0xD8, 0xC5, 0xDA, 0x9F, 0x7E, 0x01, 0x56, 0x20, 0x11, 0xA8, 0xDD, 0x54, 0x44, 0x24, 0x56, 0x62,
-    0xE5, 0x15, 0x64, 0xAA, 0x44, 0x24, 0x12, 0x09, 0xA9, 0x68, 0x3D, 0x82, 0x5C, 0xE4, 0x05, 0x48,
-    0x65, 0xAA, 0x08, 0x44, 0x6A, 0x4A, 0x29, 0x3F, 0x33, 0xD7, 0xEC, 0x71, 0x4F, 0x4F, 0x4F, 0xCF,
-    0xEE, 0x0B, 0x38, 0xC1, 0xD4, 0x7C, 0x75, 0x7B, 0xEE, 0x74, 0xDF, 0x76, 0x6B, 0x22, 0xE2, 0xCE,
-    0xAE, 0x8E, 0x67, 0x85, 0x79, 0x46, 0x53, 0xB6, 0x15, 0x40, 0xBA, 0x4E, 0x66, 0xE8, 0x3A, 0xCA,
-    0xB2, 0x60, 0x54, 0xF4, 0x5E, 0x4A, 0xE1, 0x21, 0x21, 0x07, 0xF6, 0x76, 0x7F, 0x5B, 0xD8, 0x73,
-    0x99, 0x7C, 0x02, 0x36, 0xAD, 0xDB, 0xAB, 0x95, 0x49, 0x60, 0x83, 0x4D, 0x5C, 0x0E, 0xCC, 0x93,
-    0xFC, 0xC6, 0x72, 0x09, 0x0C, 0xC8, 0x15, 0x29, 0xA3, 0x18, 0x91, 0x8D, 0xC0, 0x77, 0x80, 0xAD,
-    0x82, 0xE4, 0xD4, 0x2A, 0x8A, 0xC3, 0x8A, 0xAB, 0x40, 0xCB, 0xFE, 0x5B, 0x51, 0x0A, 0x74, 0x6C,
-    0x57, 0x91, 0x19, 0x7A, 0x8A, 0x4E, 0xE4, 0x37, 0xFA, 0x8A, 0x76, 0xE4, 0xD7, 0x34, 0x7D, 0xB5,
-    0x5E, 0xFC, 0xC3, 0x6F, 0xEB, 0x56, 0x39, 0xB9, 0x15, 0x39, 0x46, 0x5B, 0x71, 0x51, 0x69, 0x08,
-    0x2C, 0x2A, 0xD2, 0x8A, 0xD7, 0xC0, 0x9C, 0xF2, 0x94, 0x65, 0x3E, 0xAC, 0xA2, 0x88, 0xBB, 0x2C,
-    0x70, 0x42, 0xA6, 0x33, 0x5E, 0x37, 0x40, 0xD7, 0x0F, 0xE7, 0xC0, 0x9F, 0xE7, 0x97, 0x27, 0xF7,
-    0xA3, 0xDB, 0x4F, 0x64, 0x98, 0xC1, 0x86, 0x61, 0xEC, 0x8F, 0x6D, 0xFD, 0x1B, 0x07, 0xBD, 0xE4,
-    0xC7, 0x7E, 0x17, 0xC6, 0x3E, 0x2A, 0x6F, 0xC1, 0xB6, 0xCE, 0xA4, 0x8D, 0x40, 0xF7, 0xC8, 0x2B,
-    0x69, 0x4A, 0xA0, 0xC8, 0xDE, 0xD1, 0x4E, 0x22, 0x35, 0x63, 0xFE, 0x8D, 0xF9, 0x34, 0x3F, 0xD1,
-    0x9A, 0xE4, 0xEE, 0xF9, 0xA4, 0xE4, 0x0F, 0x5F, 0x89, 0xDE, 0xDF, 0x78, 0x9C, 0xC5, 0xD1, 0xBD,
-    0x4A, 0x03, 0x41, 0x14, 0x05, 0xE0, 0x1B, 0x36, 0x10, 0x11, 0x8B, 0x7D, 0x01, 0x25, 0xAD, 0x95,
-    0xA9, 0x6C, 0x15, 0x7C, 0x80, 0xF8, 0x06, 0xA6, 0xB3, 0x8B, 0x3E, 0x81, 0xB1, 0x12, 0x04, 0x71,
-    0x56, 0xB0, 0x14, 0x6C, 0x4D, 0x95, 0x17, 0x10, 0xD4, 0xC2, 0x3E, 0x62, 0x2B, 0x8A, 0x95, 0x65,
-    0x92, 0x31, 0x09, 0x68, 0x7E, 0x8E, 0xE7, 0xDE, 0xCC, 0x0E, 0x9B, 0x27, 0xF0, 0x14, 0x3B, 0xF3,
-    0xB1, 0x3B, 0x3F, 0xF7, 0xAE, 0x08, 0x73, 0xFD, 0xF6, 0x7E, 0x53, 0xE6, 0xB8, 0xA7, 0x90, 0x2F,
-    0x30, 0xBD, 0x8A, 0x64, 0x58, 0xA7, 0x5E, 0x61, 0xF9, 0x48, 0x06, 0x38, 0x12, 0xD9, 0x47, 0x48,
-    0xDD, 0xC3, 0x89, 0x8C, 0x38, 0xBB, 0x38, 0xBC, 0xE3, 0x73, 0x4C, 0x56, 0x39, 0x6E, 0x72, 0x49,
-    0x63, 0xCE, 0x89, 0x93, 0x47, 0x7E, 0x65, 0x1B, 0x3E, 0x19, 0xC7, 0x40, 0x62, 0x94, 0xA9, 0x72,
-    0xA6, 0xDB, 0x59, 0x3E, 0xC9, 0x5D, 0x60, 0x2D, 0xB0, 0x41, 0x66, 0x40, 0x39, 0x50, 0xE6, 0x70,
-    0x5D, 0xF4, 0x72, 0xC9, 0x0F, 0x5C, 0x1F, 0xB7, 0x91, 0x43, 0x38, 0x1F, 0x77, 0x12, 0x19, 0xC0,
-    0x0D, 0xC3, 0xA9, 0x9A, 0xBE, 0x72, 0x67, 0x99, 0x4B, 0x6F, 0xBF, 0x71, 0x50, 0xA4, 0x47, 0x2B,
-    0xD2, 0xEB, 0x41, 0x0F, 0x91, 0x2C, 0x90, 0x05, 0x95, 0x72, 0x4E, 0xE0, 0x8E, 0x81, 0x4A, 0x50,
-    0xCA, 0x3B, 0xB3, 0xFA, 0x8D, 0xC0, 0x4C, 0x0B, 0x9C, 0xA0, 0x13, 0xEF, 0x48, 0x7A, 0x60, 0xC5,
-    0x54, 0xB3, 0x6E, 0x9C, 0x02, 0x1D, 0xDB, 0x6C, 0x64, 0xD4, 0x9E, 0x9C, 0xD0, 0xCF, 0xC0, 0xAF,
-    0xF2, 0x45, 0x7F, 0xC1, 0xFD, 0x8C, 0x1F, 0x59, 0x9F, 0xD3, 0x69, 0x68, 0xFB, 0xAA, 0x51, 0x57,
-    0x6B, 0x9A, 0xB2, 0xA0, 0x5C, 0x69, 0xC7, 0x2F, 0x4B, 0x39, 0xA5, 0x76, 0x76, 0xBE, 0xBD, 0x28,
-    0x41, 0x0A, 0xF9, 0x3F, 0xB6, 0x8A, 0xEC, 0x62, 0xAB, 0xC8, 0xB4, 0x9D, 0xFC, 0x01, 0x01, 0xC9,
-    0xEE, 0xCF, 0x78, 0x9C, 0x63, 0x60, 0x62, 0x60, 0x60, 0x70, 0x38, 0x79, 0xCF, 0x8A, 0xE1, 0xE2,
-    0x7F, 0x16, 0x06, 0x87, 0xBF, 0xFF, 0xFF, 0xFF, 0x67, 0xFE, 0xF9, 0x9F, 0x97, 0xE1, 0x07, 0x90,
-    0xF1, 0x9F, 0xED, 0xF7, 0x7F, 0xFE, 0x09, 0x20, 0xC6, 0x7F, 0x16, 0x20, 0xEB, 0xDB, 0xFF, 0x5A,
-    0xE3, 0xAD, 0x39, 0x0C, 0xBF, 0xFF, 0xEB, 0xFF, 0xAF, 0x67, 0x00, 0x81, 0xDF, 0xFF, 0xD7, 0x03,
-    0xF5, 0x40, 0x58, 0xFF, 0xF3, 0x19, 0x60, 0x2C, 0x6E, 0x38, 0x8B, 0x09, 0xC6, 0xDA, 0xCF, 0x00,
-    0x63, 0xE5, 0xC3, 0x59, 0xFA, 0x70, 0x16, 0xFF, 0x20, 0x64, 0xFD, 0x82, 0xB3, 0xBE, 0xFF, 0xE7,
-    0x81, 0xB2, 0x16, 0xDC, 0x87, 0x7A, 0x88, 0x01, 0x00, 0x72, 0x31, 0x58, 0xB2, 0x78, 0x9C, 0x63,
-    0x60, 0x60, 0x50, 0x58, 0xFE, 0xF6, 0x5E, 0x37, 0x0B, 0x03, 0x08, 0x18, 0xFC, 0xFE, 0x0F, 0x04,
-    0xEF, 0xD9, 0x41, 0xEC, 0xEF, 0xFF, 0xC1, 0xE0, 0x3E, 0x33, 0x03, 0x43, 0xC3, 0x7F, 0x28, 0xF0,
-    0x67, 0x60, 0xF8, 0xFA, 0xFF, 0x7F, 0xB4, 0x90, 0xE2, 0x32, 0x20, 0x87, 0x89, 0xE1, 0xEF, 0xFF,
-    0x78, 0x90, 0xCA, 0x4D, 0xFF, 0xFF, 0xB3, 0x1B, 0x00, 0x31, 0xD8, 0x88, 0x9F, 0xFF, 0x59, 0x12,
-    0xFE, 0xFF, 0x67, 0x04, 0xB3, 0x13, 0xB2, 0x18, 0x0A, 0xFE, 0xFF, 0x67, 0x80, 0x81, 0x02, 0x90,
-    0x1E, 0x28, 0x70, 0xF8, 0xFF, 0x9F, 0x0B, 0x2E, 0xF1, 0xFF, 0x7F, 0x3F, 0x9C, 0xFD, 0xE3, 0xFF,
-    0xFF, 0x5A, 0x46, 0x28, 0xFB, 0x00, 0xD0, 0x96, 0xFD, 0x6A, 0x10, 0xB6, 0xC0, 0x1F, 0x90, 0x03,
-    0xE6, 0x42, 0xDC, 0x99, 0xF0, 0x0F, 0xE1, 0x4E, 0x86, 0x84, 0x3F, 0x30, 0x77, 0x02, 0x81, 0xC2,
-    0x76, 0xA8, 0x3B, 0xC1, 0x20, 0xE0, 0x17, 0x50, 0x15, 0xCC, 0x34, 0x90, 0x8F, 0x38, 0x61, 0x6C,
-    0x83, 0x7F, 0xFF, 0xF9, 0xE0, 0x76, 0x7E, 0xFB, 0x2F, 0x2F, 0xC0, 0x0C, 0x65, 0x7F, 0xFA, 0xAF,
-    0xFF, 0xE5, 0x3C, 0x54, 0xCB, 0xC7, 0xFF, 0xFA, 0x7F, 0xFE, 0xCB, 0x40, 0xD8, 0x5F, 0xFE, 0xF3,
-    0xFF, 0xFE, 0x7F, 0x1F, 0xE2, 0xFE, 0x3F, 0xFF, 0x79, 0x3E, 0x01, 0xDD, 0x0C, 0x52, 0xB5, 0xF1,
-    0xFF, 0x7F, 0x56, 0x07, 0x90, 0x33, 0xC3, 0x43, 0x80, 0x36, 0xEF, 0x67, 0x60, 0x78, 0x0C, 0x0B,
-    0x2B, 0x1E, 0xA0, 0x9B, 0x7F, 0x41, 0x98, 0xF3, 0xC1, 0x2E, 0xBB, 0x01, 0x62, 0xAE, 0x87, 0x86,
-    0x40, 0x50, 0x7B, 0xA7, 0x19, 0x88, 0x06, 0x00, 0x71, 0xB0, 0x97, 0x35, 0x78, 0x9C, 0x63, 0x60,
-    0x60, 0x30, 0xB8, 0xC3, 0xC1, 0x00, 0x01, 0x0F, 0xFE, 0xC7, 0x43, 0x59, 0x1F, 0xFF, 0xF7, 0x43,
-    0x59, 0x9F, 0x48, 0x63, 0x19, 0xFC, 0xFD, 0x0F, 0x06, 0xF7, 0x59, 0x1E, 0xFC, 0x87, 0x02, 0xBE,
-    0x0F, 0x30, 0x16, 0x7F, 0x01, 0x8C, 0xC5, 0xC1, 0x10, 0x1C, 0xFA, 0xED, 0xFF, 0xFE, 0xD0, 0x50,
-    0x53, 0x32, 0xEC, 0x18, 0x14, 0xAC, 0x8F, 0xFF, 0xE7, 0x43, 0x59, 0x1F, 0xFE, 0xDF, 0x87, 0xB2,
-    0x2E, 0xFC, 0xFF, 0x6F, 0x1D, 0x28, 0x0E, 0x62, 0x35, 0x80, 0x3C, 0xB9, 0x1F, 0xC4, 0x12, 0xF8,
-    0x07, 0x62, 0x82, 0xA5, 0xBF, 0x00, 0x19, 0x10, 0x4D, 0x02, 0x27, 0xFE, 0x9D, 0x67, 0x63, 0x00,
-    0x00, 0xC5, 0xA7, 0x80, 0x32, 0x78, 0x9C, 0x63, 0x60, 0x62, 0x80, 0x01, 0x41, 0x86, 0x8B, 0xFF,
-    0x59, 0xA0, 0xEC, 0x05, 0xFF, 0x39, 0x7E, 0xFE, 0xE7, 0x85, 0x72, 0xBE, 0xFE, 0x97, 0xFF, 0xFD,
-    0x9F, 0x1F, 0xCA, 0xF9, 0xFE, 0xDF, 0x7E, 0x18, 0x70, 0x7E, 0xA1, 0x72, 0xE4, 0xA1, 0x9C, 0x1F,
-    0xFF, 0xF5, 0x7F, 0xFC, 0xB7, 0x87, 0x72, 0x80, 0x6A, 0xBE, 0xFE, 0xAF, 0x87, 0x72, 0xFE, 0xFD,
-    0xE7, 0xFB, 0xF8, 0xFF, 0x3E, 0x84, 0x1D, 0xF0, 0xFF, 0x3F, 0xD7, 0x81, 0xFF, 0xFF, 0x39, 0xC0,
-    0x9C, 0x87, 0xFF, 0xFF, 0xB3, 0x02, 0x05, 0xC0, 0xEA, 0x04, 0xFE, 0x80, 0x94, 0xFC, 0xF9, 0xFF,
-    0x3F, 0x86, 0x91, 0xC1, 0xE0, 0xC7, 0xFF, 0xFF, 0xF1, 0x0C, 0x0C, 0x8F, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x2D, 0x90, 0xF8, 0xCF, 0xC9, 0xC0, 0x60, 0xF0, 0xEF, 0x3F, 0x04, 0xCC, 0x07, 0xA9, 0x5E,
-    0x08, 0x61, 0xBF, 0x67, 0x03, 0x9B, 0xB3, 0x18, 0x24, 0x77, 0x9E, 0x1D, 0x6A, 0x9D, 0x42, 0x6A,
-    0xB9, 0x1B, 0x23, 0x88, 0x01, 0x00, 0x7E, 0x63, 0x94, 0xEF, 0x78, 0x9C, 0x6D, 0x91, 0xCD, 0x55,
-    0xC2, 0x50, 0x10, 0x85, 0x47, 0x4F, 0x38, 0xCA, 0x41, 0x30, 0x1D, 0x48, 0x07, 0xD0, 0x81, 0x74,
-    0x20, 0x6B, 0x57, 0x76, 0xA0, 0x1D, 0x48, 0x09, 0xAE, 0xDC, 0x9A, 0xA5, 0x3B, 0xD2, 0x41, 0x52,
-    0x82, 0x1D, 0x40, 0x07, 0x80, 0x8A, 0x88, 0x48, 0x3E, 0xE7, 0xCD, 0xFB, 0x39, 0x59, 0x78, 0x17,
-    0x99, 0x7C, 0x39, 0xC9, 0xBC, 0x7B, 0x6F, 0xF2, 0xD7, 0x8E, 0x44, 0xCD, 0x6E, 0xA5, 0xE4, 0x3E,
-    0xE1, 0x9E, 0x6C, 0xCD, 0x2A, 0x52, 0x0E, 0x67, 0x35, 0xC4, 0xB7, 0x67, 0x90, 0x4D, 0xE1, 0x22,
-    0xE0, 0x92, 0x85, 0x48, 0xC3, 0x28, 0xE0, 0xD6, 0xAD, 0xD9, 0xF1, 0x12, 0xF0, 0x97, 0x81, 0xC8,
-    0x06, 0x4E, 0x8C, 0xC6, 0x70, 0x2E, 0xF2, 0xA4, 0xFB, 0x0C, 0x0B, 0x7B, 0x3E, 0x84, 0xBE, 0xE1,
-    0x86, 0xB9, 0x1B, 0x07, 0x6E, 0x0C, 0x77, 0x5C, 0xBB, 0xF1, 0x49, 0x65, 0xD8, 0xF8, 0x13, 0xDF,
-    0xE0, 0x54, 0xC7, 0x34, 0xF8, 0xB9, 0x83, 0xAE, 0x8E, 0x3A, 0xBA, 0x85, 0x4B, 0xBD, 0x7E, 0xF0,
-    0xE8, 0xF1, 0xDB, 0x6E, 0xF6, 0x5C, 0x79, 0x7C, 0x77, 0x5E, 0x73, 0xFF, 0x89, 0xAA, 0xD4, 0x24,
-    0xF2, 0xE0, 0x17, 0xAA, 0x26, 0xD0, 0xD3, 0x38, 0x55, 0xCC, 0x7D, 0xD4, 0x50, 0xDB, 0x60, 0x46,
-    0xF5, 0xA5, 0xA1, 0x0E, 0xC1, 0xAA, 0xE5, 0x66, 0x18, 0x83, 0xF8, 0x56, 0x9E, 0x21, 0x35, 0xA8,
-    0x87, 0x1C, 0x53, 0x09, 0xAA, 0x1F, 0x48, 0x15, 0x99, 0x41, 0x77, 0x56, 0x92, 0xB6, 0xAB, 0x4E,
-    0x92, 0x34, 0xDC, 0x42, 0x5A, 0x6A, 0x5A, 0xBF, 0xC6, 0x8A, 0x19, 0xB4, 0xB1, 0x58, 0x65, 0xF2,
-    0x9F, 0xFE, 0x00, 0x7F, 0x59, 0x85, 0x98, 0x78, 0x9C, 0x75, 0x51, 0xCD, 0x4D, 0xC3, 0x50, 0x0C,
-    0x76, 0x0B, 0x94, 0x20, 0xDA, 0x8A, 0x09, 0x08, 0x1B, 0xB4, 0x62, 0x81, 0x76, 0x02, 0x60, 0x03,
-    0x2A, 0x31, 0x00, 0x23, 0x84, 0x0D, 0xE0, 0xCC, 0x05, 0x24, 0x2E, 0xDC, 0xC8, 0x06, 0x85, 0x23,
-    0xA7, 0x74, 0x83, 0xB0, 0x41, 0x0B, 0xA1, 0x2A, 0x09, 0xD0, 0x8F, 0xEF, 0xD9, 0x2E, 0x28, 0x95,
-    0xB0, 0x94, 0x38, 0xF6, 0x7B, 0xF1, 0xF7, 0x63, 0xB9, 0x6F, 0x49, 0x3D, 0x86, 0xD7, 0x8D, 0x14,
-    0xA7, 0x6B, 0xCD, 0x37, 0x74, 0x66, 0x18, 0xAF, 0x35, 0x4B, 0xF4, 0x26, 0x40, 0xA3, 0xDE, 0x5C,
-    0x22, 0xBE, 0x00, 0xEA, 0x43, 0xFB, 0xC0, 0xEE, 0x01, 0x1F, 0xAB, 0x0E, 0x2D, 0x5D, 0x01, 0x5B,
-    0xF2, 0x8D, 0xD8, 0x0B, 0x3B, 0x7C, 0x01, 0x44, 0x16, 0x38, 0x77, 0xD0, 0x63, 0xCD, 0xEF, 0x78,
-    0x08, 0x45, 0xA6, 0xC5, 0x47, 0x28, 0x14, 0x9C, 0x1C, 0x1F, 0x1D, 0x7E, 0xF9, 0x9B, 0xBB, 0x22,
-    0x23, 0x60, 0x9B, 0xDF, 0x27, 0xB0, 0x3C, 0x04, 0x76, 0x44, 0xF6, 0x80, 0x36, 0x8B, 0x94, 0x4D,
-    0x5E, 0x91, 0x5B, 0x60, 0x93, 0xE9, 0x13, 0x3D, 0xBE, 0x5F, 0xD9, 0x0C, 0x48, 0x33, 0x4C, 0xC3,
-    0x90, 0x39, 0x12, 0xC5, 0x79, 0x56, 0xC1, 0x73, 0xDC, 0x88, 0x9E, 0xE5, 0x3A, 0xFF, 0x4C, 0x91,
-    0x2A, 0x0C, 0xC4, 0xA6, 0x34, 0x39, 0x3F, 0x17, 0x20, 0x12, 0xB1, 0xC9, 0x01, 0x2F, 0xE2, 0x49,
-    0x42, 0x86, 0xDD, 0x40, 0x22, 0x72, 0x5B, 0x3A, 0xC4, 0x89, 0xA5, 0x20, 0xED, 0x34, 0xFC, 0x66,
-    0x1A, 0x06, 0x14, 0xDB, 0xA6, 0x8C, 0xB1, 0x03, 0x30, 0x0A, 0x5C, 0xD2, 0x96, 0x56, 0x90, 0xD1,
-    0x34, 0x2A, 0x8C, 0x09, 0xA6, 0xFD, 0x60, 0x4D, 0x40, 0x32, 0xD2, 0x0C, 0xFA, 0x7C, 0xA7, 0x6E,
-    0x94, 0xD8, 0x37, 0x79, 0x0C, 0xFA, 0x5C, 0xA9, 0x9A, 0x02, 0x99, 0x19, 0x10, 0xE2, 0xCB, 0x75,
-    0xD3, 0xB0, 0xBF, 0x8D, 0x2D, 0xA0, 0xD6, 0x04, 0x24, 0x37, 0xD7, 0xCD, 0xD8, 0x10, 0x45, 0xF2,
-    0x35, 0x98, 0x6D, 0xB9, 0x33, 0xF6, 0x85, 0xD9, 0x6F, 0x89, 0x33, 0x5E, 0xAD, 0x56, 0x7D, 0x8E,
-    0x9D, 0x31, 0xD7, 0xBB, 0x8A, 0xCA, 0x2F, 0x8C, 0x54, 0x83, 0xC7, 0x53, 0x66, 0x2E, 0x48, 0x79,
-    0x24, 0xFF, 0xC6, 0x0F, 0x68, 0xD5, 0xDC, 0xBF, 0x78, 0x9C, 0x45, 0x8F, 0xCD, 0x4D, 0x02, 0x51,
-    0x14, 0x85, 0xAF, 0x43, 0x00, 0x01, 0x49, 0x2C, 0x40, 0x09, 0x7B, 0x16, 0xEC, 0xDC, 0x0E, 0x1D,
-    0x68, 0x07, 0xB8, 0x72, 0x2B, 0x1B, 0xD7, 0xD8, 0xC1, 0x4C, 0x07, 0xD8, 0x01, 0x74, 0x00, 0x1D,
-    0x38, 0x1D, 0x10, 0x68, 0x80, 0x64, 0x74, 0x34, 0x1A, 0x87, 0xCF, 0x7B, 0xDF, 0x0F, 0xDC, 0xC5,
-    0xCB, 0x39, 0xEF, 0xE6, 0xFC, 0x5C, 0x79, 0x92, 0x38, 0x2F, 0x49, 0x41, 0x3F, 0xE0, 0x57, 0xD2,
-    0x8A, 0x65, 0x20, 0x15, 0xD9, 0x27, 0xB4, 0x1D, 0x1E, 0xC2, 0x74, 0x05, 0xF7, 0x8E, 0x6C, 0xA0,
-    0x7B, 0x7D, 0xE4, 0x70, 0x61, 0xE4, 0x87, 0xAD, 0xC8, 0x07, 0x5C, 0x29, 0x7E, 0x80, 0xB1, 0xC8,
-    0x23, 0x2C, 0x94, 0x94, 0xD0, 0x74, 0x7B, 0x5A, 0x22, 0x7F, 0x64, 0x41, 0x99, 0x4A, 0x0E, 0x3D,
-    0x23, 0xCE, 0xA2, 0x0A, 0x36, 0xA2, 0x51, 0xA3, 0xA3, 0x6E, 0xDD, 0xCC, 0xB0, 0x69, 0x85, 0x22,
-    0xBF, 0x8A, 0x63, 0x29, 0x29, 0x94, 0xC4, 0xBA, 0x56, 0x8B, 0xE4, 0x74, 0x49, 0xAD, 0xBD, 0x22,
-    0x7E, 0xD3, 0xCD, 0x3C, 0x92, 0x6F, 0x73, 0x6B, 0x78, 0x3C, 0x81, 0x03, 0x0C, 0x3C, 0xD9, 0xC3,
-    0x1D, 0xBC, 0x47, 0xF9, 0x52, 0xBE, 0xA0, 0x13, 0xE4, 0x7D, 0x2B, 0x3A, 0x0D, 0xF2, 0xC4, 0x4E,
-    0xB0, 0x77, 0xE2, 0xFF, 0x76, 0x70, 0xEB, 0xDE, 0x4B, 0x6F, 0xB9, 0xB6, 0xFD, 0x3A, 0x86, 0xB5,
-    0xF3, 0x98, 0xA0, 0x3E, 0x69, 0x79, 0xCA, 0xAE, 0x59, 0x94, 0x3C, 0x87, 0x52, 0x25, 0xD9, 0xCC,
-    0xC9, 0x7D, 0xAB, 0x1B, 0x39, 0xCF, 0x50, 0xFE, 0x01, 0xCC, 0xD5, 0x9A, 0x12, 0x78, 0x9C, 0xDD,
-    0x91, 0x3F, 0x0E, 0x01, 0x51, 0x10, 0xC6, 0xC7, 0x9F, 0x44, 0x08, 0xB1, 0x85, 0x44, 0x25, 0x5C,
-    0x40, 0xB8, 0xC1, 0xEA, 0x74, 0xB2, 0x37, 0x20, 0xD1, 0x2A, 0x28, 0xB7, 0x53, 0x49, 0x74, 0x2A,
-    0x89, 0x1B, 0x88, 0x44, 0x70, 0x02, 0x2E, 0xA0, 0x50, 0x6F, 0x21, 0x4E, 0x20, 0xD9, 0x04, 0x6B,
-    0x17, 0x9F, 0x99, 0xB7, 0x6F, 0xD7, 0x1D, 0x4C, 0xF1, 0xF2, 0xFD, 0x5E, 0x66, 0xBE, 0xF9, 0x5E,
-    0x5E, 0xCB, 0x26, 0x5D, 0xCD, 0x69, 0xE2, 0x86, 0x9C, 0x06, 0x17, 0x05, 0x1F, 0x45, 0x0D, 0x77,
-    0x98, 0x41, 0x0C, 0x8F, 0xFF, 0x83, 0xDF, 0x4B, 0x3D, 0x81, 0x86, 0x86, 0x17, 0x4C, 0x0F, 0xDD,
-    0x50, 0xD7, 0x00, 0xF3, 0x8E, 0x7D, 0x08, 0x5B, 0x06, 0x17, 0x48, 0xE9, 0x79, 0x98, 0x07, 0xA0,
-    0x22, 0x7A, 0x0C, 0x06, 0x0B, 0xB8, 0x96, 0x89, 0xAC, 0xB7, 0x00, 0x05, 0x7C, 0x1E, 0x1D, 0xBE,
-    0x62, 0x6B, 0x3A, 0x21, 0xAC, 0x3A, 0x2F, 0x25, 0xE3, 0xA5, 0xF4, 0x26, 0xF1, 0x90, 0x8D, 0x3D,
-    0x69, 0xDF, 0xA4, 0xE8, 0x89, 0xAA, 0xFC, 0xC5, 0x64, 0xDA, 0x56, 0x09, 0xA2, 0x60, 0x44, 0x06,
-    0x90, 0x8F, 0x61, 0x08, 0x64, 0x62, 0xB8, 0x00, 0xC9, 0x18, 0x02, 0x09, 0x39, 0x4F, 0x2B, 0xBD,
-    0x03, 0x3B, 0xF7, 0x70, 0xE6, 0x34, 0x34, 0xFA, 0xC8, 0x08, 0x07, 0xC5, 0x7A, 0xE1, 0xC8, 0x2A,
-    0xA2, 0x19, 0xA2, 0xCA, 0x72, 0x83, 0xAF, 0x75, 0x47, 0x26, 0x9B, 0x21, 0x0D, 0xB4, 0x69, 0x7F,
-    0xB9, 0xB2, 0x4B, 0x4A, 0x7D, 0x01, 0xE3, 0xC2, 0xD9, 0x6F, 0x78, 0x9C, 0x4D, 0xD0, 0xCB, 0x09,
-    0xC2, 0x40, 0x14, 0x85, 0xE1, 0x8C, 0xF8, 0x42, 0x14, 0xDC, 0x0B, 0x92, 0x0E, 0xB4, 0x83, 0xE0,
-    0xC2, 0xB5, 0x6E, 0x5C, 0x6B, 0x09, 0x96, 0x60, 0x07, 0xB1, 0x03, 0xED, 0x20, 0xE9, 0x40, 0x3B,
-    0xB0, 0x04, 0xB1, 0x02, 0x41, 0x0D, 0x1A, 0x1F, 0xF9, 0x1D, 0x70, 0x8E, 0x93, 0xB3, 0xFA, 0xB8,
-    0x0C, 0x97, 0x3B, 0x27, 0x18, 0xCD, 0x14, 0x13, 0x16, 0x28, 0xD1, 0xEA, 0x4F, 0x92, 0x85, 0xF7,
-    0x26, 0x78, 0xFA, 0x37, 0x81, 0xCB, 0x05, 0x1A, 0xF2, 0x87, 0x9D, 0xB8, 0x86, 0xBE, 0x9C, 0x41,
-    0xD5, 0x31, 0x84, 0x58, 0xE3, 0x3D, 0xB4, 0xE5, 0x9C, 0xB3, 0x71, 0x9C, 0xC2, 0x44, 0xE3, 0x13,
-    0x34, 0xE5, 0x37, 0x07, 0xD1, 0xDE, 0x37, 0x90, 0x6F, 0x50, 0x73, 0xEC, 0x16, 0xF6, 0x44, 0x97,
-    0x14, 0x3A, 0xF2, 0x1D, 0x2A, 0x8E, 0x43, 0x98, 0x97, 0x96, 0xB7, 0xE4, 0x17, 0x47, 0x71, 0x59,
-    0x5A, 0x7E, 0x85, 0xBA, 0xFF, 0x5C, 0x22, 0x6E, 0xED, 0x96, 0x5F, 0x6D, 0x63, 0x93, 0xF9, 0x7E,
-    0xA2, 0xBC, 0xD4, 0xDB, 0xC3, 0x3B, 0x4E, 0xBD, 0x7B, 0x5F, 0xFD, 0xAE, 0x9A, 0xB7, 0x78, 0x9C,
-    0x9D, 0xD1, 0x4D, 0x4E, 0xC2, 0x40, 0x18, 0xC6, 0xF1, 0x6A, 0x55, 0x44, 0x04, 0x6E, 0x60, 0x7A,
-    0x00, 0x22, 0x1E, 0xC1, 0x1B, 0x60, 0xC2, 0xDA, 0x78, 0x04, 0xF4, 0x04, 0x70, 0x03, 0x16, 0xB2,
-    0x36, 0xDC, 0x00, 0x97, 0xB2, 0x2A, 0x89, 0x07, 0xA8, 0x37, 0x70, 0x07, 0x6B, 0x21, 0x7E, 0x4C,
-    0x6B, 0xFB, 0x67, 0xD2, 0x99, 0xB7, 0xD3, 0x46, 0x17, 0x84, 0x59, 0xFD, 0x32, 0xF3, 0xCE, 0xC7,
-    0xF3, 0x8E, 0xE7, 0xFD, 0x19, 0x93, 0xF4, 0xD2, 0x6A, 0x05, 0x43, 0xA3, 0x25, 0xD0, 0xCB, 0x35,
-    0xD5, 0x7A, 0xF2, 0x73, 0x2A, 0xB8, 0x35, 0xCB, 0x37, 0x30, 0xB0, 0x7B, 0xDE, 0xE0, 0xC8, 0x72,
-    0xC3, 0x58, 0xCE, 0xFC, 0xA6, 0x2B, 0x54, 0xB4, 0x84, 0x09, 0xE7, 0x8E, 0x8D, 0x9D, 0x19, 0x97,
-    0x59, 0x3A, 0xA1, 0xE0, 0xAF, 0x2B, 0x80, 0xBA, 0xD5, 0x35, 0x9C, 0x58, 0x3E, 0xC3, 0x81, 0xE5,
-    0x27, 0x33, 0xAB, 0x7B, 0xB8, 0xC8, 0xF1, 0x30, 0xCF, 0x24, 0x43, 0xA2, 0xC3, 0x76, 0xCC, 0xB2,
-    0x9E, 0x8B, 0x0E, 0x25, 0x0C, 0x92, 0x2C, 0xE8, 0x2B, 0x77, 0x43, 0x90, 0x72, 0x27, 0xF7, 0xAE,
-    0x79, 0x17, 0x8E, 0xC0, 0x97, 0x0A, 0xA8, 0xC9, 0x74, 0xC6, 0xD9, 0x3F, 0xEF, 0x2D, 0xA5, 0x88,
-    0xF7, 0xEB, 0x4E, 0xA5, 0x51, 0x4D, 0xA1, 0xA2, 0x2D, 0xFC, 0xB2, 0x3F, 0xA9, 0xC7, 0x07, 0xA1,
-    0x70, 0x51, 0xE9, 0x54, 0x24, 0x2F, 0xFE, 0x81, 0xF0, 0xD8, 0x50, 0x37, 0xA8, 0xA8, 0x79, 0xC5,
-    0xFD, 0xF8, 0x63, 0x56, 0xD0, 0xBB, 0x7A, 0x39, 0xDD, 0x02, 0xCA, 0x40, 0x8A, 0xD2, 0x78, 0x9C,
-    0x63, 0x60, 0x64, 0x78, 0x7C, 0x9F, 0xE9, 0xCF, 0x7F, 0xCE, 0x7F, 0xFF, 0xB9, 0xFF, 0xFD, 0xE7,
-    0x19, 0x94, 0x88, 0xFB, 0xFB, 0x7F, 0x16, 0x07, 0x35, 0x06, 0x00, 0xA1, 0x9C, 0x6F, 0xFC, 0x78,
-    0x9C, 0x9D, 0x92, 0x3D, 0x4E, 0xC3, 0x40, 0x10, 0x85, 0x87, 0x04, 0x94, 0x48, 0x48, 0x11, 0x47,
-    0xE0, 0x08, 0xDB, 0x50, 0xA2, 0xB8, 0xA5, 0x22, 0x47, 0xF0, 0x0D, 0xE0, 0x06, 0x40, 0x8B, 0x28,
-    0x38, 0x02, 0x57, 0xA0, 0x48, 0x19, 0x39, 0x37, 0x88, 0x6F, 0x60, 0xA4, 0x1C, 0xC0, 0x49, 0xA4,
-    0x20, 0x9B, 0x9F, 0x7C, 0xAC, 0xC4, 0xEE, 0xF3, 0x52, 0x50, 0x24, 0x5B, 0x7D, 0x4F, 0x9E, 0x7D,
-    0x33, 0x6F, 0xD6, 0x76, 0x64, 0x3A, 0x2F, 0x3C, 0xF5, 0x23, 0xAF, 0xA0, 0x1E, 0x04, 0x9E, 0xE3,
-    0xC5, 0x71, 0x10, 0x53, 0x2F, 0x6E, 0x62, 0xD5, 0x83, 0x17, 0xF1, 0x83, 0xBD, 0xC2, 0x48, 0x5E,
-    0x9F, 0x5D, 0x91, 0xAD, 0x29, 0x92, 0x1E, 0xB5, 0xF8, 0x16, 0xD4, 0x7D, 0x02, 0xBD, 0xC8, 0xD9,
-    0xFE, 0x9C, 0xFA, 0xFC, 0xE7, 0xA9, 0x41, 0xCF, 0x21, 0x46, 0x33, 0xDB, 0x71, 0x2A, 0x6E, 0x19,
-    0x8B, 0x37, 0x54, 0xE2, 0x7B, 0xB8, 0x94, 0xF8, 0x80, 0xD9, 0x55, 0xE0, 0x7C, 0xE7, 0x17, 0x10,
-    0x77, 0xD6, 0x78, 0x3E, 0xF9, 0xC5, 0xA5, 0xC7, 0x70, 0xDD, 0x41, 0x71, 0x11, 0xC6, 0x28, 0x55,
-    0x60, 0xF6, 0xCE, 0x9D, 0x2C, 0xBF, 0x92, 0xC5, 0xC1, 0x30, 0xA2, 0x4B, 0xCA, 0xB3, 0xAE, 0xCF,
-    0x9F, 0x5C, 0x69, 0xDE, 0x03, 0xF6, 0x26, 0xCE, 0x13, 0x9F, 0x67, 0xD0, 0x38, 0x25, 0x0B, 0xF1,
-    0xB6, 0x7B, 0xD3, 0xAC, 0x7B, 0xEB, 0xB3, 0x46, 0xA3, 0xB9, 0x16, 0xAE, 0x43, 0xC1, 0x37, 0x2C,
-    0x82, 0xBB, 0xFF, 0x97, 0xAA, 0x18, 0xE4, 0x8D, 0x42, 0x99, 0xDC, 0xA3, 0xDA, 0xDB, 0x0F, 0x33,
-    0x5C, 0x8F, 0x70, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x01, 0x03, 0x06, 0x06, 0x81, 0xED, 0x67, 0x22,
-    0xC1, 0xEC, 0xBF, 0x72, 0x0C, 0x5F, 0xFF, 0xFF, 0xFF, 0xBF, 0x9E, 0x05, 0x28, 0xF6, 0xBF, 0xDF,
-    0xE0, 0x3F, 0x08, 0xDC, 0x17, 0x67, 0x30, 0xF8, 0x3F, 0x7F, 0xC3, 0x7F, 0x08, 0xE8, 0xB9, 0xFE,
-    0xBF, 0xFF, 0xC3, 0xFF, 0xF3, 0x2B, 0xFE, 0x41, 0xB8, 0xFE, 0x1F, 0xFF, 0xF3, 0x32, 0x38, 0xFC,
-    0x02, 0xB3, 0x79, 0x1F, 0xFC, 0xE7, 0x04, 0xEA, 0x3B, 0x06, 0x64, 0xBE, 0x67, 0x4A, 0xF8, 0xCF,
-    0x0A, 0x32, 0xB0, 0xE8, 0xF6, 0x59, 0x71, 0x06, 0x06, 0x41, 0xB8, 0x65, 0x0C, 0x00, 0x6E, 0x8F,
-    0x39, 0x42,
+const uint8_t Quicksand_28Bitmaps[7938] = {
+    0x03, 0x00, 0x63, 0x58, 0x56, 0xCD, 0x08, 0xCA, 0x35, 0x7A, 0x0C, 0xE0, 0x84, 0x06, 0x0A, 0x7E,
+    0xA6, 0x17, 0xB7, 0xC0, 0x6E, 0xF9, 0x0B, 0x22, 0x7E, 0x01, 0x8D, 0x17, 0xF8, 0x07, 0x0C, 0x84,
+    0x43, 0x40, 0x5F, 0x6D, 0x02, 0xE9, 0xFA, 0x01, 0x0A, 0xA4, 0xAF, 0xA0, 0x40, 0x53, 0x00, 0xB9,
+    0x04, 0x00, 0x33, 0x28, 0x07, 0x03, 0x75, 0x70, 0xBE, 0x02, 0x97, 0x05, 0xB0, 0xEC, 0xC0, 0x09,
+    0x4B, 0x97, 0x9C, 0x8F, 0xA0, 0x31, 0xCB, 0xC8, 0x60, 0x64, 0x0C, 0x02, 0x4C, 0x0C, 0x00, 0x83,
+    0x00, 0xC7, 0x54, 0x57, 0x46, 0x04, 0x4F, 0xE0, 0x3A, 0x28, 0x1E, 0x25, 0xE0, 0xFC, 0x6F, 0xF0,
+    0x1C, 0x0D, 0x0B, 0xDA, 0xFF, 0xC8, 0x49, 0xEF, 0x37, 0x2C, 0xB6, 0x79, 0x60, 0x1E, 0xF9, 0x3F,
+    0x2F, 0xAC, 0xED, 0x2F, 0x34, 0xDD, 0x83, 0x32, 0x2C, 0x28, 0x3C, 0x02, 0xFE, 0x41, 0xC3, 0xFF,
+    0x1F, 0x34, 0x1D, 0x3C, 0x82, 0x04, 0x69, 0x01, 0x34, 0xBB, 0x80, 0x7C, 0xD3, 0x0F, 0xF1, 0x3E,
+    0xD4, 0xA2, 0xEF, 0x60, 0xD7, 0x7F, 0x85, 0xB9, 0x1D, 0x24, 0xC3, 0x06, 0x8A, 0x3B, 0x58, 0x8A,
+    0x28, 0x00, 0xFB, 0x01, 0xA6, 0x1D, 0xEC, 0x27, 0x7E, 0x90, 0xE7, 0xF9, 0x10, 0xD1, 0xE9, 0x0F,
+    0xF2, 0x31, 0x17, 0x8C, 0xFF, 0x13, 0x18, 0x6F, 0x13, 0x60, 0x21, 0x00, 0x36, 0x7A, 0x3D, 0x28,
+    0x68, 0xE0, 0xE1, 0xF9, 0x19, 0x18, 0xD9, 0x17, 0x90, 0xC2, 0xFA, 0x23, 0x30, 0xA5, 0x7F, 0x80,
+    0xC5, 0x06, 0x38, 0xE1, 0xFD, 0x47, 0xE1, 0x03, 0x1D, 0xC4, 0x88, 0xCE, 0xFF, 0x88, 0xCA, 0x67,
+    0xFA, 0x48, 0x40, 0x3D, 0xBA, 0xF9, 0x0F, 0x50, 0xEC, 0xFF, 0x8F, 0xE1, 0xBE, 0x09, 0x88, 0x54,
+    0x0C, 0x74, 0xFF, 0x7E, 0x50, 0x20, 0x70, 0xC2, 0xF8, 0x3F, 0x80, 0x41, 0x83, 0x88, 0x7C, 0x88,
+    0xFF, 0x19, 0xA0, 0xE9, 0x18, 0x16, 0x3E, 0x48, 0xE1, 0x97, 0x00, 0x8E, 0xB1, 0xAF, 0xF0, 0xEC,
+    0x7C, 0x01, 0x6C, 0xF4, 0x03, 0x78, 0x00, 0x7D, 0x03, 0x87, 0x3C, 0x2C, 0x23, 0x80, 0x0A, 0xB0,
+    0xF9, 0x10, 0x53, 0xEE, 0x33, 0x42, 0x73, 0xB5, 0x3E, 0x54, 0x99, 0x1F, 0x28, 0xD5, 0xFD, 0x85,
+    0x46, 0x1C, 0xA8, 0xDC, 0xCB, 0x56, 0x26, 0x54, 0x6E, 0x81, 0x52, 0x18, 0x13, 0x3C, 0x5E, 0x90,
+    0x0B, 0x04, 0xA0, 0x51, 0xE0, 0x12, 0xD1, 0x1A, 0x29, 0x7D, 0x96, 0xCC, 0xA8, 0x80, 0x86, 0x02,
+    0x00, 0x03, 0x83, 0x45, 0x6B, 0x99, 0xA0, 0x81, 0xC4, 0x03, 0xCD, 0x10, 0xFC, 0xD0, 0x08, 0x05,
+    0xD2, 0x97, 0xFF, 0x83, 0x69, 0x48, 0x9C, 0xF2, 0x1B, 0x40, 0x52, 0x21, 0x3F, 0x28, 0x51, 0x68,
+    0x03, 0xE9, 0x9F, 0xA0, 0xB4, 0x01, 0xA4, 0x7F, 0xFC, 0x3F, 0xCF, 0x04, 0xA2, 0x0F, 0x82, 0x2C,
+    0x00, 0xA9, 0x17, 0x82, 0xE7, 0xFB, 0xE1, 0x4B, 0xFF, 0x85, 0x66, 0xB4, 0x4B, 0xE7, 0x99, 0x00,
+    0x03, 0x03, 0xC7, 0x34, 0x53, 0x38, 0x5B, 0xE0, 0x3A, 0x28, 0xF4, 0x61, 0x21, 0xF5, 0x83, 0x50,
+    0xFA, 0x87, 0xE6, 0x1A, 0x60, 0x1A, 0xDA, 0x2F, 0xCA, 0x10, 0xF8, 0x07, 0x9C, 0x52, 0x0C, 0xA0,
+    0xC5, 0x44, 0x00, 0x38, 0xA9, 0x3C, 0x84, 0xF9, 0xF0, 0x33, 0xC8, 0xF2, 0x1F, 0xD0, 0x00, 0x00,
+    0xC5, 0x08, 0x0F, 0x90, 0x07, 0x4D, 0x9A, 0xE0, 0x22, 0xE2, 0x20, 0xDC, 0x6B, 0xBF, 0x41, 0xA1,
+    0x05, 0x4B, 0xD9, 0x40, 0x55, 0xFE, 0x08, 0xB7, 0x02, 0x43, 0x32, 0x1E, 0x85, 0x87, 0x2C, 0xF7,
+    0x0B, 0x5A, 0x6A, 0x31, 0x40, 0x03, 0x99, 0x0F, 0xC1, 0x09, 0x80, 0x39, 0x03, 0x16, 0x22, 0x2C,
+    0x08, 0xDE, 0x37, 0x78, 0x8A, 0x82, 0x64, 0x54, 0x24, 0x0B, 0x36, 0xC0, 0x03, 0x13, 0x9A, 0xC6,
+    0x99, 0x91, 0x4D, 0x9C, 0x8F, 0x90, 0xFA, 0x8C, 0xAC, 0x10, 0x54, 0x66, 0xC1, 0xA3, 0x0C, 0xB9,
+    0xB0, 0x81, 0x64, 0x63, 0x56, 0x38, 0xEF, 0x22, 0x2C, 0x2D, 0xC1, 0x32, 0x17, 0x07, 0xB2, 0xCD,
+    0xEB, 0x11, 0x52, 0x3F, 0x91, 0x23, 0xAC, 0xE1, 0x3F, 0x22, 0xA1, 0x82, 0x1D, 0x25, 0xCB, 0x80,
+    0x94, 0x38, 0xDF, 0x23, 0x6C, 0xFE, 0xF2, 0x1F, 0x96, 0x28, 0xA1, 0x8E, 0x42, 0x78, 0xFA, 0xD3,
+    0x7F, 0x24, 0x6F, 0x82, 0x8A, 0xC7, 0x9C, 0x34, 0x08, 0x10, 0x05, 0x65, 0x2B, 0x04, 0x60, 0xFA,
+    0x84, 0xCC, 0xE3, 0xF8, 0x88, 0xCC, 0x63, 0x87, 0x15, 0x56, 0x90, 0x54, 0x01, 0x00, 0x53, 0x68,
+    0xEF, 0x80, 0x01, 0x71, 0x60, 0x18, 0xC3, 0xC1, 0x7D, 0x70, 0x46, 0x83, 0x01, 0x96, 0x4F, 0x48,
+    0x1C, 0xA6, 0x80, 0x3B, 0x77, 0xC1, 0xE0, 0x2F, 0x22, 0x76, 0xC0, 0x81, 0xC1, 0x09, 0x77, 0xD8,
+    0x3F, 0x78, 0xF0, 0x82, 0x03, 0x98, 0x1B, 0xC6, 0x06, 0xA6, 0x61, 0x78, 0x08, 0x83, 0x5C, 0x25,
+    0x0B, 0xE7, 0xFC, 0x86, 0xC7, 0x1C, 0xD8, 0xD9, 0x7A, 0x70, 0x89, 0x9F, 0x70, 0x0F, 0x82, 0x23,
+    0xC5, 0x1F, 0x2E, 0xF1, 0x1D, 0x16, 0x60, 0xD0, 0xCC, 0xB8, 0xD7, 0x03, 0x9E, 0x08, 0x40, 0x20,
+    0x0F, 0x11, 0xD5, 0xF0, 0xA4, 0xFD, 0x0B, 0x39, 0x1D, 0x3E, 0x7E, 0x3F, 0x7B, 0x06, 0x28, 0x35,
+    0x43, 0xAC, 0x02, 0x5A, 0x2E, 0xF0, 0xFC, 0x3F, 0x92, 0xEB, 0x04, 0xFE, 0x20, 0x99, 0x0F, 0x72,
+    0x2B, 0x2F, 0x42, 0xEA, 0x3F, 0x2C, 0xAA, 0x11, 0xA5, 0x19, 0x3C, 0x14, 0x10, 0x1E, 0x87, 0xE7,
+    0x37, 0x68, 0xB4, 0xDE, 0x47, 0xE6, 0x9C, 0x47, 0x56, 0xB6, 0x1F, 0xD9, 0x80, 0xF9, 0xC8, 0x46,
+    0xE7, 0x23, 0x38, 0xFF, 0x90, 0xCA, 0xCB, 0x09, 0xA0, 0x30, 0xDD, 0x2A, 0x09, 0x0F, 0x08, 0x66,
+    0x07, 0x70, 0xBE, 0x03, 0x4B, 0xAC, 0x07, 0xA5, 0xFD, 0xF9, 0x40, 0x5E, 0xE2, 0x5F, 0x90, 0xA3,
+    0x41, 0x79, 0xF1, 0xFD, 0x9A, 0xDB, 0xA0, 0x28, 0x65, 0x44, 0x2A, 0x6B, 0xA4, 0x91, 0x8A, 0x1A,
+    0x48, 0x50, 0x15, 0x82, 0xCB, 0x97, 0x1C, 0x58, 0x14, 0x96, 0xCE, 0xC8, 0x80, 0x24, 0x34, 0x00,
+    0x43, 0x80, 0x63, 0xD6, 0x28, 0xDC, 0x00, 0x78, 0x34, 0xC3, 0x3C, 0x03, 0xB3, 0x08, 0x02, 0xFE,
+    0xA2, 0xF2, 0x17, 0xFC, 0x47, 0xE5, 0x7F, 0x47, 0xE5, 0x3B, 0xFC, 0x47, 0xE5, 0x3F, 0x44, 0xE3,
+    0x03, 0x43, 0x1E, 0x99, 0x0F, 0x0C, 0x8C, 0x4A, 0x64, 0xFE, 0xD7, 0xFF, 0xE7, 0x0B, 0x90, 0xF8,
+    0x40, 0x8F, 0xEB, 0x21, 0xF3, 0x81, 0xE9, 0x80, 0x05, 0x99, 0x0F, 0x0A, 0x0A, 0x24, 0x7E, 0x01,
+    0x28, 0x43, 0x20, 0xF1, 0xC1, 0xA9, 0x04, 0xC1, 0x07, 0xE6, 0x4C, 0x7B, 0x06, 0x24, 0xFE, 0x01,
+    0x70, 0x20, 0x21, 0xF8, 0x3F, 0xC1, 0x71, 0x06, 0xE7, 0x03, 0x63, 0x43, 0x16, 0x99, 0x0F, 0x0D,
+    0x18, 0x18, 0x1F, 0x98, 0x4D, 0xF3, 0x19, 0x90, 0xF8, 0x1B, 0xA0, 0x11, 0x0C, 0xE3, 0x7F, 0x87,
+    0xA6, 0x28, 0x28, 0x1F, 0x18, 0x30, 0xF3, 0xCB, 0x41, 0x60, 0x3B, 0xD0, 0xCB, 0xE5, 0x62, 0xA0,
+    0xD8, 0x47, 0x02, 0xF7, 0xC1, 0x99, 0x0F, 0x09, 0xB0, 0xA0, 0xCA, 0xFF, 0x67, 0x32, 0x78, 0xF3,
+    0x0E, 0x02, 0x80, 0x19, 0xE7, 0xDD, 0xBB, 0x5C, 0x44, 0x88, 0x16, 0xA0, 0xC5, 0xD7, 0x60, 0xE3,
+    0x3B, 0xC0, 0x92, 0x39, 0x0C, 0xFC, 0xF0, 0x03, 0x91, 0x00, 0x63, 0x60, 0x68, 0xE9, 0x80, 0x82,
+    0x0C, 0x44, 0xAA, 0x06, 0x01, 0x6E, 0x70, 0xF8, 0xC2, 0x80, 0x3C, 0x28, 0xDC, 0xE1, 0x80, 0x0F,
+    0xE4, 0xB9, 0xF7, 0xEF, 0x20, 0xE0, 0x1C, 0x0B, 0xC8, 0x5F, 0xFA, 0x88, 0xCC, 0x0C, 0x74, 0x39,
+    0x3F, 0x12, 0xEF, 0x27, 0xCC, 0x39, 0x50, 0x67, 0x72, 0x21, 0xF1, 0xFE, 0x41, 0xDD, 0xC3, 0x00,
+    0x2D, 0x27, 0x58, 0x11, 0x1C, 0x03, 0x24, 0x5F, 0x83, 0xC3, 0x00, 0x49, 0x61, 0x01, 0x28, 0x5A,
+    0x14, 0x8D, 0x99, 0x60, 0x71, 0xBD, 0x3E, 0xE0, 0x15, 0xD0, 0x55, 0x35, 0x8C, 0x10, 0xCF, 0xDE,
+    0xFF, 0x87, 0x48, 0xBF, 0x08, 0x47, 0xEB, 0x82, 0x13, 0x11, 0x1C, 0xB0, 0x40, 0xE4, 0xB2, 0x95,
+    0x8D, 0x96, 0xFD, 0x07, 0xC7, 0x35, 0x30, 0xB0, 0x24, 0x40, 0x3A, 0x16, 0xFE, 0x07, 0xC7, 0xF9,
+    0x72, 0x71, 0x98, 0x5F, 0x90, 0x9D, 0x58, 0xF0, 0x1F, 0x96, 0x99, 0xA0, 0x09, 0x26, 0x1E, 0x89,
+    0xF7, 0x05, 0x9E, 0xA8, 0x20, 0xF1, 0x78, 0x1F, 0x89, 0xB7, 0x01, 0xC5, 0xFD, 0x0B, 0xF0, 0xF0,
+    0x50, 0x55, 0xA2, 0x9A, 0xF2, 0x09, 0x9A, 0x7C, 0x90, 0xCB, 0x51, 0x44, 0xA1, 0x89, 0x54, 0x9E,
+    0x1E, 0x00, 0x25, 0xAB, 0x84, 0x77, 0x90, 0x04, 0x2F, 0xF0, 0x1B, 0x14, 0x94, 0x1F, 0xA1, 0x45,
+    0xCA, 0x53, 0x70, 0xC8, 0x00, 0xD3, 0xCD, 0x7E, 0x35, 0xC1, 0xA0, 0x97, 0x90, 0x88, 0x3E, 0x00,
+    0x0F, 0x16, 0x90, 0x0F, 0x04, 0xE0, 0x25, 0x22, 0x3B, 0x72, 0x89, 0xA4, 0x05, 0x4D, 0x81, 0x37,
+    0x81, 0xEC, 0x7D, 0x62, 0x70, 0xAB, 0x14, 0x8C, 0x85, 0xA0, 0x2C, 0x00, 0x83, 0x81, 0xC4, 0x59,
+    0xCC, 0x08, 0xCE, 0x24, 0x24, 0xDF, 0x82, 0x23, 0xD3, 0x1E, 0x6E, 0x25, 0x28, 0x11, 0xC2, 0xE5,
+    0xBE, 0x42, 0xE3, 0x1B, 0x66, 0xF6, 0xFF, 0xFD, 0x70, 0xB7, 0x7D, 0x43, 0xCA, 0xCF, 0x20, 0x47,
+    0x43, 0x7D, 0x09, 0x4D, 0xA2, 0xF5, 0x08, 0xBB, 0xFE, 0xC2, 0xFC, 0x0D, 0xB5, 0x2B, 0x9F, 0x01,
+    0x59, 0x21, 0x07, 0x82, 0xF7, 0x1B, 0x1A, 0x74, 0x30, 0x3F, 0xCA, 0x21, 0x78, 0x1B, 0x90, 0xCD,
+    0x00, 0x6A, 0x03, 0x29, 0x84, 0xE5, 0x0B, 0x50, 0xB4, 0x2C, 0xFD, 0xF7, 0x7F, 0x1D, 0x0B, 0x34,
+    0xDC, 0xB9, 0x9F, 0x82, 0x53, 0x29, 0x0B, 0xC4, 0x90, 0x6D, 0x88, 0xA4, 0x0E, 0xB4, 0xFB, 0x2F,
+    0xA2, 0x1C, 0xB8, 0x00, 0xA2, 0xD7, 0x85, 0xB7, 0xFD, 0x01, 0x67, 0xD5, 0x8F, 0x40, 0x4E, 0x1E,
+    0x48, 0xC7, 0x1F, 0x90, 0x4D, 0xC0, 0xFC, 0x7B, 0x9F, 0x11, 0x9A, 0xC8, 0xF8, 0x40, 0xE9, 0x5E,
+    0x0E, 0x96, 0x7C, 0xEA, 0x41, 0x09, 0x85, 0x05, 0xE6, 0x8C, 0xF7, 0x40, 0x37, 0xC3, 0x12, 0x14,
+    0x50, 0x29, 0xCB, 0x1F, 0xB8, 0xE7, 0x80, 0x31, 0xCA, 0xF1, 0x07, 0x5A, 0xC2, 0x82, 0x23, 0x83,
+    0x0B, 0x9E, 0x8C, 0x40, 0xB9, 0x92, 0xE7, 0x17, 0x82, 0x07, 0x4C, 0x29, 0x3F, 0x50, 0xE4, 0xBE,
+    0xC2, 0x63, 0x03, 0x18, 0xFF, 0x5C, 0x1F, 0xE1, 0x61, 0x09, 0x8A, 0xDB, 0x03, 0xF0, 0xBC, 0x09,
+    0x74, 0x3F, 0x13, 0x3C, 0xB6, 0x81, 0xB1, 0x71, 0x1E, 0x64, 0x92, 0x3F, 0x2C, 0xEC, 0xFC, 0xC1,
+    0x71, 0xC7, 0x06, 0x2D, 0x8C, 0xB8, 0xC1, 0xCE, 0x3B, 0x0F, 0x0C, 0xC2, 0x25, 0xFF, 0x21, 0x19,
+    0x08, 0x94, 0xCB, 0xCF, 0xFE, 0x85, 0x45, 0x3C, 0xDE, 0xFC, 0xAB, 0x00, 0x2E, 0xF3, 0xAD, 0xE1,
+    0xA1, 0x9F, 0x3C, 0xA3, 0x42, 0x04, 0xCC, 0x00, 0x00, 0x33, 0xE8, 0x40, 0x00, 0x36, 0x70, 0xCA,
+    0xFC, 0x0F, 0x4F, 0xE5, 0x48, 0xB9, 0x19, 0x68, 0xD0, 0x37, 0x24, 0xCE, 0x7B, 0x86, 0x86, 0xBB,
+    0x30, 0x00, 0x0B, 0x0D, 0x98, 0xB9, 0x48, 0xB9, 0xBA, 0x01, 0x16, 0xAD, 0x30, 0x8F, 0x31, 0x21,
+    0x78, 0xDF, 0xA0, 0x21, 0x01, 0x01, 0x7F, 0xE1, 0xD9, 0x11, 0xE2, 0x47, 0x5E, 0x04, 0x6F, 0x03,
+    0x22, 0xDE, 0xC0, 0x61, 0xFA, 0x1E, 0x49, 0xDB, 0x4F, 0x78, 0xF2, 0xC0, 0xB0, 0xBB, 0x00, 0x16,
+    0xB0, 0x30, 0xBB, 0x99, 0x11, 0xBC, 0xAF, 0x88, 0x78, 0x06, 0xC7, 0x7A, 0x3C, 0x8A, 0xDD, 0x7C,
+    0x28, 0x76, 0xB3, 0x23, 0xDB, 0xFD, 0x9F, 0x11, 0xD9, 0xEE, 0xF9, 0x28, 0x76, 0xEB, 0xA3, 0xD8,
+    0xCD, 0x8D, 0x62, 0x37, 0x0B, 0xB2, 0xDD, 0xF7, 0x51, 0xEC, 0xCE, 0x47, 0x70, 0x0C, 0x50, 0xEC,
+    0x5E, 0x80, 0x62, 0xF7, 0x47, 0x14, 0xBB, 0x7F, 0x20, 0xDB, 0xCD, 0x80, 0x62, 0x77, 0x02, 0x8A,
+    0xDD, 0x17, 0x50, 0xEC, 0xFE, 0x42, 0xAC, 0xDD, 0x0D, 0x48, 0x99, 0x02, 0xCC, 0x43, 0xB2, 0x5B,
+    0xE0, 0x0F, 0x92, 0x36, 0x60, 0x22, 0x44, 0x48, 0x01, 0x00, 0x03, 0x73, 0xA6, 0xDD, 0xD9, 0xE3,
+    0x01, 0x37, 0x14, 0x9C, 0x1C, 0xFB, 0x18, 0x18, 0x90, 0xE3, 0xCA, 0x8E, 0x01, 0x25, 0x45, 0xB3,
+    0x42, 0x03, 0xF1, 0xFE, 0xAC, 0x9D, 0xD0, 0xD4, 0x1E, 0x00, 0x29, 0x19, 0x12, 0x20, 0x89, 0xE3,
+    0x01, 0xD4, 0x53, 0x8F, 0xC0, 0x61, 0xFB, 0x0D, 0x1A, 0xAA, 0x06, 0xE0, 0x62, 0xE0, 0x37, 0x2C,
+    0x98, 0x7E, 0x81, 0x42, 0xE6, 0x1F, 0x2C, 0x6D, 0x7E, 0x01, 0xB9, 0x1E, 0xEE, 0xA8, 0x8F, 0xC0,
+    0xE8, 0x11, 0x80, 0x85, 0x0C, 0x30, 0xC2, 0xF7, 0xA3, 0xC9, 0x21, 0xEB, 0xAB, 0x07, 0xC5, 0x8E,
+    0x3F, 0xCC, 0x4C, 0x7B, 0x50, 0xB4, 0xDC, 0x87, 0x05, 0x15, 0x0F, 0x38, 0x21, 0x70, 0x41, 0x33,
+    0x2F, 0x33, 0x38, 0x13, 0x81, 0xDC, 0x59, 0x00, 0x8D, 0x42, 0x60, 0x71, 0x71, 0xBF, 0x72, 0xF9,
+    0x3F, 0x58, 0x12, 0x80, 0xE6, 0xC4, 0x38, 0x06, 0x06, 0xA4, 0xC2, 0x0C, 0xC2, 0xBB, 0xF4, 0x1F,
+    0x29, 0x9D, 0x82, 0x4A, 0x93, 0x5E, 0xD3, 0x94, 0x9F, 0x90, 0xAC, 0xFD, 0x10, 0xAA, 0xE6, 0x07,
+    0x58, 0xF2, 0x17, 0x34, 0xE9, 0x3A, 0x80, 0x52, 0xBF, 0x01, 0x3C, 0xB3, 0x7E, 0x05, 0x06, 0x02,
+    0x3C, 0x8A, 0x41, 0x8E, 0x62, 0xBE, 0x00, 0xCF, 0x47, 0x40, 0xA5, 0xEC, 0x1F, 0xA0, 0x09, 0x03,
+    0x1C, 0x35, 0x5C, 0x1F, 0xE1, 0xC9, 0x13, 0xE4, 0x6F, 0x84, 0x1C, 0x88, 0xF7, 0x00, 0xAE, 0x0F,
+    0x68, 0x3A, 0xE7, 0x06, 0x78, 0xFC, 0x83, 0x4C, 0x0F, 0x80, 0x67, 0xFD, 0x4F, 0xA0, 0x28, 0xFF,
+    0x07, 0x35, 0x06, 0xE8, 0xEB, 0xF9, 0xE0, 0x92, 0x53, 0x1A, 0xC4, 0x7B, 0x02, 0x76, 0x14, 0x50,
+    0xF9, 0xFF, 0x28, 0x21, 0xC3, 0x63, 0xFF, 0x21, 0x09, 0xEA, 0x37, 0x4A, 0x39, 0x3E, 0x01, 0x96,
+    0x63, 0x21, 0x69, 0xED, 0x0A, 0x4A, 0x8E, 0x65, 0x58, 0x02, 0xF4, 0xFE, 0x7D, 0x0D, 0x44, 0xF2,
+    0x71, 0x36, 0x81, 0x30, 0x00, 0x03, 0x83, 0xE4, 0x8E, 0x70, 0xB8, 0x05, 0x06, 0xA0, 0xC0, 0x79,
+    0x2F, 0x01, 0xE5, 0x41, 0x33, 0x34, 0x44, 0xD3, 0x25, 0xE4, 0xF4, 0x0C, 0xCA, 0x51, 0xFF, 0xEF,
+    0xFD, 0x83, 0x26, 0x36, 0x60, 0x28, 0xEE, 0x67, 0x65, 0x10, 0x38, 0x0A, 0x49, 0xD8, 0xBF, 0xA0,
+    0x7E, 0xF9, 0x0E, 0x72, 0xAC, 0x03, 0x2C, 0x19, 0x04, 0x80, 0xDC, 0xB5, 0x01, 0x66, 0x18, 0x30,
+    0xBC, 0xE2, 0x81, 0x91, 0x0A, 0x8B, 0xCA, 0x07, 0xC0, 0xA0, 0xFF, 0x06, 0x2B, 0x20, 0x40, 0xD1,
+    0xC5, 0xF8, 0x13, 0x5A, 0x02, 0x81, 0x3D, 0xC4, 0xFA, 0x1B, 0x16, 0xCC, 0xE0, 0x54, 0xFB, 0x07,
+    0x99, 0xC7, 0x8D, 0xC2, 0xE3, 0xF9, 0x0D, 0x8F, 0x29, 0x60, 0xF8, 0xF0, 0xFC, 0x80, 0xE7, 0x73,
+    0xA0, 0xDF, 0x79, 0xBE, 0xC2, 0x13, 0x11, 0x30, 0x48, 0xB8, 0x3F, 0xC2, 0x82, 0x05, 0x94, 0x23,
+    0x39, 0x37, 0xC0, 0x62, 0x02, 0x94, 0x53, 0xD9, 0x0D, 0x60, 0x29, 0x0F, 0x54, 0xA2, 0xB0, 0x80,
+    0x7C, 0xA4, 0x0D, 0xCB, 0x9C, 0x8C, 0x20, 0xDF, 0xFE, 0xAF, 0x0E, 0x5B, 0x0E, 0xE2, 0xDC, 0x47,
+    0x4A, 0xB3, 0x7F, 0xC1, 0xA6, 0x43, 0x43, 0x69, 0xFF, 0x57, 0x88, 0xCD, 0x3F, 0x21, 0x05, 0xC8,
+    0x6F, 0x48, 0x26, 0x14, 0xD8, 0xFE, 0xEF, 0xFF, 0x3E, 0x56, 0x05, 0xA4, 0x34, 0x07, 0x4E, 0xAA,
+    0x4C, 0x08, 0x1E, 0x2C, 0x85, 0xC0, 0x9C, 0x62, 0x8F, 0xE0, 0x6D, 0x40, 0x89, 0xB4, 0x1F, 0xC8,
+    0xDA, 0x12, 0x10, 0x19, 0x05, 0x92, 0xA3, 0x79, 0x19, 0x90, 0x52, 0x32, 0x42, 0xA1, 0xC0, 0x6F,
+    0x44, 0xC1, 0x07, 0x29, 0x75, 0x59, 0x61, 0x9C, 0xAB, 0xB0, 0x12, 0x88, 0x88, 0xF2, 0x38, 0x0F,
+    0x61, 0xD7, 0x3F, 0x70, 0x39, 0x0C, 0x03, 0x8D, 0x91, 0x70, 0x26, 0x00, 0x63, 0x70, 0x66, 0x04,
+    0x4A, 0xD7, 0x83, 0x12, 0x01, 0x28, 0x06, 0x19, 0x41, 0xF8, 0x2B, 0x30, 0x86, 0x37, 0x80, 0x3C,
+    0x61, 0xC4, 0xC8, 0x40, 0x29, 0x10, 0x28, 0x63, 0x05, 0x06, 0xF1, 0x7A, 0xB0, 0xF9, 0x3F, 0xA0,
+    0xE6, 0x03, 0x63, 0x89, 0xA1, 0xE1, 0x9F, 0x2D, 0x03, 0x00, 0x75, 0x94, 0xCB, 0x0D, 0xC2, 0x30,
+    0x0C, 0x86, 0x5B, 0x38, 0x50, 0x1E, 0x45, 0x70, 0x60, 0x0E, 0xBA, 0x41, 0x47, 0x80, 0x09, 0x10,
+    0x1B, 0xF4, 0xC8, 0x81, 0x03, 0x8C, 0xC0, 0x08, 0xDD, 0x00, 0x36, 0x80, 0x0D, 0xE8, 0x06, 0x3C,
+    0x26, 0xE0, 0xA9, 0xD2, 0x4A, 0xA8, 0xC4, 0x89, 0xED, 0x38, 0x95, 0xF0, 0xD1, 0x07, 0x27, 0xF9,
+    0xBF, 0x2F, 0xFE, 0x5F, 0xE5, 0xAC, 0xD6, 0x98, 0xD3, 0x14, 0xAE, 0x8C, 0xC6, 0x71, 0xBD, 0xF8,
+    0x6C, 0xCF, 0x66, 0x3D, 0x71, 0x1A, 0x03, 0xFA, 0x11, 0x5C, 0x1A, 0x4E, 0x43, 0x76, 0xCE, 0xB8,
+    0x41, 0xE4, 0xE0, 0xA4, 0x22, 0x8F, 0xE9, 0xBD, 0xFD, 0x92, 0xC1, 0x63, 0x1C, 0xC1, 0xD3, 0x12,
+    0x34, 0x10, 0xFD, 0x8C, 0x03, 0x32, 0x83, 0xB7, 0xF0, 0x8E, 0xB6, 0xED, 0xBC, 0xE1, 0x7A, 0x15,
+    0x41, 0x34, 0x16, 0x84, 0x00, 0x9C, 0x95, 0x87, 0x40, 0x5B, 0x40, 0xF3, 0xC4, 0x9D, 0x8D, 0x8E,
+    0x62, 0x27, 0x58, 0xDC, 0xB4, 0x50, 0x53, 0xA2, 0xA9, 0xF1, 0xC5, 0x86, 0x34, 0x8B, 0xF3, 0x35,
+    0xD0, 0x73, 0x76, 0x3A, 0x42, 0x25, 0xEF, 0xFC, 0xA5, 0x52, 0x24, 0x96, 0x92, 0x0D, 0xEC, 0x7D,
+    0xC4, 0xC4, 0x72, 0x5C, 0xCD, 0xBC, 0xA3, 0xD5, 0x19, 0x5D, 0x57, 0x19, 0x65, 0xC9, 0x72, 0xA1,
+    0xEB, 0x83, 0x03, 0xED, 0x36, 0xA2, 0x7F, 0xF0, 0x90, 0x9D, 0x9E, 0xF8, 0x98, 0xA6, 0xF0, 0xF2,
+    0xA2, 0xF0, 0x81, 0xA3, 0x21, 0xD6, 0x45, 0x87, 0x70, 0x10, 0xB1, 0xAC, 0x31, 0xA8, 0x95, 0x84,
+    0x1D, 0xD6, 0x56, 0x7D, 0x69, 0x02, 0xEF, 0x48, 0xB6, 0x7B, 0x80, 0xD2, 0x74, 0xC4, 0x6A, 0x64,
+    0x62, 0xB0, 0x96, 0x4F, 0xC1, 0x4D, 0xA4, 0x00, 0xCA, 0x87, 0x42, 0x72, 0x83, 0x73, 0xE2, 0x42,
+    0xB2, 0x85, 0xBB, 0x8C, 0xAF, 0x47, 0xDF, 0x95, 0x2D, 0xF0, 0xFC, 0xBA, 0xEB, 0x3F, 0x83, 0x03,
+    0x43, 0x17, 0x15, 0x64, 0x6E, 0x33, 0x38, 0xA2, 0xB3, 0x60, 0xA9, 0x8B, 0xE1, 0x1A, 0x2C, 0x2D,
+    0x33, 0x23, 0x32, 0x2C, 0x72, 0x42, 0xDD, 0x88, 0xC8, 0xF9, 0x60, 0x1F, 0x83, 0x23, 0x72, 0x7F,
+    0x46, 0x68, 0xE9, 0x4D, 0x68, 0x58, 0x83, 0x12, 0x7D, 0x0C, 0x58, 0x6B, 0xD3, 0x3F, 0x90, 0x4B,
+    0x41, 0xD9, 0xDA, 0x17, 0x6A, 0x78, 0xC1, 0x3F, 0x59, 0x70, 0x44, 0xCC, 0x87, 0x5B, 0xAF, 0x00,
+    0x49, 0x6A, 0xEC, 0xC8, 0x4E, 0x4A, 0x40, 0x24, 0x06, 0x06, 0x58, 0x48, 0xA1, 0x7A, 0xE2, 0x3B,
+    0xCC, 0x9F, 0x30, 0xF0, 0x0F, 0x56, 0xE4, 0x20, 0x42, 0x4F, 0x1E, 0x45, 0x60, 0x02, 0x2C, 0xE1,
+    0x31, 0x20, 0x92, 0x14, 0x0B, 0x8A, 0xC0, 0x07, 0x74, 0x33, 0x3F, 0xC1, 0xD3, 0x3F, 0x3C, 0xD1,
+    0xED, 0x47, 0x15, 0xF8, 0x0A, 0x4F, 0x5C, 0x44, 0x0B, 0x60, 0x98, 0xF1, 0x19, 0x9E, 0xC8, 0xE1,
+    0xE9, 0xFF, 0x3F, 0x03, 0xBA, 0xEF, 0x99, 0x51, 0x04, 0x16, 0x20, 0xA5, 0x64, 0x58, 0xBA, 0xE1,
+    0x43, 0x11, 0x10, 0xF8, 0x0F, 0xCF, 0x29, 0x50, 0xF0, 0x13, 0xDD, 0x9A, 0x4F, 0x68, 0x81, 0x0E,
+    0x0A, 0x21, 0x7B, 0x54, 0x43, 0xFE, 0x41, 0xCA, 0x3B, 0x64, 0xDF, 0xFC, 0xF7, 0x43, 0x11, 0x68,
+    0xF8, 0x8F, 0x70, 0x8A, 0xC2, 0x2D, 0x0E, 0x48, 0xFE, 0x81, 0x16, 0xA2, 0x06, 0xBF, 0xC0, 0x71,
+    0x02, 0x2E, 0x22, 0xB2, 0x55, 0x18, 0x14, 0xA7, 0xFE, 0x85, 0x16, 0x90, 0x5F, 0x91, 0x52, 0x50,
+    0x3D, 0x72, 0x39, 0xF4, 0x1F, 0x5E, 0xBA, 0x3B, 0xC0, 0x44, 0xDE, 0x4B, 0xC0, 0x4C, 0x3F, 0x01,
+    0xE6, 0xAF, 0x63, 0x45, 0x58, 0xEE, 0xD8, 0x36, 0xA3, 0x42, 0x15, 0xC4, 0x00, 0x00, 0x95, 0x95,
+    0x3B, 0x0A, 0x02, 0x31, 0x10, 0x86, 0x65, 0x2D, 0x6C, 0x04, 0x3D, 0x82, 0x47, 0xB2, 0xB4, 0x13,
+    0x6F, 0xE0, 0x11, 0x2C, 0x05, 0x8B, 0x5D, 0xB0, 0xF1, 0x0C, 0x22, 0x6C, 0xEF, 0x51, 0x04, 0x71,
+    0x6F, 0xE0, 0x1B, 0x9F, 0x21, 0xCE, 0x24, 0x13, 0x32, 0x7F, 0x52, 0x99, 0xF2, 0x63, 0x49, 0x36,
+    0xFF, 0x7C, 0x33, 0xA9, 0xF6, 0xB2, 0x36, 0x23, 0x49, 0x4E, 0xF5, 0x70, 0xED, 0xB7, 0x36, 0x91,
+    0x88, 0x96, 0x9A, 0xF8, 0xF0, 0x8D, 0xAD, 0xD7, 0xBC, 0xB6, 0xDF, 0x10, 0xB4, 0x09, 0xC1, 0xB4,
+    0x96, 0xF2, 0x51, 0x24, 0x6E, 0x94, 0x14, 0x40, 0x58, 0x8B, 0x2E, 0x92, 0x99, 0xF3, 0x4E, 0x13,
+    0xBA, 0xE4, 0x31, 0x21, 0x17, 0xCE, 0x0D, 0x48, 0xC5, 0x77, 0x03, 0x32, 0xE0, 0xEA, 0x01, 0xA1,
+    0xB2, 0x8D, 0x13, 0xF2, 0xA4, 0xB8, 0x91, 0xDC, 0x48, 0x07, 0x24, 0x67, 0x0A, 0x14, 0xC9, 0x89,
+    0xA2, 0x45, 0x42, 0x52, 0x16, 0x48, 0x28, 0xFE, 0xF6, 0xFF, 0x24, 0xDF, 0xA7, 0xC9, 0xCE, 0xCA,
+    0xFF, 0xE7, 0x4A, 0xC2, 0x22, 0x79, 0x90, 0xEA, 0x48, 0x3E, 0x14, 0x2B, 0x90, 0x3E, 0xCB, 0x0E,
+    0x64, 0xCA, 0x0E, 0x01, 0x69, 0x58, 0x1D, 0x20, 0x2F, 0xB6, 0x4A, 0x93, 0xA1, 0xEB, 0x56, 0x4D,
+    0xEE, 0xF2, 0x96, 0xF4, 0x54, 0x49, 0xD9, 0xDF, 0x48, 0x26, 0xC6, 0xB7, 0xB8, 0xB1, 0xE5, 0x9C,
+    0xD7, 0x6A, 0x17, 0x86, 0x01, 0x38, 0x56, 0xA6, 0xD6, 0xF9, 0xC7, 0xE2, 0xAD, 0x40, 0x07, 0x66,
+    0x8D, 0x3D, 0x2C, 0xA4, 0x2F, 0x7E, 0x9B, 0x70, 0x17, 0x0E, 0xCE, 0xB2, 0x23, 0x65, 0xDF, 0xFF,
+    0xF9, 0x7F, 0x91, 0x38, 0xF3, 0x91, 0x39, 0xF1, 0x7F, 0xFF, 0xAF, 0x5F, 0x05, 0x03, 0x2C, 0x7F,
+    0x61, 0xFE, 0x47, 0xCA, 0x5D, 0x83, 0x87, 0x63, 0x6F, 0x0C, 0x01, 0xC2, 0x20, 0x0E, 0x1C, 0xB0,
+    0x22, 0x73, 0xF8, 0x70, 0x72, 0xD8, 0x80, 0x1C, 0x7F, 0x17, 0x08, 0x10, 0x19, 0x84, 0x9E, 0xC3,
+    0xCD, 0xE9, 0xEF, 0x80, 0x01, 0x26, 0xE4, 0x98, 0xB3, 0x47, 0x89, 0xD3, 0x5F, 0x48, 0x9C, 0xFA,
+    0x83, 0x48, 0x1C, 0x2E, 0x00, 0x9B, 0x70, 0x17, 0x0E, 0xF6, 0xB2, 0x20, 0x65, 0xDF, 0xFF, 0xFA,
+    0x7F, 0x91, 0x38, 0xFE, 0xC8, 0x1C, 0xB9, 0xBF, 0xFF, 0xD7, 0xAF, 0x82, 0x82, 0x59, 0x4C, 0x7F,
+    0x61, 0xA9, 0x0B, 0x12, 0x13, 0x83, 0x8C, 0xA3, 0xAF, 0x04, 0x01, 0x4C, 0x20, 0x0E, 0x0C, 0xDC,
+    0x67, 0x44, 0xE2, 0x00, 0x13, 0x1E, 0x12, 0x87, 0x0B, 0x99, 0xC3, 0x0C, 0xE4, 0xE4, 0xA7, 0x41,
+    0x80, 0xE8, 0x20, 0xF4, 0x1C, 0x85, 0x9C, 0x5F, 0xD0, 0x24, 0x00, 0xC9, 0xA3, 0xF0, 0x82, 0x04,
+    0x08, 0x00, 0x43, 0x80, 0x85, 0x73, 0x90, 0x38, 0x7F, 0xA0, 0xAE, 0x82, 0x66, 0x5F, 0x5E, 0x64,
+    0x0E, 0xDF, 0x28, 0x87, 0xCA, 0x1C, 0x44, 0xF0, 0x02, 0xA3, 0x94, 0xC7, 0x20, 0x13, 0x91, 0xD0,
+    0x38, 0xBF, 0xC0, 0xE2, 0x09, 0x98, 0xD6, 0x59, 0x7F, 0xC2, 0x52, 0x16, 0x30, 0xAF, 0x81, 0xB2,
+    0x2D, 0x0B, 0x34, 0x45, 0xCC, 0x07, 0xC9, 0xE6, 0x43, 0x25, 0xE4, 0xC0, 0x25, 0x66, 0xAE, 0x90,
+    0xE1, 0xF5, 0xFF, 0xE0, 0x24, 0x05, 0xCF, 0xDE, 0xFD, 0x88, 0x52, 0x0B, 0x9A, 0x0C, 0x2E, 0x43,
+    0xD8, 0xBE, 0x10, 0x43, 0xAF, 0x81, 0xD8, 0x39, 0x30, 0x97, 0x24, 0xCD, 0xA8, 0x10, 0x05, 0x33,
+    0x00, 0xCD, 0xD4, 0xB1, 0x0D, 0xC2, 0x30, 0x10, 0x85, 0x61, 0xA7, 0x41, 0x02, 0x81, 0x14, 0x5A,
+    0x2A, 0x06, 0x40, 0x62, 0x04, 0x46, 0xA2, 0xA7, 0x09, 0x23, 0xB8, 0xA7, 0x61, 0x01, 0x44, 0x66,
+    0x60, 0x81, 0x8C, 0x00, 0x15, 0x12, 0x35, 0x69, 0x10, 0x71, 0xCC, 0xF9, 0xF9, 0x7C, 0xF1, 0xC1,
+    0x02, 0xB8, 0xFC, 0xA2, 0x3F, 0x51, 0x92, 0xB3, 0x8F, 0xA7, 0xC2, 0xA8, 0xF5, 0x58, 0xBC, 0x52,
+    0xCE, 0xCB, 0xFA, 0xC6, 0xC9, 0x6F, 0x90, 0x91, 0x70, 0xF2, 0xE0, 0xB8, 0x1C, 0x68, 0xA6, 0x3A,
+    0x50, 0xA5, 0xBB, 0x40, 0xC3, 0xEB, 0xA0, 0x03, 0x4D, 0x55, 0x07, 0xAA, 0x54, 0x47, 0xD4, 0x65,
+    0xA5, 0x8B, 0xB4, 0x1B, 0x4A, 0xEA, 0xEE, 0x81, 0x26, 0x9D, 0x94, 0xF4, 0xB9, 0x6F, 0xA0, 0xA7,
+    0x94, 0xBD, 0x5F, 0x47, 0xDA, 0xA7, 0x92, 0xBA, 0x51, 0x24, 0xBA, 0x69, 0xC5, 0x5D, 0x63, 0x98,
+    0x52, 0x49, 0x5D, 0x22, 0x1B, 0x4B, 0x1B, 0x3E, 0x26, 0x13, 0x5D, 0xDE, 0x72, 0x27, 0xD4, 0xA2,
+    0x0C, 0x9D, 0x10, 0xA6, 0x12, 0x9D, 0x50, 0x19, 0x4A, 0x74, 0x42, 0xE1, 0x8C, 0x2B, 0x7A, 0x0C,
+    0x8C, 0x10, 0xFD, 0xCA, 0x43, 0x9C, 0x54, 0x21, 0x1C, 0x93, 0x57, 0x93, 0x13, 0xF6, 0xF2, 0x46,
+    0x53, 0xED, 0x79, 0xC2, 0x07, 0x5A, 0x72, 0x97, 0x51, 0x1A, 0xD0, 0x9C, 0x2C, 0x6F, 0x98, 0x8C,
+    0xCC, 0xDC, 0xFC, 0x90, 0xF9, 0x37, 0x1A, 0x7F, 0xD3, 0x9B, 0xA7, 0x3E, 0xAD, 0xDA, 0x37, 0x97,
+    0xB3, 0x1E, 0xFB, 0xB2, 0x5B, 0x7D, 0x00, 0x5D, 0xD4, 0xB1, 0x0D, 0xC2, 0x30, 0x10, 0x05, 0xD0,
+    0x24, 0x92, 0x49, 0x04, 0x4B, 0x64, 0x04, 0xB6, 0xA0, 0x64, 0x05, 0x36, 0x80, 0x41, 0x90, 0x80,
+    0x1E, 0x09, 0xD8, 0x80, 0x0D, 0x18, 0x81, 0x48, 0x4C, 0x40, 0x83, 0xE8, 0x52, 0x50, 0x20, 0x21,
+    0x4C, 0xF0, 0xF9, 0x7C, 0x3E, 0x7F, 0xB7, 0xAF, 0xF1, 0xE9, 0xFC, 0xFF, 0xED, 0xF6, 0xA5, 0xB6,
+    0xB0, 0x38, 0xAD, 0xDD, 0x6E, 0x26, 0x09, 0x7C, 0x06, 0x63, 0xA5, 0xB6, 0x61, 0x45, 0xB5, 0x8D,
+    0x4F, 0xF2, 0xF2, 0x1B, 0x1B, 0x23, 0xA9, 0x70, 0xC9, 0x41, 0xB7, 0x2C, 0x30, 0xCF, 0xA1, 0x2F,
+    0x01, 0x9E, 0x9A, 0x63, 0x86, 0x99, 0xA6, 0x81, 0xA1, 0x7E, 0xEB, 0x36, 0x18, 0xCE, 0x3A, 0x0A,
+    0x83, 0xAB, 0xDD, 0x15, 0x80, 0x7E, 0xAD, 0x01, 0x58, 0x0D, 0x92, 0x9F, 0x00, 0x6E, 0x95, 0x7D,
+    0x05, 0x70, 0x97, 0x51, 0x04, 0xA6, 0xD2, 0x60, 0x01, 0x8A, 0xBF, 0x01, 0x38, 0x86, 0x04, 0x45,
+    0xA0, 0x1B, 0x8B, 0xF0, 0xE2, 0xD8, 0x2B, 0x2C, 0x78, 0x14, 0x05, 0x8A, 0x6A, 0x05, 0xD0, 0xF9,
+    0xDF, 0x4D, 0xA0, 0xF5, 0x59, 0x4E, 0x80, 0x0A, 0x3D, 0x02, 0xF0, 0xA3, 0xA4, 0xE0, 0x47, 0x01,
+    0x70, 0x39, 0x1A, 0x03, 0xB8, 0xD0, 0x2D, 0x01, 0xA8, 0x03, 0x3F, 0x80, 0xCE, 0xDF, 0xF9, 0x04,
+    0xDA, 0x1C, 0xFC, 0xB5, 0x06, 0xD8, 0xE6, 0x40, 0x17, 0x05, 0xC1, 0xDD, 0xE6, 0xFA, 0x1B, 0xCA,
+    0x20, 0xA3, 0x98, 0xDB, 0x21, 0x09, 0x61, 0xF1, 0xD8, 0x14, 0x7F, 0x83, 0x01, 0xC3, 0xD4, 0x30,
+    0x15, 0x14, 0x01, 0x06, 0x87, 0x9B, 0xE0, 0x64, 0x28, 0x8E, 0x24, 0x04, 0xCF, 0x1A, 0x56, 0x08,
+    0x55, 0xF0, 0x54, 0xF9, 0x5F, 0x12, 0x26, 0xF6, 0x03, 0x51, 0x0A, 0x40, 0xA3, 0x1C, 0x92, 0x19,
+    0xAA, 0x5D, 0x5D, 0xA6, 0xFD, 0x85, 0xA5, 0x73, 0x70, 0x86, 0xB9, 0x0F, 0x8E, 0x11, 0x05, 0x50,
+    0xB1, 0xC1, 0x0A, 0x8D, 0x35, 0xA8, 0x03, 0xC1, 0xD9, 0xD2, 0x1E, 0x12, 0x0C, 0xFF, 0xED, 0x60,
+    0x26, 0x03, 0x03, 0x09, 0x14, 0xC1, 0x02, 0xD0, 0x2C, 0x07, 0xB7, 0x8E, 0x0B, 0xAC, 0xD5, 0x1E,
+    0xE1, 0x52, 0x08, 0xEF, 0x13, 0xDC, 0x34, 0x68, 0xA0, 0xEF, 0x07, 0xC5, 0xFD, 0x7D, 0x64, 0x5F,
+    0x7E, 0x05, 0x85, 0x1F, 0xDC, 0x49, 0x0C, 0xB0, 0xE0, 0xE2, 0x0C, 0xF8, 0x0F, 0xCB, 0x35, 0xF0,
+    0x38, 0xE0, 0x5B, 0x80, 0x94, 0x54, 0xA0, 0xE5, 0x9A, 0xFD, 0x05, 0xA4, 0xF8, 0x80, 0xFA, 0x2A,
+    0xFF, 0x03, 0x2C, 0x06, 0x61, 0xE0, 0xFB, 0xFF, 0xF9, 0x9F, 0x51, 0xAD, 0x05, 0xA5, 0x84, 0xF3,
+    0xB0, 0xC4, 0x00, 0x07, 0x9F, 0xFE, 0xDF, 0xFF, 0x0A, 0x4F, 0x98, 0xF0, 0x74, 0xFF, 0x9E, 0x58,
+    0x31, 0x6C, 0xE6, 0x61, 0xB3, 0xF7, 0x23, 0xA6, 0xFB, 0xD6, 0x3F, 0x80, 0xA7, 0x23, 0x78, 0x1E,
+    0xA9, 0x5F, 0x80, 0x1A, 0x7C, 0xA0, 0x00, 0xB4, 0x4F, 0x80, 0x27, 0x2E, 0x78, 0x7A, 0xE4, 0x13,
+    0x40, 0x14, 0xA6, 0xB0, 0xC8, 0xE6, 0x04, 0xEA, 0x3F, 0x8F, 0x2C, 0xF6, 0x19, 0x64, 0xFE, 0x67,
+    0x58, 0x1A, 0x87, 0x80, 0xBF, 0x20, 0x25, 0x1B, 0xA0, 0x19, 0x0D, 0x9E, 0xED, 0xFC, 0xC1, 0x09,
+    0xFB, 0x3E, 0x23, 0x5C, 0xEC, 0x1B, 0x24, 0xAD, 0x02, 0xCB, 0x17, 0x59, 0xA4, 0x2C, 0x08, 0xCE,
+    0xE8, 0x1B, 0x90, 0x6A, 0x8D, 0x5F, 0x50, 0x57, 0x80, 0xCA, 0xC9, 0xFD, 0xCC, 0x84, 0xEA, 0x05,
+    0x90, 0xC2, 0xDF, 0x88, 0x74, 0x0A, 0x77, 0x57, 0x02, 0x42, 0x08, 0x5E, 0x03, 0x81, 0xEB, 0x3A,
+    0x44, 0x95, 0x00, 0x05, 0x85, 0xE0, 0x7A, 0xE3, 0xBD, 0x17, 0x6A, 0x50, 0x26, 0x77, 0x74, 0x86,
+    0xC3, 0x92, 0x26, 0x00, 0x65, 0x94, 0x3B, 0x0A, 0x02, 0x41, 0x10, 0x44, 0x61, 0x47, 0x10, 0x13,
+    0x31, 0x57, 0xD0, 0x93, 0xB8, 0x1E, 0xC9, 0x4C, 0x30, 0xF1, 0x0A, 0x1E, 0x41, 0x33, 0x31, 0xD9,
+    0x23, 0x18, 0x98, 0x09, 0xB2, 0x27, 0x10, 0xF7, 0x00, 0x06, 0x0B, 0x8A, 0xF8, 0x5B, 0xC7, 0xEA,
+    0xF6, 0x33, 0xD5, 0x63, 0x67, 0x2F, 0x98, 0x4F, 0x57, 0x57, 0xF5, 0x74, 0xF7, 0xA9, 0xED, 0xD8,
+    0x45, 0x09, 0xCE, 0x6B, 0xAA, 0x6D, 0xA8, 0x2C, 0x62, 0xDF, 0x11, 0xCE, 0x96, 0x5A, 0x1B, 0xAF,
+    0x46, 0xAD, 0xBE, 0x72, 0x68, 0x40, 0xEA, 0xC4, 0x92, 0xB9, 0x2E, 0x73, 0x4F, 0x74, 0x24, 0xC6,
+    0xDB, 0xB9, 0x61, 0xF4, 0x66, 0xB8, 0x44, 0x1B, 0xCC, 0x18, 0x7F, 0xC2, 0x5C, 0x44, 0x5C, 0x46,
+    0xE7, 0x8F, 0x18, 0x26, 0xF3, 0x05, 0x8A, 0x11, 0xB7, 0x64, 0xE4, 0xC4, 0x33, 0x31, 0x25, 0xF1,
+    0x55, 0xCC, 0x15, 0x78, 0xED, 0x7D, 0x5F, 0xFA, 0xCD, 0xDF, 0x7B, 0xF3, 0x00, 0xEB, 0x27, 0x56,
+    0x9F, 0x86, 0xD5, 0x4B, 0xB7, 0xC8, 0xBF, 0x9E, 0x93, 0x91, 0xD6, 0xE2, 0xA9, 0x4E, 0x08, 0xF7,
+    0x0F, 0x35, 0x75, 0xF4, 0xFE, 0x49, 0x82, 0x47, 0xAC, 0x8E, 0xB1, 0x7A, 0x9A, 0xFF, 0xAA, 0xC9,
+    0x98, 0x2B, 0xF8, 0xC2, 0x72, 0xD3, 0xB0, 0x58, 0x99, 0xF9, 0x6E, 0xE7, 0x05, 0x01, 0x52, 0xC3,
+    0x67, 0xAB, 0x1F, 0x22, 0xEA, 0x1D, 0x33, 0xEC, 0x97, 0x32, 0xC3, 0x98, 0xAB, 0xDB, 0x6F, 0x37,
+    0xE9, 0x05, 0xD9, 0x7C, 0xEF, 0x02, 0x0F, 0x1E, 0xED, 0x17, 0x83, 0xF0, 0x82, 0xD3, 0x5C, 0xE1,
+    0x36, 0x30, 0x4C, 0x06, 0x27, 0xB4, 0x6C, 0x68, 0x40, 0x1E, 0x86, 0x46, 0xC8, 0x7C, 0x46, 0x68,
+    0xB0, 0xE0, 0xCF, 0xEF, 0xBD, 0xAA, 0x82, 0x4E, 0x37, 0x20, 0x89, 0x07, 0xE8, 0xB4, 0x38, 0xB0,
+    0x11, 0x8B, 0xFF, 0x83, 0xEC, 0xFF, 0x05, 0x4F, 0xAB, 0x97, 0x41, 0xFE, 0x81, 0x27, 0x63, 0x06,
+    0x81, 0x3F, 0xEB, 0x41, 0xDE, 0x82, 0xC7, 0x42, 0x02, 0x2B, 0xC8, 0x9D, 0x2C, 0x08, 0xE7, 0x81,
+    0x0C, 0x66, 0x42, 0xE5, 0x22, 0xCB, 0x06, 0x20, 0xE9, 0x85, 0x84, 0x8A, 0x1C, 0x12, 0x17, 0x18,
+    0xD4, 0xF0, 0x3C, 0x02, 0x4D, 0xA6, 0xB6, 0x48, 0x5C, 0x60, 0x12, 0xFA, 0xEF, 0x8D, 0xA2, 0xF9,
+    0xFF, 0xFF, 0x79, 0x08, 0xD3, 0x21, 0x59, 0xBE, 0x1A, 0x66, 0xBB, 0x00, 0x24, 0xAF, 0xDE, 0x17,
+    0x87, 0x95, 0x4D, 0xD0, 0xAC, 0xA2, 0x05, 0xD3, 0x7E, 0x03, 0x1E, 0x18, 0x10, 0x90, 0xF4, 0x0A,
+    0x5E, 0x00, 0x40, 0x40, 0x33, 0x28, 0x81, 0x23, 0x05, 0x3D, 0xA8, 0xB4, 0xC9, 0x47, 0x72, 0xCF,
+    0x04, 0x44, 0xF6, 0x82, 0x65, 0x16, 0x64, 0xBF, 0x6E, 0x40, 0xF5, 0xAB, 0x03, 0x2C, 0xF5, 0x40,
+    0x01, 0x22, 0xE7, 0xC3, 0xB9, 0x4C, 0xC8, 0x5C, 0xEE, 0x4B, 0xF7, 0x91, 0x53, 0x12, 0xE7, 0xAF,
+    0xFF, 0x76, 0x30, 0x2E, 0x30, 0x8D, 0xB0, 0xFE, 0x86, 0x25, 0x0F, 0x50, 0x16, 0x79, 0x0F, 0x2A,
+    0x18, 0xEE, 0xB3, 0xC2, 0x12, 0x41, 0x3E, 0x38, 0xEE, 0xDF, 0x47, 0x32, 0x31, 0x18, 0x1E, 0x87,
+    0x78, 0xE1, 0x2B, 0x22, 0xF2, 0xCF, 0x13, 0x2C, 0x47, 0x81, 0xF6, 0x81, 0x83, 0xE2, 0x7F, 0x34,
+    0xDC, 0x39, 0x41, 0xED, 0x33, 0x33, 0x20, 0x69, 0x17, 0x00, 0x53, 0xB8, 0x7D, 0x17, 0x19, 0xCC,
+    0x05, 0x59, 0x8F, 0x02, 0x38, 0x3F, 0xA0, 0x09, 0x70, 0x1F, 0x40, 0x13, 0x60, 0x67, 0x98, 0x3E,
+    0x13, 0x04, 0xFE, 0xFD, 0xDF, 0x0F, 0xA6, 0x23, 0x19, 0xE0, 0xC1, 0xEC, 0xCF, 0x80, 0x02, 0x46,
+    0x05, 0x46, 0x05, 0x48, 0x12, 0xF8, 0x8E, 0x5C, 0x47, 0x80, 0xB3, 0xF5, 0x7B, 0x56, 0x28, 0x0B,
+    0x00, 0x6D, 0x95, 0xEB, 0x4D, 0xC3, 0x40, 0x0C, 0xC7, 0x4B, 0x11, 0x10, 0xD1, 0x07, 0x19, 0xA1,
+    0x23, 0x20, 0x16, 0x28, 0x12, 0x0B, 0x30, 0x02, 0x1B, 0xB4, 0x1B, 0xD0, 0x0D, 0xE8, 0x08, 0xF9,
+    0xCA, 0x14, 0x65, 0x83, 0x64, 0x83, 0xDE, 0x06, 0xA5, 0x51, 0x1E, 0x0A, 0x49, 0x13, 0x6C, 0x9F,
+    0xED, 0x73, 0x10, 0xFE, 0x94, 0xE8, 0x1E, 0xFE, 0xD9, 0xFE, 0xDB, 0xF7, 0xD6, 0x47, 0x93, 0xFF,
+    0x6C, 0x77, 0xBA, 0x2D, 0xB4, 0x45, 0xC6, 0x56, 0x0E, 0xEB, 0x5A, 0xD3, 0x37, 0xB6, 0x76, 0xD8,
+    0x14, 0x82, 0xFF, 0xC7, 0xA0, 0x2B, 0x9C, 0x61, 0x37, 0x06, 0xE1, 0x2D, 0xF7, 0x92, 0x86, 0xB1,
+    0x41, 0x00, 0xD1, 0xF3, 0x20, 0x19, 0x1E, 0xD9, 0x19, 0x03, 0xEF, 0xB5, 0xF2, 0xD6, 0x2A, 0x2C,
+    0x5A, 0x63, 0x10, 0x5F, 0x0C, 0xE0, 0x07, 0xD5, 0x4D, 0xFE, 0x13, 0x6D, 0x95, 0x98, 0x0A, 0xEE,
+    0xA4, 0x0A, 0xB8, 0x6B, 0x13, 0x0A, 0xBE, 0x20, 0x45, 0xDC, 0xAB, 0x7E, 0xD2, 0x00, 0x78, 0x47,
+    0x19, 0x7F, 0x08, 0xA3, 0x6B, 0xAA, 0x80, 0x53, 0x2B, 0xCE, 0xAD, 0x8A, 0x1C, 0x00, 0x53, 0xAF,
+    0x98, 0x83, 0xEA, 0x58, 0x2E, 0x68, 0xBD, 0xB6, 0x72, 0x41, 0x2C, 0xB4, 0xF9, 0x62, 0x96, 0x60,
+    0x26, 0x3A, 0x46, 0x15, 0xA7, 0x02, 0x38, 0x67, 0x17, 0x33, 0xDE, 0xFA, 0xC9, 0x1C, 0x5F, 0xBC,
+    0x7B, 0xC5, 0xA7, 0x61, 0xCB, 0x13, 0x73, 0x9C, 0x45, 0x15, 0x9D, 0xF7, 0x90, 0xC1, 0x6D, 0x17,
+    0x3F, 0x2B, 0x2A, 0x21, 0xAB, 0xFD, 0x47, 0x01, 0x41, 0x54, 0x3E, 0x90, 0x4E, 0xD2, 0xC2, 0xC7,
+    0x7F, 0xE0, 0x84, 0x1F, 0x2C, 0xB1, 0xF6, 0x88, 0x77, 0x1A, 0x63, 0x67, 0xED, 0x89, 0x43, 0xC0,
+    0x08, 0x75, 0x46, 0xFF, 0x57, 0x88, 0x14, 0xD1, 0xDE, 0x9B, 0x89, 0x09, 0xD0, 0x91, 0xC7, 0x0E,
+    0x39, 0xF2, 0x50, 0xA7, 0x16, 0xBD, 0x7A, 0x41, 0x96, 0xC8, 0x61, 0x04, 0x48, 0xC9, 0x6C, 0x49,
+    0xF2, 0x0E, 0x3F, 0xBB, 0xA0, 0x09, 0x44, 0x8C, 0xBD, 0xE4, 0xA1, 0x7A, 0xD3, 0x95, 0x51, 0x12,
+    0x16, 0x6E, 0xE7, 0x23, 0x40, 0xCE, 0xAD, 0xD1, 0x1F, 0xE8, 0x71, 0xEE, 0xB8, 0xF7, 0x20, 0xBA,
+    0xCC, 0xAA, 0x16, 0x10, 0x4B, 0xEE, 0x73, 0xC8, 0x49, 0xAE, 0xA3, 0x90, 0xB6, 0xBE, 0xB7, 0xAC,
+    0xA6, 0x6C, 0x38, 0xD4, 0x3A, 0xAE, 0x08, 0xF9, 0x28, 0x45, 0x03, 0x47, 0xBD, 0xED, 0xAB, 0xEF,
+    0x30, 0x4F, 0xE9, 0xD9, 0x5B, 0x86, 0xA5, 0xC4, 0xCC, 0xE0, 0x26, 0x88, 0x87, 0xA7, 0x00, 0xBF,
+    0xCF, 0x7E, 0x3C, 0x5F, 0x1B, 0xF5, 0xF7, 0x9A, 0x6B, 0xCC, 0xED, 0xC9, 0x36, 0x46, 0x13, 0x42,
+    0x79, 0x0D, 0x77, 0xCB, 0xE4, 0x34, 0x37, 0xAC, 0xED, 0x92, 0x93, 0x77, 0x9B, 0x24, 0xBB, 0xB0,
+    0x4B, 0x8F, 0x97, 0x00, 0x95, 0x1C, 0x99, 0xE2, 0x17, 0x03, 0x83, 0x29, 0x77, 0xEE, 0xCD, 0x01,
+    0x99, 0x9A, 0x0A, 0x56, 0xF5, 0x1C, 0x1A, 0xA7, 0x1B, 0xC0, 0x09, 0xED, 0x32, 0x2C, 0xEE, 0x3E,
+    0x81, 0x7C, 0x1D, 0x00, 0x4F, 0xAB, 0x20, 0xCF, 0x81, 0x33, 0x63, 0x4F, 0xFA, 0x0A, 0x20, 0xF9,
+    0x1D, 0xC8, 0x05, 0xBA, 0xE7, 0xBF, 0x24, 0x2C, 0x09, 0xF7, 0x83, 0x6C, 0xF5, 0x83, 0xC7, 0x7F,
+    0x3F, 0x28, 0x99, 0x31, 0xC3, 0xD3, 0x50, 0x3F, 0x52, 0xA4, 0x7D, 0x04, 0x72, 0x1D, 0x10, 0xEE,
+    0x01, 0xBA, 0xB1, 0x7F, 0x02, 0x5C, 0x2D, 0x28, 0xA8, 0xFA, 0x2F, 0xC0, 0x63, 0x1C, 0x14, 0x13,
+    0xFD, 0x1F, 0xE0, 0x49, 0x01, 0x14, 0xA0, 0xFD, 0x9F, 0x10, 0xA9, 0x13, 0x68, 0x56, 0xFF, 0x17,
+    0x78, 0xCE, 0x06, 0x25, 0x15, 0x20, 0xD7, 0x1E, 0x95, 0x8B, 0x22, 0xFB, 0x19, 0xEE, 0x0A, 0x30,
+    0xF7, 0x13, 0xAC, 0x88, 0x82, 0xC4, 0xDE, 0x07, 0x68, 0x6C, 0x41, 0x62, 0xA3, 0xFF, 0x00, 0x2C,
+    0x66, 0x20, 0xA1, 0x5D, 0x80, 0x48, 0x50, 0x40, 0x9F, 0xF7, 0x0B, 0xFC, 0x87, 0xE5, 0x33, 0x50,
+    0xE2, 0xEB, 0x07, 0x26, 0x32, 0x98, 0x2B, 0xBF, 0x82, 0xB8, 0x9F, 0x60, 0x41, 0x0F, 0x2F, 0xCF,
+    0xE6, 0x43, 0xCD, 0x45, 0x29, 0xCF, 0xFE, 0xFF, 0x07, 0xC7, 0x23, 0xB8, 0x1C, 0xDB, 0x03, 0xCC,
+    0xF1, 0xFB, 0x3F, 0x83, 0xB8, 0x02, 0xB0, 0x32, 0x8A, 0x1B, 0xE2, 0x42, 0x48, 0x72, 0x06, 0x32,
+    0x3F, 0x40, 0xBC, 0x33, 0x11, 0x14, 0xE2, 0x7D, 0x8C, 0x0C, 0x01, 0xFF, 0x20, 0x69, 0xD9, 0xA0,
+    0xAD, 0xD3, 0x0C, 0x62, 0x37, 0x00, 0xCD, 0x95, 0x31, 0x0A, 0xC2, 0x40, 0x10, 0x45, 0x55, 0x54,
+    0x44, 0x8D, 0x69, 0x2D, 0x04, 0x53, 0xD8, 0xA7, 0xB5, 0x8B, 0xB5, 0x85, 0xE7, 0xB0, 0xB4, 0x10,
+    0x0B, 0x4F, 0xE2, 0x65, 0xC4, 0x3A, 0x58, 0x48, 0x4E, 0x20, 0x78, 0x00, 0xD3, 0x48, 0x08, 0x99,
+    0xE8, 0x3A, 0x33, 0xBB, 0x3B, 0x19, 0x6F, 0x60, 0x8A, 0x90, 0x4F, 0x60, 0xC3, 0xFC, 0x79, 0xFF,
+    0xA7, 0xD5, 0x69, 0xE9, 0x2B, 0x6B, 0x4E, 0xB7, 0x33, 0x05, 0x5A, 0x56, 0x7E, 0x56, 0xFF, 0xC5,
+    0xFF, 0x91, 0xAB, 0xF4, 0x79, 0x5E, 0x8A, 0xDC, 0x7D, 0x24, 0xC0, 0x28, 0x23, 0x97, 0x9C, 0x99,
+    0x95, 0x2F, 0x85, 0x23, 0x98, 0x18, 0x1F, 0x8E, 0x87, 0xD4, 0xA6, 0x16, 0x10, 0xE8, 0x7B, 0xCF,
+    0x56, 0x1D, 0x92, 0x04, 0xC2, 0x65, 0x41, 0x6B, 0x02, 0xA3, 0x36, 0x92, 0x90, 0x1C, 0x8B, 0x4F,
+    0x17, 0x92, 0xBE, 0x1B, 0x71, 0x85, 0x6D, 0x70, 0x9B, 0xB6, 0xAE, 0xF7, 0x41, 0x18, 0x25, 0xEF,
+    0x87, 0xA0, 0xCA, 0xAF, 0x36, 0x01, 0xF8, 0x88, 0x32, 0x6A, 0x21, 0xC8, 0xC1, 0x04, 0xCE, 0x5C,
+    0xCB, 0xE2, 0x57, 0xF2, 0xDB, 0x40, 0xED, 0x2B, 0xD4, 0xE6, 0x54, 0x24, 0x13, 0x91, 0x08, 0x9D,
+    0x40, 0xC2, 0x98, 0x0C, 0x40, 0xB2, 0x4C, 0x81, 0xE9, 0x82, 0xC7, 0x83, 0xD8, 0xCE, 0x69, 0xA2,
+    0xD8, 0xC9, 0x37, 0x22, 0x0F, 0xAE, 0xE8, 0x98, 0xAB, 0x09, 0x9B, 0xB3, 0xE1, 0x79, 0x6A, 0x42,
+    0x97, 0xAC, 0x33, 0x6B, 0x84, 0xB2, 0x64, 0x97, 0x70, 0x40, 0xDC, 0xC1, 0xED, 0x4A, 0x8B, 0x18,
+    0xB1, 0xED, 0x99, 0x6A, 0x4F, 0xAA, 0xA4, 0xB2, 0xA9, 0xD6, 0x07, 0x26, 0x33, 0xA2, 0x7F, 0x47,
+    0x3E, 0xE5, 0xF3, 0x17, 0x74, 0xDB, 0x9F, 0xB6, 0xD6, 0xCF, 0x2F, 0x03, 0x83, 0xC0, 0x93, 0x6F,
+    0xEF, 0xCD, 0x56, 0x83, 0x72, 0x16, 0x41, 0x22, 0x20, 0x06, 0xE6, 0x2A, 0x08, 0x90, 0x41, 0x49,
+    0x81, 0xF7, 0x21, 0x01, 0xF7, 0x7F, 0x7F, 0x46, 0xD9, 0x49, 0x58, 0xF9, 0xF1, 0x3F, 0x0F, 0x5A,
+    0x2C, 0x30, 0x83, 0x74, 0xED, 0x87, 0x58, 0xF8, 0x6D, 0x3D, 0x38, 0x98, 0x38, 0xA1, 0x66, 0x33,
+    0x82, 0x9C, 0xB9, 0x1F, 0x61, 0xB1, 0xC2, 0x7F, 0xE4, 0x42, 0xA0, 0x01, 0x29, 0x2A, 0x90, 0x1C,
+    0x8D, 0x92, 0x76, 0x11, 0x21, 0x8B, 0x00, 0x5F, 0x10, 0xC9, 0x13, 0xCC, 0x8B, 0xC7, 0xC9, 0x83,
+    0x17, 0x41, 0x50, 0x53, 0xE6, 0x33, 0x20, 0xDB, 0x70, 0x1F, 0x89, 0xB7, 0x01, 0x29, 0xCC, 0xC1,
+    0xC9, 0x87, 0x13, 0xC1, 0x13, 0xF8, 0x0F, 0x8B, 0x6A, 0x68, 0x6A, 0xBA, 0xCF, 0x88, 0x6C, 0x28,
+    0x38, 0xAC, 0x40, 0x9A, 0xA2, 0xC0, 0x1A, 0xEF, 0x83, 0xE3, 0x47, 0xE0, 0x37, 0x28, 0x94, 0x80,
+    0x39, 0x6B, 0x3D, 0x30, 0xFA, 0x14, 0x7E, 0x80, 0xE3, 0xE1, 0x00, 0x28, 0x28, 0xCF, 0x9E, 0x06,
+    0x25, 0x79, 0x26, 0x42, 0xE5, 0x40, 0x01, 0x38, 0xEC, 0xE7, 0xC1, 0x4A, 0x5F, 0x81, 0xD2, 0x19,
+    0x15, 0xAA, 0x20, 0x06, 0x00, 0x43, 0x01, 0x82, 0x28, 0xBC, 0x02, 0x54, 0x25, 0x1F, 0x11, 0x89,
+    0x00, 0xE6, 0xB9, 0x41, 0xC4, 0x9D, 0x72, 0xE7, 0xDE, 0x1C, 0x16, 0x38, 0xF7, 0x39, 0x34, 0x59,
+    0x42, 0xB8, 0x97, 0x61, 0x29, 0x13, 0xCC, 0x0D, 0x80, 0x27, 0x4E, 0x30, 0x17, 0x54, 0x9E, 0xF4,
+    0xA4, 0xAF, 0x00, 0x92, 0xDF, 0x80, 0x5C, 0x60, 0x90, 0xFE, 0xD7, 0x84, 0xE5, 0xC2, 0x7E, 0x50,
+    0xC0, 0x21, 0x92, 0x70, 0x3F, 0x28, 0xA7, 0x30, 0xC3, 0xB3, 0x41, 0x3F, 0x30, 0xDD, 0xE5, 0x23,
+    0x12, 0x51, 0xBF, 0x03, 0x22, 0xDB, 0x01, 0x83, 0xB9, 0x7F, 0x02, 0x52, 0x44, 0xFD, 0xFB, 0xDF,
+    0x7F, 0x01, 0x9E, 0x6B, 0x40, 0x89, 0xA9, 0xFF, 0x03, 0x3C, 0x35, 0x83, 0xD2, 0x44, 0xFF, 0x27,
+    0xA4, 0xB0, 0xFD, 0xF8, 0xBF, 0xFF, 0x0B, 0xBC, 0x70, 0x02, 0xA5, 0x76, 0x20, 0xD7, 0x1E, 0x95,
+    0x8B, 0x22, 0xFB, 0x19, 0x9E, 0xFA, 0xC1, 0xDC, 0x4F, 0xB0, 0x52, 0x16, 0x12, 0x38, 0x1F, 0xA0,
+    0x09, 0x0E, 0x92, 0xA0, 0xFA, 0xE1, 0x29, 0x01, 0x92, 0x60, 0x0A, 0x60, 0xE9, 0x01, 0x9C, 0x22,
+    0xFA, 0x15, 0xE0, 0x65, 0x0B, 0x28, 0x39, 0x82, 0x12, 0xEF, 0x7A, 0xB8, 0x1B, 0x81, 0xDC, 0x4F,
+    0xB0, 0xAC, 0x82, 0xBF, 0x48, 0xFE, 0xFF, 0xFF, 0x17, 0x88, 0x0B, 0x2A, 0x8A, 0xDF, 0xEF, 0x01,
+    0x16, 0x5A, 0xEB, 0xC1, 0xE1, 0x2C, 0x00, 0x2B, 0x66, 0xB9, 0x20, 0x2E, 0x84, 0x96, 0x11, 0x79,
+    0x40, 0x37, 0x83, 0xBD, 0x33, 0x11, 0x14, 0xE2, 0x7D, 0x8C, 0x0C, 0x01, 0xFF, 0xA0, 0x76, 0xB4,
+    0x75, 0x9A, 0x41, 0xEC, 0x06, 0x00, 0x03, 0x83, 0xA2, 0xDB, 0xEF, 0xD6, 0x88, 0xC1, 0x79, 0x47,
+    0xC1, 0x61, 0x65, 0xCD, 0x40, 0x5C, 0xFC, 0xFC, 0xEF, 0x2E, 0xBF, 0x09, 0x24, 0x65, 0x21, 0x49,
+    0x1C, 0x9C, 0x14, 0x36, 0x43, 0x92, 0x3C, 0xD0, 0x76, 0x19, 0xA8, 0x47, 0x40, 0x21, 0xFF, 0x15,
+    0x16, 0xB8, 0x0E, 0xE0, 0xB0, 0x84, 0x15, 0x30, 0xA0, 0xA0, 0xE9, 0x07, 0xB9, 0x99, 0x03, 0x1E,
+    0xA9, 0xEF, 0x41, 0x81, 0x01, 0x4B, 0xD7, 0xC0, 0x98, 0x63, 0xBE, 0x00, 0x0D, 0x35, 0x88, 0x66,
+    0xF6, 0x0F, 0xFF, 0xF7, 0xA7, 0x41, 0x41, 0x19, 0xD0, 0x61, 0x9F, 0xFE, 0x23, 0x03, 0xEE, 0x2F,
+    0xF8, 0xB8, 0x6C, 0xC0, 0x08, 0x58, 0x05, 0x07, 0x51, 0xC0, 0xF8, 0xF0, 0x67, 0x40, 0x02, 0x9F,
+    0x10, 0x09, 0x1D, 0x92, 0xD2, 0xD6, 0x23, 0x73, 0x0F, 0xC0, 0x62, 0x06, 0x9E, 0x44, 0xD8, 0x91,
+    0xB8, 0x0A, 0xF0, 0x8C, 0x09, 0x8B, 0x0F, 0xB8, 0xA3, 0x97, 0xB1, 0x83, 0x33, 0x26, 0x24, 0xA2,
+    0x81, 0x9E, 0xCB, 0x07, 0x7B, 0xEB, 0x3C, 0x13, 0x34, 0xB7, 0xF5, 0x43, 0x4A, 0x8F, 0xF5, 0xC0,
+    0x88, 0x35, 0xF8, 0x09, 0x49, 0x77, 0xE0, 0xC2, 0xE3, 0xEC, 0x1D, 0x68, 0xE1, 0x0C, 0xCF, 0x33,
+    0xB0, 0x3C, 0x6A, 0xF0, 0x07, 0x35, 0x8B, 0x3A, 0x80, 0xCB, 0x90, 0x3E, 0x46, 0xB8, 0xE5, 0xC9,
+    0x1D, 0x9D, 0x66, 0x60, 0x06, 0x00, 0x03, 0x83, 0xE2, 0xDB, 0xEF, 0xD6, 0x8A, 0x81, 0xA4, 0x21,
+    0x01, 0x74, 0x15, 0x1C, 0x58, 0xDA, 0xC0, 0x80, 0xBD, 0x8F, 0x1C, 0x7D, 0x1C, 0x06, 0x60, 0x27,
+    0x22, 0xA2, 0xC8, 0x11, 0x1C, 0xA2, 0xA0, 0xE4, 0x31, 0x37, 0x7D, 0x3A, 0x30, 0x61, 0xC4, 0x80,
+    0xF8, 0xA0, 0x74, 0x6E, 0x0D, 0x72, 0xDC, 0xCF, 0xFF, 0xEF, 0x41, 0xFC, 0x0D, 0xB0, 0xC4, 0xE3,
+    0xF0, 0x0F, 0x1C, 0x03, 0x5F, 0xE1, 0x1E, 0x78, 0x04, 0xE6, 0xFF, 0x85, 0x95, 0x0A, 0x20, 0xAF,
+    0xFD, 0x67, 0x33, 0x40, 0x24, 0x5E, 0x50, 0xA0, 0xB3, 0x4D, 0x40, 0xF2, 0x2F, 0xD0, 0xAF, 0x6C,
+    0x17, 0xE0, 0xA9, 0x0F, 0xEC, 0x3D, 0xB6, 0x0F, 0xF0, 0x64, 0x01, 0x8E, 0x64, 0xB6, 0x4F, 0x88,
+    0xA4, 0x0A, 0x0A, 0x08, 0xB6, 0x2F, 0xF0, 0x7C, 0x0E, 0x0E, 0x2F, 0x20, 0xDF, 0x1E, 0xCE, 0x17,
+    0x40, 0x93, 0x07, 0xF1, 0x3F, 0xC3, 0xD3, 0x12, 0x44, 0xFD, 0x27, 0xB8, 0xF3, 0xC0, 0x0E, 0x04,
+    0xDA, 0xB7, 0x9F, 0x01, 0x29, 0x8D, 0xB0, 0x6D, 0x80, 0x05, 0x2D, 0x24, 0x39, 0xB2, 0x15, 0xC0,
+    0x42, 0x18, 0x92, 0xCF, 0xD9, 0x04, 0x90, 0x12, 0xCE, 0x5F, 0x90, 0x7F, 0x7F, 0xC1, 0x0D, 0x98,
+    0x00, 0xF6, 0xFF, 0x27, 0x58, 0x02, 0x00, 0x67, 0x20, 0x36, 0x90, 0x27, 0x20, 0x69, 0x7F, 0x01,
+    0x34, 0xC5, 0x02, 0x73, 0xE3, 0x7C, 0x60, 0x14, 0x17, 0xFD, 0xFB, 0x5F, 0x0F, 0xE6, 0x1F, 0x00,
+    0xE5, 0xA4, 0x3D, 0x6F, 0x80, 0xA4, 0x2B, 0x24, 0x45, 0xC3, 0xCA, 0x8F, 0x78, 0x07, 0x48, 0x12,
+    0x82, 0x96, 0x20, 0xE7, 0x99, 0x02, 0xA0, 0x49, 0xAA, 0x00, 0x54, 0x72, 0xEC, 0x67, 0x05, 0xC5,
+    0x3E, 0x24, 0x2C, 0x15, 0x4A, 0x67, 0x86, 0x33, 0x82, 0x1D, 0xC0, 0xC4, 0x80, 0x04, 0x1E, 0x20,
+    0x85, 0x2D, 0x24, 0x21, 0xAF, 0x47, 0xE1, 0xFF, 0x45, 0x0A, 0x2B, 0x48, 0xF0, 0x83, 0xD2, 0xD9,
+    0x84, 0x39, 0x90, 0x04, 0x28, 0xF0, 0x07, 0x62, 0xFC, 0xD7, 0xFF, 0xEF, 0x3D, 0x40, 0x81, 0xFF,
+    0x13, 0x9A, 0x77, 0x41, 0xA5, 0xDD, 0xFD, 0xD5, 0xA7, 0xE1, 0xE5, 0x2B, 0xBC, 0x70, 0x80, 0xA5,
+    0xD7, 0x67, 0xFF, 0x11, 0x25, 0x07, 0x18, 0x2C, 0x85, 0x94, 0xB2, 0x2C, 0x88, 0x88, 0x6C, 0x5B,
+    0xD5, 0x65, 0x06, 0x61, 0x02, 0x00, 0x63, 0x60, 0x42, 0x64, 0x42, 0x60, 0xEE, 0x61, 0x45, 0x70,
+    0x7E, 0xC2, 0x4C, 0x81, 0x18, 0xCE, 0x3F, 0x18, 0x38, 0x02, 0xAD, 0x33, 0x33, 0x98, 0xA0, 0x1C,
+    0x03, 0x50, 0x32, 0x3D, 0xCF, 0x02, 0xE1, 0xFC, 0x84, 0xA5, 0x58, 0x20, 0xE7, 0x20, 0xBC, 0x04,
+    0xFA, 0xFD, 0x5F, 0xFE, 0xEF, 0xFF, 0xF7, 0x7B, 0x6E, 0x83, 0x53, 0xE2, 0xEF, 0xFF, 0xEB, 0xFF,
+    0xAF, 0x07, 0x86, 0xD5, 0x22, 0x50, 0x86, 0xFA, 0x0D, 0x2B, 0x6E, 0x80, 0xA9, 0x96, 0x19, 0xC8,
+    0xD1, 0x83, 0x85, 0x17, 0xC7, 0x6F, 0x58, 0x00, 0x03, 0x83, 0x91, 0xFB, 0x37, 0x3C, 0x99, 0xFC,
+    0xFB, 0xCF, 0xF7, 0x1B, 0x5E, 0x64, 0xFC, 0xFA, 0xCF, 0xFF, 0x1B, 0x9E, 0x1E, 0x7E, 0xFC, 0xD7,
+    0x47, 0x38, 0x74, 0x78, 0x70, 0x7E, 0xC1, 0x39, 0xDF, 0xFF, 0xEB, 0x7F, 0x87, 0x97, 0x26, 0x5F,
+    0xFE, 0xF3, 0x2F, 0xB8, 0x0F, 0x4B, 0x2F, 0x0D, 0xEF, 0x59, 0x00, 0x63, 0x10, 0x00, 0x59, 0x3D,
+    0x1F, 0x94, 0x26, 0x99, 0x81, 0x59, 0x8B, 0x15, 0x88, 0x59, 0x1E, 0x02, 0x3D, 0x2D, 0x50, 0xC6,
+    0xCA, 0x80, 0x02, 0xA6, 0xB1, 0x02, 0xC3, 0xA4, 0x1E, 0xE8, 0xE2, 0xF3, 0x40, 0x7C, 0x9F, 0x0E,
+    0xF8, 0x3C, 0x30, 0x0E, 0xD7, 0x33, 0x08, 0xFC, 0x91, 0x66, 0x00, 0x00, 0x63, 0x10, 0x04, 0x86,
+    0x0D, 0xF7, 0xC7, 0xFF, 0xF1, 0xC0, 0xDC, 0x49, 0x7F, 0xF4, 0xF1, 0xBF, 0x7F, 0xC0, 0x3F, 0x76,
+    0x00, 0x63, 0x00, 0x99, 0xAC, 0xD0, 0x36, 0x33, 0x02, 0xA2, 0x40, 0xA0, 0x75, 0x66, 0x06, 0x13,
+    0x38, 0x1F, 0xB1, 0x30, 0x38, 0xFC, 0x86, 0x65, 0x7E, 0x03, 0x10, 0xEB, 0x3C, 0x0B, 0x28, 0x18,
+    0x78, 0x05, 0x7E, 0xC1, 0xD2, 0x2A, 0x94, 0xD5, 0x0F, 0xB2, 0x9A, 0xFF, 0x12, 0x34, 0xDE, 0x58,
+    0xE0, 0xB9, 0x84, 0x1D, 0x28, 0x2C, 0xFF, 0xEF, 0xFF, 0xFB, 0xDD, 0xAF, 0x41, 0x49, 0x16, 0xE8,
+    0xEE, 0xF7, 0x7B, 0x5E, 0x83, 0xF3, 0xC6, 0xEF, 0xFF, 0xE7, 0xFF, 0xAF, 0x07, 0x3A, 0xFA, 0x30,
+    0x30, 0x17, 0x7C, 0xFA, 0x3F, 0x9F, 0x19, 0x5C, 0xB0, 0xEC, 0x07, 0xE5, 0x1F, 0x48, 0x09, 0x00,
+    0x34, 0xF6, 0x0F, 0x24, 0xA9, 0x00, 0x43, 0x9D, 0x09, 0x28, 0xAC, 0x07, 0x0B, 0x17, 0x68, 0xCA,
+    0x07, 0x7A, 0x87, 0xFD, 0x37, 0x2C, 0x1C, 0x0A, 0xFE, 0xC3, 0x42, 0x00, 0x68, 0x05, 0xF7, 0x6F,
+    0x58, 0xBC, 0x2A, 0xFC, 0x87, 0xA7, 0x17, 0x60, 0x70, 0xFC, 0x86, 0xE7, 0xF6, 0xFF, 0xB0, 0x58,
+    0x02, 0x45, 0xDC, 0x6F, 0x78, 0xA4, 0xFE, 0x85, 0xC5, 0x22, 0xA8, 0x58, 0xFA, 0x0D, 0xE7, 0xFC,
+    0x81, 0x65, 0x1D, 0x60, 0xEC, 0x8E, 0x0A, 0xD3, 0x4A, 0xF8, 0x17, 0x92, 0x30, 0x2F, 0x42, 0xF8,
+    0x3B, 0xBC, 0x18, 0xFB, 0x09, 0x4B, 0xAC, 0xC0, 0xBC, 0xC5, 0xB7, 0xE0, 0x3E, 0x2C, 0x33, 0x6C,
+    0x3C, 0x0F, 0x63, 0x4D, 0xB8, 0xCF, 0x0C, 0x00, 0x63, 0x00, 0x99, 0x6C, 0x70, 0xE2, 0xED, 0x59,
+    0x4F, 0x70, 0xEE, 0x61, 0x61, 0x08, 0x00, 0x27, 0x33, 0x5F, 0x90, 0x97, 0x79, 0x05, 0xA0, 0x29,
+    0x81, 0x1D, 0x68, 0x38, 0xFF, 0x23, 0x78, 0x46, 0xFF, 0xFD, 0x5F, 0xFE, 0xDF, 0xFF, 0xFD, 0x19,
+    0x6D, 0x20, 0x59, 0xC6, 0xDF, 0xFF, 0xCF, 0xFF, 0xAF, 0x07, 0x9A, 0x0E, 0x52, 0xCB, 0x01, 0xC4,
+    0xF7, 0x99, 0xA0, 0x36, 0xF3, 0x01, 0x39, 0xB2, 0x0C, 0xD0, 0xA4, 0x6F, 0xFF, 0x1B, 0xEE, 0x87,
+    0x1F, 0xFF, 0xF3, 0x7F, 0xC3, 0xE3, 0xF2, 0xCB, 0xFF, 0xF9, 0xBF, 0x61, 0xE1, 0x06, 0x8C, 0xE2,
+    0xF5, 0xBF, 0x61, 0xA1, 0x09, 0x8C, 0xE5, 0xFD, 0x08, 0xCE, 0x83, 0xFF, 0xE7, 0x87, 0x01, 0xE7,
+    0x17, 0x12, 0x67, 0xFF, 0x77, 0x78, 0x26, 0xDD, 0xF0, 0xBF, 0x7F, 0xC1, 0x7D, 0x26, 0x78, 0x69,
+    0x24, 0x0D, 0x00, 0x83, 0x18, 0xBA, 0xE3, 0xED, 0xBD, 0x6A, 0x66, 0x38, 0x77, 0x22, 0x24, 0x22,
+    0x61, 0xA1, 0x55, 0xF0, 0x1F, 0x11, 0xB3, 0x20, 0xAD, 0xBF, 0x61, 0xB1, 0x5B, 0x0F, 0x8F, 0xDD,
+    0x75, 0xE9, 0x6D, 0xBF, 0xFF, 0x43, 0x03, 0xF2, 0x0F, 0x24, 0xE7, 0x08, 0x7C, 0x87, 0xA4, 0x9A,
+    0x06, 0x58, 0x5A, 0x07, 0xE5, 0x33, 0x66, 0x70, 0x02, 0x85, 0x38, 0x01, 0xE4, 0x2A, 0x1E, 0x90,
+    0xB3, 0x61, 0x31, 0x01, 0xCC, 0x21, 0xF1, 0x20, 0x3F, 0xC9, 0x31, 0xC0, 0x63, 0xF3, 0x3C, 0x48,
+    0x3B, 0x3B, 0x8C, 0x0F, 0xD4, 0xC0, 0x04, 0xF7, 0x0A, 0xD4, 0x37, 0x1F, 0xA0, 0x01, 0x0A, 0xF5,
+    0x14, 0xD7, 0x27, 0x78, 0x82, 0x81, 0x84, 0xF2, 0x17, 0x44, 0xD2, 0x05, 0x39, 0x8D, 0xEF, 0x0B,
+    0x3C, 0xAD, 0x80, 0x83, 0x8C, 0x1F, 0x8D, 0xCF, 0x07, 0x2F, 0xA4, 0xA0, 0xEA, 0x11, 0xC9, 0x0E,
+    0x9C, 0x5F, 0x78, 0x10, 0x89, 0x0F, 0x1C, 0xD0, 0x9C, 0x1B, 0x90, 0xE2, 0x06, 0xE8, 0x56, 0xD6,
+    0x04, 0x58, 0x7C, 0x42, 0x62, 0x92, 0x91, 0xE1, 0x3F, 0x2C, 0x59, 0x80, 0x52, 0xC8, 0x7A, 0x10,
+    0x71, 0x9F, 0x11, 0x1E, 0x95, 0xF6, 0x60, 0x45, 0x32, 0xF0, 0x7C, 0xC6, 0x09, 0x16, 0x85, 0xE4,
+    0x93, 0x04, 0x68, 0x46, 0x03, 0x86, 0xE3, 0x7E, 0x60, 0x94, 0x27, 0xFE, 0x85, 0x9A, 0x04, 0xCE,
+    0x5C, 0x7B, 0xEF, 0x40, 0xCB, 0x6D, 0x22, 0xF2, 0x2F, 0x83, 0x01, 0xB8, 0x84, 0xE9, 0x63, 0x44,
+    0x78, 0x24, 0x79, 0x46, 0xA5, 0x2A, 0x84, 0x05, 0x00, 0xBD, 0x54, 0x2B, 0x0E, 0xC2, 0x40, 0x10,
+    0xDD, 0x12, 0x96, 0x04, 0x08, 0x6D, 0x2F, 0x40, 0x30, 0x18, 0x54, 0xB1, 0x28, 0x50, 0x1C, 0x00,
+    0x4D, 0x38, 0x06, 0x09, 0x0A, 0x85, 0x41, 0x61, 0x51, 0x3D, 0x08, 0x77, 0x40, 0xA3, 0x41, 0xA0,
+    0xC8, 0x2A, 0x12, 0xE8, 0x88, 0x32, 0x6F, 0x3F, 0xD3, 0xF6, 0x02, 0x54, 0x34, 0xFB, 0xB2, 0xED,
+    0xEC, 0xCE, 0xFB, 0x4C, 0x3A, 0xC6, 0xEB, 0x70, 0xDE, 0xB9, 0x2A, 0x77, 0xE6, 0x68, 0x01, 0xFD,
+    0xCD, 0xC4, 0xB5, 0x1D, 0xA7, 0x24, 0x79, 0xE6, 0x23, 0x92, 0x47, 0x4D, 0x1F, 0x2A, 0x33, 0x5E,
+    0x5D, 0x2F, 0x30, 0xE6, 0x10, 0x90, 0xDD, 0x30, 0xE3, 0x6A, 0x4F, 0x6B, 0x59, 0x0A, 0x8E, 0x4A,
+    0x0B, 0x9C, 0x4A, 0xE2, 0xD5, 0x13, 0xA8, 0x25, 0xB1, 0x31, 0x2F, 0x73, 0x40, 0x2D, 0x42, 0x97,
+    0x28, 0x55, 0x13, 0x42, 0x53, 0xE5, 0x3F, 0xEE, 0xB9, 0x47, 0x7E, 0x36, 0x39, 0xED, 0x07, 0x14,
+    0x14, 0xB0, 0x17, 0x4E, 0x28, 0x74, 0x6F, 0x59, 0x1F, 0x91, 0x84, 0x01, 0x8C, 0x36, 0xA0, 0xDD,
+    0xAD, 0x3E, 0xFE, 0xE0, 0xDF, 0xAA, 0x54, 0x01, 0x38, 0x17, 0xC8, 0x8A, 0x09, 0xC3, 0x96, 0xE3,
+    0x2E, 0x49, 0x10, 0xE0, 0xB6, 0x36, 0x05, 0x6E, 0x61, 0x0C, 0x83, 0x8E, 0x32, 0xB9, 0xE3, 0x1E,
+    0xD0, 0xB4, 0x82, 0x28, 0xB1, 0x25, 0x67, 0x13, 0xA6, 0x8F, 0x76, 0xD4, 0xAD, 0x23, 0x35, 0xFD,
+    0xDA, 0xC9, 0x40, 0xE5, 0x88, 0x73, 0x60, 0x5E, 0x20, 0xBA, 0x6F, 0x69, 0x0F, 0x11, 0xCA, 0x9D,
+    0x0A, 0x3E, 0x6C, 0x46, 0x7B, 0x98, 0xDE, 0x20, 0x49, 0x47, 0x79, 0xA8, 0xD4, 0x6A, 0xBB, 0x8C,
+    0x54, 0x05, 0xE5, 0xF9, 0x1B, 0x2C, 0x9A, 0xF0, 0xED, 0x5D, 0x1E, 0x26, 0xC7, 0xB1, 0x8E, 0xD4,
+    0x0F, 0x63, 0x00, 0x99, 0xEC, 0x70, 0xF2, 0x9E, 0x15, 0x30, 0xEB, 0xB0, 0x30, 0x38, 0x80, 0xD2,
+    0x18, 0xF3, 0x4F, 0xA0, 0x7E, 0x70, 0x24, 0xB1, 0xFD, 0xFE, 0xCF, 0x3F, 0x01, 0x1C, 0x72, 0x2C,
+    0x40, 0xD6, 0xB7, 0xFF, 0xB5, 0xC6, 0x5B, 0x73, 0x80, 0xF6, 0xE8, 0x43, 0xFD, 0xFF, 0xFB, 0xFF,
+    0x7A, 0xA8, 0x63, 0x7E, 0xC3, 0x53, 0xC8, 0x6F, 0xB8, 0xC1, 0xBF, 0xE1, 0xAE, 0xFE, 0x0D, 0xF5,
+    0x34, 0x88, 0x95, 0x0F, 0x67, 0xE9, 0xC3, 0x59, 0xFC, 0x83, 0x90, 0xF5, 0x0B, 0xCE, 0xFA, 0x0E,
+    0xCF, 0x4D, 0x0B, 0xEE, 0xC3, 0xA2, 0x01, 0x00, 0x03, 0x19, 0xB3, 0xFC, 0xED, 0xBD, 0x6E, 0x88,
+    0xA1, 0x06, 0xBF, 0x09, 0xC6, 0x27, 0x30, 0xFF, 0x45, 0x0B, 0x29, 0x2E, 0xFB, 0x0F, 0x72, 0x13,
+    0x34, 0xE0, 0x81, 0xE5, 0x02, 0xBB, 0x01, 0xCC, 0xE4, 0x9F, 0xFF, 0x59, 0x12, 0xE0, 0xD6, 0x65,
+    0x81, 0x02, 0x1E, 0x9E, 0xC9, 0x0B, 0x50, 0xFD, 0xC1, 0x05, 0x97, 0x40, 0xC4, 0x32, 0x38, 0x75,
+    0xD4, 0xC2, 0xD2, 0xF4, 0x01, 0x50, 0x3E, 0x50, 0x83, 0x16, 0x0A, 0xE0, 0x6C, 0x3A, 0x17, 0xE2,
+    0x4E, 0x48, 0x26, 0x81, 0xB8, 0x93, 0x21, 0xE1, 0x0F, 0xCC, 0x9D, 0x20, 0xCF, 0x6C, 0x47, 0xA4,
+    0x3B, 0x60, 0xC8, 0x01, 0x63, 0x1A, 0x96, 0x22, 0xC0, 0x3E, 0xE2, 0x84, 0x97, 0x2A, 0xFF, 0x60,
+    0xB9, 0x02, 0x1C, 0xD2, 0xF2, 0x02, 0xB0, 0x72, 0xED, 0xD3, 0x7F, 0xFD, 0x2F, 0xB0, 0x4C, 0xF5,
+    0xF1, 0xBF, 0xFE, 0x9F, 0xFF, 0x32, 0xB0, 0xA4, 0xC5, 0xFF, 0xFB, 0xFF, 0x7D, 0x26, 0x68, 0x3A,
+    0xE1, 0x01, 0x86, 0x7B, 0x3F, 0x23, 0x24, 0xF9, 0xB2, 0x3A, 0x80, 0x9C, 0x19, 0x1E, 0xB2, 0x1D,
+    0x9C, 0xD3, 0x61, 0x85, 0x04, 0x28, 0x82, 0x05, 0xA0, 0x59, 0x1B, 0x1C, 0x8F, 0x0A, 0x37, 0xFE,
+    0x23, 0x15, 0xA6, 0x41, 0xED, 0x9D, 0x66, 0x20, 0x1A, 0x00, 0x03, 0xA9, 0xBF, 0x03, 0x0B, 0x80,
+    0x07, 0xF0, 0x80, 0xFC, 0x08, 0x0F, 0xF7, 0x4F, 0xA4, 0xB1, 0x0C, 0xA0, 0xA9, 0xF4, 0x3E, 0xCB,
+    0x03, 0x58, 0x22, 0xE0, 0xFB, 0x00, 0x63, 0xF1, 0x17, 0x20, 0x4A, 0x87, 0xE0, 0xD0, 0x6F, 0xFF,
+    0xF7, 0x87, 0x86, 0x9A, 0x92, 0x61, 0xC7, 0xA0, 0x60, 0xE1, 0x48, 0x8F, 0xD6, 0x81, 0xE2, 0xD0,
+    0xE4, 0x83, 0x3F, 0xDF, 0xFF, 0x3B, 0xCF, 0xC6, 0x00, 0x00, 0x63, 0x80, 0x9B, 0xCC, 0x20, 0x08,
+    0xCC, 0x3D, 0x30, 0xB3, 0x17, 0xFC, 0xE7, 0xF8, 0x09, 0x33, 0x05, 0xE8, 0x21, 0xF9, 0xDF, 0x30,
+    0x5F, 0x82, 0x3C, 0x32, 0x0C, 0x38, 0xBF, 0x50, 0x39, 0xB0, 0xB8, 0xFD, 0xF1, 0x5F, 0x1F, 0x1E,
+    0x8D, 0xC0, 0x54, 0xC2, 0xFF, 0x15, 0x56, 0x64, 0x01, 0x23, 0x8C, 0xEF, 0x23, 0x2C, 0xDD, 0x01,
+    0xE3, 0x83, 0xEB, 0x00, 0x2C, 0xD9, 0x00, 0xD3, 0x0F, 0x6B, 0x00, 0x34, 0x45, 0x08, 0xFC, 0x01,
+    0x29, 0x01, 0x66, 0x91, 0x18, 0x46, 0x06, 0x83, 0x1F, 0xE0, 0x0C, 0xFD, 0x08, 0x94, 0xEE, 0xDF,
+    0x42, 0x13, 0x38, 0x3C, 0x75, 0x83, 0x23, 0x76, 0xE1, 0x7F, 0xE4, 0xC2, 0x65, 0x31, 0x48, 0xEE,
+    0x3C, 0x3B, 0x2C, 0x6A, 0x53, 0xCB, 0xDD, 0xC0, 0x51, 0x06, 0x00, 0x13, 0x58, 0xC1, 0x0A, 0xCF,
+    0x84, 0x0D, 0x51, 0x40, 0x1D, 0xF0, 0x98, 0x06, 0xFA, 0x99, 0xE5, 0x03, 0x3C, 0xAE, 0x41, 0x3A,
+    0xD8, 0x0F, 0xC0, 0xDC, 0x08, 0x0E, 0x1F, 0x96, 0x00, 0x44, 0x42, 0x7B, 0x00, 0x0A, 0xA7, 0x7F,
+    0xD0, 0x32, 0x03, 0x1A, 0x04, 0xDF, 0xE1, 0x31, 0xF6, 0x07, 0x94, 0x02, 0x3F, 0xC2, 0x1C, 0x61,
+    0x00, 0x0E, 0xF1, 0x09, 0x30, 0xA7, 0x2C, 0x00, 0x8B, 0x2B, 0xC0, 0x1C, 0xFD, 0x11, 0x12, 0x33,
+    0x84, 0xC2, 0x0D, 0x1C, 0x22, 0x01, 0x50, 0xF7, 0x24, 0x40, 0x92, 0xCF, 0x01, 0x98, 0x6B, 0xF1,
+    0x97, 0x37, 0x9F, 0x40, 0x6E, 0x15, 0x80, 0xA5, 0x38, 0x50, 0x20, 0xB1, 0x80, 0xD2, 0x07, 0x13,
+    0x3C, 0x80, 0xB9, 0x81, 0xDE, 0xD9, 0x0F, 0xF3, 0x37, 0xA8, 0x20, 0xFC, 0x0A, 0x2F, 0x2C, 0xC0,
+    0x91, 0xF2, 0x1B, 0x16, 0xBE, 0xE0, 0xC8, 0x52, 0x80, 0x79, 0x04, 0x12, 0x2A, 0xD3, 0x60, 0xD1,
+    0x07, 0x09, 0xB3, 0xBF, 0xF0, 0x40, 0x80, 0xA6, 0x3B, 0x7D, 0x04, 0x17, 0x94, 0xB1, 0xB8, 0x11,
+    0x5C, 0x60, 0xE8, 0x22, 0xE2, 0x16, 0x92, 0xBB, 0x18, 0x90, 0xC0, 0x3F, 0xA4, 0xA8, 0x01, 0x07,
+    0x0C, 0x1F, 0x32, 0x77, 0xC1, 0x7B, 0x16, 0x06, 0x6C, 0x00, 0x00, 0x73, 0xA8, 0x84, 0xE7, 0xB3,
+    0x4E, 0xC6, 0xAF, 0x50, 0xB7, 0x80, 0x9C, 0xCE, 0xFB, 0x0B, 0xE6, 0x31, 0xA0, 0x43, 0xEC, 0x7F,
+    0xC3, 0x39, 0xDF, 0x87, 0x1F, 0x07, 0xE1, 0xD3, 0x1F, 0x20, 0x8E, 0x3E, 0x3C, 0x35, 0xD8, 0xFF,
+    0x80, 0xA5, 0x2C, 0x60, 0x50, 0xDB, 0x7F, 0x83, 0xC6, 0x1D, 0x28, 0x58, 0xED, 0xE1, 0xE1, 0x0E,
+    0x4C, 0xF6, 0xF6, 0xC0, 0xF0, 0x95, 0x85, 0x26, 0x9A, 0xFF, 0xF6, 0xC0, 0xD8, 0x7A, 0x2F, 0x0E,
+    0x8C, 0xB4, 0xBF, 0xE0, 0x82, 0x00, 0x94, 0x97, 0xCE, 0xDE, 0x06, 0x0A, 0x81, 0x92, 0xC7, 0x45,
+    0x58, 0x46, 0x03, 0xA5, 0x06, 0x01, 0x48, 0xB9, 0xB3, 0x9E, 0xF1, 0x3B, 0xC8, 0x46, 0x70, 0xA9,
+    0xB3, 0x9E, 0x19, 0x5A, 0x2A, 0x1A, 0xB4, 0x75, 0xBA, 0x83, 0x5D, 0xC0, 0x0F, 0x2F, 0x21, 0x05,
+    0x10, 0xB9, 0x1A, 0x9C, 0x9C, 0xD9, 0xE1, 0x9C, 0x87, 0x48, 0xC9, 0x03, 0x68, 0x1F, 0xD0, 0x91,
+    0xD3, 0x58, 0x60, 0x59, 0x4B, 0x1F, 0x18, 0xE5, 0xF7, 0x81, 0xAE, 0x61, 0x28, 0xFC, 0x07, 0xD2,
+    0x02, 0x74, 0xE8, 0xFF, 0xB5, 0x33, 0x6F, 0x43, 0x92, 0xFF, 0x04, 0x78, 0x01, 0xC5, 0x89, 0x54,
+    0x0A, 0xF9, 0x81, 0xD3, 0x02, 0x84, 0x97, 0x03, 0x35, 0x34, 0x79, 0xC5, 0xAA, 0x4A, 0x11, 0x30,
+    0x0B, 0x00,
+};
+const uint8_t Quicksand_28Dictionary[1024] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFD, 0xFF, 0xDF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xFE, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xFD, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x80, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x7E, 0x01, 0x00, 0x00, 0xC5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1,
+    0xFF, 0xFF, 0xFF, 0xDF, 0x58, 0x12, 0x21, 0x63, 0xFA, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x8C, 0x45,
+    0x64, 0xE9, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC8,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0xFB, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xAF, 0xF1, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE1, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0B,
+    0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x8F, 0x00,
+    0xFB, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0x30, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x07,
+    0xF2, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 const GFXglyph Quicksand_28Glyphs[] = {
-    { 0, 0, 16, 0, 0, 8, 0 }, //  
-    { 6, 41, 12, 3, 41, 116, 8 }, // !
-    { 20, 17, 23, 2, 41, 141, 124 }, // "
-    { 37, 41, 39, 1, 41, 312, 265 }, // #
-    { 29, 57, 33, 2, 48, 325, 577 }, // $
-    { 42, 43, 46, 2, 42, 396, 902 }, // %
-    { 38, 43, 40, 1, 42, 368, 1298 }, // &
-    { 8, 17, 12, 2, 41, 75, 1666 }, // '
-    { 19, 53, 21, 2, 42, 209, 1741 }, // (
-    { 18, 53, 21, 1, 42, 213, 1950 }, // )
-    { 17, 19, 19, 1, 41, 122, 2163 }, // *
-    { 30, 30, 33, 2, 35, 84, 2285 }, // +
-    { 9, 13, 13, 2, 5, 73, 2369 }, // ,
-    { 17, 6, 23, 3, 21, 36, 2442 }, // -
-    { 6, 7, 12, 3, 7, 32, 2478 }, // .
-    { 31, 55, 31, 0, 47, 75, 2510 }, // /
-    { 31, 43, 35, 2, 42, 310, 2585 }, // 0
-    { 15, 41, 22, 1, 41, 85, 2895 }, // 1
-    { 27, 42, 33, 3, 42, 242, 2980 }, // 2
-    { 26, 42, 31, 2, 41, 254, 3222 }, // 3
-    { 31, 41, 32, 0, 41, 183, 3476 }, // 4
-    { 27, 42, 32, 3, 41, 267, 3659 }, // 5
-    { 27, 43, 32, 3, 42, 292, 3926 }, // 6
-    { 27, 42, 31, 3, 41, 173, 4218 }, // 7
-    { 27, 42, 32, 2, 41, 308, 4391 }, // 8
-    { 27, 43, 33, 3, 42, 299, 4699 }, // 9
-    { 7, 31, 13, 3, 31, 61, 4998 }, // :
-    { 9, 39, 13, 3, 31, 104, 5059 }, // ;
-    { 26, 30, 31, 1, 34, 178, 5163 }, // <
-    { 28, 16, 32, 2, 27, 61, 5341 }, // =
-    { 27, 29, 31, 3, 34, 160, 5402 }, // >
-    { 25, 44, 29, 2, 44, 219, 5562 }, // ?
-    { 52, 52, 57, 2, 42, 593, 5781 }, // @
-    { 36, 43, 38, 1, 42, 292, 6374 }, // A
-    { 31, 41, 38, 5, 41, 224, 6666 }, // B
-    { 34, 43, 38, 2, 42, 282, 6890 }, // C
-    { 35, 41, 42, 5, 41, 235, 7172 }, // D
-    { 26, 41, 33, 5, 41, 85, 7407 }, // E
-    { 26, 41, 33, 5, 41, 83, 7492 }, // F
-    { 36, 43, 41, 2, 42, 310, 7575 }, // G
-    { 32, 41, 42, 5, 41, 66, 7885 }, // H
-    { 5, 41, 15, 5, 41, 26, 7951 }, // I
-    { 25, 42, 33, 3, 41, 123, 7977 }, // J
-    { 32, 42, 39, 5, 41, 250, 8100 }, // K
-    { 26, 41, 32, 5, 41, 47, 8350 }, // L
-    { 38, 41, 48, 5, 41, 220, 8397 }, // M
-    { 33, 41, 43, 5, 41, 219, 8617 }, // N
-    { 40, 43, 45, 2, 42, 349, 8836 }, // O
-    { 28, 41, 35, 5, 41, 171, 9185 }, // P
-    { 45, 53, 45, 2, 42, 447, 9356 }, // Q
-    { 32, 41, 39, 5, 41, 227, 9803 }, // R
-    { 29, 43, 33, 2, 42, 295, 10030 }, // S
-    { 33, 41, 36, 1, 41, 63, 10325 }, // T
-    { 32, 42, 41, 5, 41, 169, 10388 }, // U
-    { 37, 41, 39, 1, 41, 300, 10557 }, // V
-    { 54, 41, 56, 1, 41, 419, 10857 }, // W
-    { 33, 42, 36, 2, 41, 299, 11276 }, // X
-    { 32, 42, 33, 1, 42, 198, 11575 }, // Y
-    { 34, 41, 38, 2, 41, 213, 11773 }, // Z
-    { 18, 53, 23, 4, 41, 56, 11986 }, // [
-    { 31, 55, 31, 0, 47, 77, 12042 }, // <backslash>
-    { 18, 53, 23, 1, 41, 60, 12119 }, // ]
-    { 26, 22, 32, 3, 43, 156, 12179 }, // ^
-    { 34, 5, 40, 3, -5, 31, 12335 }, // _
-    { 11, 10, 14, 1, 42, 59, 12366 }, // `
-    { 30, 32, 36, 2, 31, 265, 12425 }, // a
-    { 30, 45, 36, 4, 44, 280, 12690 }, // b
-    { 27, 32, 30, 2, 31, 219, 12970 }, // c
-    { 30, 45, 36, 2, 44, 273, 13189 }, // d
-    { 29, 32, 33, 2, 31, 249, 13462 }, // e
-    { 21, 44, 23, 1, 44, 124, 13711 }, // f
-    { 31, 43, 37, 2, 31, 350, 13835 }, // g
-    { 26, 44, 33, 4, 44, 155, 14185 }, // h
-    { 7, 41, 13, 3, 41, 63, 14340 }, // i
-    { 13, 53, 16, -2, 41, 116, 14403 }, // j
-    { 26, 44, 32, 4, 44, 198, 14519 }, // k
-    { 6, 44, 14, 4, 44, 29, 14717 }, // l
-    { 46, 31, 53, 4, 31, 223, 14746 }, // m
-    { 26, 31, 34, 4, 31, 155, 14969 }, // n
-    { 31, 32, 36, 2, 31, 272, 15124 }, // o
-    { 30, 43, 36, 4, 31, 279, 15396 }, // p
-    { 30, 43, 36, 2, 31, 279, 15675 }, // q
-    { 19, 31, 23, 4, 31, 107, 15954 }, // r
-    { 24, 32, 28, 2, 31, 239, 16061 }, // s
-    { 20, 38, 21, 0, 38, 105, 16300 }, // t
-    { 26, 32, 34, 4, 31, 149, 16405 }, // u
-    { 29, 32, 32, 1, 31, 237, 16554 }, // v
-    { 42, 32, 44, 1, 31, 321, 16791 }, // w
-    { 26, 32, 28, 1, 31, 229, 17112 }, // x
-    { 26, 43, 34, 4, 31, 221, 17341 }, // y
-    { 24, 31, 28, 2, 31, 164, 17562 }, // z
-    { 22, 54, 24, 1, 42, 224, 17726 }, // {
-    { 5, 57, 13, 4, 47, 33, 17950 }, // |
-    { 23, 54, 24, 1, 42, 228, 17983 }, // }
-    { 24, 10, 29, 2, 24, 95, 18211 }, // ~
+    { 0, 0, 16, 0, 0, 2, 0 }, //  
+    { 9, 13, 13, 2, 5, 48, 2 }, // ,
+    { 17, 6, 23, 3, 21, 29, 50 }, // -
+    { 31, 43, 35, 2, 42, 258, 79 }, // 0
+    { 15, 41, 22, 1, 41, 63, 337 }, // 1
+    { 27, 42, 33, 3, 42, 206, 400 }, // 2
+    { 26, 42, 31, 2, 41, 210, 606 }, // 3
+    { 31, 41, 32, 0, 41, 170, 816 }, // 4
+    { 27, 42, 32, 3, 41, 226, 986 }, // 5
+    { 27, 43, 32, 3, 42, 253, 1212 }, // 6
+    { 27, 42, 31, 3, 41, 161, 1465 }, // 7
+    { 27, 42, 32, 2, 41, 267, 1626 }, // 8
+    { 27, 43, 33, 3, 42, 247, 1893 }, // 9
+    { 7, 31, 13, 3, 31, 46, 2140 }, // :
+    { 36, 43, 38, 1, 42, 260, 2186 }, // A
+    { 34, 43, 38, 2, 42, 240, 2446 }, // C
+    { 35, 41, 42, 5, 41, 216, 2686 }, // D
+    { 26, 41, 33, 5, 41, 79, 2902 }, // E
+    { 26, 41, 33, 5, 41, 77, 2981 }, // F
+    { 25, 42, 33, 3, 41, 95, 3058 }, // J
+    { 38, 41, 48, 5, 41, 214, 3153 }, // M
+    { 33, 41, 43, 5, 41, 212, 3367 }, // N
+    { 40, 43, 45, 2, 42, 297, 3579 }, // O
+    { 32, 41, 39, 5, 41, 214, 3876 }, // R
+    { 29, 43, 33, 2, 42, 240, 4090 }, // S
+    { 33, 41, 36, 1, 41, 55, 4330 }, // T
+    { 54, 41, 56, 1, 41, 392, 4385 }, // W
+    { 30, 32, 36, 2, 31, 221, 4777 }, // a
+    { 30, 45, 36, 4, 44, 245, 4998 }, // b
+    { 27, 32, 30, 2, 31, 170, 5243 }, // c
+    { 30, 45, 36, 2, 44, 225, 5413 }, // d
+    { 29, 32, 33, 2, 31, 192, 5638 }, // e
+    { 31, 43, 37, 2, 31, 320, 5830 }, // g
+    { 26, 44, 33, 4, 44, 133, 6150 }, // h
+    { 7, 41, 13, 3, 41, 49, 6283 }, // i
+    { 6, 44, 14, 4, 44, 21, 6332 }, // l
+    { 46, 31, 53, 4, 31, 199, 6353 }, // m
+    { 26, 31, 34, 4, 31, 123, 6552 }, // n
+    { 31, 32, 36, 2, 31, 214, 6675 }, // o
+    { 30, 43, 36, 4, 31, 248, 6889 }, // p
+    { 19, 31, 23, 4, 31, 87, 7137 }, // r
+    { 24, 32, 28, 2, 31, 178, 7224 }, // s
+    { 20, 38, 21, 0, 38, 64, 7402 }, // t
+    { 26, 32, 34, 4, 31, 113, 7466 }, // u
+    { 29, 32, 32, 1, 31, 176, 7579 }, // v
+    { 26, 43, 34, 4, 31, 183, 7755 }, // y
 };
 const UnicodeInterval Quicksand_28Intervals[] = {
-    { 0x20, 0x7E, 0x0 },
+    { 0x20, 0x20, 0x0 },
+    { 0x2C, 0x2D, 0x1 },
+    { 0x30, 0x3A, 0x3 },
+    { 0x41, 0x41, 0xE },
+    { 0x43, 0x46, 0xF },
+    { 0x4A, 0x4A, 0x13 },
+    { 0x4D, 0x4F, 0x14 },
+    { 0x52, 0x54, 0x17 },
+    { 0x57, 0x57, 0x1A },
+    { 0x61, 0x65, 0x1B },
+    { 0x67, 0x69, 0x20 },
+    { 0x6C, 0x70, 0x23 },
+    { 0x72, 0x76, 0x28 },
+    { 0x79, 0x79, 0x2D },
 };
 const GFXfont Quicksand_28 = {
     (uint8_t*)Quicksand_28Bitmaps,
     (GFXglyph*)Quicksand_28Glyphs,
     (UnicodeInterval*)Quicksand_28Intervals,
-    1,
+    14,
     1,
     73,
     59,
     -15,
+    GLYPH_FORMAT_RAW_DEFLATE,
+    (uint8_t*)Quicksand_28Dictionary,
+    1024,
+    NULL,
+    0,
+    { 35, 0, 0, 42, 33, 1 },
 };
@@ -1,850 +1,760 @@
 #pragma once
 #include "epd_driver.h"
-const uint8_t Roboto_20Bitmaps[11948] = {
-    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xFB, 0xF9, 0x9F, 0xED, 0x07, 0x08,
-    0xB1, 0xC2, 0xD1, 0x77, 0x28, 0x62, 0x81, 0xA0, 0x6F, 0x50, 0xC4, 0x0C, 0x44, 0x5F, 0x11, 0x88,
-    0x09, 0x88, 0xBE, 0x80, 0x11, 0x03, 0x12, 0x38, 0x78, 0x9E, 0xE9, 0xE7, 0x7F, 0xAE, 0x9F, 0xFF,
-    0xB9, 0x81, 0x0C, 0x00, 0x0C, 0xAC, 0x32, 0x96, 0x78, 0x9C, 0xFB, 0xBC, 0x9F, 0xE1, 0x97, 0xFD,
-    0x67, 0x04, 0xB1, 0x9E, 0xE1, 0x97, 0xFE, 0xE7, 0x7E, 0x86, 0x5F, 0xF2, 0x9F, 0xEB, 0x19, 0x7E,
-    0xF1, 0x7F, 0xCE, 0x67, 0xF8, 0xC5, 0xF7, 0xD9, 0x9F, 0xE1, 0x17, 0xEF, 0x67, 0x7B, 0x86, 0x5F,
-    0x3C, 0x9F, 0xF5, 0x19, 0x7E, 0x71, 0x01, 0x00, 0xC4, 0x0A, 0x19, 0xB4, 0x78, 0x9C, 0x55, 0x8F,
-    0xEB, 0x0D, 0x01, 0x41, 0x14, 0x85, 0x8F, 0x37, 0x21, 0x94, 0x40, 0x07, 0x74, 0xA0, 0x02, 0xA1,
-    0x83, 0xD5, 0x01, 0x1D, 0xD0, 0x01, 0x1D, 0xD0, 0x80, 0xD0, 0x01, 0x1D, 0xAC, 0x7F, 0x7E, 0x4D,
-    0x56, 0x07, 0xDE, 0xCB, 0x62, 0x5D, 0x73, 0xE6, 0x26, 0x2B, 0xBE, 0x64, 0x92, 0x93, 0x9C, 0x99,
-    0xB9, 0xDF, 0x05, 0x80, 0xA9, 0xE4, 0xD1, 0x92, 0x32, 0xC8, 0x46, 0x32, 0xE8, 0x4B, 0xD1, 0xE5,
-    0xA3, 0xB0, 0xCB, 0xB9, 0x7C, 0xF6, 0xD9, 0xA5, 0x5D, 0xBE, 0xCD, 0xB4, 0x23, 0x8F, 0x81, 0x76,
-    0xE4, 0xD5, 0x06, 0xC2, 0x99, 0xE6, 0x4F, 0x0D, 0x88, 0x3C, 0x1B, 0x8C, 0x89, 0x25, 0x30, 0x46,
-    0xC4, 0x74, 0x20, 0x09, 0xDE, 0x5F, 0x06, 0x56, 0x76, 0x6C, 0x4F, 0x4A, 0xEE, 0xE9, 0xDE, 0x7E,
-    0x3D, 0xB6, 0x4A, 0xE4, 0x14, 0x68, 0x47, 0xAE, 0x4B, 0xED, 0xC8, 0x7D, 0xA4, 0x1D, 0x79, 0x76,
-    0x55, 0x89, 0xC4, 0x75, 0x55, 0x22, 0x52, 0x55, 0x25, 0x44, 0xC9, 0x28, 0xFF, 0x2F, 0xEF, 0x9C,
-    0x1A, 0xCF, 0xC2, 0xDE, 0xDA, 0x4A, 0x0A, 0x43, 0x29, 0xE8, 0xE6, 0x07, 0x60, 0x2E, 0x59, 0x97,
-    0x2F, 0x6B, 0xED, 0x48, 0x38, 0xF9, 0x8D, 0xE5, 0x76, 0x54, 0x22, 0xEF, 0xA6, 0x2A, 0xB9, 0xB1,
-    0x35, 0x55, 0xB2, 0x34, 0xA4, 0xA2, 0x4A, 0xC0, 0x17, 0xEC, 0xA1, 0x86, 0x85, 0x78, 0x9C, 0x7D,
-    0x90, 0xB1, 0x4E, 0x02, 0x41, 0x14, 0x45, 0x1F, 0x6B, 0x62, 0x84, 0x82, 0xFD, 0x03, 0xE5, 0x13,
-    0xB6, 0x36, 0xD1, 0xE5, 0x0F, 0xB4, 0xB3, 0x5C, 0x4A, 0x3B, 0xB7, 0xB2, 0x41, 0x03, 0x89, 0xA1,
-    0xD6, 0x4F, 0xB0, 0xA1, 0xD6, 0x3F, 0x70, 0x5B, 0x2B, 0x13, 0x13, 0xEB, 0xAD, 0xAC, 0x97, 0x20,
-    0xC4, 0x10, 0x97, 0x3D, 0xBC, 0x37, 0x33, 0xD2, 0xC1, 0xAD, 0xCE, 0xBC, 0xB9, 0xB9, 0xF7, 0xCD,
-    0x88, 0x88, 0x2C, 0x4A, 0x09, 0xDA, 0x4B, 0x53, 0xB8, 0x6B, 0x19, 0x7C, 0xA3, 0x1A, 0x29, 0x8C,
-    0x71, 0x6A, 0x8B, 0x2C, 0x29, 0xAF, 0x27, 0x0D, 0x37, 0x22, 0x8D, 0x1D, 0x9F, 0xA9, 0xA4, 0xCF,
-    0x87, 0x99, 0x6B, 0x0E, 0x73, 0x9B, 0x6B, 0x10, 0x9D, 0x27, 0x2E, 0x8C, 0x66, 0x74, 0x03, 0x15,
-    0xC4, 0x39, 0x8F, 0x46, 0xAF, 0x9C, 0x24, 0x54, 0xAD, 0xD0, 0xB5, 0xE6, 0x2C, 0xD0, 0x0F, 0x9C,
-    0x7A, 0xBA, 0xD4, 0xAA, 0x7B, 0x6F, 0xF8, 0x54, 0x7C, 0x3B, 0x70, 0xF8, 0x65, 0xE8, 0xA7, 0x0F,
-    0x0D, 0x9C, 0x7B, 0x6F, 0xBF, 0xDE, 0x66, 0x0D, 0xDC, 0x82, 0x4E, 0x4B, 0xE2, 0x40, 0x05, 0xE9,
-    0x1F, 0xCE, 0x30, 0x26, 0x5B, 0xE1, 0xA2, 0x72, 0xB2, 0x5F, 0x8E, 0xFC, 0x2E, 0xE9, 0x9C, 0x63,
-    0xA3, 0x39, 0x71, 0x41, 0x19, 0x89, 0x24, 0x0D, 0x9D, 0x9E, 0x36, 0x5D, 0xDD, 0x6A, 0x72, 0xA4,
-    0x6F, 0x71, 0x4A, 0xF5, 0xA2, 0x36, 0x78, 0x51, 0x8B, 0x24, 0xEF, 0x30, 0x8C, 0x7C, 0xC1, 0x6A,
-    0xF4, 0xFF, 0x7F, 0xBB, 0x69, 0x03, 0x1D, 0xA9, 0x87, 0x72, 0x78, 0x9C, 0x4D, 0x90, 0xBB, 0x71,
-    0xC2, 0x40, 0x18, 0x84, 0x57, 0x98, 0xE7, 0xF0, 0x52, 0x01, 0x8C, 0x51, 0xEA, 0x8C, 0x0E, 0xA0,
-    0x03, 0xAB, 0x03, 0x28, 0xC0, 0x33, 0xD0, 0x81, 0x1D, 0x3A, 0xA3, 0x03, 0x4C, 0x03, 0xCC, 0x10,
-    0x3A, 0x33, 0x1D, 0x88, 0x90, 0x4C, 0x10, 0x3B, 0xD0, 0x00, 0x1A, 0x30, 0x60, 0x6B, 0xFD, 0xEB,
-    0x47, 0x8F, 0xBB, 0xE0, 0x6E, 0x3F, 0xCD, 0x7F, 0xBB, 0xAB, 0x83, 0xFB, 0xED, 0x3F, 0x21, 0x5B,
-    0x37, 0x92, 0xA5, 0x14, 0xE6, 0x9C, 0x7D, 0xB2, 0x9F, 0x52, 0xE8, 0x5B, 0x38, 0x79, 0x22, 0xDC,
-    0x82, 0x6C, 0x97, 0x21, 0xB0, 0xA2, 0xA8, 0xC3, 0x58, 0xE8, 0xB7, 0x0B, 0xBC, 0xB1, 0x28, 0x22,
-    0x1E, 0xFF, 0x6B, 0x03, 0x13, 0x96, 0x31, 0x62, 0xD5, 0xA0, 0xBD, 0x0F, 0x63, 0xF2, 0xF6, 0x8C,
-    0xDC, 0xC5, 0x65, 0xCD, 0x48, 0xD8, 0x05, 0x96, 0x91, 0x7E, 0x1D, 0xE6, 0xCD, 0xCA, 0x03, 0xD6,
-    0xEF, 0xA4, 0xAD, 0xB7, 0xB4, 0xF2, 0xE6, 0xB8, 0x8C, 0x0D, 0xE8, 0xB1, 0x61, 0xD0, 0x9A, 0x05,
-    0x67, 0x13, 0xBC, 0x24, 0xF4, 0xF3, 0x8A, 0x50, 0xCC, 0x3A, 0x0A, 0x0E, 0x1B, 0x0E, 0xBF, 0xDE,
-    0x23, 0x4F, 0x69, 0xC5, 0x87, 0x25, 0x2B, 0x72, 0xE8, 0x1B, 0x9C, 0xA7, 0x5A, 0xBA, 0xA7, 0xA1,
-    0x0E, 0x9B, 0x38, 0x7E, 0x88, 0x90, 0x13, 0x58, 0xCA, 0x2F, 0x84, 0x53, 0x11, 0x51, 0x4B, 0xB6,
-    0x93, 0x7C, 0xCF, 0xC8, 0x8E, 0x1E, 0x91, 0x4F, 0xCE, 0x63, 0xAB, 0x7D, 0x90, 0xB8, 0x0C, 0x16,
-    0x7A, 0xB7, 0x9A, 0x24, 0xD8, 0xEA, 0xEB, 0xA5, 0xE9, 0xFA, 0x06, 0x59, 0xB3, 0x78, 0xD9, 0xDA,
-    0xFA, 0x1F, 0xB1, 0x53, 0x7A, 0xDD, 0x78, 0x9C, 0x4D, 0x90, 0x41, 0x4A, 0xC3, 0x60, 0x10, 0x85,
-    0x5F, 0x52, 0x5B, 0xAA, 0x62, 0xF5, 0x08, 0x85, 0x82, 0x3B, 0xB5, 0x5B, 0x77, 0xDE, 0xA0, 0x82,
-    0x07, 0x50, 0x5C, 0x0A, 0x85, 0x1E, 0xC1, 0x0B, 0x48, 0xBD, 0x41, 0xDC, 0xB8, 0xF6, 0x08, 0x8A,
-    0x5B, 0x17, 0xE2, 0xD2, 0x4D, 0xA3, 0x78, 0x80, 0xD0, 0x56, 0xAB, 0xA4, 0x4D, 0x3E, 0x67, 0xFE,
-    0x44, 0x70, 0x56, 0x1F, 0xF3, 0xBF, 0xBC, 0xF7, 0x32, 0x92, 0x6E, 0x8B, 0xF4, 0x50, 0xD5, 0x3C,
-    0x62, 0xB3, 0x11, 0x70, 0xA7, 0x74, 0xBE, 0x0F, 0x7C, 0x43, 0xB6, 0x7B, 0x5E, 0xD2, 0x72, 0x9E,
-    0x72, 0x20, 0xBD, 0xB3, 0xE5, 0xFC, 0xC5, 0xBA, 0x74, 0xC9, 0xB6, 0xF3, 0xC2, 0x9F, 0x47, 0xFF,
-    0xF8, 0x9A, 0x8E, 0xF3, 0xA7, 0xFB, 0xCD, 0x5C, 0x28, 0xBD, 0xD9, 0xB7, 0xFD, 0x92, 0xD8, 0x79,
-    0xC4, 0xB3, 0xBE, 0x39, 0xAD, 0x72, 0x0B, 0x9E, 0xA0, 0x59, 0xF1, 0xCC, 0x62, 0xF7, 0xEA, 0x3E,
-    0x67, 0x70, 0x57, 0xA3, 0x3E, 0xF0, 0xE4, 0xBF, 0x35, 0x69, 0x54, 0xF1, 0x0F, 0xC9, 0x8A, 0x4D,
-    0x69, 0x4E, 0xC3, 0xD6, 0xCD, 0x17, 0x12, 0xCF, 0x8C, 0xA7, 0x0C, 0xD4, 0xC5, 0x7A, 0x2C, 0x30,
-    0x49, 0xDB, 0x77, 0x03, 0xE5, 0x99, 0x56, 0x44, 0x9E, 0x9D, 0xC5, 0x66, 0x5C, 0x64, 0x6E, 0x90,
-    0x73, 0x65, 0x35, 0x0A, 0x9C, 0x1F, 0xCC, 0xB8, 0xA3, 0x25, 0x8D, 0xFA, 0x00, 0x2D, 0xAB, 0x18,
-    0xCE, 0x31, 0x07, 0xFF, 0xF5, 0xB1, 0x61, 0x77, 0x09, 0x6B, 0x3A, 0x86, 0x61, 0xEF, 0x24, 0x37,
-    0xFD, 0xBE, 0x4C, 0x14, 0x66, 0x42, 0x2A, 0xF5, 0x0B, 0xC7, 0x71, 0x14, 0x4A, 0x1D, 0xBD, 0x32,
-    0xB9, 0x88, 0xEC, 0x5C, 0xC9, 0x2F, 0x29, 0x65, 0x9A, 0xCD, 0x78, 0x9C, 0xFB, 0x6B, 0xFF, 0x17,
-    0x04, 0xF5, 0xFF, 0xCA, 0xFF, 0xE5, 0x07, 0x42, 0xBE, 0xBF, 0xBC, 0x7F, 0x79, 0x00, 0x7E, 0x78,
-    0x0B, 0x33, 0x78, 0x9C, 0x3D, 0xD0, 0xD1, 0x11, 0xC1, 0x40, 0x18, 0x04, 0xE0, 0x7F, 0xC6, 0x30,
-    0x21, 0x61, 0x74, 0x40, 0x07, 0x74, 0x40, 0x07, 0x4A, 0xA0, 0x03, 0x25, 0x28, 0x41, 0x3A, 0x49,
-    0x09, 0x94, 0x14, 0xE1, 0xC1, 0x83, 0x9B, 0xB5, 0xD9, 0xBD, 0xB9, 0x97, 0xEF, 0xE1, 0xF2, 0xDF,
-    0xFE, 0x7B, 0x89, 0x88, 0xD8, 0xD6, 0x24, 0x3E, 0x27, 0x72, 0xC4, 0x95, 0x0E, 0xA8, 0x68, 0xEA,
-    0x48, 0x8B, 0x25, 0x7D, 0x63, 0x42, 0x7F, 0x9D, 0x26, 0x76, 0xF4, 0x89, 0x5A, 0xC7, 0x53, 0xFA,
-    0xC5, 0x78, 0x3D, 0x3D, 0xC6, 0x24, 0xDC, 0xE8, 0x05, 0x07, 0xDD, 0xDC, 0x68, 0x70, 0x45, 0x7B,
-    0x34, 0x72, 0x41, 0x5F, 0x72, 0xC0, 0x5C, 0x01, 0x55, 0xD1, 0x27, 0xFE, 0xDA, 0x67, 0x9B, 0x92,
-    0xE0, 0x34, 0x27, 0xEF, 0xB5, 0xC5, 0x1B, 0xF3, 0x76, 0x37, 0x71, 0x2B, 0x37, 0x74, 0xFD, 0xDC,
-    0xBC, 0x55, 0xD2, 0x3A, 0xDD, 0x43, 0x8B, 0x66, 0x9A, 0x3A, 0x97, 0x57, 0xF3, 0x0F, 0xFC, 0x01,
-    0x0A, 0x4F, 0x4A, 0xDF, 0x78, 0x9C, 0x6B, 0x60, 0x63, 0x00, 0x82, 0x07, 0xF3, 0x41, 0xE4, 0xC3,
-    0xFF, 0x5C, 0x40, 0x52, 0xE1, 0x5F, 0x3D, 0x88, 0xF3, 0xE5, 0x3F, 0x0B, 0x90, 0x6C, 0xF8, 0x2F,
-    0x07, 0xE2, 0xFC, 0x05, 0xCB, 0x7F, 0xFD, 0xCF, 0x0C, 0x24, 0x2F, 0x80, 0x55, 0x25, 0xFC, 0xD7,
-    0x07, 0x92, 0x02, 0xFF, 0xC1, 0x12, 0xBF, 0xDF, 0x83, 0xC8, 0x6F, 0x60, 0xE9, 0x4F, 0xFF, 0x39,
-    0x40, 0x06, 0xFE, 0xE7, 0x01, 0x92, 0x1B, 0xFE, 0xF3, 0x03, 0xC9, 0x09, 0x60, 0xA5, 0x09, 0xFF,
-    0xE3, 0x81, 0x64, 0xC0, 0xFF, 0x7C, 0x20, 0xE9, 0xF0, 0x1F, 0x64, 0x85, 0xC1, 0xFF, 0x7E, 0x30,
-    0x39, 0x1F, 0x89, 0xEC, 0x87, 0xCB, 0x42, 0x54, 0x42, 0x74, 0x35, 0x80, 0x4D, 0x80, 0x98, 0x76,
-    0x01, 0x6C, 0xF2, 0xC7, 0xFF, 0x9C, 0x70, 0x07, 0xFD, 0x04, 0xDB, 0x0E, 0x36, 0x20, 0x00, 0xAC,
-    0xF0, 0x00, 0xD8, 0x85, 0x9F, 0xC1, 0x92, 0x7F, 0xE6, 0x83, 0x4D, 0x91, 0x03, 0xBB, 0x0C, 0xE8,
-    0x23, 0x81, 0xBF, 0x20, 0xC3, 0x2F, 0x82, 0x55, 0x40, 0x7C, 0xDD, 0xC0, 0x0A, 0x22, 0x01, 0xE9,
-    0xE1, 0x4B, 0x07, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x28, 0xF8, 0xCF, 0xC5, 0x00, 0x06, 0x09, 0x08,
-    0x06, 0x27, 0x84, 0x11, 0x00, 0x66, 0x28, 0x80, 0x18, 0x1C, 0x0C, 0x0C, 0x8C, 0x1B, 0xD6, 0xB3,
-    0x38, 0xFC, 0xE7, 0x10, 0xB8, 0xCE, 0xF3, 0xF1, 0xFF, 0xFB, 0x8A, 0xFF, 0x11, 0xBF, 0xFF, 0xCB,
-    0x7F, 0xFE, 0x0F, 0x01, 0xF1, 0x0C, 0x2D, 0x7F, 0x41, 0x74, 0x0D, 0x13, 0x50, 0xF9, 0xAF, 0xFF,
-    0xFB, 0x59, 0x41, 0xBA, 0x05, 0xFE, 0xFD, 0x3F, 0x0F, 0x36, 0x66, 0xC3, 0xFF, 0xDB, 0x20, 0xFD,
-    0x0C, 0x0C, 0xDF, 0xFF, 0x1B, 0xFD, 0xF7, 0x07, 0xD2, 0x06, 0xFF, 0xF3, 0x19, 0x7E, 0xBE, 0x67,
-    0x64, 0x60, 0x78, 0xF8, 0x9F, 0x87, 0xE1, 0x01, 0x10, 0x33, 0x2C, 0xF8, 0xCF, 0xC4, 0xE0, 0xF0,
-    0x9F, 0x1B, 0x28, 0x97, 0x0A, 0xC4, 0x99, 0x0C, 0x0C, 0x00, 0xE8, 0x1F, 0x37, 0x9C, 0x78, 0x9C,
-    0x63, 0x60, 0x60, 0x60, 0xF8, 0xF0, 0x9F, 0x9B, 0x01, 0x0A, 0x68, 0xC1, 0x9C, 0x3C, 0x73, 0xE6,
-    0xCC, 0x9F, 0xFF, 0xE7, 0x03, 0x49, 0xCE, 0x6F, 0xFF, 0x61, 0x40, 0x1E, 0x3B, 0x93, 0x56, 0x6E,
-    0x40, 0x62, 0x02, 0x00, 0x56, 0x17, 0x48, 0x82, 0x78, 0x9C, 0x63, 0xF8, 0xF6, 0x9F, 0x95, 0x01,
-    0x86, 0xBF, 0xFF, 0x67, 0x61, 0xF8, 0xF1, 0x9F, 0x89, 0xE1, 0xCF, 0x7D, 0x06, 0x85, 0xFF, 0xF5,
-    0x0C, 0x1B, 0xFE, 0xF3, 0x32, 0x7C, 0xFA, 0xCF, 0xCC, 0x60, 0xE0, 0xC3, 0xC0, 0x00, 0x00, 0x8B,
-    0x94, 0x11, 0x87, 0x78, 0x9C, 0x13, 0x10, 0x04, 0x02, 0xC6, 0xCF, 0xFF, 0x81, 0x80, 0x07, 0x99,
-    0x04, 0x00, 0x9C, 0x17, 0x0F, 0x47, 0x78, 0x9C, 0x63, 0x68, 0x63, 0x5E, 0xF0, 0xDF, 0xFF, 0xC3,
-    0xFF, 0xF9, 0x0F, 0xFE, 0xF7, 0x3B, 0xFC, 0xE5, 0x06, 0x00, 0x41, 0x12, 0x08, 0xBC, 0x78, 0x9C,
-    0x5D, 0xCE, 0x59, 0x19, 0x01, 0x60, 0x14, 0x84, 0xE1, 0xDF, 0xBE, 0x2F, 0x11, 0x34, 0xA0, 0x01,
-    0x0D, 0x68, 0x40, 0x03, 0x1A, 0xD0, 0x80, 0x06, 0x34, 0xA0, 0x01, 0x0D, 0x68, 0x40, 0x03, 0xFB,
-    0xBE, 0x8C, 0xC7, 0xF3, 0x9D, 0x73, 0x63, 0x6E, 0xE6, 0xBD, 0x98, 0x8B, 0x09, 0xE1, 0x97, 0xF3,
-    0x36, 0x90, 0xE7, 0x90, 0x2E, 0xAB, 0x0A, 0x7A, 0xCA, 0x83, 0x95, 0x92, 0xE0, 0x28, 0xDB, 0xDE,
-    0xA7, 0x06, 0x35, 0xE9, 0x96, 0x8A, 0x60, 0xA6, 0x34, 0xD8, 0x2B, 0x0A, 0xAE, 0x4B, 0xDB, 0xBE,
-    0xBB, 0x74, 0x4D, 0x25, 0x30, 0x52, 0x16, 0xEC, 0x14, 0x07, 0x97, 0xB5, 0x6D, 0x5F, 0x7D, 0xBA,
-    0xE2, 0x67, 0x06, 0xCA, 0x81, 0x8D, 0x12, 0xE0, 0xE4, 0x67, 0x1E, 0x63, 0x3F, 0x53, 0xA7, 0x3B,
-    0x2A, 0x80, 0x85, 0x52, 0xE0, 0xA0, 0x08, 0xB8, 0xCD, 0x6D, 0xFB, 0x69, 0xD3, 0x0D, 0x3F, 0x33,
-    0x51, 0xC6, 0x8F, 0xC7, 0xFE, 0xCE, 0x7C, 0x01, 0x34, 0x50, 0x35, 0xB3, 0x78, 0x9C, 0x95, 0x90,
-    0xCD, 0x11, 0xC1, 0x50, 0x14, 0x46, 0xAF, 0xF8, 0xC9, 0x0C, 0x33, 0x89, 0x0E, 0x64, 0x86, 0x7D,
-    0x4A, 0x50, 0x81, 0x8D, 0x02, 0x14, 0x60, 0xA3, 0x85, 0x74, 0x20, 0x1D, 0x48, 0x07, 0x74, 0x10,
-    0x4B, 0xCB, 0x74, 0x40, 0x0B, 0x0C, 0x92, 0x18, 0x1C, 0xEF, 0xE6, 0x45, 0xAC, 0x7D, 0xAB, 0xB3,
-    0xB8, 0xEF, 0x9B, 0xF3, 0x3D, 0x91, 0xE0, 0xF0, 0x3E, 0x2E, 0x45, 0x53, 0x62, 0xB2, 0x30, 0xB0,
-    0xA3, 0x4A, 0x4F, 0xA4, 0x60, 0x33, 0x9E, 0x3F, 0x09, 0x25, 0x80, 0xB6, 0x48, 0x4C, 0x2A, 0x11,
-    0x2B, 0x3D, 0x7E, 0xE1, 0x9C, 0xF0, 0x94, 0xEE, 0xB8, 0x17, 0xFA, 0x4A, 0x67, 0x06, 0x37, 0x5C,
-    0xA5, 0x0C, 0x2F, 0xA7, 0x23, 0x55, 0x97, 0x5F, 0xEA, 0x53, 0x91, 0x84, 0xB0, 0xA6, 0x98, 0xF0,
-    0x81, 0x63, 0x69, 0xFA, 0x3F, 0xFD, 0xFA, 0x8A, 0x86, 0x72, 0xBA, 0x4A, 0x7B, 0xFC, 0xAB, 0x35,
-    0x30, 0x72, 0x46, 0xA7, 0xB6, 0xCA, 0xF0, 0x6B, 0xD3, 0x88, 0xB5, 0xB5, 0x6F, 0x0D, 0x51, 0xC1,
-    0x84, 0x6D, 0xB5, 0x72, 0x62, 0x56, 0x8E, 0x9A, 0xE5, 0xDA, 0x55, 0x28, 0xCC, 0xF4, 0xF8, 0xFB,
-    0x43, 0x1F, 0x6B, 0xFB, 0x7E, 0x2B, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x70, 0x78, 0x05, 0x24,
-    0x9A, 0xFE, 0xFD, 0x67, 0x10, 0x38, 0xF6, 0xFF, 0xFF, 0x7F, 0x87, 0x5F, 0x40, 0xE2, 0xFF, 0x77,
-    0x10, 0xF1, 0xFF, 0xC7, 0xFF, 0xFD, 0xAC, 0x7F, 0xFF, 0xFF, 0xC8, 0x61, 0x64, 0xF8, 0xFB, 0x5F,
-    0x19, 0xA8, 0xE8, 0xEF, 0x7F, 0x86, 0x41, 0x40, 0x02, 0x00, 0x69, 0x4D, 0x48, 0x84, 0x78, 0x9C,
-    0x63, 0x60, 0x60, 0x98, 0xF2, 0xF7, 0xFD, 0x5A, 0x56, 0x06, 0x10, 0xB8, 0xF2, 0x1F, 0x08, 0xDE,
-    0x83, 0xD8, 0x09, 0xFF, 0xC1, 0xA0, 0x1F, 0xC8, 0xFC, 0xFA, 0xFF, 0xBE, 0x99, 0xD1, 0xB5, 0xFF,
-    0xFF, 0xD9, 0x18, 0x18, 0xFE, 0xFD, 0xE7, 0x00, 0x0A, 0xFC, 0xFA, 0xCF, 0x07, 0x94, 0x5F, 0x0F,
-    0xD2, 0x70, 0xE1, 0x7F, 0x3C, 0xC3, 0x81, 0xFF, 0xFA, 0x20, 0x66, 0x01, 0x50, 0xF1, 0x07, 0xA0,
-    0x0C, 0x10, 0x18, 0x00, 0x25, 0x3F, 0xFC, 0xE7, 0x01, 0x31, 0x15, 0xFE, 0xCF, 0x67, 0x80, 0x02,
-    0x83, 0xFF, 0xF5, 0x30, 0x66, 0xC3, 0x7F, 0x7B, 0x18, 0xF3, 0xC1, 0x7F, 0x5E, 0x18, 0xF3, 0x07,
-    0xC8, 0x0A, 0xA8, 0xD2, 0xF3, 0x30, 0xC1, 0x87, 0x10, 0xD3, 0x41, 0xE0, 0x0F, 0x5C, 0x7E, 0x03,
-    0xC2, 0xD4, 0x9F, 0xFF, 0xB9, 0xE1, 0x86, 0xC2, 0x35, 0x7D, 0xFF, 0x2F, 0x0B, 0x65, 0x05, 0xFC,
-    0x7F, 0xCF, 0x08, 0x65, 0x7E, 0xF9, 0xAF, 0x07, 0x37, 0xFE, 0x3F, 0x33, 0x94, 0xF9, 0xE8, 0xBF,
-    0x3F, 0x94, 0x25, 0xF0, 0xEF, 0x3F, 0x0B, 0x94, 0x79, 0x11, 0xE8, 0x2B, 0xB8, 0x9D, 0x1A, 0x4A,
-    0x60, 0xC0, 0x54, 0xF0, 0x1F, 0x06, 0xF8, 0x1B, 0xB0, 0x32, 0x01, 0x3C, 0x00, 0x6C, 0x46, 0x78,
-    0x9C, 0x45, 0x90, 0x31, 0x0A, 0xC2, 0x50, 0x10, 0x44, 0x17, 0x12, 0xB1, 0x50, 0x31, 0x37, 0x10,
-    0xED, 0x85, 0x20, 0x68, 0xAB, 0xE0, 0x01, 0x3C, 0xC2, 0xCF, 0x0D, 0xF4, 0x06, 0x5E, 0xC1, 0x03,
-    0x28, 0xA6, 0xB1, 0xD6, 0x1B, 0x68, 0x65, 0x9B, 0x42, 0xB0, 0x4D, 0x2A, 0xDB, 0x44, 0x10, 0x34,
-    0xA0, 0x8E, 0xBB, 0x7F, 0x13, 0xF3, 0xAA, 0xE1, 0x33, 0x3B, 0x3B, 0x7F, 0x89, 0x68, 0xF7, 0x49,
-    0xD7, 0x2E, 0x31, 0x17, 0x30, 0xB1, 0x43, 0x14, 0xC0, 0x62, 0x88, 0x1E, 0x88, 0x46, 0x83, 0x33,
-    0xE0, 0xD0, 0x17, 0x75, 0xB6, 0xE4, 0x68, 0x04, 0xD8, 0x8B, 0x39, 0x41, 0x27, 0xC4, 0x58, 0xD4,
-    0x0A, 0xB3, 0x13, 0xDA, 0xA2, 0x16, 0x98, 0x93, 0x52, 0xA9, 0xC2, 0xC4, 0xDC, 0xD1, 0x52, 0xE1,
-    0xBD, 0x21, 0xFB, 0xBC, 0xDE, 0x34, 0xC7, 0x52, 0x1E, 0x32, 0x5E, 0x96, 0xD6, 0x4A, 0xA5, 0x93,
-    0xA2, 0xD0, 0xD7, 0x81, 0xEE, 0x55, 0x1A, 0x28, 0xAF, 0x32, 0x85, 0x93, 0x4D, 0xA1, 0x7C, 0xAD,
-    0x24, 0x20, 0xFA, 0xAB, 0x38, 0x43, 0xB3, 0x78, 0x4B, 0xB4, 0xDF, 0x04, 0xDB, 0x50, 0xE3, 0x0F,
-    0x30, 0x3E, 0x6C, 0x8B, 0x27, 0xE7, 0xE5, 0x38, 0x0E, 0xE5, 0x97, 0x2E, 0x67, 0x5A, 0xC4, 0x73,
-    0x2B, 0xAF, 0x61, 0x2F, 0xB4, 0x61, 0xEF, 0x0F, 0xB2, 0x55, 0x70, 0x61, 0x78, 0x9C, 0x63, 0x60,
-    0x00, 0x81, 0x0F, 0xFF, 0xFB, 0x19, 0xA0, 0xE0, 0x07, 0x9C, 0xA9, 0xF0, 0x1F, 0xCE, 0x3C, 0x80,
-    0x60, 0x7E, 0x87, 0x33, 0x15, 0xFE, 0x9F, 0x87, 0x31, 0x37, 0xFC, 0x8F, 0x85, 0x31, 0xBF, 0xFE,
-    0x77, 0x81, 0x32, 0x05, 0xFE, 0xAD, 0x77, 0x80, 0x32, 0x17, 0xFC, 0x97, 0x83, 0x31, 0xBF, 0xFC,
-    0x67, 0x85, 0x31, 0xFF, 0xED, 0x67, 0x80, 0x32, 0x27, 0xFC, 0xD7, 0x87, 0x31, 0x3F, 0xFF, 0x67,
-    0x87, 0x31, 0xFF, 0x9E, 0x67, 0x80, 0x32, 0x1B, 0xFE, 0xDB, 0xC3, 0x98, 0x9F, 0xFE, 0x73, 0xC0,
-    0x98, 0x7F, 0xEE, 0x33, 0x40, 0x99, 0x05, 0xFF, 0xFD, 0x61, 0xCC, 0x4F, 0xFF, 0xA5, 0x05, 0x05,
-    0x05, 0x13, 0xFF, 0xCF, 0x17, 0x14, 0xFC, 0xFD, 0x1F, 0x06, 0xD6, 0xFF, 0xC3, 0xCA, 0x84, 0xB8,
-    0xD8, 0x01, 0xE1, 0x79, 0x4A, 0x98, 0x00, 0xCC, 0x47, 0x72, 0x26, 0x78, 0x9C, 0x65, 0xCE, 0x31,
-    0x0A, 0xC2, 0x40, 0x10, 0x05, 0xD0, 0x31, 0x08, 0x01, 0x83, 0x92, 0x23, 0x08, 0x1E, 0x20, 0x39,
-    0x80, 0x82, 0xAD, 0x95, 0xD6, 0x9E, 0x41, 0x30, 0x60, 0x61, 0x6B, 0x69, 0xE7, 0x09, 0x44, 0x1B,
-    0x7B, 0x6F, 0xE0, 0x15, 0x2C, 0xB5, 0x31, 0xDE, 0x20, 0x22, 0x31, 0x1A, 0x75, 0xF7, 0x3B, 0xBB,
-    0x99, 0xA4, 0xF1, 0x37, 0xFB, 0x60, 0x99, 0x3F, 0x43, 0x29, 0x8A, 0xD4, 0x28, 0xAB, 0xF4, 0xAA,
-    0x94, 0x63, 0x69, 0x43, 0xF4, 0x89, 0x49, 0xA2, 0x0E, 0xA5, 0xF4, 0xA6, 0x14, 0x56, 0x82, 0x36,
-    0xA6, 0xA2, 0x10, 0x43, 0xD1, 0x08, 0xC1, 0x4E, 0xC5, 0x63, 0x56, 0x84, 0xC4, 0xF4, 0xF6, 0x88,
-    0x16, 0xB2, 0xA2, 0x4E, 0x5B, 0x60, 0x3D, 0x3F, 0x01, 0x01, 0x45, 0xCA, 0xCC, 0x66, 0xE0, 0x7E,
-    0xDF, 0xB1, 0x73, 0x70, 0xA4, 0xE2, 0x0D, 0x57, 0x94, 0xC2, 0x13, 0xDD, 0xD0, 0x14, 0x5D, 0xD1,
-    0xFA, 0x13, 0xFF, 0x7E, 0x13, 0xAB, 0x3B, 0xBC, 0xBC, 0x28, 0x7A, 0xC2, 0x4D, 0xD1, 0x60, 0xF8,
-    0x1A, 0xCE, 0xD1, 0xDE, 0xBC, 0xE7, 0x6D, 0x21, 0x30, 0xE9, 0xCC, 0x34, 0x5F, 0x40, 0x8F, 0xF2,
-    0x2A, 0x0A, 0x95, 0x41, 0xD7, 0x8C, 0xF5, 0xCF, 0xFA, 0x32, 0xE0, 0xF7, 0x07, 0x73, 0x48, 0x78,
-    0x54, 0x78, 0x9C, 0x2D, 0x8E, 0x3B, 0x6E, 0xC2, 0x50, 0x10, 0x45, 0x07, 0x04, 0x48, 0x7C, 0x22,
-    0xA7, 0xA0, 0x86, 0x1D, 0x00, 0x5D, 0xD2, 0x44, 0x42, 0x6C, 0x20, 0xE9, 0x52, 0x9A, 0x1D, 0x24,
-    0x0B, 0x88, 0x64, 0xC4, 0x06, 0xCC, 0x0E, 0x58, 0x01, 0x12, 0x1D, 0xA5, 0xBD, 0x03, 0x48, 0x9B,
-    0x26, 0x59, 0x00, 0x11, 0x8E, 0x6D, 0x90, 0x40, 0xE0, 0x93, 0x37, 0xEF, 0x79, 0xAA, 0xA3, 0x19,
-    0x9D, 0x3B, 0x57, 0x44, 0x64, 0xB4, 0xF9, 0xF5, 0x45, 0x67, 0x7C, 0x85, 0x37, 0x4B, 0x17, 0x4A,
-    0xFA, 0x84, 0xE8, 0xB5, 0xAB, 0x74, 0x25, 0xB0, 0x27, 0x99, 0xF1, 0x5D, 0x75, 0xF4, 0xC7, 0xC0,
-    0x81, 0x9C, 0xA9, 0x97, 0x54, 0x6C, 0x4B, 0x18, 0x97, 0x51, 0x2A, 0x78, 0x2F, 0x5F, 0xAC, 0x6A,
-    0x22, 0x31, 0x4F, 0x37, 0x93, 0x1C, 0x55, 0xE4, 0x87, 0x02, 0x9D, 0x9E, 0x24, 0x70, 0x78, 0x98,
-    0x9C, 0xD9, 0x4A, 0x0A, 0x4D, 0xD3, 0x06, 0x1A, 0x19, 0x4B, 0x15, 0x8F, 0x74, 0x32, 0x3C, 0xA5,
-    0x1D, 0xC3, 0xDC, 0xD1, 0x3B, 0x7E, 0x4E, 0xDB, 0x3D, 0x08, 0x33, 0x15, 0x54, 0x59, 0xA6, 0xB4,
-    0x1C, 0x85, 0x09, 0x77, 0xEE, 0x1A, 0xAC, 0x19, 0x3A, 0xE3, 0x79, 0x4A, 0xA8, 0x14, 0xD3, 0x97,
-    0x82, 0xAA, 0x4D, 0x6E, 0xCB, 0x49, 0xDB, 0x9B, 0x6F, 0x35, 0xB3, 0xE7, 0xD1, 0x34, 0x30, 0x3F,
-    0xEF, 0x6F, 0xB6, 0x95, 0xE6, 0x2F, 0x14, 0xAC, 0x26, 0xF3, 0xFD, 0xE1, 0xC3, 0x58, 0xFF, 0x72,
-    0x3C, 0x79, 0x05, 0x78, 0x9C, 0xFB, 0xF6, 0x1F, 0x06, 0x78, 0xBE, 0x61, 0x63, 0x72, 0x0A, 0x08,
-    0x42, 0xC0, 0x8F, 0xFF, 0x4C, 0x0C, 0x50, 0xF0, 0x77, 0x3F, 0x8C, 0x15, 0xF0, 0xDF, 0x1F, 0xC6,
-    0x3C, 0xF0, 0x9F, 0x17, 0xC6, 0xFC, 0xF2, 0x9F, 0x0D, 0xC6, 0xFC, 0xFD, 0x1E, 0xC6, 0x52, 0xF8,
-    0xDF, 0x0F, 0x63, 0x2E, 0xF8, 0x2F, 0x0F, 0x63, 0x7E, 0xFC, 0xCF, 0x09, 0x63, 0x22, 0x59, 0xF0,
-    0x1F, 0x6E, 0x41, 0x01, 0xC2, 0x82, 0x07, 0x08, 0x0B, 0xBE, 0x21, 0x2C, 0xF8, 0x0B, 0xB7, 0xC0,
-    0x01, 0x61, 0xC1, 0x01, 0x84, 0x05, 0x9F, 0x11, 0x16, 0xFC, 0x82, 0x5B, 0xA0, 0x80, 0xB0, 0x60,
-    0x02, 0xC2, 0x82, 0x8F, 0x08, 0x0B, 0x7E, 0x20, 0x2C, 0xF8, 0x07, 0xB7, 0x20, 0x01, 0x61, 0xC1,
-    0x05, 0x84, 0x05, 0x5F, 0xFF, 0x73, 0x41, 0x18, 0x00, 0x5F, 0xF6, 0x51, 0x3E, 0x78, 0x9C, 0x35,
-    0x8F, 0xCD, 0x0D, 0x82, 0x40, 0x10, 0x85, 0x07, 0x35, 0x18, 0x8C, 0x7F, 0x1D, 0x48, 0xA2, 0x05,
-    0x60, 0x05, 0x10, 0x1B, 0x30, 0xF1, 0xE8, 0x41, 0x0F, 0x1E, 0x8D, 0xD1, 0x0A, 0xD4, 0x12, 0xEC,
-    0x00, 0x3B, 0xA0, 0x04, 0xBD, 0xE9, 0xD1, 0x0A, 0xC4, 0x0E, 0x24, 0x01, 0x34, 0x80, 0xF0, 0x9C,
-    0x59, 0xE5, 0x25, 0x9B, 0xBC, 0xCC, 0xBE, 0xFD, 0xF6, 0x0D, 0x91, 0x79, 0xC9, 0xEF, 0x53, 0x12,
-    0x25, 0x60, 0xCD, 0xD8, 0xDC, 0xA0, 0x54, 0x27, 0xCA, 0xE0, 0x0E, 0x16, 0x39, 0xE6, 0xE4, 0x00,
-    0x55, 0xA2, 0x23, 0x9E, 0x7C, 0xD6, 0x12, 0xCE, 0x51, 0x7B, 0xA0, 0x23, 0xEE, 0x85, 0x7A, 0x80,
-    0x96, 0xB8, 0x08, 0xC6, 0xDF, 0x85, 0x30, 0x6E, 0xE5, 0xAD, 0xBE, 0xFF, 0xBD, 0xF8, 0x40, 0xEB,
-    0x2A, 0xCA, 0x01, 0xAE, 0x64, 0xDD, 0xC1, 0xE4, 0x83, 0x26, 0x91, 0x53, 0xC8, 0x67, 0x9E, 0xA6,
-    0x00, 0x2C, 0x1E, 0xD1, 0x5E, 0x15, 0xF0, 0x39, 0x9C, 0x62, 0x55, 0x19, 0x26, 0xB0, 0x69, 0x83,
-    0x13, 0x5F, 0x38, 0x78, 0x6A, 0x01, 0xDA, 0xC2, 0x8B, 0xD1, 0x88, 0xA5, 0x23, 0x11, 0x17, 0x49,
-    0x04, 0x2C, 0x68, 0x3B, 0x45, 0x85, 0x14, 0x61, 0x9C, 0x96, 0xB3, 0xF1, 0x1B, 0x3A, 0xA9, 0xBD,
-    0x7A, 0x61, 0xD9, 0xB4, 0x75, 0x86, 0xC7, 0xC6, 0x2A, 0xA0, 0x5B, 0xC0, 0xB6, 0x3F, 0x4A, 0x84,
-    0x1F, 0xFD, 0x36, 0xE7, 0x0A, 0x66, 0x26, 0x66, 0x27, 0x61, 0xEB, 0x5A, 0xF8, 0x4B, 0xAE, 0xF7,
-    0x05, 0x79, 0xC2, 0x8A, 0x66, 0x78, 0x9C, 0x2D, 0xCF, 0x3F, 0x0E, 0x01, 0x41, 0x14, 0x06, 0xF0,
-    0xE7, 0x4F, 0x08, 0x76, 0x45, 0xA7, 0x63, 0x13, 0x17, 0x10, 0x2E, 0xE0, 0x02, 0x12, 0x57, 0x50,
-    0x2B, 0x34, 0x2A, 0x85, 0x38, 0x82, 0x1B, 0xA8, 0xD4, 0x34, 0x6A, 0x37, 0xB0, 0xB5, 0x86, 0xA0,
-    0x13, 0xC9, 0xEE, 0x0A, 0x4B, 0xAC, 0x9D, 0xCF, 0x7B, 0x33, 0xF3, 0x35, 0xF3, 0x9B, 0x79, 0x33,
-    0x6F, 0x66, 0x88, 0xDA, 0x07, 0xB5, 0xAF, 0x13, 0xC7, 0x4B, 0xC0, 0x29, 0xB0, 0x2E, 0x02, 0x2C,
-    0x59, 0x0A, 0xB3, 0xD6, 0x56, 0x16, 0x17, 0xF0, 0x79, 0xFA, 0x46, 0x93, 0x22, 0x34, 0x58, 0x73,
-    0x2E, 0xC7, 0x28, 0xCA, 0x39, 0x15, 0xD0, 0x17, 0x19, 0xD1, 0x07, 0xF9, 0x34, 0x10, 0xD0, 0x13,
-    0x45, 0xE5, 0x6B, 0x45, 0x28, 0xAB, 0x93, 0x56, 0x08, 0xC7, 0x56, 0x43, 0xB8, 0x89, 0x39, 0xC1,
-    0x7A, 0x9B, 0x2E, 0x2F, 0xB8, 0x0F, 0xDD, 0xB9, 0xA6, 0xE0, 0x6C, 0xE0, 0x73, 0xF9, 0x0A, 0x38,
-    0x1E, 0x30, 0xEB, 0xAE, 0xF8, 0x35, 0x65, 0xDE, 0x21, 0x89, 0x51, 0xA2, 0x9E, 0x62, 0xF4, 0x23,
-    0x79, 0xEB, 0xF0, 0x1E, 0x8C, 0xF8, 0xB6, 0x1C, 0x99, 0x7C, 0x60, 0x41, 0xE9, 0xCE, 0x62, 0x80,
-    0xB1, 0xD5, 0x19, 0x55, 0x83, 0x5A, 0xAA, 0xBF, 0xC9, 0x89, 0xB1, 0x96, 0xA1, 0x33, 0xB9, 0x01,
-    0x15, 0xD1, 0xCF, 0x7E, 0x5C, 0x6B, 0x67, 0xDA, 0x26, 0xC7, 0x69, 0x56, 0xC6, 0x3F, 0xC9, 0x27,
-    0x79, 0x2B, 0x78, 0x9C, 0x13, 0x28, 0x67, 0xBA, 0xF0, 0x5F, 0xFF, 0xF3, 0xFF, 0xFC, 0x8F, 0xFF,
-    0xFD, 0x13, 0xDE, 0x71, 0x32, 0x10, 0x07, 0x04, 0x40, 0xBA, 0xE4, 0x61, 0xBA, 0x38, 0x00, 0x4B,
-    0x60, 0x10, 0xEC, 0x78, 0x9C, 0x63, 0x70, 0xC8, 0x60, 0x60, 0xF8, 0xF6, 0x9F, 0x93, 0xE1, 0xF7,
-    0x7F, 0x3E, 0x86, 0x9F, 0xFF, 0x79, 0x18, 0x36, 0xDE, 0x67, 0x66, 0x20, 0x07, 0x7C, 0x02, 0x9A,
-    0x01, 0xC3, 0x9F, 0xFF, 0x73, 0x30, 0x7C, 0xF9, 0xCF, 0xC6, 0xF0, 0xE3, 0x3F, 0x23, 0xC3, 0xBF,
-    0xFD, 0x0C, 0x05, 0xFF, 0xF5, 0x19, 0x1E, 0xFC, 0x67, 0x67, 0x10, 0xE8, 0x62, 0x60, 0x00, 0x00,
-    0xD5, 0x30, 0x19, 0xFA, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x03, 0x05, 0x2B, 0x08, 0x6D, 0xF0, 0xDB,
-    0x1F, 0x4C, 0x3B, 0xFC, 0xFE, 0x0F, 0x66, 0x04, 0xFC, 0xF9, 0x0F, 0x66, 0x04, 0xFC, 0xFD, 0xFF,
-    0xFF, 0x3E, 0x3B, 0x03, 0x43, 0x02, 0x90, 0xDE, 0xCF, 0xC2, 0xC0, 0x50, 0xF0, 0xEF, 0xFF, 0xFF,
-    0x7E, 0x26, 0x06, 0x86, 0x46, 0x20, 0x9D, 0x0B, 0x52, 0xF8, 0xFB, 0xFF, 0x7F, 0x2F, 0xB0, 0xCE,
-    0xFF, 0xFF, 0xF5, 0x21, 0x46, 0x01, 0x45, 0x34, 0xC1, 0x0C, 0x90, 0x9A, 0x18, 0x30, 0x0B, 0xA4,
-    0xAB, 0x8F, 0x11, 0xC4, 0x02, 0x99, 0xB3, 0x9E, 0x85, 0x01, 0x66, 0x32, 0x1B, 0xB2, 0x5D, 0x08,
-    0xDB, 0x11, 0xEE, 0x01, 0xB9, 0x10, 0x00, 0x17, 0x1D, 0x38, 0xC7, 0x78, 0x9C, 0x0B, 0x09, 0x85,
-    0x00, 0xD1, 0x7F, 0xFF, 0x21, 0xC0, 0x1E, 0x93, 0xC1, 0x40, 0x16, 0xC0, 0x63, 0xA0, 0x0B, 0x14,
-    0x88, 0x00, 0x00, 0xA5, 0xDF, 0x36, 0x35, 0x78, 0x9C, 0x5B, 0xCC, 0xCC, 0x00, 0x05, 0x9F, 0xCF,
-    0xB3, 0xC0, 0x58, 0xFF, 0xEF, 0xB3, 0xC1, 0x58, 0xFF, 0xDF, 0x8B, 0x83, 0x59, 0x0E, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xAF, 0x09, 0x66, 0x0A, 0xBC, 0x00, 0x32, 0xAD, 0x20, 0x0A, 0xB6, 0x00, 0x99, 0x3E,
-    0x10, 0x66, 0xE3, 0xBF, 0xFF, 0xFF, 0x73, 0x19, 0xE0, 0x8A, 0xA1, 0x26, 0x04, 0xFC, 0xFF, 0xCF,
-    0x09, 0x66, 0x24, 0xFC, 0x81, 0x8A, 0x4D, 0xFA, 0x0F, 0x55, 0x77, 0x14, 0xAA, 0x57, 0x01, 0x66,
-    0x5E, 0x00, 0xDC, 0x0E, 0x84, 0xBD, 0x48, 0x6E, 0x81, 0xBB, 0x6F, 0x31, 0xDC, 0xCD, 0x00, 0xC8,
-    0xF6, 0x3C, 0x9C, 0x78, 0x9C, 0x8D, 0xCF, 0x4F, 0x0E, 0xC1, 0x40, 0x14, 0xC7, 0xF1, 0x47, 0xFD,
-    0x8D, 0x04, 0x1B, 0xB6, 0x75, 0x03, 0x8E, 0xE0, 0x12, 0xD6, 0x38, 0x01, 0x37, 0x70, 0x02, 0x71,
-    0x04, 0x3D, 0x42, 0x2F, 0x20, 0x15, 0xD7, 0xB0, 0xE9, 0xD2, 0xAE, 0xA1, 0x54, 0x8A, 0xF8, 0x9A,
-    0xCE, 0x9B, 0xEE, 0xBD, 0xCD, 0xEF, 0x93, 0xF7, 0x32, 0xF3, 0x66, 0x44, 0x96, 0x67, 0x0E, 0x43,
-    0x11, 0x59, 0x60, 0x2A, 0xA9, 0x8B, 0xE4, 0x05, 0x58, 0xC9, 0x1A, 0xB6, 0xB3, 0x0B, 0x78, 0x31,
-    0x1B, 0x33, 0xFF, 0xD0, 0xBE, 0xD3, 0x31, 0xB8, 0xD2, 0xCB, 0x68, 0x18, 0x1C, 0xF1, 0xC5, 0x56,
-    0xC0, 0x58, 0x11, 0x96, 0x9D, 0x98, 0xAE, 0xE2, 0x49, 0xCB, 0xE6, 0x94, 0xA4, 0x62, 0x91, 0x32,
-    0xB7, 0x39, 0xC1, 0x4D, 0x52, 0x76, 0x36, 0xFB, 0x5F, 0xD7, 0x08, 0xD9, 0xEB, 0xD9, 0x5B, 0x79,
-    0x49, 0x46, 0x53, 0x91, 0x53, 0x53, 0xBC, 0xA8, 0xCA, 0xDF, 0x35, 0x1A, 0x38, 0x3C, 0xF0, 0x14,
-    0xE6, 0x2F, 0x8A, 0xB7, 0xDB, 0x29, 0xA7, 0xA8, 0x78, 0xDE, 0x0F, 0xF1, 0x56, 0x45, 0xFA, 0x78,
-    0x9C, 0x5D, 0x92, 0xBD, 0x4E, 0x02, 0x51, 0x10, 0x85, 0x47, 0x90, 0x08, 0xA8, 0xC0, 0x1B, 0x48,
-    0x65, 0xA3, 0x09, 0x76, 0x26, 0xC6, 0xC2, 0x17, 0x30, 0xC6, 0x1A, 0x12, 0x88, 0x3D, 0x81, 0xD8,
-    0x5A, 0xE0, 0x1B, 0x80, 0xB5, 0x05, 0x52, 0x58, 0x58, 0x10, 0x28, 0x2C, 0x35, 0xD0, 0x58, 0xA8,
-    0x05, 0x6A, 0x63, 0x62, 0x83, 0xB1, 0x33, 0x14, 0x8B, 0x0B, 0x08, 0xAC, 0xB2, 0xC7, 0x39, 0xBB,
-    0x22, 0xE0, 0x14, 0x33, 0xE7, 0x7E, 0x7B, 0xE7, 0x67, 0x67, 0x57, 0x84, 0x76, 0xF0, 0x62, 0x1B,
-    0xE5, 0x55, 0xF9, 0xB3, 0x1B, 0x38, 0x96, 0x18, 0x9F, 0x9F, 0x00, 0xE3, 0xEA, 0xDE, 0x06, 0xD6,
-    0xDD, 0x73, 0x16, 0x88, 0xCF, 0x89, 0x44, 0xCE, 0x01, 0x9F, 0x03, 0x06, 0x58, 0x73, 0x9F, 0x94,
-    0x90, 0x64, 0x38, 0x46, 0x66, 0x9C, 0xDB, 0x83, 0xD7, 0xF1, 0xBE, 0x31, 0xD8, 0xC1, 0xB2, 0x48,
-    0xD4, 0xBD, 0xE7, 0x5A, 0x3F, 0x27, 0x72, 0x86, 0xC0, 0x04, 0x3C, 0x18, 0x22, 0x1D, 0x83, 0x2A,
-    0xD5, 0x32, 0xE2, 0x0C, 0x9A, 0x6E, 0xE9, 0x2D, 0x89, 0x8E, 0x74, 0xAE, 0x6D, 0x15, 0x08, 0x46,
-    0x10, 0xD2, 0xF8, 0x86, 0xC6, 0x1D, 0xA0, 0xE2, 0x2B, 0x94, 0x62, 0x89, 0x88, 0xDD, 0xF0, 0x88,
-    0x49, 0xD0, 0x8F, 0x55, 0x31, 0x2F, 0x52, 0x60, 0x3B, 0xB3, 0xA9, 0xA0, 0x9B, 0x6C, 0x93, 0x9B,
-    0x1C, 0xA8, 0x5B, 0xA3, 0xCA, 0x99, 0x0D, 0x0D, 0x43, 0xEA, 0x5E, 0x45, 0xDD, 0x47, 0xB1, 0x57,
-    0x64, 0xED, 0x3D, 0xA6, 0xE7, 0xD5, 0xB5, 0x8B, 0x0C, 0x1B, 0x08, 0xF3, 0x5A, 0xCE, 0x01, 0x83,
-    0x0C, 0xDF, 0x7F, 0x49, 0xB5, 0x95, 0x74, 0xC0, 0x30, 0xC9, 0x26, 0x41, 0xD5, 0xDF, 0xCC, 0x33,
-    0xF3, 0x04, 0x55, 0xF8, 0x55, 0xDB, 0x31, 0xB6, 0xCD, 0x10, 0xD4, 0xB1, 0xC0, 0xCA, 0x2B, 0xCE,
-    0x60, 0xC3, 0x0C, 0x81, 0x9F, 0xBB, 0x60, 0xE5, 0xEF, 0x10, 0xBB, 0x9C, 0x61, 0x91, 0x34, 0xCC,
-    0xE5, 0x04, 0x38, 0x4E, 0x16, 0x9A, 0xDE, 0xA7, 0xAB, 0xC3, 0xC3, 0x37, 0x88, 0xA2, 0xE9, 0x3D,
-    0x01, 0x74, 0x44, 0xAB, 0x28, 0xAF, 0xD0, 0x2F, 0x60, 0xE9, 0x36, 0xF2, 0x3D, 0x1C, 0xBD, 0xEB,
-    0x40, 0x05, 0x76, 0x78, 0x54, 0xE0, 0x2F, 0xA8, 0xAB, 0xFC, 0x2E, 0x5A, 0x9E, 0x8D, 0x2D, 0xFD,
-    0xA0, 0x76, 0x59, 0x57, 0x21, 0xA3, 0xA9, 0xA5, 0x3B, 0xF6, 0x69, 0xCC, 0xCD, 0x82, 0x3A, 0x87,
-    0x98, 0xB6, 0x08, 0x6A, 0xFF, 0x72, 0x3A, 0xD8, 0x9D, 0x05, 0x1B, 0x36, 0x12, 0x2C, 0x73, 0x98,
-    0x1E, 0x93, 0x12, 0xD0, 0x3C, 0xBD, 0x68, 0x4D, 0xA5, 0x5E, 0xBA, 0x7F, 0x54, 0x7A, 0x92, 0xB5,
-    0x7F, 0x6B, 0x1B, 0xD7, 0x9B, 0xAE, 0xFE, 0x01, 0xA9, 0xDD, 0xD0, 0x70, 0x78, 0x9C, 0x4D, 0xD0,
-    0xEB, 0x0D, 0x82, 0x40, 0x10, 0x04, 0xE0, 0x23, 0x12, 0x22, 0x04, 0x85, 0x0E, 0xB4, 0x03, 0x4C,
-    0x2C, 0x00, 0x3A, 0xD1, 0x0E, 0xA4, 0x04, 0x3B, 0x80, 0x0E, 0xB4, 0x03, 0x4B, 0xD0, 0x12, 0xE8,
-    0x40, 0x3B, 0xF0, 0x41, 0x30, 0x2A, 0x86, 0x71, 0xF7, 0xB8, 0xE5, 0x9C, 0x1F, 0x90, 0x8F, 0x70,
-    0x30, 0x19, 0xA5, 0x28, 0x0B, 0x1C, 0x94, 0x4D, 0x09, 0xFC, 0xE9, 0x02, 0x78, 0x56, 0x0D, 0x10,
-    0x5A, 0xB5, 0x40, 0x32, 0x20, 0x46, 0x81, 0x62, 0x50, 0x8E, 0xA4, 0xBD, 0x0E, 0xAA, 0x10, 0x36,
-    0x70, 0x45, 0x35, 0xBC, 0x1B, 0x02, 0xD1, 0x07, 0x4E, 0x89, 0x99, 0x88, 0x9A, 0x64, 0xD8, 0x18,
-    0xAC, 0xB1, 0x52, 0xAA, 0x3B, 0x1B, 0x9D, 0x30, 0x55, 0xEA, 0x85, 0x51, 0xAF, 0x07, 0x7C, 0x73,
-    0xE1, 0xE8, 0xC7, 0xFA, 0x05, 0x8E, 0x3E, 0x92, 0xF3, 0x61, 0x4A, 0xA6, 0x5B, 0xC5, 0x38, 0x6A,
-    0xED, 0xFB, 0xC6, 0x2D, 0x1C, 0xBE, 0xDD, 0x91, 0x2E, 0x29, 0x6F, 0x8C, 0x59, 0x4F, 0x98, 0x44,
-    0xAC, 0xAF, 0x28, 0x25, 0xCC, 0x05, 0xD8, 0x91, 0xB6, 0xE6, 0xD3, 0xAA, 0x83, 0x5E, 0x28, 0x92,
-    0x12, 0x1E, 0x2F, 0xE4, 0x4B, 0xC1, 0x90, 0xFF, 0xE3, 0xCA, 0x02, 0x09, 0x75, 0x90, 0x45, 0x72,
-    0xEA, 0x94, 0x0F, 0x6B, 0xF1, 0xF3, 0xCA, 0x2E, 0x49, 0x67, 0x6A, 0x4C, 0xEC, 0xE2, 0xC1, 0x0F,
-    0x03, 0x4C, 0x7D, 0xAF, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x08, 0xDE, 0xAF, 0x55, 0x67, 0x60, 0x60,
-    0xF8, 0xF1, 0x1F, 0x02, 0xA4, 0x10, 0xCC, 0xFB, 0x8C, 0x40, 0xA6, 0x85, 0xB1, 0x71, 0xC8, 0xF1,
-    0xFF, 0xFF, 0x79, 0x80, 0x4C, 0x36, 0xA0, 0x32, 0x86, 0xAF, 0xFF, 0xE3, 0x61, 0xCC, 0x86, 0xFF,
-    0xEB, 0x61, 0x4C, 0x85, 0xFF, 0xF7, 0x61, 0x4C, 0x86, 0xFF, 0xFF, 0x11, 0xCC, 0xF7, 0x30, 0xA6,
-    0xC1, 0xFF, 0xF3, 0x30, 0xE6, 0x86, 0xFF, 0xF9, 0x30, 0xE6, 0x8F, 0xFF, 0xBC, 0x40, 0xEC, 0x19,
-    0x1A, 0x5A, 0xFA, 0xEA, 0xFF, 0x7B, 0x26, 0xB8, 0xC5, 0xD2, 0x08, 0x37, 0xB0, 0x21, 0x39, 0x87,
-    0x09, 0xAA, 0x2D, 0xE8, 0xCF, 0x7F, 0x3D, 0x84, 0x1B, 0xE0, 0xE6, 0x32, 0xFC, 0xF9, 0xCF, 0x0C,
-    0x63, 0x7E, 0xFB, 0xCF, 0x01, 0x63, 0x7E, 0xFE, 0xCF, 0x0D, 0x63, 0x7E, 0xFA, 0xCF, 0x03, 0x63,
-    0x7E, 0x41, 0x88, 0xFE, 0xF8, 0xCF, 0x09, 0x65, 0x0A, 0xFC, 0xFB, 0xCF, 0x02, 0x65, 0x5E, 0x02,
-    0x7B, 0xC8, 0xD2, 0xD8, 0xD8, 0x79, 0xD9, 0xFF, 0xFF, 0xF6, 0x70, 0x37, 0xFC, 0x67, 0x85, 0x33,
-    0x75, 0x60, 0x2E, 0x3B, 0x6B, 0x01, 0x54, 0x0F, 0x00, 0xA4, 0xE8, 0xA3, 0xF4, 0x78, 0x9C, 0x63,
-    0x60, 0x60, 0x60, 0x58, 0xFA, 0xF6, 0xFF, 0x5A, 0x31, 0x06, 0x30, 0xF8, 0xFE, 0x1F, 0x04, 0x38,
-    0x40, 0xCC, 0x4B, 0x60, 0xE6, 0xFF, 0xF3, 0x8C, 0x0C, 0x0C, 0x0A, 0xFF, 0xFE, 0x9F, 0x0F, 0x0F,
-    0x39, 0xFE, 0xFF, 0x3F, 0x2F, 0x03, 0xC3, 0x85, 0xFF, 0xF7, 0x59, 0x80, 0xB2, 0x4F, 0xFE, 0xCF,
-    0x67, 0x60, 0xF8, 0xF1, 0x5F, 0x16, 0xA4, 0xD2, 0xE0, 0xFF, 0x7F, 0x26, 0x81, 0xFF, 0xFF, 0x99,
-    0xC1, 0x26, 0xFC, 0xF8, 0xCF, 0x51, 0x00, 0x92, 0x03, 0x81, 0x4F, 0xFF, 0xF9, 0x2E, 0xFC, 0xB7,
-    0x87, 0xB0, 0x2F, 0xFC, 0xD7, 0xFF, 0xF8, 0x9F, 0x0F, 0xC2, 0x9E, 0xF0, 0x3F, 0xFE, 0xCB, 0x7F,
-    0x2E, 0x06, 0x18, 0xF8, 0x06, 0xB1, 0x10, 0xEA, 0x00, 0x76, 0x38, 0xFB, 0xC7, 0x7F, 0x36, 0x92,
-    0xD8, 0xC8, 0x7A, 0x91, 0xCD, 0xFC, 0xF2, 0x9F, 0x1B, 0xCE, 0x46, 0x76, 0x03, 0x92, 0xDB, 0xE4,
-    0x1B, 0x90, 0xDC, 0x0C, 0xF4, 0x0B, 0x13, 0x98, 0xFD, 0x13, 0x68, 0xC8, 0x4F, 0x90, 0xA7, 0xC1,
-    0x7E, 0x64, 0x04, 0xF9, 0x1D, 0x24, 0xF1, 0xF4, 0x7F, 0x3F, 0x50, 0xE0, 0xDF, 0xFF, 0xFD, 0x6E,
-    0xCE, 0xC0, 0x30, 0xE1, 0x01, 0x8A, 0x3C, 0x82, 0x84, 0xD5, 0x7E, 0xA8, 0x93, 0x80, 0xE0, 0x3D,
-    0xC4, 0x59, 0x02, 0xDB, 0xFE, 0xBE, 0x5F, 0xCB, 0x0A, 0x64, 0x00, 0x00, 0x56, 0x2F, 0x75, 0x5E,
-    0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x08, 0xCE, 0x5A, 0x30, 0x80, 0xC0, 0x8F, 0xFF, 0x60, 0x10, 0x8B,
-    0xC4, 0xFE, 0x2F, 0x03, 0x66, 0x5B, 0x19, 0x3B, 0xB7, 0xFE, 0xFD, 0xFF, 0x9E, 0x09, 0xC4, 0x66,
-    0x03, 0x8A, 0x04, 0xFC, 0xFD, 0x2F, 0x07, 0x63, 0x33, 0x1C, 0xFC, 0xBF, 0x1F, 0xCE, 0x16, 0xF8,
-    0xF7, 0x9F, 0x05, 0xC6, 0x66, 0xF8, 0xF2, 0x9F, 0x07, 0xCE, 0xBE, 0xF0, 0x5F, 0x1F, 0xCE, 0x2E,
-    0xF8, 0x5F, 0x0F, 0x67, 0x1B, 0x00, 0x35, 0xC3, 0xD8, 0x0C, 0xFF, 0xDF, 0x23, 0xD8, 0xFF, 0xFE,
-    0x23, 0xD8, 0x7F, 0x51, 0xD8, 0x8C, 0x38, 0xD8, 0xD8, 0xF5, 0x22, 0x99, 0x89, 0x6C, 0x17, 0xB2,
-    0x1B, 0x90, 0xDD, 0xF6, 0x15, 0xE1, 0x66, 0x64, 0xBF, 0x5C, 0x44, 0xF8, 0x31, 0xE0, 0x1F, 0xC4,
-    0xEF, 0xC0, 0x30, 0x99, 0xF6, 0x0F, 0x1A, 0x26, 0xC8, 0x61, 0x85, 0x1A, 0x86, 0xEF, 0xF7, 0x9A,
-    0x83, 0xCD, 0x05, 0x00, 0x51, 0xCA, 0x90, 0x0C, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x0A, 0xEC, 0x7F,
-    0x60, 0x65, 0x59, 0x19, 0x83, 0x01, 0xF3, 0x8F, 0xFF, 0x6C, 0x0C, 0x10, 0x40, 0x2D, 0x16, 0xC4,
-    0x64, 0x61, 0x06, 0x98, 0x6D, 0xF1, 0x38, 0x58, 0xD4, 0xB6, 0x17, 0xB7, 0x5B, 0x8C, 0x85, 0xE1,
-    0x3E, 0xAF, 0xC7, 0xC6, 0x02, 0x00, 0x5B, 0xD1, 0x7E, 0xB4, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x0A,
-    0xF8, 0x7F, 0x60, 0x65, 0x59, 0x19, 0x83, 0x01, 0xF3, 0x8F, 0xFF, 0x6C, 0x0C, 0x10, 0x40, 0x7D,
-    0x16, 0xC4, 0x0E, 0x66, 0x06, 0x98, 0xBD, 0xFC, 0x38, 0x58, 0xB4, 0x73, 0x01, 0x71, 0x2C, 0x00,
-    0xE7, 0xAD, 0x65, 0x55, 0x78, 0x9C, 0x4D, 0xD0, 0xBD, 0x6A, 0x02, 0x41, 0x10, 0xC0, 0xF1, 0x81,
-    0xCB, 0x97, 0x21, 0xD1, 0x83, 0x74, 0x01, 0xB1, 0x4C, 0x99, 0x84, 0xD8, 0xE7, 0x11, 0xB4, 0x10,
-    0xC4, 0x2A, 0x16, 0xF6, 0xF1, 0x0D, 0x14, 0x52, 0xA6, 0xB8, 0x57, 0xB8, 0x2A, 0x6D, 0xF2, 0x02,
-    0xA9, 0x53, 0xDE, 0x81, 0x96, 0x81, 0x43, 0xAC, 0x2C, 0xC2, 0x09, 0x7A, 0x1A, 0xC1, 0xE4, 0xEF,
-    0xEE, 0x8E, 0x59, 0x32, 0xC5, 0xF2, 0x83, 0xD9, 0x99, 0xDD, 0x19, 0x11, 0x09, 0x5F, 0xBE, 0x78,
-    0xBF, 0x12, 0x1B, 0xE1, 0x06, 0x1B, 0x97, 0xD6, 0x53, 0x47, 0xF2, 0x03, 0x91, 0x1B, 0x48, 0xDA,
-    0xAD, 0x0F, 0xB8, 0x17, 0x99, 0x90, 0x05, 0x26, 0x3B, 0x22, 0x17, 0xD9, 0x50, 0x75, 0x55, 0xBF,
-    0x1C, 0x85, 0x10, 0xB8, 0x16, 0x4B, 0xCA, 0x43, 0x5E, 0x1D, 0x25, 0xE5, 0x3A, 0xA5, 0xA1, 0x1E,
-    0xF2, 0x38, 0xA7, 0x22, 0x7F, 0xB1, 0xE0, 0xCC, 0xBB, 0xA0, 0xE4, 0xBD, 0xE2, 0xC4, 0x7B, 0xFD,
-    0xCF, 0xDF, 0x1C, 0x9B, 0xF3, 0xF6, 0xCE, 0xC4, 0x85, 0xBA, 0xB0, 0xBF, 0x8B, 0xF4, 0x8E, 0x7A,
-    0xE5, 0xFA, 0xA8, 0x0B, 0x4E, 0xB5, 0xB0, 0x4B, 0xB4, 0xE0, 0xDC, 0x7B, 0x4E, 0xCD, 0xFB, 0x8D,
-    0x81, 0x77, 0x93, 0xCC, 0x5B, 0x7E, 0xF6, 0x0F, 0x5B, 0x17, 0x3C, 0x38, 0xF7, 0x8D, 0x63, 0x34,
-    0xB1, 0xB6, 0x85, 0x5B, 0xF2, 0x4E, 0xBD, 0x37, 0xC3, 0x0E, 0x12, 0xEB, 0xAE, 0x74, 0xEE, 0xB1,
-    0x63, 0x72, 0xE8, 0xCA, 0x9E, 0x3E, 0xC9, 0x9E, 0xCD, 0x66, 0x76, 0x27, 0xC3, 0x8C, 0x81, 0x78,
-    0x9C, 0xFB, 0xF1, 0x9F, 0x8D, 0x01, 0x0C, 0x1A, 0xFE, 0xE7, 0xFF, 0x18, 0x14, 0x6C, 0x2B, 0x63,
-    0x30, 0xD8, 0x0C, 0x62, 0xC3, 0x01, 0x1E, 0xF6, 0x60, 0x70, 0x33, 0x61, 0x36, 0x00, 0xA8, 0x4E,
-    0x8D, 0x7A, 0x78, 0x9C, 0xFB, 0xF2, 0x9F, 0xFB, 0x0B, 0x6D, 0x10, 0x00, 0xBB, 0x94, 0x3B, 0xC5,
-    0x78, 0x9C, 0x63, 0x60, 0x00, 0x83, 0x0F, 0xFF, 0xF9, 0x19, 0x86, 0x07, 0x8B, 0xEF, 0xDF, 0x7F,
-    0x46, 0x28, 0xEB, 0xEF, 0x7F, 0x66, 0x10, 0xEB, 0xD3, 0x7F, 0xDE, 0x5F, 0xFF, 0xD9, 0x41, 0xAC,
-    0xEF, 0xFF, 0xB9, 0xBE, 0xFD, 0xE7, 0x05, 0x32, 0x04, 0xFE, 0xFD, 0x67, 0x7D, 0xF0, 0x7F, 0x3F,
-    0x50, 0xE1, 0xC1, 0xFF, 0xEF, 0x19, 0x12, 0xFE, 0xFF, 0xEF, 0x33, 0x9D, 0xFA, 0xEF, 0xBF, 0x3D,
-    0x03, 0xC3, 0x8F, 0xFF, 0x60, 0xC0, 0xC6, 0xC0, 0x10, 0xF0, 0x0F, 0xC4, 0xB0, 0x05, 0x69, 0x73,
-    0xB8, 0xF5, 0xEF, 0x7E, 0x14, 0x90, 0x06, 0x00, 0xD2, 0xDA, 0x54, 0xF2, 0x78, 0x9C, 0x4D, 0xCF,
-    0xCD, 0x0D, 0x82, 0x40, 0x10, 0x05, 0xE0, 0x31, 0x1A, 0x48, 0xF0, 0x00, 0x0D, 0x68, 0xE8, 0xC0,
-    0x12, 0xB0, 0x04, 0x3B, 0xF0, 0xE6, 0x55, 0x3B, 0xD0, 0x12, 0xEC, 0xC0, 0x12, 0xB0, 0x03, 0xE9,
-    0xC0, 0x12, 0x0C, 0x15, 0x70, 0x31, 0x71, 0x05, 0xE5, 0xB9, 0x3F, 0xF3, 0x36, 0xCE, 0x65, 0xBF,
-    0xCB, 0xEC, 0x7B, 0x63, 0x90, 0x88, 0x9B, 0x2B, 0xBA, 0x89, 0x51, 0xF7, 0x58, 0x89, 0xFA, 0x04,
-    0xCC, 0xE8, 0x17, 0xB6, 0xA2, 0xDE, 0x00, 0x29, 0xFD, 0xC4, 0x45, 0xD4, 0x25, 0x90, 0xD1, 0x2D,
-    0xEE, 0xA2, 0x2E, 0xBE, 0x58, 0xD0, 0x8D, 0xCD, 0xA1, 0x7B, 0x54, 0xA2, 0x3E, 0xBB, 0x1C, 0xB5,
-    0x71, 0x39, 0xC1, 0x3B, 0x20, 0xA7, 0x07, 0xA0, 0xA6, 0xDD, 0x24, 0x74, 0xFD, 0x8E, 0xFF, 0x20,
-    0x6B, 0xF0, 0x50, 0xDF, 0xA4, 0x1C, 0x7D, 0x1D, 0xEB, 0xDC, 0xD5, 0xDC, 0x07, 0xA7, 0xFE, 0xAA,
-    0x29, 0x7B, 0xCA, 0xC7, 0x97, 0x0B, 0x6E, 0xED, 0x16, 0xBD, 0xFE, 0xBB, 0xD1, 0x3E, 0x55, 0xB4,
-    0x3F, 0x41, 0x5D, 0x8C, 0x98, 0xD3, 0x36, 0xE2, 0x18, 0x7D, 0xB0, 0x11, 0xB4, 0x0C, 0x58, 0xFE,
-    0x00, 0xCC, 0x92, 0x89, 0x47, 0x78, 0x9C, 0xFB, 0xF1, 0x9F, 0x8D, 0x01, 0x02, 0x7E, 0x8C, 0x60,
-    0x96, 0x95, 0x31, 0x18, 0x30, 0xFD, 0xF8, 0x0F, 0x05, 0x9C, 0xD8, 0x58, 0x00, 0x6C, 0x6C, 0x52,
-    0x03, 0x78, 0x9C, 0x55, 0xD0, 0xE1, 0x0D, 0x82, 0x40, 0x0C, 0x86, 0xE1, 0x06, 0xD0, 0x18, 0x4C,
-    0xD4, 0xB8, 0x80, 0xAB, 0x30, 0x89, 0xB2, 0x81, 0xC6, 0x05, 0x1C, 0xC1, 0x55, 0xD8, 0x00, 0x46,
-    0xD0, 0x09, 0x1C, 0x81, 0x10, 0x62, 0x38, 0xD0, 0xF0, 0x79, 0xED, 0xF5, 0x0E, 0xEC, 0xAF, 0x3E,
-    0x7F, 0xDE, 0x34, 0x35, 0x28, 0xC9, 0x4F, 0x03, 0xC4, 0x06, 0x88, 0xBC, 0x8D, 0xF3, 0xCA, 0x7B,
-    0x74, 0xDE, 0x28, 0x33, 0x38, 0x9F, 0xD4, 0x85, 0xBA, 0x9C, 0x72, 0xEC, 0x8F, 0x0F, 0xF2, 0x6A,
-    0xFD, 0xF6, 0xC1, 0xB1, 0xEE, 0xD8, 0x4F, 0x0D, 0x66, 0xB8, 0x8B, 0xAF, 0x1A, 0x2C, 0x70, 0x10,
-    0xEF, 0x35, 0xD8, 0x60, 0x6D, 0xD8, 0xF1, 0xE0, 0x82, 0x06, 0x89, 0x73, 0xEB, 0x82, 0x63, 0x4D,
-    0x3D, 0x3B, 0x79, 0x48, 0x30, 0xC3, 0x4D, 0x7D, 0x91, 0xA0, 0xCD, 0xD1, 0xC0, 0x5E, 0xEC, 0x24,
-    0xD8, 0x20, 0x55, 0x93, 0x04, 0x3B, 0x24, 0x24, 0xF7, 0x2D, 0x49, 0x82, 0xE3, 0x8B, 0xBC, 0x39,
-    0xC8, 0x39, 0xEF, 0xDC, 0x06, 0x39, 0x47, 0x5F, 0x67, 0xB2, 0x41, 0xCE, 0x05, 0xF7, 0x88, 0x38,
-    0x17, 0x6C, 0x83, 0x9C, 0x0B, 0xAE, 0x70, 0xE4, 0x5C, 0x70, 0x8E, 0x9A, 0x73, 0xC1, 0x64, 0x3F,
-    0x97, 0xCE, 0xDD, 0xDB, 0x4F, 0xCE, 0xDD, 0x82, 0x73, 0x93, 0x2B, 0x9C, 0xFF, 0x9C, 0x63, 0xAB,
-    0xFE, 0x01, 0xEC, 0xE9, 0xD9, 0x77, 0x78, 0x9C, 0x4D, 0xCF, 0xBB, 0x01, 0x82, 0x40, 0x14, 0x44,
-    0xD1, 0x47, 0xE2, 0x8F, 0x84, 0x12, 0xE8, 0x00, 0x3B, 0xB0, 0x04, 0x4B, 0xB0, 0x04, 0x89, 0x4C,
-    0xC9, 0x8C, 0xED, 0x00, 0x4A, 0xB0, 0x04, 0x3A, 0xC0, 0x0E, 0x2C, 0x81, 0xC0, 0xDF, 0x12, 0xE0,
-    0xB8, 0xAE, 0xEC, 0x38, 0x13, 0x9D, 0xE0, 0x26, 0xE3, 0x90, 0x5A, 0x58, 0x89, 0xCA, 0x61, 0x2F,
-    0x46, 0x22, 0x4E, 0xC5, 0x3B, 0x71, 0x9F, 0xFC, 0x8D, 0x15, 0x3D, 0x60, 0x4B, 0x1F, 0xD1, 0xD3,
-    0xB3, 0x11, 0x4B, 0xFA, 0x16, 0xA2, 0x9F, 0x4F, 0xB8, 0xD2, 0x36, 0x62, 0x41, 0xDF, 0xB1, 0xA1,
-    0x43, 0x34, 0x39, 0x7B, 0xFB, 0x68, 0xB2, 0x3D, 0x50, 0xD0, 0x0D, 0x3A, 0xDA, 0x47, 0xF3, 0xE8,
-    0x6F, 0x44, 0x9F, 0xD1, 0xD1, 0x19, 0x70, 0x88, 0xB6, 0x27, 0x6A, 0xBA, 0xF5, 0x97, 0xA2, 0x73,
-    0xB1, 0xBD, 0xC4, 0xAD, 0x78, 0x2D, 0x36, 0x27, 0xBE, 0xA0, 0xFA, 0x00, 0x32, 0x49, 0xA9, 0x4C,
-    0x78, 0x9C, 0x65, 0x50, 0xD1, 0x09, 0xC2, 0x40, 0x0C, 0x8D, 0xA5, 0xBD, 0x0A, 0x62, 0x71, 0x00,
-    0xDD, 0xC1, 0x0D, 0x1C, 0x41, 0x37, 0xD0, 0x25, 0x14, 0xDC, 0xC5, 0x5F, 0x3F, 0xC5, 0x6E, 0x50,
-    0x9D, 0xC0, 0x2D, 0x04, 0x05, 0x39, 0x41, 0x6C, 0x8B, 0x58, 0x9F, 0xB9, 0xF4, 0xAC, 0x77, 0xFA,
-    0xE0, 0x72, 0x79, 0x90, 0xE4, 0x25, 0x8F, 0x88, 0x68, 0x7D, 0xD1, 0xAB, 0x90, 0x6A, 0x1C, 0xC1,
-    0xD0, 0x4A, 0xF2, 0x3D, 0x04, 0x99, 0xC9, 0x7B, 0x15, 0xF4, 0x72, 0x71, 0x06, 0xFA, 0x4C, 0x52,
-    0x20, 0xE6, 0xAF, 0xC0, 0x96, 0x63, 0x8E, 0x91, 0x29, 0x18, 0x02, 0x11, 0xD1, 0xCB, 0x04, 0xC6,
-    0x1D, 0x5D, 0x9A, 0xD5, 0x9D, 0x44, 0x3B, 0x8C, 0xE5, 0x09, 0x26, 0xDC, 0x74, 0x45, 0x62, 0xE5,
-    0xA0, 0xE9, 0x86, 0x8E, 0x25, 0x15, 0x82, 0x1C, 0x6D, 0x4B, 0x1E, 0x08, 0x0B, 0x51, 0x31, 0x28,
-    0x11, 0x95, 0x50, 0x0D, 0x51, 0xA5, 0x95, 0x31, 0x3B, 0xC4, 0x3F, 0xC4, 0x29, 0xF3, 0x06, 0x78,
-    0xA3, 0xBF, 0xA2, 0x4F, 0x04, 0xDE, 0x3A, 0xDE, 0xA2, 0xCD, 0x09, 0x29, 0xA6, 0xEE, 0x71, 0x89,
-    0x7B, 0xB6, 0x12, 0x43, 0x94, 0x58, 0x91, 0x7D, 0xAC, 0x9A, 0x9F, 0x80, 0x81, 0x63, 0xE2, 0xA1,
-    0xF5, 0x67, 0xAF, 0x18, 0xBF, 0x91, 0x91, 0x6F, 0xF1, 0xFC, 0x8A, 0x82, 0x78, 0x9C, 0xFB, 0xF1,
-    0x1F, 0x04, 0xEE, 0x57, 0x33, 0x31, 0x30, 0xFC, 0xF8, 0x0F, 0x01, 0xEB, 0x19, 0xE1, 0xCC, 0xFF,
-    0x76, 0x40, 0xA6, 0x85, 0xB1, 0xB1, 0x71, 0xE9, 0x9F, 0xFF, 0xFF, 0x99, 0x7E, 0xFC, 0x67, 0x63,
-    0x00, 0x02, 0x87, 0x7F, 0xFF, 0x79, 0xA0, 0x4C, 0x86, 0xCF, 0xFF, 0xFD, 0x61, 0xCC, 0x09, 0xFF,
-    0xE7, 0xC3, 0x98, 0x06, 0xFF, 0xEF, 0xC3, 0x98, 0x02, 0xFF, 0xDF, 0xC3, 0x98, 0x0C, 0x08, 0xA6,
-    0x02, 0x42, 0x41, 0xC1, 0xFF, 0xF5, 0x30, 0xE6, 0xC3, 0xFF, 0xF1, 0x50, 0xA6, 0xC2, 0xDF, 0xFF,
-    0x7C, 0x3F, 0xFE, 0x5B, 0x01, 0x2D, 0x4E, 0xFD, 0xFD, 0xFF, 0x3F, 0x0B, 0xDC, 0x39, 0xF9, 0x70,
-    0x97, 0x9D, 0x67, 0x86, 0x32, 0xDF, 0x77, 0x33, 0x83, 0x9C, 0x0E, 0xB5, 0x62, 0x00, 0x99, 0x00,
-    0x03, 0x74, 0x80, 0x0B, 0x78, 0x9C, 0x5D, 0x50, 0x4B, 0x0A, 0xC2, 0x30, 0x10, 0x1D, 0xDB, 0x14,
-    0xA4, 0x75, 0xE1, 0x5E, 0xC4, 0xDE, 0xC0, 0xDE, 0x44, 0x8F, 0xE0, 0xD2, 0xA5, 0x1B, 0x05, 0x57,
-    0x7A, 0x00, 0x41, 0x6F, 0xE0, 0x4A, 0xB7, 0x1E, 0x41, 0xBC, 0x81, 0x78, 0x81, 0x7A, 0x81, 0x12,
-    0x41, 0x91, 0x7E, 0xB4, 0xCF, 0x34, 0x49, 0xDB, 0xD4, 0x07, 0x49, 0xE6, 0x31, 0x93, 0x37, 0x33,
-    0x8F, 0x88, 0xBA, 0x87, 0x88, 0x6F, 0x6C, 0x52, 0x88, 0x21, 0x10, 0x32, 0x19, 0xDF, 0x20, 0xB1,
-    0x2F, 0xE2, 0x20, 0x47, 0xB8, 0x5C, 0xA4, 0x80, 0x2B, 0xC8, 0x15, 0xDC, 0x11, 0x4F, 0x82, 0x95,
-    0xBC, 0xFB, 0x45, 0xC1, 0x04, 0xB0, 0xC9, 0x07, 0x2C, 0x2D, 0xE3, 0xD2, 0x0E, 0x5B, 0xA5, 0x79,
-    0xC7, 0x40, 0x1E, 0x89, 0xB5, 0xF8, 0xF4, 0x44, 0x47, 0x91, 0x00, 0x67, 0x7A, 0xA3, 0xAD, 0x7B,
-    0x83, 0x0B, 0x31, 0x47, 0x93, 0x0F, 0x5A, 0x29, 0x98, 0x26, 0x19, 0xAC, 0x0C, 0xE5, 0x88, 0x29,
-    0xEC, 0x4C, 0xB7, 0x29, 0x08, 0xFB, 0x23, 0x46, 0x59, 0x43, 0xA0, 0x21, 0x6D, 0x34, 0x45, 0x73,
-    0x9C, 0x87, 0x39, 0xA8, 0xB1, 0xC2, 0xD0, 0x5C, 0xCE, 0xAB, 0xD6, 0x1E, 0x17, 0x6B, 0x97, 0x86,
-    0xC4, 0xB2, 0xDC, 0x17, 0x56, 0x4D, 0xE7, 0xC2, 0x2A, 0xCF, 0x30, 0xF1, 0x64, 0xD8, 0xAB, 0x1C,
-    0x15, 0xC6, 0x1F, 0x23, 0xFE, 0x05, 0x7A, 0x54, 0x21, 0x41, 0x68, 0x55, 0x64, 0x06, 0x8C, 0xEA,
-    0xD4, 0x0B, 0xA8, 0x53, 0x41, 0x6E, 0x64, 0xE8, 0xC2, 0xE8, 0x07, 0x55, 0x83, 0x98, 0x35, 0x78,
-    0x9C, 0x4D, 0xCF, 0xBD, 0x0D, 0xC2, 0x30, 0x14, 0x04, 0x60, 0x87, 0x9F, 0x04, 0xF1, 0x37, 0x03,
-    0x1D, 0x05, 0x05, 0x48, 0x6E, 0x10, 0x0D, 0x8C, 0x80, 0x04, 0x3D, 0xA3, 0xC0, 0x06, 0x8C, 0x10,
-    0x16, 0xA1, 0xA6, 0x0C, 0x1B, 0xD0, 0xD0, 0x23, 0x88, 0x8C, 0x02, 0x42, 0x1C, 0x7E, 0x58, 0x3E,
-    0xFB, 0x15, 0xD6, 0x57, 0x3C, 0xDB, 0x77, 0x15, 0x64, 0x8E, 0x43, 0x65, 0xA7, 0x82, 0x9B, 0x51,
-    0x64, 0x34, 0xC4, 0x53, 0xAD, 0xD7, 0x27, 0x60, 0x2C, 0x4E, 0x65, 0xF5, 0x8A, 0x82, 0x9E, 0x00,
-    0x75, 0x6F, 0xF5, 0x46, 0x8B, 0x36, 0xE8, 0xD0, 0x25, 0xBA, 0xF4, 0x23, 0xB2, 0x41, 0x3B, 0xBA,
-    0x9B, 0x79, 0x2F, 0x80, 0xC4, 0xDB, 0x20, 0x97, 0xBF, 0x66, 0x5A, 0xAF, 0x6C, 0x86, 0x5E, 0xC8,
-    0x56, 0x24, 0xC1, 0x59, 0xC8, 0xBC, 0x71, 0x5D, 0x52, 0x79, 0xE5, 0x42, 0xAB, 0xCF, 0xFF, 0x74,
-    0x2E, 0xD1, 0xA7, 0x0F, 0xD8, 0xD3, 0x03, 0xA0, 0xC6, 0x5E, 0x2F, 0x1B, 0xCD, 0xFB, 0x8E, 0x39,
-    0xBD, 0x8B, 0xBA, 0xAB, 0x2F, 0x9A, 0xF4, 0xD3, 0x86, 0xF3, 0x3E, 0x63, 0x4B, 0x2F, 0x71, 0x53,
-    0x3F, 0x67, 0x2C, 0x96, 0x73, 0x78, 0x9C, 0x55, 0x90, 0xBB, 0x6E, 0xC2, 0x30, 0x14, 0x86, 0x0F,
-    0xB9, 0x80, 0xC4, 0x4D, 0x99, 0x98, 0x79, 0x03, 0xB2, 0x30, 0x22, 0xB1, 0x74, 0xAD, 0x32, 0xB0,
-    0x97, 0xA1, 0x3B, 0xEC, 0x44, 0x22, 0x6F, 0x00, 0x03, 0x23, 0x12, 0x8F, 0x90, 0x57, 0x60, 0x65,
-    0xF2, 0xDA, 0x4E, 0xAD, 0xD4, 0xA9, 0x93, 0x25, 0x44, 0x85, 0x48, 0x1A, 0xFF, 0x1C, 0xDB, 0x38,
-    0x12, 0x67, 0xFA, 0x7E, 0xDB, 0xC7, 0xE7, 0xD3, 0x21, 0xA2, 0xE4, 0x53, 0xC9, 0x95, 0x47, 0xBA,
-    0xE6, 0x0A, 0x5C, 0x79, 0x43, 0xF3, 0x3F, 0x4C, 0xBD, 0x32, 0x1E, 0x81, 0xF4, 0xE5, 0xBD, 0x00,
-    0x7C, 0xA2, 0x2B, 0xDE, 0xF8, 0x24, 0x2A, 0xD1, 0x27, 0x52, 0x08, 0xC8, 0x5C, 0xAF, 0x29, 0xC6,
-    0x97, 0xF9, 0x21, 0x86, 0xA4, 0x04, 0x07, 0xC3, 0x54, 0xC1, 0x4B, 0x90, 0x5B, 0x2E, 0xE1, 0xEB,
-    0xBB, 0xBA, 0x14, 0xDA, 0x35, 0xFF, 0x41, 0xF8, 0x8E, 0xB7, 0x80, 0x18, 0xB8, 0x70, 0x65, 0x81,
-    0xD4, 0xAA, 0xD1, 0xB0, 0xE4, 0x20, 0x9A, 0x36, 0xC4, 0xBF, 0x1C, 0x64, 0xF8, 0x78, 0xB6, 0x63,
-    0xED, 0xDC, 0xF5, 0xC4, 0x37, 0xA0, 0xE3, 0x42, 0x74, 0xC3, 0xA2, 0x1E, 0x93, 0x3D, 0xCF, 0xF7,
-    0x2E, 0x4E, 0xA1, 0x40, 0x70, 0x46, 0xD7, 0x71, 0xF8, 0x8D, 0x91, 0xF3, 0xF7, 0x33, 0x08, 0x83,
-    0x09, 0xF7, 0x46, 0x15, 0x26, 0x56, 0x77, 0x43, 0xF4, 0xC3, 0x66, 0xE3, 0xD9, 0x07, 0xD0, 0x63,
-    0xB5, 0xCA, 0xEE, 0x4A, 0xE8, 0xC5, 0x2D, 0xCD, 0x0E, 0x65, 0xCB, 0xB4, 0x4D, 0x4F, 0x4A, 0xEE,
-    0xB5, 0xE6, 0x1D, 0xBC, 0x35, 0x81, 0x9C, 0x78, 0x9C, 0xFB, 0xFF, 0x1F, 0x0E, 0xE4, 0xFF, 0xE3,
-    0x60, 0x1B, 0x03, 0xC1, 0xE2, 0xFF, 0xFB, 0x41, 0x14, 0x33, 0x03, 0x10, 0x24, 0xFC, 0xEF, 0x67,
-    0x80, 0x81, 0x51, 0x36, 0x71, 0x6C, 0x00, 0x42, 0x5A, 0x57, 0x65, 0x78, 0x9C, 0xFB, 0xF4, 0x9F,
-    0x87, 0x01, 0x0C, 0xBE, 0xFF, 0x67, 0xFF, 0x34, 0x02, 0xD8, 0x1F, 0xFF, 0xF3, 0x42, 0xD8, 0x3F,
-    0xFE, 0xB3, 0x7F, 0xF8, 0xCF, 0x07, 0x61, 0xFF, 0xFC, 0xCF, 0xF6, 0xE0, 0xBF, 0x3E, 0x84, 0xFD,
-    0xF7, 0x3F, 0xF3, 0x82, 0xFF, 0xFD, 0x60, 0xA6, 0xC1, 0xFF, 0xF7, 0x0C, 0x0E, 0xFF, 0xFF, 0x33,
-    0x83, 0xD8, 0x17, 0xFE, 0xCF, 0x67, 0x60, 0xF8, 0xFD, 0x3F, 0x0E, 0xC8, 0x54, 0xF8, 0xF3, 0x5F,
-    0x8E, 0x81, 0xE1, 0xE1, 0xFF, 0xFF, 0x35, 0xA6, 0x29, 0xBF, 0xFF, 0xFF, 0x67, 0x01, 0x8A, 0xFC,
-    0xFD, 0x0F, 0x06, 0x7E, 0x20, 0x95, 0x0D, 0x60, 0xE6, 0x7A, 0x46, 0xB0, 0x11, 0x09, 0xB7, 0xFE,
-    0xDF, 0xAF, 0x06, 0x31, 0x01, 0xD8, 0xD5, 0x81, 0x2D, 0x78, 0x9C, 0x3D, 0x90, 0x69, 0x15, 0xC2,
-    0x40, 0x0C, 0x84, 0xC3, 0x7D, 0x1F, 0x0E, 0xC0, 0x01, 0x28, 0x00, 0x1C, 0x80, 0x03, 0x70, 0x40,
-    0x1D, 0x80, 0x03, 0x70, 0x00, 0x0E, 0xC0, 0x01, 0x38, 0x00, 0x07, 0xAD, 0x83, 0x96, 0x72, 0xF5,
-    0x71, 0x0D, 0xD9, 0xEC, 0xA6, 0xF9, 0x91, 0xBC, 0xAF, 0x2F, 0x99, 0x9D, 0xCE, 0x15, 0x1D, 0xB2,
-    0x35, 0x02, 0xE8, 0x8C, 0xB9, 0xA3, 0x35, 0x76, 0xE4, 0xE1, 0xE0, 0x28, 0xC0, 0x98, 0xBA, 0x40,
-    0xC6, 0xD2, 0x0D, 0x4D, 0xA2, 0x0F, 0x8A, 0x96, 0x5E, 0x28, 0x13, 0x3D, 0x50, 0xB7, 0x04, 0x64,
-    0x89, 0x22, 0x27, 0x3A, 0xC1, 0x89, 0xFB, 0x16, 0x0B, 0xA1, 0xBD, 0x88, 0x8F, 0xE4, 0x5B, 0xBA,
-    0xF3, 0x33, 0xFB, 0xE6, 0xBE, 0x66, 0x46, 0x82, 0x92, 0x19, 0x6F, 0x14, 0xCC, 0x88, 0xD1, 0xE0,
-    0xDE, 0x46, 0x28, 0x07, 0x67, 0xF4, 0xB8, 0xCF, 0xB0, 0x11, 0xF2, 0x44, 0xF4, 0x88, 0xA1, 0x50,
-    0x1B, 0x3E, 0xF7, 0x8B, 0xEC, 0xCB, 0x3D, 0x8B, 0x3E, 0xAD, 0x16, 0xD1, 0xDD, 0x18, 0xFC, 0xA8,
-    0xF9, 0x88, 0x97, 0xBA, 0xE9, 0x8F, 0xAD, 0x59, 0xC0, 0xC3, 0xD4, 0x51, 0x1F, 0x2B, 0x7E, 0xA6,
-    0xE5, 0x88, 0xBE, 0x21, 0x5B, 0xA8, 0x2A, 0x25, 0xC8, 0x25, 0xC8, 0x2B, 0xC5, 0xA8, 0x7C, 0x43,
-    0x05, 0xF6, 0x31, 0xE0, 0x53, 0xAD, 0x19, 0x7C, 0xF1, 0x4A, 0xCE, 0x1B, 0x34, 0x1C, 0x1B, 0x97,
-    0x06, 0x67, 0xA3, 0x54, 0x5F, 0xA6, 0x82, 0xD4, 0x97, 0xA9, 0xA5, 0xFA, 0xFA, 0x03, 0x90, 0x59,
-    0x70, 0xDC, 0x78, 0x9C, 0x3D, 0x52, 0xDB, 0x41, 0x83, 0x40, 0x10, 0xBC, 0xBC, 0x4C, 0x4C, 0x34,
-    0xD8, 0x01, 0x76, 0x60, 0x09, 0x67, 0x07, 0xD2, 0x41, 0xE8, 0x40, 0x3B, 0x20, 0x1D, 0x24, 0x1D,
-    0x40, 0x07, 0xA1, 0x03, 0xED, 0x80, 0x12, 0xB0, 0x03, 0x50, 0x90, 0x00, 0x79, 0x8C, 0x3B, 0xB7,
-    0x49, 0xF8, 0x60, 0x97, 0xDD, 0xB9, 0x99, 0xBD, 0x59, 0x7A, 0x8C, 0x0D, 0x1F, 0x7C, 0xBA, 0x90,
-    0xC2, 0x36, 0x98, 0x31, 0x7B, 0x06, 0x5C, 0xE5, 0x1B, 0xDE, 0x2F, 0x1E, 0x98, 0x7D, 0x00, 0x23,
-    0x46, 0xF9, 0x94, 0xA2, 0xA2, 0x15, 0x2B, 0x47, 0x12, 0x58, 0x66, 0x25, 0x14, 0xDB, 0x61, 0x1C,
-    0x22, 0x62, 0x56, 0x03, 0x3E, 0xE3, 0x09, 0x42, 0xB9, 0x73, 0xBD, 0xEC, 0xBC, 0x92, 0xF0, 0x84,
-    0xCC, 0x98, 0x73, 0xE1, 0x7A, 0xF1, 0x21, 0x96, 0xF0, 0x8A, 0x8D, 0x31, 0x07, 0x0C, 0x29, 0xBE,
-    0xDA, 0xB3, 0xB3, 0x86, 0x20, 0xF7, 0x98, 0x50, 0xDC, 0xAF, 0xD8, 0x49, 0xC9, 0x56, 0xE1, 0x9E,
-    0x99, 0x8C, 0x71, 0x47, 0xC9, 0xC7, 0xDB, 0x6B, 0x9A, 0x60, 0x71, 0x6B, 0xFB, 0x14, 0x1F, 0x06,
-    0x1C, 0xB5, 0x51, 0x8A, 0x37, 0x11, 0x2F, 0x44, 0x58, 0x62, 0x8F, 0xC1, 0x45, 0xF0, 0x24, 0xD2,
-    0x47, 0xC6, 0xDC, 0xF9, 0x90, 0x89, 0xB8, 0xF4, 0xDB, 0x5C, 0x70, 0x6E, 0xDC, 0x23, 0x4C, 0x48,
-    0x8E, 0x0A, 0x83, 0x00, 0xEF, 0xAC, 0xB4, 0x18, 0xA5, 0xD4, 0x29, 0x31, 0x59, 0xE3, 0x45, 0x2F,
-    0x39, 0x2D, 0x39, 0x4B, 0x82, 0xF9, 0x17, 0x96, 0x6A, 0xC4, 0xBC, 0xE6, 0xBC, 0x21, 0x96, 0x92,
-    0xB2, 0x22, 0x8D, 0x36, 0x77, 0xF7, 0xB6, 0x15, 0xB1, 0xC6, 0x6C, 0xE1, 0x51, 0x58, 0xA4, 0xA3,
-    0x86, 0x58, 0x63, 0x02, 0x58, 0x8A, 0xCB, 0x98, 0xBB, 0xD6, 0x39, 0x23, 0xE8, 0x58, 0xBD, 0xAE,
-    0x8B, 0x5E, 0x57, 0x24, 0x4E, 0x2A, 0xA1, 0x78, 0x1D, 0x69, 0xA5, 0x83, 0x12, 0xCA, 0x3E, 0xAC,
-    0x56, 0xFE, 0xC0, 0xFB, 0xB9, 0x9D, 0x79, 0x5A, 0xF9, 0xA1, 0xDD, 0xBA, 0xD7, 0x85, 0xB9, 0x6C,
-    0x76, 0x73, 0x25, 0x9C, 0x69, 0x92, 0x5C, 0x8F, 0x77, 0xEE, 0xAF, 0xF8, 0x07, 0x40, 0xC0, 0xC4,
-    0x25, 0x78, 0x9C, 0x3D, 0x90, 0xEB, 0x51, 0x82, 0x41, 0x0C, 0x45, 0x2F, 0x7C, 0x80, 0x30, 0x3C,
-    0x86, 0x0A, 0xD4, 0x0E, 0xA0, 0x03, 0xE9, 0x80, 0x12, 0xB0, 0x03, 0x2C, 0x81, 0x0E, 0xB0, 0x03,
-    0xE8, 0x40, 0x3A, 0xC0, 0x0E, 0xB4, 0x03, 0xA0, 0x02, 0x66, 0x04, 0x1F, 0x08, 0x78, 0x4C, 0xF6,
-    0xF1, 0xED, 0x8F, 0x4C, 0xCE, 0x6E, 0xF6, 0x26, 0xB9, 0x47, 0x26, 0x0A, 0x67, 0xCB, 0x8B, 0x96,
-    0xEC, 0x23, 0xFC, 0x70, 0xA7, 0xFE, 0x1F, 0x2D, 0xCF, 0x87, 0xD0, 0x90, 0x3E, 0x79, 0x70, 0x78,
-    0xE5, 0xCD, 0xE2, 0x8A, 0x8D, 0xC3, 0x17, 0x03, 0x8B, 0xF7, 0x70, 0x23, 0xF5, 0xA1, 0xE9, 0x77,
-    0xDF, 0xF6, 0xD3, 0x74, 0xC2, 0xBB, 0x55, 0xAF, 0xA5, 0x63, 0xFC, 0xE9, 0x3A, 0x75, 0x25, 0x4D,
-    0xEF, 0xD0, 0x9B, 0xB1, 0xAF, 0xE4, 0xDE, 0x8B, 0x43, 0x9E, 0x43, 0x23, 0xB8, 0xD2, 0x4E, 0xA0,
-    0x5F, 0xA0, 0x92, 0x61, 0x07, 0xD3, 0x9C, 0xEB, 0x11, 0x3A, 0x25, 0x3C, 0xC3, 0x6D, 0x09, 0x07,
-    0x58, 0x94, 0x70, 0x35, 0x81, 0x22, 0xE5, 0x4F, 0x70, 0xA6, 0x9B, 0xE0, 0x83, 0xE9, 0x8E, 0x79,
-    0x82, 0x0B, 0x1D, 0xD3, 0xAB, 0x66, 0xE1, 0xC2, 0x2F, 0x52, 0xCB, 0x79, 0x28, 0x4D, 0xC3, 0xF4,
-    0xA4, 0x59, 0x1C, 0xC8, 0xC6, 0xAC, 0x05, 0xF9, 0x76, 0x32, 0x4F, 0xBE, 0xAA, 0x2F, 0x71, 0x72,
-    0x0B, 0xDC, 0x04, 0x5B, 0x2F, 0x9A, 0xA7, 0x68, 0xE6, 0x7B, 0x30, 0x2F, 0x18, 0x37, 0x36, 0xA3,
-    0x06, 0x11, 0xDC, 0xCC, 0x7F, 0x01, 0x1E, 0x81, 0x80, 0x78, 0x9C, 0xCD, 0x8E, 0xE1, 0x11, 0xC1,
-    0x40, 0x10, 0x85, 0x5F, 0x64, 0x18, 0xC1, 0x98, 0x74, 0x40, 0x07, 0x4A, 0xA0, 0x83, 0x28, 0x41,
-    0x09, 0x3A, 0xA0, 0x04, 0x1D, 0x48, 0x07, 0x4A, 0x50, 0x42, 0xD2, 0x01, 0x1D, 0x18, 0x93, 0x99,
-    0x90, 0x61, 0x7C, 0xEE, 0x6E, 0x13, 0x35, 0x78, 0x3F, 0x76, 0xF6, 0xBB, 0xDD, 0xB7, 0xF7, 0x6A,
-    0x66, 0x32, 0x7D, 0x48, 0x4A, 0x8E, 0xD6, 0x6F, 0x20, 0x5A, 0x43, 0x2F, 0xC0, 0x95, 0x9D, 0xF4,
-    0x66, 0x14, 0xE0, 0xC1, 0x54, 0xAA, 0x58, 0xB4, 0x96, 0x81, 0x94, 0x73, 0xF2, 0xFD, 0x96, 0x8B,
-    0xAB, 0x73, 0x88, 0x83, 0x25, 0xF3, 0x6F, 0x0D, 0x63, 0x57, 0x9F, 0x4C, 0x3C, 0xDC, 0x59, 0x4A,
-    0xA9, 0xCD, 0xDD, 0xF6, 0x59, 0xDA, 0x9B, 0xD3, 0xDF, 0x89, 0xDD, 0xD8, 0x6E, 0xAA, 0x76, 0xEB,
-    0x0D, 0x43, 0x83, 0x92, 0x2C, 0xE5, 0x16, 0x19, 0xAC, 0x28, 0x0E, 0x3E, 0x8B, 0xE9, 0x45, 0xC8,
-    0x62, 0xAA, 0x80, 0x7E, 0x07, 0x39, 0x14, 0x5D, 0xEF, 0x13, 0x65, 0x3F, 0x68, 0x13, 0xA9, 0xFB,
-    0x29, 0xF9, 0x13, 0xF8, 0x02, 0xA3, 0x09, 0x61, 0x63, 0x78, 0x9C, 0xFB, 0xF0, 0x1F, 0x06, 0xEE,
-    0x33, 0x7C, 0xC0, 0xC1, 0x36, 0x30, 0x86, 0x80, 0xAF, 0xFF, 0xF3, 0x19, 0x60, 0xE0, 0xF7, 0x7F,
-    0x6E, 0x18, 0x33, 0xE1, 0xFF, 0x7B, 0x46, 0x18, 0xFB, 0xD3, 0xFF, 0x78, 0xB8, 0x92, 0x3F, 0xFF,
-    0xB9, 0x60, 0xCC, 0x02, 0x14, 0x25, 0xFE, 0x48, 0x4A, 0x38, 0x61, 0xCC, 0x06, 0xA0, 0x45, 0x30,
-    0xF0, 0xF9, 0xBF, 0x3D, 0x9C, 0xFD, 0xF7, 0x3F, 0x07, 0x8C, 0x39, 0x01, 0x49, 0xC9, 0x17, 0x84,
-    0x12, 0x81, 0x7F, 0xFF, 0xD9, 0x61, 0xEC, 0x05, 0xFF, 0xCF, 0xC3, 0x95, 0x7C, 0xFD, 0xAF, 0x8F,
-    0xA4, 0x84, 0x0D, 0xC6, 0xDE, 0xF0, 0x7F, 0x3F, 0x5C, 0xC9, 0xB7, 0xFF, 0xF2, 0x30, 0xA6, 0xC2,
-    0xFF, 0xFF, 0xAC, 0x30, 0xF6, 0x81, 0xFF, 0xEB, 0xE1, 0x4A, 0xBE, 0xFF, 0x97, 0x43, 0x52, 0xC2,
-    0x02, 0x63, 0x5F, 0xF8, 0x7F, 0x1F, 0x1A, 0x2A, 0xC6, 0x8C, 0x9F, 0xE1, 0x61, 0xF5, 0x9F, 0x03,
-    0x17, 0x1B, 0x00, 0xBD, 0x63, 0x79, 0xE5, 0x78, 0x9C, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x30,
-    0x7C, 0x5F, 0x50, 0xF0, 0xFF, 0x7D, 0x06, 0x86, 0x81, 0xC5, 0x4A, 0x42, 0xFF, 0x91, 0xDC, 0x04,
-    0x00, 0x5E, 0x5C, 0x56, 0x3B, 0x78, 0x9C, 0x3D, 0xCF, 0xD9, 0x11, 0x01, 0x01, 0x10, 0x45, 0xD1,
-    0xB1, 0xEF, 0x4B, 0x06, 0x64, 0x30, 0x32, 0x20, 0x03, 0x32, 0x20, 0x03, 0x21, 0x90, 0x01, 0x19,
-    0x90, 0x01, 0x19, 0x90, 0x01, 0x19, 0xCC, 0x64, 0xA0, 0x98, 0x29, 0x5B, 0xE1, 0xAA, 0xF2, 0xBA,
-    0xF5, 0xD7, 0xF9, 0x78, 0x1F, 0xB7, 0x63, 0xAA, 0xC1, 0xEF, 0x96, 0xB4, 0x84, 0x1E, 0x53, 0x21,
-    0x78, 0x1F, 0x0C, 0x37, 0xB2, 0xC2, 0x99, 0xB2, 0xB0, 0xA5, 0x29, 0x8C, 0x18, 0xDA, 0xE8, 0xB3,
-    0x31, 0x3C, 0xC8, 0x08, 0x09, 0x45, 0xE1, 0x48, 0x5D, 0x98, 0x10, 0x0A, 0x6D, 0x16, 0xB6, 0x7E,
-    0x9E, 0x0C, 0x29, 0x79, 0x21, 0xF6, 0xA4, 0x39, 0x1D, 0xA1, 0xCB, 0xCC, 0x46, 0xAF, 0xC8, 0x70,
-    0x25, 0xE7, 0x49, 0x15, 0x61, 0xED, 0x49, 0x03, 0xC6, 0x9E, 0xB4, 0x33, 0xDC, 0x3D, 0xE9, 0x42,
-    0x49, 0xD8, 0xD3, 0xF0, 0xA4, 0xBE, 0x8D, 0x58, 0x79, 0x12, 0xFF, 0xA4, 0x82, 0x3F, 0x50, 0xFB,
-    0x02, 0x89, 0x81, 0x3B, 0x7E, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0xFF, 0xFF, 0x3F, 0x50, 0x2C, 0x28,
-    0xF8, 0xF7, 0x3F, 0x03, 0xC3, 0xC0, 0x62, 0x45, 0xA5, 0x7F, 0x70, 0xF7, 0x80, 0x30, 0x00, 0x8C,
-    0x49, 0x5B, 0xB5, 0x78, 0x9C, 0x1D, 0xCC, 0x4B, 0x0D, 0xC2, 0x60, 0x14, 0x05, 0xE1, 0xA1, 0x0B,
-    0x1E, 0x09, 0xB4, 0x48, 0xC0, 0x01, 0x38, 0x00, 0x07, 0x48, 0xC0, 0x4A, 0x25, 0xD4, 0x01, 0x75,
-    0x50, 0x09, 0x48, 0xA8, 0x85, 0x4A, 0x68, 0x13, 0xA0, 0x09, 0x8F, 0x0E, 0xFF, 0xE5, 0x6C, 0xBE,
-    0xCD, 0xE4, 0x00, 0xD3, 0x99, 0xD8, 0xCE, 0xE6, 0x6F, 0xA5, 0xB3, 0xB0, 0xD7, 0x45, 0xF8, 0xD4,
-    0x3C, 0xFC, 0x34, 0x46, 0x78, 0x70, 0xFF, 0xBA, 0x25, 0x6B, 0xD7, 0x77, 0x33, 0x18, 0x9C, 0x77,
-    0x2E, 0x61, 0x94, 0x32, 0xC2, 0xEF, 0x95, 0xAD, 0x17, 0x4E, 0x1E, 0xE1, 0xDD, 0xA6, 0x6C, 0x03,
-    0x0F, 0xB3, 0x94, 0x41, 0xE7, 0x6A, 0x8C, 0xF3, 0xD2, 0xE2, 0x07, 0xCE, 0x90, 0x2E, 0x09, 0x78,
-    0x9C, 0xFB, 0xF7, 0x1F, 0x0A, 0xF8, 0xFE, 0x61, 0x61, 0x29, 0x2A, 0x41, 0x01, 0x23, 0x00, 0xC5,
-    0xC3, 0x1C, 0x3F, 0x78, 0x9C, 0xFB, 0xF6, 0x5F, 0x9F, 0x81, 0xA1, 0xE1, 0xFF, 0x7E, 0x06, 0x06,
-    0x86, 0x5F, 0xFF, 0xD9, 0x18, 0x18, 0x36, 0xFC, 0x97, 0x07, 0x32, 0xFF, 0x82, 0xF8, 0x0F, 0xFF,
-    0xB3, 0x01, 0x00, 0xC3, 0x3B, 0x0B, 0xD2, 0x78, 0x9C, 0x55, 0xCE, 0x31, 0x0E, 0x01, 0x41, 0x18,
-    0x05, 0xE0, 0xDF, 0xDA, 0x44, 0x04, 0xC9, 0x38, 0x80, 0x5E, 0xA1, 0xD8, 0x23, 0x68, 0x75, 0xD4,
-    0x0A, 0x89, 0x44, 0xE1, 0x14, 0x9C, 0x41, 0xA7, 0xA2, 0xDE, 0x03, 0x28, 0x24, 0x62, 0x5B, 0xD5,
-    0xD4, 0x1A, 0x13, 0x85, 0x5A, 0x48, 0x36, 0x62, 0x64, 0xE7, 0x79, 0xB3, 0xA6, 0xF1, 0xAA, 0x2F,
-    0x33, 0xFF, 0xBC, 0x7F, 0x44, 0xFA, 0x67, 0x77, 0x19, 0x08, 0x93, 0x14, 0x60, 0x7A, 0x54, 0xEE,
-    0x81, 0x7B, 0x24, 0x09, 0x30, 0x6E, 0x4F, 0x1D, 0x5A, 0x92, 0x61, 0xC1, 0x8B, 0x2B, 0x26, 0xF2,
-    0x44, 0x93, 0x1A, 0x62, 0x23, 0xAB, 0x75, 0x4C, 0x29, 0x1C, 0x25, 0x04, 0xFA, 0x4F, 0xA3, 0x93,
-    0x63, 0x0D, 0xB5, 0x2C, 0xFB, 0x28, 0xC5, 0x15, 0x87, 0x74, 0x4F, 0x65, 0xD0, 0xF1, 0x6F, 0x2E,
-    0x47, 0x23, 0xBC, 0x78, 0xA3, 0x1A, 0xF4, 0x41, 0xA5, 0x6C, 0xD6, 0x62, 0xE1, 0xC7, 0xB6, 0xD4,
-    0x0B, 0x1D, 0x1E, 0x59, 0xEA, 0x01, 0xCC, 0x67, 0x16, 0x30, 0xFC, 0x85, 0x8F, 0x01, 0x44, 0x6E,
-    0x5E, 0xF5, 0x02, 0x91, 0xA8, 0x9D, 0x33, 0x5D, 0x96, 0xD5, 0xBE, 0xA9, 0xF9, 0x6C, 0x36, 0x78,
-    0x9C, 0xFB, 0xF4, 0x9F, 0x9B, 0x01, 0x02, 0x3E, 0xD1, 0x92, 0x15, 0x70, 0xEB, 0xFF, 0x5C, 0x16,
-    0x10, 0x4B, 0xFB, 0xCF, 0xFF, 0xFF, 0xFF, 0xF7, 0x33, 0x02, 0x59, 0x6F, 0xFF, 0x83, 0x80, 0x2C,
-    0x90, 0xF5, 0x7F, 0xBF, 0x59, 0xF0, 0xEF, 0xFF, 0xFB, 0x41, 0x2C, 0xA0, 0x9A, 0x80, 0xFF, 0xFF,
-    0x59, 0x3F, 0xFD, 0xF7, 0x07, 0x69, 0xFC, 0xFE, 0x9F, 0xE7, 0xD3, 0x7F, 0x7E, 0x10, 0xEB, 0xC1,
-    0x7F, 0x79, 0x28, 0x6B, 0xC2, 0xFF, 0x78, 0xA8, 0xC9, 0x01, 0xFF, 0xFB, 0xA1, 0x2C, 0x83, 0xFF,
-    0xF3, 0xA1, 0x2C, 0x85, 0xFF, 0xEB, 0x31, 0x58, 0x08, 0x59, 0xB0, 0x0E, 0xA8, 0x29, 0xFE, 0xC8,
-    0x26, 0xE7, 0x43, 0x6C, 0xE3, 0x06, 0xBA, 0x80, 0x0D, 0xEC, 0x02, 0x16, 0x20, 0xEB, 0xBC, 0x5B,
-    0x0A, 0xC4, 0x55, 0xAF, 0xE1, 0x2E, 0x55, 0x07, 0xB9, 0x7E, 0x3D, 0xC8, 0xF5, 0x6C, 0x40, 0x1F,
-    0xAD, 0x05, 0xBA, 0x16, 0x00, 0x71, 0x90, 0x82, 0xD9, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x28, 0x7A,
-    0xF3, 0x7F, 0x2D, 0x0B, 0x03, 0x10, 0x4C, 0xFC, 0x0F, 0x04, 0xE7, 0x99, 0x18, 0x18, 0x04, 0xFE,
-    0x82, 0x58, 0xFF, 0xED, 0x19, 0x18, 0x2E, 0xFC, 0x7F, 0x6F, 0x61, 0x74, 0xED, 0xFF, 0x7B, 0x46,
-    0x86, 0x1F, 0xFF, 0x65, 0x80, 0x4A, 0x7E, 0xFD, 0xE7, 0x16, 0x00, 0xF1, 0x40, 0x32, 0xFA, 0x05,
-    0xFF, 0xEB, 0x41, 0xDA, 0x02, 0xFE, 0xE7, 0x6F, 0xF8, 0xAF, 0x0F, 0x62, 0x09, 0xFC, 0xEF, 0x7F,
-    0xF0, 0x9F, 0x8F, 0x01, 0x02, 0x3E, 0xFC, 0xE7, 0x81, 0xB2, 0x3E, 0xFE, 0xE7, 0xC6, 0x60, 0x21,
-    0x64, 0x11, 0x3A, 0x36, 0xFC, 0x97, 0x87, 0xB2, 0xA0, 0x26, 0x03, 0xCD, 0x83, 0xDA, 0xD6, 0xF0,
-    0xDF, 0x1F, 0xEA, 0x82, 0x6F, 0xFF, 0x79, 0xC1, 0xAE, 0x52, 0x3A, 0xFA, 0xFF, 0x3F, 0x33, 0xCC,
-    0xA5, 0xFE, 0xC8, 0xAE, 0x67, 0x60, 0x68, 0x7A, 0xF3, 0x7E, 0x2E, 0x33, 0x03, 0x03, 0x00, 0xAC,
-    0xDF, 0x51, 0x6F, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x03, 0x85, 0xFF, 0xFB, 0x19, 0x68, 0xC9, 0xDA,
-    0xFA, 0xF7, 0x9E, 0x25, 0x98, 0x75, 0xF9, 0x3F, 0x10, 0x68, 0x01, 0x59, 0x06, 0x20, 0xC6, 0xFF,
-    0xF7, 0x40, 0xD6, 0xC3, 0xFF, 0xFF, 0x23, 0x9D, 0xAF, 0xFF, 0x07, 0xB2, 0x7E, 0xFE, 0xD7, 0x03,
-    0xAA, 0xFD, 0xF1, 0x7F, 0xBF, 0xC0, 0xFF, 0xFF, 0x4C, 0x40, 0xD6, 0x86, 0xFF, 0xFB, 0x13, 0xFE,
-    0xCF, 0x87, 0x9A, 0xB2, 0xE0, 0xBF, 0x3D, 0x94, 0x75, 0xE1, 0x3F, 0x3F, 0x94, 0xF5, 0xE1, 0x3F,
-    0x2F, 0x9C, 0xC5, 0x83, 0x85, 0xC5, 0x8B, 0xA1, 0x03, 0x61, 0x0A, 0xD4, 0x64, 0x03, 0xA0, 0xBD,
-    0x10, 0xDB, 0x0E, 0x00, 0x59, 0x3F, 0xFE, 0xEB, 0x02, 0x59, 0x3F, 0x81, 0xAC, 0x07, 0x40, 0x57,
-    0x05, 0x83, 0x5D, 0xA5, 0xF0, 0x0F, 0xE4, 0xD2, 0xF3, 0x20, 0xD7, 0x1F, 0x02, 0xB1, 0xB8, 0xFE,
-    0x81, 0x7C, 0xB4, 0xF4, 0xDF, 0x3D, 0x4B, 0x86, 0xBF, 0xFB, 0x01, 0x6F, 0x1C, 0x7F, 0x83, 0x78,
-    0x9C, 0x63, 0x60, 0x60, 0x48, 0x7C, 0xFD, 0x7E, 0x2E, 0x0B, 0x03, 0x10, 0x14, 0xFC, 0xFB, 0xFF,
-    0xFF, 0xFF, 0x79, 0x26, 0x20, 0xEB, 0xD7, 0x7F, 0x10, 0xD0, 0x63, 0x60, 0x98, 0xF0, 0xFF, 0xBF,
-    0x85, 0xD1, 0xB5, 0xFF, 0xF7, 0x19, 0x18, 0xBE, 0xFE, 0xD7, 0x05, 0x4A, 0xFC, 0xFE, 0xCF, 0xC1,
-    0xF0, 0xF7, 0x3F, 0x48, 0xC9, 0x83, 0xFF, 0x7C, 0x01, 0xFF, 0xE7, 0x83, 0xB4, 0x35, 0xFC, 0xB7,
-    0x5F, 0xF0, 0xDF, 0x1E, 0xC4, 0x32, 0xF8, 0x5F, 0xFF, 0xE0, 0xBF, 0xBC, 0x20, 0x10, 0x28, 0xFE,
-    0x9F, 0xFF, 0xE1, 0x3F, 0x14, 0xAC, 0x87, 0xB3, 0xF6, 0x7F, 0x84, 0xB3, 0x3E, 0xFC, 0xE7, 0x61,
-    0x80, 0x80, 0x0F, 0xFF, 0xF9, 0xA0, 0xAC, 0x03, 0xFF, 0xF5, 0xA1, 0xAC, 0x02, 0x88, 0xC9, 0x40,
-    0x20, 0xF0, 0xFF, 0x3F, 0xD8, 0x6D, 0xC7, 0x18, 0x19, 0x7E, 0xFC, 0xF7, 0x07, 0x4B, 0xE9, 0x01,
-    0x15, 0xFE, 0x8F, 0x16, 0x4A, 0xFE, 0x0B, 0x34, 0x42, 0xE0, 0x0F, 0xD8, 0xB8, 0xFB, 0x8C, 0x20,
-    0x67, 0x80, 0x00, 0x27, 0x48, 0x71, 0xE2, 0xED, 0xFF, 0xE7, 0xC4, 0x19, 0x18, 0x00, 0xFB, 0x79,
-    0x67, 0xE6, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x70, 0xB8, 0xF5, 0xBF, 0x96, 0x81, 0x41, 0xE0, 0xD7,
-    0xFF, 0xFF, 0xF3, 0x19, 0x18, 0x36, 0xFC, 0xFF, 0xFF, 0xBF, 0x9F, 0x81, 0xE1, 0xDB, 0xFF, 0xFD,
-    0xAE, 0x26, 0x0C, 0x0C, 0x7F, 0xFE, 0xB3, 0x33, 0x00, 0xC1, 0xFF, 0xF7, 0x20, 0x52, 0xE1, 0xFF,
-    0x7A, 0x10, 0x65, 0x00, 0x92, 0x47, 0xA3, 0xFE, 0xFC, 0x07, 0x01, 0x16, 0x28, 0xF5, 0xEA, 0xDF,
-    0xFF, 0xFF, 0xEF, 0xDE, 0x31, 0x63, 0x55, 0x49, 0x6F, 0x0A, 0x00, 0x80, 0x32, 0x4B, 0x74, 0x78,
-    0x9C, 0x65, 0xCF, 0x3D, 0x0A, 0xC2, 0x40, 0x10, 0x05, 0xE0, 0x17, 0xED, 0x82, 0x62, 0x6E, 0x60,
-    0x0A, 0x2B, 0x41, 0x49, 0x9B, 0x46, 0x41, 0x8F, 0x60, 0x65, 0xE7, 0x0D, 0xF4, 0x08, 0x1E, 0xC2,
-    0x52, 0x48, 0x6E, 0xA0, 0x4D, 0xEA, 0x05, 0x2F, 0xA0, 0x20, 0x62, 0x97, 0x9F, 0xCE, 0x4E, 0x1B,
-    0x21, 0x81, 0x24, 0xCF, 0xD9, 0x24, 0x90, 0xC2, 0xA9, 0x3E, 0xD8, 0xD9, 0x37, 0x33, 0x00, 0x82,
-    0x22, 0x74, 0x91, 0x2B, 0xE0, 0x4E, 0x29, 0xB3, 0x50, 0x70, 0x34, 0x78, 0xA5, 0x42, 0x42, 0xAE,
-    0x97, 0x4F, 0x8A, 0x32, 0x4E, 0x01, 0xA4, 0x54, 0x16, 0xD9, 0x11, 0xF9, 0x54, 0x1B, 0x7A, 0x02,
-    0xD8, 0x54, 0x3E, 0xE7, 0x5A, 0x16, 0xD5, 0x8D, 0x83, 0x46, 0x31, 0xFB, 0x8D, 0x3E, 0xEC, 0xFD,
-    0xA9, 0x7D, 0x6D, 0x7F, 0xB4, 0x29, 0x6D, 0x32, 0xEA, 0x69, 0x67, 0x51, 0xCA, 0x89, 0x28, 0x13,
-    0xC5, 0xB2, 0xD5, 0xAA, 0xDA, 0xCA, 0x2E, 0xF5, 0xA6, 0x91, 0x08, 0x17, 0xAD, 0xB1, 0x16, 0x82,
-    0x32, 0x74, 0xAD, 0x4A, 0x75, 0xCA, 0xA9, 0x91, 0x53, 0xC7, 0x4A, 0xED, 0xB9, 0xC5, 0xCE, 0xD4,
-    0x4A, 0x38, 0xC4, 0x57, 0x19, 0x32, 0x36, 0xA7, 0x29, 0xE9, 0xDE, 0x68, 0xF1, 0x62, 0x64, 0xC8,
-    0x7D, 0x55, 0xCD, 0xA4, 0xE5, 0xA1, 0xA1, 0x5B, 0x80, 0x43, 0xFE, 0x3E, 0x76, 0x81, 0x1F, 0xEF,
-    0x59, 0x8D, 0x0D, 0x78, 0x9C, 0xFB, 0xF8, 0x9F, 0x9B, 0x01, 0x02, 0x3E, 0xD2, 0x92, 0xA5, 0x70,
-    0xE2, 0xDF, 0x3E, 0x36, 0x30, 0xEB, 0xC7, 0xFF, 0xFF, 0xFF, 0xEF, 0x33, 0x01, 0x59, 0xBB, 0xFF,
-    0x83, 0x80, 0x1C, 0x90, 0xF5, 0xFF, 0xBE, 0x5B, 0xF0, 0xEF, 0xFF, 0xFD, 0x20, 0x16, 0x3B, 0x03,
-    0x43, 0xC1, 0xFF, 0xF7, 0x40, 0x56, 0x3F, 0x48, 0xE3, 0xDF, 0xFF, 0x4C, 0x1F, 0xFF, 0xF3, 0x83,
-    0x58, 0x3F, 0xFF, 0xB3, 0x40, 0x59, 0x3F, 0xFE, 0xB3, 0x7E, 0xFC, 0xCF, 0x03, 0x62, 0x7D, 0x07,
-    0xB1, 0xB8, 0x07, 0x98, 0x05, 0x00, 0x56, 0x8B, 0x77, 0x35, 0x78, 0x9C, 0x63, 0x70, 0x66, 0x98,
-    0xF0, 0x9F, 0xF7, 0xC3, 0xFF, 0xF8, 0x0F, 0xFF, 0xFD, 0x03, 0xFE, 0x71, 0x32, 0x20, 0x81, 0x03,
-    0xFF, 0xF9, 0x29, 0x44, 0x00, 0xD6, 0xD4, 0x2F, 0x77, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x30, 0x61,
-    0x60, 0x60, 0xB8, 0xF0, 0x9F, 0x93, 0x81, 0xE1, 0xEB, 0x7F, 0x7E, 0x06, 0x86, 0x2F, 0x20, 0x62,
-    0xC2, 0x7B, 0x56, 0x06, 0xAC, 0xE0, 0xC3, 0x7F, 0xDE, 0x01, 0x22, 0x78, 0x18, 0x18, 0x3E, 0xFE,
-    0xE7, 0x06, 0x39, 0x92, 0xCB, 0x29, 0xF9, 0xDF, 0x7F, 0xD6, 0xAF, 0xFF, 0xFF, 0xBF, 0x07, 0x72,
-    0xFE, 0xDB, 0x31, 0x5C, 0xFE, 0xDF, 0xCB, 0xC4, 0x00, 0x00, 0x58, 0x75, 0x49, 0x45, 0x78, 0x9C,
-    0xB5, 0xCF, 0xCD, 0x11, 0xC1, 0x60, 0x14, 0x85, 0xE1, 0x4F, 0xB0, 0x20, 0x32, 0x2A, 0x30, 0xA3,
-    0x02, 0x4A, 0xD0, 0x82, 0x7D, 0x16, 0x76, 0xB6, 0x4A, 0xD0, 0x42, 0x3A, 0xA0, 0x04, 0x25, 0xE8,
-    0x80, 0x0E, 0x52, 0x42, 0x26, 0x66, 0x8C, 0x89, 0x88, 0x57, 0x26, 0xE7, 0xD0, 0x81, 0xBB, 0x7A,
-    0x16, 0xF7, 0xE7, 0xDC, 0x92, 0x38, 0xA8, 0xCA, 0x3F, 0xEB, 0xCC, 0xC5, 0x7A, 0x31, 0x91, 0x4E,
-    0xE4, 0x3D, 0xA9, 0x66, 0xA6, 0xBE, 0x23, 0x45, 0x24, 0x55, 0x2C, 0x34, 0x9B, 0x41, 0x5F, 0x7A,
-    0xB0, 0xD2, 0xBE, 0x14, 0x06, 0xD2, 0x1B, 0x7C, 0xA3, 0xAD, 0xD1, 0x4F, 0x1B, 0x6B, 0x0B, 0x51,
-    0xA7, 0x7D, 0x78, 0x92, 0x74, 0x9A, 0x86, 0x2B, 0x07, 0xA7, 0x9A, 0xC3, 0xD0, 0xF9, 0xEE, 0x2C,
-    0xAD, 0x8C, 0xFC, 0x9B, 0xB9, 0x61, 0x6C, 0xDD, 0xD8, 0x59, 0xEB, 0x76, 0xA5, 0x7F, 0xAB, 0x48,
-    0x3E, 0x26, 0x63, 0x75, 0x5C, 0x78, 0x9C, 0xFB, 0xF3, 0x9F, 0xE1, 0x0F, 0x2D, 0x11, 0x00, 0x22,
-    0x44, 0x3F, 0x61, 0x78, 0x9C, 0xDD, 0xC7, 0xC1, 0x0D, 0x82, 0x40, 0x10, 0x46, 0xE1, 0x81, 0x48,
-    0x30, 0x18, 0x62, 0x1B, 0xDE, 0xF0, 0xA0, 0x77, 0x8B, 0xB1, 0x00, 0x4D, 0xEC, 0x63, 0x2D, 0x80,
-    0xC4, 0x0E, 0xA8, 0x81, 0x0E, 0x38, 0x7B, 0xA2, 0x00, 0x4D, 0x36, 0x99, 0x8B, 0x60, 0x90, 0xE7,
-    0x0E, 0x6A, 0x13, 0xCE, 0x61, 0xDE, 0xFF, 0x29, 0xE9, 0xEE, 0x4A, 0x95, 0x88, 0x1C, 0xEF, 0xBE,
-    0x8C, 0x45, 0x59, 0x0D, 0x40, 0x13, 0x1D, 0xC2, 0xC7, 0x05, 0xDF, 0x6C, 0x90, 0xF7, 0x53, 0xE6,
-    0x0A, 0x97, 0xED, 0x7E, 0xC0, 0xE3, 0x36, 0xA7, 0x91, 0x42, 0x69, 0x63, 0x91, 0x33, 0xB4, 0x91,
-    0x48, 0x8D, 0x53, 0x0A, 0x09, 0x37, 0x4E, 0x59, 0xD3, 0x28, 0x4B, 0xF3, 0x93, 0xDC, 0x82, 0xFF,
-    0xBA, 0x23, 0xB3, 0xBC, 0x50, 0x16, 0x36, 0x1E, 0xA4, 0x3F, 0x67, 0x1F, 0xCF, 0xFE, 0xC3, 0x6F,
-    0x90, 0x2C, 0x9A, 0xDA, 0x78, 0x9C, 0xFB, 0xF8, 0x9F, 0x43, 0xE1, 0xC4, 0xBF, 0x7D, 0x6C, 0x0C,
-    0x0C, 0x1F, 0xFF, 0x73, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0x7D, 0x26, 0x20, 0x6B, 0xD7, 0x7F, 0x10,
-    0x90, 0x03, 0xB2, 0xFE, 0xDF, 0x77, 0x0B, 0xFE, 0xFD, 0xBF, 0x1F, 0xC4, 0x62, 0x67, 0x60, 0x28,
-    0xF8, 0xFF, 0x1E, 0xC8, 0xEA, 0x67, 0x00, 0x82, 0xBF, 0xFF, 0x99, 0x3E, 0xFE, 0xE7, 0x07, 0xB1,
-    0x7E, 0xFE, 0x67, 0x81, 0xB2, 0x7E, 0xFC, 0x67, 0xFD, 0xF8, 0x9F, 0x07, 0xC4, 0xFA, 0x0E, 0x62,
-    0x71, 0x0F, 0x30, 0x0B, 0x00, 0x13, 0xB0, 0x63, 0x60, 0x78, 0x9C, 0x4D, 0x8F, 0x31, 0x0A, 0xC2,
-    0x60, 0x0C, 0x46, 0x3F, 0x90, 0x2A, 0xD4, 0x52, 0x37, 0x57, 0xC1, 0x83, 0xA8, 0xB3, 0xA7, 0xD0,
-    0x13, 0xE8, 0x8D, 0x74, 0x68, 0x67, 0xBD, 0x80, 0xE0, 0x11, 0xDC, 0x5D, 0xBC, 0x41, 0x2B, 0x2D,
-    0x0E, 0x0A, 0x3E, 0xFF, 0x3F, 0xB6, 0x90, 0x4C, 0x8F, 0x90, 0x2F, 0x79, 0x91, 0xB4, 0xBD, 0x73,
-    0x99, 0x2A, 0xD6, 0x9E, 0x50, 0xD5, 0x30, 0xE2, 0x27, 0x22, 0xA7, 0x40, 0x67, 0x58, 0xCF, 0x4B,
-    0x48, 0xA5, 0x17, 0x8B, 0xD0, 0x68, 0xD9, 0x49, 0x5F, 0x06, 0x01, 0x57, 0x54, 0xDA, 0x70, 0xD0,
-    0x3F, 0x91, 0x1C, 0x59, 0x1A, 0xB6, 0xA4, 0x0F, 0x72, 0xC3, 0x9A, 0xBC, 0x26, 0x33, 0xBC, 0x31,
-    0x79, 0x32, 0x36, 0xBC, 0x32, 0x73, 0xE8, 0x06, 0x5C, 0xCC, 0x2D, 0xEB, 0x4F, 0xBC, 0x49, 0xDC,
-    0xE1, 0x4E, 0xA7, 0x89, 0x3A, 0x26, 0x59, 0x98, 0xA4, 0x53, 0xEF, 0x1E, 0x1A, 0x59, 0xB8, 0x7F,
-    0xF3, 0x07, 0xB0, 0x8B, 0x62, 0x23, 0x78, 0x9C, 0xFB, 0xF4, 0x9F, 0x2D, 0xE0, 0xD6, 0xFF, 0xB9,
-    0x2C, 0x0C, 0x0C, 0x9F, 0xFE, 0x9B, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7E, 0x46, 0x20, 0xEB, 0xCF,
-    0x7F, 0x10, 0x90, 0x05, 0xB2, 0xFE, 0xAF, 0x37, 0x4D, 0xF9, 0xF3, 0x7F, 0x3F, 0x90, 0x75, 0x9F,
-    0x89, 0x81, 0xA1, 0xE1, 0xFF, 0x7F, 0xD6, 0x4F, 0xFF, 0xF5, 0x19, 0x80, 0xE0, 0xE7, 0x7F, 0xEE,
-    0x4F, 0xFF, 0xF9, 0x41, 0xAC, 0x8F, 0xFF, 0xE5, 0x3F, 0xFD, 0xE7, 0x01, 0xB1, 0x16, 0xFC, 0xF7,
-    0xFF, 0xF4, 0x9F, 0x1B, 0xC4, 0x4A, 0xF8, 0x5F, 0x0F, 0x65, 0x39, 0xFC, 0xEF, 0x87, 0xB2, 0x0C,
-    0xFE, 0xCF, 0xC7, 0x60, 0x21, 0x64, 0x11, 0x3A, 0xC0, 0xA6, 0x20, 0x4C, 0x96, 0x87, 0xD8, 0xC6,
-    0x05, 0x74, 0x01, 0x23, 0x48, 0xD9, 0x7F, 0x16, 0xA0, 0xAB, 0xFA, 0x54, 0x82, 0x7E, 0xFF, 0x5F,
-    0x0F, 0x72, 0x1F, 0x18, 0xF0, 0x00, 0x59, 0xDE, 0xFF, 0x80, 0x8C, 0xF5, 0x20, 0xD7, 0x73, 0x27,
-    0xBC, 0x86, 0xFA, 0x08, 0x6C, 0x1E, 0x03, 0xF5, 0x59, 0x00, 0x6E, 0xF6, 0x80, 0x65, 0x78, 0x9C,
-    0xAD, 0xCE, 0x31, 0x0E, 0x01, 0x51, 0x14, 0x85, 0xE1, 0x13, 0x5A, 0x13, 0x7A, 0xCD, 0x44, 0x4F,
-    0x44, 0x45, 0x14, 0xB4, 0xB3, 0x0B, 0x4B, 0xB0, 0x04, 0x4B, 0xB0, 0x03, 0x76, 0xF0, 0x34, 0x6F,
-    0x25, 0x7A, 0x33, 0x76, 0x40, 0x41, 0x42, 0x32, 0xF3, 0xBB, 0x33, 0x9E, 0xD7, 0x50, 0x3A, 0xD5,
-    0xD7, 0xDC, 0x73, 0x8F, 0x24, 0x5F, 0x9E, 0x66, 0x2A, 0x9D, 0x74, 0xC4, 0xD2, 0xAF, 0x9C, 0x96,
-    0x35, 0xC8, 0x71, 0xBA, 0x42, 0x36, 0xF0, 0x98, 0x9E, 0x8C, 0x24, 0xDD, 0x70, 0x3D, 0x68, 0x9B,
-    0x36, 0xB8, 0x35, 0x3B, 0x83, 0x52, 0xDC, 0x81, 0x45, 0x50, 0x41, 0x37, 0xE8, 0x42, 0x12, 0xD5,
-    0xF9, 0xA1, 0xE4, 0xEB, 0x62, 0x1F, 0x5B, 0x56, 0xB1, 0xD9, 0xBE, 0xB5, 0x4C, 0x5B, 0x5B, 0xF0,
-    0x60, 0x68, 0xBA, 0x9B, 0xCE, 0x30, 0x9D, 0x34, 0xAB, 0xC6, 0xBC, 0xF3, 0x59, 0x3F, 0xAF, 0x25,
-    0x5F, 0xE5, 0x59, 0xDA, 0x28, 0xB4, 0xFC, 0x5B, 0x2F, 0x62, 0x98, 0x7B, 0x81, 0x78, 0x9C, 0xFB,
+const uint8_t Roboto_20Bitmaps[9455] = {
+    0x03, 0x00, 0xFB, 0xF9, 0x9F, 0xED, 0x07, 0x08, 0xB1, 0xC2, 0xD1, 0x77, 0x28, 0x62, 0x81, 0xA0,
+    0x6F, 0x50, 0xC4, 0x0C, 0x44, 0x5F, 0x11, 0x88, 0x09, 0x88, 0xBE, 0x80, 0x11, 0x52, 0x40, 0x32,
+    0x1C, 0x3C, 0xCF, 0xF4, 0xF3, 0x3F, 0xD7, 0xCF, 0xFF, 0xDC, 0x40, 0x06, 0x00, 0xFB, 0xBC, 0x9F,
+    0xE1, 0x97, 0x3D, 0x12, 0xB1, 0x9E, 0xE1, 0x97, 0xFE, 0xE7, 0x7E, 0x86, 0x5F, 0xF2, 0x9F, 0xEB,
+    0x19, 0x7E, 0xF1, 0x7F, 0xCE, 0x67, 0xF8, 0xC5, 0xF7, 0xD9, 0x9F, 0xE1, 0x17, 0xEF, 0x67, 0x7B,
+    0x86, 0x5F, 0x3C, 0x9F, 0xF5, 0x19, 0x7E, 0x71, 0x01, 0x00, 0x83, 0x18, 0xC3, 0x06, 0x64, 0x72,
+    0x43, 0xDD, 0xC2, 0x0C, 0x0C, 0x28, 0x0E, 0x68, 0x14, 0x80, 0xE4, 0x20, 0x21, 0xF1, 0xE9, 0x3C,
+    0x48, 0x0E, 0xE2, 0xA6, 0xAF, 0xF3, 0x21, 0x72, 0x60, 0xC3, 0xF2, 0x21, 0x72, 0x60, 0xFF, 0x01,
+    0x83, 0xE1, 0x1B, 0xD4, 0x2B, 0xFF, 0x80, 0x21, 0xF6, 0x13, 0xE4, 0xF2, 0xBB, 0x77, 0xFF, 0xFE,
+    0xBF, 0x7F, 0xF7, 0xEE, 0xFF, 0xFF, 0x77, 0x7D, 0x19, 0xFE, 0xC3, 0x41, 0x3C, 0x0A, 0x1B, 0x14,
+    0xF7, 0xCC, 0x40, 0x3F, 0x73, 0x42, 0x9D, 0x0A, 0x8A, 0x09, 0x88, 0x1B, 0x3F, 0xDE, 0x87, 0xC8,
+    0x81, 0xFD, 0xBD, 0x1E, 0x22, 0x07, 0x0E, 0xC3, 0x7A, 0x88, 0x1C, 0x38, 0x55, 0xF8, 0x43, 0x9C,
+    0x04, 0x0E, 0x25, 0x79, 0x88, 0x93, 0xC0, 0x9E, 0xE7, 0x83, 0x38, 0x09, 0x9A, 0x61, 0xC0, 0x89,
+    0x16, 0x85, 0x7D, 0x1D, 0xEC, 0x34, 0x10, 0x5E, 0x0B, 0x4E, 0x13, 0x8C, 0xC0, 0x40, 0x84, 0xC4,
+    0xDF, 0x87, 0xF7, 0xA0, 0xB8, 0x86, 0x64, 0xD5, 0xCF, 0xFB, 0x21, 0x72, 0xE0, 0xC4, 0xD5, 0x8F,
+    0xB0, 0x16, 0xE4, 0xBB, 0x2F, 0xD0, 0x58, 0xFE, 0xA3, 0x0F, 0x71, 0x12, 0xD8, 0x5A, 0x7E, 0x88,
+    0x93, 0xC0, 0x31, 0xC1, 0x03, 0x71, 0x12, 0x03, 0x03, 0x00, 0x03, 0x1B, 0x08, 0x4B, 0x33, 0xF8,
+    0x59, 0x4B, 0xFF, 0xFF, 0xAF, 0x01, 0xDB, 0xFB, 0x14, 0x64, 0x6D, 0x3D, 0x3C, 0xA9, 0x80, 0xC2,
+    0xE4, 0xEB, 0xFF, 0xFB, 0x19, 0xAD, 0xFF, 0x40, 0xD1, 0xF4, 0x0F, 0xC4, 0x5D, 0x00, 0xB4, 0x18,
+    0x1A, 0x91, 0x7F, 0xFE, 0xB3, 0x15, 0x40, 0xA2, 0xEF, 0xCB, 0x7F, 0x2E, 0x68, 0x42, 0xF9, 0xF0,
+    0x9F, 0x0F, 0xCA, 0x3A, 0xF0, 0x9F, 0xBF, 0x00, 0x12, 0x2D, 0x1B, 0xFE, 0xCB, 0x1B, 0xC0, 0xFC,
+    0x05, 0x4A, 0x99, 0xB6, 0x50, 0xD6, 0xE7, 0xFF, 0xFF, 0xAD, 0xE0, 0x61, 0xF2, 0xBF, 0x16, 0xA2,
+    0x00, 0x94, 0x06, 0xF7, 0x43, 0x3C, 0x79, 0x15, 0xC4, 0x84, 0x88, 0x36, 0x03, 0x0B, 0x25, 0x3B,
+    0x88, 0x5A, 0x87, 0x3F, 0x70, 0xB3, 0x12, 0xFE, 0xC3, 0x22, 0x0D, 0xE8, 0x4A, 0x7E, 0x78, 0x90,
+    0xDB, 0x43, 0x63, 0xA3, 0xE1, 0x7F, 0xFC, 0x4F, 0x48, 0x78, 0x01, 0x33, 0xE0, 0x77, 0x48, 0x18,
+    0x6E, 0xF8, 0x6F, 0xFF, 0xE9, 0xBF, 0x1C, 0x24, 0x2D, 0xF3, 0x1F, 0xF8, 0x7F, 0x1F, 0x18, 0x15,
+    0x06, 0xFF, 0xFE, 0x73, 0x01, 0x03, 0x76, 0x7F, 0x78, 0x19, 0xD0, 0x64, 0x26, 0x50, 0x1C, 0x40,
+    0x8B, 0x28, 0x03, 0x70, 0x79, 0xB5, 0x1E, 0x14, 0x5B, 0x06, 0x27, 0xFF, 0xFF, 0xAF, 0x66, 0x82,
+    0xC6, 0x64, 0x3D, 0x2C, 0xFC, 0x70, 0xB3, 0x00, 0x63, 0x08, 0x78, 0x7D, 0x5F, 0x13, 0xE1, 0x54,
+    0x50, 0x19, 0xC0, 0x0A, 0xE3, 0x2C, 0xF8, 0x3F, 0x6F, 0x07, 0xCC, 0x6B, 0x40, 0x6B, 0xEF, 0x33,
+    0x32, 0x7C, 0x03, 0x79, 0x24, 0x00, 0xE4, 0xB2, 0x9F, 0xF1, 0x20, 0x77, 0x03, 0x59, 0x9F, 0x40,
+    0x51, 0xF3, 0x47, 0x1E, 0x14, 0x78, 0x40, 0x6F, 0xFD, 0x01, 0x29, 0xFF, 0xCB, 0x0F, 0x72, 0x0E,
+    0x1B, 0x30, 0xC0, 0x39, 0x90, 0x78, 0x1F, 0xC1, 0x29, 0x13, 0xA6, 0xF2, 0x37, 0x38, 0xC5, 0x40,
+    0x4D, 0x09, 0x80, 0x04, 0x2B, 0xD4, 0x86, 0x87, 0x10, 0xDF, 0x41, 0x6D, 0xFF, 0x15, 0x8F, 0x70,
+    0x19, 0x9B, 0x03, 0x2C, 0x82, 0xC0, 0xAE, 0x7E, 0x00, 0x09, 0x4F, 0x58, 0xD8, 0xE5, 0x23, 0x71,
+    0x0C, 0x60, 0x01, 0x09, 0x8D, 0x6E, 0x26, 0x85, 0x1B, 0xEF, 0x73, 0x60, 0xFE, 0xAF, 0x07, 0x05,
+    0xE1, 0x7F, 0x19, 0x68, 0x60, 0xF1, 0x00, 0xF3, 0x7A, 0xC7, 0xBF, 0xF3, 0xD0, 0x98, 0x60, 0xDE,
+    0x00, 0x8C, 0xC2, 0x03, 0x90, 0x30, 0xF8, 0xDE, 0x0F, 0x76, 0xB4, 0x01, 0xD8, 0x52, 0x05, 0x60,
+    0x00, 0x7E, 0x06, 0xC5, 0x13, 0x38, 0x20, 0x37, 0x00, 0xBD, 0xF0, 0x05, 0x94, 0x9C, 0xFE, 0x81,
+    0x82, 0xFF, 0x1B, 0x50, 0x1C, 0xCE, 0x13, 0xF8, 0x27, 0xC7, 0x80, 0x50, 0xB9, 0x00, 0x64, 0xD4,
+    0xC7, 0xF7, 0x50, 0x53, 0x1C, 0xD6, 0x82, 0xF5, 0x72, 0x40, 0x6D, 0x10, 0x00, 0x9B, 0x7B, 0x1E,
+    0x66, 0x3B, 0x34, 0x72, 0xA1, 0x2E, 0x03, 0xA7, 0x1C, 0xB0, 0xAB, 0x01, 0x03, 0x92, 0x4B, 0xFF,
+    0xDE, 0xB7, 0x84, 0x0A, 0x1C, 0x02, 0x19, 0xC8, 0x05, 0xF3, 0x0B, 0x3C, 0xC6, 0x16, 0xFC, 0x7F,
+    0xAF, 0x96, 0xF4, 0x0F, 0xA2, 0xED, 0x23, 0x28, 0xB0, 0x1E, 0x42, 0x4C, 0x03, 0xA7, 0xED, 0x06,
+    0x48, 0xE0, 0x7C, 0x03, 0x49, 0x17, 0x20, 0xB1, 0x27, 0x40, 0x5C, 0xF6, 0x05, 0x64, 0x1E, 0x24,
+    0x37, 0x00, 0x1D, 0xA1, 0xCF, 0x60, 0xF0, 0x0F, 0xE2, 0xB3, 0x02, 0xA0, 0xDD, 0xDF, 0xA1, 0x7E,
+    0x03, 0x26, 0xC4, 0xD3, 0xFF, 0x61, 0x41, 0xFE, 0x09, 0x68, 0xAD, 0x2E, 0x3C, 0xCA, 0x10, 0xE1,
+    0xF8, 0xF8, 0x3F, 0x2C, 0x9A, 0xC0, 0x59, 0xE1, 0x3E, 0x23, 0xCC, 0x37, 0xF3, 0xFF, 0x80, 0xA2,
+    0xED, 0xF3, 0x7F, 0x66, 0xA0, 0x30, 0xEB, 0x45, 0x50, 0x58, 0x7E, 0xF9, 0xCF, 0xF4, 0x11, 0x98,
+    0x24, 0x15, 0x40, 0x45, 0xC5, 0xB7, 0xFF, 0x40, 0x25, 0x1C, 0x20, 0x31, 0x7F, 0x86, 0x5F, 0xEF,
+    0x81, 0x29, 0x85, 0x11, 0x9C, 0x05, 0x98, 0x80, 0x06, 0xFF, 0x7D, 0x0F, 0x49, 0x54, 0xBD, 0x40,
+    0x67, 0xFC, 0xFD, 0x0F, 0x89, 0x09, 0x50, 0x78, 0xFE, 0x06, 0x87, 0x1F, 0x28, 0x00, 0xD8, 0x18,
+    0xBE, 0xC3, 0x12, 0xF3, 0x7F, 0x06, 0x68, 0xAE, 0x51, 0xF8, 0x0D, 0x4A, 0x79, 0xC0, 0x08, 0xCA,
+    0x55, 0x0E, 0xFE, 0x05, 0x54, 0xAF, 0x07, 0xCB, 0x1D, 0xFF, 0xEF, 0x81, 0x32, 0x9F, 0x01, 0x38,
+    0x2F, 0xF5, 0x33, 0x82, 0x1D, 0xE5, 0x70, 0xF3, 0xFF, 0xBD, 0x2C, 0x46, 0x60, 0x70, 0xCD, 0x07,
+    0x00, 0xFB, 0x6B, 0x0F, 0x86, 0xFA, 0x7F, 0xE5, 0xFF, 0xF2, 0x03, 0x21, 0xDF, 0x5F, 0xDE, 0xBF,
+    0x3C, 0x00, 0x03, 0x6B, 0x00, 0xFB, 0xFA, 0x8B, 0x3F, 0xD8, 0xA7, 0xF9, 0xE0, 0x18, 0x04, 0x19,
+    0xF5, 0x77, 0x3D, 0xD8, 0x0A, 0x5E, 0x70, 0x48, 0x82, 0x4C, 0xFC, 0xB3, 0x1E, 0xAC, 0x42, 0x1F,
+    0xEC, 0x64, 0x6E, 0xB0, 0x30, 0x2B, 0xA5, 0xF9, 0x83, 0x03, 0x4E, 0x42, 0x44, 0x20, 0xB2, 0x1F,
+    0xA0, 0x24, 0x0F, 0xDC, 0x04, 0x88, 0x69, 0x10, 0x93, 0x0D, 0x20, 0x09, 0x06, 0x6C, 0x23, 0xD4,
+    0x76, 0x88, 0x4B, 0x20, 0xAE, 0x82, 0xB8, 0x10, 0xE2, 0x7C, 0xA8, 0xCB, 0x27, 0x80, 0x4D, 0x12,
+    0xF8, 0xDB, 0x0F, 0x49, 0x9F, 0x6C, 0x60, 0x55, 0xF1, 0x70, 0x5F, 0x03, 0x43, 0x00, 0x00, 0x3D,
+    0x94, 0xC9, 0x09, 0x80, 0x30, 0x10, 0x45, 0x0F, 0xF1, 0x20, 0x22, 0x68, 0x05, 0x62, 0x07, 0x5A,
+    0x8A, 0x1D, 0x58, 0x4A, 0xD2, 0x81, 0x25, 0xA4, 0x15, 0x4B, 0xD0, 0x0E, 0xEC, 0x40, 0xC4, 0x93,
+    0xB8, 0xA0, 0x79, 0x1F, 0x73, 0x09, 0x81, 0x99, 0xFC, 0x15, 0xE2, 0xB8, 0x2F, 0x5E, 0x59, 0x07,
+    0x82, 0xFA, 0xB1, 0x62, 0x49, 0x48, 0xA4, 0x82, 0xDC, 0x4B, 0xB1, 0x21, 0xBB, 0x8C, 0x30, 0x1B,
+    0x9C, 0x31, 0x38, 0x57, 0x25, 0x6F, 0x68, 0x3F, 0x85, 0x2E, 0xA7, 0xD1, 0x02, 0x95, 0x0D, 0x0F,
+    0x7A, 0x7C, 0xA9, 0x63, 0x1B, 0x3F, 0x80, 0x16, 0x88, 0xFF, 0x1C, 0xE2, 0x54, 0x9B, 0x7A, 0xE5,
+    0x40, 0x10, 0xDA, 0x04, 0xF2, 0x46, 0x11, 0x12, 0x74, 0xC0, 0x0E, 0x40, 0xC7, 0xE2, 0x88, 0xC2,
+    0x9D, 0xE1, 0xE5, 0x41, 0xA9, 0x50, 0xF6, 0x39, 0x2A, 0xEF, 0x00, 0x3E, 0xB3, 0x21, 0xD7, 0x8E,
+    0xAA, 0x5F, 0x03, 0xEB, 0xE4, 0x82, 0x05, 0x10, 0x9C, 0xC1, 0x09, 0x73, 0x06, 0x27, 0x24, 0x13,
+    0x06, 0x80, 0x0C, 0x67, 0xDC, 0xB0, 0x9E, 0xC5, 0xE1, 0x3F, 0x87, 0xC0, 0x75, 0x9E, 0x8F, 0xFF,
+    0xDF, 0x57, 0xFC, 0x8F, 0xF8, 0xFD, 0x5F, 0xFE, 0x33, 0x3C, 0x33, 0xB5, 0x80, 0xD3, 0x50, 0x0D,
+    0xD0, 0xD5, 0x0A, 0xBF, 0xFE, 0xEF, 0x67, 0x85, 0x06, 0xC7, 0x79, 0x68, 0xCC, 0xDE, 0x86, 0x38,
+    0xEE, 0xFB, 0x7F, 0x23, 0x70, 0x52, 0x31, 0x00, 0x46, 0xE8, 0x4F, 0x90, 0x27, 0x1E, 0x02, 0x3D,
+    0xFC, 0x00, 0xE4, 0xE9, 0x05, 0x40, 0xFF, 0x3A, 0x80, 0x83, 0x3F, 0x15, 0x88, 0x33, 0x19, 0x18,
+    0x00, 0x83, 0x04, 0x35, 0x37, 0x4C, 0x8E, 0x16, 0xCC, 0xC9, 0x33, 0x67, 0xCE, 0xFC, 0xF9, 0x7F,
+    0x3E, 0x90, 0xE4, 0x84, 0xE7, 0xF4, 0xFF, 0xF2, 0xD8, 0x99, 0x74, 0x70, 0x0E, 0x00, 0x03, 0x86,
+    0x17, 0x2B, 0x1C, 0x83, 0x5C, 0xF6, 0x03, 0x68, 0xF1, 0x9F, 0xFB, 0xE0, 0x94, 0xBE, 0x01, 0xA8,
+    0xE7, 0x13, 0xD0, 0x2C, 0x03, 0x1F, 0x06, 0x06, 0x00, 0x13, 0x10, 0x04, 0x02, 0xC6, 0xCF, 0x20,
+    0x83, 0x78, 0x90, 0x49, 0x00, 0x63, 0x68, 0x63, 0x5E, 0xF0, 0xDF, 0xFF, 0xC3, 0xFF, 0xF9, 0x0F,
+    0xFE, 0xF7, 0x3B, 0xFC, 0xE5, 0x06, 0x00, 0x83, 0x26, 0x16, 0x98, 0xBA, 0xDF, 0xFD, 0x30, 0x27,
+    0xEB, 0xC3, 0x8C, 0xE5, 0x81, 0x05, 0x19, 0x54, 0xD7, 0xE7, 0xFF, 0x30, 0xC7, 0xC2, 0xBC, 0x08,
+    0x89, 0x7D, 0x90, 0xA3, 0xA1, 0x6E, 0xD9, 0x00, 0x73, 0xCA, 0x47, 0xA8, 0x2F, 0x18, 0xBE, 0x43,
+    0x2D, 0x62, 0xF8, 0x9B, 0x0F, 0xB3, 0x9A, 0x1F, 0x96, 0x62, 0xA1, 0x49, 0xF7, 0x03, 0x2C, 0x6B,
+    0x7C, 0x83, 0x25, 0xE1, 0x3F, 0xF5, 0x84, 0xE3, 0x07, 0xE6, 0x98, 0x5F, 0xB0, 0x20, 0x84, 0xC5,
+    0x45, 0x02, 0xCC, 0xC3, 0x07, 0x60, 0x71, 0xF2, 0x09, 0x12, 0xFC, 0xC0, 0x00, 0x80, 0x65, 0xAD,
+    0x7F, 0x90, 0xA0, 0xC5, 0x17, 0xBF, 0x70, 0xC7, 0x00, 0x00, 0x03, 0x2A, 0x3F, 0xF1, 0xEF, 0x7E,
+    0x16, 0x03, 0xA1, 0x7C, 0x06, 0x31, 0x74, 0x02, 0x30, 0x0A, 0x1B, 0x20, 0x91, 0x01, 0x4C, 0x3B,
+    0xD0, 0xF8, 0xFE, 0xF6, 0x9F, 0x1D, 0x1A, 0xE5, 0xC0, 0x2C, 0xF7, 0x15, 0x12, 0x02, 0x17, 0xFE,
+    0xF3, 0x41, 0xBD, 0xB9, 0xE1, 0x3F, 0xFF, 0x4F, 0x88, 0x7B, 0x16, 0xFC, 0xD7, 0x87, 0xB2, 0x26,
+    0xFC, 0xD7, 0xFF, 0x05, 0xF1, 0xDF, 0x84, 0xFF, 0xF6, 0xA4, 0xB3, 0x10, 0xE6, 0xFD, 0x80, 0xB3,
+    0xBE, 0x43, 0x62, 0xEC, 0xC0, 0x7F, 0xFE, 0x2F, 0x10, 0x17, 0x00, 0x1D, 0x07, 0x29, 0x01, 0x40,
+    0xAE, 0xBA, 0x00, 0x89, 0x40, 0xA0, 0x4B, 0x1B, 0x60, 0x29, 0x9F, 0x51, 0x00, 0x9C, 0x80, 0x16,
+    0x80, 0x22, 0x0A, 0xE8, 0x4B, 0x15, 0xA0, 0x2F, 0xE5, 0xE1, 0x3E, 0x67, 0x85, 0x25, 0x53, 0x5F,
+    0x70, 0x80, 0x42, 0x43, 0x08, 0x00, 0x03, 0x7B, 0xEF, 0x15, 0x90, 0x68, 0xFA, 0xF7, 0x9F, 0x41,
+    0xE0, 0x18, 0xD0, 0x3C, 0x87, 0x5F, 0x20, 0x53, 0x21, 0x11, 0x0E, 0xCC, 0x1A, 0xAC, 0x7F, 0xFF,
+    0xFF, 0xC8, 0x61, 0x04, 0x26, 0x15, 0x65, 0x70, 0x82, 0x61, 0x18, 0x04, 0x24, 0x00, 0x03, 0x92,
+    0x53, 0xFE, 0xBE, 0x5F, 0x0B, 0xF1, 0xEE, 0x15, 0x58, 0x12, 0x83, 0x24, 0xB6, 0xFF, 0xE0, 0x00,
+    0xFB, 0xFA, 0xFF, 0xBE, 0x99, 0xD1, 0x35, 0x70, 0xAE, 0xFB, 0x07, 0xB6, 0x02, 0x14, 0x0B, 0x09,
+    0x10, 0xFF, 0x5D, 0x00, 0x3A, 0xEE, 0x00, 0x24, 0xF4, 0x0A, 0x80, 0x8A, 0x3F, 0x40, 0x1C, 0x63,
+    0x00, 0x94, 0x84, 0xE4, 0x08, 0xA0, 0x5B, 0x60, 0x5E, 0x03, 0x8A, 0xD6, 0xC3, 0x98, 0x0D, 0xB0,
+    0x00, 0xC3, 0xEB, 0x2E, 0x06, 0x48, 0xFC, 0xEB, 0xC3, 0x98, 0x7F, 0xE0, 0xF2, 0x1B, 0x10, 0xA6,
+    0xFE, 0x84, 0x45, 0x19, 0xD0, 0x50, 0xB8, 0xA6, 0xEF, 0xFF, 0x65, 0x19, 0x60, 0xE1, 0x08, 0x0D,
+    0x2A, 0x50, 0xB0, 0xE9, 0xC1, 0x8D, 0x87, 0x07, 0xD0, 0x23, 0x48, 0xCA, 0x85, 0xC4, 0x1D, 0x34,
+    0x6B, 0x32, 0x5C, 0x84, 0x06, 0x39, 0xD8, 0x4E, 0x0D, 0x25, 0x30, 0x60, 0x2A, 0xF8, 0x0F, 0x2F,
+    0xA5, 0x1A, 0xB0, 0x32, 0x01, 0x03, 0x92, 0x4B, 0xFF, 0xBE, 0x9F, 0x03, 0x76, 0x11, 0x38, 0xEF,
+    0xDE, 0x67, 0x86, 0x26, 0x35, 0x50, 0x0E, 0x01, 0xDA, 0x75, 0xDE, 0xCC, 0xE8, 0x18, 0xC8, 0x40,
+    0x88, 0xD7, 0x7E, 0xFE, 0xE7, 0x4E, 0x80, 0x78, 0xED, 0xC1, 0x7F, 0x79, 0x68, 0x0E, 0x01, 0xC6,
+    0xFE, 0x01, 0x48, 0x00, 0x15, 0x40, 0xE3, 0x09, 0x99, 0x05, 0xCF, 0x46, 0xC0, 0x30, 0x83, 0x3A,
+    0x41, 0xE0, 0x0F, 0x38, 0x04, 0x04, 0x94, 0x9C, 0x7F, 0x42, 0xA2, 0xFE, 0x03, 0x34, 0x65, 0x43,
+    0x58, 0xF9, 0x0C, 0x30, 0x16, 0xB8, 0xE0, 0x01, 0x02, 0xC5, 0x6B, 0x08, 0x2F, 0xFD, 0x80, 0x7B,
+    0x64, 0x01, 0x34, 0x64, 0x40, 0xFE, 0x80, 0x87, 0x36, 0x34, 0xA8, 0x41, 0xAC, 0xFB, 0x1F, 0xA0,
+    0xA1, 0xF9, 0xFF, 0xFC, 0x03, 0x88, 0xFB, 0x1C, 0xFE, 0xCF, 0x5F, 0x00, 0x31, 0x7E, 0xC3, 0xFF,
+    0x78, 0x03, 0x48, 0x02, 0xFA, 0x0E, 0x34, 0x0F, 0x58, 0xB6, 0x99, 0x82, 0x7C, 0xC9, 0x02, 0x34,
+    0x13, 0x9A, 0xB9, 0x18, 0x18, 0x9E, 0xC1, 0x42, 0x03, 0x1C, 0x42, 0x73, 0x81, 0x6A, 0x01, 0x63,
+    0x80, 0x06, 0x76, 0x3F, 0x42, 0xB6, 0x1F, 0x1E, 0x2C, 0x70, 0xE6, 0x01, 0x04, 0xF3, 0x3B, 0x9C,
+    0xA9, 0xF0, 0xFF, 0x3C, 0x8C, 0xB9, 0xE1, 0x7F, 0x2C, 0x8C, 0xF9, 0xF5, 0xBF, 0x0B, 0x94, 0x29,
+    0xF0, 0x6F, 0xBD, 0x03, 0x94, 0xB9, 0xE0, 0xBF, 0x1C, 0x8C, 0xF9, 0xE5, 0x3F, 0x2B, 0x8C, 0xF9,
+    0x6F, 0x3F, 0x34, 0xB1, 0x03, 0x3D, 0xA2, 0x0F, 0x63, 0x7E, 0x06, 0x06, 0x21, 0x94, 0xF9, 0xF7,
+    0x3C, 0x2C, 0x37, 0x34, 0x80, 0x42, 0x18, 0xC2, 0xFC, 0x04, 0xF2, 0x26, 0x84, 0xF9, 0xE7, 0x3E,
+    0x2C, 0xBB, 0x14, 0x80, 0x13, 0xA0, 0x03, 0x24, 0xAD, 0x48, 0x0B, 0x0A, 0x0A, 0x26, 0xFE, 0x9F,
+    0x2F, 0x28, 0xF8, 0x1B, 0x56, 0x92, 0xFC, 0x5F, 0xFF, 0x0F, 0x2B, 0x93, 0x01, 0x29, 0xC3, 0x51,
+    0xCC, 0x04, 0x00, 0x03, 0x99, 0x06, 0x06, 0x8C, 0xF0, 0x6C, 0xC8, 0x08, 0xCF, 0x22, 0x8C, 0x40,
+    0x07, 0x75, 0x80, 0x01, 0xD0, 0xF1, 0xB0, 0x84, 0x05, 0xC9, 0x09, 0x90, 0x74, 0x0B, 0x73, 0x37,
+    0x03, 0x3C, 0x68, 0x15, 0xA0, 0x51, 0x05, 0x32, 0xDC, 0x9F, 0x01, 0xE6, 0x19, 0xFD, 0xA5, 0x7F,
+    0xEF, 0x47, 0x81, 0x1D, 0xF9, 0x1E, 0x64, 0xAE, 0x2D, 0x2C, 0x95, 0x81, 0xE2, 0x70, 0xC1, 0xFF,
+    0xFF, 0x73, 0xCB, 0x6F, 0xFC, 0x07, 0xC6, 0x41, 0xC1, 0xDF, 0x7C, 0x70, 0x04, 0x02, 0xCD, 0x17,
+    0x60, 0x42, 0x0E, 0x04, 0x50, 0xCC, 0x43, 0x03, 0x16, 0xE8, 0x5E, 0x68, 0x1C, 0x01, 0x53, 0x08,
+    0x2F, 0xDC, 0x73, 0x7C, 0x18, 0x2C, 0xA0, 0xEC, 0x9F, 0xF7, 0xD0, 0x8C, 0xC7, 0xFD, 0x13, 0x62,
+    0xD0, 0xF7, 0xFF, 0xEC, 0x5F, 0xC0, 0x81, 0x08, 0x8C, 0x28, 0xA6, 0x0B, 0x60, 0x37, 0x6F, 0x80,
+    0x14, 0x55, 0x39, 0xCA, 0xC5, 0xFF, 0x40, 0xA9, 0xE0, 0x2B, 0xCC, 0x55, 0x0C, 0x06, 0xE0, 0x3C,
+    0x61, 0x03, 0x8E, 0xFE, 0x9B, 0xFF, 0xEE, 0x79, 0x02, 0x69, 0x00, 0x03, 0x53, 0xDB, 0xDF, 0x42,
+    0x93, 0xDE, 0x9F, 0xFF, 0xF0, 0x90, 0x86, 0xB2, 0x2E, 0x02, 0x63, 0x2D, 0x5C, 0x04, 0x12, 0xC6,
+    0xF5, 0xB0, 0x50, 0xBA, 0xCF, 0x04, 0x0B, 0x05, 0x3D, 0xB8, 0xC3, 0xA1, 0x01, 0xC6, 0xF0, 0xEF,
+    0x3C, 0x94, 0xE1, 0x00, 0x35, 0x0A, 0xA4, 0x81, 0x3F, 0xE0, 0xD6, 0xFF, 0xB5, 0x2C, 0x20, 0x9F,
+    0xDA, 0x82, 0x92, 0xDA, 0x7E, 0x46, 0xA0, 0x7B, 0xC0, 0x25, 0xC8, 0x7F, 0x39, 0x60, 0x44, 0xFF,
+    0x7F, 0x6F, 0xEE, 0xF4, 0x13, 0xE8, 0x94, 0x4F, 0xFF, 0x41, 0xC1, 0x0B, 0x2C, 0x38, 0xD8, 0x3E,
+    0x43, 0x42, 0xE4, 0xEB, 0x7F, 0x9E, 0xCF, 0x90, 0xA0, 0x07, 0x66, 0x97, 0x2F, 0x10, 0x16, 0x30,
+    0x9B, 0x7C, 0x81, 0x44, 0x13, 0x30, 0xA3, 0x40, 0xD2, 0x18, 0x50, 0xCB, 0x7C, 0x68, 0xA2, 0x03,
+    0x16, 0x2A, 0x1F, 0x20, 0x3E, 0x75, 0xF8, 0x5F, 0xBF, 0x01, 0x12, 0xAF, 0x05, 0xFF, 0xFD, 0xA1,
+    0x51, 0x7F, 0x00, 0x18, 0xED, 0xFF, 0xC0, 0x01, 0xFB, 0x15, 0x68, 0xC4, 0x37, 0x90, 0xEB, 0x0D,
+    0x40, 0xC9, 0xE8, 0xC0, 0xFF, 0xFF, 0x16, 0x40, 0x17, 0x00, 0xED, 0x14, 0x80, 0xE4, 0x04, 0x6E,
+    0x58, 0xE0, 0x42, 0x52, 0x4C, 0xD3, 0x9B, 0xF7, 0x35, 0x40, 0x5D, 0x00, 0x83, 0xE7, 0xBD, 0xFF,
+    0x3C, 0x58, 0x99, 0x9C, 0x02, 0x82, 0x10, 0xF0, 0x03, 0xEA, 0x20, 0x58, 0x56, 0x80, 0x3A, 0xD3,
+    0x9F, 0x01, 0xEE, 0x09, 0xB8, 0x05, 0x5F, 0xE0, 0x16, 0x30, 0xFC, 0x7E, 0x8F, 0x08, 0x64, 0x78,
+    0xE8, 0x2F, 0x40, 0x84, 0xFE, 0x47, 0x58, 0x80, 0x82, 0x9C, 0x05, 0xB7, 0x00, 0x9E, 0xF6, 0x81,
+    0xBE, 0xF2, 0xC7, 0xE2, 0x83, 0x6F, 0x08, 0x0B, 0xFE, 0xC2, 0x2D, 0x70, 0x40, 0x58, 0x70, 0x00,
+    0x61, 0xC1, 0x67, 0x84, 0x05, 0xBF, 0xE0, 0x16, 0x28, 0x20, 0x2C, 0x98, 0x80, 0xB0, 0xE0, 0x23,
+    0xB6, 0x20, 0x22, 0x98, 0x7E, 0xBE, 0xC2, 0xB2, 0x1E, 0x00, 0x03, 0x2A, 0x3F, 0xFE, 0xF7, 0x5E,
+    0x14, 0x03, 0x4A, 0x3E, 0xBB, 0x00, 0x89, 0x2E, 0x76, 0x90, 0x93, 0xE7, 0xAB, 0x24, 0xFF, 0x05,
+    0x3A, 0xC1, 0x01, 0x6C, 0xE8, 0x02, 0xA0, 0x81, 0x0B, 0x20, 0x91, 0xF1, 0xF7, 0x3F, 0xCB, 0x03,
+    0x48, 0xB0, 0x7C, 0xFB, 0xCF, 0xFE, 0x01, 0x62, 0xFA, 0x97, 0xFF, 0x9C, 0x50, 0x16, 0x30, 0xF2,
+    0x2F, 0xC0, 0x64, 0xD9, 0x1A, 0x20, 0x3A, 0xFE, 0xFC, 0x67, 0x14, 0x00, 0x9B, 0x32, 0x01, 0xE4,
+    0xDF, 0x2F, 0x40, 0x93, 0x81, 0x39, 0x18, 0xE8, 0x5F, 0x87, 0x7F, 0xF0, 0x04, 0xF7, 0x05, 0xC4,
+    0xE2, 0x81, 0x27, 0xC2, 0xFB, 0xCC, 0xA0, 0x38, 0xCF, 0x65, 0x32, 0xFC, 0x09, 0x0C, 0xE1, 0x02,
+    0x70, 0xF2, 0x71, 0x00, 0xFA, 0xFD, 0x03, 0xC4, 0xCF, 0x5F, 0xFF, 0x73, 0x7D, 0x85, 0x84, 0x37,
+    0xD0, 0x21, 0x3F, 0x21, 0x7E, 0x9E, 0xF0, 0xDF, 0xFE, 0x17, 0x24, 0xE4, 0x1A, 0xFE, 0xFB, 0xFF,
+    0x82, 0x89, 0xF9, 0x7F, 0x87, 0x78, 0x19, 0x18, 0xED, 0x9F, 0x61, 0x2E, 0xE5, 0x85, 0x44, 0x91,
+    0xC1, 0xBF, 0xFF, 0x6C, 0xC0, 0xA2, 0xAA, 0x4E, 0xD9, 0x09, 0x54, 0xC0, 0x41, 0x1C, 0x00, 0x76,
+    0x82, 0x02, 0xB8, 0x38, 0x04, 0xA7, 0x4C, 0x83, 0x13, 0xFF, 0xEE, 0x67, 0x03, 0x9D, 0x07, 0x00,
+    0x03, 0x12, 0x37, 0xFF, 0x9D, 0x13, 0x07, 0xEB, 0xFB, 0x0D, 0xCD, 0x5C, 0xD0, 0xE8, 0x02, 0x39,
+    0xEA, 0xDF, 0xFF, 0x3A, 0xE5, 0xAD, 0x20, 0xC1, 0x09, 0x60, 0x3F, 0x7C, 0x07, 0x86, 0xDB, 0xC7,
+    0xFF, 0x72, 0xE0, 0xA0, 0x9A, 0x0F, 0x0C, 0x6A, 0xB0, 0x6F, 0x81, 0x21, 0xFC, 0x0B, 0xE2, 0xB3,
+    0x1F, 0xFF, 0x59, 0xFE, 0xBE, 0x87, 0xBA, 0x91, 0xFD, 0xDF, 0x79, 0x68, 0x48, 0x71, 0xFD, 0xBB,
+    0x0F, 0x8D, 0x51, 0x1E, 0xA8, 0xEC, 0x87, 0xFF, 0xBC, 0xD0, 0xB0, 0x00, 0xB2, 0xBE, 0x43, 0x4C,
+    0xF9, 0xFA, 0x9F, 0xF7, 0x13, 0xD8, 0x64, 0x60, 0x20, 0xF2, 0x6C, 0x00, 0x27, 0xAF, 0xC7, 0xC0,
+    0xC4, 0x03, 0xF4, 0x4C, 0x9D, 0xF1, 0xD2, 0xFF, 0xA0, 0x12, 0xEA, 0x2B, 0xD8, 0x55, 0xDF, 0x80,
+    0x51, 0xE0, 0x00, 0x2A, 0x7D, 0x7C, 0x3F, 0x82, 0xDC, 0x9A, 0xF8, 0xE6, 0x7D, 0x36, 0xD0, 0x36,
+    0x66, 0x06, 0xE4, 0xBC, 0x0A, 0xCF, 0xAF, 0x90, 0xA0, 0xCC, 0x87, 0xB2, 0x1E, 0xC2, 0xC2, 0x4A,
+    0xE0, 0x2F, 0x2C, 0x08, 0xBE, 0x41, 0xE2, 0xC9, 0xA8, 0xE4, 0xD5, 0x7F, 0x48, 0xDC, 0xFF, 0x81,
+    0x7A, 0x1C, 0xCC, 0xDA, 0x0F, 0x31, 0xF6, 0xF7, 0xBD, 0x2A, 0x70, 0x64, 0x00, 0x00, 0x13, 0x28,
+    0x67, 0x02, 0x26, 0xC5, 0xCF, 0xFF, 0xF3, 0x3F, 0xFE, 0xF7, 0x4F, 0x78, 0xC7, 0xC9, 0x40, 0x1C,
+    0x00, 0xEB, 0x92, 0x87, 0xE9, 0xE2, 0x00, 0x00, 0x63, 0x70, 0xC8, 0x00, 0x85, 0x19, 0x27, 0xD0,
+    0x71, 0x7C, 0x60, 0xEB, 0x37, 0xDE, 0x67, 0x66, 0x20, 0x07, 0x80, 0x12, 0x3C, 0x0C, 0x7F, 0x06,
+    0x3A, 0xE5, 0x0B, 0xD0, 0x96, 0x1F, 0x40, 0x0F, 0xFF, 0xDB, 0x0F, 0x74, 0x9A, 0x3E, 0xD0, 0x7E,
+    0x76, 0x06, 0x81, 0x2E, 0x06, 0x06, 0x00, 0x83, 0x05, 0x81, 0x15, 0x54, 0xE4, 0xB7, 0x3F, 0xC4,
+    0xC7, 0xBF, 0x21, 0x51, 0x1A, 0x00, 0xCC, 0x8D, 0x20, 0x46, 0x00, 0x30, 0x85, 0xDC, 0x07, 0xFA,
+    0x2D, 0x01, 0x48, 0xEF, 0x07, 0x3A, 0xBF, 0x00, 0x98, 0xFF, 0xFB, 0x81, 0x2E, 0x6C, 0x04, 0xD2,
+    0xB9, 0x10, 0xBF, 0xFD, 0xF7, 0x82, 0x58, 0x09, 0x0B, 0x4C, 0xA0, 0x88, 0x26, 0x98, 0x01, 0x52,
+    0x13, 0x03, 0x71, 0x23, 0x90, 0xD5, 0x07, 0x76, 0x3A, 0xC8, 0x9C, 0xF5, 0xE0, 0x60, 0x00, 0x9B,
+    0xCC, 0x86, 0x6C, 0x17, 0xC2, 0x76, 0x84, 0x7B, 0x40, 0x2E, 0x04, 0x00, 0x0B, 0x09, 0x85, 0x00,
+    0xD1, 0x7F, 0xB0, 0x5C, 0x87, 0xC9, 0x60, 0x20, 0x0B, 0xE0, 0x31, 0xD0, 0x05, 0x0A, 0x44, 0x00,
+    0x5B, 0x0C, 0x53, 0xCA, 0xF0, 0xF9, 0x3C, 0x0B, 0x8C, 0xF5, 0xFF, 0x3E, 0x1B, 0x8C, 0xF5, 0xFF,
+    0xBD, 0x38, 0x24, 0x08, 0x40, 0xA5, 0x83, 0x26, 0xC4, 0x3B, 0x2F, 0x80, 0x4C, 0x2B, 0x88, 0x82,
+    0x2D, 0x40, 0xA6, 0x0F, 0x84, 0xD9, 0x08, 0x2C, 0x12, 0x72, 0x19, 0xE0, 0x8A, 0xD9, 0xE0, 0x1E,
+    0x81, 0x04, 0x59, 0xC2, 0x1F, 0xA8, 0xD8, 0xA4, 0xFF, 0x50, 0x75, 0x47, 0xA1, 0x7A, 0x15, 0x60,
+    0xE6, 0x05, 0xC0, 0xED, 0x40, 0xD8, 0x8B, 0xE4, 0x16, 0xB8, 0xFB, 0x10, 0x6E, 0x06, 0x00, 0x23,
+    0x94, 0xBE, 0x5E, 0x00, 0x0D, 0x7B, 0x00, 0x8E, 0xA0, 0x3F, 0xFF, 0x39, 0xBF, 0x80, 0xC3, 0x07,
+    0x98, 0xD9, 0xBE, 0x81, 0x8D, 0x38, 0x00, 0x0B, 0xC5, 0x05, 0xB0, 0x00, 0xDC, 0x00, 0x13, 0x79,
+    0x00, 0x73, 0xD6, 0x77, 0xA8, 0xAB, 0x1C, 0x60, 0x6E, 0xFE, 0x0C, 0xF5, 0x8F, 0x01, 0xCC, 0xBD,
+    0x9F, 0xA1, 0xD1, 0x02, 0x0C, 0x3C, 0x0E, 0xA8, 0x21, 0xF3, 0x61, 0x39, 0x86, 0x0F, 0x56, 0x40,
+    0xB0, 0xC3, 0xC2, 0x07, 0x9A, 0x7D, 0x7E, 0x41, 0x83, 0x87, 0x28, 0xA0, 0x20, 0x0A, 0xCF, 0x13,
+    0xCC, 0xB0, 0xFC, 0x02, 0x8D, 0xC7, 0xDF, 0xB0, 0x40, 0x3B, 0xB4, 0x1F, 0xE4, 0x3C, 0x00, 0x5D,
+    0x94, 0xBF, 0x4A, 0xC3, 0x50, 0x14, 0xC6, 0x6B, 0x4B, 0x41, 0x1D, 0x4A, 0x1E, 0x21, 0x93, 0x8B,
+    0x42, 0xBB, 0x09, 0xE2, 0xE0, 0x0B, 0x38, 0x38, 0xB7, 0x90, 0xE2, 0x5E, 0x22, 0xAE, 0x0E, 0xF1,
+    0x0D, 0x1A, 0x67, 0x87, 0xD8, 0xC1, 0xC1, 0xA1, 0xD0, 0xC1, 0x51, 0x31, 0x8B, 0x83, 0x3A, 0x14,
+    0x27, 0xC1, 0x45, 0x70, 0x93, 0x0E, 0x69, 0xD3, 0x84, 0x34, 0xB1, 0xDE, 0xE3, 0xFD, 0xCE, 0xCD,
+    0x6D, 0xA2, 0x19, 0x92, 0x9B, 0x2F, 0xDC, 0x7B, 0xFE, 0x7C, 0xBF, 0x13, 0xB5, 0x38, 0x7E, 0x17,
+    0xC1, 0x70, 0xAB, 0xC8, 0xF8, 0x51, 0xF9, 0xD5, 0xD1, 0xEF, 0xD2, 0xF3, 0xE0, 0xEE, 0x45, 0xCE,
+    0xFC, 0xCE, 0x2A, 0x58, 0x5B, 0xA6, 0x60, 0x5C, 0x53, 0xDE, 0xA8, 0x05, 0x6D, 0xAB, 0x2F, 0x03,
+    0x95, 0xEE, 0x79, 0xEE, 0x18, 0xD7, 0x59, 0xE3, 0x7B, 0x5D, 0x0B, 0x07, 0x48, 0xC5, 0xCC, 0xCB,
+    0x52, 0x74, 0x39, 0xA5, 0xD6, 0xB2, 0x3F, 0x32, 0xEF, 0x39, 0xE7, 0xDE, 0x9D, 0x04, 0x6D, 0xF6,
+    0xAE, 0x5E, 0xC9, 0x80, 0x09, 0xA3, 0xBA, 0x8F, 0xD2, 0x36, 0x0D, 0x2E, 0xFD, 0x93, 0xC6, 0xCF,
+    0x3C, 0xC6, 0xDF, 0x8D, 0x2E, 0x8E, 0x30, 0xC4, 0xB8, 0x2A, 0x81, 0xC1, 0xA9, 0xCD, 0x11, 0x3A,
+    0xED, 0x22, 0x5C, 0x88, 0xB1, 0x88, 0xAC, 0x29, 0x31, 0x9F, 0x32, 0xA1, 0x08, 0x2C, 0x86, 0x4E,
+    0x88, 0x06, 0xA4, 0x58, 0xC7, 0x30, 0x6C, 0xE6, 0xC5, 0xB0, 0x82, 0x71, 0x4E, 0x40, 0xCB, 0xD4,
+    0xC3, 0xA3, 0xC5, 0xFE, 0xA7, 0x0E, 0x0B, 0x0B, 0x1B, 0xF5, 0xC3, 0xA7, 0xCC, 0x62, 0x21, 0xB5,
+    0x10, 0x04, 0xDE, 0x2C, 0xB1, 0x2F, 0xEC, 0x43, 0x18, 0xB1, 0x1B, 0x02, 0x60, 0x45, 0x36, 0x04,
+    0x9F, 0xD1, 0x60, 0xEE, 0x92, 0x66, 0x6A, 0x43, 0x58, 0xD7, 0x64, 0x2D, 0x1B, 0x88, 0x72, 0x05,
+    0xFA, 0x7C, 0x08, 0x26, 0x6D, 0x20, 0x9D, 0x13, 0x70, 0x99, 0xE0, 0xE6, 0x53, 0x15, 0x15, 0x98,
+    0xF4, 0x51, 0xBB, 0x20, 0xD0, 0x92, 0x79, 0xD2, 0xD1, 0x35, 0x4C, 0x04, 0x51, 0x3F, 0xA6, 0xB3,
+    0x2F, 0x99, 0x90, 0x8B, 0x08, 0xAF, 0x18, 0x53, 0x57, 0xFD, 0xC7, 0xB9, 0xD1, 0x95, 0xB7, 0x60,
+    0x4F, 0x1A, 0x2A, 0x86, 0x80, 0xEE, 0xA7, 0xD4, 0x74, 0x35, 0x2D, 0x39, 0x49, 0xAB, 0xCB, 0xD7,
+    0x23, 0x50, 0xC0, 0xFB, 0xF0, 0x6F, 0xCF, 0x9C, 0x0E, 0xFF, 0x0A, 0x2D, 0x41, 0x1D, 0x1C, 0x73,
+    0xDA, 0xD3, 0xCA, 0x40, 0xFE, 0x73, 0x2E, 0x6F, 0x26, 0xA5, 0xAD, 0xB7, 0x8A, 0xA8, 0x5E, 0xB1,
+    0xEB, 0xE8, 0x49, 0x04, 0xF7, 0xBB, 0x6A, 0xFD, 0x0B, 0x83, 0xD2, 0x48, 0xAE, 0x05, 0x99, 0x8A,
+    0xC4, 0x7B, 0xF0, 0x1F, 0xAE, 0x1C, 0xEC, 0x68, 0x98, 0x0B, 0x21, 0x1E, 0x82, 0x85, 0x1C, 0xD8,
+    0x97, 0xFD, 0x88, 0x00, 0x06, 0x3A, 0x47, 0xFF, 0x37, 0xDC, 0x72, 0x60, 0x78, 0xF3, 0x7C, 0x85,
+    0xA5, 0x7C, 0x50, 0xBC, 0xB0, 0x7D, 0x80, 0x25, 0x58, 0x50, 0xA4, 0x32, 0x4E, 0x40, 0x44, 0x07,
+    0xD0, 0x25, 0x0E, 0xD0, 0xD8, 0x06, 0xC5, 0x58, 0x3C, 0x34, 0x73, 0x30, 0xC0, 0xB2, 0xDA, 0x0F,
+    0x98, 0xDF, 0xC0, 0x19, 0xEC, 0x13, 0x2C, 0x3E, 0xC0, 0xC2, 0x07, 0x60, 0x61, 0x81, 0x27, 0x3F,
+    0x2D, 0x80, 0xB8, 0x18, 0x1A, 0x15, 0x1F, 0xFF, 0xDB, 0x83, 0x0A, 0x85, 0x9F, 0x90, 0xA0, 0xC3,
+    0x57, 0x0E, 0xC1, 0x38, 0xE0, 0xA8, 0x6A, 0x80, 0x1A, 0xCD, 0xF0, 0xEF, 0x3F, 0x38, 0x84, 0xF8,
+    0x91, 0x02, 0x96, 0x98, 0xFC, 0x0E, 0x74, 0x5B, 0x3F, 0x18, 0xC3, 0x42, 0xEE, 0x3D, 0x58, 0x1E,
+    0x1E, 0xAA, 0x2C, 0x9F, 0x11, 0xB1, 0xF5, 0xF5, 0x3F, 0x17, 0x00, 0x83, 0x44, 0xC6, 0x5A, 0x75,
+    0x58, 0xBC, 0x00, 0x81, 0x14, 0x82, 0x79, 0x9F, 0x11, 0xC8, 0xB4, 0x30, 0x36, 0x0E, 0x39, 0x0E,
+    0x8A, 0x47, 0xA8, 0xC6, 0xAF, 0xE0, 0xAC, 0xC3, 0x06, 0x09, 0xB0, 0xF5, 0x30, 0xA6, 0x02, 0x30,
+    0xE5, 0xC1, 0x4C, 0x06, 0x66, 0x2B, 0x38, 0xF3, 0x3D, 0x8C, 0x09, 0xB4, 0x0C, 0xC6, 0x04, 0xC5,
+    0x34, 0x94, 0xF9, 0x03, 0xE8, 0xAE, 0x1F, 0xFF, 0x3D, 0x43, 0x43, 0x4B, 0x5F, 0xFD, 0x7F, 0xCF,
+    0x04, 0xB7, 0x58, 0x1A, 0xE1, 0x06, 0x36, 0x24, 0xE7, 0x30, 0x41, 0xB5, 0x01, 0xB3, 0xBE, 0x1E,
+    0xC2, 0x0D, 0x70, 0x73, 0xF1, 0xA4, 0x03, 0x28, 0x13, 0x98, 0x09, 0x61, 0xCC, 0x2F, 0x08, 0xD1,
+    0x1F, 0xFF, 0x39, 0xA1, 0x4C, 0x60, 0x0C, 0xB2, 0x40, 0x99, 0x97, 0xC0, 0x1E, 0xB2, 0x34, 0x36,
+    0x76, 0x5E, 0x06, 0x2A, 0x8B, 0x60, 0x6E, 0x00, 0xA6, 0x0C, 0x18, 0x53, 0x07, 0xE6, 0xB2, 0xB3,
+    0x16, 0x40, 0xF5, 0x00, 0x03, 0x51, 0x4B, 0xDF, 0xFE, 0x5F, 0x4B, 0x30, 0x9E, 0xC3, 0x43, 0x8E,
+    0xFF, 0x07, 0x99, 0x71, 0xE1, 0xFF, 0x7D, 0x90, 0xF3, 0x9F, 0x80, 0xDC, 0xFC, 0xE3, 0xBF, 0x2C,
+    0xC4, 0x98, 0xFF, 0x4C, 0x02, 0x30, 0x4B, 0x7F, 0xFC, 0xE7, 0x28, 0x80, 0xF9, 0xE7, 0xD3, 0x7F,
+    0xBE, 0x0B, 0xB0, 0xB0, 0x01, 0x26, 0xF8, 0x8F, 0x30, 0xB7, 0x4E, 0xF8, 0x1F, 0xFF, 0x05, 0x96,
+    0x62, 0x21, 0x51, 0x06, 0x67, 0x7F, 0x87, 0x85, 0x20, 0x8A, 0x43, 0x89, 0x63, 0x23, 0xEB, 0x45,
+    0x36, 0xF3, 0x0B, 0x2C, 0x5A, 0xC1, 0x11, 0x87, 0x70, 0x03, 0x92, 0xDB, 0xE4, 0x1B, 0x90, 0xDC,
+    0x2C, 0x00, 0x0B, 0xFC, 0x9F, 0x40, 0x43, 0x7E, 0x42, 0x02, 0xCE, 0x00, 0x94, 0xEA, 0x80, 0x7E,
+    0x07, 0x49, 0x3C, 0x05, 0x25, 0x24, 0x83, 0x7F, 0xFF, 0xF7, 0xBB, 0x39, 0x1F, 0x27, 0x94, 0xBE,
+    0xB7, 0xFD, 0x7D, 0xBF, 0x16, 0x94, 0x96, 0x00, 0x03, 0x47, 0xC6, 0x59, 0x0B, 0x44, 0xC4, 0xFC,
+    0xFF, 0x1F, 0x8B, 0xC4, 0xFE, 0x2F, 0x03, 0xCD, 0x3B, 0xCE, 0xAD, 0x7F, 0xFF, 0xBF, 0x67, 0x82,
+    0x69, 0x0E, 0xF8, 0xFB, 0x5F, 0x0E, 0x6E, 0xD0, 0x41, 0x50, 0xBC, 0x42, 0xD9, 0xC0, 0x10, 0x60,
+    0x81, 0x5B, 0xF0, 0x05, 0xE8, 0x1B, 0x18, 0x1B, 0x94, 0xDE, 0x61, 0xEC, 0x02, 0x60, 0x84, 0xC3,
+    0xD8, 0x06, 0xE0, 0x02, 0x86, 0x0D, 0xEE, 0x5C, 0x38, 0xFB, 0xDF, 0x7F, 0x04, 0xFB, 0x2F, 0x0A,
+    0x9B, 0x11, 0x07, 0x1B, 0xBB, 0x5E, 0x24, 0x33, 0x91, 0xED, 0x42, 0x76, 0x03, 0xB2, 0xDB, 0xBE,
+    0x22, 0xDC, 0x8C, 0xEC, 0x97, 0x8B, 0x08, 0x3F, 0x06, 0xFC, 0x83, 0xF8, 0x1D, 0x18, 0x26, 0xD3,
+    0xFE, 0x41, 0xC3, 0x04, 0x39, 0xAC, 0x50, 0xC3, 0xF0, 0xFD, 0x5E, 0x73, 0xB0, 0xB9, 0x00, 0xFB,
+    0x01, 0xCF, 0x6D, 0xD8, 0x59, 0x90, 0x5C, 0x63, 0xCC, 0x8C, 0xD0, 0x44, 0x2D, 0x16, 0xF6, 0xFC,
+    0x88, 0xC9, 0xA2, 0xB6, 0xBD, 0xB8, 0xDD, 0x62, 0x2C, 0x0C, 0xF7, 0x79, 0x3D, 0x36, 0x16, 0x00,
+    0xFB, 0x01, 0xCF, 0x7B, 0xD8, 0x59, 0x90, 0x5C, 0x63, 0xCC, 0x8C, 0xD0, 0x44, 0x7D, 0x16, 0xC4,
+    0x0E, 0x66, 0x78, 0xCE, 0xE4, 0xC7, 0xC1, 0xA2, 0x9D, 0x0B, 0x88, 0x63, 0x01, 0x00, 0x03, 0x39,
+    0x6F, 0xD9, 0xDB, 0xFF, 0x7B, 0xD5, 0x21, 0x2E, 0x85, 0xA4, 0x2D, 0x29, 0x10, 0xFB, 0x31, 0x24,
+    0xCE, 0xDE, 0xB3, 0x80, 0xD4, 0xFD, 0x3F, 0x1F, 0x1E, 0x72, 0x1C, 0x9C, 0x25, 0x1F, 0xFE, 0xBF,
+    0x0F, 0x32, 0xFD, 0x32, 0xC8, 0xE8, 0x9F, 0xFF, 0x65, 0xA1, 0xDE, 0x66, 0x13, 0x80, 0x59, 0xFA,
+    0xE5, 0x3F, 0x5F, 0x03, 0xCC, 0xF3, 0xC0, 0x44, 0x7E, 0x01, 0x92, 0x34, 0x40, 0x61, 0x9B, 0xFF,
+    0x01, 0x16, 0x8C, 0xE0, 0xB8, 0xE1, 0x81, 0xB3, 0xE1, 0x59, 0x04, 0x12, 0x7D, 0x70, 0xF6, 0x77,
+    0x24, 0xF6, 0x0F, 0x70, 0xC8, 0x1A, 0x82, 0xB3, 0x30, 0x84, 0xFD, 0x15, 0xE4, 0xBA, 0x7E, 0x88,
+    0x1A, 0x08, 0xFB, 0x1B, 0xD8, 0x1C, 0x08, 0xFB, 0x2B, 0x2C, 0x47, 0x00, 0x63, 0xFD, 0x33, 0xCC,
+    0xEF, 0x40, 0xF6, 0x07, 0x58, 0xCC, 0x03, 0xD9, 0x1B, 0xA0, 0x09, 0x0F, 0xC4, 0x0E, 0x80, 0x65,
+    0x1C, 0x50, 0x2A, 0xF9, 0x0B, 0xB5, 0x18, 0xC4, 0xFE, 0x0A, 0x0D, 0xFF, 0x02, 0x20, 0x7B, 0x01,
+    0x34, 0x8C, 0xBF, 0x83, 0x34, 0xFE, 0xF9, 0xFF, 0x3E, 0xD2, 0x24, 0xE5, 0x25, 0x38, 0x81, 0x2F,
+    0x80, 0x96, 0x29, 0x60, 0x7F, 0x5F, 0x81, 0xE4, 0x0F, 0x48, 0x0A, 0x6A, 0xBE, 0xF3, 0xFF, 0x7E,
+    0x37, 0x30, 0x64, 0x00, 0x83, 0x73, 0x1A, 0xFE, 0xE7, 0x0F, 0x0E, 0x36, 0x24, 0x9F, 0x1A, 0x6F,
+    0x06, 0xB1, 0xE1, 0x00, 0x0F, 0x7B, 0xB0, 0xB9, 0x1F, 0x3B, 0x1B, 0x00, 0xFB, 0xF2, 0x9F, 0x9B,
+    0x46, 0x08, 0x00, 0x83, 0xB2, 0x3E, 0xC0, 0x7C, 0x38, 0xE4, 0x59, 0x7C, 0xFF, 0x20, 0xA1, 0x0C,
+    0x64, 0xFD, 0x85, 0x84, 0xC3, 0xA7, 0xFF, 0xBC, 0xBF, 0x20, 0xF1, 0x02, 0x0C, 0xC1, 0x6F, 0xE0,
+    0x70, 0x00, 0x46, 0x14, 0xEB, 0x83, 0xFF, 0xFB, 0x81, 0x0A, 0x0F, 0x02, 0x83, 0x08, 0x98, 0xB3,
+    0xFA, 0x4C, 0xA7, 0xFE, 0x03, 0xC5, 0xE2, 0x0F, 0x78, 0x09, 0x13, 0x00, 0x2E, 0xE1, 0x6C, 0xC1,
+    0xD1, 0x7F, 0xEB, 0xDF, 0xFD, 0x28, 0x20, 0x0D, 0x00, 0x4D, 0xD4, 0xB1, 0x0D, 0x83, 0x40, 0x0C,
+    0x05, 0xD0, 0x22, 0x45, 0x24, 0x28, 0x92, 0x05, 0x12, 0xB1, 0x09, 0x8C, 0x90, 0x29, 0xD2, 0x66,
+    0x05, 0x46, 0x60, 0x13, 0x32, 0x02, 0xAB, 0xB0, 0x03, 0x12, 0x17, 0x92, 0xC8, 0x7C, 0xFB, 0xDB,
+    0x16, 0x15, 0x8F, 0xE6, 0x64, 0x7F, 0xFB, 0x2E, 0x7E, 0xDE, 0x38, 0x33, 0xBC, 0x21, 0x0F, 0x77,
+    0xAF, 0x29, 0xBB, 0x57, 0xAD, 0x84, 0x7E, 0xD8, 0x26, 0xD1, 0x8B, 0x55, 0x6F, 0x6E, 0xF8, 0x90,
+    0x98, 0x67, 0x36, 0xAD, 0xBE, 0xFE, 0xE5, 0x16, 0x9E, 0xBC, 0x76, 0xF5, 0xE6, 0xB9, 0xC1, 0x83,
+    0xF8, 0xC5, 0x80, 0x8B, 0x77, 0x0C, 0x3F, 0x25, 0x92, 0x2F, 0xF2, 0x95, 0xC8, 0xB4, 0xC4, 0x2B,
+    0x40, 0x8F, 0x9F, 0x3C, 0x47, 0xAA, 0xC9, 0x2F, 0x40, 0xE1, 0x23, 0x55, 0xD1, 0x17, 0x2D, 0xF3,
+    0x45, 0x9F, 0xAD, 0xAB, 0x53, 0x06, 0xF1, 0xB3, 0xE2, 0xE8, 0xD9, 0x56, 0x94, 0xEE, 0x0E, 0x3D,
+    0xE2, 0xD3, 0xA6, 0xAD, 0x05, 0x37, 0x26, 0x5E, 0x67, 0xA0, 0x0B, 0x16, 0x39, 0x8C, 0x71, 0xE4,
+    0x4A, 0x62, 0xF0, 0xF7, 0x1D, 0x43, 0x70, 0x46, 0x32, 0x0B, 0x52, 0x36, 0x18, 0x33, 0xC1, 0xCA,
+    0x86, 0xFF, 0x9C, 0xD8, 0x58, 0x00, 0x4D, 0x94, 0xD1, 0x0D, 0xC2, 0x30, 0x10, 0x43, 0x11, 0x2D,
+    0x12, 0xDF, 0x2C, 0xD0, 0x55, 0x98, 0x04, 0x3A, 0x03, 0x93, 0x75, 0x03, 0x3A, 0x02, 0xCC, 0x52,
+    0x21, 0x25, 0x54, 0x6A, 0xB0, 0xCF, 0x77, 0x57, 0xFE, 0xFA, 0x7E, 0x5E, 0x94, 0xDA, 0x4E, 0xC9,
+    0x9E, 0xF1, 0x52, 0xFC, 0x8D, 0x7E, 0xB0, 0x82, 0x22, 0x9F, 0x83, 0x37, 0xB1, 0x1F, 0xC8, 0x04,
+    0x8C, 0xEF, 0xCE, 0x93, 0xF3, 0x73, 0xD7, 0x91, 0xD7, 0x10, 0xF2, 0x13, 0xFC, 0x09, 0xE1, 0x86,
+    0x1B, 0x81, 0xDF, 0x2E, 0x44, 0xEF, 0x8D, 0x1F, 0x2E, 0x9C, 0xDA, 0x60, 0x7C, 0x71, 0x21, 0xF6,
+    0x5C, 0xC8, 0xDD, 0x57, 0xC2, 0xD2, 0x7A, 0xF1, 0x22, 0x21, 0x82, 0xAE, 0xE4, 0xFE, 0x65, 0xC2,
+    0x2B, 0x5A, 0x25, 0xD6, 0xB0, 0xA0, 0x43, 0x7F, 0xC0, 0x27, 0x4D, 0x8B, 0x33, 0x15, 0x1F, 0x4C,
+    0xC8, 0x54, 0x56, 0xD5, 0xC8, 0x84, 0xDC, 0xA4, 0x33, 0x85, 0xD4, 0x05, 0x8F, 0x10, 0x52, 0x97,
+    0xB5, 0x83, 0xD0, 0x56, 0x1F, 0x5C, 0xDB, 0xD1, 0x42, 0x0E, 0x86, 0xD0, 0x26, 0x1E, 0x3C, 0xB7,
+    0x9B, 0x75, 0x3E, 0x78, 0xC4, 0x3B, 0x39, 0xFC, 0xD7, 0xB8, 0xE9, 0x45, 0x4E, 0xAE, 0x8A, 0x34,
+    0x79, 0xD1, 0xCC, 0x93, 0x67, 0x0D, 0x24, 0x79, 0x8C, 0xA7, 0xB4, 0xFB, 0x01, 0x4D, 0xD3, 0xB1,
+    0x11, 0x80, 0x30, 0x08, 0x05, 0xD0, 0xCE, 0xCB, 0x9D, 0x4B, 0x38, 0x82, 0x1B, 0xB9, 0x82, 0x95,
+    0x6D, 0x3A, 0xD7, 0xD0, 0x11, 0x1C, 0xC1, 0x0D, 0x74, 0x17, 0x2D, 0x62, 0xE1, 0x45, 0xE0, 0x03,
+    0xD2, 0xBD, 0x82, 0x82, 0xFC, 0x7C, 0x8A, 0x3D, 0x79, 0xAC, 0xB9, 0x68, 0xCC, 0x30, 0x96, 0x55,
+    0xB7, 0xC1, 0x43, 0x30, 0x16, 0x81, 0xB1, 0x9E, 0xF8, 0x41, 0x21, 0xC4, 0x33, 0x96, 0x10, 0x37,
+    0xAF, 0x04, 0x08, 0x5F, 0x32, 0x04, 0xA3, 0xB7, 0x30, 0xD5, 0x32, 0xB9, 0x6F, 0xCE, 0x56, 0x2D,
+    0x43, 0x6A, 0x8A, 0x3A, 0x99, 0xA5, 0xEB, 0xE6, 0x95, 0xC2, 0x36, 0xF3, 0x7F, 0x98, 0x79, 0xC8,
+    0xBD, 0xD5, 0xC3, 0x4D, 0xB7, 0x3F, 0x99, 0xA9, 0x3D, 0x8B, 0x7B, 0xA7, 0x27, 0x99, 0xBB, 0x60,
+    0x3E, 0x06, 0xF7, 0x1E, 0xDC, 0x07, 0x53, 0xCA, 0xBF, 0xCF, 0x9A, 0x3F, 0x03, 0x51, 0x4B, 0xDF,
+    0xBE, 0x9F, 0x03, 0x4D, 0x96, 0x0C, 0xCF, 0x90, 0x22, 0xE7, 0x20, 0x52, 0xAC, 0x09, 0xFC, 0xFD,
+    0xFF, 0xBE, 0xB2, 0xEC, 0xD5, 0xFF, 0xFF, 0x32, 0x90, 0x7C, 0xC8, 0x0E, 0xF6, 0xC8, 0x7A, 0x70,
+    0x80, 0xDB, 0x43, 0xCC, 0x02, 0x85, 0xD9, 0x3F, 0x68, 0xC0, 0x7D, 0x05, 0x5A, 0x97, 0x00, 0x4B,
+    0xC2, 0x07, 0x80, 0xC9, 0xE3, 0x00, 0x24, 0x89, 0x80, 0x7C, 0xB6, 0x1E, 0x18, 0xB7, 0x7C, 0x08,
+    0x07, 0x7E, 0x86, 0x05, 0x3A, 0x28, 0x39, 0x7E, 0x83, 0x79, 0x02, 0x18, 0xD7, 0x2C, 0xDF, 0x61,
+    0xA1, 0x09, 0xCA, 0xD8, 0x08, 0x57, 0x03, 0x59, 0x3F, 0x60, 0xF1, 0x03, 0x74, 0x03, 0x3B, 0x1A,
+    0x07, 0x49, 0x19, 0x8A, 0x01, 0x28, 0x46, 0x23, 0x2C, 0xFD, 0xF3, 0x9F, 0x09, 0xC5, 0x39, 0x28,
+    0x0E, 0x85, 0x7B, 0x61, 0x03, 0x28, 0x16, 0x10, 0x9E, 0xE3, 0x43, 0xF6, 0x36, 0x1B, 0x38, 0x40,
+    0xD8, 0xC0, 0x41, 0xB1, 0x1F, 0x16, 0x54, 0xA5, 0x2F, 0xFF, 0xFF, 0x97, 0x45, 0x0A, 0xC4, 0xF3,
+    0x8C, 0x18, 0xC1, 0x0B, 0x0E, 0xF8, 0xB5, 0x60, 0x23, 0x01, 0x83, 0xE4, 0x86, 0xFB, 0xD5, 0x4C,
+    0x0C, 0xF0, 0x8C, 0x01, 0x8C, 0x7A, 0x18, 0xF3, 0xBF, 0x1D, 0x90, 0x69, 0x01, 0xCC, 0x36, 0xA5,
+    0xC0, 0x5C, 0xC9, 0x04, 0xD5, 0xE8, 0xF0, 0xEF, 0x3F, 0x0F, 0x22, 0x88, 0xFD, 0x61, 0xCC, 0x09,
+    0xFF, 0xE7, 0xC3, 0x98, 0x06, 0xFF, 0xEF, 0xC3, 0x98, 0xC0, 0x34, 0x0E, 0xB7, 0x0F, 0xC1, 0x54,
+    0x40, 0x28, 0x28, 0xF8, 0xBF, 0x1E, 0xC6, 0x7C, 0xF8, 0x3F, 0x1E, 0xCA, 0x04, 0x26, 0x48, 0x3E,
+    0x48, 0x8E, 0x4D, 0x05, 0x96, 0x4A, 0x2C, 0x70, 0xE7, 0xE4, 0xC3, 0x5D, 0x76, 0x9E, 0x19, 0xCA,
+    0x7C, 0xDF, 0xCD, 0x8C, 0xEC, 0xA5, 0x81, 0x63, 0x02, 0x00, 0x03, 0x39, 0x6F, 0xE9, 0xDB, 0xF7,
+    0x3D, 0xCC, 0x70, 0x49, 0x50, 0xBE, 0x86, 0x24, 0x52, 0x68, 0x4C, 0x83, 0x1D, 0x67, 0xF0, 0xEF,
+    0xFF, 0xFD, 0xCA, 0xB2, 0x5F, 0x90, 0x92, 0xE2, 0x02, 0x38, 0x1D, 0x02, 0x5D, 0x5B, 0x0F, 0x26,
+    0x65, 0x21, 0xA1, 0x0B, 0xB4, 0x55, 0x01, 0xE6, 0xEC, 0x1F, 0x40, 0x75, 0x13, 0x60, 0xE1, 0xFD,
+    0x00, 0x18, 0xDA, 0x0F, 0x60, 0x21, 0xDE, 0x00, 0xD4, 0xF4, 0x19, 0xE6, 0x4D, 0x03, 0x60, 0x92,
+    0xF8, 0x06, 0x73, 0x37, 0xC8, 0xB5, 0x3F, 0x61, 0x01, 0x0F, 0x8C, 0x52, 0xC6, 0x5F, 0xB0, 0xCC,
+    0x02, 0x0C, 0x39, 0xA6, 0xDF, 0x70, 0x4F, 0xFD, 0xFA, 0xCF, 0xFC, 0x1B, 0x6A, 0x0D, 0x88, 0xC3,
+    0x82, 0xC6, 0x41, 0x52, 0x86, 0x62, 0x00, 0x8A, 0xD1, 0x48, 0x96, 0xFE, 0x47, 0x75, 0xCE, 0x07,
+    0x64, 0x87, 0x22, 0x79, 0x41, 0x1F, 0xD9, 0x73, 0xDC, 0x70, 0x6F, 0x07, 0x80, 0x03, 0x1B, 0x1A,
+    0x20, 0x3F, 0xC0, 0xCA, 0x81, 0xB9, 0xE2, 0x7E, 0x46, 0x29, 0x30, 0xA8, 0xB8, 0x91, 0x02, 0x71,
+    0x3D, 0x52, 0xF0, 0xC2, 0xA2, 0x5B, 0x60, 0xD9, 0xDB, 0xF7, 0xC0, 0x9C, 0x27, 0x8D, 0x48, 0x29,
+    0x3F, 0xFF, 0xDF, 0x67, 0x82, 0x73, 0x80, 0x31, 0xEA, 0x8F, 0x90, 0xFA, 0xF2, 0xFF, 0x3F, 0x42,
+    0xCA, 0xE0, 0x1F, 0x92, 0x0C, 0xC3, 0x41, 0x16, 0x06, 0x00, 0x83, 0xE4, 0x86, 0xBD, 0xEA, 0xF0,
+    0x88, 0x01, 0x02, 0x6D, 0x24, 0x36, 0xC8, 0xAD, 0x3F, 0xFE, 0x5B, 0x18, 0x1B, 0x87, 0x1C, 0xFF,
+    0x0F, 0x0A, 0x26, 0xA8, 0xE6, 0x27, 0x20, 0x2F, 0x41, 0xD9, 0x06, 0x20, 0xFB, 0x60, 0x86, 0xFE,
+    0x02, 0xBA, 0x02, 0xC6, 0xFE, 0x0A, 0x0C, 0x4E, 0x44, 0x5C, 0xF0, 0xC0, 0xD9, 0x9F, 0x90, 0xD8,
+    0x5F, 0x81, 0x9E, 0x42, 0xE8, 0x65, 0x87, 0xB1, 0x1D, 0x40, 0x91, 0x0C, 0x65, 0x7F, 0x05, 0x05,
+    0x0F, 0x38, 0xFF, 0x06, 0x03, 0xDD, 0xC0, 0x8B, 0x70, 0x1B, 0x28, 0x09, 0xC2, 0xD8, 0xEC, 0x08,
+    0x37, 0xC7, 0xC3, 0x3D, 0xE9, 0x00, 0xC9, 0x0D, 0x10, 0x73, 0xFE, 0x80, 0x49, 0x08, 0xFB, 0x33,
+    0x38, 0xD4, 0x20, 0xEC, 0x05, 0xE0, 0x64, 0x01, 0x61, 0x2B, 0x80, 0x83, 0x1D, 0x6A, 0xEF, 0x4F,
+    0x50, 0x78, 0x43, 0xD9, 0x1F, 0x41, 0x51, 0x0C, 0x65, 0x37, 0x20, 0xF9, 0x9D, 0xE1, 0x1F, 0x30,
+    0xA5, 0x20, 0x92, 0x1E, 0x2F, 0x9C, 0x7D, 0x01, 0x98, 0xA8, 0x61, 0xEC, 0x00, 0x60, 0x34, 0x00,
+    0x00, 0x03, 0xD9, 0x75, 0xF3, 0xDF, 0xFB, 0x6A, 0x88, 0x6D, 0x09, 0xFF, 0x10, 0x71, 0xFF, 0x07,
+    0x91, 0x26, 0x0E, 0xFC, 0xFF, 0x5F, 0xE3, 0x9A, 0xF2, 0x0B, 0x6C, 0xEE, 0x77, 0xB0, 0x7B, 0x04,
+    0x7E, 0x83, 0xEC, 0xFD, 0x07, 0xF1, 0xC9, 0x01, 0x60, 0x04, 0x1A, 0x40, 0x13, 0x9E, 0x01, 0xD0,
+    0xCA, 0x00, 0x98, 0x7F, 0x80, 0xE9, 0x2B, 0x00, 0x16, 0x10, 0xBF, 0xFF, 0x33, 0x1B, 0x20, 0x9C,
+    0x03, 0xD2, 0xCB, 0x05, 0x67, 0x7F, 0xFD, 0x7F, 0x1E, 0xE6, 0x62, 0x90, 0x9F, 0xCE, 0x8B, 0xC1,
+    0x38, 0xA0, 0x64, 0x57, 0xC3, 0x04, 0xF5, 0x16, 0xA8, 0x7C, 0x3A, 0x0F, 0x75, 0xBA, 0xC1, 0x4B,
+    0x68, 0x66, 0x00, 0x83, 0x29, 0xFF, 0xFE, 0x23, 0xC2, 0xDB, 0x00, 0x98, 0x3F, 0xB8, 0xE1, 0x41,
+    0xFF, 0x13, 0x9A, 0x74, 0x20, 0xD1, 0x8B, 0x62, 0x3F, 0xD3, 0x17, 0x98, 0x13, 0x7E, 0xFD, 0x67,
+    0xF9, 0x04, 0x0B, 0xF9, 0x5F, 0xFF, 0x59, 0x1F, 0xC0, 0xD2, 0xC3, 0xDF, 0xFF, 0xCC, 0x0D, 0xD0,
+    0xB8, 0x0B, 0x00, 0xEA, 0x15, 0xF8, 0xFB, 0xDF, 0x16, 0xE2, 0x5C, 0x60, 0x42, 0x7A, 0x0C, 0x74,
+    0x99, 0x69, 0xC8, 0x8D, 0xFF, 0xA0, 0x70, 0x85, 0xE5, 0x1F, 0x50, 0x9E, 0x60, 0x28, 0xF8, 0x07,
+    0x2F, 0x3C, 0x81, 0x29, 0xE7, 0xE4, 0xBF, 0xF7, 0x73, 0x40, 0xCE, 0x04, 0x00, 0xFB, 0x8F, 0x00,
+    0xF2, 0xB8, 0xD8, 0xA0, 0x7C, 0xB3, 0xF8, 0xFF, 0x7E, 0x10, 0xC5, 0x8C, 0x16, 0x90, 0xA3, 0x6C,
+    0x22, 0xD9, 0x00, 0xFB, 0x04, 0xB3, 0xF1, 0xFB, 0x7F, 0xF6, 0x91, 0xC0, 0xFE, 0x08, 0x0B, 0x87,
+    0x1F, 0xFF, 0xD9, 0x3F, 0xC0, 0xC2, 0xEE, 0xE7, 0x7F, 0xB6, 0x07, 0xB0, 0x34, 0xF0, 0xF7, 0x3F,
+    0xF3, 0x02, 0x68, 0x42, 0x31, 0x00, 0x06, 0x9F, 0x03, 0x34, 0x30, 0x2F, 0x80, 0xE2, 0xE8, 0x37,
+    0xB8, 0x14, 0x52, 0xF8, 0xF3, 0x5F, 0x0E, 0x94, 0x30, 0xFF, 0xD7, 0x98, 0xA6, 0xFC, 0x26, 0x94,
+    0x7F, 0x6E, 0xFD, 0xBF, 0x5F, 0x0D, 0x62, 0x02, 0x00, 0x85, 0x94, 0xDB, 0x11, 0x82, 0x50, 0x0C,
+    0x44, 0x65, 0xC6, 0x42, 0xAC, 0x44, 0x4A, 0xB0, 0x14, 0x4B, 0xB0, 0x05, 0x3B, 0xB1, 0x04, 0x4A,
+    0x80, 0x0E, 0xA0, 0x04, 0x47, 0x47, 0x60, 0x78, 0xE9, 0x26, 0x9B, 0x0D, 0x9F, 0x7E, 0xDE, 0x99,
+    0x4B, 0xEE, 0xC9, 0xD9, 0x84, 0x77, 0x9A, 0x80, 0x50, 0x78, 0xB9, 0x1E, 0x34, 0x48, 0x0F, 0x94,
+    0xAC, 0xF2, 0xEB, 0x8B, 0x95, 0x2D, 0x42, 0x8A, 0xBD, 0xB9, 0xA8, 0xCA, 0x64, 0xEF, 0xF6, 0x02,
+    0x77, 0xEE, 0xC8, 0x0E, 0x5D, 0xD4, 0xFF, 0xF2, 0xDD, 0xD8, 0x67, 0x4F, 0xF3, 0x23, 0xFD, 0xCD,
+    0xD4, 0xFF, 0x72, 0x66, 0x6D, 0x49, 0xE3, 0x29, 0xC5, 0x7E, 0x82, 0xED, 0xE6, 0xE6, 0xCA, 0x30,
+    0xDC, 0x7A, 0x28, 0xD1, 0xE3, 0x6C, 0x45, 0x07, 0x65, 0xF1, 0x31, 0xC0, 0x45, 0xF0, 0x4F, 0x5C,
+    0x3A, 0x65, 0x63, 0x77, 0x14, 0xD0, 0xE2, 0xF1, 0x97, 0xD4, 0x28, 0x6B, 0x53, 0xAE, 0x59, 0x26,
+    0x1B, 0x66, 0xEC, 0xA8, 0x13, 0xF6, 0x7B, 0x4D, 0xB9, 0xE0, 0x38, 0xEF, 0xC3, 0x05, 0xC6, 0x56,
+    0x13, 0xE5, 0x6C, 0x5F, 0xC9, 0xA1, 0xAE, 0xD4, 0xCF, 0x2C, 0x8B, 0xFD, 0xD4, 0x25, 0x17, 0xA7,
+    0x31, 0xB8, 0x7E, 0x3D, 0x94, 0xE1, 0x71, 0x82, 0x40, 0x10, 0x85, 0x47, 0x33, 0x6A, 0x26, 0x33,
+    0x4A, 0x09, 0xD0, 0x09, 0x25, 0x48, 0x07, 0x58, 0x82, 0x1D, 0x68, 0x07, 0x49, 0x07, 0xD8, 0x81,
+    0xD7, 0x89, 0x25, 0x68, 0x07, 0x30, 0x4A, 0x10, 0x54, 0xB2, 0xD9, 0x77, 0x6F, 0xD7, 0x3F, 0x30,
+    0xCC, 0x71, 0xFB, 0xF6, 0xEE, 0x7D, 0x6F, 0x1F, 0x06, 0xA4, 0x79, 0x13, 0x24, 0xEF, 0x58, 0x27,
+    0x8B, 0xD9, 0xC0, 0xC6, 0xE4, 0xCA, 0xAE, 0xB6, 0x56, 0x57, 0x3F, 0x2F, 0xBC, 0x90, 0x60, 0x9A,
+    0xBA, 0xC5, 0xD2, 0xD2, 0xD0, 0x6F, 0x64, 0x72, 0x43, 0x5B, 0xB5, 0xDB, 0x94, 0xAC, 0x79, 0xF0,
+    0x87, 0xD3, 0x5F, 0xE9, 0xB7, 0x42, 0x77, 0xC6, 0xEA, 0x59, 0x39, 0xF9, 0x4F, 0x1C, 0x3C, 0x93,
+    0xF2, 0x5E, 0x47, 0x43, 0xCA, 0x98, 0x65, 0x88, 0xA7, 0x37, 0xAC, 0x04, 0x54, 0x8B, 0x68, 0x05,
+    0xB4, 0x31, 0x87, 0xE4, 0xF2, 0xFD, 0x58, 0x1C, 0xE0, 0xA0, 0x2D, 0xA7, 0x10, 0x9F, 0x16, 0x68,
+    0xB5, 0x63, 0x09, 0xA5, 0x74, 0xA8, 0x55, 0x78, 0x0D, 0x94, 0x26, 0x26, 0x38, 0xAA, 0xF4, 0x0B,
+    0xEF, 0x98, 0x1C, 0x6D, 0x2A, 0xC3, 0x7A, 0x7F, 0xD6, 0xFF, 0x8E, 0x64, 0x4B, 0xC9, 0x49, 0x50,
+    0x75, 0x52, 0x90, 0xC3, 0x5E, 0x3E, 0x02, 0x74, 0x1A, 0x99, 0xED, 0x89, 0x4E, 0x2B, 0x8B, 0x06,
+    0xBD, 0x1C, 0xE4, 0x8B, 0x03, 0x01, 0xB3, 0xA0, 0x45, 0xBF, 0x1B, 0x59, 0x71, 0x2C, 0x60, 0x52,
+    0xF4, 0xE7, 0x78, 0xEE, 0xFC, 0x46, 0x07, 0x7E, 0x24, 0x79, 0x31, 0x87, 0xBB, 0x8E, 0x76, 0x17,
+    0x92, 0x33, 0x4A, 0xC3, 0xB1, 0xAF, 0x8D, 0x9D, 0x8A, 0x77, 0xDD, 0xD6, 0x0F, 0x9B, 0x08, 0x23,
+    0xC7, 0x35, 0xEE, 0x7A, 0xE7, 0xD8, 0xB0, 0x60, 0x10, 0x27, 0xF1, 0x97, 0x21, 0x81, 0x67, 0x89,
+    0x13, 0x7B, 0x72, 0x3A, 0xDE, 0x90, 0x7F, 0x7B, 0xC1, 0x4F, 0xC7, 0x3B, 0xF7, 0x82, 0xA0, 0xE2,
+    0x1F, 0x85, 0x92, 0xCB, 0x0D, 0xC2, 0x30, 0x10, 0x44, 0x7D, 0xE1, 0x80, 0x14, 0x21, 0x2A, 0x80,
+    0x74, 0x44, 0x0B, 0x2E, 0x25, 0x9D, 0x90, 0x0E, 0x92, 0x12, 0x52, 0x02, 0x25, 0x84, 0x0A, 0x38,
+    0xC4, 0x04, 0xA2, 0x7C, 0x9C, 0x1D, 0xCF, 0xAE, 0x39, 0x72, 0xB4, 0xB4, 0x5E, 0x7B, 0xDE, 0xBC,
+    0xA0, 0xEB, 0x65, 0xA0, 0x91, 0x78, 0x2F, 0x1B, 0xB9, 0x22, 0xCC, 0x91, 0x43, 0x98, 0x7F, 0x33,
+    0x63, 0x97, 0xA2, 0xB4, 0xB4, 0x6C, 0x4C, 0xDC, 0xCA, 0x64, 0xD5, 0x59, 0x9F, 0xFF, 0x80, 0x6C,
+    0xAD, 0x16, 0x76, 0x68, 0x3C, 0x28, 0x1D, 0xD9, 0x73, 0x70, 0x9B, 0x01, 0xFC, 0xC6, 0x53, 0x65,
+    0x31, 0xE4, 0xED, 0xFB, 0x60, 0xFF, 0x40, 0xB1, 0xAB, 0xF5, 0x80, 0xCA, 0x59, 0xB7, 0xA3, 0x0C,
+    0x2A, 0x02, 0xEB, 0x34, 0x58, 0x24, 0x71, 0xC9, 0x87, 0x21, 0x66, 0xA0, 0x70, 0xFC, 0x87, 0x43,
+    0x18, 0xCD, 0x99, 0x83, 0x48, 0xF5, 0xCC, 0x46, 0x2C, 0xB1, 0xF0, 0x86, 0xDC, 0xE3, 0xC2, 0xA2,
+    0xCB, 0xFF, 0xF9, 0xC7, 0xAF, 0xF6, 0xAC, 0x9B, 0x30, 0x27, 0xCA, 0x55, 0x23, 0x1E, 0xE1, 0x39,
+    0xC2, 0x7C, 0xA8, 0x07, 0x02, 0xEE, 0x26, 0xA0, 0x54, 0x3A, 0xC0, 0xDC, 0x01, 0xFB, 0x06, 0x0F,
+    0x89, 0x7F, 0xFF, 0x39, 0x2F, 0xC0, 0x1C, 0x02, 0x4C, 0x6B, 0x8C, 0x70, 0x27, 0x3C, 0x00, 0xC5,
+    0x0F, 0x2C, 0x85, 0x7D, 0x07, 0xD9, 0xF7, 0x19, 0x1A, 0x60, 0xFF, 0x40, 0x26, 0x2D, 0x80, 0x15,
+    0x19, 0xF7, 0x11, 0x76, 0x3F, 0x80, 0x24, 0x88, 0x9F, 0xE0, 0xF0, 0xFC, 0x01, 0xF1, 0xD4, 0x47,
+    0x50, 0x28, 0x09, 0x40, 0xDD, 0x56, 0x00, 0x4A, 0x0B, 0x0D, 0xB0, 0x40, 0xFA, 0x07, 0x14, 0xFC,
+    0x08, 0x8B, 0x84, 0x6F, 0x40, 0xE5, 0x3F, 0x61, 0x7E, 0xB9, 0xF0, 0xDF, 0x5F, 0x00, 0xE6, 0x5B,
+    0x50, 0xD2, 0x98, 0x00, 0x4D, 0x2B, 0xE0, 0xD0, 0xFC, 0x0E, 0xF3, 0x3B, 0xC8, 0x45, 0xFF, 0x61,
+    0x51, 0x06, 0x72, 0x11, 0x34, 0xC0, 0xA1, 0xA1, 0xE1, 0x8F, 0x88, 0x8A, 0x9F, 0xB0, 0x18, 0x86,
+    0xD8, 0xC4, 0x39, 0x48, 0x38, 0x00, 0xFB, 0x00, 0xCB, 0x6D, 0xC0, 0x84, 0x83, 0x8B, 0x6D, 0x60,
+    0x0C, 0x01, 0x5F, 0xA1, 0xD1, 0x00, 0xF1, 0x0B, 0x37, 0x22, 0x5C, 0xA1, 0xCE, 0x01, 0xC7, 0x7D,
+    0x3C, 0x5C, 0x09, 0x3C, 0x51, 0x82, 0xD3, 0x1C, 0x92, 0x12, 0x7F, 0x24, 0x25, 0x9C, 0x30, 0x66,
+    0x03, 0x3C, 0xE5, 0x82, 0x22, 0xCE, 0x1E, 0xCE, 0xFE, 0x0B, 0xF3, 0x16, 0x72, 0xE2, 0x06, 0x05,
+    0x02, 0x5C, 0x09, 0x22, 0xD4, 0x41, 0x11, 0x74, 0x1E, 0xAE, 0xE4, 0x2B, 0x2C, 0x5A, 0xC1, 0x4A,
+    0x60, 0x7E, 0x06, 0x65, 0x72, 0xB8, 0x92, 0x6F, 0x88, 0x74, 0x00, 0x0C, 0x35, 0x56, 0x06, 0x06,
+    0xCC, 0xD8, 0xFB, 0xFE, 0x5F, 0x0E, 0x49, 0x09, 0x0B, 0x22, 0x05, 0xDD, 0x87, 0x86, 0x8A, 0x31,
+    0xE3, 0x67, 0x78, 0x58, 0xFD, 0xE7, 0xC0, 0xC5, 0x06, 0x00, 0x03, 0xC5, 0x0A, 0x1C, 0xDF, 0x17,
+    0x14, 0x04, 0xA5, 0x9F, 0x81, 0xC5, 0x4A, 0x42, 0xC8, 0x6E, 0x02, 0x00, 0x7B, 0x80, 0x48, 0x39,
+    0xFC, 0x30, 0xC1, 0x7C, 0xA8, 0xF4, 0xDF, 0xF3, 0x0C, 0xB0, 0xD8, 0x67, 0x82, 0x79, 0x1B, 0x6A,
+    0xC7, 0x06, 0x98, 0xB5, 0x01, 0x90, 0xA8, 0x07, 0x25, 0xE2, 0xF5, 0x70, 0x4F, 0x40, 0x5C, 0x07,
+    0x0C, 0x7F, 0x36, 0x58, 0x70, 0xF3, 0xC0, 0xA2, 0x40, 0x1F, 0x16, 0x24, 0xB0, 0xB8, 0xF8, 0x05,
+    0x73, 0xE2, 0x17, 0x58, 0xD6, 0x80, 0x3B, 0xA9, 0x01, 0x16, 0x4B, 0x0A, 0xD0, 0x14, 0x02, 0x8C,
+    0xE8, 0xFB, 0xF0, 0x32, 0x83, 0x19, 0xE6, 0x24, 0x4E, 0x58, 0xDC, 0x40, 0x9D, 0xE4, 0x00, 0x0D,
+    0x31, 0xA0, 0x93, 0xF6, 0xC3, 0xBD, 0xCC, 0x08, 0xCB, 0x84, 0xF0, 0x08, 0xE2, 0x85, 0x39, 0xC9,
+    0x1E, 0x16, 0x58, 0xB0, 0x58, 0xF8, 0xF5, 0x1F, 0xEE, 0x24, 0x56, 0x98, 0x07, 0xB8, 0x01, 0x03,
+    0xE5, 0x36, 0x18, 0x16, 0x14, 0xFC, 0xFB, 0x1F, 0x94, 0x28, 0x06, 0x12, 0x2B, 0x2A, 0xFD, 0xFB,
+    0x8F, 0xEC, 0x26, 0x00, 0x03, 0xA5, 0x3E, 0x7F, 0x06, 0xA4, 0x6C, 0x09, 0x32, 0x94, 0x11, 0x12,
+    0x01, 0x10, 0xCF, 0x7C, 0x83, 0x5A, 0xF1, 0x67, 0x3D, 0x38, 0x96, 0x0D, 0xFE, 0xEB, 0xFF, 0xDA,
+    0x0F, 0x0E, 0x0A, 0x9E, 0x2F, 0x20, 0x37, 0x7E, 0xFC, 0xCF, 0xF6, 0x00, 0x64, 0xF3, 0xF7, 0xFF,
+    0xC0, 0xE0, 0x03, 0x2A, 0xFC, 0x3B, 0x1F, 0xE8, 0xDF, 0x78, 0x60, 0x90, 0x01, 0xC3, 0xE4, 0xF7,
+    0x79, 0xA0, 0x32, 0x5E, 0x90, 0x57, 0x99, 0x3E, 0x82, 0x2C, 0x7D, 0xF0, 0x9F, 0xF3, 0x3B, 0xC8,
+    0xF0, 0x86, 0xFF, 0xFC, 0x00, 0xFB, 0x07, 0xCB, 0x6D, 0x7C, 0xD8, 0x58, 0x8A, 0x4A, 0x50, 0xC0,
+    0x08, 0x00, 0xFB, 0x06, 0xF2, 0x7B, 0x03, 0x38, 0x66, 0x7E, 0x81, 0xC4, 0x37, 0x80, 0x43, 0x06,
+    0x9C, 0xD8, 0x1F, 0xFE, 0x67, 0x03, 0x00, 0x03, 0x7A, 0xEE, 0xE6, 0xBF, 0x7B, 0x9E, 0x60, 0x1E,
+    0x38, 0x15, 0xE8, 0x80, 0x9D, 0x06, 0x8E, 0x22, 0x26, 0x50, 0x26, 0x8E, 0x16, 0x4C, 0xFA, 0x07,
+    0xD4, 0x7B, 0x00, 0x1C, 0x49, 0x0F, 0x81, 0x8E, 0x01, 0xA7, 0x63, 0xA0, 0x03, 0xE7, 0x33, 0x4C,
+    0x9A, 0xC9, 0x82, 0x92, 0x52, 0x19, 0xA0, 0xFE, 0x84, 0xB1, 0x02, 0x4F, 0x82, 0x4A, 0x89, 0xF3,
+    0xB0, 0x24, 0x05, 0x64, 0x09, 0x00, 0xAD, 0xD8, 0xBB, 0x6A, 0x17, 0x90, 0x75, 0xE0, 0xFF, 0x79,
+    0x16, 0x88, 0xBA, 0xAF, 0x90, 0x40, 0x07, 0xB2, 0x7E, 0x42, 0xDC, 0x0D, 0x64, 0x41, 0x42, 0x0A,
+    0x14, 0x6E, 0xBF, 0xC0, 0x81, 0xB5, 0x00, 0xC8, 0xFA, 0xFE, 0x5F, 0x16, 0x28, 0xF4, 0x0B, 0xC8,
+    0x02, 0xA6, 0xE3, 0xCC, 0xD4, 0x5F, 0xC0, 0x64, 0x0D, 0x0A, 0x26, 0x70, 0x31, 0x04, 0xCC, 0xA1,
+    0x4F, 0x41, 0x2C, 0x4E, 0x60, 0x8A, 0x66, 0x10, 0xD8, 0xF6, 0xEF, 0xBE, 0x06, 0xD0, 0x30, 0x76,
+    0x00, 0xFB, 0x04, 0xF3, 0x32, 0x03, 0x4D, 0x59, 0x01, 0xB7, 0xFE, 0xCF, 0x65, 0x01, 0xB1, 0xB4,
+    0x41, 0xD9, 0x7B, 0x3F, 0x23, 0x90, 0xF5, 0x16, 0x9C, 0x24, 0x64, 0x81, 0xAC, 0xFF, 0xFB, 0xCD,
+    0x80, 0xE9, 0x73, 0x3F, 0x88, 0xC5, 0x02, 0xF6, 0x3A, 0xEB, 0x27, 0x48, 0x82, 0xFA, 0xFE, 0x9F,
+    0xE7, 0x13, 0x24, 0xE8, 0x1F, 0xFC, 0x97, 0x87, 0xB2, 0x26, 0xFC, 0x8F, 0x87, 0x9A, 0x1C, 0xF0,
+    0xBF, 0x1F, 0xCA, 0x32, 0xF8, 0x3F, 0x1F, 0xCA, 0x02, 0x96, 0x2D, 0x18, 0x2C, 0x84, 0x2C, 0x58,
+    0x07, 0xD4, 0x14, 0x7F, 0x64, 0x93, 0xF3, 0x21, 0xB6, 0x71, 0x7F, 0x02, 0x17, 0x2E, 0x40, 0x17,
+    0xB0, 0x00, 0x59, 0xE7, 0xDD, 0x52, 0x20, 0xAE, 0x7A, 0x0D, 0x77, 0xA9, 0xFA, 0x1F, 0x48, 0xD6,
+    0xF8, 0xF4, 0x9F, 0x0D, 0xE8, 0xA3, 0xB5, 0x40, 0xD7, 0x02, 0x00, 0x03, 0x92, 0x45, 0x6F, 0xFE,
+    0xAF, 0x05, 0xBB, 0x68, 0x22, 0x38, 0x5E, 0x81, 0xF6, 0x0A, 0xFC, 0x85, 0x65, 0xC0, 0x0B, 0xFF,
+    0xDF, 0x5B, 0x18, 0x5D, 0x03, 0xD9, 0xF7, 0xE3, 0xBF, 0x0C, 0x38, 0x06, 0xB8, 0x05, 0x20, 0xB6,
+    0x03, 0x13, 0x70, 0x01, 0x24, 0xE2, 0x02, 0xFE, 0xE7, 0x6F, 0x80, 0x84, 0xA0, 0xC0, 0xFF, 0xFE,
+    0x07, 0x30, 0xF7, 0x40, 0xF3, 0x04, 0x24, 0xB0, 0xB8, 0x31, 0x58, 0x08, 0x59, 0x84, 0x8E, 0x0D,
+    0xF0, 0x58, 0x81, 0x9A, 0x0C, 0x34, 0x0F, 0x6A, 0x5B, 0x03, 0x30, 0x85, 0x41, 0x5C, 0xF0, 0x0D,
+    0xE8, 0x11, 0x90, 0xAB, 0x94, 0x8E, 0x82, 0xBC, 0x09, 0x75, 0xA9, 0x3F, 0xB2, 0xEB, 0x19, 0x18,
+    0x9A, 0xDE, 0xBC, 0x9F, 0x0B, 0x0C, 0x02, 0x00, 0x83, 0x07, 0xC1, 0x7E, 0x9A, 0xB2, 0xF0, 0x94,
+    0x0F, 0xC0, 0x28, 0xFE, 0x1F, 0xE9, 0x0C, 0x2E, 0x55, 0x7E, 0xFE, 0xD7, 0x23, 0x98, 0x1F, 0x81,
+    0xAC, 0x0B, 0x90, 0xE8, 0x00, 0xB2, 0x3E, 0x40, 0x7C, 0x05, 0x66, 0xF1, 0x60, 0x61, 0xF1, 0x62,
+    0xE8, 0x40, 0x98, 0x02, 0x35, 0xD9, 0x00, 0x68, 0x2F, 0xC4, 0xB6, 0x03, 0x78, 0xCB, 0xBA, 0xF3,
+    0x20, 0xD7, 0x1F, 0x02, 0xB1, 0xB8, 0xFE, 0x81, 0x7C, 0xB4, 0xF4, 0xDF, 0x3D, 0x4B, 0x60, 0xA1,
+    0x00, 0x00, 0x03, 0x25, 0xB0, 0xD7, 0xEF, 0xE7, 0x82, 0x5D, 0x54, 0x00, 0xCA, 0xD4, 0xE7, 0x99,
+    0xC0, 0x01, 0x0D, 0x02, 0x7A, 0x60, 0x1B, 0x2C, 0x8C, 0xAE, 0x81, 0x12, 0xD5, 0x57, 0x70, 0x29,
+    0xF0, 0x1B, 0x68, 0xC9, 0x5F, 0xB0, 0xD3, 0x80, 0x91, 0x1D, 0x00, 0x71, 0x77, 0xC3, 0x7F, 0x7B,
+    0x68, 0x5E, 0x31, 0xF8, 0x5F, 0xFF, 0xE0, 0xBF, 0xBC, 0x20, 0x10, 0x28, 0xFE, 0x9F, 0xFF, 0x01,
+    0x96, 0x8F, 0xD7, 0xC3, 0x59, 0xFB, 0x3F, 0xC2, 0x59, 0x1F, 0x60, 0x3E, 0x05, 0x46, 0x34, 0x1F,
+    0x3C, 0x1C, 0xA0, 0xF1, 0x00, 0xF4, 0xCC, 0x7C, 0x78, 0xD8, 0x41, 0x42, 0xEB, 0x18, 0x23, 0xD0,
+    0xDD, 0xFE, 0x60, 0x29, 0x3D, 0xA0, 0xC2, 0xFF, 0xD1, 0x42, 0xC9, 0x7F, 0x81, 0x46, 0x08, 0x40,
+    0x4A, 0x8B, 0xFB, 0x8C, 0xB0, 0x74, 0xCB, 0x09, 0xCD, 0x32, 0xE7, 0xC4, 0x19, 0x18, 0x00, 0x03,
+    0xF9, 0xEE, 0xD6, 0xFF, 0x5A, 0xA0, 0x23, 0x7F, 0xFD, 0x07, 0x39, 0x03, 0x94, 0xC5, 0xFA, 0x41,
+    0xA1, 0x48, 0x28, 0xDF, 0xA2, 0x50, 0x90, 0x3C, 0xCB, 0x02, 0xA5, 0x5E, 0x01, 0x0B, 0x87, 0x77,
+    0xEF, 0x98, 0xB1, 0xAA, 0xA4, 0x37, 0x05, 0x00, 0x83, 0xE6, 0x5D, 0x86, 0x3F, 0xB0, 0xBC, 0xCB,
+    0xF5, 0x17, 0x96, 0x77, 0xCF, 0x03, 0xE3, 0xEB, 0x21, 0x30, 0xC7, 0x3B, 0x83, 0x73, 0xFC, 0xCF,
+    0xFF, 0x7A, 0x28, 0x79, 0x65, 0x01, 0x96, 0xBC, 0x02, 0x4C, 0xB4, 0x17, 0x20, 0x41, 0x05, 0x64,
+    0x41, 0x6D, 0x04, 0xB2, 0x20, 0xB9, 0x03, 0x95, 0x85, 0x90, 0x45, 0xE8, 0x40, 0x98, 0x82, 0x30,
+    0x99, 0x01, 0x9E, 0x33, 0x09, 0x94, 0x43, 0x0C, 0x87, 0x60, 0x25, 0x0F, 0xD0, 0x47, 0xFF, 0xEE,
+    0x59, 0x22, 0x32, 0x90, 0x02, 0x3C, 0x2E, 0x0C, 0xE0, 0x01, 0xDD, 0x00, 0xCA, 0x3F, 0x5C, 0x90,
+    0x04, 0x26, 0xCF, 0xF0, 0x75, 0x3F, 0x30, 0x3C, 0x05, 0x40, 0x99, 0xE8, 0xE7, 0xFF, 0xF9, 0x2A,
+    0x4E, 0x2F, 0xFE, 0xDF, 0x67, 0x04, 0xFA, 0x0F, 0x0C, 0xEC, 0x80, 0x4A, 0xAE, 0x82, 0xD3, 0x2E,
+    0x38, 0xC8, 0xA7, 0xFC, 0x79, 0x3F, 0x07, 0x18, 0xB8, 0x00, 0xFB, 0x08, 0xF3, 0x32, 0x03, 0x4D,
+    0x59, 0x0A, 0x27, 0xFE, 0xED, 0x63, 0x03, 0xB3, 0x40, 0xB1, 0x7F, 0x9F, 0x09, 0xC8, 0xDA, 0x0D,
+    0x4E, 0x12, 0x84, 0xD2, 0x27, 0x34, 0x67, 0xE3, 0xCD, 0xE3, 0x03, 0xC9, 0x02, 0x00, 0x63, 0x70,
+    0x06, 0x9A, 0xC2, 0xFB, 0xE1, 0x7F, 0xFC, 0x87, 0xFF, 0xFE, 0x01, 0xFF, 0x38, 0x91, 0x42, 0x05,
+    0xE8, 0x2C, 0x7E, 0x0A, 0x11, 0x00, 0x03, 0x92, 0x26, 0xE0, 0x00, 0xE1, 0x04, 0xB9, 0x88, 0x1F,
+    0x64, 0x3A, 0x90, 0x98, 0xF0, 0x9E, 0x95, 0x01, 0x2B, 0xF8, 0x00, 0x32, 0x66, 0x40, 0x08, 0x1E,
+    0x50, 0xA0, 0x73, 0x83, 0x1C, 0xC9, 0xE5, 0x94, 0xFC, 0xEF, 0x3F, 0xEB, 0x57, 0x60, 0x28, 0x00,
+    0x39, 0xFF, 0xED, 0x80, 0x45, 0x4E, 0x2F, 0x13, 0x03, 0x00, 0xFB, 0x08, 0xF3, 0x32, 0x03, 0xAD,
+    0x59, 0x07, 0x80, 0xA1, 0x00, 0x61, 0xFD, 0x01, 0xFA, 0x12, 0xCC, 0xDA, 0xF0, 0xFF, 0x3E, 0x23,
+    0x84, 0xF5, 0xFB, 0xBF, 0x2C, 0x44, 0xDD, 0x82, 0xFF, 0xEF, 0x99, 0x20, 0xAC, 0x9F, 0xFF, 0xF5,
+    0x20, 0x7A, 0x27, 0x40, 0xFC, 0x03, 0x64, 0x7D, 0x87, 0x04, 0xF4, 0xC7, 0xFF, 0xD1, 0x90, 0xC8,
+    0x07, 0xB2, 0xFE, 0x81, 0xB3, 0x30, 0x88, 0x05, 0x04, 0x9C, 0x70, 0x56, 0x3C, 0x94, 0x95, 0x06,
+    0x09, 0xC7, 0x8F, 0xC0, 0x24, 0xF6, 0x0B, 0x1C, 0x02, 0xA0, 0x92, 0xE2, 0x02, 0x38, 0xBC, 0x41,
+    0x76, 0x00, 0x83, 0x8A, 0x15, 0xEA, 0x3E, 0x70, 0x7E, 0x01, 0xB3, 0xC0, 0x79, 0x08, 0xE2, 0xD2,
+    0xBF, 0xC0, 0x20, 0x87, 0xB0, 0x40, 0x49, 0x10, 0xC2, 0x02, 0x45, 0x0D, 0xD4, 0x6F, 0x3F, 0xFF,
+    0xF3, 0x02, 0x00, 0xFB, 0xF3, 0x9F, 0x81, 0xA6, 0x08, 0x00, 0xFB, 0xF4, 0x9F, 0xDD, 0xE1, 0xE6,
+    0xFF, 0x75, 0x40, 0xEF, 0x16, 0xBE, 0x79, 0x3F, 0x87, 0x09, 0x18, 0xD4, 0x1A, 0x7F, 0xC0, 0xB1,
+    0x0B, 0x2E, 0x02, 0xFA, 0x81, 0xFC, 0xD7, 0xE0, 0xA8, 0xE3, 0x85, 0xA4, 0x3A, 0x8E, 0x4F, 0xFF,
+    0xFF, 0xCF, 0x37, 0x4D, 0xF9, 0x03, 0xCC, 0xD8, 0xFD, 0x26, 0x25, 0xFF, 0xFE, 0xEB, 0x7F, 0xFA,
+    0x7F, 0x9F, 0x09, 0xEC, 0x90, 0xFB, 0x8C, 0x20, 0x8F, 0xF4, 0x7F, 0x82, 0x84, 0xE5, 0x3F, 0x30,
+    0x05, 0x36, 0x9F, 0x1F, 0x12, 0x73, 0xBC, 0x10, 0xF7, 0x7C, 0x82, 0xE5, 0x54, 0x2E, 0x48, 0x02,
+    0xFC, 0x04, 0x09, 0xF2, 0xEF, 0x90, 0x80, 0x03, 0xF1, 0xB9, 0x90, 0xC2, 0x68, 0xE8, 0xF3, 0x01,
+    0xFB, 0xF8, 0x9F, 0x43, 0xE1, 0xC4, 0xBF, 0x7D, 0x6C, 0x20, 0x2F, 0x71, 0x80, 0x62, 0xE6, 0x3E,
+    0x13, 0x90, 0xB5, 0x0B, 0x1C, 0x5D, 0x84, 0xD2, 0x0E, 0x34, 0xD7, 0xE1, 0xCD, 0x7F, 0x03, 0xC9,
+    0x02, 0x00, 0x43, 0x4A, 0x60, 0xB0, 0x6C, 0xCF, 0xC6, 0x80, 0x52, 0x18, 0x00, 0x33, 0x9D, 0x97,
+    0xD2, 0x52, 0x70, 0x11, 0xF1, 0xED, 0xBF, 0x1D, 0xD8, 0x7E, 0x60, 0x6C, 0xFC, 0x03, 0xDB, 0xE1,
+    0x00, 0xB4, 0x00, 0x9A, 0x63, 0x80, 0x3A, 0x58, 0x61, 0x59, 0xE6, 0xCB, 0x7F, 0x2E, 0x68, 0x5A,
+    0x00, 0x46, 0x23, 0xDF, 0x07, 0xA8, 0xA7, 0x2E, 0xFC, 0xE7, 0xFF, 0x08, 0x0D, 0xE0, 0x03, 0xFF,
+    0xE5, 0x91, 0x98, 0x48, 0x0A, 0x90, 0xB4, 0x21, 0x19, 0x06, 0xB3, 0xE2, 0x17, 0x30, 0x5A, 0x10,
+    0x16, 0x43, 0x9D, 0xF3, 0x19, 0xE4, 0x1C, 0xB0, 0x23, 0xF1, 0x95, 0x63, 0x08, 0x6F, 0x02, 0x00,
+    0xFB, 0xF4, 0x9F, 0x2D, 0xE0, 0xD6, 0xFF, 0xB9, 0x2C, 0xA0, 0x40, 0x36, 0x07, 0x25, 0x83, 0xFD,
+    0x8C, 0x40, 0x16, 0x24, 0x0F, 0xCA, 0x02, 0x59, 0xFF, 0xD7, 0x9B, 0xA6, 0xFC, 0x01, 0x46, 0xDC,
+    0xA7, 0xFF, 0xF7, 0x99, 0xC0, 0x61, 0xCF, 0xFA, 0x09, 0x96, 0xEB, 0xB8, 0x3F, 0x41, 0x82, 0xE5,
+    0xE3, 0x7F, 0xF9, 0x4F, 0x10, 0x77, 0x2F, 0xF8, 0xEF, 0xFF, 0x09, 0x12, 0x84, 0x09, 0xFF, 0xEB,
+    0xA1, 0x2C, 0x60, 0x72, 0x86, 0xB2, 0x0C, 0xFE, 0xCF, 0xC7, 0x60, 0x21, 0x64, 0x11, 0x3A, 0xC0,
+    0xA6, 0x20, 0x4C, 0x96, 0x87, 0xD8, 0xC6, 0x05, 0x74, 0x01, 0x23, 0x38, 0x17, 0xB0, 0x00, 0x5D,
+    0xD5, 0xA7, 0x12, 0xF4, 0x1B, 0x18, 0xC4, 0x9F, 0xA0, 0x79, 0x99, 0x07, 0xC8, 0xF2, 0xFE, 0x07,
+    0x49, 0xB6, 0x40, 0x53, 0x12, 0x5E, 0x43, 0x7D, 0x04, 0x8D, 0x4E, 0xAA, 0xB3, 0x00, 0x83, 0xE6,
+    0x5D, 0x86, 0xBF, 0xEB, 0xA1, 0x79, 0x57, 0xFA, 0xDF, 0x7A, 0x50, 0xD8, 0x82, 0x73, 0xF7, 0x7A,
+    0x50, 0x92, 0xF1, 0x54, 0xDA, 0x0A, 0x2A, 0x15, 0x7E, 0xFD, 0xD7, 0x03, 0x3B, 0x7A, 0xBD, 0x00,
+    0xC4, 0xF8, 0x86, 0xFF, 0xEB, 0x0B, 0x60, 0x79, 0x65, 0xFD, 0x06, 0x48, 0x08, 0x00, 0x59, 0x0F,
+    0x20, 0x41, 0x05, 0x64, 0x7D, 0x80, 0xD8, 0x08, 0x66, 0xF1, 0x60, 0x61, 0xF1, 0x62, 0xE8, 0x58,
+    0x00, 0x37, 0x05, 0x9E, 0x0B, 0xD7, 0x43, 0x73, 0xE6, 0x04, 0xA0, 0x0B, 0x7E, 0x82, 0xCB, 0xA1,
+    0x6F, 0x40, 0xD6, 0xC3, 0xFF, 0xFF, 0x2D, 0x8C, 0xC0, 0xAE, 0x32, 0x80, 0x66, 0x66, 0x98, 0xEB,
+    0xAD, 0xC1, 0xE1, 0xBE, 0xF5, 0xDF, 0x7D, 0x4F, 0x05, 0x78, 0x0C, 0xD0, 0x80, 0x05, 0x00, 0xFB,
     0xF8, 0x9F, 0xB3, 0xF1, 0x6F, 0xFF, 0xC7, 0xFF, 0x56, 0xFF, 0xFE, 0xCF, 0xFF, 0xF8, 0xFF, 0xCD,
-    0x7F, 0x10, 0xF9, 0xFF, 0xFF, 0x9A, 0x2A, 0x20, 0x29, 0xC9, 0xC0, 0xF0, 0xF1, 0x7F, 0x3D, 0x03,
-    0x88, 0xE4, 0x47, 0x22, 0xF9, 0xC0, 0x24, 0x37, 0x15, 0x49, 0x00, 0x91, 0xC4, 0x38, 0x8C, 0x78,
-    0x9C, 0x25, 0x8E, 0x31, 0x0E, 0x01, 0x51, 0x10, 0x86, 0x67, 0x9F, 0x15, 0xAB, 0x91, 0xD7, 0x69,
-    0x25, 0xD4, 0x22, 0x2E, 0xE0, 0x15, 0x4E, 0xE0, 0x02, 0xD4, 0x14, 0xAE, 0xE0, 0x00, 0x42, 0x9C,
-    0x60, 0x8F, 0x40, 0xB7, 0x25, 0x1D, 0x9D, 0x38, 0xC1, 0x2B, 0xB7, 0xF3, 0x14, 0x12, 0x36, 0x36,
-    0xFB, 0x9B, 0x99, 0xFD, 0x92, 0x49, 0xBE, 0xE2, 0x9F, 0xF9, 0x87, 0xC8, 0x66, 0x95, 0x5F, 0x45,
-    0xC4, 0x7C, 0xC1, 0xAC, 0x59, 0x4E, 0x50, 0x12, 0xA2, 0x0F, 0xF6, 0xFD, 0x59, 0x89, 0x39, 0x11,
-    0x60, 0x88, 0x36, 0xF0, 0x34, 0xC2, 0x51, 0xC2, 0x25, 0x8C, 0x43, 0x2A, 0x96, 0x3F, 0x63, 0x8B,
-    0xA0, 0x17, 0x98, 0x1F, 0x76, 0xA6, 0xB6, 0x07, 0x10, 0x96, 0xEA, 0xB6, 0xE0, 0x6B, 0xBE, 0xAB,
-    0x7A, 0x65, 0x0D, 0x4D, 0x0D, 0xB8, 0xAC, 0xAE, 0x13, 0x0E, 0x40, 0xE4, 0xA6, 0x0D, 0xD1, 0x02,
-    0xAD, 0x17, 0x3A, 0x62, 0x6F, 0xB4, 0x2F, 0x98, 0xD4, 0x96, 0x2C, 0xE0, 0x8D, 0xF6, 0xC6, 0x3C,
-    0xE9, 0x60, 0x9C, 0xE3, 0xAE, 0x1D, 0xC2, 0x50, 0xD7, 0x98, 0xB3, 0xBC, 0xD1, 0xBB, 0x55, 0x61,
-    0xCB, 0xD9, 0x3F, 0xD5, 0x01, 0x5D, 0x42, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xF3, 0x9F, 0x01, 0x04,
-    0x08, 0x52, 0x7F, 0xFF, 0x83, 0x00, 0x33, 0x94, 0x7A, 0xFD, 0xEE, 0xFF, 0xFF, 0xF7, 0xEF, 0x98,
-    0x88, 0xD0, 0x47, 0x3E, 0xF5, 0xFB, 0x3F, 0x23, 0x88, 0xFA, 0xF5, 0x9F, 0x05, 0x44, 0x7D, 0xFB,
-    0x9F, 0x17, 0x02, 0xB4, 0xEF, 0x23, 0xD0, 0x76, 0x20, 0x3F, 0x01, 0x42, 0x31, 0x6C, 0xF9, 0x77,
-    0x9E, 0x09, 0x00, 0x51, 0x0D, 0x47, 0xD5, 0x78, 0x9C, 0xFB, 0xFC, 0x9F, 0x93, 0x01, 0x08, 0x7E,
-    0xFC, 0x67, 0xF9, 0x3C, 0x40, 0xAC, 0x4F, 0x48, 0x2C, 0x2E, 0x10, 0xEB, 0xF7, 0x7F, 0x96, 0x8F,
-    0xFF, 0x79, 0x40, 0xAC, 0xFF, 0xFF, 0x59, 0x1E, 0xFC, 0x97, 0x07, 0x32, 0x14, 0x80, 0xAC, 0x0D,
-    0xFF, 0xD7, 0x03, 0x59, 0x8F, 0x81, 0x2C, 0x87, 0xFF, 0xFF, 0x73, 0x5C, 0x96, 0xFD, 0x07, 0xB2,
-    0x18, 0x7E, 0xFD, 0x07, 0x81, 0xBF, 0x40, 0xD6, 0x02, 0x10, 0x23, 0xEE, 0x1B, 0x90, 0xC5, 0xB0,
-    0xE4, 0xEF, 0xFB, 0x6C, 0xC6, 0xAF, 0xFF, 0x59, 0x00, 0xFA, 0xD2, 0x63, 0x3F, 0x78, 0x9C, 0x25,
-    0x8E, 0xD1, 0x0D, 0x82, 0x40, 0x10, 0x44, 0x07, 0xA3, 0x68, 0x50, 0x93, 0xEB, 0x80, 0x16, 0xE8,
-    0xC0, 0x16, 0x2C, 0xE1, 0x3A, 0x38, 0x4B, 0xA1, 0x03, 0x5A, 0xA0, 0x03, 0xE9, 0xE0, 0x5A, 0xA0,
-    0x03, 0x84, 0x88, 0x26, 0x08, 0x19, 0x6F, 0xEE, 0xE6, 0x63, 0xF7, 0x7D, 0xEC, 0xCC, 0xEC, 0xC4,
-    0x33, 0x82, 0x1E, 0x74, 0x1D, 0x4B, 0x51, 0x58, 0x96, 0x4E, 0x34, 0xB2, 0x30, 0x7C, 0x8A, 0xBE,
-    0xDC, 0x63, 0x61, 0x16, 0x68, 0x1D, 0x80, 0x99, 0x39, 0x60, 0xD8, 0x00, 0xBD, 0xCC, 0x96, 0x37,
-    0xA0, 0x96, 0xB9, 0xE5, 0x15, 0xA8, 0x64, 0x1E, 0x79, 0x0C, 0xC7, 0x9B, 0x07, 0x3E, 0xDC, 0xC5,
-    0x80, 0x0C, 0x3F, 0xAF, 0xA8, 0x89, 0xB9, 0x49, 0xF1, 0x1D, 0x2F, 0xF7, 0x54, 0x69, 0x59, 0xB6,
-    0x2C, 0x44, 0xA0, 0x7B, 0xF1, 0x10, 0x69, 0xF1, 0xF3, 0x10, 0x01, 0x6F, 0xAE, 0x4D, 0xA2, 0x9E,
-    0xEA, 0x92, 0x6A, 0xAA, 0x4B, 0xAA, 0xC8, 0x53, 0x22, 0x6C, 0xB1, 0x2B, 0x3D, 0xAC, 0xF9, 0x07,
-    0x2F, 0x26, 0x49, 0x23, 0x78, 0x9C, 0x25, 0x8F, 0xC1, 0x59, 0xC2, 0x50, 0x10, 0x84, 0x37, 0x08,
-    0xA8, 0x7C, 0x62, 0xEC, 0x40, 0x3A, 0xA0, 0x04, 0xED, 0x40, 0x8F, 0xDE, 0x48, 0x07, 0xDA, 0x01,
-    0x25, 0x60, 0x07, 0xA6, 0x00, 0x0F, 0x76, 0x10, 0x3B, 0x80, 0x0E, 0x48, 0x07, 0x10, 0x85, 0xA8,
-    0x04, 0xF8, 0x9D, 0x21, 0x7B, 0xD8, 0x37, 0xF3, 0xED, 0xBE, 0x9D, 0x99, 0x35, 0x57, 0xA1, 0xE2,
-    0xD9, 0x7D, 0x4B, 0x3F, 0xE7, 0x56, 0xE0, 0x9E, 0xC2, 0xFC, 0x8F, 0x4E, 0xC6, 0x44, 0xE0, 0x15,
-    0x12, 0x3D, 0x87, 0x65, 0xDC, 0xF0, 0x26, 0x50, 0x42, 0x2F, 0x84, 0x67, 0x11, 0xFB, 0xA5, 0xF8,
-    0x37, 0x0C, 0x22, 0x1E, 0x79, 0x88, 0xF8, 0xA5, 0xA3, 0xB6, 0x22, 0xF5, 0xAF, 0xD4, 0xA3, 0xBE,
-    0x3E, 0x4E, 0x8E, 0x1A, 0x2D, 0xBC, 0x54, 0xAA, 0x8D, 0x48, 0x77, 0x3A, 0x53, 0x79, 0x94, 0x73,
-    0x1D, 0x2F, 0x0C, 0x36, 0x2B, 0xCB, 0x27, 0x3E, 0x72, 0x17, 0x9F, 0xF4, 0xD6, 0x9C, 0xC5, 0x6E,
-    0x1E, 0x16, 0x99, 0x6A, 0x31, 0xC9, 0xB9, 0x88, 0xE3, 0xCC, 0xA6, 0xF6, 0x45, 0xD4, 0x85, 0xD6,
-    0x86, 0x23, 0x6D, 0xAA, 0x7E, 0x88, 0x46, 0xEE, 0x19, 0x67, 0xBA, 0xA4, 0xFA, 0xA2, 0xEB, 0x0C,
-    0xCD, 0x34, 0xB7, 0x9C, 0x55, 0x9F, 0x9C, 0x71, 0x3B, 0x2F, 0xED, 0xD9, 0xAE, 0xDE, 0x39, 0xB7,
-    0xF8, 0x06, 0x53, 0x65, 0xC5, 0x96, 0x3F, 0x38, 0x9C, 0x32, 0xEB, 0x12, 0x8E, 0x94, 0x21, 0xE1,
-    0x53, 0x35, 0x8E, 0x29, 0x1F, 0x8C, 0x5B, 0x5E, 0xB7, 0xBA, 0x0D, 0xC3, 0x96, 0x57, 0xAD, 0x6E,
-    0xCD, 0x65, 0xCB, 0x17, 0x2D, 0xA8, 0xE8, 0xAA, 0xFF, 0x03, 0x20, 0x5F, 0x83, 0xD6, 0x78, 0x9C,
-    0x2D, 0xCE, 0xD1, 0x0D, 0xC2, 0x30, 0x0C, 0x04, 0xD0, 0xAB, 0xAA, 0xFE, 0xA0, 0x06, 0x31, 0x42,
-    0x46, 0x61, 0x03, 0x46, 0x60, 0x04, 0x46, 0x80, 0x0D, 0xE8, 0x06, 0xED, 0x28, 0xD9, 0x00, 0x36,
-    0x89, 0x50, 0x11, 0x41, 0x42, 0xED, 0xE1, 0x8B, 0x9B, 0xAF, 0x93, 0x9E, 0x7D, 0xCE, 0xC0, 0x07,
-    0xEC, 0xBD, 0x78, 0xC6, 0xC2, 0xCE, 0xD2, 0x8F, 0x3B, 0xCC, 0xDC, 0x03, 0x47, 0xE6, 0x06, 0x03,
-    0x47, 0xE0, 0x69, 0x08, 0xE3, 0x16, 0x5F, 0x43, 0xE0, 0xCD, 0x3E, 0x0A, 0x61, 0x7C, 0x49, 0x15,
-    0x8D, 0x73, 0xA9, 0x28, 0x76, 0x14, 0x6F, 0x08, 0xAC, 0x1B, 0x22, 0x92, 0xC1, 0x53, 0x22, 0xEF,
-    0x9E, 0x0A, 0x69, 0xE5, 0x15, 0xF3, 0xEC, 0x9C, 0x78, 0xBA, 0x39, 0xAB, 0x56, 0xB7, 0xB5, 0xD9,
-    0x58, 0x79, 0x10, 0x5E, 0x81, 0x49, 0x5C, 0xD8, 0x03, 0x87, 0x95, 0x6D, 0xF4, 0x86, 0x0F, 0x43,
-    0xD2, 0x97, 0x35, 0x33, 0xFE, 0x01, 0xB2, 0x74, 0x55, 0x3D, 0x78, 0x9C, 0x2D, 0xCF, 0xC1, 0x11,
-    0x82, 0x30, 0x10, 0x85, 0xE1, 0x45, 0x1D, 0x74, 0x14, 0x95, 0x0E, 0xB4, 0x03, 0xEC, 0x40, 0x3A,
-    0xD1, 0x8B, 0x67, 0xE9, 0x80, 0x16, 0xEC, 0x40, 0x4A, 0xB0, 0x03, 0x4B, 0x80, 0x12, 0x3C, 0x7A,
-    0x13, 0x65, 0x50, 0x54, 0xE4, 0x97, 0x25, 0xC9, 0x21, 0xF9, 0x32, 0xF3, 0xDE, 0x66, 0x52, 0xE2,
-    0x49, 0xBB, 0x32, 0x82, 0x9C, 0x85, 0xEA, 0xC1, 0x34, 0x61, 0xAF, 0x7A, 0x31, 0x0C, 0x49, 0x55,
-    0x35, 0x3D, 0x69, 0x70, 0x44, 0x7C, 0xBD, 0x57, 0x0C, 0x45, 0xB6, 0x9A, 0x29, 0xB4, 0x7C, 0xD2,
-    0x5E, 0xA6, 0xDB, 0x9D, 0x89, 0x48, 0x44, 0x2C, 0x52, 0xE2, 0xDA, 0xF0, 0x47, 0x6B, 0xF2, 0x6D,
-    0x07, 0x70, 0xD6, 0x51, 0x4F, 0x1D, 0xBA, 0x51, 0xE5, 0x78, 0x07, 0xE6, 0xAA, 0x84, 0xE0, 0xC2,
-    0x58, 0x15, 0x12, 0x17, 0x0C, 0x54, 0xD2, 0xA4, 0xD5, 0xAD, 0x83, 0xBC, 0xE1, 0x68, 0x54, 0xC0,
-    0xDA, 0x28, 0x83, 0x99, 0x51, 0x04, 0x23, 0xA3, 0x25, 0xF4, 0x8D, 0x04, 0x5B, 0x6D, 0x15, 0x5B,
-    0xAC, 0x08, 0xAC, 0x12, 0xF3, 0xE5, 0xEE, 0xAF, 0xAE, 0x55, 0x4D, 0x77, 0xF8, 0xBB, 0xAB, 0x2D,
-    0x84, 0x60, 0x63, 0xAD, 0x52, 0xC7, 0x3C, 0xF0, 0x4B, 0x6D, 0xFE, 0x0F, 0xAA, 0xE6, 0x61, 0x0E,
-    0x78, 0x9C, 0xFB, 0xF0, 0x1F, 0x02, 0xEE, 0x33, 0x7C, 0xC0, 0x60, 0x9D, 0x67, 0x50, 0x50, 0x02,
-    0x81, 0x6F, 0xFF, 0xED, 0x19, 0xC0, 0x40, 0xE0, 0xDF, 0x7F, 0x76, 0x08, 0xEB, 0xC0, 0xFF, 0xF5,
-    0x10, 0x06, 0xC3, 0x8F, 0xFF, 0xB2, 0x10, 0x86, 0xC3, 0xFF, 0xFF, 0xCC, 0x10, 0xD6, 0xC3, 0xFF,
-    0xF9, 0x50, 0xC9, 0x3F, 0xFF, 0xB9, 0x20, 0x8C, 0x09, 0x40, 0x63, 0x21, 0xE0, 0xEB, 0x7F, 0x7D,
-    0x08, 0x43, 0xE1, 0xFF, 0x7F, 0x56, 0x98, 0x61, 0xF3, 0xA1, 0x92, 0x3F, 0xFF, 0xF3, 0x40, 0x18,
-    0x01, 0xFF, 0xFF, 0x33, 0x41, 0x58, 0x9F, 0xFE, 0xC7, 0x43, 0x25, 0xFF, 0xFE, 0xE7, 0x80, 0x30,
-    0x16, 0xFC, 0x7F, 0x0F, 0x76, 0x97, 0x12, 0x50, 0x12, 0x0A, 0xD8, 0xB0, 0xB1, 0x00, 0xEB, 0x3F,
-    0x5A, 0x56, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x10, 0xB8, 0xCE, 0x04, 0x24, 0x19, 0xBE, 0xFF,
-    0x67, 0x07, 0x92, 0x13, 0xFE, 0xBF, 0x67, 0x05, 0x73, 0xB8, 0x80, 0xA4, 0xC2, 0xFF, 0xF3, 0x0C,
-    0x60, 0x31, 0x7F, 0x10, 0xF5, 0xE0, 0x3F, 0x1F, 0x88, 0xFA, 0x04, 0x96, 0x62, 0xF8, 0xFC, 0x9F,
-    0x13, 0x44, 0x7D, 0x05, 0xEB, 0x22, 0x40, 0xB1, 0x41, 0xCC, 0x07, 0x19, 0xCC, 0xF0, 0xFB, 0x3F,
-    0x23, 0x90, 0x74, 0xF8, 0xBF, 0x1F, 0x64, 0xF3, 0xB7, 0xFF, 0xFA, 0x40, 0xEA, 0xFF, 0x7F, 0xB0,
-    0xD4, 0xFF, 0xFF, 0xF1, 0x0C, 0x08, 0x9E, 0xC2, 0x0F, 0xB0, 0x1C, 0x43, 0x00, 0x58, 0x25, 0x03,
-    0xC3, 0x1F, 0xB0, 0x3E, 0xA0, 0x29, 0x2C, 0x20, 0xEA, 0x1B, 0xC4, 0x4C, 0x22, 0x6C, 0xFF, 0xF2,
-    0x9F, 0x03, 0xC9, 0xD5, 0x50, 0x3F, 0x40, 0x7D, 0x04, 0xF5, 0x1F, 0xD0, 0x50, 0x6E, 0x88, 0xE8,
-    0x7B, 0x36, 0x44, 0x48, 0x80, 0xC2, 0x05, 0x00, 0xAD, 0x97, 0x52, 0xC9, 0x78, 0x9C, 0xFB, 0xB6,
-    0xFE, 0x1B, 0x55, 0x20, 0x00, 0x76, 0xA8, 0x3B, 0x35, 0x78, 0x9C, 0x7D, 0x90, 0x4B, 0x0E, 0x40,
-    0x40, 0x10, 0x44, 0x49, 0xFC, 0x17, 0x38, 0x86, 0xDB, 0x38, 0x12, 0x47, 0x71, 0x23, 0x13, 0x1C,
-    0xC0, 0x19, 0x7C, 0x82, 0x08, 0x25, 0xFD, 0x09, 0x36, 0xCC, 0xE6, 0x65, 0xBA, 0xA7, 0xAA, 0xBB,
-    0xC6, 0x64, 0x16, 0x9D, 0x09, 0x21, 0xA1, 0x43, 0xCD, 0xD7, 0x15, 0x11, 0xA1, 0x42, 0x4E, 0x48,
-    0xB5, 0xBA, 0xC3, 0x26, 0x2C, 0x70, 0x08, 0x33, 0x3C, 0x51, 0xFA, 0x82, 0xE0, 0x13, 0xA3, 0x60,
-    0x10, 0xD3, 0x1E, 0x31, 0xA1, 0x44, 0xC1, 0xDE, 0x27, 0x78, 0x83, 0x16, 0x48, 0x78, 0x14, 0xA3,
-    0x11, 0x1C, 0xDC, 0xD3, 0x97, 0xAA, 0x53, 0x97, 0xF1, 0x67, 0xDE, 0x0D, 0xFF, 0xB5, 0xE7, 0x0A,
-    0xF7, 0xC9, 0xA0, 0x89, 0x34, 0xDF, 0xC6, 0x96, 0x9A, 0x5D, 0xC5, 0x46, 0xFE, 0xE5, 0x02, 0x8C,
-    0xB3, 0x52, 0x68, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0xFA, 0x6F, 0x2D, 0x33, 0x03, 0x04, 0x1C, 0xFC,
-    0xFF, 0xFF, 0xFF, 0x7A, 0x46, 0x20, 0xE3, 0xCB, 0x7D, 0x86, 0x3F, 0x40, 0xF6, 0x7F, 0x3B, 0x20,
-    0xFB, 0xC7, 0xFE, 0x82, 0xFF, 0xF7, 0xD3, 0x7F, 0xFE, 0xFF, 0xCF, 0xC6, 0xA0, 0xF0, 0xBF, 0xFE,
-    0xC1, 0x7F, 0x6E, 0x06, 0x81, 0xDF, 0xFF, 0xCF, 0x87, 0xFD, 0xF8, 0x2F, 0xFF, 0xE9, 0x3F, 0x50,
-    0x63, 0x03, 0x48, 0xDD, 0x7F, 0xB6, 0x2F, 0xFF, 0x41, 0x06, 0x3C, 0x05, 0x32, 0xF3, 0xA1, 0x86,
-    0x31, 0x1C, 0xFF, 0x37, 0x97, 0x89, 0x01, 0x00, 0xBE, 0x0E, 0x2E, 0x2E,
+    0x7F, 0x10, 0xF9, 0xFF, 0xFF, 0x9A, 0x2A, 0x20, 0x29, 0x09, 0xF2, 0x66, 0x3D, 0xD8, 0xB3, 0xFC,
+    0x48, 0x24, 0x1F, 0x98, 0xE4, 0xA6, 0x22, 0x09, 0x00, 0x03, 0xBA, 0x6E, 0xFB, 0xBF, 0xFB, 0xD9,
+    0x8C, 0xF0, 0x88, 0xC9, 0x47, 0xE4, 0x33, 0x0E, 0x90, 0x5B, 0xFB, 0x41, 0xF9, 0x2C, 0x1E, 0x14,
+    0x91, 0x4C, 0xA0, 0x00, 0xBA, 0x0F, 0xD4, 0xB4, 0x1E, 0x12, 0xE4, 0x4C, 0x0E, 0x10, 0x77, 0x3F,
+    0x7F, 0xC7, 0x22, 0x00, 0x73, 0x11, 0xC8, 0x93, 0x7D, 0x10, 0x97, 0x33, 0x5C, 0x04, 0xBA, 0x33,
+    0x0B, 0xCC, 0x16, 0x00, 0x25, 0xD9, 0xFB, 0xE2, 0x60, 0xE6, 0x71, 0x68, 0x2A, 0x06, 0x05, 0xEB,
+    0xF6, 0xFF, 0xD0, 0x88, 0x65, 0x60, 0x98, 0x08, 0x8C, 0x55, 0x07, 0x17, 0x66, 0x48, 0x20, 0xB0,
+    0x7F, 0x80, 0xF8, 0xEA, 0xCB, 0x7F, 0xCE, 0x03, 0x90, 0xB0, 0xFD, 0xF2, 0x9F, 0x23, 0xE1, 0xFF,
+    0x7D, 0x26, 0xB0, 0xBD, 0x2C, 0x40, 0x3C, 0x5F, 0xC5, 0xE8, 0x39, 0xC8, 0xF1, 0x17, 0x21, 0x2E,
+    0xD5, 0x83, 0x95, 0x12, 0xFB, 0x41, 0xCE, 0x50, 0x38, 0xF1, 0xEF, 0x7D, 0x0F, 0x50, 0x2D, 0x00,
+    0x03, 0x85, 0x1D, 0x34, 0x08, 0x09, 0x50, 0x90, 0x34, 0xC2, 0x0C, 0xA5, 0x5E, 0xBF, 0x03, 0xBA,
+    0xE2, 0x1D, 0x13, 0xF1, 0xDA, 0xC9, 0xA0, 0xA0, 0xE1, 0xF5, 0x0B, 0x12, 0x5E, 0xDF, 0xFE, 0xE7,
+    0x85, 0x30, 0x81, 0x42, 0x1E, 0x1C, 0xF1, 0x09, 0x10, 0x8A, 0x61, 0xCB, 0xBF, 0xF3, 0x4C, 0x00,
+    0x83, 0xC4, 0x12, 0x50, 0x8C, 0x65, 0xA0, 0x58, 0x9F, 0x90, 0x58, 0x5C, 0x90, 0x60, 0x62, 0x81,
+    0xE6, 0x62, 0x60, 0x14, 0x3F, 0x00, 0xC7, 0x14, 0xD0, 0x4B, 0x2C, 0x1B, 0xC0, 0x41, 0xFA, 0x18,
+    0xC8, 0x02, 0x46, 0x7D, 0x8E, 0xCB, 0xB2, 0xFF, 0xA0, 0x04, 0xF0, 0x0B, 0x9C, 0xAE, 0xFE, 0x02,
+    0x59, 0x0B, 0xC0, 0x85, 0xC4, 0x37, 0x50, 0xD8, 0x2E, 0xF9, 0xFB, 0x3E, 0x9B, 0xF1, 0xEB, 0x7F,
+    0x16, 0x00, 0xFB, 0x04, 0xF1, 0x72, 0xC1, 0x7F, 0xA0, 0x45, 0xF2, 0x10, 0xC7, 0xC8, 0x27, 0x40,
+    0x82, 0x1B, 0x98, 0x90, 0xA1, 0xA9, 0x10, 0xE4, 0xE2, 0x5F, 0x60, 0xC7, 0xFF, 0x79, 0x0F, 0x75,
+    0xB8, 0x00, 0xC8, 0xCD, 0x0F, 0x40, 0x9A, 0xC1, 0xB9, 0x01, 0x9C, 0x19, 0x36, 0x80, 0xEC, 0x30,
+    0x00, 0x69, 0xFE, 0x08, 0x0E, 0x87, 0xBF, 0xE7, 0x41, 0xD1, 0xC1, 0x04, 0x36, 0x80, 0x91, 0xE1,
+    0xF7, 0x79, 0x48, 0xE2, 0x60, 0x13, 0x80, 0x18, 0x7F, 0xE0, 0x3F, 0x4F, 0x00, 0xC4, 0xCA, 0x84,
+    0xFF, 0xF2, 0x1B, 0xA0, 0x7E, 0xFB, 0x9F, 0xFF, 0x01, 0x1A, 0xF4, 0xBF, 0xCE, 0x7F, 0x85, 0x3A,
+    0xFE, 0xCB, 0xFF, 0x3F, 0xF3, 0x61, 0x9E, 0x80, 0x85, 0x34, 0xD0, 0xE7, 0xBC, 0x30, 0x3F, 0xC0,
+    0xFC, 0x0D, 0x4A, 0xCE, 0x0C, 0xB0, 0xE4, 0x0A, 0x22, 0x01, 0x35, 0x93, 0xCB, 0x11, 0x82, 0x40,
+    0x10, 0x44, 0x17, 0x4B, 0x3D, 0x50, 0xE5, 0x27, 0x04, 0x33, 0x30, 0x04, 0xCD, 0x40, 0x8F, 0xDE,
+    0x24, 0x13, 0x52, 0x20, 0x03, 0x08, 0xC0, 0x83, 0x19, 0x10, 0x02, 0x64, 0x40, 0x08, 0x48, 0x89,
+    0x88, 0x2C, 0x30, 0x4E, 0xCF, 0xEC, 0x5E, 0x28, 0x0E, 0xBB, 0x3B, 0xDD, 0xAF, 0x7B, 0xB4, 0xB9,
+    0x46, 0x01, 0xB3, 0xA4, 0x4C, 0xC8, 0x9C, 0x35, 0xAA, 0x1F, 0x2D, 0x22, 0x19, 0x9F, 0x28, 0xF3,
+    0xA9, 0x62, 0x2F, 0xA9, 0xBC, 0x06, 0x40, 0x7B, 0x00, 0x1D, 0x2B, 0x21, 0x0D, 0x6D, 0x57, 0xD4,
+    0xA0, 0x87, 0xF0, 0xBE, 0x06, 0xB1, 0x04, 0x9F, 0x37, 0xA6, 0x4D, 0xF7, 0xF9, 0x02, 0xEA, 0x21,
+    0xAE, 0x86, 0xAC, 0x70, 0x37, 0xA4, 0x80, 0xB8, 0x06, 0xD2, 0x2D, 0x6B, 0x0F, 0xDB, 0x1A, 0xE3,
+    0x03, 0x3C, 0x72, 0x62, 0x20, 0xAB, 0x17, 0x7B, 0x18, 0x0A, 0x81, 0x17, 0xF3, 0xC1, 0x20, 0x63,
+    0x77, 0xB3, 0xE4, 0x37, 0xE6, 0xA6, 0xCB, 0xF9, 0xD8, 0xE6, 0xA0, 0xD8, 0xBF, 0x64, 0x2C, 0xAB,
+    0xA7, 0x63, 0xE4, 0xEB, 0xB7, 0x84, 0x07, 0x1B, 0x67, 0xCA, 0xAB, 0xA4, 0x1B, 0x3C, 0x7E, 0x0A,
+    0x17, 0x6A, 0x42, 0x0F, 0xA4, 0xD4, 0x50, 0x4B, 0x2E, 0x5C, 0x61, 0xFD, 0xA4, 0xC9, 0x6D, 0x1C,
+    0xC9, 0x0E, 0xF1, 0xBA, 0x69, 0x2D, 0x8D, 0x75, 0x0B, 0xE9, 0x5B, 0xE2, 0xE2, 0xB6, 0x9E, 0x68,
+    0xA3, 0x73, 0x3B, 0xDF, 0x8D, 0x52, 0x7F, 0x1A, 0x89, 0xF9, 0x0F, 0x9B, 0x00, 0x71, 0xDB, 0x47,
+    0xA0, 0x2D, 0x7F, 0xC1, 0x9E, 0xFE, 0x0D, 0xB4, 0xE5, 0x33, 0xC8, 0x50, 0x07, 0x90, 0x2D, 0x13,
+    0x40, 0x4E, 0xBB, 0x00, 0x76, 0xC2, 0x5F, 0xA0, 0xA9, 0x3F, 0xC0, 0x4E, 0xF8, 0xF2, 0x9F, 0x47,
+    0x01, 0xE2, 0x84, 0x09, 0xFF, 0x09, 0xB9, 0x2F, 0x1E, 0x6A, 0xD5, 0x3F, 0x58, 0x0A, 0x05, 0xBA,
+    0x8E, 0x17, 0xE6, 0x6D, 0x58, 0x84, 0x80, 0x52, 0x17, 0x33, 0x44, 0xF2, 0xFD, 0x67, 0x88, 0xF4,
+    0x81, 0xFF, 0xFE, 0x0D, 0x10, 0x69, 0x90, 0xB1, 0x20, 0xBB, 0x41, 0x3A, 0x19, 0x81, 0x86, 0xF3,
+    0x82, 0x24, 0xEB, 0x41, 0x71, 0xD1, 0x0F, 0x92, 0xE4, 0x01, 0x07, 0x3B, 0x33, 0xD4, 0xD3, 0xDF,
+    0xFE, 0xF3, 0x42, 0x43, 0x13, 0x48, 0x01, 0x00, 0xFB, 0x0A, 0xB1, 0x11, 0x98, 0x1C, 0xA1, 0x01,
+    0xFE, 0xE9, 0x3F, 0xEF, 0x02, 0x48, 0x70, 0x7F, 0xFF, 0xCF, 0x0E, 0x8D, 0x8C, 0x3F, 0x40, 0xC7,
+    0xFC, 0x03, 0x39, 0x1E, 0xEC, 0x93, 0x1F, 0x20, 0x4F, 0x26, 0x80, 0xD4, 0x7C, 0x06, 0x69, 0xDE,
+    0x00, 0xD2, 0x07, 0x0E, 0x50, 0x70, 0x8E, 0x2B, 0x00, 0xC5, 0x26, 0xD8, 0x6F, 0x60, 0xC5, 0xBF,
+    0xC0, 0x7E, 0xFE, 0x0D, 0x34, 0x00, 0x12, 0xFB, 0xDF, 0x40, 0x86, 0xC6, 0x43, 0x22, 0x98, 0x67,
+    0x02, 0x24, 0x5C, 0x17, 0xFC, 0xD7, 0x7F, 0x00, 0xF1, 0x9B, 0xC3, 0xFF, 0xFA, 0xCF, 0xD0, 0x1C,
+    0xF2, 0xEF, 0xFC, 0x8F, 0xF7, 0xB0, 0x40, 0x81, 0x85, 0xCF, 0xE7, 0xFF, 0xB0, 0x90, 0xBE, 0x40,
+    0xAC, 0xBF, 0xA1, 0x69, 0x0B, 0xE4, 0x57, 0x68, 0x24, 0x03, 0xAD, 0x83, 0x06, 0x32, 0xD0, 0xAF,
+    0xB0, 0x90, 0xF8, 0xF3, 0x1F, 0x12, 0x53, 0xA9, 0x2F, 0xA0, 0x1A, 0x80, 0xC9, 0x0B, 0xAA, 0xCC,
+    0x01, 0x92, 0xD6, 0x41, 0x16, 0xFC, 0x3D, 0x0F, 0x55, 0x0F, 0x00, 0xFB, 0x00, 0xCD, 0x0D, 0xF7,
+    0x19, 0x30, 0x59, 0xE7, 0x19, 0x14, 0x94, 0x08, 0xFA, 0xEF, 0xC7, 0x7F, 0x59, 0x06, 0x68, 0x20,
+    0xC1, 0xAC, 0x7D, 0x08, 0x8D, 0x2E, 0x7C, 0xE9, 0x12, 0xEC, 0x4C, 0x56, 0xC2, 0xFE, 0x07, 0xC6,
+    0x7D, 0x3C, 0x54, 0xF2, 0x2F, 0xCC, 0x83, 0x0B, 0xFE, 0xBF, 0x07, 0xBB, 0x4B, 0x09, 0x28, 0x09,
+    0x05, 0x6C, 0xD8, 0x58, 0x00, 0x03, 0xBB, 0xEF, 0x3A, 0x13, 0xC4, 0x5D, 0xEC, 0x60, 0x33, 0x41,
+    0x69, 0x8C, 0x01, 0x62, 0x99, 0x02, 0xC1, 0xF8, 0x05, 0x7A, 0x83, 0x9D, 0x30, 0xC5, 0x06, 0xCD,
+    0x93, 0x88, 0x50, 0x70, 0x00, 0x27, 0x06, 0x81, 0x6F, 0xE0, 0xA0, 0x07, 0xFA, 0x82, 0x15, 0x4C,
+    0x81, 0xBD, 0x0A, 0xE5, 0x29, 0xFC, 0x80, 0x44, 0x4B, 0x00, 0x34, 0xD9, 0xFC, 0x41, 0x09, 0xBD,
+    0x6F, 0x10, 0x33, 0x89, 0xB0, 0xFD, 0x0B, 0x24, 0x5C, 0xA0, 0xAE, 0x86, 0xFA, 0x01, 0xEA, 0x23,
+    0xA8, 0xFF, 0x80, 0x86, 0x72, 0x43, 0x44, 0xDF, 0xB3, 0x21, 0x42, 0x02, 0x14, 0x2E, 0x00, 0xFB,
+    0xB6, 0x9E, 0x3A, 0x10, 0x00, 0xBB, 0xA0, 0x01, 0x35, 0x13, 0xEC, 0xB1, 0x2B, 0x50, 0x97, 0xFE,
+    0x80, 0x58, 0xB5, 0x00, 0x12, 0xAF, 0x78, 0xDD, 0xFF, 0x05, 0xE2, 0xE5, 0x2F, 0x10, 0xDB, 0xB1,
+    0x52, 0x9F, 0x21, 0x14, 0x34, 0x5D, 0x40, 0x53, 0x49, 0x03, 0x24, 0xD6, 0x81, 0x41, 0x06, 0x76,
+    0xC1, 0x65, 0x48, 0xEE, 0x17, 0x80, 0x50, 0x97, 0x20, 0xD4, 0x5F, 0xB0, 0x1C, 0x54, 0x25, 0x7A,
+    0xEA, 0xE2, 0x20, 0x64, 0x2D, 0xD4, 0x65, 0x50, 0x77, 0xFE, 0x80, 0x44, 0x29, 0xC4, 0x0F, 0x50,
+    0x1F, 0x41, 0xFD, 0xF7, 0x13, 0x6C, 0x24, 0xD4, 0xEF, 0x50, 0xCD, 0xD0, 0x70, 0x01, 0x00, 0x03,
+    0x66, 0xDD, 0x7F, 0x6B, 0x61, 0xCA, 0x0F, 0xC2, 0x22, 0xFE, 0xCB, 0x7D, 0x48, 0x36, 0xB4, 0x03,
+    0x29, 0xDF, 0x5F, 0xF0, 0xFF, 0x7E, 0xFA, 0x4F, 0x50, 0xB6, 0x03, 0x26, 0xFF, 0x07, 0xC0, 0x20,
+    0x12, 0xF8, 0xFD, 0xFF, 0x7C, 0xD8, 0x8F, 0xFF, 0xF2, 0x9F, 0x40, 0xF6, 0x40, 0x92, 0x0B, 0xDB,
+    0x17, 0x70, 0x26, 0x79, 0x0A, 0x4E, 0x98, 0x50, 0x70, 0xFC, 0xDF, 0x5C, 0x26, 0x06, 0x00,
+};
+const uint8_t Roboto_20Dictionary[1024] = {
+    0xFF, 0xFF, 0x4A, 0x22, 0xA4, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x07, 0x00, 0x00, 0x00,
+    0xFF, 0xBF, 0x00, 0xF8, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xBF, 0x00, 0xE0, 0xFF, 0xFF,
+    0x59, 0x53, 0xD7, 0xFF, 0xFF, 0xBF, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF,
+    0x00, 0x20, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xB5, 0xFD, 0xDE, 0x39, 0x20, 0xFF, 0xBF, 0x00, 0x00,
+    0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xFF, 0xBF, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xBF, 0x45, 0x34, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF8, 0xFF, 0x9F, 0x23, 0x52, 0xFC, 0xFF, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0x04, 0xF1, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x05,
+    0xF1, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x05, 0xF1, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3A, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x13, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xBF, 0x10, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xBF,
+    0x60, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xBF, 0xA0, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0xC0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xF1, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0x00, 0xF5, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0C, 0x00, 0x00, 0xFB,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x2F, 0x00, 0x10, 0xFF, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xDF, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x61, 0xDB, 0xFF, 0xBD, 0x16, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0x05, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x70, 0xFF, 0xFF, 0x8D, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0xF1, 0xFF, 0xFF, 0xDF, 0x46, 0x53, 0xFB, 0xFF, 0x8F, 0x00, 0xF1, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x70, 0xFF, 0xEF, 0x00, 0xF1, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x20, 0xFE, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x6F, 0x00, 0x00,
+    0x00, 0x40, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0xFF, 0x8F, 0x00, 0x00, 0xF2, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x0E,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0x08, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0B, 0xF8,
+    0x00, 0xFE, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x22, 0x22, 0x22, 0xF6, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xC0, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xEF, 0xF7, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xCF,
 };
 const GFXglyph Roboto_20Glyphs[] = {
-    { 0, 0, 10, 0, 0, 8, 0 }, //  
-    { 5, 30, 11, 3, 30, 48, 8 }, // !
-    { 10, 10, 13, 2, 32, 52, 56 }, // "
-    { 24, 30, 26, 2, 30, 193, 108 }, // #
-    { 20, 38, 24, 2, 34, 221, 301 }, // $
-    { 27, 30, 31, 2, 30, 236, 522 }, // %
-    { 24, 30, 26, 2, 30, 244, 758 }, // &
-    { 4, 10, 7, 2, 32, 24, 1002 }, // '
-    { 12, 44, 14, 2, 34, 146, 1026 }, // (
-    { 12, 44, 15, 0, 34, 159, 1172 }, // )
-    { 18, 17, 18, 0, 30, 123, 1331 }, // *
-    { 22, 22, 24, 1, 25, 42, 1454 }, // +
-    { 7, 10, 8, 0, 5, 43, 1496 }, // ,
-    { 11, 4, 12, 0, 15, 19, 1539 }, // -
-    { 6, 5, 11, 2, 5, 24, 1558 }, // .
-    { 17, 33, 17, 0, 30, 142, 1582 }, // /
-    { 20, 30, 24, 2, 30, 170, 1724 }, // 0
-    { 12, 30, 24, 3, 30, 56, 1894 }, // 1
-    { 22, 30, 24, 1, 30, 177, 1950 }, // 2
-    { 20, 30, 24, 1, 30, 189, 2127 }, // 3
-    { 22, 30, 24, 1, 30, 127, 2316 }, // 4
-    { 19, 30, 24, 3, 30, 182, 2443 }, // 5
-    { 20, 30, 24, 2, 30, 210, 2625 }, // 6
-    { 21, 30, 24, 1, 30, 122, 2835 }, // 7
-    { 20, 30, 24, 2, 30, 216, 2957 }, // 8
-    { 19, 30, 24, 2, 30, 205, 3173 }, // 9
-    { 6, 23, 10, 2, 23, 33, 3378 }, // :
-    { 7, 28, 9, 0, 23, 65, 3411 }, // ;
-    { 18, 19, 21, 1, 23, 103, 3476 }, // <
-    { 18, 14, 23, 3, 21, 28, 3579 }, // =
-    { 19, 19, 22, 2, 23, 92, 3607 }, // >
-    { 18, 30, 20, 1, 30, 156, 3699 }, // ?
-    { 34, 38, 38, 2, 29, 381, 3855 }, // @
-    { 27, 30, 27, 0, 30, 200, 4236 }, // A
-    { 21, 30, 26, 3, 30, 169, 4436 }, // B
-    { 24, 30, 27, 2, 30, 195, 4605 }, // C
-    { 23, 30, 28, 3, 30, 136, 4800 }, // D
-    { 20, 30, 24, 3, 30, 50, 4936 }, // E
-    { 19, 30, 23, 3, 30, 42, 4986 }, // F
-    { 24, 30, 29, 2, 30, 219, 5028 }, // G
-    { 24, 30, 30, 3, 30, 35, 5247 }, // H
-    { 5, 30, 11, 3, 30, 14, 5282 }, // I
-    { 19, 30, 23, 1, 30, 92, 5296 }, // J
-    { 24, 30, 26, 3, 30, 169, 5388 }, // K
-    { 19, 30, 23, 3, 30, 28, 5557 }, // L
-    { 31, 30, 37, 3, 30, 197, 5585 }, // M
-    { 24, 30, 30, 3, 30, 138, 5782 }, // N
-    { 25, 30, 29, 2, 30, 188, 5920 }, // O
-    { 22, 30, 27, 3, 30, 120, 6108 }, // P
-    { 25, 35, 29, 2, 30, 219, 6228 }, // Q
-    { 23, 30, 26, 3, 30, 166, 6447 }, // R
-    { 23, 30, 25, 1, 30, 226, 6613 }, // S
-    { 24, 30, 25, 1, 30, 36, 6839 }, // T
-    { 23, 30, 27, 2, 30, 110, 6875 }, // U
-    { 27, 30, 27, 0, 30, 217, 6985 }, // V
-    { 36, 30, 37, 1, 30, 303, 7202 }, // W
-    { 25, 30, 26, 1, 30, 216, 7505 }, // X
-    { 25, 30, 25, 0, 30, 160, 7721 }, // Y
-    { 23, 30, 25, 1, 30, 142, 7881 }, // Z
-    { 8, 40, 11, 3, 34, 30, 8023 }, // [
-    { 17, 33, 17, 0, 30, 144, 8053 }, // <backslash>
-    { 8, 40, 11, 0, 34, 30, 8197 }, // ]
-    { 16, 15, 18, 1, 30, 108, 8227 }, // ^
-    { 19, 4, 19, 0, 0, 20, 8335 }, // _
-    { 9, 6, 13, 1, 31, 36, 8355 }, // `
-    { 19, 22, 23, 2, 22, 168, 8391 }, // a
-    { 20, 32, 24, 2, 32, 138, 8559 }, // b
-    { 20, 22, 22, 1, 22, 138, 8697 }, // c
-    { 20, 32, 24, 1, 32, 140, 8835 }, // d
-    { 20, 22, 22, 1, 22, 163, 8975 }, // e
-    { 14, 32, 15, 1, 32, 77, 9138 }, // f
-    { 20, 31, 24, 1, 22, 196, 9215 }, // g
-    { 19, 32, 23, 2, 32, 87, 9411 }, // h
-    { 6, 31, 10, 2, 31, 31, 9498 }, // i
-    { 10, 40, 10, -2, 31, 69, 9529 }, // j
-    { 20, 32, 21, 2, 32, 135, 9598 }, // k
-    { 5, 32, 10, 3, 32, 14, 9733 }, // l
-    { 32, 22, 37, 2, 22, 129, 9747 }, // m
-    { 19, 22, 23, 2, 22, 85, 9876 }, // n
-    { 22, 22, 24, 1, 22, 141, 9961 }, // o
-    { 20, 31, 24, 2, 22, 152, 10102 }, // p
-    { 20, 31, 24, 1, 22, 143, 10254 }, // q
-    { 12, 22, 14, 2, 22, 50, 10397 }, // r
-    { 19, 22, 22, 1, 22, 168, 10447 }, // s
-    { 13, 28, 14, 0, 28, 64, 10615 }, // t
-    { 19, 22, 23, 2, 22, 86, 10679 }, // u
-    { 20, 22, 20, 0, 22, 151, 10765 }, // v
-    { 31, 22, 32, 0, 22, 234, 10916 }, // w
-    { 20, 22, 21, 0, 22, 140, 11150 }, // x
-    { 20, 31, 20, 0, 22, 182, 11290 }, // y
-    { 19, 22, 21, 1, 22, 114, 11472 }, // z
-    { 13, 41, 14, 1, 33, 138, 11586 }, // {
-    { 4, 36, 10, 3, 30, 13, 11724 }, // |
-    { 13, 41, 14, 0, 33, 122, 11737 }, // }
-    { 24, 8, 29, 2, 16, 89, 11859 }, // ~
+    { 0, 0, 10, 0, 0, 2, 0 }, //  
+    { 5, 30, 11, 3, 30, 43, 2 }, // !
+    { 10, 10, 13, 2, 32, 45, 45 }, // "
+    { 24, 30, 26, 2, 30, 176, 90 }, // #
+    { 20, 38, 24, 2, 34, 190, 266 }, // $
+    { 27, 30, 31, 2, 30, 212, 456 }, // %
+    { 24, 30, 26, 2, 30, 213, 668 }, // &
+    { 4, 10, 7, 2, 32, 17, 881 }, // '
+    { 12, 44, 14, 2, 34, 93, 898 }, // (
+    { 12, 44, 15, 0, 34, 131, 991 }, // )
+    { 18, 17, 18, 0, 30, 95, 1122 }, // *
+    { 22, 22, 24, 1, 25, 29, 1217 }, // +
+    { 7, 10, 8, 0, 5, 27, 1246 }, // ,
+    { 11, 4, 12, 0, 15, 12, 1273 }, // -
+    { 6, 5, 11, 2, 5, 18, 1285 }, // .
+    { 17, 33, 17, 0, 30, 99, 1303 }, // /
+    { 20, 30, 24, 2, 30, 124, 1402 }, // 0
+    { 12, 30, 24, 3, 30, 40, 1526 }, // 1
+    { 22, 30, 24, 1, 30, 135, 1566 }, // 2
+    { 20, 30, 24, 1, 30, 154, 1701 }, // 3
+    { 22, 30, 24, 1, 30, 116, 1855 }, // 4
+    { 19, 30, 24, 3, 30, 152, 1971 }, // 5
+    { 20, 30, 24, 2, 30, 177, 2123 }, // 6
+    { 21, 30, 24, 1, 30, 94, 2300 }, // 7
+    { 20, 30, 24, 2, 30, 182, 2394 }, // 8
+    { 19, 30, 24, 2, 30, 174, 2576 }, // 9
+    { 6, 23, 10, 2, 23, 26, 2750 }, // :
+    { 7, 28, 9, 0, 23, 47, 2776 }, // ;
+    { 18, 19, 21, 1, 23, 85, 2823 }, // <
+    { 18, 14, 23, 3, 21, 20, 2908 }, // =
+    { 19, 19, 22, 2, 23, 79, 2928 }, // >
+    { 18, 30, 20, 1, 30, 96, 3007 }, // ?
+    { 34, 38, 38, 2, 29, 362, 3103 }, // @
+    { 27, 30, 27, 0, 30, 146, 3465 }, // A
+    { 21, 30, 26, 3, 30, 137, 3611 }, // B
+    { 24, 30, 27, 2, 30, 132, 3748 }, // C
+    { 23, 30, 28, 3, 30, 119, 3880 }, // D
+    { 20, 30, 24, 3, 30, 33, 3999 }, // E
+    { 19, 30, 23, 3, 30, 30, 4032 }, // F
+    { 24, 30, 29, 2, 30, 182, 4062 }, // G
+    { 24, 30, 30, 3, 30, 24, 4244 }, // H
+    { 5, 30, 11, 3, 30, 7, 4268 }, // I
+    { 19, 30, 23, 1, 30, 70, 4275 }, // J
+    { 24, 30, 26, 3, 30, 156, 4345 }, // K
+    { 19, 30, 23, 3, 30, 17, 4501 }, // L
+    { 31, 30, 37, 3, 30, 183, 4518 }, // M
+    { 24, 30, 30, 3, 30, 127, 4701 }, // N
+    { 25, 30, 29, 2, 30, 158, 4828 }, // O
+    { 22, 30, 27, 3, 30, 96, 4986 }, // P
+    { 25, 35, 29, 2, 30, 192, 5082 }, // Q
+    { 23, 30, 26, 3, 30, 151, 5274 }, // R
+    { 23, 30, 25, 1, 30, 188, 5425 }, // S
+    { 24, 30, 25, 1, 30, 22, 5613 }, // T
+    { 23, 30, 27, 2, 30, 70, 5635 }, // U
+    { 27, 30, 27, 0, 30, 170, 5705 }, // V
+    { 36, 30, 37, 1, 30, 270, 5875 }, // W
+    { 25, 30, 26, 1, 30, 172, 6145 }, // X
+    { 25, 30, 25, 0, 30, 121, 6317 }, // Y
+    { 23, 30, 25, 1, 30, 116, 6438 }, // Z
+    { 8, 40, 11, 3, 34, 18, 6554 }, // [
+    { 17, 33, 17, 0, 30, 115, 6572 }, // <backslash>
+    { 8, 40, 11, 0, 34, 21, 6687 }, // ]
+    { 16, 15, 18, 1, 30, 81, 6708 }, // ^
+    { 19, 4, 19, 0, 0, 13, 6789 }, // _
+    { 9, 6, 13, 1, 31, 21, 6802 }, // `
+    { 19, 22, 23, 2, 22, 138, 6823 }, // a
+    { 20, 32, 24, 2, 32, 122, 6961 }, // b
+    { 20, 22, 22, 1, 22, 109, 7083 }, // c
+    { 20, 32, 24, 1, 32, 74, 7192 }, // d
+    { 20, 22, 22, 1, 22, 125, 7266 }, // e
+    { 14, 32, 15, 1, 32, 41, 7391 }, // f
+    { 20, 31, 24, 1, 22, 130, 7432 }, // g
+    { 19, 32, 23, 2, 32, 36, 7562 }, // h
+    { 6, 31, 10, 2, 31, 24, 7598 }, // i
+    { 10, 40, 10, -2, 31, 52, 7622 }, // j
+    { 20, 32, 21, 2, 32, 121, 7674 }, // k
+    { 5, 32, 10, 3, 32, 7, 7795 }, // l
+    { 32, 22, 37, 2, 22, 102, 7802 }, // m
+    { 19, 22, 23, 2, 22, 34, 7904 }, // n
+    { 22, 22, 24, 1, 22, 94, 7938 }, // o
+    { 20, 31, 24, 2, 22, 126, 8032 }, // p
+    { 20, 31, 24, 1, 22, 113, 8158 }, // q
+    { 12, 22, 14, 2, 22, 42, 8271 }, // r
+    { 19, 22, 22, 1, 22, 135, 8313 }, // s
+    { 13, 28, 14, 0, 28, 48, 8448 }, // t
+    { 19, 22, 23, 2, 22, 66, 8496 }, // u
+    { 20, 22, 20, 0, 22, 120, 8562 }, // v
+    { 31, 22, 32, 0, 22, 209, 8682 }, // w
+    { 20, 22, 21, 0, 22, 109, 8891 }, // x
+    { 20, 31, 20, 0, 22, 147, 9000 }, // y
+    { 19, 22, 21, 1, 22, 58, 9147 }, // z
+    { 13, 41, 14, 1, 33, 90, 9205 }, // {
+    { 4, 36, 10, 3, 30, 6, 9295 }, // |
+    { 13, 41, 14, 0, 33, 90, 9301 }, // }
+    { 24, 8, 29, 2, 16, 64, 9391 }, // ~
 };
 const UnicodeInterval Roboto_20Intervals[] = {
     { 0x20, 0x7E, 0x0 },
@@ -858,4 +768,10 @@ const GFXfont Roboto_20 = {
     49,
     39,
     -11,
+    GLYPH_FORMAT_RAW_DEFLATE,
+    (uint8_t*)Roboto_20Dictionary,
+    1024,
+    NULL,
+    0,
+    { 24, 1, 1, 30, 23, 0 },
 };
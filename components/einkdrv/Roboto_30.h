@@ -1,1234 +1,1125 @@
 #pragma once
 #include "epd_driver.h"
-const uint8_t Roboto_30Bitmaps[18088] = {
-    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xBB, 0xF0, 0xFF, 0xBF, 0xFC, 0x05,
-    0x24, 0x7C, 0xE0, 0xFF, 0x7F, 0x7E, 0x74, 0xBC, 0x01, 0x0D, 0x2F, 0xF8, 0xFF, 0x9F, 0x0F, 0x1D,
-    0x4F, 0xF8, 0xFF, 0x9F, 0x17, 0x1D, 0x37, 0xFC, 0xFF, 0xCF, 0x83, 0x8C, 0x0B, 0x20, 0x98, 0x1B,
-    0x19, 0x33, 0xE0, 0x02, 0x89, 0xEE, 0x0C, 0x0A, 0xFF, 0xFE, 0x73, 0x03, 0xED, 0x8B, 0xFF, 0xF0,
-    0xFF, 0xFF, 0x7C, 0x10, 0x06, 0xB1, 0x15, 0x40, 0x7A, 0x80, 0x72, 0x00, 0x43, 0x9F, 0x68, 0x68,
-    0x78, 0x9C, 0x7D, 0xC5, 0xBB, 0x0D, 0x80, 0x30, 0x10, 0x44, 0xC1, 0xB3, 0xC1, 0xE6, 0x27, 0xFA,
-    0x2F, 0x83, 0x52, 0x28, 0xC1, 0x25, 0x10, 0x92, 0x3C, 0x69, 0xD9, 0x6B, 0x80, 0x49, 0x06, 0xAD,
-    0xF1, 0xEA, 0xE4, 0xB7, 0xEE, 0x0E, 0xD4, 0xDC, 0x8E, 0x66, 0xB7, 0xA1, 0xEA, 0x16, 0x54, 0x5C,
-    0x47, 0xE1, 0x1A, 0x4F, 0x36, 0x31, 0xB2, 0xCA, 0x9D, 0x15, 0xAE, 0x2C, 0x3E, 0x85, 0x39, 0x3B,
-    0x21, 0x78, 0x9C, 0xAD, 0x93, 0xCD, 0x51, 0x02, 0x41, 0x14, 0x84, 0x57, 0x45, 0xFC, 0x41, 0x59,
-    0x33, 0xD0, 0x0C, 0x30, 0x03, 0xB0, 0x6A, 0x2E, 0x78, 0xC1, 0x0C, 0xF0, 0xE0, 0x1D, 0x32, 0xD0,
-    0x10, 0xCC, 0x40, 0x33, 0x30, 0x05, 0x33, 0xC0, 0x0C, 0x0C, 0x01, 0xFC, 0x03, 0x75, 0x61, 0xDB,
-    0xB7, 0xDD, 0xFB, 0x66, 0xD9, 0x2B, 0xE5, 0x77, 0x78, 0x53, 0xD5, 0x55, 0x5D, 0x35, 0xDD, 0xF3,
-    0x26, 0x49, 0xC8, 0x0A, 0x07, 0x36, 0x3F, 0xD1, 0x49, 0x1C, 0xA0, 0x69, 0x73, 0x81, 0xD4, 0x85,
-    0x73, 0x60, 0xC7, 0x8E, 0x5F, 0xB4, 0x5C, 0xB9, 0x06, 0xE4, 0xDD, 0x77, 0xE5, 0x1E, 0xAF, 0xF2,
-    0xEE, 0xBA, 0xF2, 0x8C, 0x27, 0x79, 0xB7, 0x5D, 0x99, 0xE1, 0xB6, 0xF2, 0x92, 0x77, 0x0C, 0xE8,
-    0x9D, 0x44, 0xE5, 0x0B, 0xA7, 0xF4, 0x3E, 0x44, 0xE5, 0x1B, 0xC7, 0xF4, 0x8E, 0xA2, 0xB2, 0xC4,
-    0xA1, 0xCD, 0x0F, 0x74, 0xD7, 0xAE, 0xBC, 0x67, 0x73, 0xAE, 0x2B, 0xF7, 0x42, 0x08, 0x37, 0x40,
-    0xDF, 0x8E, 0x15, 0x06, 0x21, 0x34, 0xCC, 0x5C, 0x27, 0xDD, 0x50, 0x29, 0x78, 0xC3, 0xD0, 0xE6,
-    0x9D, 0xE2, 0x12, 0x75, 0xA7, 0xB8, 0x62, 0x81, 0x76, 0x8C, 0x2B, 0xD4, 0x9D, 0xE2, 0x8A, 0x9C,
-    0xDD, 0x29, 0x2E, 0x39, 0x51, 0x77, 0x8A, 0x4B, 0x7A, 0xEA, 0x2E, 0x63, 0x5C, 0x32, 0x56, 0x77,
-    0x39, 0xE3, 0x92, 0x47, 0x76, 0x67, 0xDE, 0x86, 0x2B, 0x2F, 0xEC, 0xCE, 0xBC, 0x5B, 0x55, 0xEF,
-    0x23, 0x7A, 0xA7, 0x65, 0xC3, 0x75, 0x5A, 0x1B, 0x2A, 0x17, 0xD6, 0x2F, 0x70, 0x69, 0x33, 0x2B,
-    0x5A, 0x0E, 0x7C, 0xE6, 0xFF, 0x5D, 0x95, 0x71, 0x6D, 0x55, 0xBA, 0x31, 0x6E, 0x52, 0x06, 0x49,
-    0x63, 0x5C, 0xE1, 0xAB, 0x32, 0x8C, 0x4A, 0x56, 0xAE, 0x4A, 0xB5, 0xDD, 0xF9, 0xFA, 0xAA, 0x14,
-    0x9C, 0xA9, 0xBB, 0x1F, 0x1C, 0xB9, 0x72, 0xA5, 0xEE, 0x96, 0xFC, 0x19, 0xC6, 0x1F, 0xAD, 0xC8,
-    0x27, 0xC2, 0x78, 0x9C, 0xB5, 0x92, 0xCF, 0x2E, 0x43, 0x51, 0x10, 0xC6, 0xE7, 0x16, 0x55, 0xA5,
-    0xDA, 0xA5, 0x85, 0x44, 0x1F, 0x40, 0xC2, 0x5A, 0x08, 0x6B, 0x1B, 0x5D, 0x4A, 0x6C, 0x3C, 0x80,
-    0x84, 0xBE, 0x80, 0x48, 0x6C, 0xAE, 0x58, 0xF4, 0x11, 0x6C, 0xAC, 0x69, 0xBC, 0x40, 0xC5, 0x42,
-    0xC2, 0x46, 0x3C, 0xC1, 0x95, 0x58, 0x74, 0x79, 0x51, 0xF4, 0x36, 0xED, 0xED, 0x67, 0xE6, 0xFC,
-    0xB7, 0x67, 0x36, 0xE7, 0xFE, 0xCE, 0xB9, 0x33, 0xDF, 0x99, 0x6F, 0x0E, 0x91, 0xC4, 0x51, 0xBC,
-    0x4B, 0x41, 0xBC, 0xA0, 0xF3, 0x3F, 0x58, 0xFB, 0x04, 0x26, 0x1C, 0x35, 0x73, 0x00, 0xE9, 0xB6,
-    0xA1, 0x13, 0xE8, 0x58, 0x56, 0x54, 0xCF, 0x0D, 0x62, 0x52, 0xF0, 0xD9, 0x12, 0x76, 0x04, 0x47,
-    0xFC, 0x71, 0x75, 0xF6, 0x20, 0xE9, 0x11, 0xD1, 0x3E, 0xAF, 0xEB, 0xBC, 0x7B, 0xC3, 0xEB, 0xAC,
-    0x48, 0xE2, 0x5A, 0xD5, 0x18, 0x00, 0x2B, 0x44, 0x2C, 0x59, 0x51, 0x78, 0x0B, 0x5C, 0x10, 0x65,
-    0x40, 0x51, 0x2B, 0x70, 0x32, 0xD1, 0x10, 0x88, 0xB4, 0x3E, 0xD7, 0x2C, 0x50, 0x2E, 0x7B, 0x2A,
-    0xFA, 0xF2, 0xDF, 0x18, 0x89, 0xC1, 0x1E, 0x30, 0x1D, 0x9C, 0xBE, 0x03, 0x25, 0xC9, 0x30, 0xB9,
-    0x6F, 0xC0, 0x8C, 0xC8, 0x15, 0x83, 0x5E, 0xBF, 0xAC, 0xAE, 0xCB, 0x08, 0x9D, 0x90, 0x6E, 0x37,
-    0x02, 0x1E, 0x33, 0xAF, 0x79, 0xEC, 0x49, 0xAB, 0x07, 0x91, 0xC5, 0x55, 0x39, 0x46, 0x67, 0xCA,
-    0xF2, 0x9D, 0xB2, 0x22, 0x5D, 0xB0, 0xDC, 0xD5, 0xDE, 0x94, 0x7E, 0x73, 0xEA, 0xAC, 0xBE, 0x54,
-    0x7C, 0xE8, 0xCA, 0x37, 0x86, 0xC2, 0xAE, 0x1C, 0xD5, 0xF9, 0xEE, 0xE2, 0x95, 0xD3, 0x63, 0xF7,
-    0x9F, 0x82, 0xDB, 0xB5, 0x11, 0xCE, 0x8D, 0xD8, 0x08, 0xAF, 0xA5, 0x5B, 0x9D, 0x0B, 0x90, 0x07,
-    0x30, 0x3F, 0x10, 0x37, 0x75, 0xB0, 0xEF, 0xD5, 0xCC, 0xE7, 0x73, 0xAD, 0x6A, 0xDF, 0x8B, 0xCB,
-    0x29, 0x8F, 0xA8, 0x6C, 0x90, 0x9D, 0xAC, 0xB0, 0x55, 0x4B, 0xBE, 0x72, 0xB9, 0x6D, 0xE7, 0x49,
-    0x35, 0xB6, 0xA1, 0xD8, 0x80, 0x98, 0x2D, 0x21, 0x8F, 0x22, 0x92, 0x29, 0x24, 0xF2, 0x46, 0x9A,
-    0x4C, 0x2D, 0xA2, 0x0F, 0x69, 0xFC, 0x3C, 0x7E, 0x94, 0x06, 0xF9, 0x52, 0x5B, 0xEE, 0xE1, 0x20,
-    0x91, 0x0B, 0xBD, 0x3A, 0x5C, 0x54, 0x35, 0x32, 0x43, 0xC7, 0x46, 0xE1, 0x5E, 0xD1, 0x9E, 0x77,
-    0x62, 0x84, 0x56, 0x81, 0x7C, 0x7C, 0x63, 0x93, 0xFE, 0x08, 0x4F, 0x63, 0x33, 0xBF, 0x1F, 0x6F,
-    0x2C, 0x38, 0x04, 0x78, 0x9C, 0x65, 0x93, 0x3D, 0x52, 0x02, 0x41, 0x10, 0x85, 0x1B, 0x10, 0xFF,
-    0xB1, 0x38, 0x81, 0xE5, 0x05, 0x2C, 0x37, 0xA0, 0xCC, 0xFC, 0x89, 0x34, 0x53, 0xE1, 0x02, 0x78,
-    0x03, 0xCD, 0x08, 0xE1, 0x04, 0xE2, 0x0D, 0x56, 0x03, 0x63, 0xA8, 0xB2, 0x8C, 0x35, 0xF0, 0x00,
-    0xDC, 0x80, 0xE2, 0x04, 0x28, 0xFF, 0xBA, 0xC2, 0x73, 0xA6, 0x7B, 0x76, 0x76, 0x66, 0xB7, 0x83,
-    0x9E, 0xEA, 0x47, 0xCD, 0xCE, 0x7B, 0xDF, 0x0C, 0x44, 0x54, 0x6D, 0x5C, 0x50, 0xBA, 0x5E, 0x01,
-    0x74, 0xF2, 0xBE, 0x76, 0x0B, 0x5D, 0x57, 0xBE, 0x38, 0x67, 0x11, 0x6B, 0xAE, 0x16, 0x00, 0x61,
-    0xE5, 0x05, 0xD8, 0x77, 0xC5, 0x1E, 0x86, 0x05, 0xA2, 0x29, 0x3A, 0x3C, 0x9D, 0x8B, 0x38, 0x46,
-    0x5D, 0xF5, 0x16, 0x90, 0xE3, 0xE9, 0x84, 0xC5, 0x05, 0xF6, 0x54, 0x2F, 0x03, 0x45, 0x3D, 0x2D,
-    0x65, 0xF9, 0xC5, 0xB6, 0x4C, 0x1B, 0xAA, 0xDF, 0x63, 0xC8, 0x1B, 0x22, 0x6C, 0xCA, 0xB2, 0xA5,
-    0xFA, 0x08, 0x77, 0xBC, 0xFD, 0xCF, 0x15, 0x23, 0xEC, 0x66, 0xC4, 0x1B, 0x20, 0x9F, 0x11, 0x07,
-    0x68, 0x8B, 0x25, 0x7B, 0x90, 0xFA, 0xED, 0x07, 0x25, 0x4A, 0x5B, 0x0A, 0x6C, 0x58, 0xC7, 0x7C,
-    0x0F, 0xA1, 0x17, 0x73, 0xA2, 0x63, 0xCE, 0x2D, 0x80, 0x04, 0xC8, 0x81, 0x49, 0xE5, 0xA0, 0x2B,
-    0x52, 0x17, 0xEF, 0x29, 0xC8, 0xD7, 0x9A, 0xD4, 0x51, 0x02, 0xCF, 0x5C, 0x47, 0x79, 0xC5, 0xF1,
-    0xE3, 0xAA, 0x36, 0x2E, 0x15, 0x86, 0x47, 0xF4, 0x29, 0x53, 0x63, 0x9C, 0x65, 0xC5, 0x25, 0x23,
-    0xF1, 0x2B, 0x46, 0xE9, 0xD5, 0x88, 0x93, 0xD5, 0x1A, 0xC7, 0xAE, 0x18, 0x61, 0x87, 0xE8, 0x53,
-    0x19, 0x69, 0x27, 0x1B, 0x18, 0x65, 0x8B, 0x2D, 0x1F, 0x5A, 0x71, 0x80, 0xA6, 0xC6, 0xC8, 0x65,
-    0x9F, 0x90, 0x46, 0xA9, 0xB2, 0x3D, 0x54, 0xDE, 0x60, 0xAE, 0x44, 0x3D, 0x02, 0xA0, 0x40, 0xDF,
-    0xE8, 0xE7, 0x34, 0x8B, 0xA6, 0x11, 0x19, 0xE5, 0x8C, 0xED, 0x77, 0x6D, 0xB2, 0x85, 0x46, 0xC9,
-    0x06, 0xF4, 0x26, 0xF9, 0xA8, 0xA0, 0x94, 0x07, 0x41, 0x31, 0xD6, 0x0F, 0x46, 0x69, 0x9F, 0xCE,
-    0x3A, 0x8B, 0x33, 0x46, 0xE9, 0x8B, 0x06, 0xA5, 0x2F, 0x3E, 0xC9, 0x81, 0xBE, 0x38, 0x11, 0x94,
-    0xFE, 0x41, 0x06, 0xA5, 0x58, 0x0A, 0xC4, 0x52, 0xB0, 0x1A, 0x9A, 0xE3, 0x5C, 0xF3, 0xCF, 0x75,
-    0x5E, 0xBE, 0xFC, 0x98, 0x05, 0xEE, 0x31, 0x90, 0x92, 0x47, 0x3F, 0x8D, 0x8E, 0x4B, 0x20, 0x9F,
-    0x92, 0x5F, 0xFA, 0x3A, 0xC2, 0xCC, 0xFD, 0xD5, 0xE4, 0x0F, 0xFD, 0x0F, 0x13, 0xD0, 0x16, 0xD4,
-    0x78, 0x9C, 0x75, 0x52, 0xBB, 0x4E, 0xC3, 0x40, 0x10, 0xBC, 0x28, 0x09, 0xAF, 0x08, 0xE2, 0x86,
-    0x12, 0x09, 0x89, 0x9A, 0x84, 0x1F, 0x00, 0x52, 0x51, 0xD0, 0x10, 0x6A, 0x8A, 0x50, 0x50, 0x22,
-    0x25, 0x1D, 0x1D, 0xA1, 0xA1, 0xA1, 0x31, 0x7F, 0xE0, 0x34, 0xD4, 0xF4, 0x50, 0x90, 0x3F, 0x20,
-    0x7C, 0x01, 0xE2, 0x0B, 0x2C, 0x08, 0x01, 0x1C, 0x6C, 0x0F, 0xBB, 0x7B, 0x6B, 0xDF, 0x35, 0x6C,
-    0xE1, 0xB3, 0xC7, 0xB7, 0xB3, 0xB3, 0xB3, 0x6B, 0x0C, 0x45, 0x70, 0x76, 0x71, 0x60, 0xFC, 0x38,
-    0x4D, 0x01, 0x3C, 0xD5, 0x1C, 0xB0, 0x93, 0x81, 0xE3, 0xDE, 0x21, 0x33, 0xD8, 0xD8, 0x28, 0xAF,
-    0x28, 0x80, 0xE7, 0x02, 0x99, 0xD0, 0xC7, 0xC9, 0xD6, 0x1D, 0x3D, 0x17, 0x5D, 0x52, 0x9F, 0x8E,
-    0x4F, 0x60, 0x4D, 0x91, 0x39, 0xB0, 0xC4, 0x05, 0x81, 0x23, 0x45, 0xE8, 0xBA, 0x9C, 0x39, 0x42,
-    0x0B, 0x04, 0x24, 0x45, 0xEF, 0x46, 0x65, 0xA9, 0xF0, 0x1F, 0x24, 0xC5, 0xD0, 0x22, 0x9B, 0xAA,
-    0x36, 0xF0, 0x99, 0x63, 0x3E, 0x6E, 0x81, 0xA6, 0x22, 0xBF, 0x40, 0x9D, 0x8E, 0x6F, 0x2B, 0x42,
-    0x15, 0x92, 0xB4, 0x2B, 0xE0, 0xD5, 0xEB, 0x22, 0x32, 0x01, 0x19, 0xD2, 0x2E, 0x90, 0x0E, 0x49,
-    0xAC, 0x71, 0xFF, 0xCE, 0xA0, 0x84, 0xDA, 0x26, 0x60, 0xCF, 0xF9, 0x33, 0xB1, 0x5E, 0x54, 0x3C,
-    0x0F, 0x05, 0x59, 0x36, 0x5E, 0x50, 0x61, 0xF4, 0x7C, 0xA0, 0x93, 0xC3, 0x69, 0x91, 0xF8, 0xE1,
-    0xA4, 0x7D, 0x0F, 0x18, 0x09, 0x4D, 0xEC, 0x11, 0x93, 0xB6, 0x98, 0xA0, 0x55, 0xFB, 0x4E, 0x7C,
-    0x63, 0xAE, 0x33, 0x55, 0xDB, 0x52, 0xEE, 0x3F, 0xE1, 0x3A, 0x5D, 0xE5, 0xCE, 0x89, 0x8F, 0x7B,
-    0xA8, 0x0B, 0x7B, 0x4F, 0x9C, 0x69, 0xB3, 0xE0, 0xA1, 0xD2, 0x57, 0x59, 0x6B, 0x93, 0xC7, 0xA4,
-    0x9C, 0x68, 0x99, 0x01, 0x7F, 0x10, 0xCD, 0x02, 0x23, 0x6F, 0xEC, 0xCF, 0x98, 0x9B, 0x49, 0x75,
-    0x5A, 0xDC, 0x5C, 0xE3, 0x83, 0x39, 0x33, 0xEB, 0xB2, 0x58, 0x19, 0x26, 0xFC, 0xBB, 0x44, 0x06,
-    0x22, 0x3D, 0x32, 0x65, 0x96, 0xCC, 0x5F, 0xDA, 0x4B, 0xB8, 0xAA, 0x04, 0x8B, 0xC7, 0x8A, 0x31,
-    0x5F, 0xA5, 0x57, 0x01, 0x9B, 0x42, 0xFD, 0xBE, 0xBB, 0x19, 0xCC, 0xEC, 0x96, 0x8C, 0xCA, 0x6D,
-    0x2B, 0x8C, 0xA3, 0xB1, 0x63, 0x57, 0x92, 0x84, 0xB9, 0xAF, 0x26, 0x1F, 0x56, 0xCC, 0xF1, 0xDC,
-    0xAE, 0x67, 0x55, 0x36, 0x80, 0x22, 0x2F, 0x16, 0xB6, 0x55, 0xD8, 0x2C, 0xB1, 0xFD, 0x62, 0x87,
-    0xDF, 0xC9, 0x14, 0xB8, 0x14, 0xD2, 0x06, 0x41, 0xDD, 0x54, 0x80, 0x73, 0x23, 0x2B, 0x2C, 0x0B,
-    0x17, 0x5C, 0x3F, 0x3C, 0xDE, 0xAC, 0x17, 0x93, 0xF8, 0x03, 0x29, 0x9C, 0x5E, 0x87, 0x78, 0x9C,
-    0x2D, 0xC2, 0xC9, 0x09, 0x00, 0x20, 0x10, 0xC0, 0xC0, 0x87, 0xF7, 0xAA, 0xFD, 0x37, 0x1B, 0x88,
-    0xB0, 0x38, 0x0C, 0x5E, 0xFE, 0x93, 0x37, 0x06, 0x2E, 0x9C, 0x38, 0xB0, 0x63, 0xC3, 0x9A, 0xCB,
-    0x03, 0xC8, 0x21, 0x1E, 0x38, 0x78, 0x9C, 0x95, 0x52, 0xDB, 0x11, 0xC1, 0x50, 0x10, 0x5D, 0x62,
-    0xC6, 0x8C, 0x30, 0x5A, 0x50, 0x82, 0x0E, 0x94, 0xE0, 0xDB, 0x17, 0x1D, 0xD0, 0x81, 0x74, 0xA0,
-    0x05, 0x1D, 0xD0, 0x01, 0x1D, 0x30, 0x1A, 0x40, 0x05, 0x19, 0x62, 0xC8, 0x78, 0xE4, 0x48, 0x76,
-    0xEF, 0x1E, 0xDF, 0xF2, 0xB3, 0x67, 0x6E, 0xF6, 0x9E, 0xC7, 0xEE, 0x15, 0xD1, 0x6F, 0x64, 0x45,
-    0x0E, 0x2B, 0xAB, 0xFD, 0x02, 0x06, 0x6E, 0x40, 0xA4, 0x07, 0xC0, 0x5C, 0x0F, 0xCE, 0x40, 0x53,
-    0xC1, 0x1B, 0x0B, 0xAD, 0x09, 0x10, 0x2B, 0xC8, 0x90, 0xD6, 0xC2, 0x9F, 0xA9, 0xD6, 0x09, 0xD0,
-    0x56, 0x70, 0x0A, 0x24, 0xF2, 0xC0, 0xCE, 0x68, 0x0B, 0x0C, 0xBD, 0xA5, 0xA3, 0x60, 0xEB, 0xB4,
-    0x57, 0xA0, 0xAE, 0x20, 0xC7, 0xD1, 0x7A, 0x3F, 0x41, 0xA8, 0x87, 0x70, 0x69, 0x06, 0x74, 0x15,
-    0x2C, 0xFD, 0x76, 0x29, 0xD0, 0x52, 0x70, 0x71, 0x9A, 0xD2, 0x77, 0x43, 0xC1, 0xDD, 0xB5, 0x73,
-    0xC0, 0xEC, 0x3D, 0x11, 0xB2, 0xBD, 0x90, 0x4A, 0x30, 0x4C, 0xA9, 0x3F, 0x00, 0x6F, 0x91, 0x87,
-    0xCC, 0xD4, 0xA2, 0x3A, 0xFD, 0xD0, 0x21, 0x3D, 0xAF, 0x3D, 0x05, 0x73, 0x31, 0x29, 0xB3, 0xFF,
-    0xA6, 0xC1, 0xF9, 0xEC, 0x9D, 0x88, 0x33, 0xE4, 0x54, 0xCB, 0x39, 0x6F, 0xC4, 0x45, 0x22, 0x6F,
-    0x8A, 0x9D, 0x72, 0x6C, 0x20, 0x73, 0xDB, 0x89, 0x3B, 0xE1, 0xE6, 0xAA, 0x2D, 0x9B, 0xDD, 0x72,
-    0xEF, 0x03, 0xF1, 0x04, 0x26, 0xCC, 0xB7, 0x21, 0x87, 0xA0, 0x52, 0xBD, 0x9F, 0x2F, 0x93, 0x93,
-    0xA9, 0xB0, 0x78, 0x9C, 0x8D, 0x92, 0xEB, 0x0D, 0x41, 0x41, 0x10, 0x85, 0x89, 0x47, 0x84, 0x04,
-    0x15, 0xA0, 0x03, 0x3A, 0xA0, 0x04, 0x1D, 0x68, 0x41, 0x07, 0x74, 0x40, 0x07, 0x6E, 0x07, 0x74,
-    0x40, 0x09, 0x3A, 0x40, 0x07, 0xAE, 0x78, 0x93, 0xFB, 0x49, 0x76, 0xF6, 0x0C, 0x3F, 0xDD, 0x5F,
-    0x5F, 0xEE, 0xCE, 0x9C, 0x73, 0x66, 0x76, 0x93, 0x62, 0xCE, 0xBE, 0x74, 0x16, 0xE1, 0x46, 0xCD,
-    0xE0, 0xC1, 0xDA, 0x20, 0x81, 0xAA, 0xD1, 0x9B, 0x85, 0xC1, 0x01, 0x4A, 0x01, 0x7A, 0xD0, 0xB6,
-    0x5F, 0x77, 0x95, 0xEF, 0x75, 0x36, 0x84, 0xBA, 0xFA, 0xA2, 0xFA, 0x05, 0xF2, 0x01, 0xB6, 0x50,
-    0x09, 0x30, 0x56, 0x51, 0x13, 0x46, 0x56, 0xF4, 0x92, 0x92, 0x57, 0xA7, 0x50, 0x0E, 0xB0, 0x21,
-    0xA6, 0x9B, 0x42, 0x43, 0x26, 0x7D, 0xF5, 0x4F, 0xAC, 0x0D, 0x96, 0xB2, 0xDD, 0x19, 0x3C, 0x41,
-    0x21, 0xA3, 0xE2, 0x0D, 0x0A, 0x01, 0xAE, 0x50, 0x94, 0x99, 0xC5, 0x3E, 0xCB, 0xEC, 0x1F, 0xF0,
-    0x2E, 0xD7, 0x71, 0x65, 0xF7, 0x72, 0x77, 0xCF, 0x93, 0xC5, 0x84, 0x9E, 0x79, 0xA0, 0x29, 0xC6,
-    0x9A, 0x6B, 0xA5, 0x49, 0x8F, 0x3F, 0x9E, 0xA6, 0xE7, 0x17, 0x93, 0xC5, 0x8D, 0x0D, 0xB4, 0xC3,
-    0x95, 0xB6, 0x7A, 0xFA, 0xD6, 0xDA, 0xE6, 0x3B, 0xD0, 0x52, 0x89, 0x92, 0x9B, 0x4A, 0x33, 0xA3,
-    0xAB, 0xDD, 0x96, 0x62, 0x8F, 0xDD, 0xF2, 0x5C, 0x11, 0xDC, 0xD0, 0xDF, 0x86, 0xBF, 0x96, 0x44,
-    0xEF, 0xE7, 0x03, 0xB4, 0xCA, 0xA9, 0x89, 0x78, 0x9C, 0x7D, 0x90, 0xBD, 0x0E, 0x01, 0x51, 0x10,
-    0x85, 0xE7, 0x12, 0xBF, 0x51, 0xEC, 0x13, 0xC8, 0x3E, 0x82, 0x56, 0x21, 0xDB, 0xEA, 0x78, 0x03,
-    0xAB, 0xD4, 0xE9, 0x35, 0x12, 0x0F, 0xC0, 0x1B, 0xAC, 0x62, 0x7B, 0x2A, 0x9D, 0x78, 0x84, 0x7D,
-    0x84, 0xA5, 0xD3, 0xDD, 0xC4, 0x4F, 0x24, 0x72, 0xD7, 0x31, 0xF7, 0xC7, 0xA2, 0xE0, 0x14, 0x33,
-    0xF3, 0x35, 0x73, 0xCE, 0x0C, 0x11, 0x6B, 0x09, 0xD0, 0x5B, 0xDF, 0xB4, 0x80, 0xFC, 0x49, 0x53,
-    0xA4, 0x7F, 0x28, 0x71, 0xD3, 0x48, 0x10, 0x8D, 0x0D, 0xF9, 0x15, 0xF2, 0xB0, 0x2A, 0x59, 0x1A,
-    0xAA, 0x80, 0x42, 0x40, 0xB6, 0x43, 0xEC, 0x28, 0x06, 0xE6, 0xB4, 0x06, 0x6B, 0x8B, 0xE4, 0xC8,
-    0x2D, 0xA1, 0x3D, 0x3E, 0x24, 0x68, 0x96, 0xBD, 0xE6, 0xB4, 0xAB, 0x57, 0x6D, 0x2C, 0x4C, 0x0A,
-    0xD6, 0xA4, 0xCF, 0x33, 0x6F, 0xCE, 0x63, 0x02, 0x83, 0x3C, 0xCA, 0x85, 0x49, 0x0A, 0x07, 0xDE,
-    0x03, 0x11, 0xD0, 0x70, 0xC4, 0x96, 0x55, 0xC5, 0xD6, 0x56, 0x37, 0xBE, 0xE0, 0x04, 0x14, 0x0D,
-    0xB4, 0x80, 0x80, 0x93, 0xA2, 0x69, 0xE8, 0x00, 0xD4, 0x88, 0x14, 0x47, 0xD5, 0xBA, 0x9B, 0x37,
-    0x9C, 0x81, 0xB2, 0xA6, 0x2B, 0x7A, 0xE6, 0x60, 0x4B, 0xBE, 0xAA, 0xEB, 0x96, 0x75, 0xDC, 0x1F,
-    0x8C, 0x71, 0xAC, 0xEB, 0x13, 0xB2, 0x7B, 0x82, 0x83, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x8F,
-    0xFF, 0xFF, 0x73, 0x32, 0x20, 0x81, 0xA1, 0xC3, 0x0F, 0x0E, 0x05, 0x81, 0xEF, 0xFF, 0xFF, 0xC7,
-    0x83, 0x19, 0xAC, 0x3F, 0xFF, 0xA3, 0x00, 0x79, 0x4A, 0xF9, 0x03, 0xED, 0x3F, 0x5A, 0xF3, 0x01,
-    0xC5, 0xC2, 0x9F, 0x61, 0x78, 0x9C, 0x63, 0x10, 0xF8, 0xFF, 0xBF, 0x9F, 0x01, 0x93, 0xA8, 0x87,
-    0x10, 0x0A, 0xFF, 0xFF, 0xC7, 0x33, 0x04, 0xFC, 0xFF, 0xAF, 0xCF, 0x30, 0xE1, 0xFF, 0x7F, 0x3E,
-    0x86, 0x0B, 0xFF, 0xFF, 0x73, 0x30, 0x7C, 0xF9, 0xFF, 0x9F, 0x89, 0xE1, 0xCF, 0xFF, 0xF5, 0x10,
-    0x71, 0xA0, 0x10, 0x3B, 0x83, 0xC2, 0xDF, 0xF5, 0x0C, 0x0C, 0x0C, 0x0D, 0x5C, 0x0C, 0x0C, 0x00,
-    0x87, 0xFC, 0x27, 0x41, 0x78, 0x9C, 0x5B, 0xB1, 0x0A, 0x0C, 0xB4, 0xFE, 0xFE, 0x07, 0x03, 0x7B,
-    0x5C, 0x34, 0x00, 0x97, 0xAE, 0x21, 0xA7, 0x78, 0x9C, 0x63, 0x70, 0x64, 0x66, 0x48, 0xF8, 0xFF,
-    0x9F, 0xF5, 0xD3, 0xFF, 0xFF, 0xF2, 0xDF, 0xFF, 0xFF, 0xCF, 0x07, 0xE1, 0xCF, 0xFF, 0xFF, 0xDB,
-    0x4F, 0xF8, 0xFF, 0x9F, 0x83, 0x21, 0xD9, 0x8C, 0x01, 0x00, 0x35, 0x70, 0x12, 0xDE, 0x78, 0x9C,
-    0xAD, 0xD0, 0xCD, 0x11, 0xC1, 0x60, 0x14, 0x85, 0xE1, 0x0F, 0xC3, 0x30, 0x4C, 0xA4, 0x83, 0xE8,
-    0x40, 0x0B, 0x3A, 0x90, 0x0E, 0x94, 0x40, 0x07, 0x51, 0x82, 0x0E, 0xA4, 0x03, 0xE9, 0x84, 0x0E,
-    0xE8, 0x80, 0x10, 0xFF, 0xE4, 0xB5, 0x31, 0xE7, 0xDA, 0x64, 0x26, 0x66, 0x72, 0x57, 0xE7, 0x59,
-    0xDC, 0xCD, 0xEB, 0xDC, 0xF7, 0x76, 0xEC, 0x9D, 0x2E, 0x63, 0x69, 0x78, 0x30, 0xD4, 0xF6, 0xA1,
-    0x27, 0xCC, 0xA0, 0x25, 0x6C, 0xA0, 0x26, 0x9C, 0x58, 0xD9, 0xFF, 0x9D, 0xB1, 0x21, 0xC7, 0xD3,
-    0x0E, 0xA1, 0x2D, 0x24, 0x50, 0x17, 0x52, 0xD6, 0xF6, 0x72, 0x65, 0x6A, 0x78, 0xD3, 0xD7, 0x1E,
-    0x41, 0x47, 0x88, 0xA1, 0x21, 0x1C, 0xD8, 0xDA, 0xCB, 0x85, 0xC8, 0xF0, 0x22, 0xD0, 0x1E, 0x40,
-    0x57, 0x98, 0x43, 0x53, 0x28, 0x8E, 0xF1, 0xAC, 0x32, 0x06, 0xA5, 0x62, 0x1C, 0x7F, 0x63, 0xDC,
-    0x98, 0x18, 0xF2, 0x52, 0x31, 0xD2, 0xFF, 0x63, 0x2C, 0x0A, 0x63, 0x9C, 0xAB, 0x8C, 0xF1, 0x01,
-    0x12, 0xD3, 0x77, 0x89, 0x78, 0x9C, 0xCD, 0x92, 0x3D, 0x52, 0x02, 0x41, 0x10, 0x85, 0x5B, 0x5D,
-    0x40, 0x7E, 0x6B, 0x33, 0x43, 0x6F, 0xA0, 0x96, 0x17, 0x60, 0xAB, 0xAC, 0xC2, 0x6B, 0x90, 0x18,
-    0x6B, 0x46, 0x88, 0x37, 0x30, 0x22, 0xD7, 0x2A, 0x8D, 0x8D, 0x8C, 0xFD, 0xB9, 0x80, 0x06, 0xE4,
-    0xEA, 0x09, 0xA0, 0x10, 0x16, 0x45, 0xCB, 0xC7, 0xEB, 0x9E, 0x9E, 0x5A, 0xE4, 0x04, 0xBE, 0x60,
-    0x67, 0xBF, 0xDD, 0x99, 0xFE, 0x7B, 0x23, 0x42, 0x1D, 0x9C, 0xF4, 0x3A, 0x1B, 0x12, 0x75, 0x07,
-    0xEA, 0x75, 0xC7, 0x69, 0x88, 0xA0, 0xB2, 0x51, 0xD7, 0x09, 0xF7, 0x86, 0x79, 0x44, 0xD4, 0x35,
-    0x8C, 0x7E, 0xEF, 0x1C, 0x0E, 0xB8, 0xF4, 0x89, 0x0F, 0xC0, 0x28, 0xE1, 0x7A, 0x45, 0xDE, 0x14,
-    0x99, 0x01, 0x7B, 0x76, 0x68, 0x01, 0xD4, 0x44, 0xBE, 0x81, 0xC4, 0xF0, 0x0D, 0xD8, 0x95, 0x14,
-    0x78, 0x96, 0x98, 0xA1, 0xAF, 0x8F, 0x53, 0xCF, 0xAF, 0x3F, 0x2E, 0x75, 0x4B, 0x10, 0x8F, 0xC9,
-    0x0B, 0xD0, 0x74, 0x9C, 0x03, 0x5B, 0x63, 0x8B, 0x67, 0x9A, 0xB2, 0xCE, 0x09, 0xB0, 0xED, 0xA8,
-    0xAF, 0xD3, 0x58, 0xBA, 0x88, 0x6E, 0x64, 0x15, 0xA5, 0x02, 0xEB, 0x79, 0xAC, 0xC2, 0xB0, 0x31,
-    0x2F, 0x90, 0x65, 0x35, 0xFF, 0x25, 0x36, 0xF2, 0xA2, 0x05, 0xC5, 0xB5, 0x8E, 0x3E, 0x80, 0x4A,
-    0x81, 0xD5, 0xB5, 0x69, 0x8C, 0x83, 0x53, 0x3E, 0xAB, 0x12, 0x2D, 0x6A, 0x39, 0x7E, 0x72, 0x92,
-    0xE7, 0xC0, 0xBE, 0xE3, 0x0F, 0xE7, 0x9C, 0x01, 0x17, 0x81, 0x52, 0x33, 0x9C, 0x7E, 0x06, 0x3C,
-    0x33, 0x7B, 0xBE, 0x62, 0xA6, 0x77, 0xB3, 0x87, 0xE1, 0xDB, 0x86, 0xB4, 0xA8, 0x2A, 0xEA, 0x99,
-    0xD5, 0xF5, 0x18, 0xDC, 0x4F, 0x7F, 0x69, 0xE4, 0xF1, 0xD1, 0x8D, 0xDF, 0x0D, 0xCD, 0xEE, 0x32,
-    0xEF, 0xB2, 0x48, 0xB7, 0x21, 0xC3, 0x93, 0x63, 0x6C, 0xE5, 0xFA, 0xCF, 0x9D, 0x5C, 0xBD, 0xB1,
-    0x4B, 0x0F, 0xAD, 0x25, 0x39, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x83, 0xC9, 0xF9, 0x60, 0x4A, 0xE0,
-    0xFA, 0x7F, 0x30, 0x23, 0xE0, 0xF7, 0x7F, 0x30, 0x63, 0xF2, 0xBF, 0xFF, 0x20, 0x06, 0x50, 0x18,
-    0x04, 0xF2, 0x41, 0xC2, 0x60, 0x06, 0x94, 0x86, 0x30, 0xDE, 0x67, 0x40, 0x18, 0xEB, 0x59, 0x1C,
-    0xC0, 0x8C, 0x68, 0x06, 0x06, 0x10, 0xE3, 0xB6, 0x38, 0x03, 0x84, 0xC1, 0xC8, 0x00, 0x65, 0x30,
-    0x8C, 0x32, 0x88, 0x63, 0x00, 0x00, 0xAE, 0xD3, 0x94, 0x26, 0x78, 0x9C, 0x95, 0x92, 0x3D, 0x52,
-    0x02, 0x41, 0x10, 0x85, 0x67, 0x51, 0x29, 0x84, 0x52, 0x37, 0x20, 0x55, 0xA8, 0x22, 0xF6, 0xE7,
-    0x06, 0x72, 0x03, 0x09, 0x0D, 0xAD, 0xD2, 0x2A, 0x42, 0xC9, 0x0C, 0xA1, 0xCC, 0x2D, 0x8F, 0x20,
-    0xA4, 0x06, 0xCA, 0x11, 0xB8, 0x81, 0x7A, 0x02, 0xF4, 0x04, 0x48, 0xF9, 0xFF, 0x03, 0xCF, 0x37,
-    0x3B, 0xBB, 0xC3, 0x9B, 0xCD, 0x7C, 0xC1, 0xF6, 0x7E, 0x3B, 0xDD, 0x3D, 0x6F, 0x7A, 0xC7, 0x18,
-    0x2A, 0x3E, 0x39, 0x6B, 0x57, 0x8D, 0xD7, 0xF9, 0x0C, 0xD4, 0x45, 0x94, 0xE2, 0x00, 0x4E, 0x57,
-    0xEE, 0x43, 0x0B, 0x99, 0xB6, 0x13, 0x7E, 0xF7, 0x3C, 0x29, 0x10, 0x9B, 0x7C, 0x19, 0x1F, 0x36,
-    0x8E, 0xBF, 0x19, 0xD7, 0xC8, 0x4F, 0x8C, 0x2B, 0x8C, 0x75, 0x36, 0xBD, 0x64, 0xFC, 0xCA, 0xEA,
-    0x86, 0x5C, 0x88, 0x4C, 0xCC, 0xE7, 0x52, 0xC2, 0xF1, 0x1C, 0x28, 0x9A, 0x23, 0x97, 0x65, 0xF5,
-    0x01, 0x94, 0x6D, 0xD6, 0x6E, 0xCA, 0x53, 0xDB, 0xF0, 0xD1, 0x75, 0xB5, 0xBA, 0x07, 0x36, 0xCC,
-    0x33, 0x50, 0x49, 0x79, 0x64, 0x79, 0x6A, 0x8B, 0x4C, 0xB6, 0xC1, 0xBA, 0x11, 0x8D, 0x16, 0xA5,
-    0x89, 0x58, 0xBA, 0xAA, 0xFC, 0xEA, 0x8C, 0x7A, 0xFD, 0x60, 0xA2, 0xB8, 0xB7, 0x70, 0x96, 0xB5,
-    0xAB, 0x29, 0xD3, 0x6E, 0x29, 0x4C, 0x1F, 0xEB, 0x32, 0xE7, 0x70, 0xA0, 0xFC, 0x1B, 0xA6, 0xF7,
-    0x81, 0x3B, 0x5D, 0xFE, 0x04, 0xB6, 0x04, 0x3B, 0x1C, 0x53, 0x41, 0xF8, 0x2D, 0xEC, 0x66, 0x87,
-    0x5E, 0x14, 0x7E, 0x01, 0xBA, 0x82, 0xF5, 0x79, 0x78, 0xD4, 0x07, 0xE0, 0x36, 0xE7, 0xA5, 0x22,
-    0x38, 0xCC, 0x79, 0xE1, 0x2F, 0xDB, 0x14, 0xEC, 0xF1, 0x64, 0x91, 0x30, 0x2F, 0xC0, 0x8E, 0x60,
-    0xCB, 0xFF, 0x51, 0xEF, 0x65, 0x3F, 0xE7, 0x65, 0x59, 0x98, 0x73, 0x39, 0xD5, 0xCD, 0x78, 0x4D,
-    0x6E, 0xAE, 0xBD, 0xCA, 0x4D, 0x04, 0xAA, 0xFD, 0x97, 0xFF, 0x00, 0xA8, 0x80, 0xF7, 0x20, 0x78,
-    0x9C, 0x55, 0x92, 0x4D, 0x4E, 0x02, 0x41, 0x10, 0x85, 0x4B, 0x50, 0x50, 0x59, 0x38, 0x07, 0x30,
-    0x81, 0x1B, 0x40, 0xC2, 0x05, 0x5C, 0x9B, 0x18, 0x76, 0x6A, 0x62, 0xA2, 0x26, 0xB2, 0xD7, 0x9D,
-    0x5B, 0x3D, 0x81, 0x12, 0x2F, 0xC0, 0x9A, 0x8D, 0xEE, 0x5D, 0x60, 0x3C, 0x01, 0x37, 0x98, 0x9D,
-    0xDB, 0xC1, 0xDF, 0x44, 0x46, 0x79, 0xBC, 0xEA, 0x2E, 0xE8, 0xEE, 0xB7, 0x98, 0x9E, 0x6F, 0x7A,
-    0xAA, 0xBA, 0xFA, 0x55, 0x89, 0x50, 0x59, 0xFF, 0xFA, 0xB0, 0x2A, 0x4B, 0xDD, 0xFE, 0x83, 0x3A,
-    0x31, 0x1A, 0xC0, 0xEB, 0xD4, 0x51, 0x67, 0x6E, 0x88, 0x6D, 0xC5, 0xAF, 0x25, 0x61, 0x4C, 0x6A,
-    0x71, 0x2D, 0x8E, 0xBB, 0xFD, 0x92, 0xEB, 0xA6, 0xC8, 0x84, 0x4B, 0x4D, 0x3F, 0xFF, 0x01, 0x6D,
-    0x91, 0x1F, 0xF7, 0xA4, 0x9E, 0x80, 0x47, 0x11, 0x1E, 0xB2, 0xEE, 0x30, 0xE3, 0x6F, 0xD2, 0xF1,
-    0x19, 0x54, 0x33, 0x6E, 0x9C, 0x03, 0x67, 0x86, 0xDF, 0x40, 0xFD, 0x1E, 0x68, 0x1A, 0x7E, 0x32,
-    0xF5, 0x10, 0xD8, 0x31, 0x7C, 0x07, 0xB6, 0x24, 0xE8, 0x23, 0x45, 0x96, 0x57, 0x8F, 0xF0, 0x17,
-    0xA8, 0x44, 0x38, 0x47, 0x1E, 0x11, 0xAB, 0xEA, 0x05, 0xCA, 0x58, 0x45, 0x23, 0xD0, 0x1B, 0x56,
-    0xFF, 0x8E, 0x46, 0xCF, 0xEA, 0xCF, 0xAE, 0xA1, 0xBF, 0xFD, 0x9D, 0x24, 0x58, 0x4D, 0x71, 0x5C,
-    0x49, 0x10, 0x97, 0x21, 0xF1, 0x85, 0x7A, 0x15, 0xD5, 0xD8, 0x2A, 0x93, 0x32, 0x84, 0x37, 0x2F,
-    0x22, 0x14, 0x6E, 0x6F, 0xA4, 0xF7, 0x6D, 0x44, 0xF8, 0x12, 0x8C, 0xB1, 0xE0, 0x76, 0x84, 0x57,
-    0x69, 0x6A, 0x7A, 0xDC, 0x9B, 0x5A, 0x1F, 0x6D, 0x77, 0x1A, 0xD2, 0x69, 0xEC, 0x24, 0xA4, 0xD3,
-    0xD7, 0x61, 0x68, 0x8A, 0x9E, 0xBB, 0xC7, 0xD2, 0xD6, 0x56, 0x55, 0xD5, 0xB4, 0xA1, 0x3E, 0xF8,
-    0xC6, 0x99, 0xC5, 0x46, 0xE5, 0xEA, 0x43, 0x56, 0xBA, 0x30, 0xE6, 0x43, 0x7E, 0xE4, 0x67, 0x43,
-    0x8F, 0x9C, 0x25, 0x93, 0xA3, 0x31, 0x26, 0xDF, 0xBF, 0x57, 0xA3, 0x03, 0x3B, 0xF0, 0x41, 0xE7,
-    0xAE, 0xD8, 0x0F, 0xC6, 0x71, 0x62, 0xBD, 0xAB, 0x0B, 0x27, 0x05, 0x00, 0xBB, 0x78, 0x9C, 0xCD,
-    0xD2, 0xCD, 0x0D, 0x01, 0x41, 0x18, 0x87, 0xF1, 0x97, 0x8D, 0x88, 0x8F, 0x8D, 0xAD, 0x40, 0x74,
-    0x40, 0x07, 0x74, 0x42, 0x27, 0xAB, 0x04, 0x1D, 0xAC, 0x12, 0xDC, 0x1D, 0x28, 0x41, 0x07, 0x74,
-    0x60, 0xD9, 0x58, 0xEC, 0xE2, 0x31, 0xD9, 0x44, 0xBC, 0xEF, 0xDC, 0xDC, 0xFC, 0x4F, 0x93, 0xDF,
-    0x65, 0x92, 0x67, 0x46, 0xE4, 0xB3, 0x02, 0xBA, 0xA2, 0x36, 0xC1, 0x83, 0x9D, 0x0F, 0x37, 0x0F,
-    0x06, 0x78, 0xB0, 0xF5, 0x21, 0xF7, 0x20, 0xC2, 0x83, 0x15, 0x94, 0x06, 0x2E, 0x70, 0xD6, 0x10,
-    0xBD, 0x88, 0x53, 0x0D, 0x0B, 0x08, 0x0D, 0x64, 0x10, 0x18, 0x78, 0x92, 0x88, 0x86, 0x39, 0xF4,
-    0x0D, 0xB8, 0x0B, 0x1A, 0x06, 0x1E, 0x6C, 0x44, 0xC3, 0x0C, 0x86, 0x06, 0x4E, 0xD0, 0x34, 0x50,
-    0xB0, 0x17, 0x0D, 0x2E, 0xDE, 0xD8, 0xC0, 0x01, 0x5A, 0x06, 0xEE, 0x1C, 0x6B, 0x1A, 0x46, 0x30,
-    0x15, 0x0D, 0x2E, 0x77, 0xC7, 0xC0, 0x15, 0xEA, 0x1A, 0x5C, 0xEE, 0x58, 0x34, 0xB8, 0x78, 0xA1,
-    0x01, 0x97, 0x3B, 0xD0, 0xE0, 0xE2, 0x25, 0xA2, 0x61, 0x09, 0x9B, 0x75, 0xB5, 0xB2, 0x3A, 0xB5,
-    0x33, 0xEC, 0x7A, 0xF9, 0xEF, 0xF0, 0x7D, 0xBC, 0xD4, 0xFB, 0x30, 0xFF, 0x06, 0x6F, 0x61, 0x26,
-    0x09, 0xF6, 0x78, 0x9C, 0x55, 0x91, 0xBB, 0x4E, 0x42, 0x51, 0x10, 0x45, 0x87, 0x97, 0x20, 0x2F,
-    0x69, 0xA9, 0x24, 0xD1, 0xC6, 0xD8, 0x18, 0xFD, 0x00, 0x1B, 0x43, 0x2B, 0xB5, 0x95, 0x0D, 0x3D,
-    0xA1, 0xB1, 0xB0, 0xF0, 0xFE, 0x80, 0x91, 0x86, 0x9A, 0x4F, 0x80, 0x18, 0x63, 0xEB, 0x27, 0x40,
-    0x62, 0x67, 0x83, 0x7F, 0x00, 0x2A, 0x01, 0x9F, 0x77, 0x3B, 0x67, 0xEE, 0x81, 0x33, 0x33, 0xC9,
-    0x2D, 0x56, 0xEE, 0x3C, 0xF6, 0xDE, 0x87, 0x68, 0x85, 0x4D, 0x0D, 0x88, 0xE8, 0xD3, 0xE2, 0xB7,
-    0xC5, 0x1F, 0x8B, 0x7F, 0x16, 0x63, 0xDC, 0x9D, 0xF9, 0xDA, 0x67, 0x04, 0xCE, 0x29, 0x54, 0x03,
-    0x38, 0x55, 0x78, 0x04, 0xEC, 0x2A, 0x6C, 0x01, 0x3B, 0x0A, 0x2F, 0x81, 0xAA, 0xC2, 0x08, 0x28,
-    0x2B, 0xEC, 0x01, 0x45, 0x85, 0x23, 0x60, 0x5B, 0xE1, 0x04, 0xC8, 0x2B, 0x7C, 0x05, 0x72, 0x0A,
-    0xE7, 0x40, 0xA6, 0xFB, 0x12, 0x4F, 0xAF, 0xD3, 0x82, 0x6F, 0xC0, 0xA3, 0xE8, 0x7F, 0xCA, 0x38,
-    0xFC, 0x30, 0x7E, 0x68, 0x11, 0xFC, 0xB9, 0x83, 0xCB, 0x80, 0x43, 0x1F, 0xD5, 0xC5, 0xDE, 0xB1,
-    0xCC, 0xE7, 0x04, 0x0F, 0xDD, 0xD0, 0x3D, 0xC4, 0x4B, 0xAD, 0x7F, 0x9B, 0x5C, 0xFC, 0x02, 0x6E,
-    0xAC, 0xDA, 0xA9, 0xC2, 0x1A, 0x77, 0xA7, 0x15, 0x73, 0xF7, 0x96, 0xC2, 0x85, 0xB5, 0x3A, 0xB7,
-    0x41, 0xB0, 0xB7, 0x8A, 0x75, 0x5E, 0xB5, 0x58, 0xB1, 0xCD, 0xE5, 0x77, 0x20, 0x1B, 0x56, 0x95,
-    0xF8, 0x2B, 0x84, 0x43, 0x85, 0x49, 0xD8, 0xCE, 0x32, 0xB2, 0x51, 0x78, 0x31, 0x16, 0x99, 0xE2,
-    0x07, 0x1C, 0x27, 0xD4, 0x13, 0xFF, 0xBF, 0xEB, 0xD8, 0x97, 0xD2, 0xC7, 0xAB, 0xC7, 0xCE, 0x08,
-    0x4F, 0xA1, 0x44, 0xD4, 0x71, 0x99, 0x36, 0x4F, 0xFA, 0x31, 0x30, 0x4B, 0x25, 0x0B, 0x7D, 0xC9,
-    0xCE, 0x68, 0x4D, 0x33, 0xC9, 0x9D, 0x9E, 0x3D, 0xD6, 0xFD, 0xC1, 0x07, 0xF9, 0x77, 0xB0, 0x11,
-    0xDF, 0x68, 0x5F, 0x35, 0x93, 0x98, 0xFE, 0x01, 0x7F, 0xCD, 0x0F, 0xCF, 0x78, 0x9C, 0x4D, 0x92,
-    0x3D, 0x4E, 0xC4, 0x40, 0x0C, 0x85, 0xBD, 0xFF, 0x12, 0xBF, 0x39, 0x01, 0xE2, 0x06, 0x6C, 0x03,
-    0x1D, 0x02, 0x89, 0x92, 0x22, 0x2D, 0x1D, 0x68, 0x45, 0x47, 0x01, 0x0D, 0xA2, 0xE5, 0x08, 0xDC,
-    0x60, 0xD1, 0x5E, 0x00, 0x5A, 0xAA, 0x94, 0x14, 0x14, 0x69, 0x11, 0x05, 0x8B, 0xD0, 0xB6, 0x28,
-    0x88, 0x05, 0x96, 0x85, 0x24, 0x0F, 0xDB, 0x19, 0x4F, 0xC6, 0x45, 0x34, 0x5F, 0xE2, 0x79, 0x7E,
-    0xB6, 0x43, 0xA4, 0x31, 0xB8, 0x7B, 0x43, 0x83, 0x5C, 0x44, 0x8F, 0xE0, 0x30, 0x8C, 0xE6, 0x08,
-    0x71, 0x82, 0x10, 0x2F, 0x15, 0xB2, 0x67, 0xF7, 0x51, 0x52, 0x93, 0x2D, 0xD3, 0x39, 0x63, 0x1A,
-    0x7A, 0x55, 0x9A, 0x02, 0x69, 0xD3, 0x13, 0x15, 0xC0, 0x62, 0x4D, 0x9C, 0x9B, 0xD4, 0x44, 0x2F,
-    0xC0, 0x5A, 0x80, 0xDF, 0x40, 0x37, 0xC0, 0x02, 0x69, 0x40, 0xEB, 0xC0, 0x69, 0x80, 0xAC, 0xB4,
-    0x1A, 0xE0, 0x2D, 0xB0, 0x40, 0x83, 0xA7, 0x72, 0x7C, 0xA2, 0x4E, 0xDE, 0x81, 0xDE, 0x48, 0x4D,
-    0x0F, 0x05, 0x3F, 0x80, 0xE3, 0xAA, 0x21, 0x6C, 0x33, 0x7E, 0x02, 0x73, 0x87, 0x68, 0x11, 0xCD,
-    0xF4, 0x90, 0x3E, 0x94, 0xFC, 0xDC, 0xA8, 0xBA, 0xC3, 0x3E, 0xD1, 0x6E, 0x0E, 0x31, 0xF0, 0xC7,
-    0x74, 0x68, 0x43, 0xE8, 0x12, 0xBF, 0xCC, 0x9A, 0x36, 0x85, 0x65, 0xC1, 0x1D, 0xDF, 0x4B, 0x2C,
-    0xDD, 0xF6, 0x2A, 0x3C, 0x92, 0xD2, 0xAC, 0x68, 0x06, 0x81, 0x71, 0x88, 0xAC, 0x1A, 0xE2, 0x0F,
-    0x1B, 0x29, 0x39, 0xC3, 0xC5, 0x17, 0xD0, 0x2E, 0x90, 0x19, 0xB2, 0xDF, 0x4E, 0x5E, 0x27, 0x0B,
-    0xFE, 0xD6, 0x28, 0xC9, 0x33, 0x6D, 0xC4, 0x86, 0xD8, 0x9A, 0x7A, 0x1B, 0xE2, 0xB2, 0xC1, 0xD3,
-    0x58, 0x72, 0x98, 0x73, 0x91, 0x6B, 0xEF, 0x99, 0x67, 0x7A, 0x43, 0x7D, 0xBF, 0x93, 0x2B, 0xED,
-    0xB4, 0xB0, 0x2D, 0xB0, 0xCA, 0x8A, 0x56, 0x8B, 0x35, 0xB7, 0x54, 0x51, 0xBE, 0xAC, 0xDA, 0x13,
-    0xA8, 0xDD, 0x88, 0xB3, 0xB3, 0x83, 0xBD, 0x7B, 0x38, 0xCD, 0x57, 0x9B, 0x2B, 0x3A, 0x7A, 0xA9,
-    0x70, 0x14, 0xFB, 0x0A, 0x12, 0x89, 0xFD, 0x20, 0x23, 0x99, 0x79, 0xD2, 0xF6, 0x6B, 0xEC, 0x9F,
-    0x5F, 0x6C, 0x56, 0xA7, 0x7F, 0x02, 0x9E, 0x16, 0x1B, 0x78, 0x9C, 0x95, 0xCE, 0xCD, 0x0D, 0xC1,
-    0x70, 0x00, 0x86, 0x71, 0x24, 0x12, 0x44, 0xC2, 0x08, 0x1D, 0xC1, 0x06, 0x3A, 0x82, 0x11, 0x6C,
-    0xA0, 0x1B, 0x58, 0xC1, 0x08, 0xDD, 0x80, 0x93, 0x8B, 0x4B, 0x47, 0xB0, 0x81, 0x6E, 0x20, 0xD5,
-    0x68, 0xFA, 0xA1, 0x1E, 0x6E, 0xDE, 0xFF, 0x7B, 0xF3, 0xDC, 0x9E, 0xDB, 0xAF, 0x21, 0x68, 0xD6,
-    0xFC, 0xF7, 0x93, 0xF3, 0xE5, 0x57, 0x0F, 0xC3, 0x81, 0xD4, 0x71, 0xD4, 0x5D, 0xC1, 0x5A, 0x3F,
-    0x85, 0xB9, 0xFE, 0x03, 0xC6, 0xFA, 0x0D, 0x37, 0xDD, 0x25, 0xEC, 0xF4, 0x13, 0x58, 0xE8, 0xE7,
-    0x5F, 0x8D, 0x7E, 0x65, 0x9A, 0x3E, 0xD4, 0x6C, 0x4C, 0x93, 0x99, 0xA6, 0x34, 0x4D, 0x17, 0x6A,
-    0x22, 0xD8, 0xEB, 0xA7, 0xA6, 0x29, 0x4C, 0x53, 0x9B, 0x86, 0x50, 0x93, 0x98, 0x26, 0x37, 0x4D,
-    0x65, 0x9A, 0x9E, 0xBB, 0x6E, 0x6C, 0x9A, 0xCC, 0x34, 0xA5, 0x69, 0x5A, 0x18, 0xC9, 0x46, 0xA6,
-    0x39, 0x98, 0xA6, 0x30, 0x4D, 0x6D, 0x9A, 0x77, 0xA8, 0xD9, 0x9A, 0xE6, 0x6A, 0x9A, 0x27, 0x4C,
-    0xF5, 0x5F, 0xA1, 0x26, 0x36, 0xCD, 0xC9, 0x34, 0xA5, 0x69, 0x5A, 0xD5, 0x7C, 0x00, 0x46, 0xC6,
-    0xB8, 0x9F, 0x78, 0x9C, 0x5D, 0x92, 0xCD, 0x2E, 0x83, 0x51, 0x10, 0x86, 0x47, 0xA5, 0x3F, 0xFE,
-    0x25, 0x16, 0x56, 0xA2, 0x7B, 0x0B, 0x4D, 0xAC, 0x24, 0x92, 0x4A, 0x24, 0xB5, 0x91, 0xE8, 0x15,
-    0x20, 0x6E, 0x80, 0x8D, 0xD8, 0x76, 0x63, 0xCB, 0x25, 0x70, 0x07, 0xB5, 0x10, 0x0B, 0x1B, 0x56,
-    0x96, 0x7E, 0xAA, 0xFB, 0x06, 0x17, 0xD0, 0x12, 0xAA, 0xB4, 0x5F, 0x5F, 0xEF, 0xCC, 0x99, 0xEF,
-    0xAB, 0x98, 0xCD, 0xC9, 0x73, 0xE6, 0xCC, 0xCF, 0x3B, 0x73, 0x44, 0x68, 0x85, 0x83, 0xC3, 0xD2,
-    0x90, 0xC4, 0x76, 0x01, 0x5A, 0x63, 0xD6, 0xA9, 0x8E, 0x60, 0x39, 0xA3, 0x8A, 0x13, 0xEE, 0xED,
-    0x7D, 0x27, 0x46, 0xCC, 0x91, 0x76, 0x34, 0x6E, 0x7D, 0xED, 0x52, 0xDD, 0xC4, 0x37, 0xA0, 0x99,
-    0xE6, 0x59, 0x23, 0x67, 0xEC, 0xED, 0xA2, 0xE5, 0xE8, 0x02, 0x93, 0x22, 0x7D, 0x20, 0x6D, 0xF8,
-    0x0C, 0x6C, 0x4A, 0x9E, 0x91, 0xA1, 0xDE, 0x3E, 0x70, 0x2A, 0x65, 0xE0, 0x24, 0xE0, 0x34, 0x70,
-    0xAD, 0x77, 0xDB, 0xDE, 0x4E, 0x9F, 0xEF, 0x2A, 0x1A, 0x11, 0x2C, 0x42, 0x53, 0xBD, 0x03, 0x6C,
-    0x68, 0xEC, 0x9E, 0xA3, 0xF6, 0xC1, 0xCC, 0xD5, 0x40, 0x05, 0x4B, 0x1A, 0x01, 0x41, 0xEA, 0x19,
-    0x50, 0x14, 0x69, 0x03, 0x63, 0x86, 0x1F, 0xC0, 0xB8, 0xC8, 0x8D, 0x56, 0xD7, 0xB7, 0x6C, 0x6F,
-    0x58, 0x24, 0xCF, 0x63, 0x83, 0x47, 0xC7, 0x73, 0xBE, 0x52, 0xCA, 0xDD, 0x15, 0x53, 0x20, 0xAB,
-    0x98, 0xEF, 0xB9, 0xFA, 0x2D, 0xF9, 0x3B, 0x9D, 0x86, 0xCF, 0xF2, 0xDB, 0xBD, 0x2B, 0x46, 0x4F,
-    0xC9, 0xAC, 0xB2, 0xA1, 0x19, 0x1C, 0xCF, 0xC8, 0x6E, 0x2F, 0x14, 0x7C, 0xF1, 0xBA, 0xE5, 0xE0,
-    0xEE, 0xDA, 0xC4, 0xC2, 0x7D, 0x51, 0x2F, 0x5D, 0xC2, 0xAA, 0x2A, 0x62, 0x8F, 0xF3, 0x2E, 0xF0,
-    0x87, 0x5D, 0x72, 0xCC, 0xA3, 0x8E, 0xD4, 0x90, 0xFB, 0x8C, 0x43, 0x45, 0x5A, 0x94, 0xF4, 0x65,
-    0x3A, 0xCC, 0x1E, 0x38, 0x77, 0x0A, 0x49, 0x39, 0x32, 0xCD, 0xD4, 0x3F, 0x6F, 0x3B, 0xDE, 0x89,
-    0xC5, 0x4E, 0x30, 0xDD, 0x88, 0xE3, 0x3B, 0x8B, 0xB4, 0x6C, 0x6F, 0xE2, 0x7B, 0xCF, 0x9E, 0x27,
-    0x3B, 0x52, 0x2D, 0x29, 0xB6, 0xE6, 0xC1, 0x8F, 0xBA, 0x32, 0x95, 0x10, 0x14, 0xF5, 0x6D, 0xEF,
-    0xDC, 0x32, 0xAA, 0xA5, 0xA5, 0xA3, 0x28, 0x7C, 0x06, 0x9D, 0xAF, 0x9B, 0x25, 0xA9, 0x25, 0x98,
-    0x89, 0x0B, 0x98, 0x2D, 0xF8, 0x2F, 0xB8, 0x55, 0x68, 0x2E, 0x4B, 0x6C, 0x83, 0x1F, 0xFB, 0x0B,
-    0x9E, 0xC8, 0x3D, 0x89, 0x78, 0x9C, 0x55, 0x91, 0xBD, 0x4A, 0xC4, 0x40, 0x14, 0x85, 0x6F, 0x92,
-    0x65, 0x55, 0xFC, 0xC1, 0x42, 0xB4, 0xD4, 0x17, 0x10, 0xF3, 0x0C, 0x82, 0x75, 0x5A, 0x2B, 0xB1,
-    0x10, 0x2C, 0x5D, 0x1B, 0x3B, 0xD1, 0x37, 0x50, 0xD0, 0x5E, 0x2B, 0x5B, 0xF5, 0x01, 0xD4, 0xC5,
-    0x07, 0x70, 0x15, 0x2C, 0xB6, 0x5B, 0x2B, 0xAB, 0x85, 0x80, 0xB0, 0xBA, 0x26, 0x9B, 0x1C, 0xEF,
-    0x9D, 0x3B, 0x33, 0x19, 0x0F, 0x64, 0x92, 0x6F, 0x26, 0x33, 0xF7, 0xDC, 0x33, 0x44, 0xAC, 0xCD,
-    0xA3, 0xFD, 0x25, 0x72, 0x5A, 0xEC, 0x83, 0x75, 0xEC, 0xF0, 0x13, 0x46, 0x3B, 0x4A, 0x77, 0xB0,
-    0x9A, 0x36, 0x38, 0x71, 0x78, 0xE5, 0x16, 0x6F, 0xB7, 0xF6, 0x4A, 0x7E, 0x4D, 0x31, 0x8E, 0x98,
-    0x22, 0xA2, 0xB4, 0x02, 0x36, 0x18, 0x6B, 0xBB, 0xE9, 0x8D, 0xA7, 0x89, 0x76, 0xCD, 0x28, 0xE5,
-    0x78, 0x3E, 0xA1, 0x57, 0x60, 0x55, 0x2B, 0x7C, 0x03, 0x33, 0xF4, 0x25, 0x83, 0x11, 0x2F, 0x2C,
-    0xC8, 0x5C, 0x4B, 0xB1, 0x03, 0x64, 0xF4, 0x0B, 0x38, 0xAF, 0xC0, 0x19, 0x95, 0x18, 0x38, 0xB3,
-    0x35, 0x9E, 0xA8, 0xE2, 0xC7, 0xAA, 0x40, 0x6E, 0xA6, 0xAC, 0xC6, 0xBC, 0x2F, 0xC0, 0x1F, 0x20,
-    0xAA, 0xD0, 0x73, 0xC8, 0x45, 0xE2, 0xD2, 0x9F, 0x2C, 0x98, 0x70, 0xA1, 0xD8, 0x22, 0x7F, 0xB6,
-    0x46, 0xDA, 0x97, 0x88, 0x5B, 0x4C, 0xD8, 0xE4, 0xBC, 0xD2, 0x9A, 0x60, 0x17, 0x38, 0x50, 0xEC,
-    0x0A, 0x72, 0x83, 0xB9, 0x6E, 0x96, 0x3C, 0x62, 0xB6, 0x85, 0x75, 0xA1, 0x67, 0x89, 0x2B, 0x92,
-    0x70, 0xB0, 0x42, 0x74, 0x61, 0xD2, 0x23, 0xBA, 0x96, 0xD7, 0xCB, 0x90, 0x87, 0x09, 0x7B, 0xD6,
-    0x3D, 0xA2, 0x6C, 0x6C, 0x9A, 0x3B, 0x57, 0x1A, 0x24, 0x85, 0xA6, 0xF6, 0x6E, 0xEF, 0xA0, 0xC2,
-    0x89, 0x29, 0x71, 0x39, 0xC4, 0xE3, 0xB2, 0xB8, 0xCA, 0xA8, 0x51, 0xEA, 0x33, 0x35, 0x3A, 0x05,
-    0xE6, 0x02, 0xFC, 0x68, 0x9A, 0x21, 0xBD, 0xAC, 0x38, 0xC0, 0x20, 0x26, 0x32, 0xEE, 0xC2, 0x83,
-    0x39, 0x8B, 0xD9, 0x86, 0xEE, 0xB9, 0xD1, 0xC8, 0xD3, 0x61, 0x1D, 0xFC, 0x9B, 0xDE, 0x88, 0xCD,
-    0xB6, 0x42, 0xBF, 0x36, 0xA6, 0x6D, 0x46, 0x7C, 0x37, 0xDA, 0xD1, 0x3F, 0xF4, 0x8E, 0x04, 0x7B,
-    0x6D, 0x7F, 0x6A, 0x91, 0x3F, 0x6C, 0xBB, 0x1A, 0x7F, 0xA9, 0x1B, 0x12, 0xA1, 0x78, 0x9C, 0x63,
-    0x70, 0x62, 0x66, 0x58, 0xF0, 0xFF, 0x3E, 0xD3, 0xF7, 0xFF, 0xFF, 0x79, 0xFE, 0xFC, 0xFF, 0x2F,
-    0x0F, 0xC2, 0x3F, 0xFE, 0xFF, 0xE7, 0x3D, 0xF8, 0xFF, 0x3D, 0x0B, 0x43, 0x89, 0x28, 0x03, 0x55,
-    0x81, 0x13, 0x13, 0xD0, 0xAE, 0xF3, 0x20, 0xBB, 0xB8, 0x81, 0xF6, 0xF0, 0xFF, 0x05, 0xDA, 0xF5,
-    0x13, 0x68, 0xD7, 0xC5, 0xFF, 0xEF, 0x99, 0x19, 0x4A, 0x45, 0x19, 0x00, 0x0B, 0x2F, 0x24, 0x5F,
-    0x78, 0x9C, 0x63, 0x60, 0x70, 0x64, 0x66, 0x60, 0x48, 0xF8, 0xFF, 0x9E, 0x95, 0xE1, 0xF3, 0xFF,
-    0xFF, 0xF2, 0x0C, 0x3F, 0xFE, 0xFF, 0x8F, 0x07, 0x11, 0xF9, 0x0C, 0x5F, 0xFE, 0xFF, 0xD7, 0x67,
-    0x98, 0xF0, 0xFF, 0x3F, 0x3B, 0x03, 0x43, 0xB2, 0x1A, 0x03, 0xAD, 0xC1, 0x86, 0xFF, 0xFF, 0xF9,
-    0xB0, 0x10, 0xBC, 0x10, 0xE2, 0xC0, 0xFF, 0xFF, 0xDC, 0x0C, 0x1F, 0xFE, 0xFF, 0xE7, 0x00, 0x39,
-    0x92, 0x05, 0xE8, 0xBE, 0xF7, 0x0C, 0x0C, 0xFF, 0xFE, 0xF7, 0x03, 0xDD, 0x0D, 0x74, 0xF2, 0x03,
-    0x90, 0x1B, 0x7F, 0xFC, 0x3F, 0xCF, 0x00, 0x74, 0xAD, 0x1C, 0xD0, 0xA8, 0x23, 0x4C, 0x0C, 0x0C,
-    0x00, 0x26, 0x4A, 0x3B, 0xC8, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x03, 0x85, 0x48, 0x04, 0xDB, 0xE0,
-    0x57, 0x3E, 0x9C, 0xED, 0xF0, 0xFB, 0x3F, 0x9C, 0x13, 0xF0, 0xE7, 0x3F, 0x9C, 0x93, 0xF0, 0xF7,
-    0x3F, 0x9C, 0x53, 0xF0, 0xEF, 0x3F, 0x9C, 0xD3, 0x08, 0x62, 0xFE, 0xBF, 0xCF, 0x0E, 0x62, 0x4F,
-    0x02, 0xB3, 0xF7, 0xB3, 0x80, 0xD8, 0x8B, 0xC1, 0xEC, 0x3E, 0x46, 0x10, 0x7B, 0x0B, 0x98, 0x1D,
-    0x03, 0x56, 0x7F, 0x14, 0xCC, 0xB6, 0x04, 0xB3, 0xAF, 0x82, 0xB5, 0x8A, 0x43, 0x0C, 0x05, 0xB1,
-    0xD7, 0xB3, 0x30, 0xC0, 0x39, 0x10, 0xAD, 0x50, 0x4E, 0x2E, 0x03, 0x12, 0xE7, 0xFF, 0x7C, 0x26,
-    0x28, 0x07, 0x6C, 0xC0, 0x79, 0x56, 0x28, 0xEF, 0x08, 0x88, 0xF7, 0x5E, 0x03, 0xCA, 0xDB, 0x0C,
-    0xB6, 0xC8, 0x1B, 0xCA, 0x5B, 0x04, 0xE6, 0xD5, 0x41, 0xCD, 0x84, 0x38, 0x14, 0x66, 0x5B, 0x23,
-    0xD8, 0x3B, 0xF7, 0xD9, 0x30, 0x3D, 0x87, 0xEA, 0x6D, 0xD4, 0x00, 0x41, 0x0D, 0x2A, 0xD4, 0x40,
-    0x04, 0x05, 0x2F, 0x00, 0xBD, 0xAC, 0x7F, 0x4A, 0x78, 0x9C, 0xFB, 0xFA, 0x1F, 0x09, 0xB0, 0x7E,
-    0x25, 0x93, 0xC7, 0x40, 0x67, 0x40, 0xAE, 0x3B, 0x51, 0x79, 0x00, 0x25, 0xBA, 0x81, 0x4D, 0x78,
-    0x9C, 0xCB, 0x62, 0x40, 0x06, 0x7F, 0xFB, 0x18, 0x91, 0x79, 0xFF, 0xE7, 0x33, 0x21, 0xF3, 0xFE,
-    0xEF, 0x67, 0x41, 0xE6, 0xFD, 0xBF, 0xCF, 0x86, 0xCC, 0xFB, 0xFF, 0x5E, 0x1C, 0xCA, 0x2B, 0x04,
-    0x73, 0xFF, 0x6B, 0x42, 0xB9, 0x06, 0xBF, 0xC0, 0x5C, 0x6F, 0x98, 0xE2, 0x63, 0x60, 0x6E, 0x2C,
-    0x8C, 0x3B, 0x19, 0xCC, 0xAD, 0x83, 0x59, 0x9C, 0xF0, 0x07, 0xC4, 0x85, 0x5B, 0xAC, 0xF0, 0x02,
-    0xC4, 0xDD, 0x0F, 0x77, 0xC7, 0x56, 0x10, 0x97, 0x03, 0xEE, 0x8C, 0x26, 0x20, 0x8F, 0x17, 0xCE,
-    0x5B, 0x82, 0xC4, 0x13, 0xB8, 0x8E, 0xA4, 0xD2, 0x01, 0xEC, 0x84, 0xF5, 0x4C, 0x48, 0xCE, 0xEB,
-    0x67, 0x84, 0x6B, 0x01, 0xDA, 0x8E, 0xA4, 0xE5, 0x7F, 0x0C, 0x92, 0x96, 0xFF, 0xD6, 0x58, 0x7C,
-    0x84, 0xEA, 0x5B, 0x8C, 0x90, 0x40, 0x09, 0x25, 0x94, 0x10, 0x44, 0x09, 0xDD, 0x2C, 0x06, 0x64,
-    0x00, 0x00, 0xCB, 0x35, 0x81, 0x66, 0x78, 0x9C, 0xB5, 0x52, 0xBB, 0x0E, 0x01, 0x51, 0x10, 0x1D,
-    0x44, 0x90, 0x15, 0xB6, 0xD4, 0x08, 0x5F, 0x40, 0xA7, 0xA5, 0xD2, 0x89, 0xFD, 0x03, 0x89, 0xE8,
-    0xE9, 0x94, 0xE8, 0x94, 0x3E, 0xC1, 0x17, 0xF0, 0x09, 0xFC, 0x81, 0xF8, 0x02, 0x1A, 0x8D, 0x86,
-    0xAC, 0xD8, 0x78, 0xEE, 0x31, 0xBB, 0xF7, 0xB1, 0x57, 0xA1, 0x74, 0x8A, 0x3B, 0x73, 0x76, 0x66,
-    0xEE, 0x39, 0x73, 0xB3, 0x44, 0x44, 0x76, 0x6F, 0xD8, 0x8C, 0x93, 0xC0, 0xE4, 0x0D, 0xE0, 0x54,
-    0x08, 0xF3, 0x31, 0x04, 0xD2, 0x41, 0xCF, 0x4B, 0x92, 0x15, 0x93, 0x2D, 0x14, 0x2C, 0xA2, 0x27,
-    0x87, 0xC5, 0xF4, 0xC8, 0xE7, 0x88, 0x1C, 0x3E, 0x5B, 0xDC, 0x70, 0xE0, 0x18, 0x5B, 0x8B, 0x66,
-    0x2A, 0xFB, 0x40, 0xCA, 0x05, 0x72, 0xE1, 0xA5, 0x57, 0x20, 0xEB, 0xF1, 0x87, 0x90, 0xEC, 0x81,
-    0xFC, 0x1D, 0x48, 0x84, 0x64, 0x0E, 0x54, 0x1F, 0x3C, 0xA7, 0xB4, 0xEB, 0xA4, 0x30, 0x00, 0xDA,
-    0x9A, 0x7C, 0x55, 0x78, 0xA6, 0xA4, 0xC9, 0x5E, 0x69, 0x48, 0x9D, 0x8C, 0x26, 0xBE, 0xD2, 0x10,
-    0x23, 0x4B, 0x5D, 0xB8, 0xB1, 0xA6, 0xA1, 0x22, 0x6D, 0x31, 0x3C, 0x69, 0x3E, 0x40, 0xB0, 0x55,
-    0x51, 0x91, 0x0B, 0xB0, 0x8B, 0xC9, 0xDC, 0xE6, 0x7B, 0x2B, 0xAA, 0xC0, 0xEB, 0x9E, 0xE2, 0xC6,
-    0x78, 0x64, 0x92, 0xBB, 0x92, 0x2A, 0x6F, 0x00, 0x1B, 0x5D, 0x98, 0x01, 0x1D, 0x4D, 0xD6, 0x3F,
-    0x57, 0x39, 0xF3, 0x93, 0x99, 0xC4, 0xA2, 0xFF, 0xC0, 0x3E, 0xAE, 0xF4, 0x02, 0x81, 0x9D, 0xC8,
-    0x81, 0x6B, 0x1A, 0xE5, 0x17, 0xE8, 0x9B, 0x76, 0xA2, 0x45, 0x1D, 0xF1, 0xAF, 0x48, 0x74, 0x6B,
-    0x22, 0x7E, 0x00, 0xE1, 0xB4, 0xA5, 0xF7, 0x78, 0x9C, 0x6D, 0x54, 0xBF, 0x6B, 0x53, 0x51, 0x14,
-    0xBE, 0x49, 0x6C, 0x1A, 0x35, 0x35, 0x0F, 0xC1, 0xB9, 0xCF, 0x55, 0x90, 0x66, 0x13, 0x5C, 0xCC,
-    0xE4, 0xA6, 0xCD, 0x7F, 0xD0, 0x82, 0x5B, 0x41, 0x14, 0xE9, 0x24, 0x62, 0xD1, 0x7F, 0xC0, 0x4C,
-    0x2E, 0x0E, 0x56, 0xBA, 0x08, 0x8A, 0x16, 0xBA, 0x09, 0x92, 0x16, 0x1C, 0xC4, 0xC1, 0x14, 0x1C,
-    0x1D, 0x12, 0xC4, 0x45, 0x41, 0xD3, 0xF6, 0xB5, 0x49, 0x9A, 0x1F, 0xEF, 0xF3, 0xDC, 0xFB, 0x9D,
-    0xDB, 0x97, 0xF7, 0xEA, 0x59, 0xEE, 0x79, 0xEF, 0xBB, 0xF7, 0x9C, 0xEF, 0x7C, 0xF7, 0xDC, 0x63,
-    0x8C, 0xB7, 0xD5, 0x2F, 0x31, 0xBA, 0x6F, 0xAF, 0x99, 0xAC, 0xD5, 0x86, 0xA0, 0xBD, 0x3F, 0x93,
-    0x06, 0x96, 0x27, 0xF0, 0xD6, 0x9E, 0x49, 0x9D, 0x48, 0x00, 0xA0, 0x55, 0x98, 0x42, 0x8E, 0xE5,
-    0xC7, 0xBB, 0x9B, 0x17, 0xCD, 0xE5, 0xD5, 0xDF, 0xE2, 0xAD, 0x25, 0xC0, 0x8E, 0x7C, 0x5E, 0x57,
-    0x7F, 0x43, 0xFC, 0x73, 0x1E, 0x08, 0x63, 0xE0, 0xCA, 0xC9, 0xB6, 0x27, 0xC2, 0xC2, 0xFB, 0x3F,
-    0x80, 0xDB, 0x53, 0xA1, 0xBF, 0x01, 0x67, 0xE9, 0x05, 0x13, 0xB4, 0x72, 0xD3, 0x7C, 0x46, 0x58,
-    0xA2, 0xB3, 0x09, 0x9C, 0x4F, 0x95, 0xB0, 0x0D, 0x70, 0x67, 0x1F, 0xAD, 0x74, 0x71, 0x12, 0xC4,
-    0x71, 0x08, 0x81, 0x0B, 0x69, 0xC4, 0x44, 0xB8, 0xA1, 0xC1, 0x0A, 0x19, 0xA4, 0x81, 0xA6, 0x5D,
-    0x0E, 0xF1, 0x2C, 0x03, 0x98, 0x00, 0xC8, 0xCB, 0x32, 0xF6, 0xC1, 0xAA, 0x9F, 0xE3, 0xF6, 0x0A,
-    0xDD, 0x21, 0x4A, 0x22, 0x19, 0x50, 0x64, 0xBD, 0x4E, 0xED, 0xC7, 0x9A, 0x68, 0xCE, 0xA6, 0xE9,
-    0x72, 0xDF, 0x4F, 0xEA, 0x79, 0xD5, 0xFA, 0xBB, 0x58, 0x30, 0x66, 0x5F, 0x05, 0xAC, 0x7B, 0xA9,
-    0x49, 0xE1, 0x9E, 0x31, 0x3D, 0xCC, 0x1B, 0x12, 0xC1, 0xDD, 0x7C, 0xD8, 0x27, 0x52, 0xB7, 0xD2,
-    0x8D, 0x51, 0x76, 0x74, 0x62, 0xA7, 0xE3, 0x3A, 0x63, 0x87, 0x68, 0x5B, 0x82, 0x8E, 0xC0, 0x3A,
-    0xB5, 0xDF, 0x54, 0x3D, 0xE4, 0x68, 0x9D, 0xD4, 0x85, 0x4D, 0x9B, 0xA9, 0x5D, 0x8D, 0x66, 0x82,
-    0x7C, 0x83, 0x81, 0x25, 0xE8, 0xA2, 0x5D, 0x3A, 0x78, 0xE9, 0x3E, 0x47, 0x28, 0x6C, 0x73, 0x53,
-    0xA8, 0x7A, 0xEF, 0xA9, 0x20, 0x43, 0xCC, 0xA8, 0x2B, 0x47, 0x5D, 0xCB, 0xEC, 0x5B, 0xBA, 0x62,
-    0x03, 0x14, 0xD5, 0xED, 0x68, 0xBD, 0x91, 0x5E, 0xDA, 0x31, 0x8A, 0x11, 0xE3, 0x47, 0x9A, 0xF9,
-    0x90, 0xFA, 0x0B, 0x32, 0xAB, 0x6E, 0x5F, 0x95, 0xE8, 0x59, 0x59, 0x78, 0x46, 0x25, 0x18, 0xEA,
-    0xDE, 0x3E, 0x2A, 0x09, 0x52, 0x21, 0xFF, 0x79, 0xFD, 0x53, 0xF1, 0xDC, 0x74, 0x93, 0xBF, 0xF1,
-    0xA1, 0x95, 0x9F, 0xF5, 0x10, 0x11, 0x8D, 0xCA, 0x5A, 0x70, 0x59, 0x35, 0xC8, 0x65, 0x10, 0xED,
-    0xDC, 0x40, 0x8A, 0x60, 0x1E, 0x2F, 0x81, 0xD1, 0xF6, 0xAC, 0x49, 0x11, 0x47, 0x8E, 0x66, 0xA8,
-    0x67, 0x64, 0x2D, 0x51, 0x92, 0x35, 0x2D, 0x2D, 0x50, 0x06, 0x72, 0x17, 0xB3, 0x94, 0x64, 0xC1,
-    0x1C, 0x50, 0x0E, 0x90, 0xF5, 0x81, 0x9E, 0x39, 0x92, 0x10, 0x7B, 0x2C, 0x7E, 0xEC, 0x17, 0xE6,
-    0x99, 0x88, 0xBE, 0xBB, 0x7C, 0x2C, 0x03, 0x74, 0x73, 0x4E, 0x71, 0x57, 0x4F, 0xC3, 0x5E, 0x63,
-    0x83, 0x22, 0x47, 0xB6, 0x9D, 0xC2, 0x91, 0x20, 0x4B, 0x6E, 0x9F, 0xC8, 0xBC, 0xCC, 0xAE, 0x96,
-    0x87, 0x81, 0x8F, 0x63, 0x34, 0x23, 0xDB, 0x16, 0x9F, 0x5C, 0xB6, 0x80, 0x6C, 0xAA, 0xEC, 0xB5,
-    0xB2, 0x90, 0x83, 0xBC, 0xCD, 0x26, 0x93, 0xCE, 0x91, 0x8D, 0x58, 0x33, 0x17, 0xF0, 0xF9, 0x97,
-    0xA8, 0xBB, 0xBB, 0xBA, 0xAA, 0xFC, 0xEA, 0xCA, 0xE9, 0x57, 0x16, 0xB8, 0x65, 0x78, 0xF3, 0xBC,
-    0xCD, 0xDA, 0xEB, 0x17, 0xAE, 0x13, 0x1E, 0x7C, 0x78, 0xA3, 0xB3, 0x47, 0x98, 0x66, 0x26, 0x8D,
-    0xB7, 0xFF, 0x3C, 0x46, 0x6F, 0x03, 0x6D, 0xBE, 0xD3, 0xD6, 0x51, 0x2A, 0xA7, 0xAD, 0x9A, 0x1A,
-    0x41, 0x29, 0xEB, 0x9D, 0x4C, 0x93, 0xAC, 0xDD, 0x97, 0x69, 0x97, 0xD0, 0x4B, 0xCD, 0x19, 0x79,
-    0x68, 0x4D, 0x0F, 0x6D, 0x54, 0xA6, 0x91, 0x9A, 0x28, 0xD5, 0x5D, 0xB1, 0xCF, 0xE8, 0xCE, 0x2F,
-    0x3F, 0x8C, 0xD4, 0x9C, 0x24, 0xF8, 0xFB, 0xC7, 0x4D, 0xD8, 0x74, 0xAA, 0xAD, 0x64, 0x8A, 0x66,
-    0x79, 0x3E, 0x8D, 0x15, 0x78, 0x94, 0xCB, 0x20, 0x26, 0x7C, 0xFE, 0x3D, 0xC6, 0xD7, 0x87, 0x97,
-    0x92, 0x3F, 0xFF, 0x00, 0xBB, 0x9E, 0xD9, 0x4A, 0x78, 0x9C, 0x65, 0x93, 0xED, 0x51, 0x02, 0x31,
-    0x10, 0x86, 0x83, 0xDF, 0xF8, 0xC1, 0xD0, 0x81, 0x76, 0x20, 0x1D, 0x78, 0x1D, 0x68, 0x07, 0xDA,
-    0x81, 0x74, 0xE0, 0x75, 0x20, 0x1D, 0x40, 0x07, 0xD2, 0x01, 0x76, 0xC0, 0x35, 0xE0, 0x60, 0x07,
-    0x20, 0x07, 0x0C, 0x27, 0x90, 0xD7, 0xDD, 0x4B, 0x72, 0xD9, 0x8D, 0xEF, 0x9F, 0xBB, 0x3C, 0x33,
-    0xB7, 0xC9, 0xE6, 0xD9, 0x33, 0xC6, 0xA5, 0x07, 0x3C, 0x9B, 0x34, 0x03, 0x60, 0xF2, 0x0F, 0x2E,
-    0x00, 0xB4, 0x52, 0xB8, 0x26, 0x78, 0x9E, 0xC2, 0x1D, 0xC1, 0x9B, 0x84, 0x75, 0x89, 0xE1, 0x31,
-    0x81, 0x39, 0xC3, 0x8F, 0x04, 0x16, 0xC0, 0x01, 0x48, 0xE0, 0x0A, 0x28, 0x81, 0x33, 0x0D, 0x7F,
-    0x31, 0x1D, 0x01, 0xD7, 0x1A, 0x02, 0xAF, 0x19, 0x70, 0xAF, 0xD8, 0x0B, 0x70, 0x6B, 0x2C, 0xDE,
-    0x15, 0xFC, 0x04, 0xAE, 0x4C, 0x85, 0xB9, 0x82, 0x4B, 0xE0, 0xD4, 0xD0, 0x4E, 0x27, 0x12, 0x6E,
-    0xF9, 0x38, 0x74, 0xAC, 0x4B, 0x09, 0x2D, 0x86, 0xC6, 0xF4, 0xB9, 0x70, 0x0C, 0x6D, 0xFC, 0x50,
-    0xB7, 0xFA, 0x26, 0x20, 0x1D, 0xB1, 0x43, 0x8F, 0x3D, 0x66, 0x02, 0xFE, 0x00, 0x17, 0xF4, 0xD8,
-    0x00, 0xC7, 0x11, 0xD2, 0xEA, 0xC8, 0xD4, 0x17, 0xDD, 0x8E, 0xF0, 0x80, 0xA9, 0xA8, 0xE2, 0xD2,
-    0xF3, 0x3B, 0x64, 0x52, 0xDE, 0x20, 0x9C, 0xC5, 0x0A, 0x79, 0xDF, 0xDC, 0x24, 0xA7, 0x12, 0xF2,
-    0xD6, 0xDC, 0x24, 0xA7, 0x14, 0xF2, 0x76, 0xE1, 0xCE, 0x8B, 0x28, 0xAF, 0xDB, 0xD8, 0xE9, 0xD7,
-    0x9D, 0x85, 0x57, 0xEF, 0xF1, 0x2E, 0xCA, 0xA3, 0x8F, 0x66, 0x5F, 0x2E, 0x68, 0xE4, 0x95, 0x90,
-    0xF1, 0xF2, 0x2A, 0x05, 0xBD, 0x3C, 0xC5, 0xBC, 0xBC, 0x27, 0x0D, 0x9D, 0xBC, 0xB1, 0xBC, 0x70,
-    0xEB, 0xE5, 0x2D, 0x43, 0x93, 0xBE, 0x7E, 0x2D, 0x6F, 0x2B, 0xC7, 0xA5, 0xF4, 0xF2, 0xAC, 0x1C,
-    0xAC, 0xC2, 0xD5, 0xCA, 0xD4, 0x08, 0xE6, 0xEE, 0x6A, 0x47, 0x6A, 0x58, 0xA9, 0x51, 0x96, 0xB7,
-    0x90, 0x0E, 0xD8, 0x28, 0xCB, 0xDB, 0x28, 0x5B, 0x7E, 0xB9, 0x57, 0x5E, 0xD9, 0x76, 0x27, 0x14,
-    0x69, 0x32, 0x66, 0x79, 0xB9, 0x9E, 0x15, 0x6E, 0x7A, 0xC2, 0xD2, 0xF4, 0xFC, 0xF2, 0x9F, 0xF7,
-    0x07, 0x74, 0x48, 0x1D, 0x1C, 0x78, 0x9C, 0x5D, 0xD0, 0x4D, 0x6A, 0xC2, 0x50, 0x14, 0x05, 0xE0,
-    0x44, 0x52, 0x35, 0xA6, 0x42, 0x37, 0x20, 0x3A, 0x72, 0xAA, 0x0B, 0x10, 0xDA, 0xA1, 0xB3, 0xBA,
-    0x03, 0x2B, 0x9D, 0x3A, 0xE8, 0x0E, 0xE2, 0xC0, 0xB9, 0x2E, 0x40, 0x04, 0xC1, 0xB9, 0x2B, 0x10,
-    0xDD, 0x41, 0xBA, 0x01, 0x0D, 0xD2, 0x79, 0x05, 0xFF, 0x28, 0x54, 0x73, 0x7A, 0xF3, 0x8A, 0x7A,
-    0xDE, 0xBD, 0xA3, 0x7C, 0xE1, 0x71, 0x7F, 0xCE, 0x19, 0xFF, 0xB5, 0x1E, 0x55, 0x9D, 0xB4, 0xCE,
-    0xB8, 0x55, 0x57, 0x19, 0x0D, 0x65, 0x78, 0xC6, 0xDF, 0x69, 0x19, 0x3F, 0x1B, 0x67, 0x4C, 0xA3,
-    0xBE, 0x38, 0x26, 0x3B, 0x13, 0xF9, 0x91, 0x25, 0x3B, 0xBF, 0xC0, 0x23, 0x7B, 0x07, 0x94, 0xD9,
-    0x4B, 0xE0, 0x95, 0x3D, 0x04, 0xDA, 0xEC, 0x1E, 0x10, 0xB2, 0x3F, 0x94, 0xF5, 0xFB, 0x4F, 0xA0,
-    0xC6, 0x3E, 0x02, 0x45, 0x72, 0x25, 0x01, 0x1E, 0xC8, 0x5F, 0xC0, 0x82, 0xF6, 0x9F, 0xCA, 0xFA,
-    0x25, 0xE3, 0xE4, 0x7A, 0x7E, 0xE4, 0xDA, 0x79, 0xE4, 0xED, 0x7C, 0x06, 0xAE, 0xCA, 0x6B, 0xA0,
-    0xF3, 0x2B, 0xDD, 0xFB, 0x3F, 0xBD, 0x4B, 0x1C, 0xB1, 0x4B, 0xF3, 0xEB, 0x32, 0x27, 0xE0, 0x7D,
-    0x37, 0xEA, 0x9E, 0x17, 0xD9, 0x80, 0xED, 0x5C, 0xE4, 0x9B, 0xFD, 0x23, 0x81, 0xB3, 0x4F, 0x80,
-    0xCF, 0x3E, 0x00, 0x05, 0xF6, 0x5E, 0xF9, 0xA8, 0xDE, 0x4B, 0xBF, 0x9C, 0x9A, 0xE7, 0x91, 0xDF,
-    0xE4, 0x22, 0xDE, 0x47, 0xDA, 0xCD, 0xC8, 0xAD, 0xC4, 0xCA, 0xBF, 0x93, 0x26, 0xE1, 0xA7, 0x8E,
-    0x57, 0x52, 0x26, 0xD4, 0x48, 0xE5, 0x13, 0xD8, 0x0E, 0xED, 0xFC, 0xC6, 0x9C, 0xEF, 0x76, 0xDE,
-    0x34, 0x6D, 0xFF, 0x00, 0x5A, 0x67, 0x70, 0x3C, 0x78, 0x9C, 0x9D, 0x92, 0xAD, 0x4E, 0x43, 0x41,
-    0x10, 0x85, 0xA7, 0xFC, 0x84, 0xF6, 0x02, 0x01, 0x8D, 0x00, 0x1E, 0x80, 0xA4, 0xB7, 0x4F, 0x00,
-    0x41, 0x90, 0x20, 0xB0, 0x20, 0x08, 0x09, 0x06, 0x82, 0x44, 0xB5, 0x0E, 0x90, 0x75, 0x48, 0x64,
-    0xEB, 0xEA, 0xA0, 0x8F, 0x00, 0x0E, 0xD7, 0x47, 0xA8, 0x46, 0xF1, 0x57, 0x68, 0x4B, 0x0B, 0x87,
-    0xB3, 0xBB, 0x77, 0xEF, 0xEE, 0xB2, 0x55, 0x8C, 0xD9, 0xCD, 0x77, 0x67, 0xCF, 0x9C, 0x99, 0x3B,
-    0x22, 0x3A, 0x2A, 0xD5, 0xDA, 0xFE, 0x94, 0xB8, 0x58, 0x7F, 0x84, 0x8A, 0x43, 0x07, 0xBE, 0x60,
-    0xE2, 0xC2, 0x92, 0x3E, 0x6C, 0x6C, 0x18, 0xD0, 0xCE, 0x01, 0x9E, 0xA7, 0x35, 0x19, 0xF3, 0xDA,
-    0x39, 0x3B, 0xBD, 0xF9, 0xE6, 0x59, 0xB6, 0x29, 0x97, 0x05, 0x5E, 0xD2, 0x11, 0x93, 0x32, 0x95,
-    0x8E, 0x29, 0x7C, 0xCE, 0x6F, 0x25, 0x16, 0xE2, 0xB1, 0xE0, 0x4A, 0xF0, 0x59, 0x13, 0xE8, 0xDA,
-    0xA2, 0x14, 0x68, 0x88, 0xBC, 0x01, 0x9B, 0x96, 0xA4, 0xCC, 0x17, 0x19, 0x02, 0x49, 0xEE, 0x95,
-    0x65, 0x67, 0xE5, 0x07, 0x70, 0x0D, 0x7D, 0x52, 0x7A, 0x8B, 0x95, 0x5C, 0x83, 0x94, 0x58, 0xBC,
-    0xA2, 0x19, 0x47, 0x5E, 0x80, 0xA5, 0x7B, 0x4F, 0x58, 0xE4, 0xB8, 0x5E, 0x2F, 0x2A, 0x2A, 0x41,
-    0xBC, 0xF2, 0x65, 0x48, 0xA8, 0x35, 0x1F, 0x92, 0xDE, 0x24, 0x92, 0x44, 0xA4, 0x14, 0x92, 0x8F,
-    0x7F, 0x91, 0x58, 0x67, 0x62, 0xAD, 0x3F, 0x7E, 0x62, 0xCF, 0x71, 0x5F, 0x71, 0xEF, 0xF1, 0x7C,
-    0xE2, 0x19, 0x86, 0x73, 0x7E, 0x57, 0xAA, 0xF0, 0xFF, 0x45, 0x5F, 0xF9, 0x1D, 0xFA, 0xA6, 0xB9,
-    0x1E, 0x33, 0x2A, 0xB1, 0x6C, 0x41, 0xAA, 0x97, 0xA3, 0xED, 0x09, 0xF1, 0x7E, 0x6D, 0x76, 0x23,
-    0x71, 0x32, 0x6B, 0x3C, 0x06, 0xC0, 0x9D, 0x01, 0x6A, 0x7F, 0xE6, 0x4C, 0x2A, 0x8E, 0xB4, 0xCA,
-    0x28, 0x13, 0x58, 0x56, 0xFB, 0x77, 0x7B, 0x70, 0xD2, 0xE2, 0x4E, 0x60, 0x55, 0x27, 0x3F, 0xB8,
-    0x5D, 0xED, 0x66, 0xD6, 0x06, 0x39, 0x59, 0xB1, 0x36, 0xC6, 0x19, 0xD8, 0xCB, 0xAD, 0xA6, 0x4F,
-    0x7A, 0xBD, 0x77, 0xFD, 0xA1, 0x6C, 0x57, 0x6B, 0x3B, 0x05, 0x73, 0xFD, 0x05, 0xB5, 0x42, 0x0B,
-    0x56, 0x78, 0x9C, 0x95, 0xD2, 0x41, 0x0E, 0xC1, 0x50, 0x10, 0x06, 0xE0, 0x41, 0x43, 0x35, 0x91,
-    0xF4, 0x02, 0x12, 0x7B, 0x27, 0x20, 0x12, 0x47, 0xE0, 0x06, 0x1C, 0xC1, 0xDA, 0xCA, 0xC2, 0xCE,
-    0x82, 0x85, 0x03, 0x38, 0x02, 0x17, 0xC1, 0x05, 0xAA, 0x2E, 0xA0, 0x36, 0x5A, 0x0D, 0xD5, 0xDF,
-    0x50, 0xE2, 0xCD, 0x58, 0x88, 0xD9, 0x34, 0xF9, 0xF2, 0x3A, 0x6F, 0xDE, 0xCC, 0x24, 0x78, 0xC6,
-    0x6E, 0x62, 0x51, 0x16, 0x09, 0xDE, 0xD1, 0xD4, 0x80, 0x96, 0x06, 0xD8, 0x2F, 0x38, 0x06, 0x41,
-    0xF0, 0x84, 0x4D, 0x2E, 0x83, 0x3C, 0x7F, 0xDC, 0x71, 0xCA, 0x52, 0xFD, 0x00, 0x51, 0xF7, 0xC6,
-    0x47, 0x4C, 0xA0, 0x19, 0x1F, 0x71, 0x4C, 0xA0, 0x18, 0xE8, 0x08, 0x58, 0x00, 0xBE, 0x00, 0x97,
-    0xF3, 0x16, 0x4D, 0xA0, 0x10, 0xA8, 0x08, 0xD8, 0x02, 0x6D, 0x01, 0x03, 0x60, 0x2A, 0xC0, 0x7D,
-    0x64, 0x35, 0x81, 0x38, 0xAB, 0x84, 0x2B, 0x60, 0x09, 0x38, 0xF3, 0xBD, 0x02, 0x22, 0xA0, 0x24,
-    0x80, 0x0B, 0xB1, 0x05, 0x9C, 0x80, 0xF2, 0x4F, 0x70, 0xFE, 0xFC, 0x25, 0xD4, 0x10, 0xE9, 0x6B,
-    0x63, 0x5D, 0xE9, 0x45, 0xBF, 0x85, 0x5F, 0x9B, 0x33, 0xA1, 0xA6, 0xFB, 0x31, 0xD2, 0x1D, 0xDB,
-    0xEB, 0x9E, 0x46, 0xAA, 0xEB, 0x5F, 0x73, 0x59, 0xEA, 0xC9, 0x71, 0x15, 0x3D, 0x13, 0x56, 0x6A,
-    0xFA, 0xFD, 0x54, 0xEC, 0x87, 0x3B, 0x37, 0x36, 0xC8, 0xF7, 0xBC, 0x83, 0xD8, 0xB1, 0xAF, 0x2D,
-    0x7C, 0x47, 0x9D, 0x04, 0x1C, 0x1B, 0x64, 0xC2, 0x7A, 0x58, 0x78, 0x55, 0x73, 0x07, 0xE3, 0xC4,
-    0x46, 0x1B, 0x78, 0x9C, 0xFB, 0xF3, 0x1F, 0x19, 0xB0, 0xFE, 0x21, 0x91, 0xFB, 0xFE, 0x1D, 0x1C,
-    0xB0, 0x00, 0xB9, 0x4C, 0x0C, 0x08, 0x30, 0x3C, 0xB8, 0xF7, 0xEF, 0x42, 0x41, 0x2E, 0x98, 0x0B,
-    0x07, 0xFD, 0xA4, 0x73, 0x07, 0x89, 0x8F, 0xE8, 0x1F, 0x74, 0x77, 0xEF, 0x72, 0xA0, 0xA6, 0x1C,
-    0x2E, 0x92, 0xB8, 0x00, 0x6B, 0x20, 0x20, 0x36, 0x78, 0x9C, 0xFB, 0xF3, 0x1F, 0x19, 0xFC, 0x21,
-    0x85, 0xF7, 0xFE, 0x1D, 0x0C, 0xDC, 0x03, 0xF2, 0x98, 0x18, 0xE0, 0x60, 0x98, 0xF0, 0xEE, 0xDF,
-    0x85, 0x02, 0x1E, 0x06, 0x64, 0xBF, 0xF3, 0x91, 0xC6, 0x1B, 0x4C, 0x3E, 0x1A, 0x34, 0x3C, 0x00,
-    0x99, 0x94, 0xE8, 0x1F, 0x78, 0x9C, 0x75, 0x93, 0xBF, 0x4A, 0x03, 0x41, 0x10, 0xC6, 0xD7, 0x48,
-    0x54, 0x4C, 0xD4, 0x3C, 0x40, 0x20, 0x96, 0x76, 0xDE, 0x03, 0x08, 0x6A, 0x61, 0x9D, 0x6B, 0xB4,
-    0x54, 0x0B, 0x15, 0xC1, 0xC6, 0xCA, 0x03, 0x11, 0xB4, 0x4C, 0x67, 0x3A, 0xCB, 0x34, 0x82, 0xAD,
-    0x6F, 0x60, 0xB0, 0x16, 0x22, 0x16, 0x82, 0xD5, 0xF9, 0x06, 0x89, 0x89, 0x11, 0xFF, 0xC4, 0x1B,
-    0xBF, 0x99, 0xBD, 0xDD, 0xBB, 0x41, 0xFD, 0x9A, 0xDD, 0xFB, 0xED, 0xCE, 0xCC, 0xB7, 0xBB, 0x73,
-    0xC6, 0x88, 0x56, 0x8F, 0xA2, 0x8D, 0x71, 0x93, 0x29, 0x78, 0x22, 0xD6, 0xC9, 0x98, 0x03, 0x2B,
-    0x23, 0xB2, 0x6A, 0x39, 0xF4, 0x49, 0x4E, 0x9B, 0x16, 0x3C, 0x50, 0xA6, 0x49, 0x06, 0x95, 0x04,
-    0xB3, 0xCE, 0xFE, 0xDE, 0xC5, 0x37, 0xC6, 0x53, 0x26, 0xF7, 0x3C, 0xE1, 0x04, 0xC1, 0x17, 0x66,
-    0x5C, 0xF0, 0x03, 0x3B, 0x0A, 0x12, 0xBE, 0x0D, 0x32, 0x8B, 0x15, 0x0C, 0xA5, 0xB4, 0xC4, 0x50,
-    0xC2, 0xDA, 0x44, 0xB1, 0xB3, 0x71, 0x46, 0xD4, 0x35, 0x66, 0x40, 0xB4, 0xEC, 0xAD, 0xA2, 0x48,
-    0x91, 0xD3, 0x4C, 0x7B, 0xF2, 0xCE, 0x1F, 0x89, 0xCD, 0x6F, 0xD5, 0x47, 0xEA, 0x40, 0x42, 0x9D,
-    0x9E, 0x89, 0x6A, 0x87, 0x38, 0x4D, 0x46, 0xC2, 0x46, 0x63, 0xE1, 0x9A, 0x68, 0xCB, 0x28, 0xC1,
-    0xF1, 0xA2, 0x26, 0x3D, 0xA2, 0x39, 0x4D, 0x5E, 0xC4, 0x78, 0x5E, 0xA8, 0x37, 0xA3, 0x09, 0x2C,
-    0x97, 0x7F, 0x91, 0x92, 0x26, 0xAF, 0xFF, 0x93, 0xF6, 0x9D, 0xD5, 0x92, 0x27, 0xBD, 0xF4, 0xA6,
-    0xEB, 0x83, 0xBF, 0x48, 0x59, 0x13, 0xEF, 0xC7, 0x13, 0xED, 0xB9, 0x09, 0x82, 0xA5, 0x9A, 0x26,
-    0xB8, 0xF8, 0xBA, 0x26, 0xCD, 0xF4, 0x1D, 0x33, 0x82, 0x57, 0xEB, 0x68, 0x52, 0x41, 0xFA, 0x82,
-    0x22, 0x06, 0xBD, 0x33, 0xA5, 0xC9, 0x30, 0x5F, 0x4C, 0x08, 0x1E, 0xE4, 0x46, 0x13, 0x6E, 0x88,
-    0x09, 0x45, 0x38, 0x91, 0x7F, 0x1F, 0xEB, 0x0E, 0x27, 0x73, 0xB9, 0xE7, 0x47, 0x42, 0x42, 0x90,
-    0xB8, 0x28, 0x00, 0x5D, 0x21, 0x37, 0xF1, 0x86, 0xB1, 0x7B, 0xBC, 0xBE, 0x7B, 0xC5, 0x8D, 0x18,
-    0x73, 0xFF, 0x85, 0xB9, 0x5E, 0xA5, 0xAA, 0x84, 0xDF, 0x66, 0xE0, 0x3C, 0x2D, 0xF1, 0xE8, 0x40,
-    0xCB, 0x1F, 0xE8, 0x32, 0x11, 0x70, 0xE0, 0x7F, 0x0C, 0x94, 0xD9, 0x89, 0xA2, 0x35, 0xBB, 0xE1,
-    0x07, 0xBC, 0x73, 0x41, 0xF4, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0x3F, 0x13, 0x03, 0x1C, 0x7C, 0xF9,
-    0xFF, 0x9F, 0xEB, 0xCF, 0xA8, 0x08, 0x35, 0x44, 0xEE, 0xDF, 0x85, 0x83, 0xFF, 0x10, 0x11, 0x54,
-    0x40, 0xBE, 0xC8, 0x60, 0xF3, 0xE9, 0x08, 0x11, 0x01, 0x00, 0x7D, 0x38, 0x42, 0x2A, 0x78, 0x9C,
-    0xFB, 0xF6, 0xFF, 0x3F, 0xE7, 0xB7, 0x21, 0x86, 0x01, 0xCB, 0xB9, 0x86, 0x7A, 0x78, 0x9C, 0x63,
-    0x60, 0x80, 0x83, 0x0F, 0xFF, 0xFF, 0xF3, 0x31, 0x8C, 0x72, 0x87, 0x17, 0xF7, 0xEB, 0xFF, 0xFF,
-    0x9C, 0x08, 0x2E, 0xEF, 0x97, 0xFF, 0xFF, 0xB9, 0xA0, 0xDC, 0x8F, 0xFF, 0xFF, 0xF3, 0x7C, 0x06,
-    0x62, 0x28, 0x17, 0x24, 0x03, 0x54, 0xC1, 0x0F, 0xE5, 0xFE, 0xFC, 0xFF, 0x9F, 0xE3, 0xC2, 0xFF,
-    0xFF, 0xF9, 0x10, 0x9E, 0xC0, 0xFF, 0xFF, 0xFF, 0x99, 0x1B, 0xFE, 0xFF, 0x7F, 0xCF, 0x08, 0xE6,
-    0x2E, 0x00, 0xB2, 0xC0, 0x62, 0x32, 0x60, 0xEE, 0xF7, 0xFF, 0xFF, 0xEB, 0xC1, 0x3A, 0xDE, 0xB3,
-    0x00, 0x79, 0x9B, 0x80, 0xE2, 0xBC, 0x0C, 0x0C, 0x40, 0xCD, 0xFF, 0xDF, 0x57, 0xA6, 0x9E, 0xF8,
-    0x0F, 0xD2, 0xCA, 0xC0, 0xA0, 0xF0, 0xEF, 0x3F, 0x0C, 0xC4, 0x83, 0xF4, 0x5C, 0x82, 0x73, 0x59,
-    0xC0, 0x66, 0xFC, 0x80, 0xF2, 0xA4, 0xA0, 0x16, 0x1E, 0x07, 0x71, 0xEE, 0x6B, 0xC2, 0xFD, 0x62,
-    0x50, 0x5A, 0xEE, 0xC6, 0x04, 0x66, 0x01, 0x00, 0x03, 0x7E, 0xC0, 0xDB, 0x78, 0x9C, 0x65, 0xD2,
-    0xED, 0xAD, 0x01, 0x41, 0x14, 0xC6, 0xF1, 0x63, 0xC3, 0x0D, 0x17, 0x89, 0x06, 0x88, 0x0A, 0xD0,
-    0x01, 0x1D, 0x48, 0x34, 0x40, 0x07, 0x94, 0x70, 0x3B, 0x50, 0xC2, 0xBD, 0x1D, 0xD0, 0x09, 0x2A,
-    0x10, 0x1A, 0xB8, 0x1F, 0xBC, 0xBF, 0xC4, 0xE3, 0x9C, 0xD9, 0x79, 0x39, 0x27, 0xE6, 0xCB, 0x6E,
-    0x7E, 0x99, 0x4D, 0xFE, 0x7B, 0x66, 0x9E, 0x40, 0x46, 0x7E, 0x4D, 0x00, 0x54, 0xE9, 0xA9, 0xE4,
-    0x04, 0xAC, 0x48, 0x4B, 0x8F, 0xB7, 0x34, 0x8D, 0xEC, 0x81, 0xFF, 0x4C, 0x4B, 0xE3, 0x05, 0xF4,
-    0x49, 0xCB, 0x9A, 0x3F, 0x2A, 0x1A, 0xE1, 0xB7, 0x29, 0x69, 0xF9, 0xE3, 0x2D, 0x65, 0x23, 0x37,
-    0x60, 0x41, 0x5A, 0x66, 0xAE, 0x4E, 0x4B, 0x5E, 0xA7, 0x64, 0xC0, 0x5B, 0x5A, 0x46, 0x0E, 0x79,
-    0x5D, 0x92, 0xB6, 0xAF, 0x4B, 0xB2, 0xE1, 0x8F, 0x4A, 0x46, 0x42, 0x5D, 0x94, 0x65, 0xA8, 0x8B,
-    0x12, 0xEB, 0x82, 0xFC, 0xC4, 0xBA, 0x20, 0x67, 0x16, 0xD2, 0x32, 0x62, 0x40, 0x41, 0x8B, 0x6C,
-    0x41, 0x4D, 0x8B, 0x5B, 0xF3, 0x0F, 0x71, 0xE3, 0x4B, 0x32, 0xE6, 0x9F, 0xE8, 0x18, 0x29, 0x1E,
-    0xE3, 0x2C, 0x72, 0x19, 0x92, 0x14, 0x55, 0x94, 0x94, 0xDC, 0x63, 0x9C, 0x44, 0x5E, 0x77, 0xD0,
-    0x67, 0x52, 0xF6, 0x33, 0xAC, 0x99, 0x19, 0xD2, 0x15, 0xF8, 0xB5, 0xB2, 0x8C, 0x33, 0x0B, 0x22,
-    0xA7, 0xDE, 0x35, 0x42, 0x9C, 0xB4, 0xB5, 0x32, 0x0B, 0x49, 0xE9, 0x26, 0x3C, 0x7C, 0x52, 0x92,
-    0x90, 0x94, 0x44, 0x2E, 0x5D, 0xDD, 0x08, 0x5D, 0xF2, 0x24, 0x25, 0x92, 0xF4, 0x65, 0xC4, 0x27,
-    0xE9, 0xFB, 0x7C, 0x70, 0x49, 0x5A, 0x24, 0xE9, 0xDB, 0x08, 0xDD, 0xE5, 0xF8, 0x8D, 0xC8, 0x05,
-    0xCE, 0xDE, 0xB0, 0xD3, 0x34, 0x5B, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0x3F, 0x13, 0x03, 0x1C, 0xFC,
-    0x19, 0xE5, 0x8D, 0xF2, 0x08, 0xF1, 0xEE, 0xDF, 0x85, 0x01, 0x5F, 0x20, 0x0F, 0x01, 0xE2, 0x89,
-    0xE7, 0x01, 0x00, 0x04, 0xD6, 0xB8, 0x88, 0x78, 0x9C, 0x65, 0xD2, 0xCD, 0x4D, 0x03, 0x41, 0x0C,
-    0x86, 0x61, 0x03, 0x12, 0x02, 0x14, 0x02, 0x1D, 0xD0, 0x02, 0x1D, 0x40, 0x27, 0xD9, 0x0E, 0xA0,
-    0x03, 0xFA, 0xE0, 0x92, 0x1C, 0xB8, 0x2F, 0x1D, 0x24, 0x1D, 0x90, 0x0E, 0x92, 0x0E, 0xC8, 0x0F,
-    0x22, 0x02, 0x76, 0x65, 0x3E, 0xDB, 0x99, 0xB5, 0xBD, 0x3B, 0x07, 0x4B, 0xF3, 0x6A, 0xA4, 0x47,
-    0x33, 0x9A, 0x86, 0x99, 0x4F, 0x28, 0xAE, 0x2D, 0xCA, 0xA8, 0xC1, 0x38, 0x4F, 0xF9, 0x50, 0xF2,
-    0x75, 0xCA, 0x6D, 0xC9, 0x0F, 0xB1, 0x3E, 0x72, 0xC9, 0x75, 0xCC, 0xB3, 0x2E, 0x27, 0x73, 0xEB,
-    0x39, 0x9A, 0x07, 0xCF, 0xD1, 0x6C, 0x3D, 0x07, 0x53, 0x45, 0xC9, 0x75, 0x32, 0x21, 0xD6, 0x9A,
-    0xA7, 0x7F, 0xD1, 0x84, 0xF8, 0x6A, 0xA7, 0xBF, 0xA2, 0x09, 0xF1, 0xCD, 0xF2, 0x3A, 0x9A, 0x2D,
-    0xAF, 0x66, 0x9A, 0xE7, 0xCF, 0xC1, 0x84, 0xF8, 0xF2, 0x6E, 0xF9, 0x36, 0x98, 0x38, 0x79, 0x77,
-    0xCC, 0xF4, 0xEB, 0x26, 0xC4, 0xAB, 0x85, 0xE6, 0x0F, 0x0A, 0x26, 0xC4, 0xB3, 0x92, 0x97, 0x6E,
-    0x42, 0x94, 0x2D, 0xF2, 0x8A, 0xDC, 0xBC, 0x67, 0x7E, 0xEA, 0xB2, 0x9B, 0x22, 0xD2, 0x5A, 0xF3,
-    0x27, 0xB9, 0x29, 0xA2, 0xE7, 0xCE, 0x14, 0x91, 0x36, 0xF6, 0x82, 0xE4, 0xA6, 0x88, 0x9E, 0x8B,
-    0xA9, 0xA2, 0xE7, 0x62, 0x42, 0xBC, 0x09, 0xB9, 0x98, 0x10, 0x2F, 0x75, 0x4A, 0x46, 0xD8, 0x9B,
-    0xA9, 0x62, 0xC8, 0x47, 0xB3, 0xC5, 0x95, 0x89, 0x76, 0x5D, 0xAE, 0xD4, 0x34, 0x31, 0x64, 0x98,
-    0xD3, 0x22, 0x86, 0x6C, 0xA6, 0x89, 0x31, 0xAB, 0xF9, 0xCD, 0x7C, 0x9A, 0xB3, 0x9A, 0x26, 0xC6,
-    0x2C, 0x26, 0xC4, 0x49, 0x2F, 0x13, 0x4C, 0x88, 0xE3, 0x7E, 0xFE, 0x61, 0xC6, 0xF6, 0xA2, 0x9F,
-    0x61, 0x36, 0x26, 0xA6, 0xBC, 0x90, 0x1F, 0xA9, 0x62, 0xCA, 0x95, 0xE4, 0xC9, 0x20, 0x93, 0xE4,
-    0xF1, 0x30, 0xC3, 0x34, 0x31, 0x67, 0x98, 0x26, 0xE6, 0x0C, 0x73, 0x4E, 0xC3, 0x5C, 0x15, 0x31,
-    0x67, 0x2A, 0xA2, 0xE6, 0x7F, 0x63, 0x88, 0xE0, 0x82, 0x78, 0x9C, 0x65, 0xD1, 0x8B, 0x09, 0xC2,
-    0x30, 0x14, 0x85, 0xE1, 0xEB, 0x1B, 0xEA, 0x03, 0x27, 0x50, 0x37, 0xB0, 0x23, 0xB8, 0x81, 0x23,
-    0x08, 0x2E, 0xA0, 0x1B, 0xE8, 0x06, 0xBA, 0x81, 0x6E, 0xA0, 0x1B, 0xE8, 0x06, 0x76, 0x04, 0x37,
-    0x10, 0xB4, 0x3E, 0xA9, 0x5E, 0x6F, 0x6A, 0x5B, 0x7B, 0x38, 0x81, 0x90, 0xF0, 0xC1, 0x9F, 0x10,
-    0x12, 0xA9, 0xD6, 0x24, 0x1B, 0x17, 0x55, 0x2F, 0x52, 0xED, 0x93, 0x1C, 0x48, 0xB4, 0x4A, 0xD2,
-    0x25, 0xD9, 0x91, 0x68, 0x85, 0xA4, 0x43, 0xB2, 0x21, 0xC9, 0xB2, 0x44, 0xDE, 0xFF, 0x2C, 0x91,
-    0x50, 0x75, 0x85, 0x32, 0xB6, 0xAC, 0x0C, 0x52, 0xB4, 0xD9, 0x42, 0x39, 0x67, 0x59, 0x2A, 0x53,
-    0xCB, 0x4A, 0x20, 0x62, 0xB7, 0x35, 0x51, 0x6C, 0xB3, 0x40, 0x99, 0xA7, 0x59, 0x26, 0x2E, 0x6B,
-    0xA0, 0xD8, 0x6E, 0x86, 0xB2, 0xD4, 0x78, 0xC9, 0x89, 0x7C, 0x7E, 0x59, 0x4E, 0xEC, 0x6D, 0x13,
-    0x94, 0xB5, 0xA6, 0xE7, 0xA5, 0xD2, 0xB6, 0xAC, 0x0E, 0x22, 0xD7, 0x38, 0xCB, 0x8B, 0x65, 0xA7,
-    0x02, 0x88, 0xCB, 0x3C, 0x10, 0xB9, 0xA9, 0x8E, 0x50, 0xB6, 0x2E, 0x03, 0xE9, 0xD9, 0xFD, 0x1E,
-    0x88, 0xCB, 0x86, 0x28, 0x7B, 0xCB, 0x42, 0x10, 0x97, 0x45, 0x20, 0x72, 0x8F, 0xBF, 0x37, 0x2F,
-    0x01, 0x89, 0x4F, 0x22, 0x0F, 0x92, 0x80, 0xC4, 0x27, 0x91, 0x27, 0xC9, 0x91, 0x64, 0x40, 0x22,
-    0x2F, 0x93, 0x2F, 0xAD, 0x5F, 0x7D, 0xFD, 0x78, 0x9C, 0x8D, 0x93, 0xBD, 0x32, 0x43, 0x51, 0x10,
-    0xC7, 0x37, 0xDC, 0x09, 0x37, 0xC1, 0xA4, 0x56, 0xE0, 0x09, 0x32, 0x5A, 0x95, 0x4E, 0x61, 0x18,
-    0x8F, 0xC0, 0x1B, 0x88, 0xC2, 0x68, 0x8D, 0x4A, 0x47, 0x69, 0x26, 0x05, 0xAF, 0xE0, 0x09, 0x94,
-    0x66, 0x34, 0x52, 0x6B, 0xA4, 0xA0, 0xBE, 0x46, 0x44, 0x62, 0x88, 0xBF, 0xDD, 0xF3, 0xB1, 0x67,
-    0x27, 0x73, 0x0A, 0x5B, 0xDC, 0x8F, 0xDF, 0xEC, 0xEE, 0xF9, 0xEF, 0xC7, 0x21, 0x72, 0xB6, 0x7E,
-    0x7C, 0xB2, 0x55, 0x23, 0x63, 0xAD, 0x7B, 0xB0, 0x55, 0x1B, 0x86, 0x7C, 0xC1, 0xDB, 0x8E, 0xA2,
-    0x57, 0x44, 0x6B, 0x04, 0x72, 0xAA, 0x04, 0xCF, 0x33, 0x1E, 0xB9, 0xB0, 0xEE, 0xD5, 0x93, 0xBC,
-    0x56, 0xD4, 0xE9, 0xAE, 0xE0, 0x8F, 0x33, 0x71, 0x73, 0xE8, 0x83, 0xCF, 0x2A, 0xDC, 0xD7, 0x6D,
-    0xCC, 0xF6, 0x0B, 0xB4, 0x43, 0xD6, 0x31, 0xB0, 0x1F, 0xE2, 0x42, 0x52, 0xBA, 0xE1, 0x00, 0x7E,
-    0xBD, 0x01, 0x87, 0x2A, 0x90, 0x23, 0xEA, 0x44, 0x23, 0x60, 0x41, 0x15, 0x7E, 0x02, 0x8B, 0x44,
-    0x13, 0xA0, 0x50, 0xD4, 0x07, 0x36, 0x69, 0xCD, 0x87, 0x27, 0xD5, 0x17, 0x74, 0x20, 0x0F, 0x35,
-    0x76, 0x78, 0x94, 0x43, 0xF6, 0x4C, 0x4F, 0x38, 0x3F, 0xF5, 0x80, 0x55, 0x83, 0xBE, 0x81, 0x59,
-    0xD6, 0xB0, 0x64, 0x10, 0x8B, 0xAD, 0xBF, 0x03, 0x4D, 0x83, 0x58, 0xC5, 0xDC, 0x20, 0x35, 0x49,
-    0x6C, 0x08, 0x94, 0x5C, 0x74, 0x69, 0x10, 0xFF, 0x36, 0x18, 0xCF, 0x1B, 0x34, 0xF8, 0x2F, 0x6A,
-    0xE6, 0xBD, 0xCA, 0x29, 0x94, 0x39, 0x31, 0xA3, 0x2B, 0xA3, 0x3E, 0x53, 0x63, 0xA6, 0x13, 0x99,
-    0x7E, 0x71, 0x57, 0xAF, 0x13, 0x71, 0x5D, 0xCD, 0xF4, 0x9E, 0x7E, 0xEC, 0x84, 0x7A, 0x32, 0x21,
-    0x39, 0x36, 0xCD, 0x71, 0xE8, 0xE6, 0xD8, 0x37, 0xD3, 0x26, 0x3F, 0xED, 0x8E, 0xD9, 0x89, 0xCB,
-    0x90, 0x78, 0x92, 0x36, 0x67, 0xE4, 0x37, 0xC7, 0xEC, 0x17, 0x3B, 0xF9, 0xEA, 0x3A, 0x71, 0x0B,
-    0x8F, 0x38, 0x53, 0x55, 0x8B, 0x75, 0xA1, 0xEA, 0x9E, 0x3F, 0xC8, 0xAE, 0xB6, 0x55, 0xDF, 0xF4,
-    0x46, 0xD3, 0x8B, 0xA2, 0xE5, 0xA8, 0xA6, 0x35, 0x0E, 0x64, 0x37, 0x95, 0x16, 0xEE, 0xD0, 0x36,
-    0x59, 0x93, 0x9B, 0x16, 0xF3, 0xFC, 0x01, 0x24, 0x11, 0x3D, 0x5E, 0x78, 0x9C, 0xFB, 0xF3, 0x1F,
-    0x0A, 0xEE, 0x75, 0xB3, 0x30, 0x80, 0xC0, 0x9F, 0xFF, 0x08, 0xA0, 0x89, 0x2E, 0xF0, 0x9F, 0x03,
-    0x5D, 0xE0, 0x3E, 0x13, 0x58, 0xE0, 0x1D, 0x18, 0x80, 0x45, 0xF4, 0xC0, 0x02, 0x4C, 0x60, 0xC3,
-    0x14, 0xB6, 0x82, 0x94, 0x20, 0x09, 0x30, 0x30, 0x5C, 0x06, 0x8A, 0x70, 0x22, 0x0B, 0x08, 0x00,
-    0xD9, 0xF2, 0xC8, 0x02, 0x0C, 0x0F, 0xFF, 0xFF, 0xEF, 0x47, 0x11, 0x28, 0x00, 0x19, 0x82, 0x2C,
-    0x20, 0x00, 0x34, 0x84, 0x11, 0x59, 0x00, 0x24, 0xCB, 0x82, 0x22, 0xF0, 0xEB, 0xFF, 0x7F, 0x56,
-    0x14, 0x81, 0x1F, 0xFF, 0xFF, 0xB3, 0xA1, 0x08, 0xFC, 0x44, 0x17, 0xF8, 0x8D, 0xAE, 0xE5, 0x1F,
-    0x90, 0x83, 0x2C, 0xE0, 0x00, 0xB4, 0x16, 0xC5, 0x1D, 0x07, 0xFE, 0xFF, 0x5F, 0x8F, 0x22, 0x00,
-    0xB4, 0xC4, 0x1F, 0x59, 0x60, 0x21, 0x50, 0x07, 0x0F, 0x92, 0xC0, 0x14, 0x50, 0x08, 0x31, 0x81,
-    0x04, 0xEE, 0xDF, 0x05, 0x81, 0x7F, 0x20, 0x7E, 0x3C, 0x5A, 0x98, 0xFE, 0x67, 0x45, 0x13, 0xD0,
-    0x41, 0x0B, 0xF5, 0x68, 0x94, 0x78, 0xB9, 0x37, 0x5B, 0x14, 0x16, 0x04, 0x08, 0xA7, 0x8F, 0x0A,
-    0x10, 0x21, 0x00, 0x00, 0x26, 0x9B, 0x20, 0x77, 0x78, 0x9C, 0x9D, 0x93, 0x3B, 0x4E, 0xC3, 0x40,
-    0x10, 0x86, 0x27, 0x98, 0x3C, 0x78, 0xE7, 0x00, 0x48, 0xB8, 0x44, 0x08, 0x89, 0x54, 0xB4, 0x40,
-    0x43, 0x1B, 0xE5, 0x04, 0xF8, 0x08, 0xA9, 0xE0, 0x0E, 0x34, 0x48, 0x54, 0x91, 0x28, 0x28, 0x38,
-    0x00, 0xBE, 0x41, 0x02, 0x17, 0xB0, 0x10, 0x0D, 0x3D, 0x1D, 0x14, 0x20, 0x14, 0x81, 0x21, 0x41,
-    0xC3, 0x8C, 0x67, 0x1F, 0xB3, 0xB6, 0x2B, 0x46, 0x8A, 0x34, 0xFE, 0xB2, 0xF3, 0xFA, 0x77, 0x16,
-    0xA0, 0xB0, 0xA3, 0xD3, 0xB3, 0xFD, 0x06, 0x28, 0x8B, 0x9F, 0x90, 0x2C, 0xDB, 0xF6, 0xA4, 0x37,
-    0x43, 0xB1, 0x1D, 0x87, 0x72, 0xB4, 0xD6, 0x36, 0xE4, 0xCE, 0x11, 0xBC, 0x15, 0xD2, 0xFD, 0x25,
-    0xFF, 0xED, 0x6A, 0xF4, 0xCA, 0x6C, 0xA5, 0x40, 0x13, 0xF2, 0xAE, 0x23, 0x72, 0x6E, 0xDC, 0x31,
-    0xCA, 0x94, 0x2D, 0x14, 0xDE, 0x23, 0xB1, 0x16, 0x97, 0x73, 0xC7, 0x01, 0xE6, 0x88, 0x5B, 0x12,
-    0x97, 0xD9, 0xD2, 0x0F, 0x12, 0x39, 0x45, 0xDC, 0xB3, 0xE8, 0x90, 0x22, 0x28, 0x07, 0xB5, 0xD9,
-    0x71, 0x1D, 0xFE, 0xF0, 0x47, 0x97, 0xFE, 0xF0, 0xC3, 0x7D, 0x20, 0xAE, 0x43, 0xE2, 0xFA, 0x33,
-    0x0D, 0x1D, 0x40, 0x8A, 0xD8, 0xF7, 0x68, 0x88, 0x78, 0x01, 0xEF, 0x88, 0x1B, 0x4A, 0x12, 0x2E,
-    0x4F, 0xD1, 0x6B, 0x4A, 0x26, 0x1A, 0x8D, 0x7B, 0x58, 0x56, 0x88, 0xE6, 0x6D, 0x7C, 0x7A, 0x45,
-    0x4C, 0x17, 0x51, 0x2E, 0x63, 0x59, 0xFB, 0x46, 0x5C, 0xA4, 0x5F, 0x53, 0x21, 0x3A, 0xD1, 0x64,
-    0x1C, 0xA2, 0x56, 0x09, 0x7D, 0xFD, 0x17, 0x71, 0xAE, 0xBC, 0x5A, 0xB1, 0xA6, 0xAF, 0x9A, 0xEE,
-    0x6B, 0x66, 0xAC, 0x28, 0x81, 0x75, 0x7A, 0x85, 0xAA, 0x26, 0xAC, 0x6A, 0x45, 0xFB, 0x7E, 0xDD,
-    0x0D, 0x85, 0xF7, 0x48, 0x6D, 0x2D, 0x85, 0xB7, 0xDD, 0x93, 0xDB, 0xD6, 0x3B, 0x31, 0x91, 0xC4,
-    0x7A, 0x73, 0x66, 0x26, 0xC2, 0xEF, 0xD7, 0xBD, 0xDD, 0xD6, 0x94, 0xB7, 0x90, 0xD9, 0x25, 0x39,
-    0x63, 0x39, 0x3E, 0xE7, 0x5D, 0x3D, 0x1F, 0xBD, 0xF0, 0xAE, 0xAE, 0x0A, 0x4A, 0xFD, 0x46, 0x8F,
-    0x95, 0x6E, 0xC6, 0xDC, 0xB8, 0xB1, 0x7D, 0x1D, 0x6A, 0x36, 0x79, 0x43, 0x6C, 0x9B, 0x7E, 0x5E,
-    0x7A, 0x69, 0xC7, 0x03, 0x2E, 0x13, 0x41, 0x60, 0xCF, 0xC4, 0x4E, 0x42, 0x14, 0xF3, 0xD3, 0xE9,
-    0x84, 0x2C, 0xD5, 0x7D, 0x78, 0x71, 0xB0, 0x94, 0x2D, 0xE1, 0x8D, 0x2E, 0xD9, 0xB4, 0x5C, 0x92,
-    0x2A, 0xEC, 0x02, 0xFC, 0x01, 0xD1, 0x21, 0x5B, 0xD9, 0x78, 0x9C, 0x7D, 0xD2, 0xC9, 0x8D, 0xC2,
-    0x50, 0x0C, 0x06, 0xE0, 0xC7, 0x22, 0x34, 0x09, 0x8B, 0xD2, 0x01, 0x37, 0x0E, 0x5C, 0xA0, 0x13,
-    0x3A, 0x00, 0x3A, 0x80, 0x06, 0x90, 0x90, 0x28, 0x60, 0xA6, 0x03, 0xA6, 0x80, 0x91, 0x28, 0x01,
-    0x3A, 0xA0, 0x02, 0x04, 0x15, 0x10, 0xB1, 0x23, 0x04, 0xFC, 0xD8, 0x8E, 0x66, 0xB0, 0x7D, 0x18,
-    0x9F, 0x92, 0x4F, 0x6F, 0x71, 0xFC, 0xE7, 0x8E, 0xAC, 0xD2, 0x9F, 0x46, 0x90, 0xBA, 0xE3, 0xAF,
-    0x46, 0x1E, 0xD0, 0xF5, 0x80, 0x28, 0x83, 0x2D, 0x97, 0xC0, 0x34, 0x83, 0x3C, 0xAF, 0x4C, 0x26,
-    0x4F, 0x92, 0xD2, 0x1B, 0x42, 0x18, 0x13, 0xD4, 0x35, 0x84, 0x13, 0xF0, 0x69, 0x80, 0x96, 0xA4,
-    0x06, 0x02, 0xED, 0x29, 0x18, 0xB8, 0xF1, 0xA9, 0x1A, 0xCE, 0xDC, 0x89, 0x86, 0x23, 0x10, 0x1B,
-    0x38, 0x00, 0x65, 0x0F, 0xF1, 0xFF, 0x67, 0xF8, 0x5B, 0x12, 0xF0, 0xB3, 0x82, 0x6F, 0x60, 0x69,
-    0x3A, 0xBD, 0x00, 0x3D, 0x0D, 0x5F, 0xB4, 0xA3, 0xA2, 0x40, 0xE6, 0x91, 0x17, 0x58, 0xAF, 0xA8,
-    0xF8, 0x15, 0x1D, 0x37, 0xD3, 0xB4, 0xE0, 0xE0, 0xC3, 0x4D, 0xBD, 0xE9, 0x73, 0x89, 0x7E, 0x41,
-    0x6E, 0xD9, 0x01, 0x2D, 0x03, 0x34, 0xD0, 0xB9, 0x81, 0x84, 0xEE, 0x2D, 0x6A, 0xE0, 0xC6, 0xAB,
-    0x06, 0x36, 0xC0, 0xC0, 0x40, 0x5F, 0x52, 0xD1, 0x1F, 0xF7, 0xC8, 0x3A, 0x7B, 0xC3, 0x51, 0xA2,
-    0x55, 0xB0, 0x00, 0x66, 0x06, 0xDA, 0x92, 0xA4, 0x9E, 0xD8, 0x8D, 0x63, 0xD1, 0xB0, 0x97, 0x81,
-    0x28, 0xA0, 0x19, 0xAE, 0x83, 0x8F, 0xC1, 0xA6, 0x7F, 0x05, 0x6A, 0x06, 0x36, 0xFC, 0x4F, 0x69,
-    0x18, 0xD2, 0x9E, 0x9C, 0x06, 0xEE, 0x3E, 0x7A, 0x01, 0xAA, 0x22, 0x52, 0x02, 0x78, 0x9C, 0x55,
-    0x92, 0x3D, 0x33, 0x03, 0x51, 0x14, 0x86, 0xEF, 0x32, 0x16, 0xF1, 0xB5, 0x33, 0x2A, 0x55, 0x52,
-    0x28, 0x74, 0xF2, 0x37, 0x54, 0x14, 0x66, 0x6B, 0x0D, 0x25, 0x9D, 0x8C, 0x02, 0x9D, 0x8A, 0x89,
-    0x31, 0x7A, 0x33, 0xFC, 0x00, 0x1A, 0x4A, 0xE2, 0x17, 0xA4, 0xA5, 0x62, 0x26, 0x26, 0x93, 0x6E,
-    0x93, 0x91, 0x11, 0x9B, 0x8C, 0xBC, 0xCE, 0x39, 0x77, 0xEF, 0xD7, 0xDB, 0xEC, 0xBD, 0xCF, 0x9C,
-    0xFB, 0x9E, 0x8F, 0x3D, 0x4A, 0xB1, 0x2A, 0xBB, 0xB5, 0x74, 0x59, 0x39, 0x3D, 0x81, 0x75, 0x3E,
-    0x61, 0xEE, 0xBF, 0xD0, 0xBA, 0x8F, 0xF4, 0xFD, 0x0B, 0x46, 0x07, 0x72, 0xDF, 0x81, 0xD3, 0x2C,
-    0x83, 0x1F, 0x3A, 0x34, 0x8F, 0xF6, 0xCE, 0x46, 0xF4, 0xBD, 0xE1, 0x04, 0xF4, 0xAD, 0xCB, 0xE3,
-    0x36, 0x9D, 0x62, 0xA5, 0x1A, 0x40, 0xA6, 0xED, 0x13, 0x8A, 0x29, 0x2B, 0xD5, 0x07, 0xD6, 0x8B,
-    0x6C, 0x0D, 0x79, 0x33, 0x2C, 0xAC, 0x8A, 0xD7, 0x91, 0x1A, 0x03, 0xB6, 0xA0, 0x21, 0x9B, 0x10,
-    0xB5, 0x15, 0xD3, 0xF3, 0x52, 0x42, 0x9E, 0x16, 0xF4, 0x80, 0x85, 0x20, 0xA2, 0x0B, 0x2C, 0x32,
-    0xB0, 0x1E, 0x22, 0x4A, 0x5E, 0x0A, 0x00, 0x55, 0x7E, 0x1A, 0x80, 0x4F, 0xB8, 0x42, 0x44, 0x5B,
-    0x04, 0x3E, 0xA6, 0x7C, 0x92, 0x13, 0xC9, 0xD6, 0x3C, 0x70, 0x29, 0x93, 0xB8, 0x98, 0x0C, 0x6C,
-    0x39, 0x68, 0xC3, 0x82, 0xCA, 0x48, 0x8F, 0xEB, 0x38, 0x32, 0xA4, 0x5A, 0x90, 0xBA, 0x8B, 0xE9,
-    0x68, 0xB2, 0xEF, 0x7C, 0xAE, 0xC7, 0x42, 0xBC, 0x9A, 0xAB, 0x6F, 0x0C, 0x9A, 0x7E, 0x3D, 0x77,
-    0x4C, 0xE6, 0x7C, 0x72, 0x6B, 0x7F, 0x95, 0x51, 0xDF, 0x1F, 0x96, 0xF8, 0x50, 0x48, 0xD0, 0x15,
-    0xB7, 0x15, 0xCE, 0xE6, 0x9B, 0x66, 0x3A, 0x00, 0xA6, 0x2D, 0xA0, 0x99, 0x2E, 0x51, 0x67, 0x33,
-    0x01, 0x20, 0xE7, 0xF9, 0x00, 0x74, 0xDD, 0xAF, 0xD5, 0x1E, 0x0F, 0xC0, 0x4B, 0x90, 0x85, 0x73,
-    0x1B, 0x57, 0x5D, 0x47, 0xAE, 0xF7, 0x86, 0xD5, 0xA2, 0x71, 0xCB, 0x52, 0xE0, 0x44, 0x66, 0x75,
-    0x45, 0xA7, 0x4D, 0xDA, 0x9B, 0x3F, 0xD9, 0xB1, 0xF4, 0xF0, 0x9D, 0xBB, 0xE5, 0x12, 0x5E, 0xBD,
-    0x2D, 0xD4, 0x43, 0x1C, 0xD8, 0x7B, 0x16, 0x0B, 0x48, 0x72, 0x03, 0x56, 0x4C, 0xFE, 0x47, 0x99,
-    0xE8, 0x73, 0xEC, 0xDA, 0x4C, 0xB6, 0x6B, 0xE9, 0xAA, 0x3E, 0xFE, 0x03, 0x2E, 0x78, 0x27, 0xC5,
-    0x78, 0x9C, 0xFB, 0xFE, 0x1F, 0x0D, 0xE8, 0x7F, 0x27, 0x4B, 0xE4, 0xD9, 0x3B, 0x30, 0x00, 0x32,
-    0xDF, 0x43, 0x58, 0x72, 0x0C, 0x10, 0xF0, 0xF1, 0xFF, 0x7F, 0x1E, 0x06, 0x14, 0x30, 0x2A, 0x32,
-    0x2A, 0x32, 0x04, 0x45, 0x00, 0xF5, 0xBA, 0xCB, 0xA9, 0x78, 0x9C, 0xED, 0x8E, 0x3B, 0x12, 0x01,
-    0x51, 0x10, 0x45, 0x7B, 0xFC, 0x0D, 0x3B, 0x90, 0x58, 0x01, 0x52, 0x11, 0x25, 0x10, 0x51, 0x25,
-    0x51, 0x52, 0x4B, 0x10, 0x11, 0xDA, 0x8A, 0x4C, 0x86, 0x1D, 0x58, 0xCA, 0x94, 0x54, 0x42, 0xF9,
-    0x16, 0xC3, 0x1C, 0x3D, 0x66, 0xDE, 0x93, 0xD9, 0x00, 0x37, 0xB9, 0xEF, 0x9E, 0x7E, 0x75, 0xBB,
-    0x7D, 0x48, 0x8A, 0xD1, 0x01, 0x0A, 0xFE, 0x1F, 0xFC, 0x0E, 0xB8, 0x7F, 0x05, 0x47, 0x70, 0x6F,
-    0x90, 0xB6, 0xE0, 0x0C, 0xF9, 0x0B, 0xE4, 0x2C, 0xB8, 0x42, 0x56, 0x7F, 0x15, 0x2D, 0x78, 0x40,
-    0x6A, 0x0F, 0x55, 0x93, 0xCB, 0x80, 0xCC, 0x60, 0x6D, 0xC0, 0x0A, 0x96, 0x52, 0x53, 0x9A, 0x89,
-    0x81, 0xF6, 0x35, 0x44, 0xF4, 0xB2, 0x69, 0x94, 0x47, 0x3A, 0x73, 0x45, 0x36, 0x6A, 0x9D, 0x30,
-    0x37, 0xB5, 0xD2, 0x73, 0xD4, 0x15, 0xB0, 0x18, 0xF4, 0xE7, 0x81, 0x7A, 0x25, 0x9C, 0x9C, 0xB0,
-    0xDA, 0x25, 0xDE, 0xCB, 0x9E, 0x16, 0x94, 0xA2, 0xB2, 0x61, 0x10, 0xE7, 0xAE, 0xD9, 0xDF, 0xDB,
-    0x86, 0xD1, 0xAB, 0xCB, 0x47, 0xAD, 0xF1, 0xA4, 0xED, 0x44, 0xCF, 0x17, 0x64, 0x85, 0x24, 0x3E,
-    0x78, 0x9C, 0x5D, 0x52, 0xDB, 0x41, 0x02, 0x41, 0x0C, 0xDC, 0xF3, 0xAD, 0x20, 0x77, 0x1D, 0x60,
-    0x07, 0xD8, 0x81, 0x74, 0xA0, 0x1D, 0x48, 0x07, 0xDA, 0x01, 0x74, 0x00, 0x1D, 0x48, 0x07, 0xD2,
-    0x81, 0x76, 0xA0, 0x1D, 0x40, 0x07, 0x7A, 0x82, 0x87, 0x27, 0x8F, 0x21, 0xC9, 0x66, 0x77, 0x03,
-    0xF3, 0xB3, 0xD9, 0xD9, 0xBB, 0x24, 0x33, 0xC9, 0x0C, 0xE8, 0x3B, 0x83, 0x5F, 0xA0, 0x3D, 0x00,
-    0xA6, 0x96, 0xFB, 0x07, 0x1A, 0xB7, 0x00, 0x8E, 0x0C, 0x47, 0xD7, 0x53, 0xB7, 0x01, 0x2E, 0x12,
-    0xF5, 0x40, 0x9C, 0x73, 0x4B, 0xE0, 0x3A, 0x71, 0x13, 0xE0, 0xC5, 0xB9, 0x12, 0xB8, 0x4B, 0x1C,
-    0xDD, 0xEE, 0xE5, 0x65, 0x98, 0xB8, 0x0A, 0x68, 0x49, 0x86, 0xAF, 0xC4, 0xAD, 0x7C, 0x76, 0xCA,
-    0x7A, 0x1C, 0xA8, 0x42, 0xBB, 0xA8, 0x81, 0xCB, 0xC0, 0xF5, 0x80, 0x0F, 0x3E, 0x17, 0x92, 0xC2,
-    0xE3, 0x1D, 0x78, 0xE2, 0x73, 0x26, 0xA5, 0x62, 0xD9, 0x36, 0x9F, 0x03, 0x69, 0xC9, 0x83, 0x9A,
-    0xBD, 0xE2, 0xF3, 0xC6, 0x14, 0x26, 0x51, 0x27, 0x12, 0xAC, 0x43, 0x60, 0x9E, 0x2B, 0xFD, 0xC1,
-    0xA6, 0xA1, 0xC4, 0xB9, 0x8F, 0x3E, 0xA3, 0xCE, 0x31, 0xF0, 0xE8, 0xA3, 0x79, 0xF4, 0xA3, 0x0B,
-    0xBC, 0xFA, 0xE8, 0x0F, 0x38, 0xD7, 0x6A, 0x5B, 0xF6, 0x4C, 0x83, 0x4C, 0xB9, 0x9A, 0xBD, 0x25,
-    0x90, 0xE7, 0x6F, 0xA1, 0xAB, 0xB9, 0x16, 0x1E, 0xC5, 0xC4, 0x52, 0x2E, 0x57, 0x95, 0x79, 0xE0,
-    0x9E, 0xF5, 0x7D, 0x61, 0x1C, 0x2A, 0x34, 0x4F, 0x1D, 0x05, 0x39, 0x71, 0x37, 0x93, 0xB2, 0xC6,
-    0x71, 0x1A, 0xFE, 0x99, 0xF4, 0x69, 0x26, 0xF3, 0x4D, 0xC3, 0x17, 0x3D, 0x9D, 0xC4, 0x8D, 0xC5,
-    0x4A, 0x7A, 0x69, 0x26, 0xAE, 0x2B, 0x96, 0xFB, 0x0C, 0x11, 0x5B, 0x1E, 0xCD, 0x2A, 0x29, 0x53,
-    0xF1, 0x59, 0x11, 0xAD, 0xF0, 0xF8, 0x21, 0x43, 0x7A, 0x66, 0x56, 0x0C, 0x9A, 0x61, 0x73, 0x62,
-    0x66, 0xCA, 0xA0, 0x6F, 0x3A, 0xA5, 0x51, 0xA6, 0xEA, 0xFA, 0x95, 0xD9, 0x11, 0x55, 0x37, 0x5D,
-    0xEF, 0x2F, 0xB1, 0xF4, 0x76, 0xB0, 0xEC, 0x62, 0x9D, 0xAE, 0x45, 0xC2, 0x88, 0xB9, 0xC6, 0x3E,
-    0xC7, 0xEB, 0xEF, 0x87, 0x62, 0xB0, 0x41, 0x18, 0x5E, 0xC2, 0xD2, 0x6C, 0x57, 0x40, 0x79, 0xA0,
-    0x8C, 0x61, 0x95, 0xED, 0x00, 0xFA, 0xA1, 0xFD, 0x79, 0x78, 0x9C, 0x4D, 0x54, 0xCB, 0x55, 0x42,
-    0x41, 0x0C, 0x8D, 0x8A, 0x8A, 0x0A, 0x62, 0x07, 0xDA, 0x01, 0x76, 0xA0, 0x56, 0xA0, 0x1D, 0x40,
-    0x07, 0xDA, 0x81, 0x2C, 0xDC, 0x6B, 0x07, 0xD2, 0x81, 0xAC, 0xDC, 0x42, 0x07, 0xDA, 0x01, 0x74,
-    0xE0, 0x43, 0xF9, 0x3D, 0x84, 0x77, 0x4D, 0x32, 0x49, 0xC6, 0x39, 0x87, 0x43, 0x86, 0x64, 0x6E,
-    0x6E, 0x6E, 0x12, 0x0A, 0xE0, 0x94, 0xEC, 0xCC, 0x00, 0x37, 0x7B, 0xC0, 0xFD, 0x08, 0x38, 0xF7,
-    0xFB, 0x0A, 0xD8, 0x33, 0x73, 0x00, 0xB4, 0xD9, 0xDD, 0x71, 0xD7, 0x16, 0xA8, 0x9B, 0x59, 0x30,
-    0xD8, 0x35, 0xF0, 0x6A, 0xD7, 0x33, 0x00, 0x0D, 0xB3, 0xBF, 0x81, 0x13, 0x02, 0xC6, 0x76, 0xED,
-    0x22, 0x83, 0x2F, 0x80, 0x43, 0xDA, 0x44, 0xEE, 0x3E, 0x32, 0xF8, 0x5A, 0xD2, 0x72, 0xEE, 0x5A,
-    0xE0, 0x07, 0xF8, 0x56, 0x1E, 0xCC, 0x23, 0x37, 0x73, 0xC7, 0x57, 0xA4, 0x1D, 0x12, 0x4D, 0x25,
-    0xA1, 0x73, 0x07, 0x76, 0xD5, 0x64, 0x72, 0xCF, 0x44, 0x9F, 0x40, 0xCB, 0x41, 0x86, 0x92, 0xDC,
-    0x2A, 0xBE, 0x25, 0x7A, 0x01, 0xAE, 0x1C, 0xE4, 0xD6, 0x11, 0x46, 0x1A, 0x7F, 0xC7, 0x92, 0x38,
-    0xF7, 0xA6, 0x23, 0x14, 0x5A, 0x21, 0x07, 0xBF, 0x39, 0xF7, 0xA3, 0xAD, 0xE0, 0xF0, 0xF9, 0x49,
-    0xDC, 0xB6, 0x46, 0x6B, 0xC2, 0x55, 0xAC, 0x24, 0x7B, 0xAA, 0xB8, 0x96, 0xAA, 0xDB, 0xB1, 0x48,
-    0xE6, 0x3F, 0xF6, 0x8A, 0x77, 0x52, 0xC4, 0x7E, 0xE2, 0x3E, 0x94, 0x1C, 0x1A, 0x56, 0xA5, 0x10,
-    0x56, 0xF2, 0x48, 0xBE, 0x37, 0x4C, 0x67, 0x90, 0xC2, 0xCE, 0x4C, 0x96, 0x49, 0xD2, 0x9B, 0xAF,
-    0x6D, 0x61, 0x79, 0x4C, 0xCA, 0xBA, 0x63, 0xCC, 0x5A, 0xE9, 0xDA, 0xA4, 0x8B, 0xD4, 0xF3, 0x9E,
-    0xB5, 0xA0, 0xAB, 0x95, 0x4B, 0x44, 0x5D, 0xE8, 0x5E, 0xA5, 0x8A, 0x9B, 0xE2, 0xE2, 0xC8, 0x47,
-    0xE3, 0x4E, 0x54, 0xAA, 0x5D, 0x58, 0x7A, 0xA6, 0x33, 0x34, 0xEE, 0xA2, 0xBE, 0xD9, 0x4A, 0x9A,
-    0x7E, 0xF5, 0xC7, 0xA5, 0x8A, 0x52, 0x98, 0x6D, 0x1D, 0x48, 0xC6, 0x46, 0xA5, 0x1C, 0x28, 0xEC,
-    0xDA, 0xFB, 0xC6, 0xCF, 0x0F, 0x84, 0xBB, 0x90, 0x7A, 0xD0, 0x2C, 0x95, 0xC9, 0x2A, 0x20, 0xC7,
-    0xC2, 0xBD, 0x91, 0x38, 0x69, 0x09, 0xA9, 0x19, 0x02, 0xD2, 0x34, 0xEE, 0xF2, 0xE0, 0x5C, 0xC2,
-    0xDA, 0xC9, 0xF5, 0x20, 0x58, 0x13, 0x9B, 0xDC, 0x92, 0x1F, 0xBC, 0xC4, 0xB0, 0x5F, 0x8B, 0x2C,
-    0x3F, 0x96, 0x79, 0xCE, 0x69, 0x46, 0x31, 0x2E, 0x24, 0x62, 0x2E, 0x2D, 0x73, 0xC1, 0x21, 0x85,
-    0x8F, 0x88, 0xF0, 0xFE, 0xE0, 0x4F, 0xC7, 0xA7, 0x62, 0x6F, 0x96, 0xD7, 0x82, 0xA7, 0x8C, 0x7C,
-    0xA6, 0x39, 0xF1, 0xE1, 0x22, 0x2F, 0x13, 0x47, 0xDD, 0xF8, 0x26, 0x5C, 0x72, 0x9E, 0x52, 0xD5,
-    0xF2, 0xC2, 0x9E, 0x02, 0xBE, 0x42, 0xEB, 0x57, 0x35, 0x76, 0xFC, 0x77, 0x57, 0x8D, 0x45, 0x6A,
-    0x57, 0x36, 0x99, 0xA9, 0x73, 0xA5, 0xAB, 0xC6, 0xEC, 0x1F, 0x63, 0x9E, 0xB5, 0xC1, 0x55, 0xEC,
-    0xC8, 0x14, 0xE3, 0xBC, 0x81, 0xBA, 0x8E, 0x36, 0x9B, 0x8A, 0x9E, 0xF7, 0x56, 0xB7, 0x29, 0x30,
-    0x7A, 0xE2, 0xAA, 0x85, 0xAB, 0x44, 0x96, 0xE6, 0x52, 0x5C, 0xE1, 0x91, 0xF5, 0xE3, 0x96, 0x91,
-    0xB3, 0x67, 0x71, 0xE2, 0x4C, 0x63, 0xE7, 0x94, 0xBD, 0x0D, 0xBE, 0x9E, 0xCF, 0xFC, 0x37, 0xA0,
-    0x83, 0xDE, 0xC9, 0xAE, 0xFE, 0xFF, 0xC0, 0xE9, 0xBF, 0xFF, 0x9F, 0x98, 0xD2, 0x80, 0xD0, 0xF9,
-    0xA4, 0x3F, 0x65, 0x9C, 0xB9, 0xC6, 0x78, 0x9C, 0x4D, 0x52, 0xD9, 0x55, 0x42, 0x31, 0x14, 0x8C,
-    0xE0, 0x82, 0xEB, 0xA1, 0x02, 0x8E, 0x1D, 0x40, 0x07, 0xDA, 0x01, 0x74, 0xA0, 0x1D, 0x48, 0x07,
-    0xBE, 0x63, 0x03, 0xD8, 0x81, 0x76, 0xA0, 0x3F, 0x7E, 0x43, 0x07, 0xDA, 0x81, 0xBE, 0x0A, 0x3C,
-    0xA0, 0x82, 0x6C, 0x8E, 0x77, 0x4F, 0xE6, 0x27, 0xC9, 0xE4, 0x26, 0x77, 0x99, 0xA9, 0x00, 0xEC,
-    0x25, 0xC7, 0x33, 0x9D, 0x9A, 0xE9, 0x0F, 0xE8, 0x04, 0xF5, 0x03, 0x8C, 0x52, 0xFA, 0x06, 0x1E,
-    0x9C, 0x69, 0xD3, 0xFD, 0x69, 0x4A, 0x8F, 0x12, 0xAB, 0xB8, 0xA7, 0xFD, 0x6E, 0xDC, 0x08, 0xBE,
-    0x80, 0x27, 0x5E, 0xE7, 0xC0, 0xAD, 0x51, 0x5B, 0xFB, 0x97, 0xB3, 0x34, 0x84, 0x19, 0x7A, 0xF6,
-    0x73, 0xDA, 0x1C, 0x0B, 0x35, 0x03, 0xC6, 0x1A, 0xBE, 0x00, 0xAE, 0x64, 0xB3, 0x06, 0xBA, 0x4A,
-    0xBD, 0x01, 0x9F, 0x3B, 0xB4, 0x0E, 0x28, 0xFC, 0x40, 0xA9, 0x1E, 0x6D, 0x0F, 0x69, 0xAD, 0x81,
-    0x57, 0xAF, 0x70, 0x09, 0x5C, 0xE4, 0x45, 0xF0, 0x01, 0xBC, 0x6B, 0x70, 0xCB, 0xA9, 0x4B, 0xF9,
-    0x84, 0xBF, 0x8C, 0x66, 0xD3, 0x8A, 0x53, 0x51, 0xE2, 0x7E, 0xA6, 0xA6, 0x54, 0x10, 0x97, 0x77,
-    0x94, 0xA9, 0x6B, 0x3A, 0xBE, 0x58, 0x29, 0x8E, 0x0D, 0x18, 0x37, 0x05, 0xC3, 0xAD, 0x44, 0x5B,
-    0x86, 0x4A, 0xA8, 0x46, 0x49, 0xF1, 0x58, 0x62, 0x44, 0x06, 0x1A, 0x5E, 0x0C, 0x32, 0x37, 0x90,
-    0x4B, 0x57, 0xFC, 0x22, 0x06, 0x63, 0xE0, 0x3A, 0xF3, 0x18, 0x04, 0x13, 0xC9, 0xB8, 0x5F, 0x52,
-    0x73, 0xA1, 0x3A, 0x05, 0xD3, 0xA6, 0xF3, 0xD6, 0x04, 0x33, 0xB0, 0x48, 0x77, 0x2A, 0xAB, 0x43,
-    0xAC, 0x40, 0x61, 0x67, 0xF9, 0x9D, 0x08, 0x5E, 0x9A, 0xC3, 0xAC, 0x50, 0x9A, 0xC3, 0xEE, 0x4B,
-    0x73, 0xB8, 0x15, 0xD4, 0x5C, 0x82, 0xCA, 0xAC, 0x90, 0xCD, 0x11, 0x56, 0xE0, 0xAE, 0x4E, 0x94,
-    0xDA, 0x78, 0xC7, 0x0B, 0x9F, 0xF5, 0x30, 0xAC, 0x40, 0x4A, 0x42, 0x14, 0x99, 0x8A, 0xD6, 0x8C,
-    0x9E, 0xCF, 0x7F, 0x9D, 0xAD, 0xB0, 0x54, 0x5B, 0x0D, 0xCC, 0x37, 0x8C, 0x5A, 0xB5, 0xAC, 0x0B,
-    0x2B, 0xD8, 0xF5, 0xCA, 0x3D, 0x68, 0x9F, 0xF4, 0xC5, 0x35, 0x59, 0xD2, 0x19, 0xA7, 0x8A, 0xC4,
-    0x51, 0x50, 0xEB, 0x1F, 0x50, 0x0F, 0x23, 0x5C, 0x78, 0x9C, 0xED, 0x91, 0xD9, 0x11, 0x01, 0x51,
-    0x10, 0x45, 0xDB, 0x52, 0xF6, 0x52, 0x22, 0x40, 0x06, 0x64, 0x40, 0x06, 0x64, 0x40, 0x08, 0x42,
-    0xF0, 0xE3, 0x5B, 0x08, 0x64, 0x40, 0x06, 0x64, 0x30, 0x32, 0x40, 0x04, 0x4A, 0xD9, 0xCB, 0x72,
-    0x75, 0xBF, 0xA5, 0xDF, 0x28, 0x3F, 0x02, 0xD0, 0x1F, 0x73, 0x7B, 0xEE, 0xBC, 0xBA, 0xDD, 0xE7,
-    0xCD, 0x11, 0x18, 0x53, 0xA8, 0x3B, 0x50, 0x9D, 0x03, 0x48, 0xA8, 0xD3, 0xE4, 0xB7, 0x6C, 0x9D,
-    0x1F, 0x39, 0xB5, 0xF8, 0xC0, 0x8E, 0xE8, 0x06, 0xD4, 0xD4, 0x3A, 0x02, 0x3D, 0xA2, 0x3D, 0x30,
-    0x51, 0xEB, 0x01, 0x94, 0x88, 0x86, 0xB1, 0xB0, 0x36, 0xF7, 0x69, 0xD6, 0x17, 0x90, 0x77, 0xD6,
-    0x12, 0x58, 0x88, 0x9E, 0x81, 0x86, 0xB3, 0x4E, 0xAE, 0x5D, 0x01, 0x33, 0x67, 0x3D, 0x81, 0x82,
-    0x68, 0x97, 0x03, 0x92, 0xE4, 0xBB, 0x84, 0x1F, 0x63, 0xBE, 0xC9, 0x79, 0x47, 0x72, 0xF0, 0x61,
-    0x9C, 0x5A, 0xD6, 0x95, 0xCD, 0x1C, 0x99, 0x9D, 0xB1, 0x96, 0x30, 0xA5, 0x58, 0xFB, 0xC0, 0xDA,
-    0xEF, 0xCC, 0x4C, 0x45, 0x96, 0x8D, 0xA1, 0xB1, 0xC5, 0x4C, 0x2D, 0x96, 0x8B, 0xA1, 0xB1, 0x35,
-    0x00, 0x22, 0x1B, 0x95, 0x52, 0xDA, 0x97, 0xA0, 0x0D, 0xFC, 0x14, 0x3F, 0xBD, 0x44, 0xDB, 0x00,
-    0x66, 0x77, 0xEC, 0xD0, 0x35, 0xE0, 0xDB, 0x4B, 0x89, 0x2A, 0x1F, 0x37, 0x6E, 0x98, 0x46, 0x9F,
-    0xFF, 0x45, 0x98, 0x9E, 0x4A, 0x63, 0x6B, 0x0A, 0xA9, 0x4C, 0xDC, 0x12, 0xA6, 0x40, 0xA3, 0x4C,
-    0x81, 0x46, 0x99, 0x02, 0x8D, 0x32, 0xC5, 0x68, 0x4C, 0x55, 0xBE, 0xA2, 0xFE, 0xD6, 0xAF, 0xD6,
-    0x1B, 0x20, 0x36, 0xDA, 0x66, 0x78, 0x9C, 0x9D, 0xD2, 0xDB, 0x0D, 0x01, 0x61, 0x10, 0x05, 0xE0,
-    0x75, 0xBF, 0x27, 0x2A, 0x10, 0x1D, 0xD0, 0x80, 0xD0, 0xC1, 0xEA, 0x80, 0x0E, 0xE8, 0x80, 0x0E,
-    0x6C, 0x07, 0x74, 0x40, 0x07, 0xB6, 0x03, 0x1A, 0x10, 0xAB, 0x01, 0x12, 0xAC, 0xFB, 0x3A, 0xC6,
-    0x93, 0x33, 0xF3, 0xB6, 0xE6, 0xED, 0x9C, 0xE4, 0xFB, 0x33, 0xC9, 0x3F, 0x01, 0xF4, 0xA4, 0x83,
-    0xF8, 0x85, 0xBF, 0xFF, 0xCD, 0x5B, 0x8A, 0xA4, 0x43, 0x73, 0x02, 0x46, 0x9C, 0x9D, 0x08, 0x28,
-    0x73, 0xF6, 0xAC, 0x38, 0x03, 0x03, 0xCE, 0x55, 0x79, 0xB3, 0xC4, 0xC5, 0x0C, 0x38, 0x24, 0xB8,
-    0x08, 0x81, 0x9E, 0x15, 0x45, 0x2E, 0x16, 0x56, 0x5C, 0x00, 0x97, 0x73, 0x5D, 0x96, 0x28, 0x70,
-    0xE1, 0x03, 0x5B, 0xB5, 0xF6, 0x15, 0x68, 0x5B, 0x91, 0xE7, 0x62, 0x6D, 0xC5, 0x0D, 0x68, 0x70,
-    0x6E, 0x8A, 0xC8, 0x19, 0xB1, 0x52, 0xE2, 0x6E, 0x44, 0x47, 0x44, 0x96, 0x8B, 0x1D, 0xB0, 0x54,
-    0xE2, 0x01, 0xD4, 0x38, 0x77, 0x45, 0x64, 0x8C, 0x98, 0x2B, 0xF1, 0x34, 0xA2, 0xFF, 0xFD, 0x41,
-    0x2E, 0x8E, 0xC0, 0x54, 0x89, 0x17, 0x50, 0xE1, 0x3C, 0x14, 0x91, 0x32, 0x62, 0xA2, 0x44, 0x64,
-    0xC4, 0xD8, 0x8A, 0xF8, 0x47, 0x21, 0x02, 0x1B, 0x9A, 0x56, 0x68, 0xAE, 0xD0, 0xFD, 0xA3, 0xF8,
-    0x00, 0x4B, 0x03, 0x12, 0x54, 0x78, 0x9C, 0xFB, 0xFE, 0x1F, 0x04, 0x18, 0xBF, 0xE3, 0xA0, 0x56,
-    0xAF, 0x5A, 0x05, 0xA2, 0x98, 0x19, 0x18, 0x18, 0x46, 0x29, 0x1A, 0x53, 0xD0, 0xB0, 0xC6, 0x19,
-    0x1D, 0x00, 0xFA, 0x60, 0xD0, 0xEB, 0x78, 0x9C, 0x8D, 0xD0, 0xDB, 0x0D, 0x01, 0x51, 0x14, 0x85,
-    0x61, 0xD7, 0x10, 0xE2, 0xD2, 0x01, 0x1D, 0xD0, 0x01, 0x1D, 0xD0, 0x01, 0x1D, 0xD0, 0x81, 0x12,
-    0xE8, 0x80, 0x0E, 0xA6, 0x04, 0x3A, 0xA0, 0x03, 0x3A, 0x10, 0xF7, 0x61, 0x98, 0xDF, 0xDB, 0x5E,
-    0x67, 0x24, 0x26, 0x67, 0xBF, 0x7D, 0xC9, 0x5E, 0x2F, 0x7F, 0xC8, 0x3E, 0x63, 0x77, 0x86, 0xBC,
-    0x61, 0x03, 0x15, 0xC3, 0x18, 0x1A, 0xFA, 0x83, 0x89, 0xF0, 0x62, 0x2B, 0x5C, 0x21, 0x67, 0xD8,
-    0x41, 0xD9, 0x30, 0x85, 0xBA, 0xA1, 0x09, 0x03, 0x8D, 0x22, 0x02, 0xE1, 0x06, 0x59, 0xC3, 0x01,
-    0x4A, 0x86, 0x05, 0xD4, 0x0C, 0x5D, 0xE8, 0x69, 0xF4, 0x61, 0x29, 0x3C, 0x38, 0x0A, 0x27, 0x28,
-    0x1A, 0x56, 0x50, 0x35, 0xF4, 0xA1, 0xA5, 0xBF, 0x98, 0x99, 0x10, 0xFE, 0x44, 0x29, 0x18, 0x7C,
-    0xA3, 0x3C, 0xDD, 0x28, 0x17, 0xEF, 0x28, 0x23, 0x8D, 0x22, 0xD6, 0x82, 0x67, 0x94, 0x76, 0x22,
-    0xCA, 0xDB, 0x8D, 0x72, 0x07, 0x21, 0x35, 0x4A, 0x47, 0x7F, 0x31, 0x73, 0x21, 0x74, 0xB3, 0xFE,
-    0x8F, 0x32, 0x4C, 0x64, 0x4D, 0x8F, 0xF2, 0x05, 0xF3, 0xC2, 0x84, 0x20, 0x78, 0x9C, 0xFB, 0xFD,
-    0x1F, 0x04, 0x7E, 0x63, 0x90, 0xCB, 0x57, 0xAD, 0xFA, 0xF7, 0xFF, 0x3F, 0x03, 0x03, 0xC3, 0x9F,
-    0x51, 0x92, 0x14, 0x12, 0x12, 0x6E, 0x98, 0xE1, 0x09, 0x21, 0x01, 0x3F, 0x6A, 0xD1, 0x6D, 0x78,
-    0x9C, 0x35, 0xCE, 0x8D, 0x0D, 0x01, 0x41, 0x10, 0x86, 0xE1, 0x0F, 0xF1, 0x13, 0x42, 0x74, 0x40,
-    0x07, 0x74, 0xA0, 0x84, 0x53, 0x82, 0x0E, 0x28, 0x41, 0x09, 0x3A, 0xA0, 0x03, 0x3A, 0x50, 0x82,
-    0x2B, 0x41, 0x09, 0x88, 0x9C, 0x08, 0x77, 0xAF, 0x19, 0xB3, 0xB7, 0xD9, 0x64, 0x9F, 0xFD, 0xF9,
-    0x66, 0x56, 0x92, 0xC6, 0xD0, 0x56, 0x1A, 0x1B, 0x18, 0xD4, 0xCE, 0x61, 0x56, 0xFB, 0x09, 0xFB,
-    0xDA, 0x1F, 0x20, 0x71, 0x6A, 0xA4, 0x13, 0xDE, 0xBA, 0x87, 0xE1, 0x2B, 0x54, 0x2C, 0xC2, 0x05,
-    0x47, 0x9B, 0xE1, 0x2F, 0xD9, 0x0D, 0x1A, 0xCE, 0xB9, 0x3D, 0xDE, 0x41, 0xD7, 0x7D, 0xB0, 0xD5,
-    0xF6, 0x23, 0xF7, 0xDD, 0xEF, 0x4B, 0x32, 0xF7, 0xCB, 0x73, 0x05, 0x67, 0x77, 0xE5, 0x47, 0x16,
-    0x6E, 0x4A, 0xCB, 0x7F, 0x1F, 0x0B, 0xF7, 0xA4, 0xD3, 0xBF, 0x44, 0x84, 0x1F, 0x51, 0xBA, 0x64,
-    0x2D, 0xBD, 0xA3, 0x65, 0xC1, 0x45, 0x22, 0xAA, 0x59, 0xB8, 0xB5, 0x4A, 0x5F, 0xB4, 0x70, 0x3F,
-    0x4F, 0xDD, 0x2D, 0x3C, 0xF9, 0x01, 0x5D, 0xE5, 0x64, 0xE6, 0x78, 0x9C, 0xFB, 0xF7, 0x1F, 0x19,
-    0xB0, 0xFE, 0x23, 0x85, 0xBB, 0x72, 0x15, 0x32, 0x60, 0x06, 0x00, 0x57, 0xFB, 0x41, 0x27, 0x78,
-    0x9C, 0x3B, 0xF0, 0xFF, 0xFF, 0x7B, 0x46, 0x06, 0x06, 0x81, 0xBF, 0xFF, 0xFF, 0x73, 0x31, 0x30,
-    0x30, 0x3C, 0xFA, 0xFF, 0xDF, 0x1F, 0x48, 0x19, 0x00, 0x45, 0x81, 0x14, 0xC3, 0x97, 0xFF, 0xFF,
-    0x39, 0x81, 0x54, 0x02, 0x44, 0x94, 0xE1, 0x07, 0x44, 0x74, 0x01, 0x44, 0x94, 0xE1, 0xF7, 0x7F,
-    0x7F, 0x00, 0x89, 0x36, 0x1A, 0x8E, 0x78, 0x9C, 0x85, 0x91, 0xAD, 0x6E, 0x42, 0x41, 0x10, 0x85,
-    0xE7, 0x92, 0x4B, 0x03, 0x97, 0x40, 0x91, 0x78, 0x50, 0x18, 0x48, 0x13, 0x24, 0x29, 0x7D, 0x82,
-    0x52, 0x12, 0xB0, 0x3C, 0x00, 0x06, 0x43, 0x30, 0x4D, 0x6A, 0x91, 0xF8, 0x9A, 0xBE, 0x01, 0x55,
-    0x04, 0x47, 0xAB, 0x2A, 0xA9, 0xA8, 0xA8, 0x43, 0xD4, 0x10, 0x12, 0x12, 0xA0, 0xA1, 0xFC, 0xA4,
-    0xCD, 0x61, 0x66, 0x67, 0xBB, 0x17, 0xC7, 0x11, 0xB3, 0xFB, 0x65, 0x67, 0x66, 0xCF, 0xCE, 0x12,
-    0xB1, 0x6E, 0x3A, 0xDD, 0x12, 0x59, 0xA5, 0x3F, 0xC1, 0x1A, 0x47, 0x15, 0xF6, 0x30, 0x9A, 0xFA,
-    0x42, 0x5F, 0xB0, 0x7A, 0x60, 0xA8, 0xC0, 0xE9, 0x82, 0x68, 0xCD, 0x4B, 0x2B, 0x7B, 0xF5, 0xC6,
-    0x4B, 0x81, 0xE8, 0x17, 0x28, 0x4B, 0xC1, 0x06, 0x18, 0x48, 0xE2, 0xD4, 0x23, 0x5B, 0xE1, 0x3D,
-    0x01, 0xB7, 0x7A, 0xD1, 0x01, 0x88, 0xBE, 0x03, 0x29, 0x25, 0x4E, 0x8D, 0x55, 0xEB, 0x75, 0x5F,
-    0x89, 0xDB, 0xC5, 0xC9, 0x69, 0x09, 0x04, 0xE7, 0xE8, 0x6E, 0xB4, 0x50, 0x33, 0x42, 0x43, 0x67,
-    0x8D, 0xE9, 0x03, 0x27, 0xD4, 0xC6, 0x29, 0x6D, 0x39, 0xDE, 0xE7, 0x3C, 0xED, 0x52, 0x64, 0xC8,
-    0xBB, 0x9E, 0x2F, 0xFA, 0x4A, 0x4B, 0xEC, 0x27, 0x11, 0xD2, 0x0F, 0xE0, 0x87, 0xC4, 0x23, 0x8A,
-    0x84, 0x74, 0x70, 0xB4, 0xD2, 0x33, 0x9B, 0xC9, 0xBB, 0x60, 0xFB, 0xEF, 0x5C, 0x5C, 0x04, 0xDF,
-    0x40, 0xD3, 0xD0, 0x4E, 0x88, 0x27, 0x81, 0x18, 0x59, 0xB7, 0x89, 0xAA, 0xC4, 0xC7, 0xDE, 0xDC,
-    0xF8, 0x4C, 0xCA, 0xA8, 0x54, 0x7F, 0xC0, 0x25, 0x3D, 0x5B, 0x98, 0xBC, 0x02, 0xD7, 0x64, 0x1E,
-    0x21, 0xC5, 0x7D, 0xE3, 0x38, 0x3D, 0x93, 0xEF, 0xCA, 0xC8, 0xB0, 0x27, 0xD2, 0xBC, 0xD6, 0x6D,
-    0x58, 0x3F, 0x47, 0x58, 0x88, 0xF7, 0x2E, 0x78, 0x9C, 0xD5, 0xD1, 0xCB, 0x11, 0x82, 0x30, 0x10,
-    0x06, 0x60, 0x61, 0x40, 0x90, 0x83, 0x67, 0x8F, 0x96, 0x62, 0x07, 0x38, 0xE3, 0x81, 0x23, 0x55,
-    0x38, 0x96, 0x41, 0x09, 0x94, 0x40, 0x09, 0x6A, 0x07, 0x76, 0x40, 0x09, 0x1C, 0x74, 0x7C, 0xE1,
-    0xCC, 0xEF, 0x6E, 0x36, 0x66, 0x36, 0x71, 0x2C, 0xC0, 0x5C, 0xC8, 0x17, 0x92, 0xDD, 0x4D, 0x76,
-    0x04, 0x26, 0x6A, 0x8C, 0x7F, 0xCB, 0xCD, 0xAE, 0x8A, 0x1D, 0x97, 0x0F, 0x00, 0xC3, 0xE2, 0xC3,
-    0x3B, 0xCC, 0x98, 0x0A, 0x8F, 0x22, 0x74, 0xC2, 0x97, 0x25, 0x0A, 0x43, 0x5A, 0xAF, 0xB6, 0x4F,
-    0xFA, 0xD4, 0xC2, 0x86, 0x83, 0x50, 0x80, 0x21, 0x32, 0x4C, 0x98, 0x2B, 0x9A, 0xE4, 0xCC, 0x52,
-    0x2A, 0xB8, 0x02, 0x73, 0xE6, 0x4C, 0x78, 0xE2, 0xC3, 0xC4, 0x48, 0xB8, 0xE6, 0x54, 0xAA, 0x66,
-    0xA0, 0xD7, 0xE4, 0x8D, 0x8A, 0x94, 0x2A, 0x51, 0xA4, 0xD0, 0xA9, 0xE2, 0x85, 0x6E, 0xA1, 0x78,
-    0x06, 0x32, 0x9F, 0xF9, 0xEF, 0xBF, 0xC1, 0xD9, 0x20, 0x72, 0x90, 0x97, 0xA7, 0xDF, 0x35, 0xC7,
-    0xFE, 0x8D, 0x0A, 0x77, 0xDF, 0x92, 0x59, 0x0B, 0x6F, 0xF6, 0x35, 0x90, 0xDA, 0xBD, 0xC8, 0x0C,
-    0xDB, 0x48, 0xD2, 0xF4, 0xFE, 0x3B, 0x97, 0xCC, 0xDE, 0x75, 0x21, 0x63, 0xEE, 0x0F, 0x56, 0x8D,
-    0x29, 0xA5, 0xB3, 0x1D, 0x1C, 0x12, 0xC3, 0x56, 0xF7, 0x57, 0x86, 0xEB, 0xFE, 0x1B, 0xC9, 0x6E,
-    0x24, 0x4E, 0x78, 0x9C, 0x75, 0x91, 0x4B, 0x0E, 0x01, 0x51, 0x10, 0x45, 0x0B, 0xED, 0xD3, 0xA1,
-    0x63, 0x8E, 0x48, 0x2F, 0xC1, 0xA0, 0x47, 0x12, 0x6B, 0x20, 0x31, 0x30, 0x30, 0x20, 0x21, 0x91,
-    0xB0, 0x00, 0x43, 0x4B, 0x60, 0x07, 0x7A, 0x07, 0x96, 0x80, 0x1D, 0xD8, 0x89, 0x5F, 0x7C, 0x12,
-    0x2D, 0x57, 0xBD, 0x9F, 0x7E, 0x88, 0x3B, 0xE9, 0x9C, 0xF7, 0xFA, 0x56, 0xD5, 0xBB, 0x45, 0x24,
-    0xD4, 0x9E, 0x8E, 0x52, 0x64, 0xD4, 0x7A, 0x80, 0xD5, 0xD5, 0x54, 0x8B, 0x20, 0xD5, 0x50, 0x78,
-    0x87, 0x56, 0x46, 0xD0, 0xC2, 0x10, 0x66, 0xE6, 0x72, 0x1C, 0x0C, 0x84, 0x3F, 0xCD, 0x4E, 0xFE,
-    0x54, 0x44, 0x85, 0x27, 0x50, 0x25, 0xDA, 0x01, 0x4B, 0x59, 0x62, 0x0B, 0xCC, 0x89, 0x2E, 0x40,
-    0x41, 0xA2, 0xCF, 0xBF, 0x11, 0x71, 0x97, 0xA4, 0xEA, 0x70, 0x63, 0x33, 0x9F, 0xAD, 0x75, 0xFF,
-    0x23, 0xE0, 0xF6, 0x81, 0x9E, 0xC6, 0x0D, 0xDB, 0x42, 0xA0, 0xA8, 0x91, 0x07, 0xF0, 0xB8, 0xB0,
-    0x47, 0xB1, 0x0E, 0x40, 0xFE, 0x13, 0x5D, 0x0B, 0x8F, 0x9F, 0x78, 0x02, 0x72, 0xFF, 0x6F, 0x0F,
-    0x3F, 0x68, 0x57, 0xFE, 0xEA, 0x6B, 0x4D, 0x25, 0xC4, 0x33, 0x37, 0xAD, 0x21, 0xF9, 0x45, 0xAB,
-    0xD8, 0x97, 0xB7, 0xDE, 0x7B, 0x06, 0xB2, 0x74, 0x7D, 0x97, 0xE6, 0x8B, 0x44, 0x9C, 0x55, 0x28,
-    0x6D, 0x22, 0xC9, 0x32, 0x93, 0x1F, 0xC9, 0x24, 0x65, 0xCE, 0x93, 0x60, 0x28, 0x72, 0x76, 0xC8,
-    0xDE, 0x82, 0x4A, 0xC9, 0xEC, 0x68, 0xEF, 0x48, 0x34, 0x1B, 0x2C, 0xE9, 0xFE, 0x6A, 0xBF, 0xF5,
-    0x78, 0xD4, 0xF6, 0xB4, 0xA3, 0xB6, 0xFF, 0x02, 0x89, 0xB8, 0xBF, 0x10, 0x78, 0x9C, 0x63, 0x60,
-    0x80, 0x83, 0x0D, 0xFF, 0xFF, 0xF3, 0x33, 0x0C, 0x55, 0xAE, 0x41, 0x59, 0xBA, 0x08, 0x82, 0xBB,
-    0xF8, 0x3F, 0x10, 0xE4, 0xC2, 0xB8, 0x13, 0xFE, 0x83, 0x81, 0x2F, 0x84, 0x2B, 0xF0, 0x17, 0xC2,
-    0xFD, 0xBF, 0x15, 0xCC, 0xBD, 0xF8, 0x1F, 0x01, 0x80, 0xDC, 0xDF, 0x40, 0xAA, 0x37, 0xAC, 0xED,
-    0x2F, 0x84, 0x1B, 0x00, 0x24, 0xFD, 0x40, 0xA6, 0xFF, 0x01, 0x73, 0x1F, 0xFC, 0xFF, 0x7F, 0x9F,
-    0x91, 0x01, 0x6A, 0x22, 0x3F, 0xC3, 0xB7, 0xFF, 0xFF, 0xE5, 0x20, 0xCE, 0xF8, 0x05, 0xE2, 0x02,
-    0xD5, 0xB0, 0x41, 0xB8, 0x1F, 0x81, 0x5C, 0x05, 0xA0, 0x5A, 0xA8, 0x23, 0x3F, 0x00, 0xB9, 0x09,
-    0xFF, 0xFF, 0xF7, 0x23, 0xB9, 0x19, 0x68, 0x80, 0x3D, 0x12, 0xF7, 0x00, 0xC2, 0x57, 0x20, 0x2E,
-    0xD0, 0x1E, 0x5E, 0x24, 0x2E, 0x50, 0x3F, 0x37, 0x2A, 0x97, 0x0B, 0x89, 0xFB, 0x11, 0x95, 0xFB,
-    0x01, 0x83, 0xCB, 0x8D, 0xDB, 0x64, 0x34, 0x7B, 0x81, 0xAE, 0xD2, 0x47, 0xE2, 0x02, 0x7D, 0x5F,
-    0x0F, 0xE5, 0x82, 0x14, 0x0A, 0xA0, 0xFA, 0x08, 0x14, 0x54, 0xAC, 0x08, 0xFF, 0x32, 0x7C, 0x85,
-    0x87, 0xC6, 0x1F, 0x10, 0xF7, 0xC2, 0xFF, 0xFF, 0xE7, 0xC1, 0x61, 0xB5, 0x00, 0x1C, 0x56, 0x0E,
-    0xA8, 0x21, 0x09, 0x0A, 0x31, 0x50, 0x38, 0xFF, 0x81, 0x06, 0xFB, 0x06, 0x58, 0x14, 0xDC, 0x87,
-    0xB8, 0xE8, 0x0F, 0x94, 0x9B, 0x06, 0xE1, 0x16, 0x40, 0x63, 0xD0, 0x01, 0xEA, 0xDE, 0x49, 0x90,
-    0xF8, 0x35, 0x40, 0x8D, 0x7D, 0x10, 0x00, 0x00, 0x4A, 0x74, 0x17, 0x2D, 0x78, 0x9C, 0x63, 0x60,
-    0x00, 0x81, 0xA0, 0xF2, 0x70, 0x66, 0x06, 0x18, 0x50, 0x78, 0xF9, 0x1F, 0x08, 0xBC, 0xA1, 0x3C,
-    0x81, 0x9F, 0xFF, 0xC1, 0x40, 0x1B, 0xC2, 0x7D, 0xFC, 0x1F, 0x0A, 0x58, 0x40, 0x3C, 0x07, 0x18,
-    0xEF, 0xBF, 0x3F, 0x88, 0xFB, 0x09, 0xC8, 0xC8, 0x31, 0x49, 0xF9, 0x0D, 0xA4, 0x98, 0x80, 0xDC,
-    0xBF, 0xFF, 0xFF, 0xDB, 0x02, 0x29, 0x03, 0x20, 0xCD, 0xCD, 0xC0, 0x30, 0xE1, 0xFF, 0xFF, 0xF3,
-    0x60, 0x23, 0x2E, 0x82, 0x55, 0x7F, 0xFC, 0xFF, 0x5F, 0x0E, 0xCC, 0x35, 0xF8, 0xFF, 0x7F, 0x3D,
-    0x03, 0x03, 0xD0, 0x16, 0x56, 0x88, 0x0D, 0xBF, 0xFE, 0xFF, 0x67, 0x64, 0xF8, 0xFF, 0xFF, 0x3E,
-    0xD4, 0xFE, 0x2F, 0x40, 0x89, 0x80, 0xFF, 0xFF, 0xEB, 0xA1, 0xDC, 0x0F, 0xFF, 0xFF, 0x73, 0x02,
-    0x4D, 0xD2, 0x87, 0x72, 0x0F, 0xFC, 0xFF, 0xCF, 0x03, 0xC4, 0xFC, 0x50, 0xEE, 0x82, 0xFF, 0xFF,
-    0xF9, 0x80, 0x2A, 0xD6, 0xAF, 0x82, 0x80, 0x5B, 0x40, 0x99, 0x0F, 0xFF, 0x91, 0x01, 0xFF, 0x47,
-    0x14, 0xAE, 0xFC, 0x27, 0xBC, 0x5C, 0xA0, 0x62, 0x2E, 0x06, 0x04, 0xF8, 0x00, 0xF6, 0x07, 0x1C,
-    0x3C, 0x00, 0x5A, 0x86, 0xC4, 0x05, 0x3A, 0x43, 0x1E, 0x89, 0xDB, 0x80, 0x70, 0x33, 0xD4, 0x97,
-    0xF7, 0x91, 0xB8, 0xA0, 0xB0, 0x61, 0x87, 0x32, 0x13, 0x81, 0xF8, 0x2B, 0xC2, 0x4B, 0x7F, 0x80,
-    0x56, 0x5E, 0xF8, 0xFF, 0xFF, 0x3D, 0x24, 0x42, 0x0E, 0xFE, 0x3F, 0xCF, 0x04, 0xD2, 0x0C, 0x31,
-    0x2C, 0xE0, 0x1F, 0x38, 0x98, 0xBE, 0x01, 0xF9, 0xF3, 0x4C, 0x8D, 0x5A, 0x81, 0x86, 0xF4, 0x03,
-    0x45, 0x0B, 0x10, 0x4E, 0xE6, 0x84, 0x06, 0x19, 0x04, 0xD4, 0xA3, 0xC4, 0xE0, 0x79, 0x66, 0xE4,
-    0xF8, 0x5D, 0xC7, 0x02, 0x77, 0x8B, 0x53, 0x59, 0xBA, 0x29, 0x98, 0x01, 0x00, 0xB8, 0x6B, 0xED,
-    0xDA, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x81, 0x80, 0x15, 0xBB, 0xBB, 0x58, 0xC1, 0xAC, 0x89, 0xFF,
-    0x81, 0x80, 0x1F, 0xC4, 0x72, 0x00, 0xB1, 0xFE, 0xF3, 0x81, 0x98, 0x5F, 0xC1, 0x4C, 0x1E, 0x20,
-    0x4B, 0x01, 0xCC, 0xFA, 0xCF, 0x0D, 0x64, 0x2E, 0x00, 0xD2, 0xB5, 0xCA, 0x46, 0xCC, 0x40, 0xE6,
-    0xC7, 0xFF, 0xFF, 0xE7, 0x33, 0x40, 0xC0, 0x37, 0x88, 0x3A, 0x10, 0xF8, 0xF9, 0xFF, 0x3F, 0x2B,
-    0x94, 0xF9, 0xE7, 0xFF, 0x7F, 0x28, 0x8B, 0xE1, 0xEF, 0xFF, 0xF7, 0x08, 0xE6, 0x7D, 0xE2, 0x98,
-    0x9F, 0xFE, 0x43, 0x01, 0x1F, 0x61, 0x66, 0x40, 0x68, 0x28, 0x90, 0x0E, 0x0D, 0x0D, 0x65, 0x25,
-    0xC9, 0x8A, 0x51, 0x26, 0x84, 0x09, 0x00, 0x67, 0xE7, 0xB0, 0x65, 0x78, 0x9C, 0x75, 0x92, 0x3F,
-    0x4B, 0xC4, 0x40, 0x10, 0xC5, 0x27, 0x2A, 0x22, 0xFE, 0x4D, 0x61, 0x6D, 0x52, 0x5A, 0xC9, 0x7D,
-    0x03, 0xAD, 0xEC, 0xFC, 0x53, 0xF9, 0x15, 0x04, 0x9B, 0xB3, 0xB2, 0x13, 0xAC, 0xEC, 0xC4, 0x6B,
-    0xEC, 0x83, 0x82, 0x75, 0xBE, 0x81, 0xD7, 0x0B, 0x9E, 0x36, 0x96, 0x9E, 0x82, 0xA5, 0x70, 0xA7,
-    0xA0, 0xE0, 0x5D, 0xF4, 0xF9, 0x66, 0x67, 0x73, 0xD9, 0x0B, 0x38, 0xC5, 0xB2, 0xBF, 0x64, 0x77,
-    0x66, 0xDE, 0x9B, 0x15, 0x61, 0x34, 0x8E, 0xF6, 0x97, 0x65, 0x14, 0x57, 0x60, 0x1C, 0x4B, 0x0A,
-    0x24, 0xA4, 0x0C, 0x2E, 0xB6, 0x1A, 0x0E, 0xD3, 0x1F, 0x43, 0x6C, 0x3A, 0x7C, 0xF1, 0x84, 0x1B,
-    0x87, 0x43, 0xEE, 0xCE, 0xF6, 0x4E, 0x0B, 0xFD, 0x92, 0xC8, 0x2E, 0xD7, 0x6D, 0xCD, 0x5E, 0x38,
-    0x7C, 0x06, 0xBA, 0x91, 0xE6, 0x6F, 0x39, 0xFC, 0x02, 0x56, 0xAC, 0xDE, 0x40, 0x91, 0x67, 0xA6,
-    0x0D, 0xFB, 0xC4, 0x18, 0xE8, 0x49, 0x85, 0xCC, 0x74, 0xEE, 0x91, 0xED, 0x24, 0x27, 0xC0, 0x7A,
-    0x80, 0x6D, 0x60, 0x29, 0xC0, 0x7B, 0x60, 0x21, 0x40, 0x96, 0x9D, 0x0F, 0x90, 0xE9, 0xE6, 0xC6,
-    0x71, 0xF6, 0xFF, 0xBF, 0xB5, 0xBB, 0xB5, 0xCC, 0xF9, 0x78, 0xDD, 0x5A, 0x57, 0x41, 0xCF, 0xB9,
-    0x29, 0xEA, 0x06, 0x8A, 0xD4, 0x2A, 0xAF, 0xF7, 0x5D, 0xF1, 0x73, 0xE4, 0xC6, 0x50, 0x91, 0x95,
-    0x3A, 0x91, 0xCF, 0x44, 0xDC, 0xF0, 0x4E, 0xA6, 0xE6, 0xA4, 0x3A, 0x16, 0xF8, 0x2C, 0x6D, 0x54,
-    0xA1, 0x23, 0x2B, 0xFC, 0xFE, 0xDA, 0xF0, 0xD0, 0x4F, 0x30, 0x33, 0x94, 0x4B, 0x9B, 0x6F, 0x56,
-    0xB6, 0x6F, 0xD3, 0xCF, 0x2A, 0x35, 0x1A, 0xCC, 0xB9, 0x18, 0x60, 0xBF, 0x72, 0x42, 0x83, 0xED,
-    0xCE, 0x88, 0x3C, 0x4C, 0x79, 0xE4, 0xA3, 0x98, 0x64, 0xD9, 0x1D, 0xA3, 0x96, 0x93, 0x9A, 0xBB,
-    0x23, 0x8C, 0x6F, 0xA0, 0x29, 0xF2, 0xC1, 0x89, 0xAE, 0x8A, 0xC4, 0x8F, 0x70, 0x16, 0xAB, 0x22,
-    0xDC, 0xDD, 0xFE, 0x72, 0xED, 0xA9, 0xD0, 0xD7, 0x91, 0x80, 0x35, 0xBD, 0x13, 0x0F, 0xCA, 0x77,
-    0x15, 0x59, 0x8B, 0xC6, 0x9D, 0xB2, 0xA0, 0x5C, 0xBC, 0xE1, 0xE9, 0x60, 0x42, 0x77, 0x7F, 0xC9,
-    0xE7, 0x3B, 0xD1, 0x78, 0x9C, 0xFB, 0xF5, 0xFF, 0x3F, 0x03, 0x02, 0xFC, 0x1A, 0x52, 0x3C, 0xC7,
-    0xB2, 0x74, 0x16, 0x38, 0xEF, 0xE8, 0x7F, 0x20, 0xF0, 0x86, 0xF2, 0x0E, 0xFD, 0x07, 0x03, 0x2E,
-    0x30, 0x2F, 0x00, 0xC2, 0xF9, 0x7F, 0x1E, 0xCC, 0xFB, 0x06, 0xE5, 0xFD, 0xE7, 0x04, 0xF1, 0x80,
-    0xA2, 0xE9, 0xA9, 0x2F, 0x81, 0x94, 0x3E, 0x98, 0xB7, 0x9F, 0x09, 0x68, 0xC0, 0x8F, 0xFF, 0xFF,
-    0xE7, 0x83, 0x79, 0xEC, 0x20, 0xC3, 0x1B, 0xFE, 0xFF, 0x7F, 0x0F, 0xE2, 0xD5, 0x43, 0x6C, 0xFE,
-    0xF7, 0xFF, 0x3F, 0x13, 0x90, 0xC7, 0x03, 0xE1, 0x01, 0x95, 0xB2, 0x02, 0x79, 0x4C, 0x10, 0xDE,
-    0xD7, 0xFF, 0xFF, 0xD9, 0x10, 0xEE, 0xFC, 0x0C, 0x34, 0x00, 0x85, 0xC7, 0x31, 0xCA, 0x23, 0x86,
-    0x07, 0x00, 0x3C, 0x25, 0x08, 0xEE, 0x78, 0x9C, 0x63, 0x28, 0x11, 0x65, 0xD8, 0xF0, 0xFF, 0x3D,
-    0xF3, 0xD7, 0xFF, 0xFF, 0x79, 0x7F, 0xFE, 0xFF, 0xCF, 0xFF, 0x03, 0x88, 0x3F, 0xFD, 0xFF, 0xCF,
-    0xE9, 0xF0, 0xA7, 0x8F, 0x01, 0x17, 0xF8, 0xFC, 0xFF, 0x3F, 0xC7, 0x40, 0x63, 0x00, 0xEE, 0x57,
-    0x73, 0x12, 0x78, 0x9C, 0xE5, 0xD0, 0xB1, 0x11, 0x40, 0x40, 0x10, 0x46, 0xE1, 0x35, 0x43, 0xC2,
-    0x0C, 0x9D, 0xA0, 0x03, 0xA1, 0x58, 0x05, 0x5A, 0xD1, 0x81, 0xEB, 0x40, 0x05, 0x66, 0x74, 0x72,
-    0x2A, 0x10, 0x0B, 0x04, 0x37, 0x72, 0x9E, 0x75, 0x34, 0x20, 0xB6, 0xC1, 0x7E, 0xC9, 0x1F, 0x3D,
-    0x11, 0x91, 0xA6, 0xD6, 0x27, 0xE5, 0x49, 0xA2, 0xCC, 0xD0, 0x2A, 0x0E, 0x86, 0x87, 0x5E, 0x31,
-    0x50, 0xDC, 0x9B, 0xD5, 0x86, 0xF2, 0xE5, 0x3A, 0xA8, 0x7E, 0xCE, 0x9B, 0x6E, 0x82, 0x4C, 0xD9,
-    0x21, 0xD5, 0xD4, 0x07, 0xC4, 0x6E, 0x39, 0x81, 0x48, 0x0B, 0x83, 0x15, 0x4F, 0xEE, 0xB1, 0x81,
-    0x98, 0x8D, 0x51, 0x4B, 0x5F, 0x65, 0x95, 0x9B, 0x0A, 0x78, 0x9C, 0xD5, 0xD1, 0xDD, 0x0D, 0x82,
-    0x40, 0x10, 0x04, 0xE0, 0x3B, 0x34, 0xFE, 0x04, 0x1F, 0x28, 0x40, 0x2D, 0xC1, 0xD8, 0x81, 0x5A,
-    0x81, 0x25, 0xD8, 0x82, 0x1D, 0x60, 0x07, 0xB6, 0x60, 0x09, 0x74, 0xA0, 0x2D, 0x58, 0x01, 0xD1,
-    0x06, 0x78, 0x20, 0xD1, 0x88, 0x3F, 0xE3, 0x1E, 0xC7, 0xCE, 0x49, 0x09, 0xDE, 0x03, 0xC9, 0x97,
-    0x05, 0x66, 0x58, 0x2A, 0xC0, 0x1A, 0x9E, 0xEA, 0xBF, 0x75, 0x05, 0x72, 0xAB, 0x4A, 0x3E, 0xC0,
-    0x84, 0xB3, 0x33, 0x50, 0x44, 0xAA, 0xE4, 0x0D, 0xCC, 0xF8, 0xDC, 0x09, 0x40, 0x87, 0x7A, 0x01,
-    0x0B, 0xBE, 0x33, 0x93, 0x51, 0x97, 0x92, 0xEB, 0x86, 0x79, 0x07, 0x19, 0xF5, 0xA8, 0x07, 0x90,
-    0xB2, 0xCB, 0x4E, 0x46, 0x7D, 0xEA, 0x06, 0xEC, 0xD9, 0x73, 0x25, 0xA3, 0x21, 0x55, 0x4A, 0xA9,
-    0xF0, 0x0D, 0x72, 0x0A, 0xFB, 0x2B, 0xC4, 0x2D, 0xA5, 0x2D, 0xB9, 0xCA, 0x8D, 0xC6, 0x4F, 0x60,
-    0xAA, 0xCA, 0xED, 0x05, 0x38, 0xAA, 0xA6, 0x66, 0xA9, 0x65, 0x44, 0x91, 0x31, 0x77, 0x60, 0x1D,
-    0x76, 0x96, 0x35, 0x91, 0x5E, 0x6E, 0x63, 0x71, 0xD8, 0x67, 0xE9, 0x8B, 0x37, 0xDA, 0xFA, 0x55,
-    0xE8, 0x3E, 0x7D, 0xA4, 0xCA, 0x47, 0xAA, 0xE6, 0x72, 0xEB, 0x20, 0xFC, 0x95, 0x3A, 0x92, 0xAA,
-    0x23, 0x29, 0x17, 0x39, 0x0A, 0x7F, 0xD3, 0x45, 0x7E, 0x01, 0xC1, 0x93, 0x02, 0xB6, 0x78, 0x9C,
-    0xFB, 0xFC, 0xFF, 0x3F, 0xC7, 0xE7, 0x21, 0x8A, 0x01, 0xD7, 0x7E, 0x8B, 0xB8, 0x78, 0x9C, 0x63,
-    0x60, 0x00, 0x81, 0xA0, 0xF2, 0x70, 0x66, 0x30, 0x83, 0xC1, 0xB1, 0x2C, 0x9D, 0x05, 0x44, 0xFF,
-    0xFE, 0xBF, 0x9F, 0x41, 0xE1, 0xE5, 0x7F, 0x20, 0xD0, 0x04, 0x71, 0xAF, 0x83, 0x58, 0x31, 0x60,
-    0xF1, 0xF3, 0x0C, 0xDF, 0xFF, 0x83, 0x01, 0x3B, 0x03, 0xC3, 0x53, 0x08, 0x4B, 0x17, 0x2C, 0x7E,
-    0x00, 0xC2, 0xF9, 0x3F, 0x9F, 0x61, 0x02, 0x94, 0xF5, 0x9F, 0x19, 0x28, 0xFE, 0xFE, 0x0F, 0x8C,
-    0xC7, 0xFE, 0x0B, 0xC6, 0x92, 0x03, 0x8A, 0x03, 0x41, 0x6F, 0x58, 0x19, 0x48, 0xB2, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xE1, 0xA9, 0x37, 0x40, 0x2C, 0xB0, 0xB8, 0x2D, 0xD0, 0x1E, 0x05, 0xB0, 0x82, 0xFD,
-    0x4C, 0x40, 0xE6, 0x13, 0x20, 0x03, 0x24, 0xBE, 0x1F, 0xEC, 0xC0, 0x0D, 0x20, 0x71, 0x2E, 0x10,
-    0x4B, 0x01, 0xC8, 0x60, 0x05, 0x8A, 0xF3, 0x82, 0xC5, 0x05, 0x80, 0xBC, 0xF3, 0x10, 0x3F, 0x00,
-    0xDD, 0xC7, 0x01, 0x14, 0x67, 0x81, 0xF0, 0x7E, 0xFE, 0xFF, 0xEF, 0x0F, 0x61, 0x7D, 0xFC, 0xFF,
-    0x9F, 0x07, 0x28, 0x0E, 0xE1, 0x30, 0x7C, 0xFB, 0xFF, 0x9F, 0x1F, 0xC2, 0x7A, 0x00, 0x34, 0x03,
-    0x21, 0xFE, 0x05, 0x2E, 0x0E, 0xF4, 0x10, 0x1F, 0x42, 0xFC, 0x33, 0x90, 0x07, 0x17, 0xE7, 0x47,
-    0x11, 0xE7, 0xC4, 0x21, 0xCE, 0x3E, 0x2A, 0x3E, 0xDC, 0xC4, 0x01, 0x9A, 0xF3, 0x5A, 0x32, 0x78,
-    0x9C, 0x63, 0x60, 0x00, 0x01, 0xC7, 0xB2, 0x74, 0x16, 0x10, 0xFD, 0xEB, 0xFF, 0x7E, 0x06, 0x86,
-    0xA3, 0xFF, 0x81, 0xC0, 0x1B, 0xCC, 0x3B, 0xCF, 0x70, 0xE8, 0x3F, 0x18, 0x70, 0x81, 0x78, 0xF7,
-    0x03, 0x20, 0x1C, 0xA0, 0x30, 0x88, 0xF7, 0x15, 0xCA, 0xFB, 0xCF, 0x09, 0xE4, 0x81, 0x44, 0xD3,
-    0x53, 0x5F, 0x02, 0x29, 0x7D, 0x30, 0x6F, 0x3F, 0x13, 0xD0, 0x80, 0x1F, 0xFF, 0xFF, 0xCF, 0x07,
-    0xF3, 0xD8, 0x41, 0x86, 0x37, 0xFC, 0xFF, 0xFF, 0x1E, 0xC4, 0xAB, 0x07, 0x5B, 0xC9, 0xF0, 0xEF,
-    0xFF, 0x7F, 0x26, 0x20, 0x8F, 0x07, 0xC2, 0x03, 0x2A, 0x65, 0x05, 0xF2, 0x98, 0x20, 0x3C, 0xA0,
-    0xD1, 0x6C, 0x40, 0x1E, 0x84, 0xC3, 0xF0, 0x19, 0x68, 0x00, 0x0A, 0x8F, 0x63, 0x94, 0x47, 0x0C,
-    0x0F, 0x00, 0x1F, 0x61, 0xDE, 0x9E, 0x78, 0x9C, 0x5D, 0x92, 0x3B, 0x4E, 0x03, 0x31, 0x14, 0x45,
-    0xDF, 0x44, 0x40, 0x18, 0x3E, 0x49, 0x0A, 0x7A, 0xA6, 0xA0, 0x26, 0x34, 0x69, 0x09, 0x62, 0x05,
-    0x48, 0xA4, 0x8E, 0xE8, 0x28, 0xE9, 0x68, 0x61, 0x03, 0x09, 0xB3, 0x03, 0x66, 0x09, 0x2C, 0x81,
-    0x25, 0xB0, 0x83, 0x14, 0x50, 0x84, 0x2A, 0x7C, 0x22, 0x42, 0x52, 0x70, 0xB9, 0xCF, 0xCF, 0xB6,
-    0x26, 0xBE, 0xD2, 0xC8, 0x3E, 0xB6, 0xDF, 0x7F, 0x44, 0x54, 0xE7, 0xB7, 0xD7, 0x07, 0x12, 0x55,
-    0x4C, 0x41, 0x8D, 0x32, 0x8F, 0x9D, 0x15, 0x9C, 0x1E, 0xFD, 0xC1, 0x1B, 0xBC, 0x4E, 0x1D, 0x5E,
-    0x20, 0x6A, 0x43, 0x79, 0xCE, 0xCD, 0xB8, 0x37, 0x78, 0xE7, 0xD2, 0x57, 0xEB, 0x3F, 0xE0, 0x46,
-    0xCF, 0x17, 0xC0, 0x84, 0x4B, 0x05, 0xCC, 0x1A, 0xCA, 0x27, 0x7C, 0x90, 0x8B, 0x7C, 0x03, 0x5D,
-    0xF3, 0x3B, 0x77, 0x3B, 0x06, 0x6B, 0x1A, 0x97, 0x0C, 0x29, 0x1D, 0xB3, 0x72, 0x79, 0xD0, 0x20,
-    0xBB, 0x02, 0xEE, 0x42, 0x9E, 0x4B, 0x60, 0xB3, 0x8A, 0xE6, 0xCE, 0x41, 0xFE, 0x02, 0xB4, 0x02,
-    0x7F, 0x00, 0x7B, 0xFC, 0x76, 0x03, 0xF3, 0xAE, 0xFD, 0xE9, 0x82, 0x9A, 0x9E, 0xC8, 0x5F, 0xC0,
-    0x76, 0x60, 0xFA, 0x3A, 0xAC, 0x73, 0x99, 0xB0, 0xDE, 0xA7, 0xF6, 0x75, 0xFF, 0xCF, 0xE4, 0x24,
-    0xFE, 0xBE, 0xDA, 0x04, 0x66, 0xA9, 0x79, 0x9A, 0x7F, 0xAD, 0x3E, 0x61, 0xA7, 0x32, 0xAD, 0x7F,
-    0xCB, 0xF0, 0x5E, 0xEB, 0x57, 0xA3, 0xE3, 0x68, 0xDE, 0x75, 0x49, 0x4C, 0xDC, 0x20, 0x0A, 0x3E,
-    0xDF, 0xB1, 0xFE, 0x0E, 0x95, 0x7F, 0xBC, 0x27, 0xED, 0xFF, 0xA8, 0x77, 0x39, 0xF5, 0xFD, 0x97,
-    0xB3, 0x64, 0x3E, 0xF2, 0xBA, 0x3E, 0x3F, 0x91, 0x5F, 0xC3, 0x87, 0x90, 0x87, 0xCD, 0x7F, 0xDC,
-    0x90, 0x28, 0xFE, 0x1F, 0x47, 0xB6, 0xFB, 0x07, 0x9C, 0xCA, 0xE1, 0x64, 0x78, 0x9C, 0xD5, 0xD1,
-    0xBB, 0x0D, 0xC2, 0x30, 0x10, 0x06, 0x60, 0xF3, 0x0A, 0xA1, 0x00, 0x51, 0x52, 0x21, 0x06, 0xA0,
-    0xA0, 0xA0, 0x67, 0x04, 0x0A, 0x24, 0xE8, 0x60, 0x00, 0x1A, 0x3A, 0x4A, 0xA8, 0xA8, 0x99, 0x80,
-    0x8C, 0x90, 0x11, 0x18, 0x21, 0x62, 0x82, 0x20, 0x31, 0x40, 0x84, 0x04, 0x42, 0xBC, 0xF4, 0x73,
-    0xE7, 0x3B, 0xC0, 0x89, 0xC4, 0x00, 0x5C, 0x91, 0xF8, 0x8B, 0x1D, 0x9F, 0x7D, 0x67, 0x0C, 0xC7,
-    0x60, 0x3E, 0xCA, 0xDB, 0xC1, 0x1D, 0x81, 0xE9, 0xDC, 0x00, 0x24, 0x0D, 0x61, 0x58, 0xBF, 0x82,
-    0x23, 0xF1, 0x2C, 0xB7, 0x3B, 0x48, 0x04, 0x96, 0xC9, 0x53, 0x89, 0x0A, 0x93, 0x62, 0x33, 0x5C,
-    0x3D, 0xE8, 0x35, 0x11, 0x8E, 0x69, 0x55, 0x8B, 0x9C, 0x58, 0x46, 0x39, 0xDE, 0x73, 0x4D, 0xDF,
-    0x7D, 0x66, 0xD3, 0x68, 0x4A, 0xD4, 0xF8, 0x51, 0x14, 0x1E, 0x81, 0x3E, 0x53, 0x64, 0x96, 0x9C,
-    0xEA, 0xCB, 0x16, 0x10, 0x3B, 0x34, 0x94, 0xDF, 0x25, 0x9D, 0xBC, 0xE0, 0xF0, 0x42, 0xBB, 0x3A,
-    0x3C, 0x03, 0x25, 0x87, 0x27, 0xC0, 0x4B, 0xB3, 0xFC, 0x7B, 0x36, 0xF3, 0x6F, 0x66, 0xE7, 0x4C,
-    0xDE, 0xF4, 0xA9, 0xE8, 0xCC, 0x91, 0xC3, 0x99, 0xDE, 0x48, 0x0A, 0x6E, 0xF6, 0x40, 0x8F, 0x59,
-    0x15, 0x5E, 0x79, 0x44, 0x0C, 0xDF, 0x6B, 0xE1, 0xD9, 0x4A, 0xB6, 0x75, 0x32, 0xD6, 0x3A, 0x4F,
-    0xBB, 0x03, 0x6E, 0x4C, 0x4F, 0xA9, 0xE1, 0x59, 0x1E, 0x54, 0x0B, 0xA9, 0x6E, 0xFD, 0x26, 0x1D,
-    0x2C, 0x0A, 0xB5, 0xBF, 0xBE, 0xD6, 0x3E, 0xDD, 0xFD, 0xCF, 0x15, 0xFE, 0x86, 0x2F, 0x19, 0x84,
-    0x20, 0x55, 0x78, 0x9C, 0xD5, 0xD1, 0x3F, 0x0E, 0x01, 0x41, 0x14, 0x06, 0xF0, 0x51, 0x50, 0xD8,
-    0x08, 0x27, 0x90, 0x6D, 0x94, 0x62, 0x8B, 0x6D, 0x85, 0x23, 0x48, 0xF4, 0xA2, 0x90, 0x90, 0x68,
-    0x54, 0x2A, 0xC2, 0x0D, 0xB8, 0x82, 0xB8, 0xC0, 0x96, 0x4A, 0x4E, 0xB0, 0x6E, 0x40, 0x74, 0x3A,
-    0x1A, 0xFF, 0xD7, 0xE7, 0xCD, 0xCC, 0xDB, 0xDD, 0xD9, 0x88, 0x03, 0x78, 0xC5, 0xEE, 0xFE, 0x8A,
-    0x7D, 0xF3, 0xCD, 0x7B, 0x42, 0x50, 0x39, 0xC3, 0x6E, 0x49, 0x44, 0xB5, 0x04, 0xD5, 0x58, 0xD4,
-    0x81, 0x3C, 0x69, 0x01, 0x55, 0xAD, 0x86, 0xA2, 0xFD, 0xD6, 0x44, 0x4F, 0xF1, 0x80, 0xB8, 0x88,
-    0x2F, 0x7A, 0x8D, 0xDC, 0xCE, 0x43, 0x73, 0x40, 0xCF, 0x2A, 0x75, 0x28, 0xDC, 0x15, 0xCF, 0x80,
-    0x9F, 0x92, 0xFD, 0x1B, 0x8A, 0x57, 0xA0, 0xA8, 0xCF, 0xBB, 0x48, 0x06, 0x40, 0x46, 0xF3, 0x44,
-    0x74, 0x80, 0x1D, 0xA7, 0xD9, 0x13, 0xDB, 0xC0, 0x8C, 0xE9, 0x11, 0xE7, 0x40, 0xCD, 0xE0, 0x56,
-    0x07, 0x0D, 0x49, 0x3F, 0xE4, 0x0C, 0x52, 0x3B, 0x2B, 0xC9, 0xAC, 0xC1, 0x73, 0x92, 0xA7, 0x2F,
-    0x5A, 0xBF, 0x3B, 0xAF, 0x93, 0xE7, 0x52, 0xAA, 0x8A, 0x41, 0xCA, 0x3C, 0x31, 0x68, 0xC7, 0x37,
-    0x92, 0x17, 0x94, 0xA3, 0x4A, 0x1B, 0xBC, 0x44, 0xD3, 0xB8, 0x49, 0xD2, 0x49, 0xBE, 0x52, 0x5B,
-    0xCD, 0x4A, 0x4E, 0xAC, 0x2C, 0xA9, 0x27, 0x29, 0x9E, 0xF4, 0xEA, 0xBB, 0xCD, 0x23, 0x8F, 0x7D,
-    0x93, 0xDC, 0x42, 0x21, 0xE0, 0xEF, 0x95, 0x0E, 0x38, 0xE5, 0x0D, 0x7A, 0x9C, 0x97, 0xF7, 0x1B,
-    0x92, 0xB7, 0xEF, 0xC5, 0xB7, 0x09, 0x33, 0xFF, 0x05, 0x3F, 0x5A, 0x3D, 0x14, 0x01, 0x78, 0x9C,
-    0x63, 0x60, 0x00, 0x02, 0x83, 0xB2, 0x70, 0x86, 0x5F, 0xFF, 0xDF, 0x33, 0x14, 0xFC, 0xFB, 0xFF,
-    0x9F, 0x0D, 0xC8, 0x10, 0xF8, 0xFD, 0x1F, 0xCC, 0xF8, 0x7F, 0xE1, 0x3F, 0x94, 0xF1, 0x0B, 0xC6,
-    0xF8, 0x0F, 0x67, 0xBC, 0xB7, 0x60, 0x14, 0x60, 0x04, 0x31, 0x38, 0x41, 0x46, 0x00, 0x19, 0xF5,
-    0x0C, 0x50, 0x06, 0x37, 0x8C, 0xC1, 0x0C, 0x63, 0x30, 0x0C, 0x23, 0x06, 0x00, 0x88, 0xB7, 0x7C,
-    0xF2, 0x78, 0x9C, 0x45, 0x90, 0xBD, 0x4A, 0x43, 0x41, 0x10, 0x85, 0x27, 0x98, 0x04, 0xC4, 0x10,
-    0x6F, 0x27, 0x88, 0x60, 0x1B, 0xAC, 0x2E, 0x08, 0xB6, 0x2A, 0x62, 0xDA, 0xF8, 0x06, 0x46, 0xC1,
-    0xB4, 0x5A, 0x99, 0x26, 0xA0, 0x16, 0x76, 0x16, 0x79, 0x02, 0xCD, 0xD3, 0x68, 0xA9, 0xA5, 0xD8,
-    0x04, 0x51, 0x0B, 0x9B, 0xC4, 0x44, 0x44, 0x83, 0xC9, 0x1E, 0xE7, 0x67, 0x67, 0x3D, 0xCD, 0xEE,
-    0x07, 0x33, 0x67, 0x66, 0x0E, 0x11, 0x2B, 0x3F, 0x6A, 0x6F, 0x90, 0xEB, 0x16, 0xAC, 0xFB, 0xB2,
-    0xC1, 0x1B, 0x54, 0xC3, 0x92, 0x40, 0x0F, 0x51, 0x37, 0x42, 0xBF, 0x4E, 0x98, 0x27, 0x3A, 0xE1,
-    0xE7, 0x7A, 0x77, 0xE7, 0x8E, 0x9F, 0x63, 0xA2, 0x51, 0x2C, 0x79, 0xE5, 0xCE, 0x02, 0x7D, 0x6B,
-    0x05, 0x51, 0x16, 0x80, 0xB2, 0xB4, 0x15, 0xD4, 0xFA, 0x0B, 0xA8, 0xD0, 0x0C, 0x7D, 0x1B, 0xF4,
-    0x00, 0x2C, 0x52, 0x70, 0xEA, 0x0D, 0x06, 0x55, 0x9A, 0x7A, 0xA5, 0xEA, 0x07, 0x58, 0xF9, 0xA7,
-    0x31, 0x3B, 0x2F, 0x25, 0x92, 0xE9, 0xE8, 0xCC, 0x39, 0x4E, 0x74, 0xAB, 0xAB, 0xC8, 0xCD, 0x60,
-    0x27, 0xD4, 0x0C, 0x2F, 0x0C, 0xB1, 0x66, 0xB8, 0xF5, 0x6E, 0x58, 0x8A, 0xBD, 0x87, 0x4F, 0xB0,
-    0x1B, 0xA2, 0x0E, 0x66, 0x8C, 0xC9, 0x99, 0xF6, 0x82, 0x6C, 0x9D, 0xF4, 0x09, 0xAC, 0x36, 0x5B,
-    0xAD, 0xA2, 0x51, 0x17, 0x68, 0x7C, 0x00, 0x0B, 0xB1, 0x94, 0x6D, 0xF4, 0x2A, 0xA7, 0xFD, 0x6E,
-    0x32, 0x3E, 0x07, 0x36, 0x73, 0x36, 0x2E, 0xFA, 0x31, 0x55, 0xC9, 0xE5, 0x4C, 0x17, 0x0A, 0x12,
-    0xD7, 0xB3, 0xE4, 0x59, 0x5F, 0xBF, 0x9C, 0x6A, 0x82, 0x79, 0x8A, 0x1A, 0x0D, 0x2E, 0x79, 0x71,
-    0x18, 0xCA, 0x62, 0xD9, 0x24, 0xD2, 0xB2, 0x9A, 0x65, 0x8F, 0xF2, 0xEF, 0xD7, 0x7C, 0xC5, 0xED,
-    0xD3, 0x76, 0x5D, 0x63, 0xFC, 0x03, 0x2A, 0xBA, 0xD4, 0x5A, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8,
-    0xF5, 0xFF, 0x3F, 0x23, 0x03, 0x18, 0x50, 0x81, 0xF5, 0xFB, 0x3F, 0x14, 0xB0, 0xE0, 0x67, 0x85,
-    0x84, 0x86, 0x02, 0xA9, 0xB0, 0xD0, 0x50, 0x46, 0xEA, 0xD8, 0x3B, 0x80, 0xAC, 0x9F, 0xC8, 0x2C,
-    0x26, 0x08, 0xEB, 0xC7, 0xFF, 0xFF, 0xAC, 0x10, 0xD6, 0xB7, 0xFF, 0xFF, 0x79, 0x20, 0xAC, 0x4F,
-    0xFF, 0xFF, 0xDF, 0xCF, 0x98, 0xCE, 0x02, 0x64, 0x1D, 0x00, 0x87, 0x01, 0x1B, 0x90, 0xE5, 0x00,
-    0x67, 0x31, 0x7C, 0x87, 0xB3, 0x1C, 0xFE, 0xC0, 0x58, 0x0C, 0x0A, 0xA5, 0xE9, 0xA2, 0x0C, 0x00,
-    0x9A, 0x49, 0x9F, 0x25, 0x78, 0x9C, 0xFB, 0xF3, 0xFF, 0x3D, 0x03, 0x04, 0x7C, 0xF9, 0xFF, 0x9F,
-    0xED, 0xCF, 0x28, 0x8F, 0x08, 0xDE, 0xEF, 0xFF, 0xFF, 0x91, 0x78, 0xBF, 0xFE, 0xFF, 0x67, 0x84,
-    0xF0, 0xBE, 0x03, 0x79, 0x3F, 0xFE, 0xFF, 0x67, 0x85, 0xF0, 0xFE, 0x03, 0x79, 0x40, 0x79, 0x6E,
-    0x30, 0x27, 0x00, 0xC4, 0xFB, 0xF8, 0xFF, 0xBF, 0x3F, 0x4C, 0xDB, 0x7F, 0xB6, 0x0D, 0xFF, 0xFF,
-    0xBF, 0x67, 0x01, 0x72, 0x26, 0xFE, 0x07, 0xF1, 0x1C, 0x80, 0xC4, 0xF9, 0xF0, 0xD4, 0x13, 0xFF,
-    0xC1, 0x3C, 0x86, 0x5F, 0xFF, 0x11, 0x80, 0x8D, 0xE1, 0x02, 0x94, 0x75, 0xFF, 0x13, 0x88, 0x07,
-    0x93, 0xE4, 0xF8, 0x08, 0xE6, 0x39, 0x00, 0x9D, 0xF3, 0xFF, 0xBD, 0x26, 0xC3, 0x07, 0x30, 0x8F,
-    0x81, 0x21, 0xA5, 0x3C, 0x9C, 0x09, 0xE2, 0x02, 0x00, 0x02, 0x2F, 0xDE, 0x96, 0x78, 0x9C, 0x4D,
-    0x90, 0xDB, 0x0D, 0x82, 0x40, 0x10, 0x45, 0xD7, 0x10, 0x49, 0x8C, 0x44, 0xED, 0x00, 0x3A, 0xD0,
-    0x12, 0xE8, 0x00, 0x3A, 0xB0, 0x04, 0xE8, 0x40, 0x4B, 0xB0, 0x04, 0x3B, 0xC0, 0x0E, 0xB0, 0x04,
-    0x3B, 0xC0, 0x16, 0x90, 0xC4, 0x47, 0x82, 0x5C, 0xE7, 0xC5, 0xE2, 0x7C, 0x70, 0xF7, 0x26, 0x9B,
-    0xB3, 0x67, 0xE8, 0x01, 0x67, 0xF3, 0x01, 0x82, 0x17, 0x30, 0xB7, 0x3A, 0xA0, 0x71, 0x2D, 0xB0,
-    0xD4, 0x96, 0x02, 0x07, 0x77, 0x01, 0xD6, 0x5A, 0x4F, 0x40, 0xEC, 0x72, 0x60, 0xAF, 0xF5, 0x2E,
-    0xF7, 0x80, 0x5A, 0x6B, 0x07, 0x84, 0xC2, 0xD3, 0xFA, 0x96, 0x43, 0x37, 0xA2, 0x07, 0x54, 0xF4,
-    0xBD, 0x19, 0x7A, 0x07, 0x64, 0x14, 0x47, 0x43, 0x53, 0xAE, 0x28, 0x12, 0x43, 0xD3, 0xAD, 0x05,
-    0x67, 0xAF, 0x68, 0x62, 0x04, 0x9C, 0x4F, 0x60, 0x26, 0xE0, 0x46, 0x88, 0xAD, 0xBC, 0xE7, 0xBE,
-    0xA4, 0xC8, 0x73, 0x16, 0x74, 0xC2, 0x8A, 0x3C, 0xB9, 0x1C, 0x08, 0x1C, 0x8D, 0x8B, 0x15, 0x02,
-    0x0E, 0xC7, 0xB5, 0x09, 0xFD, 0xF0, 0xBF, 0xA1, 0x63, 0xF4, 0x4B, 0x14, 0x4D, 0x20, 0xA4, 0xD7,
-    0x33, 0xAB, 0x25, 0xA1, 0x13, 0x55, 0x74, 0xAA, 0x19, 0x97, 0xA6, 0xA8, 0x9A, 0xC5, 0xD5, 0x14,
-    0x55, 0xB3, 0x6E, 0x4D, 0xD1, 0x34, 0xDF, 0xA6, 0x68, 0x9A, 0xC0, 0xD6, 0xD7, 0x94, 0x6B, 0xE4,
-    0x2B, 0x69, 0x7A, 0x45, 0xD5, 0xD4, 0x9D, 0x27, 0xCD, 0x6A, 0x6A, 0xAC, 0x99, 0xFD, 0xD5, 0x72,
-    0x52, 0xE4, 0xD9, 0x78, 0xC5, 0x1F, 0x13, 0x2A, 0xA3, 0xB1, 0x78, 0x9C, 0x45, 0x52, 0xDB, 0x41,
-    0x02, 0x41, 0x0C, 0x5C, 0xF1, 0x2D, 0x88, 0x76, 0xC0, 0x75, 0x80, 0x1D, 0x40, 0x07, 0xD2, 0x81,
-    0x76, 0x00, 0x1D, 0x70, 0x1D, 0x60, 0x07, 0xD8, 0x01, 0x74, 0x70, 0x7C, 0xF8, 0x8F, 0x1D, 0x40,
-    0x07, 0xBC, 0x05, 0x79, 0x8D, 0x93, 0xC9, 0xDE, 0xB9, 0x1F, 0x47, 0x12, 0x36, 0x99, 0xC9, 0xCC,
-    0xEE, 0x80, 0x52, 0xD0, 0x39, 0xA3, 0xE6, 0xC1, 0x14, 0x28, 0xAF, 0x80, 0x1B, 0x25, 0x09, 0xD0,
-    0xF6, 0xF2, 0x92, 0x25, 0xFE, 0xF5, 0xA0, 0xA4, 0x03, 0x64, 0x5E, 0xDE, 0x72, 0xC0, 0x27, 0x50,
-    0x55, 0x32, 0x02, 0xE0, 0xE5, 0x03, 0x26, 0xA1, 0x05, 0x34, 0x94, 0x2C, 0x58, 0xBE, 0x8E, 0x20,
-    0xBD, 0xF0, 0x0C, 0x74, 0x95, 0xFC, 0x20, 0x8E, 0x7B, 0xD1, 0xC5, 0x63, 0x1C, 0x79, 0x40, 0x1C,
-    0x47, 0x90, 0x27, 0x01, 0x58, 0xC2, 0x2E, 0xE0, 0xD5, 0xA2, 0xA1, 0xBA, 0x48, 0xE7, 0x8A, 0x09,
-    0x31, 0xF6, 0xE8, 0x5B, 0x79, 0x2E, 0x0C, 0x32, 0xBC, 0x63, 0x42, 0x46, 0x0B, 0xCC, 0xAC, 0xCC,
-    0x4D, 0x2E, 0x42, 0xF8, 0x00, 0x2A, 0xBA, 0x93, 0xB1, 0xFB, 0x52, 0xB4, 0xC7, 0xFC, 0x36, 0xA1,
-    0xA5, 0xD7, 0x68, 0xB7, 0xBC, 0xEF, 0xE0, 0xD4, 0x80, 0x37, 0x7E, 0xF7, 0xA8, 0x11, 0xF5, 0x51,
-    0x79, 0xC3, 0x99, 0xF5, 0xB5, 0x43, 0x85, 0x51, 0x5D, 0xB4, 0xAB, 0xBE, 0xC7, 0x44, 0xA3, 0x6E,
-    0x19, 0xB1, 0x3D, 0x05, 0xEE, 0xA3, 0x60, 0x25, 0x03, 0x2E, 0x71, 0xFF, 0xB1, 0xB4, 0x91, 0x06,
-    0xDF, 0x26, 0xED, 0xD4, 0x5A, 0x86, 0x46, 0x6D, 0x1E, 0x15, 0x4B, 0x6D, 0xAB, 0x15, 0xE5, 0x09,
-    0xEF, 0x76, 0x61, 0x1D, 0xC5, 0x68, 0x1A, 0xC6, 0xCE, 0xE0, 0x49, 0xA5, 0xCC, 0xC8, 0xA5, 0x23,
-    0xA3, 0x7A, 0x38, 0x09, 0xFE, 0x48, 0x91, 0x8E, 0x46, 0x27, 0x88, 0x72, 0x37, 0x71, 0xF8, 0x2D,
-    0x57, 0x70, 0xF2, 0x62, 0x98, 0x75, 0x7C, 0xEF, 0x25, 0x06, 0xCD, 0xC8, 0x4F, 0xBE, 0x8C, 0x5C,
-    0x25, 0xFE, 0xA4, 0x2E, 0xA8, 0xBB, 0xB8, 0x71, 0x4D, 0xD9, 0xF4, 0x95, 0x3B, 0x6A, 0x0C, 0xCF,
-    0xEE, 0x40, 0x62, 0xA2, 0x47, 0xFF, 0x4D, 0x05, 0xF9, 0xC4, 0x73, 0x42, 0xF1, 0x5A, 0x4C, 0xA6,
-    0xFC, 0xB1, 0xEC, 0x80, 0xFC, 0x6D, 0x19, 0xC3, 0xFC, 0x2D, 0xD0, 0x19, 0x99, 0xA2, 0xB3, 0x81,
-    0x7C, 0x72, 0x7D, 0x64, 0x45, 0x88, 0xA6, 0x66, 0x05, 0xBA, 0x16, 0x08, 0xF1, 0x09, 0xB4, 0x0B,
-    0xF4, 0x59, 0x5E, 0x35, 0xBA, 0x39, 0xCE, 0x19, 0x83, 0xA2, 0x9C, 0xFC, 0xE3, 0xFC, 0xCA, 0xD8,
-    0x10, 0xFE, 0x00, 0x01, 0xCA, 0x29, 0xD8, 0x78, 0x9C, 0x4D, 0xD0, 0xFF, 0x0D, 0xC1, 0x50, 0x10,
-    0x07, 0xF0, 0x0B, 0x69, 0x34, 0x41, 0xD3, 0x0D, 0xD8, 0x80, 0x0D, 0xD8, 0x80, 0x11, 0x6C, 0xC0,
-    0x06, 0x6C, 0xC0, 0x06, 0x3A, 0x82, 0x0D, 0xD8, 0xA0, 0x62, 0x01, 0xE9, 0x08, 0x44, 0xC5, 0xCF,
-    0x7E, 0xDD, 0xDD, 0xBB, 0xBE, 0xE7, 0xFE, 0xE8, 0x7B, 0x97, 0x7C, 0x7A, 0xF9, 0xDE, 0x2B, 0x80,
-    0x25, 0x69, 0x2D, 0x00, 0x34, 0x67, 0xFC, 0x69, 0x68, 0x7B, 0x01, 0xD6, 0x44, 0x6F, 0xA0, 0xAD,
-    0xED, 0x0B, 0xE8, 0x12, 0x15, 0xC0, 0x44, 0xBA, 0xB1, 0x58, 0x22, 0xD6, 0x67, 0x69, 0x8F, 0x6A,
-    0x55, 0xC7, 0x7C, 0x3C, 0xD4, 0xAA, 0x1E, 0x10, 0xF5, 0x9D, 0x55, 0xBD, 0x27, 0x3A, 0x98, 0x55,
-    0x1D, 0x51, 0x69, 0x56, 0x75, 0x92, 0x56, 0x66, 0x89, 0xA6, 0xEC, 0x36, 0xDE, 0xAA, 0xBE, 0x7B,
-    0xAB, 0x1A, 0xDE, 0xAA, 0xF6, 0x8B, 0x98, 0x46, 0x27, 0xB4, 0x85, 0x5F, 0x4B, 0x6B, 0x67, 0xB9,
-    0xAD, 0x38, 0x03, 0x5A, 0xBE, 0x93, 0x0C, 0x92, 0xDB, 0x2A, 0x93, 0xC9, 0xF9, 0xBF, 0xAD, 0x82,
-    0x16, 0x7B, 0x0A, 0x9A, 0xED, 0x7C, 0x18, 0x74, 0x29, 0x19, 0x9E, 0xB5, 0x76, 0xBB, 0x15, 0xB5,
-    0x66, 0xBB, 0xD5, 0x37, 0xC9, 0x6B, 0x9B, 0xF0, 0xF1, 0x71, 0x2F, 0x28, 0x36, 0xE2, 0xF3, 0x0A,
-    0x8C, 0x5C, 0xDE, 0xBD, 0xA0, 0x95, 0xCB, 0xCD, 0xB6, 0xA7, 0x3F, 0x7D, 0x45, 0xA7, 0x3E, 0xCF,
-    0x4D, 0x74, 0xD8, 0x2D, 0x93, 0x5B, 0xE9, 0x26, 0xD8, 0xCC, 0xF8, 0x07, 0x9A, 0x5A, 0xC0, 0x45,
-    0x78, 0x9C, 0x55, 0x91, 0xCD, 0x4D, 0xC3, 0x40, 0x10, 0x85, 0x17, 0x07, 0x41, 0x04, 0x18, 0xD2,
-    0x01, 0x1C, 0x91, 0x90, 0x20, 0x1D, 0x84, 0x2B, 0x37, 0x3A, 0x20, 0x1D, 0x84, 0x06, 0x50, 0x38,
-    0x70, 0x27, 0x1D, 0x84, 0x0E, 0x40, 0xA2, 0x00, 0xD2, 0x41, 0x10, 0x0D, 0x98, 0x0E, 0x12, 0xFE,
-    0x12, 0x7E, 0xE4, 0x7C, 0xEC, 0xCC, 0x78, 0x77, 0xED, 0x77, 0x59, 0x7D, 0x6B, 0xED, 0x9B, 0xF7,
-    0xC6, 0xEF, 0xB0, 0xEF, 0x4C, 0x1F, 0x90, 0x4F, 0x60, 0x50, 0xE1, 0x37, 0xB4, 0xFB, 0xF0, 0x54,
-    0x61, 0x09, 0x59, 0x07, 0x58, 0x53, 0x3A, 0x80, 0xA9, 0x73, 0xBF, 0xB0, 0xA1, 0x78, 0x09, 0x43,
-    0xE7, 0xBE, 0x60, 0x47, 0x71, 0xA2, 0xA6, 0xAF, 0xC1, 0xFA, 0x4D, 0xEF, 0x47, 0xC1, 0x7A, 0xA1,
-    0xAF, 0xBA, 0xEA, 0xE0, 0xF5, 0x67, 0x9E, 0xA5, 0x1D, 0x9D, 0x6A, 0xE2, 0x12, 0x36, 0xFD, 0x71,
-    0x0E, 0x17, 0xC9, 0xC2, 0xDD, 0xC1, 0x9E, 0xE0, 0x03, 0x9C, 0xF8, 0x63, 0x0E, 0x5B, 0x82, 0x7D,
-    0x1D, 0x2F, 0xF3, 0xD7, 0xD5, 0x12, 0x0A, 0x27, 0xE9, 0x66, 0x16, 0xDD, 0xC7, 0xCC, 0x9C, 0x5B,
-    0x31, 0x36, 0xFC, 0x14, 0xEB, 0x53, 0xE8, 0x19, 0xFA, 0x98, 0xB9, 0x84, 0xCB, 0x0D, 0xAF, 0xC5,
-    0xDA, 0xDF, 0xB5, 0x5D, 0x28, 0x7A, 0x2B, 0x9B, 0xC9, 0xE2, 0x1A, 0x0A, 0xBF, 0x99, 0x69, 0x45,
-    0x12, 0xB3, 0x55, 0xEA, 0xF0, 0xD0, 0xF4, 0x30, 0x2D, 0x54, 0x62, 0x5E, 0xC1, 0x76, 0x40, 0x5F,
-    0x86, 0xB0, 0x31, 0x8B, 0x19, 0xF7, 0x29, 0xFA, 0xF1, 0x74, 0x1F, 0x49, 0x86, 0x5A, 0x77, 0xD3,
-    0x33, 0x55, 0xF7, 0x18, 0xD3, 0xBA, 0xC7, 0x98, 0x55, 0x77, 0xD3, 0x2A, 0x74, 0x0F, 0x38, 0x6E,
-    0x62, 0xAF, 0x46, 0xDD, 0xD8, 0x5D, 0x35, 0x8A, 0xDD, 0x55, 0xF3, 0xD4, 0x5D, 0xB4, 0x4C, 0xDD,
-    0x9D, 0xFE, 0xAD, 0x41, 0x0D, 0x5F, 0x60, 0x37, 0x7D, 0xBB, 0xA9, 0x97, 0x5D, 0x48, 0xD7, 0xF4,
-    0x54, 0xF1, 0xB8, 0x81, 0xB3, 0x56, 0x03, 0x8F, 0x92, 0xED, 0x63, 0x59, 0x9C, 0x25, 0xFA, 0x07,
-    0x1E, 0x19, 0xD9, 0x81, 0x78, 0x9C, 0x8D, 0xD0, 0xCB, 0x0D, 0x01, 0x61, 0x14, 0xC5, 0x71, 0x6F,
-    0x82, 0x85, 0xB5, 0x85, 0xE8, 0x60, 0x74, 0x40, 0x07, 0x74, 0x40, 0x07, 0x74, 0x42, 0x07, 0xAC,
-    0xAD, 0x66, 0x3F, 0x0B, 0x25, 0xD0, 0x81, 0xA8, 0xC0, 0xC4, 0x23, 0x1E, 0x83, 0xBF, 0x2B, 0xE1,
-    0x7C, 0x9F, 0xDD, 0xDC, 0xDD, 0x2F, 0xF7, 0xE4, 0xDC, 0xE4, 0xC6, 0x78, 0x93, 0x8F, 0x53, 0x2B,
-    0x8C, 0xBE, 0x93, 0xC0, 0x36, 0xA3, 0xB9, 0x41, 0x20, 0x0C, 0x2C, 0x58, 0x94, 0x0E, 0x30, 0x77,
-    0xC1, 0x07, 0xD4, 0x85, 0x99, 0x05, 0x73, 0xD2, 0x19, 0x86, 0x42, 0xDB, 0x56, 0x15, 0x69, 0x03,
-    0x6B, 0xD7, 0x71, 0x87, 0x96, 0x30, 0xB2, 0x60, 0x41, 0x3A, 0xC2, 0xD4, 0x05, 0x9F, 0x50, 0x13,
-    0x16, 0xB0, 0xCF, 0x4A, 0x17, 0xE8, 0x0B, 0x1D, 0xEB, 0x28, 0x4B, 0x3B, 0x58, 0xB9, 0x8E, 0xC4,
-    0x3F, 0x36, 0xF9, 0xBC, 0xC0, 0x3F, 0x36, 0x16, 0x1A, 0x2F, 0xA8, 0x4A, 0xE1, 0xDF, 0x77, 0xAE,
-    0xD0, 0x15, 0x7A, 0xD6, 0x51, 0xF2, 0x8F, 0xB1, 0xFC, 0x4D, 0xF3, 0xE4, 0xFF, 0x3A, 0x48, 0xAF,
-    0x37, 0x85, 0x4C, 0xC8, 0x9E, 0x78, 0x9C, 0xAD, 0x92, 0xCB, 0x0D, 0x41, 0x41, 0x14, 0x86, 0xC7,
-    0x23, 0xE2, 0x11, 0x8F, 0x06, 0x84, 0x0E, 0x94, 0xE0, 0x56, 0x80, 0x0A, 0x10, 0x0D, 0xD0, 0x01,
-    0x1D, 0xD0, 0x01, 0x1D, 0xB0, 0x51, 0x09, 0x1B, 0xAB, 0x6B, 0x67, 0x89, 0x78, 0x24, 0x12, 0xD7,
-    0xE7, 0xCE, 0x9C, 0x99, 0x21, 0xD6, 0x66, 0xF5, 0x25, 0x67, 0xE6, 0xCC, 0x7F, 0xFE, 0xFF, 0x28,
-    0x25, 0x67, 0x9D, 0xB3, 0x70, 0xA0, 0x24, 0xB0, 0x81, 0xB6, 0x81, 0x0E, 0xD0, 0x35, 0x74, 0x83,
-    0xB1, 0x81, 0x3A, 0x1C, 0x53, 0x86, 0x56, 0xD0, 0x94, 0xFB, 0x17, 0xC8, 0x0B, 0x3D, 0x40, 0x8A,
-    0x2A, 0x22, 0x54, 0xEE, 0xC1, 0x5C, 0x28, 0x80, 0xA1, 0x50, 0xDF, 0x7D, 0xA0, 0x46, 0xBE, 0xC9,
-    0xE4, 0x2F, 0x34, 0x83, 0x86, 0x72, 0xF2, 0xCA, 0x42, 0x27, 0x28, 0x0A, 0xDD, 0x21, 0x6B, 0xA0,
-    0xF2, 0x82, 0xA4, 0xA1, 0xAD, 0x95, 0x37, 0xD9, 0xC5, 0xB3, 0x56, 0xED, 0x75, 0xC2, 0x84, 0xA6,
-    0x73, 0x4C, 0x62, 0x8E, 0xA6, 0x96, 0x6B, 0x06, 0x19, 0x83, 0x83, 0xE8, 0xFB, 0x5B, 0x3B, 0xAE,
-    0x7A, 0x42, 0xFA, 0xD7, 0x96, 0x3D, 0xCE, 0xDA, 0x05, 0xD4, 0x7E, 0x95, 0xFE, 0x67, 0xF2, 0x91,
-    0xF7, 0x34, 0x4E, 0xAD, 0x27, 0x14, 0xB8, 0xD4, 0x54, 0x05, 0x96, 0x56, 0xA0, 0x4F, 0x46, 0xA7,
-    0xF5, 0x91, 0x5A, 0xF0, 0xB6, 0xD9, 0x90, 0xB4, 0x47, 0xB6, 0x7C, 0x85, 0xA9, 0xEF, 0xED, 0xEA,
-    0x7E, 0x4B, 0xBE, 0x36, 0x47, 0x6F, 0xD3, 0x1B, 0x1F, 0xD2, 0xB1, 0x86, 0x78, 0x9C, 0xFB, 0xF9,
-    0x9F, 0xFF, 0xE7, 0x20, 0x46, 0x00, 0xC6, 0xF0, 0x6B, 0x74, 0x78, 0x9C, 0xAD, 0xD2, 0xCD, 0x4D,
-    0x42, 0x51, 0x10, 0x86, 0x61, 0xAE, 0x01, 0x82, 0xFC, 0xDE, 0x0A, 0x70, 0x09, 0x4B, 0x3B, 0xC0,
-    0x0E, 0xA4, 0x03, 0xEC, 0x00, 0x0A, 0x30, 0xD1, 0x0E, 0xA0, 0x03, 0xAC, 0x40, 0x28, 0x81, 0x12,
-    0x88, 0x16, 0xA0, 0x26, 0xBA, 0x56, 0x48, 0x20, 0x42, 0x90, 0x97, 0x03, 0xDF, 0x9C, 0x21, 0xAC,
-    0xE5, 0xAE, 0x9E, 0x9C, 0x9C, 0x99, 0x3B, 0x3F, 0xA7, 0x7D, 0x9F, 0x64, 0xF4, 0x8D, 0x19, 0x1A,
-    0x67, 0xD0, 0x95, 0x5E, 0x80, 0x4B, 0xF1, 0x13, 0x86, 0x52, 0xBA, 0x81, 0xBC, 0xF8, 0x01, 0x75,
-    0xE9, 0x0E, 0xFA, 0x96, 0x68, 0xCB, 0x9B, 0x69, 0x05, 0x17, 0xD2, 0xC2, 0x43, 0xE6, 0x50, 0x90,
-    0x7E, 0xA0, 0xE8, 0x2A, 0xB9, 0xCA, 0xFF, 0xD7, 0x3B, 0x54, 0xA4, 0x09, 0xD4, 0xA4, 0x01, 0xB4,
-    0xA4, 0x1B, 0x18, 0x59, 0x81, 0x7F, 0x90, 0xF5, 0x02, 0xAD, 0xE7, 0xC7, 0xD0, 0xF3, 0x73, 0xF3,
-    0xC0, 0x5F, 0xE2, 0xE9, 0xF5, 0x36, 0xB6, 0x1F, 0xF2, 0x48, 0x69, 0x08, 0xE6, 0x76, 0xAF, 0x29,
-    0x7C, 0x37, 0x12, 0x0B, 0x50, 0x23, 0x69, 0x38, 0x4A, 0xE2, 0x60, 0x1E, 0x94, 0xF8, 0x09, 0xAE,
-    0xA4, 0x10, 0x50, 0xF5, 0x4A, 0xCF, 0xD0, 0xEF, 0x89, 0x6C, 0x92, 0x33, 0xDF, 0xDC, 0x71, 0xE2,
-    0x4B, 0xC8, 0x49, 0x6B, 0xB0, 0x65, 0x13, 0xB7, 0xD5, 0xF3, 0x42, 0xE7, 0xB1, 0xBC, 0x7D, 0x8B,
-    0x0A, 0xF8, 0x8A, 0xEB, 0x7D, 0x25, 0x66, 0x0B, 0x3F, 0xE8, 0xE8, 0xFE, 0xF1, 0xE5, 0xB4, 0xFD,
-    0x35, 0xED, 0x00, 0x15, 0x78, 0xB6, 0xB6, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x58, 0xFA, 0xF7, 0x7D,
-    0x36, 0x23, 0x03, 0x12, 0xB8, 0xF2, 0x1F, 0x08, 0xEA, 0xA1, 0x9C, 0x7F, 0xFF, 0x79, 0x19, 0x0A,
-    0xFE, 0x83, 0x81, 0x2D, 0x44, 0xE4, 0xFF, 0x7F, 0x6E, 0x86, 0x6F, 0x10, 0x91, 0xFF, 0x6C, 0x20,
-    0x01, 0x87, 0xFF, 0xFF, 0x39, 0x15, 0xA0, 0x02, 0xFF, 0xE7, 0x83, 0x44, 0x36, 0xFC, 0xFF, 0xCF,
-    0x0A, 0xC4, 0xEB, 0x85, 0x1D, 0x7F, 0x01, 0x85, 0x74, 0x80, 0x22, 0xDF, 0xFF, 0xFF, 0x67, 0xF8,
-    0xF4, 0xFF, 0x3F, 0x3B, 0x03, 0x83, 0xC1, 0x5F, 0xA0, 0x90, 0x06, 0xC3, 0x96, 0xFF, 0xFF, 0xFB,
-    0x81, 0xA2, 0xE7, 0x41, 0xCA, 0x37, 0xC2, 0x34, 0xCB, 0x31, 0xFC, 0xFE, 0x1F, 0x0F, 0xB6, 0xE4,
-    0x07, 0x54, 0x84, 0x85, 0xE1, 0xEF, 0x7F, 0x79, 0xB0, 0x88, 0xC3, 0x3F, 0xB0, 0x80, 0x3F, 0xC8,
-    0x49, 0xFC, 0x10, 0x97, 0x4C, 0x04, 0x09, 0x9C, 0x67, 0x42, 0x76, 0x7B, 0xD1, 0x9B, 0xFF, 0x73,
-    0x59, 0x80, 0x34, 0x00, 0xCE, 0x2C, 0x66, 0xE5,
+const uint8_t Roboto_30Bitmaps[15290] = {
+    0x03, 0x00, 0x03, 0x3A, 0x59, 0x1E, 0x19, 0x03, 0x35, 0xF2, 0xA3, 0xE3, 0x0D, 0x68, 0x18, 0xE8,
+    0x61, 0x3E, 0x74, 0x0C, 0x8C, 0x39, 0x5E, 0x74, 0x0C, 0x0C, 0x40, 0x1E, 0x64, 0x5C, 0x00, 0xC1,
+    0xDC, 0xC8, 0x98, 0x01, 0x17, 0x48, 0x74, 0x07, 0x95, 0x00, 0xDC, 0x40, 0xFB, 0xE2, 0x81, 0xF1,
+    0x36, 0x1F, 0x84, 0x41, 0x6C, 0x05, 0x90, 0x1E, 0xA0, 0x1C, 0x00, 0x7D, 0xD0, 0xC1, 0x0D, 0x80,
+    0x30, 0x00, 0x42, 0xD1, 0xAA, 0x69, 0x8D, 0x9A, 0xEE, 0x3F, 0x86, 0xA3, 0x38, 0x42, 0x47, 0xE8,
+    0x91, 0x0B, 0x09, 0xC2, 0x02, 0x3D, 0xBD, 0xDB, 0x0F, 0x81, 0xBE, 0x03, 0xEA, 0x6B, 0x9A, 0x79,
+    0xE8, 0x10, 0x74, 0xD3, 0x19, 0xE8, 0xA2, 0xA7, 0x40, 0x27, 0x9D, 0x80, 0x5A, 0x76, 0x40, 0x95,
+    0x33, 0x1C, 0x1C, 0x61, 0xE7, 0x17, 0x36, 0xBE, 0xA1, 0xFC, 0xAD, 0x94, 0x41, 0x0E, 0x82, 0x30,
+    0x14, 0x44, 0xAB, 0x42, 0x34, 0xA2, 0x72, 0x14, 0xBC, 0x81, 0x9A, 0x74, 0xA3, 0x1B, 0xBC, 0x01,
+    0x1B, 0xF7, 0x72, 0x03, 0x8F, 0xE2, 0x55, 0xB8, 0x81, 0x47, 0xE0, 0x08, 0x2E, 0xD4, 0xB8, 0x10,
+    0xAC, 0x65, 0x7E, 0x7F, 0x3F, 0xDD, 0x12, 0xBB, 0x80, 0xE4, 0x27, 0x53, 0x3A, 0x6F, 0xA6, 0xB8,
+    0xD5, 0x62, 0xBF, 0xA7, 0x70, 0x56, 0xB4, 0xD3, 0xDB, 0x39, 0x26, 0xFF, 0x13, 0x40, 0x4E, 0x7A,
+    0x88, 0x49, 0xCB, 0x44, 0x6D, 0x7E, 0x35, 0x69, 0x63, 0x9E, 0x54, 0x08, 0x7B, 0xCD, 0x27, 0x47,
+    0x0A, 0x17, 0xD1, 0xBA, 0x20, 0x72, 0x68, 0x25, 0xCA, 0x17, 0x88, 0x56, 0x12, 0xB5, 0x3D, 0xEC,
+    0x12, 0x5A, 0xC1, 0xDE, 0x00, 0xE3, 0x83, 0xB1, 0xE2, 0xB3, 0x53, 0x18, 0xC5, 0x91, 0xB7, 0x5A,
+    0xEB, 0x93, 0x31, 0x7B, 0xFB, 0x6A, 0x4D, 0xAE, 0x75, 0xD4, 0xC5, 0x1F, 0xAC, 0x74, 0xE0, 0x84,
+    0x40, 0x17, 0x68, 0x48, 0xAD, 0xA4, 0x98, 0x99, 0xB7, 0xAB, 0x1C, 0xE8, 0x95, 0xB7, 0xCB, 0x05,
+    0x4D, 0xBC, 0x5D, 0xBE, 0x18, 0x33, 0x6F, 0x97, 0x23, 0x8F, 0xBD, 0x5D, 0xAE, 0xC3, 0x18, 0x25,
+    0x9D, 0xF3, 0xA4, 0x24, 0x76, 0x5F, 0x5F, 0x6C, 0x5B, 0xC1, 0x1B, 0x69, 0x23, 0xB9, 0x33, 0x57,
+    0xD2, 0x8E, 0x84, 0xFB, 0x19, 0xDA, 0x3B, 0xF7, 0x22, 0x58, 0xC9, 0xC0, 0xC9, 0xCE, 0xF2, 0x35,
+    0xE6, 0x60, 0x9F, 0x9F, 0x8E, 0xB2, 0x1E, 0xFF, 0xBF, 0x2A, 0x65, 0x50, 0x95, 0x8D, 0xB7, 0xCB,
+    0x55, 0x49, 0xBD, 0xDD, 0xB0, 0x2A, 0x85, 0x92, 0x1F, 0x05, 0x55, 0x25, 0xEB, 0x71, 0xEF, 0x55,
+    0xC5, 0x5D, 0xFC, 0x08, 0x57, 0x72, 0xC1, 0x93, 0x23, 0xB1, 0x6B, 0xF8, 0xAF, 0xF8, 0x03, 0xAD,
+    0x95, 0xBB, 0x0E, 0x01, 0x41, 0x14, 0x86, 0x91, 0xB8, 0x44, 0xDC, 0x4A, 0xA5, 0x07, 0x90, 0x50,
+    0x7B, 0x0A, 0xA5, 0x44, 0xE3, 0x01, 0x14, 0xBC, 0x80, 0x48, 0x34, 0x2B, 0x0A, 0x2F, 0xA1, 0x16,
+    0xF1, 0x02, 0x54, 0x12, 0x5E, 0x82, 0x4E, 0x29, 0x58, 0xB7, 0xB0, 0x86, 0x73, 0x66, 0xCE, 0x65,
+    0x6B, 0xB6, 0xFB, 0x33, 0x3B, 0x33, 0x7B, 0xFE, 0xF3, 0x9D, 0x7F, 0xED, 0xD3, 0xF1, 0x1A, 0x9A,
+    0xEF, 0x1D, 0x17, 0xFD, 0x67, 0x59, 0xF0, 0x15, 0x08, 0x91, 0x6E, 0x40, 0x21, 0xA0, 0x29, 0x2F,
+    0x47, 0xF4, 0xFC, 0xB9, 0xAF, 0x66, 0xD2, 0xAD, 0x5D, 0x80, 0xEF, 0x74, 0xB8, 0x76, 0x24, 0xB6,
+    0xDC, 0xEC, 0xCC, 0xED, 0x54, 0xEE, 0x08, 0xB0, 0x07, 0x72, 0xE3, 0x13, 0x4B, 0x4B, 0x44, 0xE7,
+    0x4E, 0x16, 0x95, 0x10, 0xEA, 0x27, 0x9B, 0x80, 0xEE, 0x06, 0x0C, 0xFA, 0x0D, 0xDE, 0x7B, 0x3B,
+    0xE7, 0xB1, 0x6B, 0x49, 0xB5, 0x7A, 0x04, 0x8C, 0x5E, 0xBC, 0x17, 0xC8, 0x82, 0xEB, 0x12, 0xAA,
+    0xD6, 0x4B, 0x88, 0x61, 0xD8, 0xA1, 0x9D, 0xE8, 0x4B, 0x9E, 0xD2, 0x84, 0x98, 0x9A, 0xC8, 0x33,
+    0x94, 0xDA, 0xA6, 0xF6, 0xB8, 0xB8, 0x5B, 0xC4, 0x49, 0xDB, 0x38, 0x3D, 0x14, 0x49, 0xEF, 0x25,
+    0x20, 0x94, 0x3E, 0xB0, 0xD5, 0x13, 0xD4, 0x82, 0x6C, 0xFD, 0xC9, 0x41, 0x67, 0xBD, 0x80, 0x08,
+    0xAA, 0xC8, 0xF5, 0xD5, 0x20, 0x9C, 0x78, 0x33, 0xA3, 0xFB, 0x86, 0x03, 0x90, 0x0A, 0x97, 0x9A,
+    0x09, 0xF5, 0xDC, 0xE4, 0x1E, 0xC4, 0x2A, 0xFA, 0x9E, 0xBF, 0xCB, 0xFE, 0xEF, 0x59, 0xF9, 0x9B,
+    0x5C, 0x0E, 0xAB, 0x3E, 0x8F, 0x04, 0x38, 0x99, 0x3D, 0xF2, 0x40, 0xC1, 0xC9, 0xE9, 0x99, 0xFC,
+    0x93, 0xBE, 0x36, 0x24, 0xEA, 0x04, 0x3F, 0x42, 0x11, 0xC5, 0x6C, 0x03, 0x46, 0xBA, 0x36, 0x77,
+    0x4E, 0x50, 0xF8, 0xC8, 0xDB, 0x40, 0x81, 0x19, 0x1D, 0x83, 0x66, 0x1B, 0xD3, 0x19, 0xE9, 0x12,
+    0x8B, 0x72, 0xBA, 0xE7, 0x6E, 0x58, 0xA1, 0x6A, 0x8A, 0x13, 0x2F, 0x33, 0x8E, 0xA9, 0xDA, 0xAE,
+    0x34, 0xC6, 0xBF, 0xCB, 0x81, 0xE7, 0xFA, 0xF7, 0x01, 0x65, 0x95, 0x3D, 0x6E, 0xC2, 0x40, 0x10,
+    0x85, 0x09, 0xC4, 0x80, 0x22, 0xC1, 0x19, 0xB8, 0x40, 0x84, 0x0B, 0x44, 0x47, 0x92, 0x2A, 0x74,
+    0xFC, 0x5D, 0x00, 0x8E, 0x40, 0xE7, 0x5B, 0x70, 0x05, 0xA0, 0xA0, 0x47, 0x42, 0xD4, 0x49, 0xC1,
+    0x01, 0x72, 0x83, 0x88, 0x13, 0x44, 0x02, 0x12, 0x23, 0x4C, 0x10, 0x3B, 0xBF, 0x9E, 0xB5, 0xA7,
+    0xF3, 0x93, 0x56, 0x3B, 0xF3, 0xBD, 0x37, 0x6B, 0x57, 0xC3, 0xE8, 0xBD, 0x90, 0xAD, 0x0D, 0x3C,
+    0x04, 0x45, 0x5F, 0x9B, 0xA0, 0xB5, 0x3D, 0x5F, 0x8C, 0xC9, 0xF0, 0x47, 0xAB, 0x39, 0x52, 0xF3,
+    0xD6, 0xCA, 0x9A, 0x81, 0x6C, 0x80, 0xC4, 0x2F, 0x7B, 0xFF, 0x26, 0x2C, 0xC6, 0x04, 0x1A, 0x1B,
+    0x39, 0x76, 0xB8, 0xAF, 0x3A, 0xCD, 0x1E, 0x10, 0xEB, 0x80, 0xBC, 0x7D, 0xA2, 0xAF, 0x0A, 0xCE,
+    0x4F, 0x01, 0x4C, 0xC8, 0xCB, 0x04, 0x61, 0x1C, 0xD8, 0x92, 0xAB, 0x15, 0x13, 0xB6, 0xC1, 0x8A,
+    0x03, 0xC1, 0x68, 0xC5, 0xBD, 0x64, 0x56, 0x2F, 0xAA, 0x82, 0x41, 0x9C, 0x42, 0xD3, 0x52, 0xA8,
+    0xC3, 0x9A, 0xE6, 0xBF, 0x34, 0x94, 0x34, 0xE6, 0x09, 0xC6, 0x8C, 0x15, 0x40, 0x0A, 0xA4, 0x21,
+    0x76, 0xA4, 0xE8, 0x02, 0x97, 0x8D, 0x8F, 0x0C, 0xE4, 0x3E, 0x90, 0x6A, 0xE6, 0xEC, 0x70, 0x7B,
+    0x51, 0x31, 0x48, 0x87, 0x51, 0xF7, 0x01, 0x76, 0xE6, 0x3B, 0x67, 0x9F, 0xEB, 0xED, 0x35, 0x2F,
+    0xFE, 0xCB, 0x82, 0x9B, 0x9A, 0xEA, 0x2E, 0x9B, 0x3A, 0xE0, 0x64, 0xA3, 0xA8, 0x6D, 0xC5, 0x04,
+    0x12, 0xB5, 0x83, 0xE5, 0x4E, 0x0F, 0x20, 0x4A, 0x7A, 0x9E, 0x9E, 0x55, 0xDC, 0x43, 0x7C, 0x2F,
+    0xFA, 0xF6, 0x48, 0xD6, 0x6B, 0x30, 0xDB, 0xAC, 0xB5, 0x95, 0xCD, 0xC0, 0xA0, 0x97, 0x5C, 0x64,
+    0xE1, 0xB9, 0x8F, 0x25, 0xF2, 0x84, 0xF2, 0x0F, 0xDB, 0x5F, 0xEB, 0x64, 0x67, 0x40, 0x89, 0x0D,
+    0xC0, 0xA1, 0xA2, 0xAC, 0x6A, 0x20, 0x81, 0x28, 0x08, 0xD6, 0x4F, 0x44, 0xA9, 0xD1, 0x29, 0x73,
+    0xF4, 0x9B, 0x39, 0x91, 0x51, 0xFA, 0xE2, 0x82, 0x2E, 0xF4, 0xC5, 0x13, 0xA1, 0xF4, 0x2F, 0x62,
+    0x94, 0xD4, 0x52, 0x48, 0x2D, 0x85, 0xB7, 0x1F, 0xBE, 0xCE, 0x36, 0xBF, 0x1C, 0xF3, 0xDB, 0xE3,
+    0x8D, 0x59, 0x12, 0xB3, 0x11, 0x48, 0xCD, 0xA3, 0x9F, 0x45, 0x67, 0xFE, 0x01, 0x2F, 0x19, 0xA3,
+    0x76, 0xE6, 0xF7, 0x92, 0xD6, 0x88, 0x16, 0xFA, 0x0E, 0x85, 0x55, 0x3D, 0x0E, 0x01, 0x41, 0x14,
+    0x5E, 0x09, 0x09, 0x91, 0xB0, 0x8D, 0x52, 0x22, 0x51, 0x4B, 0x1C, 0x41, 0xA5, 0xD0, 0x58, 0xB5,
+    0x46, 0xA1, 0x94, 0xD0, 0xE9, 0x74, 0x1A, 0xCD, 0x1E, 0x41, 0xE5, 0x12, 0x14, 0xDC, 0x00, 0x27,
+    0x10, 0x27, 0xD8, 0xC4, 0x4F, 0x62, 0x65, 0x18, 0xF3, 0xE6, 0xFD, 0xCC, 0x28, 0xC4, 0x76, 0x3B,
+    0x9B, 0x7C, 0x6F, 0xDE, 0xF7, 0xB7, 0x38, 0x67, 0x38, 0x6D, 0xFB, 0xFE, 0x0E, 0x06, 0xE0, 0x8F,
+    0x6D, 0xD6, 0x1D, 0x34, 0x5F, 0x7E, 0x37, 0x10, 0xB0, 0x7D, 0xAA, 0x81, 0xCF, 0xCF, 0x97, 0x22,
+    0x86, 0x0E, 0xDD, 0xAF, 0xAF, 0x3C, 0x27, 0xDF, 0x91, 0xB7, 0x9B, 0xF0, 0x04, 0x9A, 0xE5, 0x51,
+    0xAD, 0xAE, 0x73, 0x10, 0x79, 0x26, 0x16, 0x16, 0xB8, 0x55, 0x96, 0x32, 0x2A, 0xFE, 0x71, 0xA2,
+    0x98, 0xBB, 0x1A, 0xDD, 0x36, 0xF4, 0x91, 0x13, 0x32, 0x59, 0xD9, 0x39, 0x28, 0x87, 0x94, 0xE4,
+    0xDD, 0x0D, 0x4B, 0x56, 0xFA, 0x93, 0xB7, 0xC5, 0xD2, 0xC6, 0x4E, 0x3C, 0x08, 0xD1, 0xCA, 0xDE,
+    0x35, 0x13, 0x4A, 0x52, 0xEE, 0x25, 0xD9, 0xB2, 0xBC, 0x39, 0xCC, 0x78, 0x1C, 0x4A, 0x51, 0xC9,
+    0x63, 0x06, 0xB3, 0xEA, 0x04, 0xFD, 0xD6, 0xEE, 0x2E, 0xAC, 0x92, 0x58, 0x87, 0xED, 0xE6, 0x25,
+    0x90, 0x7C, 0x91, 0x68, 0x4A, 0x8C, 0x02, 0x3C, 0x88, 0x74, 0xE1, 0x4A, 0xB4, 0x29, 0xD8, 0x3F,
+    0x85, 0x39, 0x11, 0x61, 0xBF, 0x0D, 0x5E, 0x0B, 0x8B, 0xEE, 0x81, 0xF3, 0x61, 0xB9, 0x03, 0xDA,
+    0x0E, 0xE3, 0xD8, 0x04, 0x8E, 0x6E, 0x82, 0x69, 0x2A, 0x6D, 0x02, 0x2F, 0x29, 0xF9, 0xEB, 0x0C,
+    0xFC, 0xEC, 0x60, 0x19, 0x45, 0x6A, 0xC1, 0x72, 0xC5, 0x0B, 0x60, 0xBE, 0xB8, 0x2B, 0x0C, 0x43,
+    0x71, 0x0A, 0x9F, 0xE5, 0x64, 0xC2, 0xCD, 0xAC, 0x24, 0x70, 0x4F, 0x5A, 0x2F, 0x95, 0x12, 0xF8,
+    0xD7, 0x47, 0xE2, 0x3E, 0xBC, 0xEC, 0xFE, 0x9B, 0xB8, 0x1A, 0xFF, 0xA7, 0x42, 0x8B, 0x3C, 0x26,
+    0x92, 0x3B, 0x99, 0xA0, 0x87, 0xD5, 0xF5, 0xB7, 0xAF, 0x1B, 0x47, 0x14, 0xBF, 0x45, 0x7F, 0x00,
+    0x3D, 0xB3, 0xA0, 0x10, 0xA7, 0x08, 0x6B, 0x73, 0x84, 0x16, 0xB6, 0x86, 0x0B, 0xE7, 0xEB, 0xCD,
+    0xA2, 0xC2, 0x4A, 0x7C, 0x00, 0x35, 0xC2, 0xC9, 0x09, 0x00, 0x20, 0x10, 0xC0, 0xC0, 0x87, 0xF7,
+    0xAA, 0xFD, 0x37, 0x1B, 0x88, 0xB0, 0xE0, 0x30, 0x78, 0xFF, 0x93, 0x37, 0x06, 0x2E, 0x9C, 0x38,
+    0xB0, 0x63, 0xC3, 0x9A, 0xCB, 0x03, 0x95, 0x93, 0xC1, 0x09, 0xC2, 0x40, 0x14, 0x44, 0x17, 0x0D,
+    0x04, 0x12, 0xC4, 0x92, 0x52, 0x82, 0x67, 0x4F, 0x6E, 0x27, 0x29, 0x21, 0xAD, 0xD8, 0x41, 0x2C,
+    0x41, 0x52, 0x41, 0x3A, 0x10, 0xBC, 0x28, 0x1A, 0xC4, 0x0D, 0xCC, 0x9B, 0x65, 0xBD, 0x99, 0x8B,
+    0xB9, 0xF8, 0xFF, 0x7F, 0x6F, 0x26, 0x7A, 0x8E, 0xFA, 0x9D, 0x14, 0x4D, 0xFA, 0xBE, 0xEC, 0x7B,
+    0x2B, 0xFA, 0x9E, 0x0F, 0xBD, 0xD6, 0x35, 0x03, 0x9A, 0x5A, 0x81, 0xA9, 0x16, 0x8B, 0xE4, 0x44,
+    0x24, 0xCC, 0xAC, 0x7C, 0x10, 0xD7, 0x47, 0xD8, 0x91, 0xA0, 0x2F, 0x8C, 0xBD, 0x03, 0xF9, 0x14,
+    0x75, 0xB2, 0x3D, 0x90, 0xCD, 0x01, 0xFC, 0x3D, 0xE6, 0x77, 0x2C, 0x68, 0x10, 0x50, 0x73, 0x77,
+    0x05, 0xF7, 0x0F, 0xEE, 0x8B, 0xB4, 0xDF, 0xB4, 0x7A, 0xC9, 0xAB, 0xFE, 0x78, 0xF1, 0xBF, 0x3C,
+    0xC7, 0x93, 0xBD, 0xCB, 0xDB, 0x7D, 0x8F, 0x2F, 0xF4, 0xCD, 0x67, 0x28, 0xCC, 0x65, 0x52, 0xB3,
+    0x67, 0x1B, 0xF6, 0x73, 0x65, 0x90, 0x1D, 0xDA, 0x6A, 0xF2, 0x3C, 0x86, 0xD2, 0x7C, 0x24, 0xA5,
+    0x34, 0xF2, 0x44, 0x11, 0x6F, 0x2E, 0x7A, 0x13, 0x8A, 0xE4, 0xD6, 0x94, 0x2B, 0x5A, 0xDF, 0xB9,
+    0x09, 0x9B, 0xB2, 0x1B, 0x61, 0x1A, 0x73, 0x7F, 0xBE, 0x5B, 0xC0, 0x02, 0xF5, 0xC5, 0x47, 0x58,
+    0x9C, 0x7D, 0x87, 0xEA, 0x04, 0x3A, 0x6F, 0x3F, 0xDC, 0x83, 0x50, 0x17, 0xFF, 0x81, 0x05, 0xFE,
+    0x43, 0x98, 0xB1, 0x06, 0x70, 0xCF, 0xFF, 0x80, 0x29, 0x7F, 0x00, 0x93, 0x0B, 0x80, 0x07, 0xC7,
+    0x1F, 0x58, 0x8A, 0x80, 0xBB, 0xF4, 0x02, 0x2C, 0x1E, 0x0A, 0x60, 0x8A, 0x04, 0xE0, 0x01, 0xF0,
+    0x1B, 0x66, 0x12, 0x1E, 0x7F, 0x35, 0xC0, 0xE2, 0x22, 0x00, 0x16, 0xB0, 0x02, 0xF0, 0x60, 0x83,
+    0x27, 0xB0, 0x3F, 0xD0, 0x80, 0x03, 0xA5, 0x0C, 0x06, 0x84, 0x9F, 0x51, 0x42, 0x01, 0x1E, 0x2E,
+    0xF0, 0x90, 0xFA, 0x02, 0xB3, 0x8C, 0x18, 0x06, 0xA1, 0xF0, 0x45, 0xB1, 0x1D, 0xEE, 0x9E, 0x7F,
+    0x50, 0x17, 0xC2, 0xDD, 0xEC, 0x00, 0xF3, 0x45, 0x01, 0xCC, 0x5F, 0x1B, 0x60, 0x3E, 0xFD, 0x80,
+    0x64, 0x27, 0x23, 0x6A, 0xC4, 0xFC, 0x83, 0x86, 0x98, 0x03, 0x2C, 0x0C, 0x37, 0xC0, 0x42, 0xF5,
+    0x13, 0x42, 0x6D, 0x3F, 0x2C, 0x61, 0xCB, 0xC1, 0x94, 0xC0, 0x5C, 0xBE, 0x1F, 0x96, 0xDB, 0xF5,
+    0x61, 0x61, 0xCB, 0x0A, 0xD5, 0x33, 0x1F, 0x96, 0x1B, 0xB9, 0x51, 0x2D, 0x84, 0xA7, 0x0D, 0x78,
+    0x6A, 0x81, 0xA7, 0x1F, 0x00, 0x83, 0xF9, 0x00, 0x29, 0x75, 0xA3, 0xF2, 0x26, 0xC0, 0xA3, 0x1E,
+    0x93, 0xD7, 0x00, 0x75, 0x18, 0x76, 0x1E, 0x2C, 0x66, 0x32, 0x19, 0x41, 0x2E, 0x06, 0xF1, 0x14,
+    0xD8, 0x81, 0x5E, 0x5A, 0xCF, 0x0A, 0xE1, 0x25, 0xFE, 0xB1, 0x07, 0x45, 0xD2, 0x7B, 0xCB, 0x04,
+    0x60, 0x10, 0x2F, 0x01, 0xA5, 0x99, 0x0D, 0xA0, 0x10, 0xDE, 0xFB, 0xFF, 0xFC, 0x0B, 0x70, 0xB4,
+    0x3E, 0x40, 0xCE, 0xDE, 0x8C, 0x0C, 0xCD, 0x7F, 0xE1, 0x89, 0xDD, 0x03, 0x64, 0xD4, 0x36, 0x08,
+    0xA7, 0x9A, 0x09, 0x1E, 0x7C, 0x20, 0x93, 0x91, 0xD2, 0x51, 0x3C, 0x03, 0x52, 0x9A, 0x81, 0xA7,
+    0x58, 0x50, 0xDA, 0x9A, 0x0F, 0x8B, 0x1C, 0x70, 0xB4, 0x70, 0xFC, 0x81, 0x27, 0xD7, 0xEF, 0x40,
+    0x1F, 0x7C, 0x82, 0x05, 0x8F, 0x01, 0x28, 0xC6, 0x0A, 0x08, 0x95, 0x6F, 0x90, 0x30, 0xF6, 0x87,
+    0x24, 0x17, 0x30, 0x4F, 0xE1, 0x0F, 0x38, 0x7A, 0xFF, 0x42, 0x4B, 0xCB, 0x06, 0xB0, 0xC5, 0x4B,
+    0x40, 0x24, 0x00, 0x63, 0x80, 0xE9, 0xE3, 0x44, 0x4E, 0xE0, 0x43, 0x87, 0x1F, 0x1C, 0x0A, 0x02,
+    0x40, 0x3F, 0xC5, 0x83, 0x19, 0xAC, 0x3F, 0x51, 0x8B, 0x05, 0x79, 0x4A, 0xF9, 0x43, 0x3D, 0x7C,
+    0x08, 0xF1, 0x01, 0x03, 0xD9, 0xD1, 0x8F, 0x85, 0xA8, 0x87, 0x10, 0x0A, 0x20, 0x57, 0x05, 0x80,
+    0xC2, 0x7F, 0x02, 0xC8, 0x6F, 0x17, 0x40, 0xA1, 0xF7, 0x05, 0xE4, 0x8C, 0x3F, 0xC0, 0x48, 0x04,
+    0x8B, 0x5F, 0x00, 0x85, 0xAF, 0xC2, 0x5F, 0x50, 0x94, 0x36, 0x00, 0xFD, 0x05, 0x00, 0x5B, 0xB1,
+    0x0A, 0x0C, 0xB4, 0xA0, 0xC9, 0xDD, 0x1E, 0x17, 0x0D, 0x00, 0x63, 0x70, 0x64, 0x06, 0x05, 0x15,
+    0x2B, 0x30, 0x30, 0xE4, 0x81, 0x32, 0xF9, 0x20, 0x0C, 0x74, 0xA1, 0xFD, 0x04, 0x50, 0x38, 0x25,
+    0x9B, 0x31, 0x00, 0x00, 0x83, 0x83, 0x07, 0xF0, 0x28, 0x06, 0x5B, 0x39, 0x1F, 0x39, 0x58, 0xE1,
+    0xA1, 0x0F, 0x72, 0x11, 0x0F, 0x9C, 0x53, 0x00, 0x0F, 0x2A, 0x88, 0xDF, 0x11, 0xA6, 0x7D, 0x46,
+    0x8A, 0x62, 0xA0, 0x37, 0xFD, 0x11, 0x9C, 0x7F, 0xB0, 0x10, 0x82, 0x78, 0x99, 0x03, 0xCE, 0xD9,
+    0x00, 0xF3, 0x1C, 0xC4, 0x1F, 0x48, 0xD1, 0xFA, 0x1D, 0x29, 0xAC, 0x81, 0x41, 0xCF, 0x0F, 0x67,
+    0x3B, 0xC0, 0x53, 0x2C, 0x24, 0x16, 0xE0, 0x49, 0x0C, 0x18, 0xD3, 0xF7, 0x11, 0x5A, 0xBE, 0xC1,
+    0x82, 0x13, 0x12, 0x62, 0xF2, 0x70, 0xB6, 0x02, 0x2C, 0x90, 0xA0, 0xB1, 0xCD, 0x4A, 0x44, 0x60,
+    0xFC, 0xA6, 0x66, 0x60, 0xFC, 0x27, 0x2A, 0x30, 0x3E, 0x21, 0x07, 0xC6, 0x0F, 0x58, 0x2A, 0x81,
+    0x04, 0x26, 0x31, 0x81, 0xF1, 0x91, 0xF4, 0xC0, 0x98, 0x80, 0x33, 0x30, 0xBE, 0x52, 0x33, 0x30,
+    0x00, 0x83, 0x78, 0x2D, 0xB5, 0xDC, 0x8D, 0x11, 0xEE, 0x9F, 0xAD, 0xE0, 0x14, 0x25, 0x0E, 0xE5,
+    0x5D, 0x81, 0xE5, 0x74, 0x78, 0xA8, 0xC2, 0x93, 0x1F, 0x03, 0xBC, 0x18, 0x80, 0xD8, 0x06, 0x0A,
+    0xA1, 0xFD, 0x6E, 0x46, 0x53, 0xA1, 0x29, 0x10, 0xE8, 0x86, 0xF7, 0x20, 0x2B, 0x17, 0x42, 0xD2,
+    0xE0, 0x57, 0x58, 0x46, 0xFF, 0x05, 0x0E, 0x80, 0xDF, 0x30, 0xF7, 0x3C, 0x00, 0x05, 0x9F, 0x00,
+    0x3C, 0x22, 0x13, 0x40, 0x9A, 0x13, 0x10, 0xE1, 0x0B, 0x92, 0x40, 0x84, 0x30, 0x48, 0x1B, 0x28,
+    0x98, 0x61, 0xA9, 0x03, 0xE4, 0x99, 0x0F, 0xF0, 0x00, 0x05, 0x05, 0x15, 0x1B, 0x5A, 0x0C, 0x7F,
+    0x81, 0xC7, 0x27, 0x28, 0xFE, 0xB9, 0xE0, 0xE1, 0x01, 0xE6, 0x72, 0xC3, 0x43, 0x05, 0xCC, 0xE5,
+    0xF9, 0x8E, 0xE0, 0x02, 0x9D, 0xC5, 0x3B, 0x28, 0xB9, 0x3C, 0xDF, 0x10, 0x5E, 0x00, 0x71, 0xD1,
+    0x7C, 0x44, 0x20, 0xBD, 0xC3, 0xD2, 0x05, 0x38, 0xAC, 0x58, 0x0F, 0xC0, 0x13, 0x2C, 0x28, 0x35,
+    0x30, 0x37, 0x20, 0x32, 0x1A, 0x30, 0xAD, 0x81, 0x12, 0x62, 0x3F, 0x3C, 0x21, 0xEE, 0x07, 0x45,
+    0x05, 0xB4, 0x14, 0x28, 0x00, 0x47, 0xCF, 0x4F, 0x98, 0x4D, 0x0F, 0xC1, 0xD1, 0xF3, 0x09, 0x96,
+    0xC2, 0x7F, 0x83, 0x13, 0xE7, 0x02, 0x68, 0x49, 0x7A, 0x10, 0x12, 0xFB, 0xA0, 0x2C, 0x7D, 0xDE,
+    0xDD, 0x79, 0x29, 0x34, 0x6D, 0x80, 0x6C, 0x87, 0x02, 0x2E, 0x06, 0xE4, 0xD2, 0x0A, 0x5A, 0x34,
+    0x1C, 0x42, 0x2B, 0x02, 0x97, 0xA0, 0xA4, 0x49, 0xE4, 0x14, 0x0B, 0x00, 0x83, 0xE5, 0x47, 0x88,
+    0x77, 0x04, 0xAE, 0x43, 0xFC, 0x15, 0xF0, 0x1B, 0xE2, 0x41, 0x70, 0x36, 0xCD, 0x07, 0x09, 0x83,
+    0x40, 0x7E, 0xC0, 0x6F, 0x48, 0xF4, 0xE6, 0x43, 0x69, 0x08, 0xE3, 0x7D, 0x06, 0x84, 0xB1, 0x9E,
+    0xC5, 0x01, 0xCC, 0x88, 0x06, 0x7B, 0x21, 0xFF, 0xB6, 0x38, 0xC4, 0x2F, 0xF9, 0x8C, 0x50, 0x4F,
+    0xE5, 0x33, 0x8C, 0x32, 0x88, 0x63, 0x00, 0x00, 0x83, 0xD8, 0x93, 0x52, 0x9E, 0x2E, 0x82, 0x08,
+    0xC7, 0x26, 0x70, 0xDA, 0xEF, 0x85, 0x4A, 0x32, 0x2C, 0x44, 0x4D, 0xC7, 0x01, 0xF0, 0x84, 0xA5,
+    0x0B, 0x33, 0x18, 0x96, 0xCD, 0x98, 0xA0, 0xE9, 0xEE, 0x7E, 0x84, 0x72, 0x32, 0x28, 0xA1, 0xF0,
+    0x42, 0x0A, 0x06, 0xB0, 0x0B, 0x40, 0x19, 0xAA, 0x1F, 0xE2, 0x69, 0x5D, 0x58, 0x88, 0x00, 0xED,
+    0x17, 0x80, 0xC7, 0x3E, 0x28, 0xD2, 0xD9, 0x40, 0xD1, 0x06, 0x4B, 0x3C, 0xDF, 0x41, 0x01, 0xB5,
+    0x01, 0x11, 0xF7, 0x1F, 0x41, 0x06, 0x3E, 0x40, 0xA4, 0x8C, 0x0B, 0xA0, 0xE8, 0xF8, 0x00, 0xF3,
+    0x28, 0xD8, 0xCF, 0xFC, 0x20, 0x45, 0xD0, 0xD0, 0x05, 0x69, 0xE5, 0x43, 0xCE, 0xB5, 0x07, 0x50,
+    0x12, 0x15, 0x24, 0x39, 0x20, 0xF3, 0xBF, 0xC0, 0x82, 0x0A, 0x9E, 0xBC, 0xDE, 0x23, 0x73, 0x0D,
+    0x90, 0x92, 0x35, 0xD4, 0x38, 0x79, 0x64, 0xFE, 0x77, 0x44, 0xCA, 0x82, 0x2A, 0xBF, 0x8F, 0x2C,
+    0xFD, 0x10, 0x1E, 0xD3, 0x0C, 0xB0, 0xC8, 0x44, 0x56, 0xBE, 0x00, 0xAD, 0x88, 0xF9, 0x81, 0x9C,
+    0x96, 0x21, 0x31, 0xCE, 0x84, 0xC4, 0xFF, 0x8A, 0x6A, 0x9A, 0x03, 0x22, 0xD5, 0xC2, 0xD2, 0x58,
+    0x3D, 0x12, 0x17, 0x54, 0x94, 0x22, 0x7B, 0xF5, 0x22, 0x72, 0x16, 0x84, 0xB8, 0x85, 0x1B, 0x89,
+    0xBB, 0x01, 0xCD, 0x2D, 0xC0, 0x28, 0x93, 0x45, 0xE2, 0x36, 0xC0, 0x4A, 0x68, 0x28, 0xF8, 0x06,
+    0x2F, 0xC1, 0xE1, 0xE9, 0x83, 0x19, 0xD5, 0x2D, 0xF6, 0x68, 0x6E, 0x61, 0x41, 0x0D, 0x97, 0x7C,
+    0x64, 0xCB, 0x80, 0xC9, 0x64, 0xDD, 0x2A, 0x38, 0xE0, 0x72, 0x40, 0x2D, 0xE6, 0xE5, 0x49, 0xE5,
+    0x03, 0x00, 0x83, 0xD8, 0x93, 0x52, 0x1E, 0x06, 0x8F, 0x1F, 0x86, 0x46, 0x70, 0xD2, 0x27, 0x94,
+    0xEF, 0xB8, 0xA0, 0xB1, 0x81, 0x94, 0x1C, 0x41, 0x81, 0xF7, 0x3E, 0xC2, 0x38, 0xE5, 0x37, 0x24,
+    0xAD, 0x5E, 0x80, 0x06, 0xA5, 0xC2, 0x1F, 0x70, 0xFC, 0x7D, 0x83, 0xC5, 0xE2, 0x06, 0x70, 0x02,
+    0xF8, 0x0B, 0x73, 0x8F, 0x00, 0x28, 0xF4, 0x0D, 0xFE, 0xC3, 0xC3, 0x19, 0x18, 0x8B, 0x2C, 0x09,
+    0xF0, 0xC0, 0x00, 0x79, 0x80, 0x7D, 0x02, 0x3C, 0x84, 0x41, 0xA1, 0xC7, 0xB1, 0x00, 0x16, 0x0F,
+    0x60, 0x0F, 0x73, 0x22, 0x65, 0xCC, 0x4F, 0xA8, 0xDC, 0x2F, 0x88, 0xB8, 0x87, 0x86, 0x37, 0x13,
+    0x12, 0xF7, 0x1F, 0x34, 0x58, 0x19, 0x60, 0xAE, 0xF2, 0x47, 0xF0, 0x04, 0x7E, 0xC1, 0x02, 0x10,
+    0xCC, 0x7B, 0xF6, 0x1F, 0xAE, 0x96, 0x40, 0x7A, 0x07, 0x03, 0x66, 0x54, 0xEE, 0x7E, 0x26, 0x14,
+    0x2E, 0x52, 0xD2, 0x11, 0x48, 0xFE, 0xFD, 0x1F, 0xC5, 0x8D, 0x0A, 0xBF, 0x51, 0x9C, 0x01, 0xCA,
+    0x10, 0xEF, 0x91, 0x4B, 0x9E, 0xDF, 0xB0, 0xE8, 0x84, 0xFB, 0x97, 0x1B, 0x89, 0x7B, 0x00, 0x11,
+    0x30, 0x50, 0xCD, 0xFA, 0x48, 0xDC, 0x02, 0x54, 0xA3, 0x81, 0x61, 0xEC, 0xFF, 0x01, 0x9E, 0x16,
+    0xC1, 0xB2, 0x1F, 0x10, 0xC6, 0x81, 0xF4, 0x5E, 0x40, 0x18, 0x07, 0x62, 0x2E, 0x40, 0x44, 0x0A,
+    0xC8, 0x5E, 0x07, 0x44, 0x31, 0xF0, 0x1B, 0x14, 0xD1, 0x7F, 0x61, 0x9A, 0x1B, 0xC0, 0x81, 0x05,
+    0x8C, 0xA8, 0xFB, 0xE0, 0x62, 0xF7, 0x37, 0x58, 0x1B, 0x28, 0x67, 0xDF, 0x0F, 0x87, 0xA4, 0x0D,
+    0x2E, 0x78, 0x39, 0x02, 0x4B, 0x39, 0xF0, 0x22, 0xEE, 0x3F, 0xC1, 0xFA, 0x02, 0x91, 0x62, 0x21,
+    0xA1, 0x0A, 0x00, 0xCD, 0xD4, 0xB1, 0x0D, 0xC2, 0x30, 0x10, 0x05, 0x50, 0x24, 0x3A, 0x14, 0x14,
+    0x46, 0xC8, 0x08, 0x19, 0x21, 0xA3, 0xB0, 0x09, 0x6C, 0xC2, 0x0A, 0xE9, 0x29, 0xC8, 0x08, 0x19,
+    0x21, 0x23, 0x84, 0x20, 0x19, 0x42, 0x14, 0xC1, 0xF9, 0xEC, 0xB3, 0xFF, 0x5D, 0x47, 0x47, 0xAA,
+    0xE8, 0x55, 0xD6, 0xFF, 0xDF, 0x56, 0xE9, 0x15, 0x38, 0x72, 0x3F, 0x20, 0x05, 0xBD, 0x85, 0x97,
+    0x01, 0x0E, 0x0F, 0xA1, 0xB3, 0xE0, 0x0C, 0x1C, 0x3E, 0x06, 0x28, 0xA6, 0x45, 0x01, 0x9D, 0x7F,
+    0x42, 0xA0, 0x69, 0x9C, 0x46, 0x04, 0x9A, 0xCC, 0x5E, 0x01, 0xE5, 0xBB, 0x55, 0xB0, 0xD2, 0x62,
+    0x10, 0xCE, 0x7E, 0x26, 0x08, 0x93, 0xCF, 0x08, 0x81, 0x9F, 0x31, 0x80, 0x23, 0x0F, 0x10, 0xE0,
+    0xCE, 0xA3, 0x02, 0x78, 0x73, 0x45, 0x19, 0x9A, 0x50, 0x77, 0x86, 0x21, 0x34, 0x96, 0x61, 0x0E,
+    0x97, 0x28, 0x41, 0x1D, 0xFB, 0x4F, 0xD0, 0xC7, 0x0A, 0x13, 0x3C, 0x63, 0xFD, 0x02, 0x95, 0xEC,
+    0x44, 0xA0, 0x95, 0x5B, 0x23, 0xE0, 0xA4, 0xEA, 0x08, 0x14, 0xDE, 0x65, 0x83, 0x40, 0xD3, 0xBD,
+    0x5D, 0xF9, 0x5B, 0xF8, 0x6F, 0xF7, 0x30, 0xCF, 0x6A, 0xE9, 0x7E, 0x87, 0x5C, 0xDE, 0x68, 0x06,
+    0xF3, 0x6F, 0xF0, 0x05, 0x03, 0xF3, 0xE1, 0x29, 0x15, 0x2D, 0xE1, 0xC2, 0xE3, 0x1B, 0xCE, 0xFD,
+    0x8D, 0xCA, 0xFD, 0x8B, 0xCA, 0xFD, 0xF7, 0xBF, 0xDF, 0x05, 0x0A, 0x54, 0xC0, 0x69, 0xC1, 0x1F,
+    0x29, 0xD3, 0x28, 0xC0, 0x43, 0x00, 0x16, 0x9C, 0xF2, 0x48, 0xDC, 0x00, 0x58, 0xD8, 0xC2, 0x63,
+    0x8F, 0x0F, 0x89, 0xDB, 0x00, 0x0B, 0x4E, 0x78, 0x32, 0xE1, 0x42, 0xE2, 0x6E, 0x80, 0xA7, 0x5C,
+    0x58, 0x2C, 0xB0, 0x23, 0x71, 0x1F, 0xC0, 0x42, 0x00, 0x9E, 0x08, 0x98, 0x8B, 0x6E, 0xFD, 0xBB,
+    0x5F, 0xCD, 0x04, 0x0B, 0xB1, 0x6D, 0x90, 0xFC, 0xC4, 0x0C, 0x8D, 0x1C, 0x24, 0xFF, 0x80, 0x82,
+    0x1E, 0x06, 0xB8, 0x20, 0x61, 0x88, 0x5C, 0x4A, 0x82, 0x82, 0x2A, 0x4A, 0xD9, 0x68, 0x1B, 0xB4,
+    0xD0, 0x00, 0x72, 0xB5, 0x41, 0x9A, 0x36, 0x41, 0xD2, 0x89, 0xC0, 0xD4, 0x5E, 0x78, 0x34, 0xD7,
+    0xA3, 0xBA, 0xF6, 0x3E, 0x12, 0x57, 0xE0, 0x3F, 0x2C, 0x56, 0xE1, 0xAA, 0xD9, 0x90, 0xB8, 0x5F,
+    0x50, 0xBD, 0xFA, 0x01, 0x35, 0x20, 0x1E, 0xA0, 0xE4, 0x13, 0xA4, 0xF4, 0x07, 0xE3, 0xF2, 0xA2,
+    0x2A, 0xE6, 0xF9, 0x04, 0x4B, 0x05, 0x60, 0xA3, 0xB8, 0x3F, 0x20, 0x72, 0x03, 0xD0, 0x22, 0x8E,
+    0x0B, 0x08, 0xD3, 0x81, 0xCE, 0x60, 0x69, 0x40, 0xC4, 0x18, 0xA8, 0x40, 0x50, 0x80, 0x67, 0xB6,
+    0x09, 0x60, 0xFF, 0xFF, 0x81, 0x05, 0xFB, 0x37, 0xB0, 0x3A, 0xA0, 0xD1, 0xE7, 0x99, 0xA0, 0xD9,
+    0x86, 0x1B, 0x92, 0x46, 0xF7, 0xBB, 0x19, 0x4F, 0xFD, 0x07, 0x2D, 0x2D, 0x7E, 0xC2, 0x83, 0xCE,
+    0x1E, 0xB9, 0x4C, 0x83, 0xE5, 0x0F, 0x58, 0xA9, 0x27, 0x09, 0xB5, 0x70, 0x0B, 0x58, 0x4E, 0x13,
+    0x91, 0x7A, 0x52, 0xCB, 0xDD, 0x20, 0xC1, 0x04, 0x00, 0x85, 0x55, 0x2B, 0x0E, 0xC2, 0x40, 0x10,
+    0xA5, 0x1F, 0xBA, 0x0A, 0xB8, 0x02, 0x37, 0x00, 0x03, 0xB6, 0x02, 0x89, 0xA8, 0xC5, 0x35, 0x69,
+    0x70, 0x18, 0x0C, 0xE1, 0x1A, 0xDC, 0x80, 0xA4, 0x17, 0x00, 0x8B, 0xDA, 0x03, 0x20, 0xEA, 0x11,
+    0x94, 0x0B, 0x90, 0xE2, 0x9A, 0x90, 0x7E, 0xD8, 0xD9, 0xDD, 0x99, 0x1D, 0x47, 0xD5, 0xBE, 0x64,
+    0xBA, 0x9D, 0x79, 0x9F, 0xA9, 0x7D, 0xB2, 0xDB, 0xDB, 0x01, 0x13, 0x0D, 0x84, 0x36, 0x37, 0x08,
+    0xAD, 0x8B, 0x3D, 0x6E, 0xCD, 0xEA, 0x39, 0xA0, 0x89, 0x7A, 0xB9, 0xC4, 0x7B, 0xF6, 0xCC, 0xFC,
+    0x66, 0xF0, 0xC2, 0x77, 0x6A, 0xB5, 0xD8, 0x22, 0xD6, 0x4A, 0x96, 0xB0, 0x17, 0x97, 0x52, 0x37,
+    0x1F, 0x0D, 0xF8, 0xAB, 0x3C, 0x8E, 0x53, 0x2E, 0x86, 0xBE, 0x69, 0xC2, 0xE0, 0x15, 0xE8, 0xCE,
+    0x1E, 0x5D, 0xB9, 0xF3, 0xAC, 0x07, 0x44, 0x4E, 0x0B, 0x02, 0x3C, 0xB0, 0xED, 0xDD, 0x76, 0x53,
+    0x54, 0x63, 0x18, 0x81, 0xA4, 0x5A, 0x1F, 0x8A, 0x3B, 0xE4, 0x61, 0x66, 0x73, 0xBA, 0x56, 0x02,
+    0x35, 0xDA, 0x76, 0x60, 0x9B, 0x14, 0x49, 0x88, 0x40, 0x9D, 0xCA, 0x47, 0x16, 0x46, 0x00, 0x63,
+    0x9A, 0x25, 0x81, 0x69, 0x05, 0x19, 0xF3, 0x0C, 0x81, 0xA0, 0x88, 0x28, 0x75, 0x19, 0x54, 0xB7,
+    0x72, 0xA8, 0x44, 0x0A, 0x3A, 0xAB, 0xBF, 0x91, 0x33, 0x6C, 0x29, 0x8C, 0xD0, 0xEF, 0xB0, 0x71,
+    0xC5, 0x00, 0xBF, 0x0E, 0x42, 0x71, 0xED, 0xC2, 0xA5, 0x48, 0x0C, 0x58, 0x1A, 0x54, 0x97, 0xDE,
+    0x07, 0x6D, 0x0A, 0x56, 0x2A, 0xC1, 0xC9, 0x31, 0x71, 0x7A, 0x01, 0xC7, 0x4B, 0xCA, 0x65, 0xAA,
+    0x15, 0x8B, 0x50, 0xC9, 0xB1, 0xFE, 0x5A, 0x82, 0x8B, 0x5A, 0x98, 0x1C, 0x0B, 0x63, 0x90, 0xD2,
+    0xFE, 0x3F, 0xAA, 0xCD, 0xEA, 0xDF, 0x7E, 0x45, 0xFB, 0x9F, 0xEC, 0x56, 0x43, 0x83, 0xE4, 0xC0,
+    0xB9, 0x0C, 0x49, 0xC6, 0xF9, 0xE1, 0xB8, 0x30, 0xA7, 0x1F, 0x95, 0xD4, 0xB1, 0x0D, 0xC2, 0x50,
+    0x0C, 0x84, 0xE1, 0x94, 0x08, 0x21, 0x85, 0x11, 0x18, 0x81, 0x51, 0x18, 0x81, 0x11, 0x18, 0x85,
+    0x4D, 0xA0, 0xA2, 0x49, 0xC3, 0x08, 0x6C, 0x40, 0x56, 0x08, 0x11, 0x28, 0x04, 0x3D, 0xA0, 0x40,
+    0xBE, 0xF8, 0xFE, 0x8E, 0x74, 0xD7, 0x7D, 0x67, 0xFB, 0xE5, 0xE9, 0xCF, 0x68, 0xFE, 0x67, 0x9E,
+    0x9D, 0x9A, 0xE9, 0x2B, 0xC1, 0xD0, 0x7E, 0x0E, 0x39, 0xAE, 0x35, 0x02, 0xCD, 0x6D, 0x91, 0xF3,
+    0x2D, 0xA8, 0x55, 0x8C, 0xE7, 0x9A, 0xE3, 0x32, 0xCF, 0xFC, 0x37, 0x84, 0x3A, 0xE7, 0x76, 0xDA,
+    0x6C, 0x14, 0x36, 0x4D, 0x71, 0xCD, 0x06, 0x9A, 0x33, 0x34, 0x3D, 0x34, 0x2F, 0xD7, 0xAC, 0xB4,
+    0x24, 0x95, 0x31, 0x4D, 0x07, 0xCD, 0x00, 0xCD, 0xC7, 0x35, 0x3B, 0x68, 0x5A, 0x68, 0x1E, 0xD0,
+    0x14, 0x3D, 0x48, 0x9C, 0x8C, 0xCA, 0xD4, 0x28, 0x63, 0x9A, 0x31, 0x2E, 0x49, 0x65, 0x4C, 0xB3,
+    0x87, 0xA6, 0x83, 0x66, 0x80, 0xE6, 0xED, 0x9A, 0x2D, 0x34, 0x17, 0x68, 0xEE, 0xFA, 0xD3, 0x54,
+    0x7E, 0xD7, 0x2A, 0x63, 0x9A, 0x23, 0x34, 0x3D, 0x34, 0x63, 0xD6, 0x7C, 0x01, 0x75, 0x95, 0xBD,
+    0x0E, 0x01, 0x41, 0x14, 0x85, 0x77, 0x49, 0x10, 0x56, 0x14, 0x0A, 0x95, 0x44, 0xAF, 0x54, 0xA9,
+    0x48, 0x24, 0x34, 0x8A, 0x7D, 0x06, 0x2F, 0xA0, 0x12, 0x4F, 0xA0, 0xE5, 0x11, 0x3C, 0x02, 0x85,
+    0x28, 0x34, 0xAB, 0x52, 0x92, 0x88, 0x7E, 0xC3, 0x0B, 0x2C, 0x89, 0x9F, 0x4D, 0xFC, 0xEE, 0xB9,
+    0x33, 0xF7, 0xEE, 0x92, 0xA8, 0x64, 0x4C, 0x66, 0xE6, 0x9E, 0x73, 0xBE, 0x7B, 0x57, 0x49, 0xEB,
+    0xF5, 0x9B, 0xA6, 0xE8, 0x99, 0x11, 0x51, 0x05, 0xBD, 0xDA, 0x45, 0xE0, 0x0B, 0x51, 0x7C, 0x6F,
+    0x4C, 0xE3, 0x8B, 0xF2, 0xA2, 0xB6, 0xDC, 0x6D, 0x35, 0xE6, 0x3A, 0x95, 0xA0, 0x18, 0x0F, 0x6F,
+    0x6F, 0x95, 0xA5, 0x3E, 0xA7, 0x78, 0x27, 0x97, 0x5E, 0x5C, 0xD8, 0x1E, 0x16, 0x94, 0x58, 0x23,
+    0xB4, 0x8D, 0x61, 0xC6, 0x48, 0x2C, 0x70, 0xF0, 0x9F, 0xF6, 0x26, 0x38, 0xE6, 0xA2, 0x08, 0x6D,
+    0x5A, 0x90, 0x84, 0x87, 0xDD, 0x70, 0xE9, 0xE2, 0x6C, 0x57, 0x60, 0xDC, 0xE0, 0xE6, 0x89, 0x04,
+    0x38, 0xA2, 0xEC, 0x4C, 0x8E, 0xAD, 0x46, 0xB6, 0x64, 0x18, 0x2C, 0x8B, 0x7C, 0x1B, 0xF3, 0x7C,
+    0x89, 0xAB, 0x19, 0xD4, 0x0E, 0x7E, 0x7C, 0x7D, 0x27, 0x3A, 0x6C, 0xBD, 0x78, 0x72, 0x6F, 0x96,
+    0x1E, 0x5F, 0x43, 0x89, 0xDD, 0x71, 0x4D, 0xC9, 0xF7, 0x6F, 0x5F, 0x83, 0xA6, 0x61, 0xDE, 0xE8,
+    0x3C, 0xD4, 0x83, 0x07, 0xFD, 0xAE, 0xAD, 0xB6, 0xEF, 0x9C, 0xE3, 0x01, 0x45, 0xDA, 0x22, 0xA1,
+    0x0E, 0x45, 0x4B, 0xE1, 0x0D, 0xC4, 0xC7, 0x4F, 0xC2, 0x13, 0x34, 0xA4, 0x2E, 0xC2, 0x2F, 0x78,
+    0xB7, 0x6E, 0x61, 0x73, 0x81, 0x4E, 0x9F, 0x11, 0x22, 0xA9, 0xB9, 0x9F, 0xDD, 0x2B, 0x67, 0x42,
+    0x67, 0xB3, 0x67, 0x99, 0x08, 0xE8, 0x95, 0xF4, 0x51, 0xE8, 0x46, 0x96, 0xC9, 0xA9, 0x64, 0x04,
+    0x2D, 0xB1, 0x3A, 0x4F, 0x4E, 0x4C, 0x25, 0x87, 0x24, 0x28, 0x45, 0x2F, 0xCA, 0x7D, 0x8F, 0x2F,
+    0x4B, 0xB3, 0x32, 0x78, 0x2A, 0x18, 0x22, 0xF3, 0x9B, 0x2E, 0xD9, 0xCA, 0x32, 0x61, 0x44, 0xC1,
+    0x2A, 0x6B, 0x0A, 0x56, 0x34, 0x75, 0xAA, 0xC2, 0x68, 0x48, 0xEC, 0x07, 0x55, 0x94, 0xBF, 0x0A,
+    0xC2, 0x40, 0x0C, 0xC6, 0xB5, 0x27, 0xBA, 0x38, 0x38, 0x88, 0x3E, 0x85, 0xD0, 0x67, 0x10, 0x9C,
+    0xBB, 0x3A, 0x3A, 0x08, 0x8E, 0xE2, 0xE2, 0xE6, 0x33, 0xE8, 0xE0, 0xEE, 0xE6, 0x5A, 0x7C, 0x00,
+    0xC5, 0x27, 0xF0, 0x0F, 0x38, 0xB8, 0xD5, 0xC9, 0xA9, 0x20, 0x08, 0x82, 0x5A, 0xDB, 0x9A, 0xE4,
+    0xEE, 0x72, 0xE9, 0x0D, 0x85, 0xD0, 0xF6, 0x92, 0x7C, 0xF9, 0x7D, 0xA1, 0xD3, 0x9D, 0x8E, 0x9A,
+    0xDC, 0x8E, 0x36, 0xC6, 0xCC, 0x86, 0x77, 0x69, 0x3B, 0x6C, 0xC3, 0xB1, 0x28, 0x30, 0x5A, 0xD9,
+    0x97, 0x61, 0x6F, 0x98, 0x18, 0x74, 0x21, 0x75, 0x08, 0x09, 0xFC, 0x54, 0x8F, 0x2F, 0x33, 0x3F,
+    0x9D, 0x69, 0xFE, 0x03, 0x4B, 0x41, 0x83, 0xD8, 0x38, 0xB1, 0x86, 0x84, 0xE1, 0x93, 0x59, 0x24,
+    0x49, 0xB9, 0x76, 0xEC, 0x3C, 0x40, 0xDD, 0x4A, 0x2C, 0xD0, 0x1C, 0xC6, 0x17, 0xD9, 0x62, 0x33,
+    0x98, 0x56, 0xCA, 0x13, 0xA3, 0x35, 0x94, 0xB9, 0x10, 0x1A, 0x96, 0x21, 0x08, 0x51, 0x4E, 0x1D,
+    0x3F, 0x90, 0xC4, 0x4B, 0xF8, 0x66, 0x0C, 0xD5, 0xC7, 0x0A, 0x4E, 0xB3, 0xAA, 0xBC, 0x1C, 0x4A,
+    0xC8, 0xEC, 0x93, 0x21, 0x45, 0x6A, 0xD4, 0x9E, 0x99, 0x40, 0x47, 0x29, 0x68, 0xF0, 0xE1, 0x31,
+    0xA6, 0x1E, 0x32, 0xD3, 0xE1, 0x4D, 0x58, 0x46, 0x71, 0xF2, 0x36, 0xEC, 0x41, 0x63, 0x42, 0x34,
+    0x41, 0x7E, 0x88, 0xE1, 0xF1, 0x23, 0xAB, 0x25, 0x46, 0xD7, 0xE0, 0x4D, 0xCD, 0x2D, 0x8C, 0xCD,
+    0xD5, 0x57, 0xAB, 0x76, 0x31, 0x33, 0x48, 0x0D, 0x29, 0xCB, 0x38, 0xDF, 0xB5, 0xB0, 0xAA, 0x40,
+    0x6C, 0x29, 0x9F, 0x35, 0xB5, 0x38, 0xD7, 0x45, 0x78, 0x73, 0xCD, 0x18, 0x4E, 0x3C, 0x11, 0x0A,
+    0x99, 0x34, 0xE1, 0xF2, 0xE2, 0x8F, 0x85, 0x8B, 0xCE, 0xC6, 0xAD, 0x03, 0x38, 0x93, 0x4C, 0x7C,
+    0xEB, 0xAF, 0x85, 0x9D, 0xAE, 0x7A, 0x3F, 0x8E, 0x0B, 0x8B, 0x24, 0x52, 0x85, 0xB0, 0x26, 0xAC,
+    0x9C, 0x1F, 0xAB, 0xCE, 0xD9, 0x8F, 0x6D, 0xDF, 0xE6, 0xF8, 0x03, 0x63, 0x70, 0x62, 0x06, 0x7A,
+    0xE0, 0x3E, 0x13, 0x50, 0x94, 0x07, 0x68, 0xBE, 0x3C, 0x08, 0x03, 0x25, 0x78, 0x0F, 0xFE, 0x7F,
+    0xCF, 0xC2, 0x50, 0x22, 0xCA, 0x40, 0x55, 0xE0, 0xC4, 0x04, 0xB4, 0xEB, 0x3C, 0xC8, 0x2E, 0x6E,
+    0xA0, 0x3D, 0xFC, 0xC0, 0x60, 0x94, 0x07, 0x86, 0x01, 0xEF, 0x45, 0x50, 0x20, 0x95, 0x8A, 0x32,
+    0x00, 0x00, 0x63, 0x60, 0x70, 0x64, 0x06, 0x05, 0xD6, 0x7B, 0x56, 0x90, 0xC3, 0xE4, 0x41, 0x82,
+    0xF1, 0x20, 0x22, 0x1F, 0x64, 0xAD, 0x3E, 0x28, 0x42, 0x80, 0xA1, 0x97, 0xAC, 0xC6, 0x40, 0x6B,
+    0xB0, 0x01, 0x14, 0x74, 0x98, 0x04, 0x2F, 0x84, 0x00, 0x7B, 0xE7, 0x03, 0x28, 0xEA, 0x3E, 0x83,
+    0xBC, 0xF1, 0x03, 0x94, 0x1C, 0xFF, 0x01, 0x53, 0x59, 0x02, 0xC8, 0xC9, 0x0F, 0x40, 0x6E, 0xFC,
+    0x01, 0x4A, 0x08, 0x13, 0xC0, 0xF1, 0x7F, 0x04, 0x18, 0x48, 0x00, 0x43, 0x02, 0x0A, 0x91, 0x08,
+    0xB6, 0xC1, 0x2F, 0x84, 0xFF, 0x1C, 0x7E, 0x23, 0x3C, 0x1B, 0xF0, 0x07, 0xE1, 0xF3, 0x04, 0xA4,
+    0x60, 0x28, 0x00, 0xA7, 0x2C, 0x08, 0xA7, 0x11, 0x92, 0x24, 0xC1, 0xA1, 0x3E, 0x09, 0x92, 0x56,
+    0x59, 0xE0, 0xB9, 0xE6, 0x7F, 0x1F, 0xD8, 0xCE, 0x2D, 0x60, 0x76, 0x0C, 0x58, 0xFD, 0x51, 0x30,
+    0xDB, 0x12, 0xCC, 0xBE, 0x0A, 0xD6, 0x2A, 0x8E, 0x48, 0x4B, 0xEB, 0x59, 0x10, 0x09, 0xAB, 0x0F,
+    0xEE, 0x5C, 0x20, 0x27, 0x97, 0x01, 0x89, 0xF3, 0x7F, 0x3E, 0x13, 0x94, 0x03, 0x36, 0xE0, 0x3C,
+    0x2B, 0x94, 0x77, 0x04, 0x9C, 0x58, 0x35, 0xA0, 0xBC, 0xCD, 0x60, 0x8B, 0xBC, 0xA1, 0xBC, 0x45,
+    0x60, 0x5E, 0x1D, 0xD4, 0x4C, 0x88, 0x43, 0x61, 0xB6, 0x35, 0x82, 0xBD, 0x73, 0x9F, 0x0D, 0xD3,
+    0x73, 0xA8, 0xDE, 0x46, 0x0D, 0x10, 0xD4, 0xA0, 0x42, 0x0D, 0x44, 0x50, 0xF0, 0x02, 0x00, 0xFB,
+    0x8A, 0x9C, 0x89, 0x58, 0xC9, 0xE5, 0x31, 0xD0, 0x19, 0x50, 0xC7, 0xD5, 0x00, 0xCB, 0x42, 0x4E,
+    0xD7, 0x0C, 0x7F, 0xFB, 0x18, 0x91, 0x79, 0xFF, 0xE7, 0x33, 0x21, 0xF3, 0xFE, 0xEF, 0x67, 0x41,
+    0xE6, 0xFD, 0xBF, 0xCF, 0x86, 0xCC, 0xFB, 0xFF, 0x5E, 0x1C, 0xCA, 0x2B, 0x84, 0xE4, 0x1D, 0x4D,
+    0x58, 0xC0, 0x41, 0xD2, 0x8C, 0x37, 0x4C, 0xF1, 0x31, 0x30, 0x37, 0x16, 0xC6, 0x9D, 0x0C, 0xE6,
+    0xD6, 0xC1, 0x2C, 0x4E, 0x00, 0x27, 0x4D, 0xB8, 0xC5, 0x0A, 0x2F, 0xC0, 0x89, 0x1D, 0xEE, 0x8E,
+    0xAD, 0xB0, 0x8C, 0x00, 0x01, 0x4D, 0xFF, 0x91, 0x53, 0xCA, 0x12, 0x24, 0x9E, 0xC0, 0x75, 0x24,
+    0x95, 0x0E, 0x60, 0x27, 0xAC, 0x67, 0x42, 0x72, 0x5E, 0x3F, 0x23, 0x5C, 0x0B, 0xD0, 0x76, 0x24,
+    0x2D, 0xFF, 0x63, 0x90, 0xB4, 0xFC, 0xB7, 0xC6, 0xE2, 0x23, 0x54, 0xDF, 0x62, 0x84, 0x04, 0x4A,
+    0x28, 0xA1, 0x84, 0x20, 0x4A, 0xE8, 0xA2, 0x86, 0x3C, 0x00, 0x03, 0x5B, 0x93, 0x52, 0xEE, 0xC6,
+    0x04, 0xF5, 0x4C, 0x23, 0x38, 0xDB, 0x4B, 0x10, 0x99, 0xEE, 0x40, 0x96, 0x80, 0x42, 0x6F, 0x5D,
+    0xC7, 0x2B, 0x70, 0xB2, 0x0B, 0x80, 0x66, 0xF1, 0xA7, 0xA0, 0x04, 0x74, 0x00, 0xA2, 0x18, 0x9C,
+    0x91, 0xD9, 0x3F, 0xC1, 0x82, 0x06, 0xE8, 0x20, 0x9E, 0x6F, 0xB0, 0x38, 0x01, 0x06, 0x13, 0xFF,
+    0x4F, 0x98, 0x7B, 0x80, 0xE1, 0xA8, 0xFF, 0x0B, 0xE6, 0xA6, 0x06, 0x78, 0x78, 0x41, 0xFC, 0xEB,
+    0x0F, 0xE7, 0xA0, 0xC8, 0x20, 0xC2, 0x1E, 0x62, 0x1A, 0x1F, 0x9C, 0xF3, 0x15, 0x9E, 0x9C, 0xF1,
+    0xA6, 0x3F, 0xA4, 0xA4, 0x55, 0x80, 0x94, 0xE5, 0x40, 0xC1, 0x05, 0x8B, 0x78, 0xB0, 0xAF, 0x64,
+    0x61, 0x9C, 0xCF, 0xB0, 0xF2, 0x09, 0x9A, 0x51, 0xF4, 0x60, 0x12, 0x40, 0xEF, 0xBE, 0x67, 0x42,
+    0xD2, 0x6E, 0x8F, 0x6C, 0x3B, 0x2B, 0x8C, 0xED, 0x80, 0x9C, 0x62, 0x27, 0xC0, 0xE3, 0x1C, 0xA2,
+    0x1F, 0x87, 0x57, 0x3E, 0xC0, 0x12, 0x13, 0x94, 0xC3, 0xCD, 0x40, 0x1B, 0x20, 0xF0, 0x6A, 0x3F,
+    0x13, 0xB2, 0x73, 0x10, 0x2E, 0xF8, 0x84, 0xEC, 0xD0, 0xCF, 0xC8, 0x89, 0xFF, 0x03, 0xB2, 0x47,
+    0x03, 0x10, 0x99, 0x0B, 0x08, 0x92, 0xCC, 0x20, 0x34, 0x00, 0x6D, 0x56, 0x41, 0x4B, 0x1B, 0x41,
+    0x14, 0xDE, 0x24, 0x9A, 0xC6, 0x60, 0xCC, 0x52, 0xE8, 0xD9, 0xF5, 0x2A, 0x04, 0x73, 0x13, 0x3C,
+    0x79, 0xEA, 0xD1, 0xFA, 0x0F, 0x14, 0x7A, 0x0B, 0x14, 0x8A, 0x78, 0x92, 0xD2, 0xA0, 0x7F, 0xA0,
+    0x39, 0x79, 0xF1, 0x62, 0xE9, 0xA5, 0xA0, 0x58, 0xC1, 0x9B, 0x50, 0xD6, 0x83, 0x87, 0xD2, 0x83,
+    0x11, 0x7A, 0xEC, 0x61, 0x73, 0x6D, 0xA1, 0x5D, 0x35, 0xAD, 0xD1, 0x98, 0xCD, 0xF4, 0xCD, 0xBC,
+    0xEF, 0xED, 0xCC, 0x6E, 0x7D, 0x87, 0x64, 0x99, 0x99, 0x9D, 0x37, 0xF3, 0xBD, 0xEF, 0xFB, 0xDE,
+    0xDA, 0xD8, 0xFC, 0x3A, 0x56, 0xF1, 0xE1, 0xA2, 0x97, 0x8F, 0xE5, 0xA1, 0x18, 0xC3, 0x44, 0x76,
+    0x62, 0x3D, 0x49, 0x29, 0x16, 0x4D, 0x66, 0xDE, 0x48, 0x1C, 0x61, 0x76, 0x4B, 0xCE, 0x8C, 0x66,
+    0xFA, 0xD1, 0xF3, 0xA7, 0xDE, 0xDC, 0xE6, 0x4F, 0x95, 0xDE, 0x52, 0xFC, 0x67, 0xC9, 0x51, 0x57,
+    0x55, 0x26, 0xB4, 0x0B, 0xCC, 0xA7, 0xCB, 0xB6, 0x1D, 0xEE, 0x90, 0x60, 0x57, 0x9C, 0xAD, 0xBF,
+    0x59, 0xFA, 0x26, 0xAA, 0xEB, 0x5E, 0x8C, 0xEA, 0x0B, 0x64, 0x8F, 0x05, 0x15, 0x89, 0x33, 0x81,
+    0x60, 0x90, 0x15, 0xB8, 0xD9, 0xA4, 0x0A, 0x42, 0xCC, 0xE4, 0x00, 0xE9, 0x73, 0x25, 0x8F, 0x1D,
+    0x4E, 0xA7, 0xF4, 0x0D, 0x99, 0xA3, 0xEF, 0xF2, 0x20, 0xFA, 0x5C, 0xBA, 0x91, 0x6C, 0xD6, 0xFC,
+    0x32, 0x8E, 0x5A, 0xC2, 0xDA, 0x8A, 0xA9, 0x39, 0x17, 0x2E, 0x30, 0x68, 0xBF, 0x45, 0xA2, 0x9A,
+    0x4E, 0x13, 0x67, 0xEC, 0xA3, 0xC1, 0x44, 0x5B, 0xD0, 0xC5, 0x6E, 0x3B, 0x46, 0x02, 0x0E, 0x77,
+    0x34, 0x31, 0x6F, 0x41, 0x48, 0x62, 0xCE, 0xAB, 0x62, 0x30, 0xE0, 0x99, 0x55, 0x0D, 0xDD, 0x88,
+    0x69, 0x49, 0x02, 0xFB, 0x64, 0x98, 0x1B, 0xF3, 0x1D, 0x23, 0x7D, 0xC0, 0x32, 0xC8, 0x5C, 0x35,
+    0x97, 0xEB, 0x42, 0xCE, 0x7A, 0xFB, 0x22, 0x9F, 0x26, 0xE2, 0xD4, 0x21, 0x34, 0x50, 0xEC, 0x40,
+    0x36, 0x23, 0xE6, 0x70, 0x0F, 0xCA, 0x7C, 0x50, 0xA5, 0x33, 0x5E, 0x14, 0x00, 0xEF, 0x2B, 0x00,
+    0x32, 0x54, 0x93, 0x78, 0xEC, 0x80, 0x96, 0xD7, 0xD0, 0xD1, 0x9D, 0x2A, 0xE3, 0xB1, 0x87, 0xFB,
+    0xF6, 0x51, 0xB4, 0x7B, 0x55, 0xEE, 0xF3, 0xFE, 0x7D, 0x64, 0xFE, 0x03, 0x25, 0xDD, 0xAB, 0x27,
+    0x78, 0x1C, 0x00, 0x89, 0x5B, 0xF8, 0x04, 0xBD, 0x03, 0x08, 0x86, 0x58, 0x3B, 0x80, 0x72, 0xCD,
+    0x4C, 0x9D, 0xCF, 0x3F, 0x8B, 0x91, 0xBA, 0x9C, 0x0D, 0x8B, 0xA4, 0xE2, 0x43, 0x78, 0x10, 0xDD,
+    0x87, 0x67, 0x7C, 0x11, 0x35, 0x50, 0xA4, 0x3D, 0x0A, 0xB9, 0x19, 0x30, 0xD7, 0xA7, 0x4B, 0x70,
+    0x9E, 0xC0, 0x36, 0x8A, 0x29, 0x16, 0x77, 0x48, 0x9A, 0x5C, 0xE0, 0x99, 0x69, 0x80, 0x54, 0x61,
+    0x48, 0xDA, 0xB8, 0x9A, 0x8F, 0x13, 0xEC, 0xC3, 0xBA, 0x7A, 0xB4, 0xFE, 0x86, 0xE1, 0x80, 0xD5,
+    0x88, 0x8B, 0xFD, 0xA5, 0x2D, 0xAE, 0xF8, 0xF2, 0x23, 0xF9, 0xE3, 0x3C, 0x09, 0xE1, 0x7B, 0xC9,
+    0x62, 0xB9, 0x33, 0x76, 0xAD, 0xAD, 0xB5, 0x66, 0xD2, 0x44, 0xFA, 0x27, 0x86, 0x15, 0x35, 0xBC,
+    0x40, 0xDB, 0xDF, 0x9A, 0x59, 0xF7, 0xC2, 0xD8, 0x66, 0x89, 0x85, 0xA1, 0x3E, 0x53, 0x37, 0xD7,
+    0x2D, 0xDC, 0x3B, 0x37, 0xD9, 0x7C, 0x3E, 0x4D, 0x93, 0xB9, 0x36, 0xBD, 0xCF, 0x1D, 0x2F, 0xE4,
+    0xA4, 0x35, 0x78, 0x0D, 0x0D, 0x14, 0xFC, 0x24, 0xED, 0x56, 0x84, 0xBB, 0x29, 0x5D, 0x93, 0x86,
+    0x62, 0x7A, 0xFB, 0xBD, 0xFD, 0x06, 0xB8, 0x46, 0x35, 0x97, 0x3F, 0xEE, 0x19, 0x26, 0x6C, 0x9C,
+    0x1E, 0x2C, 0xA6, 0x4D, 0x60, 0xC2, 0x7B, 0x34, 0x1E, 0x11, 0x63, 0xDA, 0x48, 0x6C, 0x5B, 0xC8,
+    0x45, 0xCF, 0x3A, 0x7E, 0x2E, 0x9A, 0x19, 0x0B, 0xCA, 0x84, 0x6D, 0x86, 0xF9, 0x78, 0x2D, 0xDD,
+    0xD6, 0x44, 0xC6, 0x67, 0x48, 0x68, 0xA1, 0x4C, 0x7D, 0xA8, 0x67, 0x1C, 0x91, 0x90, 0x8A, 0x5B,
+    0x5A, 0x46, 0x2F, 0x7F, 0x88, 0x19, 0x21, 0x0C, 0x24, 0xEA, 0xF7, 0x2F, 0xE7, 0xD3, 0x4B, 0xE2,
+    0xC4, 0xBA, 0x68, 0xFE, 0x9C, 0x3B, 0xF2, 0xB1, 0xF1, 0xA6, 0xF0, 0x1F, 0x48, 0xBB, 0xDF, 0xC7,
+    0xEA, 0x62, 0xEB, 0x99, 0x1D, 0xF9, 0x07, 0x5D, 0x94, 0xDB, 0x0D, 0x82, 0x40, 0x10, 0x45, 0xF1,
+    0x99, 0x18, 0x1F, 0xB1, 0x03, 0xEC, 0xC0, 0x16, 0xE8, 0xC0, 0x12, 0x68, 0xC1, 0x0E, 0xA4, 0x03,
+    0xED, 0x40, 0x3A, 0xD0, 0x0E, 0x2C, 0x41, 0x3B, 0xD0, 0x0E, 0xD4, 0x10, 0x0D, 0x7C, 0x20, 0xB2,
+    0x8F, 0xB9, 0x73, 0x97, 0xFB, 0x05, 0x43, 0x80, 0xDD, 0x3D, 0x67, 0x26, 0xD2, 0xDD, 0xA5, 0x51,
+    0x37, 0x87, 0x06, 0xBB, 0xD7, 0xBC, 0x1A, 0x7E, 0xCF, 0xE7, 0x43, 0xBA, 0x46, 0xCC, 0x67, 0xDE,
+    0xA9, 0x2D, 0xC5, 0x40, 0x4E, 0x46, 0x73, 0x87, 0xA9, 0xD7, 0xE0, 0x42, 0xF8, 0x0B, 0x00, 0x52,
+    0xEE, 0xD7, 0x5C, 0xCE, 0x1B, 0x69, 0x09, 0x25, 0xE4, 0x8D, 0x38, 0x11, 0xB7, 0x2E, 0xEE, 0x83,
+    0xA2, 0x3D, 0xAA, 0x0A, 0x82, 0xC3, 0x8D, 0x91, 0x21, 0x35, 0xE4, 0x62, 0x69, 0x96, 0x73, 0x03,
+    0x3E, 0x51, 0xFB, 0x68, 0x81, 0xC4, 0x54, 0x4B, 0x2C, 0xEC, 0x25, 0x38, 0x8A, 0x26, 0x0B, 0x8B,
+    0xEC, 0x4E, 0xC5, 0xB7, 0xD3, 0xF1, 0x4B, 0xFD, 0x61, 0xEF, 0xFA, 0x5E, 0x57, 0x2D, 0xD6, 0xCE,
+    0xF4, 0x1C, 0x8A, 0x39, 0x68, 0x3B, 0xFF, 0xBF, 0x94, 0xA1, 0xC5, 0x7E, 0x65, 0x0A, 0xEF, 0x21,
+    0x3E, 0x54, 0x04, 0x0F, 0x6E, 0x50, 0x8F, 0x18, 0x68, 0x38, 0xFF, 0xB9, 0x42, 0xF3, 0x74, 0xB6,
+    0xD0, 0xD8, 0x5C, 0x6E, 0xD0, 0x34, 0x27, 0x85, 0x66, 0x07, 0x4D, 0x1B, 0x6D, 0xAA, 0x22, 0x98,
+    0xD4, 0x63, 0xC8, 0x4F, 0x99, 0xF1, 0xF4, 0x90, 0xAC, 0x69, 0x4E, 0x22, 0x7B, 0x69, 0xA7, 0x98,
+    0x10, 0x3C, 0x05, 0xDA, 0x14, 0xC5, 0xCA, 0xC3, 0x2B, 0x59, 0x17, 0xE9, 0xBD, 0x1F, 0x8B, 0x75,
+    0x73, 0xDF, 0x4A, 0x02, 0x05, 0x33, 0x77, 0xB4, 0x79, 0x20, 0xEB, 0xCA, 0x75, 0xE2, 0x8B, 0x19,
+    0xD8, 0xB6, 0x1C, 0xF0, 0xF8, 0x14, 0x86, 0x13, 0x79, 0xC4, 0xB4, 0x17, 0xF2, 0x11, 0xE4, 0x6C,
+    0xE0, 0x65, 0xA1, 0x2B, 0x66, 0xD3, 0x17, 0x03, 0x6D, 0xDD, 0x71, 0xBA, 0xE9, 0xFD, 0x01, 0x5D,
+    0x94, 0x3D, 0x0A, 0xC2, 0x40, 0x10, 0x85, 0x8D, 0xF8, 0x87, 0xB1, 0xF0, 0x02, 0x69, 0xBD, 0x86,
+    0x96, 0x96, 0x5E, 0x41, 0x6C, 0x2D, 0x72, 0x03, 0x2D, 0xEC, 0xE3, 0x01, 0x44, 0x10, 0xBC, 0x46,
+    0xC0, 0x1B, 0xE4, 0x06, 0x82, 0x78, 0x00, 0xC1, 0x90, 0x4A, 0x31, 0xEE, 0x1B, 0xD8, 0xDD, 0x37,
+    0x93, 0xEE, 0x83, 0x65, 0x76, 0xF2, 0xED, 0x9B, 0xF1, 0x41, 0xB8, 0x9F, 0x66, 0xFE, 0x0E, 0xFF,
+    0x6D, 0x0D, 0x4B, 0x3E, 0x99, 0x51, 0x50, 0xCD, 0xDC, 0x9C, 0x7A, 0x3C, 0xB4, 0xD2, 0x76, 0xE0,
+    0xCE, 0x45, 0xCC, 0x46, 0x86, 0xF6, 0x09, 0xF3, 0x1B, 0x1E, 0x89, 0x6F, 0x70, 0x43, 0x7C, 0x84,
+    0x21, 0xE2, 0x3D, 0x3C, 0x11, 0xE7, 0x86, 0xED, 0x79, 0x89, 0x11, 0x71, 0x83, 0x90, 0x45, 0xC6,
+    0xBE, 0xE9, 0x13, 0x3F, 0x65, 0xC6, 0x02, 0x5F, 0x5D, 0xFB, 0x99, 0x70, 0x98, 0xF3, 0x2A, 0xD1,
+    0x3E, 0x46, 0xDA, 0x4F, 0x91, 0x18, 0x5F, 0x85, 0xF5, 0x97, 0xC5, 0xFA, 0xD3, 0xCD, 0x47, 0x16,
+    0x5F, 0xBC, 0x1F, 0x2B, 0x2E, 0xE5, 0x7E, 0x1F, 0xE6, 0x7F, 0x16, 0x08, 0x3F, 0x31, 0x62, 0xD9,
+    0x65, 0x76, 0x0F, 0x3C, 0x60, 0xC6, 0x84, 0x33, 0xBB, 0x60, 0x8D, 0x99, 0x6B, 0xC3, 0x8D, 0x39,
+    0xEF, 0xEA, 0x0D, 0xCD, 0x7D, 0x3D, 0x62, 0x4C, 0x1C, 0xF7, 0x53, 0x63, 0xD0, 0x23, 0xAF, 0x7E,
+    0xCA, 0xFF, 0xFA, 0x2B, 0x21, 0x56, 0x9B, 0xA9, 0x32, 0x7E, 0x52, 0xCD, 0x3B, 0xED, 0xEF, 0xCC,
+    0x7E, 0x5F, 0xE5, 0x52, 0xCA, 0xFE, 0x01, 0x83, 0x02, 0xC3, 0xB2, 0xF2, 0x30, 0x26, 0xA4, 0x14,
+    0xAE, 0x70, 0x02, 0x1C, 0x8F, 0xD1, 0x08, 0x81, 0x5F, 0xD0, 0x04, 0x53, 0x07, 0x13, 0xF9, 0x0E,
+    0x4F, 0x60, 0x3A, 0x0C, 0x30, 0x2F, 0xFE, 0x47, 0xCE, 0x70, 0x90, 0x54, 0x76, 0x3E, 0x23, 0x6D,
+    0x3A, 0x28, 0xBC, 0xF4, 0x61, 0x4A, 0xEA, 0x41, 0x96, 0x1A, 0xFC, 0x86, 0x26, 0x29, 0xA0, 0x29,
+    0xE7, 0x51, 0x3C, 0x05, 0x8A, 0x01, 0x1E, 0x84, 0x15, 0xD0, 0x12, 0x01, 0x66, 0xE9, 0x06, 0x70,
+    0xF4, 0x7F, 0x82, 0x07, 0x26, 0x24, 0x5A, 0xC0, 0x41, 0xC9, 0x05, 0x77, 0xEB, 0x1F, 0x90, 0x9F,
+    0xFF, 0xC1, 0x02, 0x0B, 0xEA, 0x79, 0x4E, 0x07, 0x94, 0xB4, 0x02, 0x34, 0x82, 0xB7, 0x01, 0x1E,
+    0xD0, 0xD0, 0xD4, 0xC1, 0x7F, 0x00, 0xC9, 0x60, 0x60, 0x12, 0xEA, 0xE8, 0xE0, 0xF8, 0x00, 0x8B,
+    0x73, 0x38, 0xF8, 0x88, 0x92, 0x36, 0xA1, 0x66, 0x71, 0xA3, 0x8A, 0x7C, 0xC1, 0x26, 0xC2, 0x85,
+    0x21, 0xC2, 0x89, 0x2A, 0xF2, 0x95, 0x2C, 0x91, 0x2F, 0xD8, 0x44, 0xB8, 0x08, 0xB9, 0x07, 0xD3,
+    0xCD, 0x98, 0xFE, 0xC2, 0xF4, 0x3B, 0x66, 0xF8, 0x60, 0x86, 0x21, 0x6A, 0x38, 0x7F, 0x06, 0x99,
+    0xFA, 0x1F, 0x39, 0x2E, 0xBE, 0x83, 0xDC, 0xFB, 0x13, 0xD9, 0xD1, 0x7F, 0x41, 0x49, 0xF3, 0x33,
+    0x52, 0x26, 0x37, 0x00, 0x27, 0x8E, 0x0D, 0x48, 0x06, 0x6D, 0x00, 0x97, 0x29, 0x0A, 0xFF, 0x11,
+    0x3E, 0xFB, 0x0E, 0xC9, 0x75, 0x3F, 0xE0, 0xA5, 0x49, 0x01, 0xB4, 0xC4, 0x04, 0xA5, 0xB1, 0x58,
+    0x06, 0x68, 0x1A, 0x3B, 0x0F, 0xAF, 0xCA, 0xD6, 0x85, 0xA7, 0x2E, 0x07, 0x95, 0x6B, 0x72, 0xE8,
+    0xF5, 0xDD, 0x7D, 0xA8, 0xD3, 0x10, 0x25, 0xB6, 0x14, 0xCC, 0x19, 0x7F, 0xD0, 0x6A, 0x2D, 0xA0,
+    0xD0, 0x4B, 0x70, 0xF2, 0xF6, 0x44, 0x0E, 0x14, 0xA7, 0xB2, 0x72, 0x37, 0x68, 0x46, 0x02, 0x00,
+    0x83, 0x26, 0x84, 0x7B, 0xDD, 0x2C, 0x50, 0xDF, 0xC0, 0x53, 0xC6, 0x7F, 0x2B, 0x74, 0x01, 0x68,
+    0x02, 0x45, 0x12, 0x80, 0x84, 0x25, 0x50, 0xE0, 0x3D, 0x2C, 0xDB, 0x9D, 0x67, 0x44, 0x38, 0x54,
+    0xA0, 0x05, 0x94, 0x90, 0x64, 0x91, 0x5D, 0x1E, 0xF0, 0x17, 0x12, 0x63, 0x70, 0x01, 0x70, 0x94,
+    0x73, 0x21, 0x0B, 0x80, 0xDC, 0xE5, 0x8F, 0x22, 0xB0, 0x00, 0x1C, 0x00, 0x48, 0x02, 0xA0, 0xF4,
+    0xC1, 0x86, 0x2C, 0x00, 0xF2, 0x26, 0x2F, 0x8A, 0xC0, 0x05, 0x50, 0x78, 0x23, 0x0B, 0x14, 0x80,
+    0x52, 0x25, 0xB2, 0x80, 0x00, 0xC8, 0x54, 0x64, 0x01, 0x50, 0x2A, 0x45, 0x15, 0x00, 0x26, 0x0C,
+    0x16, 0x14, 0x01, 0x60, 0xD8, 0xB1, 0xA1, 0x08, 0x00, 0x43, 0x95, 0x1D, 0x45, 0x00, 0xE8, 0x10,
+    0x0E, 0x14, 0x01, 0x60, 0xEC, 0x71, 0x12, 0x14, 0xE0, 0x22, 0x51, 0xCB, 0x57, 0x74, 0x81, 0x6F,
+    0xE8, 0xD6, 0xFE, 0x40, 0x77, 0xE9, 0x2F, 0x74, 0xBF, 0x00, 0x7D, 0xCB, 0x88, 0x2C, 0xA0, 0x80,
+    0x1E, 0x1E, 0x0D, 0xE8, 0x21, 0xF6, 0x00, 0x3D, 0x4C, 0xBF, 0xA1, 0x85, 0x3A, 0x46, 0xBC, 0x6C,
+    0x40, 0x8F, 0xB9, 0x5F, 0xE0, 0x54, 0x8E, 0x10, 0xD8, 0x88, 0x16, 0xFB, 0x09, 0xFF, 0x50, 0xD2,
+    0x87, 0xC0, 0x14, 0xA4, 0x14, 0x04, 0x2C, 0xC1, 0xDE, 0xA2, 0xA4, 0x31, 0x8C, 0x54, 0x08, 0x03,
+    0xDA, 0xA8, 0xE9, 0xF4, 0xBD, 0x25, 0x4A, 0x4A, 0x3E, 0x57, 0x05, 0x2B, 0x6E, 0x00, 0xFB, 0x83,
+    0x92, 0x8B, 0x58, 0x49, 0xE5, 0xBE, 0x7F, 0x07, 0x07, 0x2C, 0x70, 0xE7, 0x31, 0xA0, 0xBA, 0x76,
+    0x48, 0x73, 0xC1, 0xD9, 0x06, 0x04, 0x72, 0x19, 0x50, 0xC2, 0xAA, 0x9F, 0x74, 0xEE, 0xF0, 0x0B,
+    0x1C, 0x22, 0x83, 0xEE, 0xEE, 0x5D, 0x0E, 0xD4, 0x94, 0xC3, 0x45, 0x12, 0x17, 0x00, 0xFB, 0x83,
+    0x92, 0x8B, 0x48, 0xE2, 0xBD, 0x7F, 0x07, 0x03, 0xF7, 0xE0, 0x2E, 0x43, 0x75, 0xE7, 0xD0, 0xE6,
+    0x81, 0x73, 0x0C, 0x08, 0xF0, 0xA0, 0x84, 0x12, 0x1F, 0x69, 0xBC, 0xE1, 0x17, 0x2E, 0x54, 0xE0,
+    0x01, 0x00, 0x83, 0x02, 0xC7, 0xB2, 0xF2, 0x30, 0x66, 0xA4, 0x14, 0x6E, 0x70, 0x13, 0x1C, 0x8F,
+    0x35, 0x70, 0x05, 0x0E, 0x7F, 0xD0, 0x52, 0x33, 0x34, 0x25, 0x20, 0xB2, 0x24, 0xC3, 0x25, 0xA4,
+    0xEC, 0xC8, 0x0E, 0x4F, 0x47, 0xE7, 0x33, 0xD2, 0xA6, 0xFF, 0x85, 0xA6, 0x49, 0x50, 0x00, 0xFD,
+    0xAF, 0x07, 0x19, 0x60, 0xF0, 0x1B, 0x1A, 0xEB, 0xC0, 0x30, 0x38, 0xCF, 0x04, 0x8F, 0x30, 0x3E,
+    0x48, 0x30, 0x73, 0x43, 0xAD, 0xF8, 0x0A, 0xD6, 0x76, 0x00, 0xE6, 0x7F, 0x48, 0x9C, 0xBC, 0x07,
+    0x07, 0xA1, 0x3D, 0xDC, 0xA9, 0xFF, 0x40, 0x3E, 0xFC, 0x09, 0x0F, 0x54, 0x88, 0xC7, 0xB8, 0x50,
+    0x92, 0x1C, 0x28, 0xAA, 0xF9, 0x0C, 0x10, 0x89, 0x18, 0x12, 0x41, 0xF2, 0x05, 0x48, 0x69, 0x09,
+    0x18, 0x01, 0x1D, 0x1D, 0x1A, 0x1B, 0xE0, 0x91, 0x80, 0x2D, 0xED, 0xC1, 0x53, 0x11, 0x3F, 0xAA,
+    0xC8, 0x47, 0x78, 0xB4, 0x23, 0xD9, 0xC7, 0x8B, 0x2A, 0xF2, 0x19, 0x96, 0x20, 0x90, 0x45, 0xB8,
+    0x51, 0x45, 0xBE, 0xE0, 0x16, 0x39, 0x70, 0x06, 0x02, 0x6C, 0xE0, 0x22, 0x1F, 0xA0, 0x21, 0xED,
+    0xFF, 0x19, 0x9B, 0x08, 0x0F, 0xAA, 0x08, 0xDC, 0x3D, 0x70, 0x11, 0x54, 0x37, 0x03, 0xF3, 0x9D,
+    0xFF, 0x07, 0x78, 0x32, 0x86, 0x89, 0x1C, 0x80, 0x27, 0x4E, 0x98, 0xC8, 0x04, 0x78, 0xD2, 0x84,
+    0x89, 0x24, 0xA0, 0xE4, 0x40, 0x90, 0x88, 0xC0, 0x7F, 0x58, 0x32, 0x85, 0x89, 0x80, 0x12, 0x2E,
+    0x07, 0xAA, 0xC8, 0x57, 0x64, 0xCB, 0xC0, 0x22, 0x0F, 0xFE, 0xC3, 0x73, 0x1A, 0x54, 0x24, 0x01,
+    0x91, 0x15, 0xA1, 0x22, 0x20, 0x83, 0xE0, 0xF1, 0x03, 0x71, 0xDD, 0xA7, 0xFF, 0x70, 0xB3, 0x15,
+    0xFE, 0x80, 0x45, 0x40, 0xE5, 0xEA, 0x7D, 0x48, 0x19, 0x0E, 0x2A, 0x58, 0x79, 0x20, 0x69, 0xFF,
+    0xFF, 0xFB, 0xAA, 0xD0, 0xD4, 0xE5, 0xA0, 0x84, 0x08, 0xAE, 0x5D, 0x02, 0x90, 0xEB, 0x0E, 0x19,
+    0x94, 0x2A, 0x0A, 0xA9, 0xF8, 0xBA, 0x06, 0x2F, 0xC2, 0xE1, 0x1E, 0x5A, 0x02, 0x29, 0xE5, 0xB3,
+    0x19, 0x11, 0x9E, 0x56, 0x48, 0x29, 0x2F, 0x77, 0x85, 0x28, 0x00, 0x00, 0x83, 0x9B, 0x09, 0x0B,
+    0x5D, 0xAE, 0x51, 0x11, 0xAA, 0x88, 0x80, 0xF3, 0x1B, 0x04, 0xFC, 0x87, 0x88, 0xA0, 0x02, 0xF2,
+    0x45, 0x46, 0xC3, 0x79, 0x40, 0x44, 0x00, 0x03, 0xC5, 0xFA, 0x50, 0xC3, 0x00, 0x43, 0x02, 0x1F,
+    0xE0, 0xAE, 0x1F, 0xE5, 0x0E, 0x1B, 0xEE, 0x57, 0x78, 0xAE, 0x06, 0x71, 0x79, 0xBF, 0xC0, 0x13,
+    0x1F, 0x28, 0xAD, 0xF0, 0x7C, 0x86, 0x25, 0x53, 0x70, 0x2A, 0xE3, 0xFA, 0x00, 0x4B, 0xE0, 0xE0,
+    0xB4, 0xC9, 0x71, 0x01, 0x9E, 0xCA, 0x05, 0x40, 0x79, 0xB4, 0x01, 0x9E, 0xEF, 0x17, 0x80, 0xCA,
+    0x03, 0x01, 0x78, 0xAE, 0xFF, 0x0E, 0x4E, 0xB0, 0x40, 0x1D, 0xEF, 0x41, 0x29, 0x6C, 0xD3, 0x7F,
+    0x70, 0xE6, 0xBD, 0x00, 0x2A, 0x26, 0x2A, 0x53, 0x4F, 0xFC, 0x87, 0x64, 0x6F, 0x05, 0x44, 0x81,
+    0x0D, 0x4E, 0xE6, 0x97, 0xE0, 0x5C, 0x16, 0x58, 0x62, 0x44, 0x2A, 0x9C, 0x19, 0x04, 0x8E, 0x83,
+    0x8B, 0x35, 0x4D, 0xB8, 0x5F, 0x0C, 0x4A, 0xCB, 0xDD, 0x20, 0x89, 0x1F, 0x00, 0x7D, 0xD4, 0xDD,
+    0x09, 0xC2, 0x50, 0x0C, 0x05, 0x60, 0x28, 0x15, 0x04, 0xEB, 0x08, 0x8A, 0x1B, 0x38, 0x82, 0x3B,
+    0xB8, 0x40, 0x47, 0xB0, 0x23, 0x74, 0x93, 0x3A, 0xC2, 0x5D, 0xC5, 0x49, 0x7C, 0xA8, 0x15, 0x8A,
+    0xA5, 0x57, 0x93, 0x9B, 0x9F, 0x93, 0x17, 0x9F, 0x0A, 0xDF, 0x43, 0x6F, 0x48, 0x4E, 0x62, 0xFF,
+    0x94, 0x96, 0xED, 0x82, 0x4C, 0xDC, 0x5F, 0x10, 0x6A, 0xC2, 0x21, 0xC8, 0x6F, 0x6F, 0x9E, 0x15,
+    0x0A, 0x0D, 0xEF, 0x82, 0xD5, 0x52, 0x5B, 0xF8, 0x6D, 0x97, 0x45, 0xFA, 0x67, 0x72, 0x97, 0x78,
+    0xBB, 0xCC, 0x1A, 0x13, 0x95, 0xCE, 0x76, 0x4E, 0x65, 0xB2, 0xE9, 0x8B, 0x50, 0xE6, 0x8F, 0x41,
+    0xC6, 0x52, 0x9D, 0xCB, 0x69, 0xB5, 0x41, 0x88, 0x3C, 0x74, 0xE5, 0x4D, 0x16, 0x98, 0x2E, 0x4B,
+    0xCA, 0x9E, 0x9A, 0x22, 0x33, 0x86, 0x98, 0xA4, 0xB7, 0xEA, 0x54, 0xDE, 0x9E, 0xAA, 0x22, 0xD7,
+    0x9C, 0x75, 0x4E, 0x22, 0x7C, 0x45, 0x1B, 0x94, 0xB8, 0x3D, 0xBE, 0xA6, 0x75, 0x90, 0x76, 0xB5,
+    0xA3, 0x29, 0x52, 0xBF, 0x60, 0x13, 0x16, 0x5E, 0xF2, 0x3E, 0xDB, 0x42, 0xB3, 0x6C, 0xF8, 0xD3,
+    0xBA, 0xB4, 0xE5, 0x6C, 0xC3, 0x4C, 0xB6, 0xD2, 0xC3, 0x26, 0xF4, 0x90, 0x82, 0x32, 0x44, 0x49,
+    0xD6, 0x33, 0x15, 0x9A, 0xFA, 0x39, 0xA6, 0xF4, 0x6F, 0x6E, 0xF5, 0xD5, 0x8F, 0x94, 0xE4, 0xA2,
+    0x25, 0xB9, 0x50, 0xE8, 0xF6, 0x41, 0x28, 0xC4, 0x43, 0x94, 0x54, 0x16, 0x17, 0x44, 0x4A, 0xC2,
+    0x3C, 0x8F, 0x5C, 0x12, 0x4A, 0xC7, 0xC7, 0x0F, 0x85, 0xCE, 0xC8, 0x2D, 0x0A, 0x05, 0xB8, 0xFA,
+    0x02, 0x83, 0x9B, 0x89, 0x6A, 0xC3, 0x28, 0x6F, 0x94, 0x87, 0x8B, 0x07, 0x2E, 0x49, 0xC0, 0xC0,
+    0xF7, 0x0F, 0x72, 0x11, 0x1C, 0x4F, 0x3C, 0x0F, 0x00, 0x65, 0xD4, 0xC1, 0x6D, 0xC2, 0x40, 0x10,
+    0x85, 0xE1, 0xE5, 0x92, 0x03, 0x8A, 0x23, 0x4A, 0xA1, 0x03, 0x5A, 0xA1, 0x04, 0xEA, 0xC9, 0xC5,
+    0x7B, 0xC8, 0xDD, 0x74, 0x80, 0x3B, 0x48, 0x3A, 0x80, 0x0E, 0x82, 0x93, 0x28, 0x51, 0x14, 0xAC,
+    0x65, 0xE7, 0xCD, 0xCE, 0xCE, 0x5B, 0x87, 0x1B, 0x9F, 0x80, 0x5F, 0xC2, 0x33, 0x73, 0x4B, 0xF6,
+    0x5D, 0x7B, 0xE5, 0xDF, 0x48, 0x8F, 0x37, 0xFF, 0x1B, 0xCA, 0xEB, 0xC7, 0xB8, 0x6B, 0x78, 0x36,
+    0xDE, 0xB1, 0x62, 0xF8, 0xC0, 0x03, 0x73, 0xAC, 0xDC, 0x34, 0x27, 0xE7, 0x87, 0x45, 0xB1, 0x70,
+    0xB7, 0x28, 0x16, 0xDE, 0x2D, 0x8A, 0xC2, 0x43, 0xD3, 0x94, 0x61, 0x03, 0xF7, 0x7F, 0xDC, 0xCC,
+    0xC5, 0x67, 0xFD, 0xF4, 0x17, 0x37, 0x73, 0xF1, 0x45, 0xF9, 0xC2, 0xCD, 0x39, 0x9D, 0x23, 0xF8,
+    0x74, 0xA0, 0xA6, 0x3C, 0xA6, 0xA3, 0xF2, 0x86, 0x9A, 0x32, 0x0D, 0x85, 0x65, 0x20, 0x57, 0x5E,
+    0x5C, 0x8F, 0xE0, 0xD7, 0x40, 0x4D, 0x79, 0x18, 0xC6, 0x6F, 0xDE, 0xCC, 0x45, 0x79, 0x9B, 0xF9,
+    0x1C, 0xBC, 0xB9, 0x95, 0xA9, 0x33, 0xF6, 0x26, 0xE6, 0xEF, 0x02, 0x7E, 0x0F, 0xDE, 0x94, 0xA2,
+    0x73, 0x6D, 0xE2, 0xF1, 0x5F, 0xF5, 0x1F, 0x0C, 0xDE, 0x94, 0xA2, 0xB3, 0x35, 0x51, 0x74, 0xB6,
+    0x66, 0xC4, 0x22, 0x54, 0xB6, 0xE6, 0x84, 0xA9, 0x9C, 0x94, 0x57, 0x7A, 0xFF, 0xEB, 0xC0, 0x39,
+    0x97, 0xE6, 0x8C, 0xD5, 0xFD, 0xA8, 0xBC, 0x47, 0x53, 0x8B, 0xC4, 0x1B, 0x2C, 0xBC, 0x16, 0x89,
+    0xB5, 0xA9, 0x45, 0x66, 0x34, 0xBF, 0x75, 0x51, 0x88, 0xD1, 0xD4, 0x22, 0xB3, 0x34, 0xB7, 0x65,
+    0xF1, 0x88, 0xF3, 0x15, 0xEB, 0x63, 0xD9, 0x65, 0xE6, 0xBC, 0xB0, 0x76, 0x3F, 0x98, 0x73, 0xD3,
+    0x56, 0x93, 0x79, 0xF4, 0xF3, 0xC4, 0x2C, 0x87, 0xA9, 0xAC, 0x3A, 0x33, 0x2E, 0xE7, 0xD3, 0x7F,
+    0xFE, 0x4D, 0x76, 0xB1, 0x1A, 0xFE, 0x4C, 0x76, 0x0C, 0x1A, 0x1E, 0x93, 0xDD, 0xAB, 0x86, 0xF7,
+    0xF5, 0xB8, 0x34, 0x1C, 0xEA, 0xBD, 0x12, 0xBE, 0x03, 0x65, 0xD4, 0x4D, 0x0D, 0xC2, 0x40, 0x10,
+    0x05, 0xE0, 0x84, 0x63, 0x29, 0x09, 0x0A, 0xC0, 0x42, 0x25, 0xE0, 0x00, 0x09, 0x24, 0x18, 0x00,
+    0x09, 0x48, 0x40, 0x42, 0x1D, 0x80, 0x03, 0x24, 0x50, 0x09, 0x38, 0x20, 0xA1, 0x3D, 0x2E, 0x29,
+    0xBC, 0xDD, 0x99, 0xD9, 0x79, 0x99, 0xEB, 0x97, 0xBC, 0x66, 0x3B, 0x7F, 0xA9, 0x96, 0x47, 0xDE,
+    0x96, 0x5C, 0xB5, 0x4D, 0x9E, 0x41, 0xB4, 0x4A, 0x4E, 0xB6, 0x41, 0x1E, 0x41, 0xE4, 0x35, 0x5E,
+    0x36, 0x41, 0x6E, 0x41, 0x2C, 0x26, 0xF2, 0xAD, 0x31, 0x11, 0x37, 0x18, 0x22, 0xC7, 0x59, 0x7F,
+    0x59, 0x65, 0x91, 0xAC, 0x41, 0x2A, 0x1F, 0x8B, 0xA9, 0x9C, 0x6D, 0x1E, 0x55, 0xD0, 0xEF, 0x15,
+    0xCB, 0xA8, 0x33, 0x6E, 0x72, 0xD1, 0x98, 0x09, 0x62, 0x2D, 0xCB, 0x28, 0xAD, 0xAD, 0x72, 0x2D,
+    0x0B, 0xEA, 0x04, 0xCB, 0xD2, 0xB2, 0x4C, 0x65, 0xDC, 0x9C, 0xF4, 0xB3, 0x7E, 0x4F, 0x05, 0x3B,
+    0xB3, 0x24, 0x41, 0xEF, 0x4F, 0x2C, 0x7D, 0x5E, 0x5D, 0x2F, 0xEB, 0x7C, 0x65, 0xBD, 0x60, 0x52,
+    0x0E, 0x2C, 0x77, 0xC4, 0x48, 0xB0, 0x27, 0x0D, 0x09, 0x62, 0x7B, 0x96, 0xFF, 0x10, 0xBE, 0x27,
+    0x12, 0xC4, 0x12, 0x09, 0xC6, 0x71, 0x66, 0x19, 0x82, 0x74, 0x41, 0xCA, 0x7D, 0x25, 0x19, 0x82,
+    0x74, 0x41, 0xF2, 0xA9, 0x65, 0x79, 0x05, 0xD9, 0x05, 0xC1, 0x65, 0x69, 0x7E, 0x8D, 0x95, 0x3D,
+    0x0A, 0xC2, 0x40, 0x10, 0x85, 0x31, 0x4A, 0x24, 0x31, 0x82, 0x27, 0xD0, 0x73, 0x58, 0xA5, 0xB3,
+    0x10, 0xC1, 0x23, 0x98, 0x1B, 0xA8, 0x85, 0xD8, 0x8A, 0x95, 0xA5, 0xA5, 0xE0, 0x29, 0x3C, 0x81,
+    0xA5, 0x60, 0x63, 0x6F, 0x6F, 0xBD, 0x22, 0xFE, 0xA4, 0x31, 0x31, 0x33, 0xD9, 0x99, 0x1D, 0xC2,
+    0x14, 0x56, 0xC2, 0x10, 0x77, 0xDF, 0xCC, 0xFB, 0xDE, 0x2C, 0x35, 0xB7, 0x58, 0x0E, 0x6A, 0x12,
+    0xF1, 0xCE, 0x09, 0x7D, 0xEE, 0x8B, 0x0A, 0x61, 0x3A, 0xE2, 0xD2, 0x8D, 0x19, 0x0B, 0x2B, 0xA8,
+    0x02, 0x93, 0x1E, 0x77, 0x99, 0xE7, 0xFB, 0xDD, 0x15, 0x7E, 0xBA, 0xFC, 0xD1, 0x11, 0xC4, 0xAC,
+    0x73, 0x6A, 0xAD, 0xE8, 0xD1, 0x94, 0xF2, 0x0E, 0x74, 0x5A, 0xC6, 0x8B, 0x01, 0x94, 0x4E, 0xEC,
+    0xFF, 0x3C, 0x37, 0x74, 0x53, 0x5A, 0xCA, 0x46, 0x00, 0x35, 0x3E, 0xF6, 0x17, 0xB1, 0xC2, 0x37,
+    0x82, 0xF4, 0xA5, 0xDE, 0xAD, 0x35, 0x31, 0xF8, 0x6C, 0x5C, 0x6B, 0x2B, 0x20, 0x36, 0x11, 0xD8,
+    0x22, 0x08, 0x17, 0xB8, 0x64, 0x2C, 0x66, 0x52, 0x9C, 0x0F, 0x16, 0xF7, 0x44, 0xA9, 0x40, 0xA7,
+    0x7E, 0x67, 0xD7, 0x49, 0xAC, 0xFF, 0xA0, 0xF1, 0xB3, 0x8A, 0xA6, 0xB3, 0x9D, 0x7C, 0x09, 0x9E,
+    0x9C, 0x38, 0x9A, 0x41, 0xF8, 0x72, 0x78, 0x12, 0x2B, 0x7F, 0x95, 0x5A, 0xFA, 0x57, 0x41, 0xA5,
+    0xA4, 0xDC, 0xA8, 0xE8, 0x52, 0xD4, 0x2B, 0x3D, 0x2A, 0x93, 0x50, 0xE6, 0x95, 0x88, 0xBC, 0xDA,
+    0xA9, 0x2A, 0xB3, 0x07, 0xB4, 0x1B, 0x32, 0xEF, 0x31, 0x5E, 0x1B, 0x49, 0x59, 0x6D, 0xB4, 0x6E,
+    0x2A, 0x4F, 0xF7, 0xCB, 0x28, 0x78, 0x6E, 0x7B, 0x18, 0x1B, 0x4F, 0x22, 0xE7, 0x63, 0x53, 0xE5,
+    0xF8, 0xDA, 0xD2, 0xEA, 0x9E, 0x11, 0x85, 0xF3, 0x8C, 0x17, 0x5A, 0x8A, 0x6F, 0xDE, 0xE6, 0x4C,
+    0x5B, 0x5C, 0x27, 0xDA, 0x6D, 0x72, 0xFB, 0x96, 0x00, 0x7C, 0x69, 0xE5, 0x85, 0x73, 0x19, 0x1A,
+    0xCA, 0x5C, 0x61, 0xD2, 0xE8, 0x9C, 0x1F, 0x83, 0x27, 0x84, 0x7B, 0xDD, 0x2C, 0x30, 0x4B, 0xE0,
+    0x40, 0x13, 0x5D, 0x00, 0x1C, 0x76, 0x28, 0x02, 0xF7, 0x99, 0x10, 0xF9, 0xEE, 0x1D, 0x2C, 0xF5,
+    0xC3, 0x1D, 0xAA, 0xB0, 0xF5, 0x3F, 0xD8, 0xF1, 0x70, 0x01, 0x48, 0xF2, 0xE6, 0x44, 0x16, 0x00,
+    0xA5, 0x68, 0x79, 0x64, 0x01, 0x50, 0x59, 0xD2, 0x8F, 0x22, 0x50, 0x00, 0x32, 0x04, 0x59, 0x40,
+    0x00, 0x94, 0x40, 0x91, 0x05, 0x40, 0xB2, 0x2C, 0x28, 0x02, 0xC0, 0xC4, 0xC0, 0x8A, 0x22, 0x00,
+    0xF4, 0x2E, 0x1B, 0x8A, 0xC0, 0x4F, 0x74, 0x81, 0xDF, 0xE8, 0x5A, 0x80, 0xC9, 0x90, 0x09, 0x59,
+    0x00, 0x94, 0xA7, 0x50, 0xDC, 0x71, 0x00, 0x94, 0x96, 0x91, 0x05, 0x7E, 0x80, 0xE2, 0x13, 0x49,
+    0x60, 0xE1, 0x7F, 0x50, 0x42, 0x40, 0x08, 0x4C, 0x81, 0x64, 0x48, 0x58, 0x7E, 0x84, 0x64, 0xC8,
+    0x78, 0xB4, 0x30, 0x05, 0xC5, 0x18, 0x8A, 0x80, 0x0E, 0x5A, 0xA8, 0x47, 0xA3, 0xC4, 0xCB, 0xBD,
+    0xD9, 0xA2, 0xA8, 0xC9, 0x03, 0x29, 0x4C, 0x46, 0x05, 0xF0, 0x09, 0x00, 0x00, 0x9D, 0x95, 0x31,
+    0x0E, 0x01, 0x41, 0x14, 0x86, 0x97, 0x45, 0x24, 0x12, 0x67, 0xD8, 0x52, 0x44, 0xA1, 0xD2, 0xA2,
+    0xD1, 0x6E, 0x9C, 0xC0, 0x1E, 0x41, 0xC5, 0x1D, 0x94, 0x2A, 0x9D, 0x23, 0x70, 0x04, 0x71, 0x01,
+    0x71, 0x0D, 0x0A, 0x8A, 0x0D, 0x36, 0x23, 0x59, 0xDE, 0xCE, 0x7B, 0xF3, 0xDE, 0xCE, 0x8C, 0xC6,
+    0x94, 0x7F, 0x76, 0xDE, 0xCC, 0xFC, 0xFF, 0xF7, 0xDE, 0xE2, 0x1A, 0x2F, 0x96, 0x83, 0x8A, 0x44,
+    0x3C, 0xD2, 0xD4, 0x77, 0x58, 0xE9, 0x2B, 0x44, 0xA6, 0xCB, 0xE9, 0x39, 0xA8, 0xFE, 0x9C, 0x23,
+    0x9B, 0x2B, 0xF7, 0x0C, 0x10, 0xB7, 0x0D, 0xB1, 0x8F, 0x76, 0x54, 0xE9, 0x54, 0x35, 0xF8, 0x37,
+    0xD0, 0xEE, 0x16, 0x56, 0x7D, 0x6B, 0x87, 0x0F, 0x22, 0xED, 0xB3, 0xDE, 0x99, 0x0A, 0x34, 0x46,
+    0x9A, 0x75, 0xC5, 0x09, 0x17, 0x48, 0x34, 0xC1, 0x46, 0x7E, 0x29, 0xC4, 0xDE, 0x06, 0x3A, 0x18,
+    0x42, 0x28, 0x3C, 0x84, 0x84, 0x62, 0x96, 0xE6, 0x00, 0xF1, 0x9D, 0x02, 0x27, 0x36, 0x4E, 0xB0,
+    0x5B, 0x90, 0x19, 0x40, 0x63, 0xA4, 0x26, 0x50, 0x82, 0xA3, 0xF2, 0x60, 0x47, 0xF0, 0x16, 0xE1,
+    0xCB, 0x70, 0x45, 0xD9, 0xD7, 0x32, 0xCA, 0xC6, 0xB8, 0x59, 0xCF, 0x28, 0x25, 0x23, 0x35, 0x2C,
+    0xE9, 0xF9, 0xAF, 0x04, 0xB5, 0x5E, 0xEE, 0x89, 0x9E, 0x7B, 0x79, 0x6E, 0xEF, 0x79, 0xA3, 0xE3,
+    0x44, 0xEE, 0xF3, 0xAB, 0xEC, 0x6A, 0x02, 0xAE, 0x3A, 0xDE, 0xC7, 0xBE, 0x84, 0xCA, 0x39, 0x66,
+    0x05, 0xF0, 0x32, 0xED, 0xBE, 0x4E, 0x5B, 0x32, 0x71, 0xD0, 0x85, 0x25, 0x39, 0x0A, 0x77, 0x30,
+    0x5F, 0x47, 0xA2, 0x75, 0x0F, 0x14, 0x82, 0xB6, 0xC6, 0x69, 0x8A, 0x63, 0xF1, 0xB6, 0xDA, 0x5C,
+    0x80, 0x55, 0xDD, 0xBF, 0xC5, 0x67, 0x62, 0xE4, 0x5A, 0xDC, 0x9B, 0xE7, 0x46, 0xCA, 0xE2, 0xDE,
+    0xF4, 0x50, 0x2E, 0xA6, 0xA3, 0xEE, 0xB4, 0xC9, 0x94, 0xFE, 0x49, 0x62, 0xC1, 0xF0, 0x9E, 0x95,
+    0xA5, 0xE2, 0x1F, 0xD4, 0x2C, 0x6B, 0x7B, 0x79, 0x0F, 0x36, 0x27, 0xB7, 0xAA, 0x25, 0x66, 0xDC,
+    0xF0, 0x4A, 0xED, 0x23, 0xBF, 0x27, 0xF4, 0x82, 0xE0, 0x03, 0x8D, 0x94, 0xB1, 0x0D, 0xC2, 0x30,
+    0x10, 0x45, 0x43, 0x47, 0x10, 0x45, 0x36, 0xA0, 0xA3, 0xA0, 0x62, 0x24, 0x16, 0x41, 0x8A, 0xC4,
+    0x00, 0x30, 0x42, 0x06, 0xC8, 0x10, 0x8C, 0x92, 0x15, 0x80, 0x48, 0x41, 0x11, 0x24, 0xE8, 0xFE,
+    0xD9, 0xE7, 0xEF, 0x2B, 0x22, 0x52, 0xBE, 0xC2, 0xBE, 0xFC, 0xFB, 0xCF, 0xA6, 0x48, 0xBB, 0x2F,
+    0xE2, 0x25, 0xF1, 0x3B, 0x7B, 0xA0, 0xF2, 0x7D, 0xFE, 0xF1, 0x0E, 0x83, 0x56, 0x97, 0x49, 0xE3,
+    0xB4, 0xC9, 0x11, 0xEA, 0x8E, 0x81, 0x4C, 0x78, 0xCD, 0x40, 0x8D, 0xB6, 0x11, 0x28, 0xD0, 0x10,
+    0x06, 0xA3, 0x9C, 0xCA, 0x00, 0xE5, 0x65, 0xD0, 0x4B, 0xCA, 0x0C, 0x5E, 0x92, 0x88, 0x03, 0x9B,
+    0xE5, 0x33, 0xFC, 0x2D, 0x15, 0x64, 0x22, 0xD0, 0xA0, 0x7E, 0x04, 0x06, 0x2C, 0x31, 0x01, 0xE9,
+    0xF3, 0x96, 0x00, 0xF2, 0x58, 0xF4, 0x31, 0xBE, 0x56, 0x0C, 0xD6, 0x2E, 0xF5, 0x83, 0xDF, 0x4B,
+    0x99, 0xD5, 0xE3, 0x11, 0x75, 0x89, 0xA0, 0x9E, 0x43, 0x89, 0x6D, 0x2F, 0x53, 0x28, 0x83, 0x0D,
+    0x36, 0x04, 0xE1, 0x0C, 0x74, 0xA1, 0xE1, 0x06, 0x4E, 0xE1, 0x0D, 0x48, 0x3F, 0xF7, 0xD5, 0xC9,
+    0x12, 0xE8, 0x55, 0x84, 0x04, 0xEE, 0xAA, 0x7A, 0x02, 0x47, 0x75, 0x9D, 0x12, 0x1B, 0x51, 0x54,
+    0x02, 0x4F, 0x04, 0x42, 0xE0, 0x86, 0xFA, 0xBB, 0x35, 0xE4, 0xDB, 0x7F, 0x8B, 0x77, 0x0C, 0x3A,
+    0xE9, 0x14, 0x03, 0x31, 0x66, 0xC5, 0x40, 0xA6, 0x2F, 0x7F, 0x83, 0x7A, 0x3B, 0xB5, 0x3C, 0x4C,
+    0x18, 0x29, 0x81, 0x6F, 0x03, 0xC7, 0x62, 0x0F, 0x13, 0x3C, 0x9A, 0x60, 0x65, 0x03, 0x7A, 0x52,
+    0x86, 0x06, 0x43, 0x02, 0x5A, 0x4E, 0x04, 0x97, 0x0F, 0xE7, 0x2B, 0xD3, 0xDA, 0x7E, 0x43, 0x73,
+    0x22, 0x28, 0x5C, 0xFB, 0xC1, 0x9A, 0x9F, 0x41, 0x02, 0x18, 0xE8, 0xC0, 0xF7, 0x10, 0xE3, 0x05,
+    0x7E, 0x83, 0xC3, 0xEF, 0x0B, 0x22, 0x92, 0x0F, 0x80, 0xF5, 0xFC, 0x82, 0xA7, 0x47, 0xB0, 0x6E,
+    0x46, 0x50, 0x22, 0x62, 0x42, 0x8A, 0x6A, 0x36, 0x06, 0x44, 0xB4, 0x81, 0xB5, 0x73, 0x09, 0x20,
+    0x92, 0x29, 0x38, 0x28, 0x78, 0x51, 0x54, 0x7C, 0x00, 0x45, 0xCE, 0x7F, 0x24, 0x33, 0x60, 0x69,
+    0x88, 0x0B, 0x45, 0xE0, 0x1B, 0x3C, 0xF4, 0x19, 0xE0, 0x51, 0x09, 0x77, 0x08, 0x3C, 0xE3, 0xDE,
+    0x67, 0x45, 0x16, 0x01, 0x65, 0xE0, 0xF7, 0x1A, 0x48, 0x02, 0x90, 0x02, 0xA1, 0x97, 0x19, 0xC5,
+    0x58, 0x90, 0x22, 0x4F, 0xB8, 0x80, 0xC2, 0x6F, 0x48, 0x70, 0xD5, 0xC2, 0xE2, 0x80, 0xC1, 0xE0,
+    0x37, 0x5A, 0xE6, 0x61, 0x50, 0x78, 0x01, 0x11, 0xC9, 0x43, 0x98, 0x33, 0x05, 0x52, 0xCA, 0x20,
+    0xB9, 0x19, 0x7F, 0xF9, 0x04, 0x05, 0x8B, 0x50, 0x52, 0x2C, 0x34, 0xC0, 0xDE, 0xA3, 0x08, 0x18,
+    0xC0, 0x8A, 0x3E, 0x64, 0x6F, 0xA1, 0x86, 0x0D, 0x30, 0xE9, 0xF2, 0x7E, 0x47, 0xE4, 0x27, 0x70,
+    0x98, 0xF2, 0x7F, 0x43, 0xE4, 0x28, 0x88, 0xC0, 0x17, 0x58, 0xDA, 0x87, 0x09, 0x7C, 0x40, 0xCA,
+    0xBF, 0x60, 0x33, 0x36, 0xFC, 0x87, 0xE7, 0x2A, 0x88, 0x2D, 0x06, 0x48, 0xA5, 0x1D, 0xC4, 0x1D,
+    0x3F, 0x11, 0xF9, 0xFC, 0x31, 0x38, 0xFD, 0x83, 0x8A, 0xA9, 0x3A, 0x70, 0x58, 0x4D, 0x82, 0x94,
+    0x61, 0xE0, 0x0A, 0xEA, 0x7C, 0x65, 0x58, 0xD9, 0x4D, 0x58, 0xD9, 0x88, 0x54, 0x89, 0x41, 0x03,
+    0xF1, 0x3B, 0x9C, 0xFF, 0x1E, 0x92, 0x2F, 0xE0, 0x95, 0xC0, 0x7F, 0x49, 0x98, 0xFD, 0x5B, 0xC1,
+    0x21, 0xBA, 0x8F, 0x0D, 0xE1, 0x4D, 0x81, 0x90, 0xF2, 0x30, 0x15, 0x08, 0x13, 0x00, 0xFB, 0x8E,
+    0x96, 0x8F, 0xFE, 0xEB, 0x93, 0x27, 0xF2, 0xEC, 0x1D, 0x2C, 0xEB, 0xBD, 0x87, 0xB0, 0x60, 0x31,
+    0xF1, 0x11, 0x16, 0x12, 0x70, 0x30, 0x2A, 0x32, 0x2A, 0x32, 0x04, 0x45, 0x00, 0xFB, 0x8D, 0x14,
+    0x33, 0xA0, 0x10, 0xE1, 0x1E, 0x15, 0x18, 0x41, 0x02, 0xBF, 0xF0, 0x0A, 0x80, 0x52, 0xEA, 0x4F,
+    0x58, 0xFA, 0x81, 0x26, 0x26, 0xCE, 0x6F, 0x88, 0x0C, 0x04, 0x4E, 0x4B, 0xEC, 0x9F, 0x61, 0x49,
+    0x1D, 0x9A, 0x44, 0x59, 0x3E, 0x20, 0x65, 0x57, 0x50, 0x7E, 0x02, 0x65, 0x10, 0x58, 0x26, 0x02,
+    0xE5, 0x83, 0xF5, 0xE0, 0xAC, 0x04, 0xCD, 0x64, 0xA0, 0x74, 0x69, 0x0F, 0xCE, 0x82, 0xD0, 0x34,
+    0x5F, 0x00, 0x29, 0x8D, 0x80, 0xF5, 0xC9, 0x7F, 0x1F, 0x70, 0x6E, 0xF8, 0x03, 0xA9, 0x10, 0xC0,
+    0xE5, 0xD9, 0xBA, 0xF0, 0xD0, 0xE5, 0xFF, 0xA0, 0x25, 0x2C, 0x28, 0x5F, 0xC0, 0xC0, 0x7B, 0x26,
+    0xE4, 0x32, 0x1B, 0x08, 0xA4, 0xA1, 0x85, 0xC0, 0x3F, 0xB4, 0x7A, 0x87, 0x21, 0xE0, 0x15, 0xB8,
+    0xBC, 0xB4, 0x44, 0x2A, 0xCD, 0x9D, 0xCA, 0xCA, 0xDD, 0xA0, 0xE5, 0x19, 0x00, 0x5D, 0x95, 0xEF,
+    0x11, 0xC1, 0x40, 0x10, 0xC5, 0xE3, 0x03, 0x32, 0xE3, 0x5F, 0x3A, 0x88, 0x0E, 0xE8, 0x40, 0x09,
+    0x74, 0x40, 0x07, 0x74, 0x40, 0x07, 0x74, 0x40, 0x09, 0x4A, 0xD0, 0x81, 0x12, 0xE8, 0x80, 0xCC,
+    0x98, 0x60, 0x48, 0x98, 0x6C, 0xDE, 0xBE, 0xDD, 0xE4, 0x3E, 0x99, 0xBD, 0xCC, 0xED, 0xBD, 0xF7,
+    0x7E, 0x7B, 0xAE, 0x6C, 0x16, 0xE8, 0xF7, 0xF1, 0x46, 0x1B, 0x9A, 0xAF, 0x9D, 0xF1, 0x4F, 0x9B,
+    0x33, 0xE7, 0x66, 0xE1, 0x43, 0x68, 0xA5, 0x99, 0xD8, 0xF8, 0xAC, 0x44, 0x77, 0x94, 0xB8, 0x12,
+    0x8A, 0xC7, 0x25, 0xA7, 0xB2, 0xB3, 0xB5, 0x5A, 0x2A, 0xCE, 0xCD, 0x8C, 0xB3, 0x32, 0x96, 0xB0,
+    0xEC, 0x44, 0x76, 0x22, 0xDC, 0xE2, 0x4D, 0x56, 0x25, 0xE8, 0x33, 0xC8, 0xE8, 0x6B, 0xED, 0x84,
+    0x7C, 0xAE, 0xB4, 0x57, 0xDA, 0xC6, 0x88, 0x95, 0x04, 0x3D, 0x91, 0xC5, 0xD0, 0x35, 0xCE, 0xD4,
+    0xA8, 0xAF, 0xFE, 0x70, 0xDB, 0x29, 0xC3, 0xB3, 0x63, 0x12, 0xC5, 0xA2, 0xC8, 0x7F, 0x42, 0x26,
+    0xE6, 0x8C, 0xBB, 0xC7, 0x5C, 0x01, 0xFE, 0xCB, 0x98, 0xCC, 0x7F, 0x36, 0x22, 0x18, 0xAA, 0x42,
+    0x5D, 0x13, 0xC4, 0x29, 0x7C, 0xA4, 0x66, 0xC7, 0x83, 0xA5, 0xDD, 0x00, 0x2A, 0x07, 0x5A, 0x5B,
+    0x61, 0xFF, 0xE1, 0x1C, 0x8A, 0x70, 0xCE, 0x9B, 0x82, 0x4A, 0x77, 0x1B, 0xD2, 0xF6, 0x56, 0x09,
+    0xBF, 0x25, 0xF7, 0x74, 0xC9, 0xDC, 0x85, 0xA4, 0x83, 0x1B, 0x41, 0x25, 0xFE, 0xAE, 0x8C, 0xAB,
+    0xBA, 0xA5, 0x9E, 0xC0, 0x95, 0x17, 0xD1, 0x7C, 0x4C, 0x99, 0x62, 0x17, 0xF9, 0x37, 0xA0, 0x1C,
+    0xC5, 0xF6, 0xC2, 0x65, 0x85, 0x0C, 0xBB, 0x47, 0x97, 0x29, 0xB2, 0x1E, 0x25, 0x4E, 0x19, 0xD4,
+    0xAD, 0x53, 0xC7, 0x08, 0xD4, 0x5D, 0xBE, 0x55, 0x88, 0xE5, 0x6E, 0x35, 0xD8, 0xC5, 0x3A, 0x4E,
+    0x6F, 0xE0, 0x1E, 0x21, 0x4C, 0x0F, 0xD7, 0x98, 0x7F, 0x0C, 0x6E, 0x65, 0xF6, 0x6E, 0x04, 0x8E,
+    0xA8, 0x7D, 0xBD, 0x96, 0xD4, 0x94, 0x61, 0x30, 0xA8, 0xEC, 0x0F, 0x55, 0x55, 0xCB, 0x51, 0x02,
+    0x41, 0x10, 0x5D, 0x60, 0x29, 0x41, 0x44, 0xC9, 0x00, 0x32, 0xC0, 0x10, 0x30, 0x02, 0xC8, 0x40,
+    0x32, 0xC0, 0x0C, 0xE4, 0xE0, 0x1D, 0x32, 0x80, 0x0C, 0xB8, 0x79, 0x85, 0x4C, 0x96, 0x0C, 0x84,
+    0xE2, 0x53, 0xAE, 0xB2, 0xBB, 0xF6, 0xEF, 0xF5, 0x8C, 0xB7, 0xA5, 0x98, 0xE9, 0x7E, 0xDD, 0xEF,
+    0x33, 0x07, 0x87, 0x2C, 0x8D, 0x92, 0x20, 0xB9, 0xD9, 0xCE, 0xE7, 0x92, 0xB3, 0xE0, 0x88, 0x26,
+    0x19, 0xCE, 0x1D, 0xAC, 0x2C, 0xA3, 0x15, 0x16, 0xFC, 0x38, 0x0A, 0x04, 0x11, 0x7C, 0xDB, 0x82,
+    0x2C, 0xBB, 0x93, 0x60, 0x10, 0x65, 0x07, 0xC5, 0xAF, 0xCC, 0xD0, 0xCD, 0x7B, 0xB3, 0x1E, 0x5E,
+    0x03, 0xA3, 0x0D, 0xEE, 0x9D, 0x7A, 0x7D, 0x2F, 0x5E, 0xF0, 0x85, 0x8B, 0xF7, 0x3E, 0x57, 0xAE,
+    0xD1, 0x9E, 0x98, 0xE3, 0x88, 0x0D, 0xA8, 0x15, 0xEB, 0x58, 0xED, 0x42, 0x68, 0x7A, 0x42, 0x91,
+    0x2D, 0xE4, 0x31, 0x17, 0x26, 0x96, 0xA0, 0x89, 0x8A, 0x8C, 0x51, 0x61, 0x27, 0xE7, 0x27, 0xE0,
+    0x9C, 0xB0, 0x77, 0x51, 0xE1, 0x20, 0x13, 0xF6, 0x20, 0x69, 0xC2, 0xDE, 0x2E, 0x8C, 0xD1, 0x93,
+    0x62, 0x2B, 0x0C, 0x16, 0x29, 0x22, 0xFD, 0x36, 0x63, 0x18, 0x17, 0x3F, 0x46, 0x1B, 0x9D, 0x24,
+    0xFC, 0x19, 0x26, 0xAE, 0xE9, 0x89, 0xA6, 0x62, 0xDF, 0x72, 0x8F, 0x9A, 0x9A, 0x28, 0xB3, 0x4D,
+    0x1A, 0xF7, 0x33, 0xE6, 0xA2, 0xA9, 0x60, 0x57, 0x91, 0xEA, 0x7A, 0xEC, 0x97, 0xA9, 0xCA, 0x0C,
+    0xB2, 0x5A, 0x2B, 0xE2, 0x09, 0x1B, 0x6B, 0xA0, 0x9C, 0xCF, 0x8D, 0x82, 0xA9, 0x6A, 0x70, 0x2D,
+    0x78, 0x0B, 0x99, 0x7F, 0x67, 0xFE, 0x1B, 0xA8, 0x14, 0xF7, 0x82, 0x37, 0x97, 0xEF, 0x03, 0x62,
+    0xA2, 0x14, 0x67, 0x9C, 0x4C, 0xA2, 0xF6, 0xDD, 0x84, 0x31, 0x45, 0x68, 0x1B, 0x3D, 0xAF, 0xA2,
+    0xAB, 0x43, 0x7D, 0x75, 0xC5, 0x2E, 0x4A, 0x4A, 0xF1, 0x56, 0xD8, 0x73, 0xC1, 0xD8, 0xFB, 0xAA,
+    0xF0, 0x36, 0xB7, 0xD8, 0x38, 0xF1, 0xF7, 0x8C, 0xFD, 0x41, 0x31, 0xC9, 0x08, 0x33, 0x97, 0x63,
+    0xD7, 0xB0, 0xF3, 0x85, 0x3E, 0x1F, 0xB3, 0xB4, 0x78, 0xE3, 0x5A, 0x7B, 0x53, 0x6E, 0x4E, 0x17,
+    0x96, 0x2E, 0xF6, 0x11, 0xAF, 0xE5, 0x64, 0x9D, 0x2F, 0xD4, 0xC6, 0x0D, 0xC3, 0x11, 0xB6, 0x32,
+    0xEC, 0xDC, 0xF8, 0x8B, 0x9B, 0x23, 0x41, 0x6E, 0x14, 0x37, 0x37, 0x53, 0x27, 0xDD, 0x68, 0x9C,
+    0x83, 0x2D, 0x48, 0x65, 0x09, 0x34, 0x4D, 0x8D, 0xEF, 0xAE, 0xC1, 0x4C, 0x74, 0xEA, 0x05, 0x4E,
+    0xA0, 0x14, 0xE9, 0xE4, 0x9E, 0x29, 0x5C, 0xFB, 0xC3, 0xCB, 0x97, 0xD5, 0xD3, 0x2F, 0xAC, 0x2F,
+    0xF5, 0x3F, 0xB1, 0x35, 0x5A, 0xD2, 0xB0, 0x44, 0x80, 0x08, 0x73, 0xB9, 0x27, 0xF2, 0xA5, 0x7A,
+    0x77, 0x3D, 0x0B, 0xC1, 0xA5, 0x7B, 0xE4, 0x58, 0x65, 0xC1, 0x81, 0x62, 0x47, 0xA4, 0x8D, 0xA6,
+    0x7E, 0x2B, 0x89, 0x4C, 0xEC, 0x35, 0x24, 0xF7, 0x52, 0xFF, 0x2B, 0xAF, 0xC2, 0x6A, 0x9E, 0xAB,
+    0x10, 0x95, 0x1A, 0x2E, 0x08, 0x4B, 0xC9, 0xF8, 0x28, 0x8B, 0x8F, 0xEE, 0x39, 0x15, 0xF5, 0xE2,
+    0x5F, 0x9C, 0x67, 0xFE, 0xE3, 0x1A, 0x25, 0x89, 0x68, 0x70, 0x11, 0x97, 0xE8, 0x27, 0x71, 0x9E,
+    0x8F, 0xE3, 0x12, 0xFA, 0x3E, 0xFC, 0x01, 0x85, 0x94, 0xDB, 0x09, 0xC2, 0x40, 0x10, 0x45, 0x83,
+    0x20, 0x11, 0x62, 0x0D, 0x62, 0x07, 0xB1, 0x03, 0x4B, 0x88, 0x1D, 0x58, 0x82, 0x25, 0x28, 0xF6,
+    0xE4, 0xB7, 0x2D, 0xD8, 0x41, 0x48, 0x09, 0x22, 0x51, 0xA2, 0xC4, 0x35, 0x3B, 0x33, 0x77, 0x1E,
+    0x5F, 0xFE, 0xEE, 0x86, 0xEC, 0xCE, 0x3D, 0xE7, 0xEE, 0x09, 0xC2, 0xE3, 0x96, 0xD3, 0xE6, 0xD7,
+    0xE7, 0xD8, 0x13, 0x4D, 0x1F, 0xBB, 0xD0, 0xF9, 0xC3, 0xED, 0x21, 0x98, 0x9F, 0x3A, 0x4D, 0x8E,
+    0x6D, 0x85, 0x53, 0x6C, 0x90, 0x39, 0x72, 0xAF, 0x40, 0x45, 0x12, 0x7F, 0x21, 0x91, 0x8F, 0xF2,
+    0xBF, 0x89, 0x7A, 0x3B, 0x6B, 0xC7, 0x46, 0xB2, 0xE8, 0x9C, 0x0A, 0x03, 0x87, 0x3D, 0x68, 0xE6,
+    0x04, 0xA4, 0xE5, 0x8F, 0x81, 0x9F, 0x1A, 0x52, 0xD2, 0x2F, 0x83, 0x42, 0x75, 0x3E, 0xB8, 0xB1,
+    0xA5, 0x29, 0xD3, 0xEB, 0x3A, 0x29, 0x34, 0xB8, 0x75, 0xB1, 0x16, 0x00, 0x4E, 0xB0, 0x82, 0x47,
+    0xD1, 0xB1, 0x42, 0x95, 0x67, 0x7E, 0x89, 0x6C, 0x3A, 0x86, 0x95, 0x1C, 0x9E, 0x2F, 0x80, 0x0C,
+    0x60, 0x57, 0x2F, 0x00, 0xD0, 0x8A, 0x61, 0xFA, 0x86, 0xA7, 0x8A, 0xEB, 0x0D, 0xA5, 0x0B, 0xA8,
+    0x90, 0x3C, 0x62, 0x12, 0x2D, 0x8D, 0xBE, 0x97, 0x0C, 0xE9, 0x9C, 0x20, 0x8D, 0xA9, 0x30, 0xAA,
+    0xE3, 0xAA, 0x82, 0x97, 0x43, 0x54, 0xF0, 0x72, 0xC8, 0x7E, 0x28, 0xB5, 0xA8, 0xD0, 0xDB, 0x53,
+    0x01, 0x11, 0x4D, 0x0E, 0x55, 0x21, 0x4F, 0xB5, 0xD4, 0x94, 0x6B, 0xC8, 0x71, 0x50, 0x85, 0x4A,
+    0xC8, 0xC1, 0x35, 0xB8, 0xA3, 0x30, 0xC4, 0xBB, 0x12, 0x85, 0xB6, 0x26, 0xC7, 0x5E, 0x14, 0x92,
+    0xF7, 0x2E, 0xBB, 0x93, 0x59, 0x76, 0x4E, 0x05, 0xD9, 0x7E, 0x6B, 0x2B, 0xF9, 0x27, 0x0D, 0x59,
+    0x53, 0x79, 0xC4, 0xAD, 0x1D, 0xAC, 0x17, 0x5A, 0xFC, 0x00, 0xFB, 0x82, 0x14, 0x59, 0x90, 0xA0,
+    0x90, 0xDB, 0xF0, 0x1F, 0x66, 0x1C, 0xCC, 0xDB, 0xEC, 0x0A, 0xFF, 0x11, 0xC1, 0x06, 0xF6, 0xCB,
+    0x7B, 0xB0, 0xEB, 0xE5, 0x19, 0x90, 0xA2, 0x25, 0x1E, 0x6C, 0x3D, 0x3C, 0x72, 0x40, 0xAE, 0xE5,
+    0x81, 0x04, 0x22, 0xCC, 0x30, 0x07, 0x48, 0x94, 0x80, 0x52, 0x03, 0x34, 0xA5, 0x81, 0xDC, 0xB9,
+    0x1F, 0xEA, 0x3A, 0x58, 0x14, 0x7F, 0x85, 0x32, 0x2F, 0x20, 0xD2, 0xC9, 0x5F, 0x68, 0x90, 0x05,
+    0xFC, 0x87, 0x85, 0x40, 0x00, 0xDC, 0xD8, 0x3F, 0xB0, 0xE0, 0xBC, 0x00, 0xF7, 0xC9, 0x67, 0x98,
+    0x61, 0xDF, 0xE0, 0xF1, 0xB1, 0x01, 0x6A, 0x0F, 0xC8, 0x6E, 0x36, 0x44, 0x54, 0x33, 0x43, 0x12,
+    0xCA, 0x7D, 0x98, 0x9B, 0x7F, 0x42, 0x82, 0xED, 0x01, 0x3C, 0x2E, 0xC0, 0x7E, 0xB2, 0x87, 0x84,
+    0x1A, 0x0F, 0x4C, 0xA8, 0x00, 0x92, 0xEA, 0x90, 0x13, 0x35, 0x88, 0xC3, 0x02, 0x92, 0xD8, 0x8F,
+    0x08, 0xCB, 0x6F, 0x20, 0x2D, 0x0F, 0x91, 0xD2, 0x2E, 0xD8, 0x8D, 0xFE, 0xA0, 0x70, 0xE7, 0x44,
+    0x08, 0x01, 0x03, 0xE5, 0xBC, 0x00, 0x4A, 0x88, 0x83, 0xFD, 0xD4, 0x8A, 0x1A, 0x2F, 0x20, 0x3F,
+    0xFD, 0x85, 0xFB, 0x06, 0x9E, 0xEE, 0x10, 0x89, 0x15, 0x29, 0xF9, 0xDE, 0x67, 0x40, 0x01, 0xA0,
+    0xD2, 0x25, 0x1E, 0x55, 0x08, 0xE8, 0x27, 0x84, 0x6F, 0xE0, 0x7E, 0x42, 0xF2, 0x0D, 0x2C, 0xF5,
+    0xA1, 0x19, 0x35, 0x2A, 0x44, 0xAC, 0x10, 0x00, 0x7B, 0x80, 0x96, 0x8F, 0x58, 0xC8, 0x10, 0x38,
+    0xF0, 0x0E, 0x01, 0xFE, 0xFD, 0x87, 0x39, 0x92, 0x01, 0xEE, 0xDD, 0x7A, 0x64, 0x3E, 0x28, 0xF0,
+    0x78, 0x90, 0xF9, 0x13, 0xD0, 0x75, 0x7C, 0x41, 0x0E, 0x5C, 0x68, 0x72, 0xE4, 0x46, 0x16, 0x58,
+    0x80, 0x48, 0x80, 0x0C, 0x30, 0x4F, 0xC6, 0xA3, 0xEB, 0xE0, 0x42, 0x16, 0xD8, 0x80, 0xAE, 0xE3,
+    0x1B, 0x3C, 0xDC, 0x11, 0xF1, 0xCE, 0x89, 0x2C, 0x70, 0x00, 0x16, 0xE8, 0x30, 0xF0, 0x1D, 0x1E,
+    0x81, 0x08, 0x1D, 0x1C, 0xC8, 0x02, 0x17, 0xD0, 0x75, 0xFC, 0x40, 0x4A, 0xB6, 0xB0, 0x04, 0xC4,
+    0x8E, 0xA6, 0x03, 0xA5, 0x58, 0x01, 0x25, 0x08, 0x14, 0x1D, 0x0E, 0x88, 0xC4, 0xC8, 0x00, 0x2B,
+    0x65, 0xF7, 0xA3, 0xE8, 0x40, 0x49, 0xF2, 0xD0, 0x42, 0x85, 0x15, 0x4D, 0xC7, 0x7A, 0x14, 0x1D,
+    0xBF, 0xD1, 0x74, 0x40, 0xF3, 0x09, 0x02, 0x7C, 0x42, 0xCA, 0x61, 0xB0, 0x64, 0xC7, 0x8B, 0xCC,
+    0x2F, 0x40, 0xCA, 0xB0, 0x30, 0x1D, 0xFD, 0xE8, 0x51, 0x8C, 0xA2, 0xA3, 0x01, 0x5D, 0x07, 0xE9,
+    0x89, 0x02, 0xA8, 0xE3, 0xFF, 0x5D, 0x24, 0x60, 0xFB, 0x15, 0x2D, 0x15, 0xFA, 0x93, 0x21, 0x00,
+    0x00, 0xFB, 0x0E, 0x8E, 0x2F, 0x46, 0x5C, 0xD4, 0xEA, 0x55, 0xAB, 0x18, 0xA1, 0x1A, 0x46, 0x29,
+    0x1A, 0x53, 0xD0, 0xB0, 0xC6, 0x19, 0x1D, 0x00, 0xFB, 0x01, 0x35, 0x1B, 0x16, 0x22, 0xF0, 0x68,
+    0x02, 0x19, 0xC1, 0x85, 0x1C, 0x9A, 0xFC, 0x08, 0x75, 0xC8, 0xBE, 0x07, 0x86, 0x3A, 0x52, 0x14,
+    0x7C, 0x81, 0x39, 0x11, 0x1A, 0x1C, 0x1C, 0x70, 0x4E, 0x01, 0x3C, 0x6C, 0x20, 0x1E, 0xF3, 0x47,
+    0x68, 0xFA, 0x8D, 0x94, 0x20, 0x10, 0x7E, 0x81, 0x06, 0x23, 0x3B, 0x9C, 0x33, 0x01, 0x39, 0x51,
+    0x18, 0xC0, 0xC3, 0x13, 0x12, 0x21, 0xF3, 0x11, 0x9C, 0xEF, 0xF0, 0xC4, 0x0A, 0x09, 0x11, 0x56,
+    0xE4, 0x98, 0xE2, 0x86, 0x73, 0x1C, 0xE0, 0xD1, 0x06, 0x49, 0xA1, 0xF5, 0x08, 0x0E, 0x7A, 0xA0,
+    0xB0, 0x90, 0x1C, 0x28, 0x3F, 0x91, 0x03, 0xE5, 0x33, 0xD1, 0x81, 0x12, 0x8F, 0x1C, 0x28, 0xFB,
+    0x49, 0x0E, 0x14, 0x05, 0x94, 0x40, 0xF9, 0x83, 0x1C, 0x28, 0xDF, 0xE0, 0x49, 0x9C, 0x50, 0xA0,
+    0xE8, 0x23, 0x07, 0x4A, 0x3F, 0x72, 0xA0, 0xBC, 0x27, 0x26, 0x50, 0x02, 0x50, 0x82, 0x15, 0x7F,
+    0xA0, 0x00, 0x00, 0x03, 0x87, 0xE1, 0x7F, 0x4C, 0x72, 0xF9, 0xAA, 0x55, 0xFF, 0xC0, 0xB6, 0xFF,
+    0x19, 0x25, 0x49, 0x21, 0x21, 0xE1, 0x86, 0x2B, 0x54, 0x01, 0x83, 0x5A, 0xC3, 0x0A, 0xF3, 0x4C,
+    0x01, 0x4C, 0x23, 0x81, 0x70, 0xC7, 0x15, 0x5E, 0xBC, 0x70, 0xFF, 0xFF, 0x83, 0x79, 0xF8, 0xDB,
+    0xFF, 0xF5, 0xDF, 0x60, 0x51, 0xFE, 0xE7, 0xBF, 0xFF, 0x07, 0xA8, 0xB5, 0xC0, 0xF0, 0xE4, 0x9D,
+    0x00, 0x8D, 0x1C, 0x60, 0x10, 0xB2, 0x1B, 0x40, 0x03, 0xEF, 0x23, 0x48, 0xFE, 0x2F, 0x24, 0x58,
+    0xBE, 0x83, 0xF4, 0x7D, 0x83, 0x44, 0xC1, 0x3F, 0x90, 0xD0, 0x07, 0x70, 0x10, 0x04, 0x80, 0xED,
+    0x99, 0x00, 0x8E, 0xCA, 0x0D, 0x60, 0x23, 0x20, 0x9A, 0x3F, 0x41, 0x8C, 0xFE, 0x0B, 0x8A, 0x9C,
+    0x9F, 0x10, 0x2B, 0xBF, 0x81, 0x12, 0x08, 0x34, 0x90, 0x81, 0x9A, 0x99, 0x13, 0xA0, 0x4E, 0x04,
+    0x6A, 0xE6, 0xBA, 0x00, 0xB5, 0x1D, 0xA8, 0x59, 0x1E, 0x00, 0x43, 0xCD, 0x47, 0xAC, 0x24, 0x71,
+    0x57, 0xAE, 0x42, 0x06, 0xCC, 0x00, 0x3B, 0x00, 0x89, 0x4C, 0x50, 0x6E, 0xE7, 0x82, 0xE4, 0x02,
+    0x7F, 0x88, 0x5F, 0xDF, 0x43, 0x43, 0x9B, 0x13, 0x12, 0x96, 0xFE, 0x10, 0x1D, 0xEF, 0xA1, 0x1E,
+    0xE6, 0x84, 0x84, 0x9B, 0x3F, 0x00, 0x03, 0x03, 0xC7, 0xD2, 0x72, 0x53, 0x98, 0x6F, 0x20, 0xF9,
+    0x62, 0x3F, 0x44, 0x13, 0x2C, 0xCF, 0xE0, 0x4D, 0x5F, 0x20, 0x2B, 0x81, 0x61, 0xF9, 0x3F, 0x5B,
+    0xD9, 0x08, 0x94, 0x9B, 0xF4, 0xC1, 0x0E, 0xB5, 0x85, 0x5A, 0xBE, 0x1E, 0xA4, 0x10, 0x92, 0xA1,
+    0x41, 0x3A, 0x18, 0x17, 0xC0, 0x3D, 0x0C, 0x8C, 0x2D, 0x56, 0x44, 0x80, 0x01, 0x95, 0x72, 0x04,
+    0x84, 0x86, 0xB2, 0xC0, 0xA3, 0x86, 0x13, 0x11, 0xAF, 0x1F, 0xE0, 0x21, 0x86, 0x9B, 0x17, 0xB8,
+    0xE3, 0x2D, 0xC4, 0x31, 0x20, 0xDE, 0x36, 0xB8, 0xD3, 0x80, 0xBC, 0x2B, 0xFF, 0x91, 0x78, 0x05,
+    0xFF, 0x91, 0x79, 0xC0, 0xA0, 0xF8, 0x5F, 0xA3, 0xC2, 0x08, 0x31, 0x05, 0x14, 0xBF, 0x5A, 0x70,
+    0x33, 0x0F, 0xC0, 0x23, 0x01, 0xC4, 0xFB, 0x04, 0x0B, 0x4E, 0x30, 0x0F, 0x1E, 0x94, 0x60, 0xDE,
+    0x4F, 0x58, 0xAC, 0x80, 0x79, 0xBF, 0xE0, 0xBC, 0x8F, 0x10, 0x39, 0x16, 0x78, 0x5C, 0x73, 0x7D,
+    0x87, 0xB9, 0x1C, 0xE4, 0x0A, 0xAE, 0xCF, 0xB0, 0x08, 0x07, 0x15, 0x15, 0x5C, 0x17, 0xA0, 0xF9,
+    0x1B, 0xEC, 0x5A, 0x6E, 0x70, 0xD9, 0x30, 0xBB, 0xE3, 0x15, 0xD8, 0x9D, 0xBC, 0xD0, 0x4C, 0x07,
+    0x04, 0x7F, 0x41, 0x29, 0x70, 0x03, 0x94, 0x73, 0xFE, 0x20, 0x38, 0x4D, 0x7D, 0x87, 0x16, 0x0E,
+    0x13, 0xC0, 0x2E, 0x16, 0x78, 0x01, 0x8A, 0x2E, 0x09, 0x50, 0x60, 0x83, 0x73, 0x46, 0x50, 0x79,
+    0x18, 0xD4, 0x3D, 0x00, 0xFB, 0x0D, 0xF7, 0x3A, 0x2C, 0x48, 0x87, 0x28, 0x37, 0xB8, 0x3C, 0x9C,
+    0x09, 0xCE, 0x55, 0x00, 0x65, 0xA9, 0xF7, 0x12, 0x30, 0x2E, 0x34, 0x33, 0xB2, 0x41, 0xB8, 0x07,
+    0x91, 0x0A, 0x3A, 0x20, 0x17, 0x9E, 0x15, 0xB8, 0xA0, 0x29, 0x6A, 0x7D, 0x78, 0x29, 0x28, 0x95,
+    0xC7, 0x43, 0xB8, 0xFD, 0xD0, 0xA0, 0x7A, 0x0F, 0x0E, 0x2B, 0x48, 0x18, 0x3A, 0x80, 0x33, 0xE3,
+    0x6F, 0x78, 0xDC, 0x7D, 0x03, 0xC5, 0xFB, 0x6F, 0x78, 0xFE, 0xB9, 0x00, 0xD2, 0xFC, 0x1B, 0x16,
+    0x27, 0xA0, 0x98, 0x5D, 0x8F, 0xEC, 0x66, 0x50, 0x74, 0x22, 0x71, 0x41, 0x0A, 0x91, 0xB8, 0x40,
+    0xAB, 0x58, 0x90, 0xB8, 0x40, 0xA3, 0x59, 0x91, 0xB8, 0xC0, 0xB4, 0xC0, 0x86, 0xC4, 0x05, 0x25,
+    0x6E, 0x54, 0x2E, 0x07, 0x6E, 0x59, 0x34, 0xBD, 0x68, 0x26, 0xA3, 0xD9, 0x0B, 0x62, 0x62, 0xBA,
+    0x99, 0x09, 0xD5, 0x47, 0x5C, 0x70, 0xFF, 0xFA, 0x83, 0xB8, 0xD0, 0xF4, 0xFB, 0x1D, 0x1A, 0x1A,
+    0x90, 0x84, 0x17, 0x00, 0x2E, 0xC8, 0x7E, 0xC3, 0xCA, 0xC1, 0x1F, 0xE0, 0xC4, 0x8C, 0x1C, 0xCE,
+    0xFE, 0x20, 0xEE, 0xFD, 0x3F, 0x48, 0x85, 0xDE, 0xEF, 0xFF, 0xFB, 0x0F, 0xFC, 0x47, 0x14, 0x24,
+    0xBF, 0x81, 0x96, 0x41, 0x62, 0xF0, 0x3D, 0x0B, 0x98, 0x3B, 0x1F, 0x39, 0x7E, 0x21, 0x00, 0x1E,
+    0xFB, 0x00, 0x83, 0x80, 0xE0, 0xF2, 0x74, 0x78, 0xFC, 0x30, 0x04, 0x80, 0xC3, 0x15, 0x96, 0xEF,
+    0x0C, 0xFE, 0xA0, 0x64, 0x7E, 0x78, 0xBA, 0x66, 0x83, 0xC5, 0x17, 0x22, 0xC9, 0x81, 0x25, 0xB3,
+    0x4C, 0x92, 0x7F, 0x43, 0x32, 0x91, 0x01, 0x34, 0x59, 0x18, 0xFC, 0x05, 0xC7, 0xCB, 0x05, 0x58,
+    0xCC, 0x1D, 0x04, 0xA7, 0x8F, 0xAF, 0xB0, 0x10, 0x52, 0x00, 0x87, 0x3E, 0xDC, 0x6F, 0x20, 0xF7,
+    0xB1, 0x2A, 0xFC, 0x87, 0x07, 0x3B, 0xD0, 0x4B, 0x9C, 0x09, 0xF0, 0xB0, 0x01, 0x79, 0x8C, 0x67,
+    0x01, 0x2C, 0x1E, 0xC0, 0x0E, 0xE0, 0xBD, 0x80, 0x92, 0x58, 0x40, 0xB1, 0xCC, 0x8D, 0xCA, 0xE5,
+    0x44, 0xE2, 0x7E, 0x44, 0xE5, 0x22, 0x25, 0x07, 0x2C, 0xB2, 0x1F, 0x30, 0xB8, 0xC8, 0x26, 0xA3,
+    0xD9, 0x8B, 0xE4, 0x2A, 0x68, 0xFA, 0xF3, 0x47, 0x72, 0xA4, 0x02, 0x22, 0xD5, 0x5F, 0x00, 0x19,
+    0x83, 0xF0, 0x2F, 0x38, 0x81, 0x7E, 0x83, 0x1B, 0xFD, 0x07, 0x14, 0x2B, 0xF0, 0xB0, 0x82, 0x64,
+    0x16, 0x50, 0x48, 0x4A, 0x83, 0x82, 0xEA, 0x0F, 0x24, 0x85, 0x83, 0xC2, 0x39, 0xDB, 0x24, 0xE5,
+    0x37, 0x24, 0x89, 0x23, 0xC5, 0x42, 0x3C, 0x4A, 0x1C, 0xBD, 0x67, 0x41, 0x89, 0x41, 0x29, 0x94,
+    0xF8, 0xB5, 0x42, 0x38, 0x35, 0xB8, 0x3C, 0x1C, 0x12, 0xFB, 0x00, 0x43, 0x02, 0x1B, 0x60, 0xDE,
+    0x1B, 0x8A, 0x5C, 0x83, 0xB2, 0x74, 0x11, 0x04, 0x17, 0x9C, 0x41, 0x73, 0x61, 0xDC, 0x09, 0xD0,
+    0xB2, 0x07, 0xC2, 0x15, 0x80, 0xE6, 0xEC, 0xFF, 0x5B, 0xC1, 0xDC, 0x8B, 0x48, 0x85, 0x08, 0x3F,
+    0x24, 0x2D, 0xF4, 0x86, 0xB5, 0xFD, 0x85, 0x70, 0x41, 0x79, 0xD4, 0x0F, 0x64, 0xFA, 0x1F, 0x30,
+    0xF7, 0x01, 0xAC, 0x6C, 0x9A, 0x00, 0xE6, 0x7E, 0x83, 0xA7, 0xB7, 0x5F, 0x20, 0xEE, 0x1F, 0x78,
+    0xCA, 0x01, 0x46, 0x03, 0xBF, 0x02, 0x2C, 0xD6, 0xC0, 0xE9, 0x8E, 0x3F, 0x01, 0x91, 0x29, 0x40,
+    0xCE, 0x98, 0x00, 0x4F, 0x0E, 0x60, 0xEE, 0x01, 0x84, 0xAF, 0x40, 0xDC, 0x07, 0x88, 0xE4, 0x0F,
+    0xE2, 0x7E, 0x80, 0x45, 0x26, 0x9C, 0xCB, 0x85, 0xC4, 0xFD, 0x88, 0xCA, 0xFD, 0x80, 0xC1, 0xE5,
+    0xC6, 0x6D, 0x32, 0x9A, 0xBD, 0x13, 0x10, 0x19, 0x0D, 0xC4, 0x0D, 0x80, 0x27, 0x44, 0x50, 0x7A,
+    0xE2, 0x17, 0x40, 0xF5, 0x11, 0x28, 0xA8, 0x58, 0x11, 0xFE, 0x05, 0xA5, 0x34, 0x68, 0x68, 0xFC,
+    0x01, 0x71, 0x81, 0x79, 0xE1, 0x3C, 0x23, 0x34, 0x7B, 0x00, 0xB9, 0x0E, 0xA8, 0x21, 0x09, 0x2E,
+    0x47, 0x80, 0xE1, 0xFC, 0x07, 0x1A, 0xEC, 0x1B, 0xE0, 0x25, 0x19, 0xC4, 0x45, 0xB0, 0xF2, 0x29,
+    0x0D, 0xC2, 0x85, 0x56, 0x40, 0xBE, 0x0E, 0x50, 0xF7, 0x4E, 0x82, 0xC4, 0xAF, 0x01, 0x6A, 0xEC,
+    0x83, 0x00, 0x00, 0x83, 0x80, 0xA0, 0xF2, 0x70, 0x78, 0xFC, 0x30, 0x28, 0xBC, 0x04, 0xF9, 0xD4,
+    0x1B, 0xCA, 0x83, 0x65, 0x1B, 0x6D, 0x08, 0x17, 0x9E, 0xC6, 0x58, 0x18, 0x50, 0x12, 0x99, 0x3F,
+    0x34, 0x44, 0xFF, 0xE7, 0x98, 0xA4, 0xFC, 0x86, 0x24, 0x3A, 0x50, 0x30, 0x81, 0x8A, 0x0C, 0x83,
+    0xBF, 0x60, 0xC7, 0x4C, 0x80, 0xC5, 0xD5, 0x45, 0xB0, 0xEA, 0x8F, 0xB0, 0xC8, 0x32, 0x00, 0xA7,
+    0x87, 0x9F, 0x30, 0x77, 0x82, 0x62, 0x91, 0x91, 0x01, 0xE6, 0x65, 0xB0, 0xEF, 0x59, 0x03, 0xE0,
+    0x21, 0x02, 0x8E, 0xC3, 0x09, 0x88, 0xF4, 0x00, 0xF4, 0x27, 0xCF, 0x01, 0x58, 0xB4, 0x80, 0xA3,
+    0x82, 0x0F, 0xA8, 0x62, 0xFD, 0x2A, 0x08, 0xB8, 0x05, 0x94, 0xF9, 0x80, 0x52, 0x4C, 0xF0, 0x7F,
+    0x44, 0xE1, 0xCA, 0x7F, 0xC2, 0xCB, 0xFD, 0x08, 0x8F, 0x2A, 0x98, 0xDD, 0xDC, 0x48, 0xDC, 0x07,
+    0xF0, 0xD8, 0x86, 0x39, 0x45, 0x1E, 0x89, 0xDB, 0x80, 0x70, 0x33, 0xD4, 0x97, 0xF7, 0x91, 0x8B,
+    0x90, 0xBF, 0x88, 0x64, 0x99, 0x08, 0x89, 0x26, 0x98, 0x97, 0xFE, 0x70, 0x81, 0x13, 0x12, 0x34,
+    0xDD, 0x1C, 0xFC, 0x7F, 0x9E, 0x09, 0x9C, 0xF4, 0xC0, 0x86, 0x05, 0xFC, 0x03, 0x07, 0x13, 0xA8,
+    0xF4, 0x9D, 0x67, 0x6A, 0xD4, 0xFA, 0x17, 0x92, 0xD3, 0x0A, 0x50, 0x8B, 0x41, 0x50, 0x90, 0x21,
+    0xCA, 0x01, 0x44, 0x0C, 0x9E, 0x67, 0x46, 0x8E, 0xDF, 0x75, 0x2C, 0x70, 0xB7, 0x38, 0x95, 0xA5,
+    0x9B, 0x82, 0x19, 0x00, 0x83, 0x5A, 0xBE, 0x62, 0x77, 0x17, 0x2B, 0x22, 0x9B, 0xF1, 0x33, 0xC0,
+    0x13, 0x10, 0x1F, 0xD4, 0x90, 0xFF, 0x10, 0x0F, 0x29, 0x40, 0xE2, 0x97, 0x1B, 0xE2, 0xED, 0xFF,
+    0xB5, 0xCA, 0x46, 0xCC, 0x10, 0x6B, 0x61, 0x91, 0xF2, 0x0D, 0xE6, 0x71, 0xB0, 0xF7, 0x58, 0xA1,
+    0xCC, 0x3F, 0xF0, 0x00, 0x06, 0x86, 0xDD, 0x7B, 0x04, 0xF3, 0x3E, 0x71, 0xCC, 0x4F, 0xB0, 0xD4,
+    0xCA, 0x47, 0x98, 0x19, 0x10, 0x1A, 0x0A, 0xA4, 0x43, 0x43, 0x43, 0x59, 0x49, 0xB2, 0x62, 0x94,
+    0x09, 0x61, 0x02, 0x00, 0x83, 0x78, 0xAD, 0x2C, 0x5D, 0x04, 0x2D, 0x75, 0xD7, 0x82, 0x82, 0x42,
+    0x1E, 0xE2, 0x3B, 0x70, 0xC6, 0x35, 0x00, 0x73, 0x61, 0xD9, 0xE2, 0xBF, 0x1B, 0x98, 0xFB, 0x10,
+    0x96, 0x8C, 0xF6, 0x83, 0xB9, 0xA0, 0x80, 0xEC, 0x0D, 0x6B, 0x03, 0x27, 0x2E, 0x79, 0x70, 0x02,
+    0xF7, 0x03, 0x99, 0xFE, 0x07, 0xCC, 0x7D, 0x00, 0xCB, 0xD8, 0x13, 0xC0, 0xDC, 0x6F, 0xF0, 0xC8,
+    0xFA, 0x05, 0xE2, 0xFE, 0x81, 0x07, 0x3B, 0x30, 0x96, 0xE4, 0x05, 0x10, 0x09, 0x0E, 0xC4, 0x0D,
+    0x40, 0xA4, 0x28, 0x50, 0x60, 0x37, 0xC0, 0xC3, 0x12, 0xCC, 0x3D, 0x00, 0x8B, 0x16, 0x08, 0xF7,
+    0x02, 0x22, 0xED, 0x80, 0xB8, 0xF0, 0x98, 0x80, 0x70, 0x3F, 0xC0, 0x02, 0x06, 0xCE, 0xE5, 0xC2,
+    0x2D, 0x8B, 0xA6, 0x17, 0xCD, 0xE4, 0x0D, 0xA8, 0xF6, 0xA2, 0xB9, 0x0A, 0xC9, 0xCD, 0x1B, 0x20,
+    0x3E, 0xBA, 0x8F, 0xE4, 0x23, 0x50, 0x50, 0x41, 0xFD, 0xFB, 0x11, 0xC4, 0xFD, 0x0A, 0x0F, 0x8D,
+    0xDF, 0x20, 0x2E, 0xD0, 0xA6, 0xF3, 0x8C, 0x50, 0x93, 0x80, 0x5C, 0x07, 0x68, 0x48, 0x2A, 0x40,
+    0x42, 0x12, 0x9C, 0x09, 0x11, 0xE1, 0x0C, 0xC9, 0xC1, 0x50, 0x20, 0x8F, 0x94, 0xB9, 0x97, 0x41,
+    0xB8, 0xD0, 0xD2, 0xDB, 0x17, 0x96, 0x4E, 0x17, 0x41, 0xE2, 0x77, 0x01, 0xCC, 0xF9, 0x90, 0xD8,
+    0x5F, 0x80, 0xF0, 0x0D, 0x34, 0x01, 0xF1, 0x21, 0x71, 0x3F, 0x20, 0x42, 0x02, 0x9A, 0xAA, 0x80,
+    0xB9, 0xE8, 0x22, 0x0B, 0x94, 0xFB, 0x17, 0x9C, 0xA4, 0xFE, 0xF8, 0xC3, 0x33, 0xF1, 0x7D, 0xB0,
+    0xA7, 0x39, 0x60, 0xA9, 0x3C, 0x1F, 0x9C, 0xD9, 0xDE, 0x6B, 0x00, 0x53, 0xF4, 0x35, 0x48, 0xC9,
+    0x09, 0x2E, 0x9D, 0xCE, 0x9D, 0xFE, 0x07, 0x2B, 0x4B, 0xE0, 0x65, 0x23, 0xA4, 0x32, 0x10, 0xF8,
+    0x05, 0x4B, 0x57, 0x90, 0x14, 0x6A, 0x00, 0xE1, 0x9F, 0x87, 0x59, 0xC8, 0x30, 0xF5, 0xCD, 0xFF,
+    0x7B, 0x59, 0xE0, 0xCC, 0x00, 0x00, 0xFB, 0x05, 0xF7, 0x3A, 0x34, 0x04, 0x87, 0x10, 0xCF, 0xB1,
+    0x2C, 0x9D, 0x05, 0xCE, 0x3B, 0x0A, 0x8A, 0x1E, 0x6F, 0x28, 0x0F, 0x5A, 0xDC, 0x70, 0x81, 0x79,
+    0x01, 0xD0, 0xA4, 0x7E, 0x1E, 0xCC, 0xFB, 0x86, 0x28, 0x31, 0xC0, 0x69, 0xF9, 0x7C, 0x7A, 0xEA,
+    0xCB, 0xFF, 0xA0, 0x04, 0x06, 0xE2, 0xED, 0x67, 0x82, 0x84, 0xCB, 0x7C, 0x30, 0x8F, 0x1D, 0x9A,
+    0x0A, 0xDE, 0x83, 0x78, 0xF5, 0xF0, 0x94, 0xCC, 0xF4, 0x0B, 0x16, 0xB9, 0x20, 0xA5, 0xAC, 0xBF,
+    0x60, 0xB1, 0x02, 0x0A, 0x6B, 0x36, 0x84, 0x3B, 0x41, 0x09, 0x0F, 0x85, 0xC7, 0x31, 0xCA, 0x23,
+    0x86, 0x07, 0x00, 0x63, 0x28, 0x11, 0x05, 0xBA, 0xED, 0x3D, 0x33, 0x50, 0x1D, 0x2F, 0xD0, 0x3D,
+    0xFC, 0x40, 0x41, 0x7E, 0x60, 0xC0, 0x70, 0x3A, 0xFC, 0xE9, 0x63, 0xC0, 0x05, 0x80, 0x3E, 0xE0,
+    0x18, 0x68, 0x0C, 0x00, 0x03, 0x81, 0x40, 0x77, 0x68, 0x96, 0xE2, 0x86, 0xF8, 0x21, 0x1E, 0x12,
+    0x56, 0xF3, 0x21, 0x54, 0x3F, 0x24, 0x5E, 0xC0, 0x31, 0xF0, 0xE2, 0x3C, 0x0B, 0x03, 0x29, 0xA0,
+    0x01, 0xE2, 0xEB, 0x91, 0x4C, 0x41, 0x83, 0x6E, 0x03, 0x24, 0xED, 0x7C, 0x02, 0xA7, 0x10, 0x03,
+    0x60, 0x02, 0xE2, 0xFA, 0x70, 0x0F, 0x94, 0xCD, 0x58, 0x3F, 0x40, 0x12, 0xF1, 0x07, 0x48, 0xC1,
+    0x01, 0xA2, 0xCE, 0x33, 0x32, 0x4C, 0x78, 0xF3, 0x7F, 0x2D, 0x30, 0xA4, 0x01, 0xD5, 0x94, 0xC1,
+    0x0D, 0xC2, 0x30, 0x14, 0x43, 0x25, 0xAE, 0x30, 0x02, 0xAC, 0x80, 0x18, 0x81, 0x6E, 0xD4, 0x0D,
+    0x60, 0x14, 0x46, 0x60, 0x04, 0x56, 0x81, 0x05, 0x38, 0x54, 0xA2, 0x22, 0x20, 0x85, 0xF8, 0xFB,
+    0xDB, 0x11, 0x17, 0xEE, 0x1C, 0x5F, 0xAA, 0xC8, 0xA9, 0xED, 0xFF, 0x8B, 0xAE, 0xCA, 0xC1, 0x7F,
+    0xA6, 0x1B, 0x76, 0x87, 0x08, 0x25, 0xDA, 0xF8, 0x5B, 0x1B, 0x95, 0xFB, 0x42, 0x84, 0xDD, 0xB6,
+    0xF5, 0xBD, 0x0B, 0x0B, 0x98, 0xF4, 0x66, 0x50, 0xA4, 0x33, 0x4B, 0x94, 0x54, 0x32, 0xA2, 0xA0,
+    0x93, 0x8A, 0x12, 0xF4, 0x54, 0x66, 0xA0, 0xA3, 0x67, 0x17, 0xF4, 0xF0, 0x38, 0x34, 0x1A, 0xAA,
+    0xA7, 0xEC, 0xF7, 0x5C, 0xD5, 0xBE, 0x62, 0x44, 0x87, 0x2F, 0xCA, 0x10, 0x41, 0xEB, 0x97, 0x8A,
+    0x5F, 0x60, 0xC0, 0xB5, 0x7A, 0x0B, 0xB7, 0xE3, 0xBD, 0x1E, 0x53, 0xA2, 0x3D, 0x73, 0x16, 0xCE,
+    0xFF, 0x17, 0x92, 0x24, 0x38, 0xB6, 0xEC, 0x7E, 0x4E, 0x7C, 0x78, 0xD2, 0x48, 0x2B, 0xE4, 0x27,
+    0x25, 0x45, 0x94, 0x14, 0xED, 0x62, 0x57, 0x39, 0x95, 0x90, 0x34, 0x85, 0xA4, 0x09, 0x92, 0xAB,
+    0x9E, 0x26, 0x24, 0x3F, 0x03, 0xBA, 0x86, 0x63, 0xA8, 0x62, 0x00, 0x83, 0x80, 0xA0, 0xF2, 0x70,
+    0x68, 0x14, 0x38, 0x96, 0xA5, 0xB3, 0x40, 0xC2, 0x64, 0x3F, 0x83, 0xC2, 0x4B, 0x90, 0x97, 0x35,
+    0x41, 0xDC, 0xEB, 0x20, 0x56, 0x0C, 0x58, 0xFC, 0x3C, 0xC8, 0x04, 0x68, 0xF2, 0x7C, 0x0A, 0x61,
+    0xE9, 0x82, 0xC5, 0x0F, 0xC0, 0xD2, 0x3B, 0x34, 0x3F, 0x80, 0xE3, 0xF5, 0xF7, 0xFF, 0xF7, 0xF0,
+    0xB4, 0xC6, 0xFE, 0x0B, 0xC6, 0x92, 0x83, 0xC4, 0x5D, 0x6F, 0x58, 0x19, 0x48, 0xB2, 0x1F, 0x98,
+    0x9A, 0xC3, 0x53, 0x6F, 0x80, 0xD3, 0xCD, 0x6F, 0x68, 0x39, 0xA3, 0x00, 0x56, 0xB0, 0x9F, 0x09,
+    0x9A, 0x6F, 0x40, 0xE2, 0xFB, 0x61, 0x01, 0x09, 0x0D, 0x40, 0x50, 0x5C, 0xB1, 0xFE, 0x86, 0xA5,
+    0x14, 0x01, 0x44, 0x5A, 0x00, 0xBA, 0x8F, 0xE3, 0x37, 0xCC, 0xBB, 0xA0, 0x50, 0x86, 0x06, 0x31,
+    0x30, 0x74, 0x78, 0x7E, 0xC3, 0xA3, 0xFA, 0x1B, 0x2C, 0x36, 0x41, 0x91, 0xC5, 0x8B, 0x10, 0xFF,
+    0x02, 0x17, 0x07, 0x7A, 0x88, 0x0F, 0x21, 0xFE, 0x19, 0x1E, 0xB9, 0x40, 0x71, 0x7E, 0x14, 0x71,
+    0x4E, 0x1C, 0xE2, 0xEC, 0xA3, 0xE2, 0xC3, 0x4D, 0x1C, 0x00, 0x83, 0x00, 0xC7, 0xB2, 0x74, 0x16,
+    0x48, 0x08, 0x02, 0x7D, 0x7B, 0x14, 0xE4, 0x51, 0x6F, 0x30, 0xEF, 0x3C, 0x2C, 0xE3, 0x72, 0x81,
+    0x78, 0xF7, 0x03, 0xA0, 0x89, 0xE6, 0x3C, 0x98, 0xF7, 0x15, 0x91, 0xF7, 0xC0, 0xA9, 0xE2, 0x7C,
+    0x7A, 0xEA, 0xCB, 0xFF, 0xA0, 0xA8, 0x02, 0xF1, 0xF6, 0x33, 0x41, 0x6C, 0x98, 0x0F, 0xE6, 0xB1,
+    0x43, 0xC3, 0xF3, 0x3D, 0x88, 0x57, 0x0F, 0x4F, 0x13, 0x4C, 0xBF, 0x60, 0xC1, 0x04, 0x52, 0xCA,
+    0xFA, 0x0B, 0xE6, 0x3F, 0x90, 0xAB, 0xD9, 0x7E, 0xC1, 0x23, 0x05, 0x14, 0x85, 0x28, 0x3C, 0x8E,
+    0x51, 0x1E, 0x31, 0x3C, 0x00, 0x83, 0x00, 0xA7, 0xB2, 0x74, 0x11, 0x44, 0x38, 0x2A, 0xBC, 0x00,
+    0x79, 0xB5, 0x17, 0x26, 0x29, 0xF0, 0x8B, 0x88, 0x74, 0x0C, 0x06, 0x2C, 0xD0, 0x18, 0xFA, 0xDF,
+    0x67, 0x1A, 0xF2, 0x12, 0x9A, 0xB1, 0x40, 0x71, 0x99, 0x0F, 0xB5, 0xF7, 0x3E, 0x24, 0xB4, 0xDE,
+    0x33, 0xC1, 0xC2, 0x93, 0x13, 0x96, 0xEB, 0xA1, 0x1A, 0x21, 0xC9, 0x8D, 0x1D, 0x9E, 0x18, 0xE6,
+    0x83, 0x82, 0xE0, 0x3E, 0x03, 0x3C, 0x34, 0xFE, 0x33, 0x26, 0xC0, 0x03, 0x07, 0x1C, 0x7E, 0xAC,
+    0x0B, 0x50, 0xD3, 0x06, 0x27, 0x22, 0x0A, 0xC0, 0xF1, 0xCD, 0xF3, 0x01, 0x16, 0x10, 0x90, 0xE8,
+    0xE1, 0xFF, 0x08, 0x4F, 0xE5, 0xE0, 0x38, 0xE1, 0x47, 0x4A, 0x0F, 0xE0, 0x88, 0x44, 0xE6, 0x4F,
+    0x40, 0xE3, 0x83, 0xE4, 0xD1, 0xF5, 0x23, 0x9B, 0x0F, 0x0C, 0x74, 0x7E, 0x34, 0xFB, 0x79, 0x11,
+    0x89, 0x03, 0xEC, 0x55, 0x4E, 0x74, 0xF7, 0x23, 0xF9, 0x0F, 0x94, 0x4B, 0x18, 0x41, 0xFE, 0x47,
+    0xA4, 0xBF, 0xF9, 0x04, 0xCB, 0x47, 0x70, 0xF8, 0xC6, 0x41, 0x23, 0xF8, 0x3E, 0x2C, 0xFC, 0x7B,
+    0x4D, 0x83, 0x5F, 0xC0, 0x0A, 0x36, 0x07, 0xB4, 0xF8, 0x41, 0x14, 0x13, 0x76, 0xB0, 0x4C, 0x88,
+    0x96, 0x69, 0x21, 0xF1, 0xDF, 0xC7, 0x84, 0x48, 0x11, 0xC0, 0xF4, 0xA1, 0x02, 0x61, 0x01, 0x00,
+    0x83, 0x80, 0xE0, 0xF2, 0x70, 0x26, 0x68, 0x90, 0xCE, 0x67, 0x30, 0x00, 0xC5, 0xF1, 0x7B, 0x09,
+    0x08, 0x77, 0x3D, 0x34, 0xDB, 0xBC, 0x67, 0x03, 0x73, 0xF7, 0xC3, 0x92, 0xDC, 0x7C, 0x30, 0xF7,
+    0xFD, 0x5F, 0xA4, 0xFC, 0x07, 0x8E, 0x8E, 0x79, 0x61, 0x6D, 0xA0, 0xB4, 0x15, 0x0F, 0xE1, 0x82,
+    0x32, 0xAB, 0xC2, 0x1F, 0x70, 0xEA, 0x01, 0x72, 0xCF, 0x33, 0xC2, 0xE2, 0x98, 0x03, 0xC4, 0x95,
+    0x83, 0xC7, 0x22, 0x1F, 0x88, 0x80, 0xB8, 0x0E, 0xE4, 0x05, 0x7F, 0x10, 0x17, 0x91, 0xF6, 0xE7,
+    0x23, 0x71, 0x15, 0x40, 0x61, 0x81, 0xE0, 0x82, 0x62, 0x02, 0x99, 0x0B, 0x74, 0x39, 0x33, 0x12,
+    0x17, 0xE8, 0x55, 0x16, 0x24, 0x2E, 0x28, 0x2C, 0x90, 0xB8, 0xC0, 0x70, 0x65, 0x43, 0xE5, 0xB2,
+    0xE3, 0x96, 0x45, 0xD3, 0x8B, 0x66, 0x32, 0x9A, 0xBD, 0xA8, 0xAE, 0x52, 0x00, 0x25, 0x52, 0x04,
+    0xB7, 0x00, 0xEA, 0x23, 0x26, 0x78, 0x4A, 0xB1, 0x07, 0x71, 0x79, 0xE1, 0x69, 0x82, 0x17, 0xC4,
+    0x5D, 0x0F, 0x8F, 0x68, 0x36, 0x70, 0x48, 0xEA, 0x40, 0x25, 0xEF, 0x43, 0xC3, 0x39, 0xDB, 0x24,
+    0xF8, 0x27, 0xA4, 0xE8, 0xFA, 0x8D, 0x54, 0x0A, 0xB2, 0x81, 0xB9, 0x8F, 0x91, 0x8A, 0x01, 0x20,
+    0x57, 0x00, 0x9A, 0x67, 0x59, 0x20, 0x5C, 0x68, 0xFC, 0x72, 0x40, 0xC3, 0x1E, 0x35, 0xF6, 0xFF,
+    0x23, 0x17, 0x73, 0x43, 0x82, 0x0B, 0x00, 0x83, 0x78, 0xAD, 0x2C, 0x5D, 0x15, 0x2D, 0x75, 0xD7,
+    0x82, 0x9C, 0x01, 0xF2, 0xED, 0x42, 0x68, 0xB6, 0x0B, 0x00, 0x73, 0x15, 0x60, 0x89, 0x3C, 0x03,
+    0xCC, 0x7D, 0x84, 0x94, 0x03, 0xF9, 0x21, 0xA9, 0xAA, 0xC6, 0x24, 0xE5, 0x17, 0x84, 0x5B, 0x00,
+    0x2D, 0x32, 0xC0, 0x19, 0x8F, 0x1F, 0xE4, 0xB6, 0xF3, 0x8C, 0xB0, 0x84, 0xCF, 0x0F, 0x72, 0x06,
+    0x34, 0xB2, 0xBE, 0x81, 0xB8, 0x7F, 0xE1, 0xC1, 0x0E, 0x8C, 0x25, 0x7E, 0x03, 0x98, 0x97, 0xC1,
+    0x21, 0xC9, 0x9F, 0x80, 0x48, 0x51, 0xC0, 0x70, 0xE4, 0x9F, 0x00, 0x0F, 0x4B, 0x30, 0xF7, 0x02,
+    0x2C, 0x5A, 0x20, 0xDC, 0x07, 0x88, 0xB4, 0x03, 0xE2, 0x7E, 0x80, 0x85, 0x04, 0x9C, 0xCB, 0x85,
+    0xC4, 0xFD, 0x88, 0xCA, 0xFD, 0x80, 0xC1, 0xE5, 0xC6, 0x6D, 0xF2, 0x01, 0x54, 0x7B, 0x27, 0x20,
+    0x52, 0xE9, 0x06, 0x88, 0x9B, 0xEB, 0x91, 0xB8, 0x0A, 0x08, 0x1F, 0x81, 0x3C, 0x08, 0x0A, 0x2A,
+    0x56, 0x24, 0xEE, 0x37, 0x78, 0x68, 0xFC, 0x00, 0x71, 0x1F, 0xC0, 0xD2, 0x75, 0x02, 0x38, 0xAC,
+    0x40, 0x21, 0xA6, 0x0B, 0x2B, 0x29, 0xF8, 0x21, 0x09, 0x36, 0xDB, 0x24, 0xF8, 0x25, 0x34, 0xD8,
+    0x0F, 0xA2, 0xC6, 0x82, 0x00, 0xB4, 0xE8, 0xFA, 0xBF, 0x03, 0xE2, 0x40, 0x68, 0xF1, 0x11, 0xB7,
+    0x01, 0xEA, 0x5E, 0x68, 0xFC, 0xC2, 0xB8, 0xD0, 0xD8, 0xDF, 0x80, 0xF0, 0x0D, 0xCC, 0xCD, 0x43,
+    0x82, 0x0B, 0x00, 0x83, 0x78, 0xAD, 0x2C, 0x1C, 0x9C, 0x65, 0x0B, 0x80, 0xE1, 0xCE, 0x06, 0x64,
+    0x08, 0x80, 0x42, 0x04, 0xC8, 0xF8, 0x7F, 0xE1, 0x3F, 0x94, 0xF1, 0x0B, 0xC6, 0xF8, 0x0F, 0x67,
+    0xBC, 0xB7, 0x60, 0x14, 0x60, 0xFC, 0x05, 0x73, 0xC9, 0x2F, 0x98, 0xA3, 0x7F, 0xC1, 0x6C, 0xFE,
+    0x05, 0xB3, 0xE7, 0x17, 0x2C, 0x74, 0x87, 0x07, 0x03, 0x00, 0x83, 0x78, 0x2D, 0xB5, 0xDC, 0x0C,
+    0xEE, 0x9D, 0x63, 0xE0, 0x50, 0x85, 0x86, 0xC1, 0x53, 0x68, 0x06, 0x62, 0x85, 0x7A, 0xF4, 0x3F,
+    0x3C, 0x6F, 0x41, 0x42, 0x1F, 0x96, 0xF7, 0x40, 0x2E, 0x9A, 0xE7, 0xEA, 0x7C, 0x1C, 0x12, 0x30,
+    0x1F, 0xA1, 0x4A, 0x9E, 0x80, 0x53, 0xCA, 0x77, 0xA8, 0x63, 0x41, 0xB1, 0xCA, 0x06, 0xD2, 0xC6,
+    0x08, 0x73, 0x19, 0x0F, 0x30, 0x24, 0xEF, 0xC3, 0x83, 0x8E, 0x1F, 0x98, 0x4C, 0xA0, 0xBC, 0x05,
+    0xEF, 0xDE, 0xF1, 0x81, 0xBC, 0xCB, 0x88, 0x88, 0xDC, 0x1F, 0x88, 0x34, 0x06, 0x89, 0xBB, 0xF7,
+    0xE2, 0x70, 0x1E, 0xB8, 0x7C, 0xAA, 0x81, 0xA7, 0x30, 0x48, 0x7E, 0xEA, 0x81, 0xF2, 0x13, 0x20,
+    0xF9, 0xF2, 0xBD, 0x06, 0x84, 0xDB, 0x08, 0xCD, 0xA6, 0x5A, 0xD0, 0xC0, 0x7E, 0x89, 0x94, 0xE9,
+    0x81, 0x20, 0xE9, 0xD6, 0x7F, 0x94, 0xC8, 0x4D, 0xFC, 0x8B, 0x94, 0x3C, 0x81, 0xB1, 0xF4, 0x0F,
+    0x16, 0xB1, 0xB0, 0xB8, 0x94, 0x4F, 0x48, 0x4B, 0x63, 0x81, 0xA7, 0x5E, 0xFF, 0x0F, 0xB0, 0x80,
+    0x07, 0x45, 0x68, 0xFE, 0x05, 0x58, 0x8A, 0x01, 0x47, 0xEF, 0x04, 0xB8, 0xC1, 0xC0, 0xA4, 0x65,
+    0x6F, 0xF0, 0x1F, 0x16, 0x23, 0x9F, 0x40, 0xC9, 0xE6, 0x37, 0x34, 0xD6, 0x1D, 0xFE, 0x81, 0x82,
+    0xEB, 0x21, 0x28, 0x3C, 0xDD, 0x8C, 0x5B, 0xFF, 0x80, 0x43, 0xD0, 0x00, 0x51, 0x98, 0xF8, 0x23,
+    0xE7, 0x73, 0x3C, 0xE5, 0x9A, 0x06, 0xCC, 0x89, 0x8E, 0x65, 0xE5, 0x6E, 0xE0, 0x60, 0x04, 0x00,
+    0x83, 0x04, 0x1B, 0x3C, 0x3A, 0x29, 0x66, 0xFD, 0x86, 0x25, 0x2C, 0x16, 0xFC, 0xAC, 0x90, 0xD0,
+    0x50, 0x20, 0x15, 0x16, 0x1A, 0xCA, 0x48, 0x6D, 0x17, 0xD0, 0x9D, 0xF5, 0x13, 0x99, 0xC5, 0xC4,
+    0x00, 0x0B, 0x5B, 0x48, 0xB0, 0x83, 0xC2, 0x9D, 0x07, 0x9E, 0xDE, 0xEE, 0x67, 0x4C, 0x67, 0x61,
+    0x80, 0x66, 0x39, 0x70, 0x4C, 0x39, 0xC0, 0x59, 0xA0, 0x78, 0x81, 0xB2, 0x1C, 0xFE, 0xC0, 0x13,
+    0xA1, 0x42, 0x69, 0xBA, 0x28, 0x03, 0x00, 0xFB, 0x03, 0x8F, 0x59, 0xA0, 0x35, 0x6C, 0xA3, 0x3C,
+    0x62, 0x78, 0xBF, 0xE1, 0xC9, 0x05, 0xC4, 0xFB, 0x05, 0x0B, 0x7C, 0x50, 0xC8, 0xB2, 0xFD, 0x80,
+    0x85, 0x37, 0x28, 0x27, 0xB0, 0x7D, 0x81, 0x45, 0x03, 0x28, 0xB3, 0xB3, 0x7D, 0x84, 0x45, 0xF6,
+    0x17, 0x10, 0x0F, 0x98, 0x22, 0xDE, 0xB3, 0xC0, 0x0A, 0x36, 0x36, 0x50, 0x76, 0x3D, 0x1F, 0x9E,
+    0x7A, 0x02, 0x52, 0xAA, 0x42, 0xB3, 0x19, 0xB4, 0x8C, 0x05, 0xA5, 0x2B, 0x48, 0x36, 0xFF, 0x04,
+    0x8E, 0x5F, 0xA8, 0x24, 0x07, 0x24, 0xB6, 0x1D, 0x40, 0xC9, 0xF7, 0xBD, 0x26, 0x28, 0x75, 0x83,
+    0xE3, 0x3E, 0xA5, 0x3C, 0x1C, 0x92, 0x4A, 0x18, 0x00, 0x4D, 0x94, 0xE1, 0x0D, 0xC2, 0x20, 0x14,
+    0x84, 0x25, 0x26, 0xFD, 0x53, 0x77, 0x90, 0x11, 0xBA, 0x89, 0x6E, 0xD2, 0x8E, 0xC0, 0x28, 0x6E,
+    0xA0, 0x1B, 0xD0, 0x11, 0xBA, 0x41, 0x5D, 0xC1, 0x90, 0x68, 0x4D, 0xB4, 0x2D, 0x1C, 0xF7, 0xE0,
+    0xFD, 0x83, 0x84, 0x1C, 0xDF, 0xBB, 0x3B, 0xF8, 0x95, 0xD1, 0x81, 0xF3, 0x91, 0xE3, 0x29, 0xB3,
+    0x39, 0xE9, 0xB5, 0x0A, 0xEA, 0x21, 0x06, 0xA4, 0xA0, 0xCE, 0x0A, 0xF9, 0x89, 0x73, 0x9B, 0x78,
+    0x15, 0x80, 0xF1, 0x15, 0xE9, 0x05, 0x8B, 0x20, 0xD2, 0x2B, 0xF2, 0x9F, 0x28, 0xDD, 0x65, 0x07,
+    0x1C, 0xA5, 0x5D, 0xB6, 0xD0, 0x52, 0x7A, 0x2A, 0x83, 0x7A, 0x0A, 0x1F, 0x39, 0x8C, 0x81, 0xF0,
+    0xAC, 0xC7, 0xFE, 0xD3, 0xB7, 0x1B, 0xA4, 0xAD, 0xC4, 0x72, 0xC5, 0xC2, 0x49, 0x22, 0xF1, 0xFE,
+    0x1E, 0xC2, 0x8D, 0x8C, 0xED, 0xD1, 0x85, 0x43, 0x61, 0x37, 0xD1, 0xA3, 0x7B, 0xED, 0x5E, 0x13,
+    0x6F, 0x67, 0x48, 0xC9, 0xF9, 0xD6, 0x96, 0x94, 0x71, 0xC7, 0x50, 0xDE, 0x4D, 0xC2, 0xEC, 0x47,
+    0x55, 0xF5, 0xF7, 0xE6, 0x5F, 0x44, 0x24, 0xE6, 0x22, 0xD1, 0x66, 0x4C, 0x55, 0xEC, 0xFC, 0x60,
+    0x4F, 0xB5, 0xCD, 0x6B, 0x6D, 0xA2, 0x7C, 0x12, 0xA6, 0x6E, 0x83, 0x7E, 0x45, 0xC0, 0xBC, 0xA8,
+    0xED, 0x50, 0x11, 0xD9, 0x23, 0x22, 0xEE, 0x85, 0x54, 0xCB, 0x91, 0x82, 0x50, 0x10, 0xAC, 0xDA,
+    0xAA, 0xB5, 0x3C, 0xB9, 0x66, 0x80, 0x21, 0x10, 0x02, 0x19, 0x2C, 0x21, 0x6C, 0x06, 0x9A, 0x81,
+    0x64, 0xA0, 0x19, 0xB8, 0x19, 0x48, 0x06, 0x70, 0x30, 0x00, 0x43, 0x30, 0x04, 0x41, 0x45, 0x14,
+    0xF5, 0xED, 0xF4, 0xFC, 0x9E, 0xB7, 0xBD, 0xE8, 0x85, 0x79, 0xDD, 0xD3, 0x9F, 0xE9, 0xED, 0x4D,
+    0xF2, 0x28, 0x71, 0xEE, 0x50, 0x6D, 0x64, 0x82, 0xCC, 0x5D, 0xAE, 0xD1, 0xC1, 0xB8, 0x2F, 0x82,
+    0xE9, 0x42, 0xCF, 0x7D, 0xFC, 0xDA, 0xDE, 0xB5, 0x2B, 0x39, 0x10, 0xE7, 0xDC, 0x76, 0x6E, 0xAC,
+    0x55, 0x04, 0xB2, 0xC2, 0x56, 0x4B, 0xA3, 0x24, 0xCF, 0xA5, 0xFC, 0xA1, 0x1D, 0x0F, 0xD8, 0x31,
+    0x51, 0x90, 0x2F, 0x06, 0x50, 0x2D, 0x54, 0xAB, 0x92, 0xA7, 0x5A, 0xD9, 0x27, 0x87, 0x45, 0x1B,
+    0x75, 0xF7, 0x93, 0xC9, 0x8F, 0xC5, 0x93, 0x46, 0x32, 0x7B, 0x62, 0x6D, 0xD6, 0xE2, 0xC7, 0x31,
+    0x54, 0xA5, 0xAC, 0x7F, 0xE5, 0xE0, 0x64, 0x62, 0xDD, 0x39, 0xCC, 0x73, 0x99, 0x1B, 0x84, 0x9A,
+    0x78, 0x71, 0x0F, 0xC9, 0x54, 0x82, 0xA8, 0x8B, 0x0C, 0x8C, 0xF4, 0xA2, 0xA7, 0x06, 0x24, 0x32,
+    0x55, 0x9E, 0x1D, 0xFC, 0xC9, 0x90, 0xB3, 0x0E, 0xE3, 0x85, 0x9A, 0xD3, 0x42, 0xDA, 0x35, 0x7E,
+    0x1A, 0x80, 0xD5, 0xAA, 0xC1, 0x1E, 0xD2, 0x1E, 0x30, 0x52, 0x82, 0xDA, 0x51, 0x15, 0x2B, 0xB0,
+    0xD5, 0x09, 0xCD, 0xF9, 0xC1, 0x07, 0x67, 0x15, 0x23, 0x03, 0x46, 0x0F, 0xF8, 0x29, 0x2C, 0xED,
+    0x2D, 0x1A, 0xA8, 0xC4, 0x93, 0xE1, 0x1F, 0x24, 0xD2, 0xC3, 0x0A, 0x72, 0x0F, 0xCB, 0x99, 0xC0,
+    0x5F, 0x69, 0x05, 0x6F, 0x51, 0x17, 0xAA, 0x85, 0xEC, 0xDD, 0x86, 0x6D, 0xE6, 0x45, 0x27, 0x5F,
+    0x6A, 0x51, 0x89, 0xFE, 0x0A, 0x0B, 0x08, 0x98, 0x5E, 0x44, 0x53, 0x1A, 0xDA, 0x79, 0x37, 0x0A,
+    0x9C, 0xB8, 0x6F, 0x0D, 0xC5, 0xFF, 0xBD, 0x78, 0x99, 0xBB, 0x7C, 0x0B, 0x93, 0xB7, 0x92, 0x6A,
+    0x16, 0xC8, 0x19, 0x2D, 0x89, 0xE4, 0x54, 0x33, 0xBC, 0x0F, 0xB1, 0xA2, 0x50, 0xA7, 0x8A, 0x6D,
+    0xF4, 0x1B, 0x52, 0x3A, 0x4E, 0x1A, 0x4F, 0x13, 0xD3, 0x4D, 0x1C, 0x3D, 0x1E, 0x99, 0x59, 0xC4,
+    0xB9, 0x69, 0xC9, 0xFE, 0x00, 0x4D, 0x94, 0x4D, 0x0D, 0x02, 0x41, 0x0C, 0x46, 0x0F, 0x1C, 0x76,
+    0x0F, 0x84, 0xE0, 0x00, 0x1C, 0x80, 0x83, 0x45, 0x02, 0x12, 0xC6, 0x01, 0x52, 0x40, 0x02, 0x12,
+    0x90, 0x80, 0x04, 0x82, 0x81, 0x4D, 0x25, 0x40, 0x52, 0x02, 0x0C, 0x01, 0xA6, 0xFF, 0x3D, 0x6E,
+    0xF2, 0x32, 0xD3, 0xCE, 0xF7, 0xBE, 0x05, 0xBF, 0x8C, 0x0E, 0x9D, 0x94, 0x9F, 0xDD, 0x71, 0xE3,
+    0x14, 0xAB, 0x9D, 0xF3, 0xE6, 0x44, 0x40, 0xC7, 0xDD, 0x48, 0x66, 0x45, 0x27, 0xBB, 0x68, 0xE2,
+    0x55, 0x1E, 0xF7, 0xA9, 0xE9, 0x01, 0xE7, 0xB6, 0xB4, 0x7C, 0x0B, 0x4B, 0x7B, 0x76, 0x3B, 0x2A,
+    0x8D, 0x86, 0x9E, 0x74, 0xA3, 0x67, 0xF3, 0x10, 0xA5, 0xBD, 0xC7, 0xFE, 0x90, 0x4C, 0x6A, 0xF4,
+    0x23, 0x59, 0x01, 0xEC, 0x99, 0x4B, 0xB5, 0x35, 0xED, 0x93, 0x1A, 0xD3, 0xF8, 0x04, 0x5F, 0xCB,
+    0xC2, 0x18, 0x53, 0x9D, 0x31, 0x75, 0x4D, 0xED, 0x5F, 0xE5, 0x74, 0xB3, 0x64, 0xC8, 0x3D, 0xEF,
+    0x12, 0x7B, 0x0D, 0xBA, 0xB1, 0xBB, 0x75, 0xD0, 0x48, 0x33, 0xBC, 0x8C, 0x96, 0xDD, 0xC0, 0xE8,
+    0x23, 0x8B, 0x5C, 0x8C, 0x46, 0x51, 0xE7, 0xA3, 0x2D, 0xFF, 0x4A, 0x6C, 0x77, 0xB1, 0xE6, 0x24,
+    0x75, 0x27, 0x23, 0x47, 0x61, 0x17, 0xE6, 0x61, 0xCF, 0x6C, 0x67, 0xDD, 0x18, 0xD2, 0x6E, 0xF4,
+    0x27, 0x25, 0x76, 0x88, 0x59, 0xFB, 0x3F, 0x55, 0x54, 0xDD, 0x0D, 0x82, 0x40, 0x0C, 0x46, 0x34,
+    0x7A, 0x21, 0x21, 0x32, 0x02, 0x8F, 0x26, 0x3E, 0xC0, 0x06, 0x3C, 0xBB, 0x85, 0x23, 0xB8, 0x80,
+    0xF1, 0xC5, 0x77, 0xDD, 0x80, 0x21, 0x5C, 0x80, 0x19, 0x5C, 0x00, 0x37, 0x40, 0x4D, 0xC4, 0xA8,
+    0x21, 0x27, 0x6D, 0xAF, 0xED, 0xDD, 0x13, 0xF9, 0xEE, 0x42, 0xDB, 0xEF, 0xA7, 0xF7, 0x94, 0xE1,
+    0x61, 0xB0, 0xB4, 0x51, 0x62, 0xE3, 0xB5, 0xD9, 0x5A, 0xA1, 0x3F, 0x72, 0x8E, 0x33, 0xCB, 0x8D,
+    0x72, 0x14, 0xFE, 0xCB, 0xED, 0x76, 0x38, 0xF2, 0x8B, 0x49, 0x37, 0x58, 0xF4, 0xC6, 0xA5, 0x1F,
+    0x78, 0x7E, 0xE6, 0xD2, 0x3D, 0xFE, 0x55, 0xB2, 0x75, 0x3F, 0xAA, 0x39, 0xD0, 0x27, 0x73, 0x1D,
+    0xDF, 0x64, 0x1B, 0xAB, 0x42, 0x25, 0x40, 0xEA, 0xA5, 0x53, 0xB3, 0x20, 0x43, 0x13, 0xE7, 0xF5,
+    0x81, 0xB8, 0xCE, 0x5C, 0x08, 0x5B, 0x79, 0x84, 0x28, 0x17, 0x31, 0x64, 0xB0, 0x96, 0x08, 0x2D,
+    0x40, 0xE4, 0x4A, 0xAC, 0x4A, 0x61, 0xB8, 0x54, 0x5C, 0x2F, 0xE0, 0xCC, 0x48, 0x20, 0x4E, 0xA0,
+    0x4C, 0x2C, 0x32, 0xB4, 0xA3, 0x32, 0x12, 0x3A, 0x10, 0x73, 0x60, 0xBB, 0x70, 0xCC, 0x95, 0x0A,
+    0x0A, 0x63, 0xEE, 0xD9, 0x08, 0xD9, 0xF8, 0xB9, 0x04, 0x07, 0xE1, 0x44, 0xE0, 0xC7, 0xFA, 0x9B,
+    0x01, 0x4D, 0x39, 0x11, 0x2E, 0x5B, 0x2E, 0x7D, 0x12, 0xCE, 0x44, 0x61, 0x6E, 0x99, 0x3B, 0x2F,
+    0x5C, 0x17, 0x05, 0xB0, 0x0E, 0x61, 0xE5, 0xA1, 0x32, 0x58, 0x36, 0x90, 0xC2, 0x78, 0xF0, 0xAE,
+    0xDC, 0x89, 0xB0, 0xFF, 0x12, 0x66, 0xFE, 0x1E, 0x44, 0xD1, 0x55, 0xF2, 0x0F, 0x77, 0x47, 0x9F,
+    0x6C, 0x1F, 0xEE, 0x6A, 0xCF, 0xEF, 0xA4, 0xC2, 0x6E, 0x1A, 0xC0, 0xB5, 0x96, 0xBD, 0x0C, 0xED,
+    0x46, 0xD1, 0x1F, 0xFB, 0x80, 0x9C, 0x89, 0x98, 0x89, 0xE7, 0x6D, 0xD8, 0x0D, 0x05, 0xBF, 0x61,
+    0xAE, 0x83, 0x79, 0x09, 0x1E, 0x55, 0xE0, 0x14, 0xCE, 0x0A, 0xE7, 0x7D, 0x42, 0x8A, 0x39, 0xB0,
+    0x5F, 0x78, 0xE0, 0x9C, 0x09, 0xFF, 0x61, 0x3E, 0x83, 0x3A, 0x39, 0x1E, 0xCE, 0x51, 0xF8, 0x8F,
+    0x88, 0x30, 0x70, 0x00, 0x13, 0x88, 0x6F, 0x06, 0x78, 0x20, 0xF7, 0x23, 0x14, 0xFE, 0x85, 0x85,
+    0x06, 0x34, 0xBA, 0x60, 0xC9, 0x17, 0x12, 0x1A, 0xFE, 0x70, 0x8E, 0x01, 0x52, 0xA6, 0x03, 0x17,
+    0x69, 0xFB, 0x11, 0x66, 0xFC, 0x46, 0xB6, 0xAC, 0x00, 0x29, 0xCD, 0x82, 0x2D, 0x43, 0xA4, 0x06,
+    0x81, 0x7F, 0xF0, 0xF8, 0x85, 0x44, 0x3B, 0x52, 0xE8, 0xFC, 0x80, 0x27, 0x02, 0x68, 0x06, 0x65,
+    0x43, 0xB6, 0xEC, 0xFF, 0x2A, 0x18, 0x90, 0xFA, 0x82, 0x1C, 0xD6, 0xFA, 0xC4, 0xF3, 0x00, 0x83,
+    0x81, 0xAD, 0xD0, 0xB8, 0x67, 0x78, 0x0E, 0xF3, 0xC2, 0x65, 0x98, 0xD3, 0x02, 0xE0, 0xB9, 0xEE,
+    0x2B, 0xCC, 0x65, 0x0A, 0xFF, 0x09, 0xF9, 0x8B, 0x01, 0x1A, 0x50, 0xF7, 0xE1, 0xE1, 0x3A, 0x1F,
+    0xEE, 0xBB, 0x7C, 0x78, 0x0C, 0x41, 0xFD, 0x5E, 0x00, 0x37, 0xA4, 0x81, 0x2A, 0xAC, 0x09, 0xF0,
+    0x04, 0xB3, 0x01, 0x16, 0x65, 0xA0, 0xC8, 0x87, 0x26, 0xA9, 0x6F, 0xB0, 0x24, 0x00, 0x4A, 0x66,
+    0x90, 0x00, 0xBD, 0x02, 0x75, 0x5E, 0xC3, 0x4D, 0xA0, 0x5F, 0x65, 0xA1, 0xCA, 0xA1, 0xE5, 0xD0,
+    0x47, 0x58, 0x60, 0x83, 0x59, 0x7E, 0x30, 0xC3, 0x60, 0x21, 0x9D, 0xF4, 0x17, 0xD9, 0x5A, 0xA8,
+    0x77, 0x41, 0x51, 0xC5, 0x82, 0x1E, 0x2C, 0x0F, 0xE0, 0xA9, 0x03, 0x91, 0x62, 0x10, 0x2E, 0xA5,
+    0x8E, 0xCF, 0x0B, 0x08, 0xA5, 0x27, 0x58, 0xD6, 0x83, 0xC7, 0x0C, 0x28, 0xB6, 0x10, 0x4E, 0xE5,
+    0x86, 0x07, 0x5B, 0x3E, 0xA2, 0x2C, 0x60, 0x81, 0x67, 0xBD, 0x7E, 0xB8, 0xD9, 0x30, 0x79, 0x78,
+    0x2A, 0x41, 0x4A, 0x39, 0xA0, 0xD4, 0x04, 0x00, 0xFB, 0xF9, 0x9F, 0x7F, 0x30, 0x23, 0x00, 0x0B,
+    0xA8, 0x81, 0x46, 0x25, 0xD0, 0x85, 0xB0, 0x84, 0xFA, 0x11, 0xEE, 0xBB, 0x4B, 0xFF, 0xE1, 0x89,
+    0xE2, 0x09, 0x3C, 0xE0, 0x41, 0x49, 0x10, 0x1A, 0x44, 0x0F, 0xE1, 0x21, 0x9E, 0x80, 0x88, 0xF4,
+    0x7F, 0x50, 0xE7, 0x82, 0x3D, 0x08, 0x71, 0x30, 0xC8, 0x19, 0x6C, 0x88, 0x50, 0x87, 0x47, 0x07,
+    0x17, 0x9C, 0xC5, 0x0D, 0x67, 0xF1, 0x50, 0xCE, 0x7A, 0x00, 0x4F, 0x3E, 0x07, 0x60, 0x51, 0x06,
+    0x4A, 0x5A, 0xF6, 0xF0, 0xF0, 0x85, 0x25, 0xC0, 0xBF, 0xB0, 0x40, 0x01, 0x39, 0x30, 0x1F, 0x11,
+    0xED, 0xEB, 0x34, 0x60, 0x21, 0x04, 0x15, 0x05, 0x95, 0x37, 0xF3, 0xE1, 0x49, 0x74, 0x3E, 0xBC,
+    0x80, 0xF4, 0x87, 0x46, 0xFB, 0x7B, 0x75, 0x46, 0xA8, 0x06, 0x6E, 0x58, 0xCC, 0x41, 0xF3, 0x48,
+    0x02, 0x3C, 0x36, 0xF1, 0xA6, 0x13, 0x2A, 0xF9, 0x1C, 0x11, 0x92, 0x1F, 0xE1, 0x31, 0x87, 0x08,
+    0xF1, 0x6F, 0xB0, 0xC4, 0x00, 0xCA, 0x2A, 0x8C, 0xB0, 0x0C, 0x0B, 0x8D, 0xAD, 0x02, 0xB8, 0x43,
+    0x3F, 0xC1, 0x9C, 0x07, 0xF2, 0x22, 0x44, 0xC3, 0x53, 0x58, 0xF4, 0x5E, 0xFE, 0x0F, 0x33, 0xED,
+    0x23, 0x3C, 0xC1, 0x22, 0x52, 0x0E, 0x22, 0x35, 0x01, 0x00, 0x03, 0x82, 0xA5, 0x7F, 0xDF, 0x67,
+    0x33, 0x22, 0x27, 0xEF, 0x2B, 0xB0, 0x34, 0x04, 0x89, 0x3A, 0xBC, 0xF9, 0x1F, 0xEA, 0x60, 0x4E,
+    0x05, 0x78, 0x6A, 0x87, 0xFA, 0x96, 0x15, 0x88, 0xD7, 0x0B, 0x3B, 0x82, 0xD2, 0x8B, 0x0E, 0xC4,
+    0x56, 0x50, 0x80, 0x03, 0xA3, 0xC2, 0x00, 0x14, 0x7A, 0x1A, 0x0C, 0x5B, 0x40, 0xA9, 0xE4, 0x3B,
+    0x24, 0xFA, 0x36, 0xC2, 0x34, 0xCB, 0x01, 0xE3, 0x22, 0x1E, 0xE6, 0x38, 0x30, 0x60, 0x01, 0x06,
+    0x36, 0x24, 0x74, 0x1D, 0x20, 0xF9, 0xCB, 0x1F, 0xE4, 0x24, 0x7E, 0xA4, 0x32, 0xE1, 0x3C, 0x13,
+    0xB2, 0xDB, 0x8B, 0xDE, 0xFC, 0x9F, 0x0B, 0xF2, 0x27, 0x00,
+};
+const uint8_t Roboto_30Dictionary[1024] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0x9B,
+    0x00, 0xFE, 0xFF, 0x0D, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0B, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06,
+    0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0xFF,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x06,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0x4A, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0xA0, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
+    0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xEE,
+    0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+    0xC7, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x30, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x03, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xDF, 0xDD, 0xDD, 0xDD, 0xDD, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x2F,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+    0x00, 0xAA, 0xAA, 0xBB, 0xFD, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0xFF, 0xFF, 0x04, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+    0x0B, 0xF3, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x09,
+    0xF2, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x08, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFA, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00,
 };
 const GFXglyph Roboto_30Glyphs[] = {
-    { 0, 0, 16, 0, 0, 8, 0 }, //  
-    { 8, 46, 16, 4, 45, 72, 8 }, // !
-    { 13, 15, 20, 4, 47, 65, 80 }, // "
-    { 35, 45, 39, 3, 45, 273, 145 }, // #
-    { 30, 60, 35, 3, 53, 353, 418 }, // $
-    { 41, 47, 46, 3, 46, 365, 771 }, // %
-    { 36, 47, 39, 3, 46, 382, 1136 }, // &
-    { 5, 15, 11, 3, 47, 39, 1518 }, // '
-    { 17, 65, 22, 4, 51, 221, 1557 }, // (
-    { 17, 65, 22, 1, 51, 213, 1778 }, // )
-    { 27, 26, 27, 0, 45, 194, 1991 }, // *
-    { 32, 32, 36, 2, 37, 43, 2185 }, // +
-    { 10, 16, 12, 0, 7, 64, 2228 }, // ,
-    { 16, 5, 17, 1, 22, 19, 2292 }, // -
-    { 8, 8, 17, 4, 7, 39, 2311 }, // .
-    { 25, 49, 26, 0, 45, 150, 2350 }, // /
-    { 29, 47, 35, 3, 46, 273, 2500 }, // 0
-    { 18, 45, 35, 5, 45, 69, 2773 }, // 1
-    { 32, 46, 35, 2, 46, 277, 2842 }, // 2
-    { 30, 47, 35, 2, 46, 302, 3119 }, // 3
-    { 33, 45, 35, 1, 45, 181, 3421 }, // 4
-    { 29, 46, 35, 4, 45, 282, 3602 }, // 5
-    { 29, 46, 35, 4, 45, 317, 3884 }, // 6
-    { 31, 45, 35, 2, 45, 169, 4201 }, // 7
-    { 29, 47, 35, 3, 46, 354, 4370 }, // 8
-    { 29, 46, 35, 3, 46, 329, 4724 }, // 9
-    { 8, 35, 15, 4, 34, 67, 5053 }, // :
-    { 10, 43, 13, 1, 34, 101, 5120 }, // ;
-    { 26, 28, 32, 2, 34, 147, 5221 }, // <
-    { 27, 18, 35, 4, 30, 23, 5368 }, // =
-    { 27, 28, 33, 4, 34, 135, 5391 }, // >
-    { 26, 47, 30, 2, 46, 241, 5526 }, // ?
-    { 51, 58, 57, 3, 44, 625, 5767 }, // @
-    { 41, 45, 41, 0, 45, 317, 6392 }, // A
-    { 31, 45, 39, 5, 45, 243, 6709 }, // B
-    { 36, 47, 41, 3, 46, 313, 6952 }, // C
-    { 33, 45, 41, 5, 45, 225, 7265 }, // D
-    { 29, 45, 36, 5, 45, 54, 7490 }, // E
-    { 28, 45, 35, 5, 45, 44, 7544 }, // F
-    { 36, 47, 43, 3, 46, 337, 7588 }, // G
-    { 35, 45, 45, 5, 45, 41, 7925 }, // H
-    { 7, 45, 17, 5, 45, 15, 7966 }, // I
-    { 29, 46, 35, 1, 45, 143, 7981 }, // J
-    { 35, 45, 40, 5, 45, 250, 8124 }, // K
-    { 28, 45, 34, 5, 45, 33, 8374 }, // L
-    { 45, 45, 55, 5, 45, 290, 8407 }, // M
-    { 35, 45, 45, 5, 45, 206, 8697 }, // N
-    { 37, 47, 43, 3, 46, 324, 8903 }, // O
-    { 33, 45, 40, 5, 45, 173, 9227 }, // P
-    { 37, 54, 43, 3, 46, 353, 9400 }, // Q
-    { 33, 45, 39, 5, 45, 244, 9753 }, // R
-    { 34, 47, 37, 2, 46, 339, 9997 }, // S
-    { 36, 45, 38, 1, 45, 41, 10336 }, // T
-    { 33, 46, 41, 4, 45, 167, 10377 }, // U
-    { 40, 45, 40, 0, 45, 329, 10544 }, // V
-    { 54, 45, 56, 1, 45, 493, 10873 }, // W
-    { 37, 45, 40, 1, 45, 322, 11366 }, // X
-    { 38, 45, 38, 0, 45, 237, 11688 }, // Y
-    { 34, 45, 38, 2, 45, 192, 11925 }, // Z
-    { 13, 61, 17, 4, 51, 33, 12117 }, // [
-    { 25, 49, 26, 1, 45, 166, 12150 }, // <backslash>
-    { 12, 61, 17, 0, 51, 35, 12316 }, // ]
-    { 24, 22, 26, 1, 45, 155, 12351 }, // ^
-    { 29, 5, 28, 0, 0, 21, 12506 }, // _
-    { 14, 9, 19, 1, 47, 55, 12527 }, // `
-    { 28, 35, 34, 3, 34, 257, 12582 }, // a
-    { 29, 48, 35, 4, 47, 203, 12839 }, // b
-    { 29, 35, 33, 2, 34, 234, 13042 }, // c
-    { 30, 48, 36, 2, 47, 224, 13276 }, // d
-    { 30, 35, 33, 2, 34, 261, 13500 }, // e
-    { 21, 48, 22, 1, 48, 106, 13761 }, // f
-    { 30, 47, 35, 2, 34, 312, 13867 }, // g
-    { 27, 47, 35, 4, 47, 115, 14179 }, // h
-    { 8, 46, 15, 4, 46, 44, 14294 }, // i
-    { 14, 59, 15, -3, 46, 103, 14338 }, // j
-    { 28, 47, 32, 4, 47, 197, 14441 }, // k
-    { 7, 47, 15, 4, 47, 15, 14638 }, // l
-    { 47, 34, 55, 4, 34, 194, 14653 }, // m
-    { 27, 34, 35, 4, 34, 119, 14847 }, // n
-    { 32, 35, 36, 2, 34, 262, 14966 }, // o
-    { 29, 47, 35, 4, 34, 230, 15228 }, // p
-    { 30, 47, 36, 2, 34, 236, 15458 }, // q
-    { 17, 34, 21, 4, 34, 67, 15694 }, // r
-    { 28, 35, 33, 2, 34, 265, 15761 }, // s
-    { 19, 42, 21, 0, 41, 90, 16026 }, // t
-    { 27, 34, 35, 4, 33, 121, 16116 }, // u
-    { 29, 33, 31, 1, 33, 221, 16237 }, // v
-    { 45, 33, 47, 1, 33, 365, 16458 }, // w
-    { 29, 33, 31, 1, 33, 217, 16823 }, // x
-    { 30, 46, 30, 0, 33, 292, 17040 }, // y
-    { 28, 33, 31, 2, 33, 161, 17332 }, // z
-    { 20, 60, 21, 1, 49, 215, 17493 }, // {
-    { 5, 53, 15, 5, 45, 14, 17708 }, // |
-    { 20, 60, 21, 0, 49, 221, 17722 }, // }
-    { 35, 12, 43, 4, 24, 145, 17943 }, // ~
+    { 0, 0, 16, 0, 0, 2, 0 }, //  
+    { 8, 46, 16, 4, 45, 57, 2 }, // !
+    { 13, 15, 20, 4, 47, 63, 59 }, // "
+    { 35, 45, 39, 3, 45, 245, 122 }, // #
+    { 30, 60, 35, 3, 53, 298, 367 }, // $
+    { 41, 47, 46, 3, 46, 336, 665 }, // %
+    { 36, 47, 39, 3, 46, 316, 1001 }, // &
+    { 5, 15, 11, 3, 47, 33, 1317 }, // '
+    { 17, 65, 22, 4, 51, 179, 1350 }, // (
+    { 17, 65, 22, 1, 51, 172, 1529 }, // )
+    { 27, 26, 27, 0, 45, 142, 1701 }, // *
+    { 32, 32, 36, 2, 37, 32, 1843 }, // +
+    { 10, 16, 12, 0, 7, 43, 1875 }, // ,
+    { 16, 5, 17, 1, 22, 12, 1918 }, // -
+    { 8, 8, 17, 4, 7, 26, 1930 }, // .
+    { 25, 49, 26, 0, 45, 125, 1956 }, // /
+    { 29, 47, 35, 3, 46, 219, 2081 }, // 0
+    { 18, 45, 35, 5, 45, 60, 2300 }, // 1
+    { 32, 46, 35, 2, 46, 234, 2360 }, // 2
+    { 30, 47, 35, 2, 46, 241, 2594 }, // 3
+    { 33, 45, 35, 1, 45, 177, 2835 }, // 4
+    { 29, 46, 35, 4, 45, 245, 3012 }, // 5
+    { 29, 46, 35, 4, 45, 273, 3257 }, // 6
+    { 31, 45, 35, 2, 45, 163, 3530 }, // 7
+    { 29, 47, 35, 3, 46, 303, 3693 }, // 8
+    { 29, 46, 35, 3, 46, 287, 3996 }, // 9
+    { 8, 35, 15, 4, 34, 55, 4283 }, // :
+    { 10, 43, 13, 1, 34, 73, 4338 }, // ;
+    { 26, 28, 32, 2, 34, 132, 4411 }, // <
+    { 27, 18, 35, 4, 30, 14, 4543 }, // =
+    { 27, 28, 33, 4, 34, 125, 4557 }, // >
+    { 26, 47, 30, 2, 46, 176, 4682 }, // ?
+    { 51, 58, 57, 3, 44, 589, 4858 }, // @
+    { 41, 45, 41, 0, 45, 280, 5447 }, // A
+    { 31, 45, 39, 5, 45, 216, 5727 }, // B
+    { 36, 47, 41, 3, 46, 265, 5943 }, // C
+    { 33, 45, 41, 5, 45, 206, 6208 }, // D
+    { 29, 45, 36, 5, 45, 48, 6414 }, // E
+    { 28, 45, 35, 5, 45, 36, 6462 }, // F
+    { 36, 47, 43, 3, 46, 298, 6498 }, // G
+    { 35, 45, 45, 5, 45, 27, 6796 }, // H
+    { 7, 45, 17, 5, 45, 6, 6823 }, // I
+    { 29, 46, 35, 1, 45, 112, 6829 }, // J
+    { 35, 45, 40, 5, 45, 228, 6941 }, // K
+    { 28, 45, 34, 5, 45, 24, 7169 }, // L
+    { 45, 45, 55, 5, 45, 288, 7193 }, // M
+    { 35, 45, 45, 5, 45, 196, 7481 }, // N
+    { 37, 47, 43, 3, 46, 282, 7677 }, // O
+    { 33, 45, 40, 5, 45, 150, 7959 }, // P
+    { 37, 54, 43, 3, 46, 301, 8109 }, // Q
+    { 33, 45, 39, 5, 45, 208, 8410 }, // R
+    { 34, 47, 37, 2, 46, 292, 8618 }, // S
+    { 36, 45, 38, 1, 45, 31, 8910 }, // T
+    { 33, 46, 41, 4, 45, 128, 8941 }, // U
+    { 40, 45, 40, 0, 45, 286, 9069 }, // V
+    { 54, 45, 56, 1, 45, 460, 9355 }, // W
+    { 37, 45, 40, 1, 45, 259, 9815 }, // X
+    { 38, 45, 38, 0, 45, 206, 10074 }, // Y
+    { 34, 45, 38, 2, 45, 169, 10280 }, // Z
+    { 13, 61, 17, 4, 51, 23, 10449 }, // [
+    { 25, 49, 26, 1, 45, 139, 10472 }, // <backslash>
+    { 12, 61, 17, 0, 51, 23, 10611 }, // ]
+    { 24, 22, 26, 1, 45, 112, 10634 }, // ^
+    { 29, 5, 28, 0, 0, 12, 10746 }, // _
+    { 14, 9, 19, 1, 47, 32, 10758 }, // `
+    { 28, 35, 34, 3, 34, 206, 10790 }, // a
+    { 29, 48, 35, 4, 47, 190, 10996 }, // b
+    { 29, 35, 33, 2, 34, 185, 11186 }, // c
+    { 30, 48, 36, 2, 47, 200, 11371 }, // d
+    { 30, 35, 33, 2, 34, 209, 11571 }, // e
+    { 21, 48, 22, 1, 48, 80, 11780 }, // f
+    { 30, 47, 35, 2, 34, 274, 11860 }, // g
+    { 27, 47, 35, 4, 47, 93, 12134 }, // h
+    { 8, 46, 15, 4, 46, 33, 12227 }, // i
+    { 14, 59, 15, -3, 46, 73, 12260 }, // j
+    { 28, 47, 32, 4, 47, 167, 12333 }, // k
+    { 7, 47, 15, 4, 47, 7, 12500 }, // l
+    { 47, 34, 55, 4, 34, 159, 12507 }, // m
+    { 27, 34, 35, 4, 34, 91, 12666 }, // n
+    { 32, 35, 36, 2, 34, 187, 12757 }, // o
+    { 29, 47, 35, 4, 34, 199, 12944 }, // p
+    { 30, 47, 36, 2, 34, 204, 13143 }, // q
+    { 17, 34, 21, 4, 34, 55, 13347 }, // r
+    { 28, 35, 33, 2, 34, 214, 13402 }, // s
+    { 19, 42, 21, 0, 41, 71, 13616 }, // t
+    { 27, 34, 35, 4, 33, 98, 13687 }, // u
+    { 29, 33, 31, 1, 33, 190, 13785 }, // v
+    { 45, 33, 47, 1, 33, 318, 13975 }, // w
+    { 29, 33, 31, 1, 33, 194, 14293 }, // x
+    { 30, 46, 30, 0, 33, 252, 14487 }, // y
+    { 28, 33, 31, 2, 33, 124, 14739 }, // z
+    { 20, 60, 21, 1, 49, 153, 14863 }, // {
+    { 5, 53, 15, 5, 45, 7, 15016 }, // |
+    { 20, 60, 21, 0, 49, 171, 15023 }, // }
+    { 35, 12, 43, 4, 24, 96, 15194 }, // ~
 };
 const UnicodeInterval Roboto_30Intervals[] = {
     { 0x20, 0x7E, 0x0 },
@@ -1242,4 +1133,10 @@ const GFXfont Roboto_30 = {
     73,
     58,
     -16,
+    GLYPH_FORMAT_RAW_DEFLATE,
+    (uint8_t*)Roboto_30Dictionary,
+    1024,
+    NULL,
+    0,
+    { 35, 1, 1, 46, 34, 1 },
 };
@@ -9260,4 +9260,10 @@ const GFXfont Roboto_50 = {
     122,
     97,
     -26,
+    0,
+    NULL,
+    0,
+    NULL,
+    0,
+    { 58, 1, 2, 75, 57, 1 },
 };
@@ -0,0 +1,212 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_diff.h"
+
+#include <esp_assert.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief number of 32 bit words in one framebuffer row.
+ */
+#define ROW_WORDS (EPD_WIDTH / 8)
+
+/**
+ * @brief number of words compared at once when skipping unchanged blocks.
+ */
+#define BLOCK_WORDS 4
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+/**
+ * @brief Find the first and last changed pixel of a framebuffer row between
+ *        the words `w0` and `w1` (exclusive).
+ *
+ * @return false if the rows are identical there.
+ */
+static bool IRAM_ATTR diff_row(const uint32_t *prev, const uint32_t *next,
+                               int32_t w0, int32_t w1, int32_t *first,
+                               int32_t *last);
+
+static void add_rect(Rect_t *rects, int32_t max_rects, int32_t *count,
+                     Rect_t area);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+int32_t epd_diff(const uint8_t *prev, const uint8_t *next, Rect_t *rects,
+                 int32_t max_rects)
+{
+    return epd_diff_area(prev, next, epd_full_screen(), rects, max_rects);
+}
+
+
+int32_t epd_diff_area(const uint8_t *prev, const uint8_t *next, Rect_t area,
+                      Rect_t *rects, int32_t max_rects)
+{
+    assert(prev != NULL && next != NULL && rects != NULL && max_rects > 0);
+
+    int32_t x0 = area.x < 0 ? 0 : area.x;
+    int32_t x1 = area.x + area.width > EPD_WIDTH ? EPD_WIDTH : area.x + area.width;
+    int32_t y0 = area.y < 0 ? 0 : area.y;
+    int32_t y1 = area.y + area.height > EPD_HEIGHT ? EPD_HEIGHT : area.y + area.height;
+    int32_t w0 = x0 / 8;
+    int32_t w1 = (x1 + 7) / 8;
+
+    const uint32_t *prev_row = (const uint32_t *)prev + y0 * ROW_WORDS;
+    const uint32_t *next_row = (const uint32_t *)next + y0 * ROW_WORDS;
+
+    int32_t count = 0;
+    bool open = false;
+    Rect_t current = { 0 };
+    int32_t last_changed = 0;
+
+    for (int32_t y = y0; y < y1 && w0 < w1; y++)
+    {
+        int32_t first, last;
+        bool changed = diff_row(prev_row, next_row, w0, w1, &first, &last);
+        prev_row += ROW_WORDS;
+        next_row += ROW_WORDS;
+        if (!changed)
+        {
+            continue;
+        }
+
+        if (open && y - last_changed - 1 <= EPD_DIFF_MERGE_GAP)
+        {
+            int32_t x1 = current.x + current.width;
+            current.x = first < current.x ? first : current.x;
+            current.width = (last + 1 > x1 ? last + 1 : x1) - current.x;
+            current.height = y - current.y + 1;
+        }
+        else
+        {
+            if (open)
+            {
+                add_rect(rects, max_rects, &count, current);
+            }
+            current.x = first;
+            current.y = y;
+            current.width = last - first + 1;
+            current.height = 1;
+            open = true;
+        }
+        last_changed = y;
+    }
+
+    if (open)
+    {
+        add_rect(rects, max_rects, &count, current);
+    }
+    return count;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static bool IRAM_ATTR diff_row(const uint32_t *prev, const uint32_t *next,
+                               int32_t w0, int32_t w1, int32_t *first,
+                               int32_t *last)
+{
+    int32_t lo = w0;
+    uint32_t changed = 0;
+
+    // skip unchanged 128 bit blocks, then narrow down to the word
+    for (; lo + BLOCK_WORDS <= w1; lo += BLOCK_WORDS)
+    {
+        uint32_t block = (prev[lo] ^ next[lo]) |
+                         (prev[lo + 1] ^ next[lo + 1]) |
+                         (prev[lo + 2] ^ next[lo + 2]) |
+                         (prev[lo + 3] ^ next[lo + 3]);
+        if (block)
+        {
+            break;
+        }
+    }
+    for (; lo < w1; lo++)
+    {
+        changed = prev[lo] ^ next[lo];
+        if (changed)
+        {
+            break;
+        }
+    }
+    if (!changed)
+    {
+        return false;
+    }
+    // pixels are stored low nibble first
+    *first = lo * 8 + __builtin_ctz(changed) / 4;
+
+    int32_t hi = w1 - 1;
+    for (; hi - BLOCK_WORDS >= lo; hi -= BLOCK_WORDS)
+    {
+        uint32_t block = (prev[hi] ^ next[hi]) |
+                         (prev[hi - 1] ^ next[hi - 1]) |
+                         (prev[hi - 2] ^ next[hi - 2]) |
+                         (prev[hi - 3] ^ next[hi - 3]);
+        if (block)
+        {
+            break;
+        }
+    }
+    for (; hi > lo; hi--)
+    {
+        if (prev[hi] ^ next[hi])
+        {
+            break;
+        }
+    }
+    changed = prev[hi] ^ next[hi];
+    *last = hi * 8 + (31 - __builtin_clz(changed)) / 4;
+    return true;
+}
+
+
+static void add_rect(Rect_t *rects, int32_t max_rects, int32_t *count,
+                     Rect_t area)
+{
+    if (*count < max_rects)
+    {
+        rects[(*count)++] = area;
+        return;
+    }
+
+    // out of rectangles: grow the last one to cover the new area as well
+    Rect_t *tail = &rects[max_rects - 1];
+    int32_t x1 = tail->x + tail->width;
+    int32_t y1 = tail->y + tail->height;
+    int32_t ax1 = area.x + area.width;
+    int32_t ay1 = area.y + area.height;
+    tail->x = area.x < tail->x ? area.x : tail->x;
+    tail->y = area.y < tail->y ? area.y : tail->y;
+    tail->width = (ax1 > x1 ? ax1 : x1) - tail->x;
+    tail->height = (ay1 > y1 ? ay1 : y1) - tail->y;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,90 @@
+/**
+ * Compare two framebuffers and report the areas that changed between them.
+ */
+
+#ifndef _EPD_DIFF_H_
+#define _EPD_DIFF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Changed areas which are at most this many unchanged rows apart are
+ *        merged into a single rectangle.
+ */
+#define EPD_DIFF_MERGE_GAP 8
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Find the areas in which two framebuffers differ.
+ *
+ * Rows are compared one 32 bit word (8 pixels) at a time, skipping over
+ * unchanged 128 bit blocks. Every changed row contributes one pixel-exact
+ * column span, and vertically adjacent spans are coalesced into rectangles.
+ * If more than `max_rects` rectangles would be needed, the surplus is merged
+ * into the last one, so the result always covers all changed pixels.
+ *
+ * @param prev      The previously displayed framebuffer.
+ * @param next      The framebuffer to display next.
+ * @param rects     Output array for the changed areas.
+ * @param max_rects Capacity of `rects`, must be at least 1.
+ *
+ * @note Both framebuffers must be 4 byte aligned and
+ *       `EPD_WIDTH / 2 * EPD_HEIGHT` bytes large.
+ *
+ * @return The number of rectangles written to `rects`, 0 if the framebuffers
+ *         are identical.
+ */
+int32_t epd_diff(const uint8_t *prev, const uint8_t *next, Rect_t *rects,
+                 int32_t max_rects);
+
+/**
+ * @brief Find the areas in which two framebuffers differ inside `area`.
+ *
+ * Like epd_diff(), but only the pixels inside `area` are compared, rounded
+ * out to whole 32 bit words (8 pixels). Pixels outside it may hold anything.
+ *
+ * @param prev      The previously displayed framebuffer.
+ * @param next      The framebuffer to display next.
+ * @param area      The area to compare, in panel coordinates.
+ * @param rects     Output array for the changed areas.
+ * @param max_rects Capacity of `rects`, must be at least 1.
+ *
+ * @return The number of rectangles written to `rects`, 0 if the area is
+ *         identical in both framebuffers.
+ */
+int32_t epd_diff_area(const uint8_t *prev, const uint8_t *next, Rect_t area,
+                      Rect_t *rects, int32_t max_rects);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -50,6 +50,8 @@
 typedef struct
 {
     uint8_t *data_ptr;
+    EpdRowFetch fetch_row;
+    const void *source;
     SemaphoreHandle_t done_smphr;
     Rect_t area;
     int32_t frame;
@@ -90,9 +92,23 @@ static void IRAM_ATTR provide_out(OutputParams *params);
 
 static void IRAM_ATTR feed_display(OutputParams *params);
 
+/**
+ * @brief Run the 4 bit waveform, reading rows either from `data` or,
+ *        if `fetch` is set, from the row callback.
+ */
+static void IRAM_ATTR draw_image_frames(Rect_t area, uint8_t *data, EpdRowFetch fetch,
+                                        const void *source, DrawMode_t mode);
+
 static void epd_fill_circle_helper(int32_t x0, int32_t y0, int32_t r, int32_t corners, int32_t delta,
                             uint8_t color, uint8_t *framebuffer);
 
+static inline void set_pixel_1bpp(uint8_t *row, int32_t x, bool ink);
+
+/**
+ * @brief Convert a point from canvas to panel coordinates.
+ */
+static inline void rotate_point(int32_t *x, int32_t *y);
+
 /******************************************************************************/
 /***        exported variables                                              ***/
 /******************************************************************************/
@@ -111,11 +127,20 @@ static const int32_t contrast_cycles_4[15] = {30, 30, 20, 20, 30, 30, 30, 40, 40
 
 static const int32_t contrast_cycles_4_white[15] = {10, 10, 8, 8, 8, 8, 8, 10, 10, 15, 15, 20, 20, 100, 300};
 
+/* 1bpp frame times, about the total time of the darkest / lightest 4bpp value. */
+static const int32_t contrast_cycles_1[4] = {250, 250, 250, 250};
+
+static const int32_t contrast_cycles_1_white[4] = {50, 100, 200, 200};
+
 // Heap space to use for the EPD output lookup table, which
 // is calculated for each cycle.
 static uint8_t *conversion_lut;
 static QueueHandle_t output_queue;
 
+/* Canvas orientation, see epd_set_rotation(). */
+static EpdRotation rotation = EPD_ROT_LANDSCAPE;
+static bool mirrored = false;
+
 static const DRAM_ATTR uint32_t lut_1bpp[256] = {
     0x0000, 0x0001, 0x0004, 0x0005, 0x0010, 0x0011, 0x0014, 0x0015,
     0x0040, 0x0041, 0x0044, 0x0045, 0x0050, 0x0051, 0x0054, 0x0055,
@@ -247,6 +272,58 @@ Rect_t epd_full_screen()
 }
 
 
+void epd_set_rotation(EpdRotation rot, bool mirror)
+{
+    rotation = rot;
+    mirrored = mirror;
+}
+
+
+EpdRotation epd_get_rotation()
+{
+    return rotation;
+}
+
+
+bool epd_is_rotated()
+{
+    return rotation != EPD_ROT_LANDSCAPE || mirrored;
+}
+
+
+int32_t epd_rotated_display_width()
+{
+    return (rotation & 1) ? EPD_HEIGHT : EPD_WIDTH;
+}
+
+
+int32_t epd_rotated_display_height()
+{
+    return (rotation & 1) ? EPD_WIDTH : EPD_HEIGHT;
+}
+
+
+Rect_t epd_rotate_area(Rect_t area)
+{
+    int32_t x0 = area.x;
+    int32_t y0 = area.y;
+    int32_t x1 = area.x + area.width - 1;
+    int32_t y1 = area.y + area.height - 1;
+    rotate_point(&x0, &y0);
+    rotate_point(&x1, &y1);
+    if (x0 > x1)
+    {
+        _swap_int(x0, x1);
+    }
+    if (y0 > y1)
+    {
+        _swap_int(y0, y1);
+    }
+    Rect_t rotated = {.x = x0, .y = y0, .width = x1 - x0 + 1, .height = y1 - y0 + 1};
+    return rotated;
+}
+
+
 void epd_clear()
 {
     epd_clear_area(epd_full_screen());
@@ -294,7 +371,9 @@ void IRAM_ATTR calc_epd_input_1bpp(uint8_t *line_data, uint8_t *epd_input,
     {
         uint8_t v1 = *(line_data++);
         uint8_t v2 = *(line_data++);
-        wide_epd_input[j] = (lut_1bpp[v1] << 16) | lut_1bpp[v2];
+        uint32_t pixel = (lut_1bpp[v1] << 16) | lut_1bpp[v2];
+        // 0b01 darkens a pixel, 0b10 lightens it
+        wide_epd_input[j] = (mode == BLACK_ON_WHITE) ? pixel : pixel << 1;
     }
 }
 
@@ -327,6 +406,7 @@ void epd_draw_vline(int32_t x, int32_t y, int32_t length, uint8_t color, uint8_t
 
 void epd_draw_pixel(int32_t x, int32_t y, uint8_t color, uint8_t *framebuffer)
 {
+    rotate_point(&x, &y);
     if (x < 0 || x >= EPD_WIDTH)
     {
         return;
@@ -347,6 +427,86 @@ void epd_draw_pixel(int32_t x, int32_t y, uint8_t color, uint8_t *framebuffer)
 }
 
 
+void epd_draw_pixel_1bpp(int32_t x, int32_t y, uint8_t color, uint8_t *framebuffer)
+{
+    rotate_point(&x, &y);
+    if (x < 0 || x >= EPD_WIDTH)
+    {
+        return;
+    }
+    if (y < 0 || y >= EPD_HEIGHT)
+    {
+        return;
+    }
+    set_pixel_1bpp(&framebuffer[y * EPD_WIDTH / 8], x, color < 128);
+}
+
+
+void epd_draw_hline_1bpp(int32_t x, int32_t y, int32_t length, uint8_t color, uint8_t *framebuffer)
+{
+    if (epd_is_rotated())
+    {
+        // the line is not a panel row any more
+        for (int32_t i = 0; i < length; i++)
+        {
+            epd_draw_pixel_1bpp(x + i, y, color, framebuffer);
+        }
+        return;
+    }
+    if (y < 0 || y >= EPD_HEIGHT)
+    {
+        return;
+    }
+    int32_t x0 = x < 0 ? 0 : x;
+    int32_t x1 = x + length > EPD_WIDTH ? EPD_WIDTH : x + length;
+    uint8_t *row = &framebuffer[y * EPD_WIDTH / 8];
+    bool ink = color < 128;
+
+    for (; x0 < x1 && x0 % 8 != 0; x0++)
+    {
+        set_pixel_1bpp(row, x0, ink);
+    }
+    // whole bytes in the middle of the line
+    int32_t bytes = (x1 - x0) / 8;
+    if (bytes > 0)
+    {
+        memset(&row[x0 / 8], ink ? 0xFF : 0x00, bytes);
+        x0 += bytes * 8;
+    }
+    for (; x0 < x1; x0++)
+    {
+        set_pixel_1bpp(row, x0, ink);
+    }
+}
+
+
+void epd_draw_vline_1bpp(int32_t x, int32_t y, int32_t length, uint8_t color, uint8_t *framebuffer)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        epd_draw_pixel_1bpp(x, y + i, color, framebuffer);
+    }
+}
+
+
+void epd_draw_rect_1bpp(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color, uint8_t *framebuffer)
+{
+    epd_draw_hline_1bpp(x, y, w, color, framebuffer);
+    epd_draw_hline_1bpp(x, y + h - 1, w, color, framebuffer);
+    epd_draw_vline_1bpp(x, y, h, color, framebuffer);
+    epd_draw_vline_1bpp(x + w - 1, y, h, color, framebuffer);
+}
+
+
+void epd_fill_rect_1bpp(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color, uint8_t *framebuffer)
+{
+    for (int32_t i = y; i < y + h; i++)
+    {
+        epd_draw_hline_1bpp(x, i, w, color, framebuffer);
+    }
+}
+
+
 void epd_draw_circle(int32_t x0, int32_t y0, int32_t r, uint8_t color, uint8_t *framebuffer)
 {
     int32_t f = 1 - r;
@@ -696,11 +856,12 @@ void epd_copy_to_framebuffer(Rect_t image_area, uint8_t *image_data,
                                         : image_data[value_index / 2] & 0x0F;
 
         int32_t xx = image_area.x + i % image_area.width;
+        int32_t yy = image_area.y + i / image_area.width;
+        rotate_point(&xx, &yy);
         if (xx < 0 || xx >= EPD_WIDTH)
         {
             continue;
         }
-        int32_t yy = image_area.y + i / image_area.width;
         if (yy < 0 || yy >= EPD_HEIGHT)
         {
             continue;
@@ -718,6 +879,31 @@ void epd_copy_to_framebuffer(Rect_t image_area, uint8_t *image_data,
 }
 
 
+void epd_copy_to_framebuffer_1bpp(Rect_t image_area, uint8_t *image_data,
+                                  uint8_t *framebuffer)
+{
+    assert(image_data != NULL || framebuffer != NULL);
+
+    uint32_t byte_width = image_area.width / 2 + image_area.width % 2;
+    for (int32_t y = 0; y < image_area.height; y++)
+    {
+        uint8_t *src = &image_data[y * byte_width];
+        for (int32_t x = 0; x < image_area.width; x++)
+        {
+            int32_t xx = image_area.x + x;
+            int32_t yy = image_area.y + y;
+            rotate_point(&xx, &yy);
+            if (xx < 0 || xx >= EPD_WIDTH || yy < 0 || yy >= EPD_HEIGHT)
+            {
+                continue;
+            }
+            uint8_t val = (x % 2) ? src[x / 2] >> 4 : src[x / 2] & 0x0F;
+            set_pixel_1bpp(&framebuffer[yy * EPD_WIDTH / 8], xx, val < 8);
+        }
+    }
+}
+
+
 void IRAM_ATTR epd_draw_grayscale_image(Rect_t area, uint8_t *data)
 {
     epd_draw_image(area, data, BLACK_ON_WHITE);
@@ -813,7 +999,36 @@ void IRAM_ATTR epd_draw_frame_1bit(Rect_t area, uint8_t *ptr,
 }
 
 
+void IRAM_ATTR epd_draw_image_1bpp(Rect_t area, uint8_t *data, DrawMode_t mode)
+{
+    const int32_t *contrast_lut = (mode == BLACK_ON_WHITE) ? contrast_cycles_1
+                                                           : contrast_cycles_1_white;
+    for (uint8_t k = 0; k < sizeof(contrast_cycles_1) / sizeof(int32_t); k++)
+    {
+        epd_draw_frame_1bit(area, data, mode, contrast_lut[k]);
+    }
+}
+
+
 void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode)
+{
+    draw_image_frames(area, data, NULL, NULL, mode);
+}
+
+
+void IRAM_ATTR epd_draw_image_rows(Rect_t area, EpdRowFetch fetch,
+                                   const void *source, DrawMode_t mode)
+{
+    assert(fetch != NULL);
+    draw_image_frames(area, NULL, fetch, source, mode);
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void IRAM_ATTR draw_image_frames(Rect_t area, uint8_t *data, EpdRowFetch fetch,
+                                        const void *source, DrawMode_t mode)
 {
     uint8_t frame_count = 15;
 
@@ -825,6 +1040,8 @@ void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode)
         OutputParams p1 = {
             .area = area,
             .data_ptr = data,
+            .fetch_row = fetch,
+            .source = source,
             .frame = k,
             .mode = mode,
             .done_smphr = fetch_sem,
@@ -832,6 +1049,8 @@ void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode)
         OutputParams p2 = {
             .area = area,
             .data_ptr = data,
+            .fetch_row = fetch,
+            .source = source,
             .frame = k,
             .mode = mode,
             .done_smphr = feed_sem,
@@ -854,9 +1073,6 @@ void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode)
     vSemaphoreDelete(feed_sem);
 }
 
-/******************************************************************************/
-/***        local functions                                                 ***/
-/******************************************************************************/
 
 static void write_row(uint32_t output_time_dus)
 {
@@ -1017,6 +1233,13 @@ static void IRAM_ATTR provide_out(OutputParams *params)
             continue;
         }
 
+        if (params->fetch_row)
+        {
+            params->fetch_row(params->source, i, line);
+            xQueueSendToBack(output_queue, line, portMAX_DELAY);
+            continue;
+        }
+
         uint32_t *lp;
         bool shifted = false;
         if (area.width == EPD_WIDTH && area.x == 0)
@@ -1109,6 +1332,49 @@ static void IRAM_ATTR feed_display(OutputParams *params)
     vTaskDelay(portMAX_DELAY);
 }
 
+static inline void set_pixel_1bpp(uint8_t *row, int32_t x, bool ink)
+{
+    if (ink)
+    {
+        row[x / 8] |= 1 << (x % 8);
+    }
+    else
+    {
+        row[x / 8] &= ~(1 << (x % 8));
+    }
+}
+
+
+static inline void rotate_point(int32_t *x, int32_t *y)
+{
+    int32_t xx = *x;
+    int32_t yy = *y;
+    if (mirrored)
+    {
+        xx = epd_rotated_display_width() - 1 - xx;
+    }
+    switch (rotation)
+    {
+    case EPD_ROT_LANDSCAPE:
+        *x = xx;
+        *y = yy;
+        break;
+    case EPD_ROT_PORTRAIT:
+        *x = EPD_WIDTH - 1 - yy;
+        *y = xx;
+        break;
+    case EPD_ROT_INVERTED_LANDSCAPE:
+        *x = EPD_WIDTH - 1 - xx;
+        *y = EPD_HEIGHT - 1 - yy;
+        break;
+    case EPD_ROT_INVERTED_PORTRAIT:
+        *x = yy;
+        *y = EPD_HEIGHT - 1 - xx;
+        break;
+    }
+}
+
+
 static void delay(uint32_t ms)
 {
     vTaskDelay(pdMS_TO_TICKS(ms));
@@ -16,6 +16,7 @@ extern "C" {
 #include <esp_attr.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "utilities.h"
 /******************************************************************************/
@@ -32,6 +33,14 @@ extern "C" {
  */
 #define EPD_HEIGHT 540
 
+/**
+ * @brief Size in bytes of a 1 bit per pixel framebuffer.
+ *
+ * Pixels are packed eight per byte, least significant bit first. A set bit
+ * is an inked (black) pixel.
+ */
+#define EPD_FRAMEBUFFER_1BPP_SIZE (EPD_WIDTH / 8 * EPD_HEIGHT)
+
 /******************************************************************************/
 /***        type definitions                                                ***/
 /******************************************************************************/
@@ -57,6 +66,17 @@ typedef enum
     WHITE_ON_BLACK = 1 << 2, /** Draw with white ink on a black display. */
 } DrawMode_t;
 
+/**
+ * @brief Orientation of the framebuffer canvas relative to the panel.
+ */
+typedef enum
+{
+    EPD_ROT_LANDSCAPE = 0,          /** Native orientation. */
+    EPD_ROT_PORTRAIT = 1,           /** Rotated 90 degrees clockwise. */
+    EPD_ROT_INVERTED_LANDSCAPE = 2, /** Rotated 180 degrees. */
+    EPD_ROT_INVERTED_PORTRAIT = 3,  /** Rotated 270 degrees clockwise. */
+} EpdRotation;
+
 /**
  * @brief Font drawing flags.
  */
@@ -76,6 +96,15 @@ typedef struct
     uint32_t flags;          /** Additional flags, reserved for future use */
 } FontProperties;
 
+/**
+ * @brief Provide one full panel row of 4 bit pixel data.
+ *
+ * @param source The data source passed to `epd_draw_image_rows`.
+ * @param y      The panel row to fetch.
+ * @param row    Output buffer of `EPD_WIDTH / 2` bytes.
+ */
+typedef void (*EpdRowFetch)(const void *source, int32_t y, uint8_t *row);
+
 /******************************************************************************/
 /***        exported variables                                              ***/
 /******************************************************************************/
@@ -159,13 +188,82 @@ void IRAM_ATTR epd_draw_grayscale_image(Rect_t area, uint8_t *data);
  */
 void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode);
 
+/**
+ * @brief Draw an image whose rows are produced on demand instead of being
+ *        read from a framebuffer.
+ *
+ * @param area   Only rows `area.y` to `area.y + area.height` are fetched and
+ *               drawn, always at full panel width.
+ * @param fetch  Called once per drawn row and frame.
+ * @param source Passed through to `fetch`.
+ * @param mode   The draw mode, as for `epd_draw_image`.
+ */
+void IRAM_ATTR epd_draw_image_rows(Rect_t area, EpdRowFetch fetch,
+                                   const void *source, DrawMode_t mode);
+
 void IRAM_ATTR epd_draw_frame_1bit(Rect_t area, uint8_t *ptr, DrawMode_t mode, int32_t time);
 
+/**
+ * @brief Draw a 1 bit per pixel picture to a given area. The image area is not
+ *        cleared and assumed to be white before drawing.
+ *
+ * Only a few frames of `epd_draw_frame_1bit` are needed instead of the 15
+ * grayscale frames, and only an eighth of the image data is read per frame.
+ *
+ * @param area The display area to draw to. `width` and `height` of the area
+ *             must correspond to the image dimensions in pixels.
+ * @param data The image data, 8 pixels per byte, least significant bit first.
+ *             Rows are padded to full bytes.
+ * @param mode BLACK_ON_WHITE darkens set pixels, the other modes lighten them.
+ */
+void IRAM_ATTR epd_draw_image_1bpp(Rect_t area, uint8_t *data, DrawMode_t mode);
+
 /**
  * @brief Rectancle representing the whole screen area.
  */
 Rect_t epd_full_screen();
 
+/**
+ * @brief Set the orientation used when drawing to a framebuffer.
+ *
+ * The transform is applied per pixel while rasterizing, so no rotated copy
+ * of the framebuffer is needed and the refresh pipeline is unchanged.
+ * Framebuffer drawing functions take canvas coordinates, where the canvas is
+ * `epd_rotated_display_width()` by `epd_rotated_display_height()` pixels.
+ * Functions which drive the panel directly (`epd_draw_image`,
+ * `epd_clear_area`, `write_mode` without a framebuffer, ...) keep using panel
+ * coordinates, use `epd_rotate_area` to convert.
+ *
+ * @param rotation The canvas rotation.
+ * @param mirror   Mirror the canvas horizontally, before rotating it.
+ */
+void epd_set_rotation(EpdRotation rotation, bool mirror);
+
+/**
+ * @brief The current canvas rotation.
+ */
+EpdRotation epd_get_rotation();
+
+/**
+ * @brief Is a rotation or mirroring in effect?
+ */
+bool epd_is_rotated();
+
+/**
+ * @brief Width of the canvas in the current rotation.
+ */
+int32_t epd_rotated_display_width();
+
+/**
+ * @brief Height of the canvas in the current rotation.
+ */
+int32_t epd_rotated_display_height();
+
+/**
+ * @brief Convert an area in canvas coordinates to panel coordinates.
+ */
+Rect_t epd_rotate_area(Rect_t area);
+
 /**
  * @brief Draw a picture to a given framebuffer.
  *
@@ -327,6 +425,85 @@ void epd_draw_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x
  */
 void epd_fill_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t color, uint8_t *framebuffer);
 
+/**
+ * @brief Draw a pixel to a given 1 bit per pixel framebuffer.
+ *
+ * @param x           Horizontal position in pixels.
+ * @param y           Vertical position in pixels.
+ * @param color       The gray value of the pixel (0-255), values below 128
+ *                    are inked.
+ * @param framebuffer The framebuffer to draw to, which must
+ *                    be `EPD_FRAMEBUFFER_1BPP_SIZE` bytes large.
+ */
+void epd_draw_pixel_1bpp(int32_t x, int32_t y, uint8_t color,
+                         uint8_t *framebuffer);
+
+/**
+ * @brief Draw a horizontal line to a given 1 bit per pixel framebuffer.
+ *
+ * @param x           Horizontal start position in pixels.
+ * @param y           Vertical start position in pixels.
+ * @param length      Length of the line in pixels.
+ * @param color       The gray value of the line (0-255);
+ * @param framebuffer The framebuffer to draw to, which must
+ *                    be `EPD_FRAMEBUFFER_1BPP_SIZE` bytes large.
+ */
+void epd_draw_hline_1bpp(int32_t x, int32_t y, int32_t length, uint8_t color,
+                         uint8_t *framebuffer);
+
+/**
+ * @brief Draw a vertical line to a given 1 bit per pixel framebuffer.
+ *
+ * @param x           Horizontal start position in pixels.
+ * @param y           Vertical start position in pixels.
+ * @param length      Length of the line in pixels.
+ * @param color       The gray value of the line (0-255);
+ * @param framebuffer The framebuffer to draw to, which must
+ *                    be `EPD_FRAMEBUFFER_1BPP_SIZE` bytes large.
+ */
+void epd_draw_vline_1bpp(int32_t x, int32_t y, int32_t length, uint8_t color,
+                         uint8_t *framebuffer);
+
+/**
+ * @brief Draw a rectanle with no fill color to a 1 bit per pixel framebuffer.
+ *
+ * @param x           Top left corner x coordinate
+ * @param y           Top left corner y coordinate
+ * @param w           Width in pixels
+ * @param h           Height in pixels
+ * @param color       The gray value of the line (0-255);
+ * @param framebuffer The framebuffer to draw to
+ */
+void epd_draw_rect_1bpp(int32_t x, int32_t y, int32_t w, int32_t h,
+                        uint8_t color, uint8_t *framebuffer);
+
+/**
+ * @brief Draw a rectanle with fill color to a 1 bit per pixel framebuffer.
+ *
+ * @param x           Top left corner x coordinate
+ * @param y           Top left corner y coordinate
+ * @param w           Width in pixels
+ * @param h           Height in pixels
+ * @param color       The gray value of the line (0-255);
+ * @param framebuffer The framebuffer to draw to
+ */
+void epd_fill_rect_1bpp(int32_t x, int32_t y, int32_t w, int32_t h,
+                        uint8_t color, uint8_t *framebuffer);
+
+/**
+ * @brief Threshold a 4 bit grayscale picture into a 1 bit per pixel
+ *        framebuffer.
+ *
+ * @param image_area  The area to copy to. `width` and `height` of the area must
+ *                    correspond to the image dimensions in pixels.
+ * @param image_data  The image data, as a buffer of 4 bit wide brightness values
+ *                    (see `epd_copy_to_framebuffer`). Values below 8 are inked.
+ * @param framebuffer The framebuffer object, which must
+ *                    be `EPD_FRAMEBUFFER_1BPP_SIZE` large.
+ */
+void epd_copy_to_framebuffer_1bpp(Rect_t image_area, uint8_t *image_data,
+                                  uint8_t *framebuffer);
+
 /**
  * @brief Font data stored PER GLYPH
  */
@@ -351,6 +528,49 @@ typedef struct
     uint32_t offset; /** Index of the first code point into the glyph array */
 } UnicodeInterval;
 
+/**
+ * @brief Code points per page of the glyph page table.
+ */
+#define GLYPH_PAGE_SIZE 256
+
+/**
+ * @brief Encoding of the glyph bitmaps of a compressed font.
+ */
+typedef enum
+{
+    /** zlib streams, with header and adler32 trailer. */
+    GLYPH_FORMAT_ZLIB = 0,
+    /** Raw deflate streams without header and trailer. */
+    GLYPH_FORMAT_RAW_DEFLATE = 1,
+    /**
+     * Runs of equal coverage, row by row. A run byte holds the coverage level
+     * in the upper and the run length - 1 in the lower 4 bits; a length of 16
+     * is followed by a byte adding up to 255 pixels more. Runs do not cross
+     * rows and are drawn without an intermediate bitmap.
+     */
+    GLYPH_FORMAT_RLE = 2,
+    /**
+     * Rendered from the signed distance fields of an `SdfFont` at the size
+     * of the `SdfInstance` the font belongs to, see `sdf_font.h`.
+     */
+    GLYPH_FORMAT_SDF = 3,
+} GlyphFormat;
+
+/**
+ * @brief Layout metrics of a font, precomputed by fontconvert.py. The box is
+ *        the union of the glyph boxes of a character class, by default the
+ *        digits and the colon, relative to the cursor on the base line.
+ */
+typedef struct
+{
+    uint8_t digit_advance;   /** Largest advance of the digits, 0 if the metrics are unknown */
+    bool    tabular_figures; /** Do all digits have the same advance? */
+    int16_t box_left;        /** Leftmost glyph pixel */
+    int16_t box_top;         /** Rows above the base line */
+    int16_t box_right;       /** End of the rightmost glyph pixel */
+    int16_t box_bottom;      /** Rows below the base line */
+} FontMetrics;
+
 /**
  * @brief Data stored for FONT AS A WHOLE
  */
@@ -364,6 +584,31 @@ typedef struct
     uint8_t          advance_y;      /** Newline distance (y axis) */
     int32_t          ascender;       /** Maximal height of a glyph above the base line */
     int32_t          descender;      /** Maximal height of a glyph below the base line */
+    uint8_t          format;         /** GlyphFormat of compressed glyph bitmaps */
+    uint8_t         *dictionary;     /** Preset dictionary of raw deflate glyphs, or NULL */
+    uint32_t         dictionary_size; /** Size of the preset dictionary in bytes */
+    /**
+     * Optional page table for direct glyph lookup, or NULL. Page `cp / 256`
+     * maps `cp % 256` to the glyph index + 1, 0 if the font has no glyph.
+     * A NULL page holds no glyphs. Code points beyond the table are searched
+     * in the intervals.
+     */
+    uint16_t       **glyph_pages;
+    uint32_t         glyph_page_count; /** Number of pages in `glyph_pages` */
+    FontMetrics      metrics;          /** Layout metrics, all 0 if unknown */
+    /**
+     * Are the glyph bitmaps preceded by their row spans? Then the
+     * `2 * height` bytes before `data_offset` hold the first inked column and
+     * the end of the last one for every row, 0, 0 for blank rows.
+     */
+    bool             row_spans;
+    /**
+     * Bits of coverage per glyph pixel: 1, 2 or 4, 0 is read as 4. Bitmaps
+     * of fewer bits pack their pixels from the lowest bits up, with rows
+     * starting at a byte, and are expanded to 4 bits before drawing. RLE
+     * glyphs always hold 4 bit levels.
+     */
+    uint8_t          bit_depth;
 } GFXfont;
 
 typedef struct
@@ -373,6 +618,73 @@ typedef struct
     uint8_t* data;
 } GFXimage;
 
+/**
+ * @brief Maximum number of glyphs in a `TextRun`.
+ */
+#define TEXT_RUN_MAX_GLYPHS 64
+
+/**
+ * @brief A glyph placed within a text run.
+ */
+typedef struct
+{
+    const GFXfont *font; /** Font of the glyph, differs within a run shaped from a `FontStack` */
+    const GFXglyph *glyph;
+    int32_t x; /** Cursor position of the glyph, relative to the start of the run */
+} ShapedGlyph;
+
+/**
+ * @brief A string decoded and looked up once, to be measured and drawn
+ *        any number of times.
+ */
+typedef struct
+{
+    const GFXfont *font;
+    FontProperties props;
+    ShapedGlyph glyphs[TEXT_RUN_MAX_GLYPHS];
+    uint32_t glyph_count;
+    int32_t advance; /** Cursor movement over the whole run */
+    int32_t x1;      /** Bounds when drawn at (0, 0), see `get_text_bounds` */
+    int32_t y1;
+    int32_t w;
+    int32_t h;
+} TextRun;
+
+/**
+ * @brief Look up the glyph of a code point for `text_run_shape_lookup`.
+ *
+ * @param source The glyph source passed to `text_run_shape_lookup`.
+ * @param font   Set to the font the glyph belongs to.
+ *
+ * @return The glyph, NULL if the source has none.
+ */
+typedef const GFXglyph *(*TextRunLookup)(const void *source, uint32_t code_point,
+                                         const GFXfont **font);
+
+/**
+ * @brief Glyph coverage mapped to output colors, built once per string.
+ */
+typedef struct
+{
+    uint8_t color[16]; /** Blended color of each coverage level */
+    uint8_t pair[256]; /** Blended colors of both pixels of a bitmap byte */
+} ColorLut;
+
+/**
+ * @brief A text run placed on the panel, whose rows are produced on demand
+ *        by `text_raster_fetch_row` instead of being drawn to a framebuffer.
+ */
+typedef struct
+{
+    const TextRun *run;
+    int32_t x;     /** Cursor position of the run on the panel */
+    int32_t y;
+    Rect_t area;   /** Full width panel rows covered by the glyphs */
+    const uint8_t *bitmaps[TEXT_RUN_MAX_GLYPHS]; /** Decoded glyph bitmaps */
+    uint8_t *data; /** Memory of the decoded bitmaps of compressed fonts */
+    ColorLut color_lut;
+} TextRaster;
+
 /**
  * @brief Get the text bounds for string, when drawn at (x, y).
  *        Set font properties to NULL to use the defaults.
@@ -381,6 +693,68 @@ void get_text_bounds(const GFXfont *font, const char *string, int32_t *x, int32_
                      int32_t *x1, int32_t *y1, int32_t *w, int32_t *h,
                      const FontProperties *props);
 
+/**
+ * @brief Decode a string and look up its glyphs, calculating the bounds.
+ *        Set font properties to NULL to use the defaults.
+ *
+ * @return false if the string was cut off after `TEXT_RUN_MAX_GLYPHS`.
+ */
+bool text_run_shape(TextRun *run, const GFXfont *font, const char *string,
+                    const FontProperties *props);
+
+/**
+ * @brief Shape a run like `text_run_shape`, with the glyphs found by
+ *        `lookup` in `source`. Missing code points are looked up again as
+ *        the fallback glyph. The run is measured with the metrics of `font`.
+ *
+ * @return false if the string was cut off after `TEXT_RUN_MAX_GLYPHS`.
+ */
+bool text_run_shape_lookup(TextRun *run, const GFXfont *font, TextRunLookup lookup,
+                           const void *source, const char *string,
+                           const FontProperties *props);
+
+/**
+ * @brief Get the bounds of a run when drawn at (x, y), like `get_text_bounds`.
+ */
+void text_run_get_bounds(const TextRun *run, int32_t *x, int32_t *y, int32_t *x1,
+                         int32_t *y1, int32_t *w, int32_t *h);
+
+/**
+ * @brief Write a shaped run, like `write_mode` with the properties it was
+ *        shaped with.
+ */
+void text_run_write(const TextRun *run, int32_t *cursor_x, int32_t *cursor_y,
+                    uint8_t *framebuffer, DrawMode_t mode);
+
+/**
+ * @brief Prepare a shaped run for drawing with `epd_draw_image_rows` at
+ *        cursor position (x, y) of the panel. Glyphs of compressed fonts are
+ *        decoded once, into memory owned by the raster. The run must outlive
+ *        the raster.
+ *
+ * @return false if out of memory or the canvas is rotated.
+ */
+bool text_raster_init(TextRaster *raster, const TextRun *run, int32_t x, int32_t y);
+
+/**
+ * @brief `EpdRowFetch` of a `TextRaster`: panel row `y` with the glyph rows
+ *        crossing it blended over the background color, the same pixels
+ *        `text_run_write` draws into a buffer filled with that color. Where
+ *        the boxes of neighbouring glyphs overlap, the later glyph is drawn
+ *        over the earlier one, also for RLE fonts.
+ *
+ * Only glyphs intersecting the row are visited, so text is drawn without a
+ * framebuffer:
+ *
+ *     epd_draw_image_rows(raster.area, text_raster_fetch_row, &raster, BLACK_ON_WHITE);
+ */
+void IRAM_ATTR text_raster_fetch_row(const void *raster, int32_t y, uint8_t *row);
+
+/**
+ * @brief Free the decoded glyphs of a raster.
+ */
+void text_raster_release(TextRaster *raster);
+
 /**
  * @brief Write text to the EPD.
  */
@@ -397,10 +771,45 @@ void write_mode(const GFXfont *font, const char *string, int32_t *cursor_x,
                 const FontProperties *properties);
 
 /**
- * @brief Get the font glyph for a unicode code point.
+ * @brief Write text to a 1 bit per pixel framebuffer.
+ *
+ * Glyph coverage is blended between the foreground and background color and
+ * then thresholded: pixels darker than mid-gray are inked.
+ *
+ * @note framebuffer must be `EPD_FRAMEBUFFER_1BPP_SIZE` bytes large.
+ */
+void write_1bpp(const GFXfont *font, const char *string, int32_t *cursor_x,
+                int32_t *cursor_y, uint8_t *framebuffer,
+                const FontProperties *properties);
+
+/**
+ * @brief Write text to a 4 bit per pixel buffer of any size, e.g. to
+ *        pre-render glyphs. Rows are `(buf_width + 1) / 2` bytes large.
+ *
+ * @note The canvas rotation is not applied, pixels outside of the buffer
+ *       are clipped.
+ */
+void write_to_buffer(const GFXfont *font, const char *string, int32_t *cursor_x,
+                     int32_t cursor_y, uint8_t *buffer, int32_t buf_width,
+                     int32_t buf_height, const FontProperties *properties);
+
+/**
+ * @brief Get the font glyph for a unicode code point, NULL if the font has
+ *        none. Uses the glyph page table if the font has one, a binary search
+ *        over the intervals otherwise.
  */
 void get_glyph(const GFXfont *font, uint32_t code_point, GFXglyph **glyph);
 
+/**
+ * @brief Decompress the glyphs of a string into the glyph cache ahead of
+ *        drawing, e.g. `GLYPH_CACHE_DIGITS` for a clock font. Does nothing
+ *        for uncompressed fonts.
+ *
+ * @note Glyphs beyond the cache budget evict each other, size it with
+ *       `glyph_cache_set_budget` first.
+ */
+void prewarm_glyph_cache(const GFXfont *font, const char *string);
+
 /**
  * @brief Write a (multi-line) string to the EPD.
  */
@@ -0,0 +1,364 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_tiles.h"
+
+#include <esp_log.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief number of bytes in one row of a tile.
+ */
+#define TILE_ROW_BYTES (EPD_TILE_SIZE / 2)
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static inline int32_t min(int32_t x, int32_t y)
+{
+    return x < y ? x : y;
+}
+
+static inline int32_t max(int32_t x, int32_t y)
+{
+    return x > y ? x : y;
+}
+
+/**
+ * @brief Allocate the pixel data of a uniform tile, filled with its color.
+ *
+ * @return The tile data, NULL if out of memory.
+ */
+static uint8_t *materialize(EpdTiles *tiles, int32_t index);
+
+/**
+ * @brief Make a tile uniform, releasing its pixel data.
+ */
+static void make_uniform(EpdTiles *tiles, int32_t index, uint8_t fill);
+
+/**
+ * @brief Check whether `rows` tile rows, `stride` bytes apart, hold a
+ *        single color.
+ *
+ * @param fill Set to the color byte if the rows are uniform.
+ */
+static bool is_uniform(const uint8_t *data, size_t stride, int32_t rows, uint8_t *fill);
+
+/**
+ * @brief Fill the pixels `x0` to `x1` (exclusive) of a tile row.
+ */
+static void fill_span(uint8_t *row, int32_t x0, int32_t x1, uint8_t fill);
+
+/**
+ * @brief Number of panel rows covered by a tile row, the last one is cut off.
+ */
+static inline int32_t tile_rows(int32_t ty);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+void epd_tiles_init(EpdTiles *tiles, uint8_t color)
+{
+    memset(tiles->data, 0, sizeof(tiles->data));
+    memset(tiles->fill, (color & 0xF0) | (color >> 4), sizeof(tiles->fill));
+}
+
+
+void epd_tiles_clear(EpdTiles *tiles, uint8_t color)
+{
+    for (int32_t i = 0; i < EPD_TILES_X * EPD_TILES_Y; i++)
+    {
+        free(tiles->data[i]);
+    }
+    epd_tiles_init(tiles, color);
+}
+
+
+void epd_tiles_draw_pixel(int32_t x, int32_t y, uint8_t color, EpdTiles *tiles)
+{
+    if (epd_is_rotated())
+    {
+        Rect_t pixel = epd_rotate_area((Rect_t){.x = x, .y = y, .width = 1, .height = 1});
+        x = pixel.x;
+        y = pixel.y;
+    }
+    if (x < 0 || x >= EPD_WIDTH || y < 0 || y >= EPD_HEIGHT)
+    {
+        return;
+    }
+
+    int32_t index = (y / EPD_TILE_SIZE) * EPD_TILES_X + x / EPD_TILE_SIZE;
+    if (tiles->data[index] == NULL && (tiles->fill[index] & 0xF0) == (color & 0xF0))
+    {
+        return;
+    }
+    uint8_t *data = materialize(tiles, index);
+    if (!data)
+    {
+        return;
+    }
+
+    x %= EPD_TILE_SIZE;
+    uint8_t *buf_ptr = &data[(y % EPD_TILE_SIZE) * TILE_ROW_BYTES + x / 2];
+    if (x % 2)
+    {
+        *buf_ptr = (*buf_ptr & 0x0F) | (color & 0xF0);
+    }
+    else
+    {
+        *buf_ptr = (*buf_ptr & 0xF0) | (color >> 4);
+    }
+}
+
+
+void epd_tiles_fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color,
+                         EpdTiles *tiles)
+{
+    Rect_t area = {.x = x, .y = y, .width = w, .height = h};
+    if (w <= 0 || h <= 0)
+    {
+        return;
+    }
+    if (epd_is_rotated())
+    {
+        area = epd_rotate_area(area);
+    }
+
+    int32_t x0 = max(area.x, 0);
+    int32_t y0 = max(area.y, 0);
+    int32_t x1 = min(area.x + area.width, EPD_WIDTH);
+    int32_t y1 = min(area.y + area.height, EPD_HEIGHT);
+    if (x0 >= x1 || y0 >= y1)
+    {
+        return;
+    }
+
+    uint8_t fill = (color & 0xF0) | (color >> 4);
+    for (int32_t ty = y0 / EPD_TILE_SIZE; ty <= (y1 - 1) / EPD_TILE_SIZE; ty++)
+    {
+        int32_t ty0 = ty * EPD_TILE_SIZE;
+        int32_t ry0 = max(y0, ty0) - ty0;
+        int32_t ry1 = min(y1, ty0 + tile_rows(ty)) - ty0;
+        for (int32_t tx = x0 / EPD_TILE_SIZE; tx <= (x1 - 1) / EPD_TILE_SIZE; tx++)
+        {
+            int32_t index = ty * EPD_TILES_X + tx;
+            int32_t tx0 = tx * EPD_TILE_SIZE;
+            int32_t rx0 = max(x0, tx0) - tx0;
+            int32_t rx1 = min(x1, tx0 + EPD_TILE_SIZE) - tx0;
+
+            if (rx0 == 0 && rx1 == EPD_TILE_SIZE && ry0 == 0 && ry1 == tile_rows(ty))
+            {
+                make_uniform(tiles, index, fill);
+                continue;
+            }
+            if (tiles->data[index] == NULL && tiles->fill[index] == fill)
+            {
+                continue;
+            }
+            uint8_t *data = materialize(tiles, index);
+            if (!data)
+            {
+                continue;
+            }
+            for (int32_t r = ry0; r < ry1; r++)
+            {
+                fill_span(&data[r * TILE_ROW_BYTES], rx0, rx1, fill);
+            }
+        }
+    }
+}
+
+
+void epd_tiles_copy_from_framebuffer(EpdTiles *tiles, const uint8_t *framebuffer)
+{
+    for (int32_t ty = 0; ty < EPD_TILES_Y; ty++)
+    {
+        const uint8_t *src_row = &framebuffer[ty * EPD_TILE_SIZE * EPD_WIDTH / 2];
+        for (int32_t tx = 0; tx < EPD_TILES_X; tx++)
+        {
+            int32_t index = ty * EPD_TILES_X + tx;
+            const uint8_t *src = &src_row[tx * TILE_ROW_BYTES];
+            uint8_t fill;
+            if (is_uniform(src, EPD_WIDTH / 2, tile_rows(ty), &fill))
+            {
+                make_uniform(tiles, index, fill);
+                continue;
+            }
+            uint8_t *data = materialize(tiles, index);
+            if (!data)
+            {
+                continue;
+            }
+            for (int32_t r = 0; r < tile_rows(ty); r++)
+            {
+                memcpy(&data[r * TILE_ROW_BYTES], &src[r * EPD_WIDTH / 2], TILE_ROW_BYTES);
+            }
+        }
+    }
+}
+
+
+void epd_tiles_copy_to_framebuffer(const EpdTiles *tiles, uint8_t *framebuffer)
+{
+    for (int32_t y = 0; y < EPD_HEIGHT; y++)
+    {
+        epd_tiles_get_row(tiles, y, &framebuffer[y * EPD_WIDTH / 2]);
+    }
+}
+
+
+void epd_tiles_compact(EpdTiles *tiles)
+{
+    for (int32_t i = 0; i < EPD_TILES_X * EPD_TILES_Y; i++)
+    {
+        uint8_t fill;
+        if (tiles->data[i] &&
+            is_uniform(tiles->data[i], TILE_ROW_BYTES, tile_rows(i / EPD_TILES_X), &fill))
+        {
+            make_uniform(tiles, i, fill);
+        }
+    }
+}
+
+
+void IRAM_ATTR epd_tiles_get_row(const void *source, int32_t y, uint8_t *row)
+{
+    const EpdTiles *tiles = (const EpdTiles *)source;
+    int32_t index = (y / EPD_TILE_SIZE) * EPD_TILES_X;
+    int32_t offset = (y % EPD_TILE_SIZE) * TILE_ROW_BYTES;
+
+    for (int32_t tx = 0; tx < EPD_TILES_X; tx++, index++)
+    {
+        if (tiles->data[index])
+        {
+            memcpy(row, &tiles->data[index][offset], TILE_ROW_BYTES);
+        }
+        else
+        {
+            memset(row, tiles->fill[index], TILE_ROW_BYTES);
+        }
+        row += TILE_ROW_BYTES;
+    }
+}
+
+
+void epd_tiles_draw_image(Rect_t area, const EpdTiles *tiles, DrawMode_t mode)
+{
+    epd_draw_image_rows(area, epd_tiles_get_row, tiles, mode);
+}
+
+
+size_t epd_tiles_memory(const EpdTiles *tiles)
+{
+    size_t size = sizeof(EpdTiles);
+    for (int32_t i = 0; i < EPD_TILES_X * EPD_TILES_Y; i++)
+    {
+        if (tiles->data[i])
+        {
+            size += EPD_TILE_BYTES;
+        }
+    }
+    return size;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static uint8_t *materialize(EpdTiles *tiles, int32_t index)
+{
+    if (tiles->data[index] == NULL)
+    {
+        uint8_t *data = (uint8_t *)malloc(EPD_TILE_BYTES);
+        if (data == NULL)
+        {
+            ESP_LOGE("epd_tiles.c", "no memory for tile %d", index);
+            return NULL;
+        }
+        memset(data, tiles->fill[index], EPD_TILE_BYTES);
+        tiles->data[index] = data;
+    }
+    return tiles->data[index];
+}
+
+
+static void make_uniform(EpdTiles *tiles, int32_t index, uint8_t fill)
+{
+    free(tiles->data[index]);
+    tiles->data[index] = NULL;
+    tiles->fill[index] = fill;
+}
+
+
+static bool is_uniform(const uint8_t *data, size_t stride, int32_t rows, uint8_t *fill)
+{
+    uint8_t value = data[0];
+    if ((value >> 4) != (value & 0xF))
+    {
+        return false;
+    }
+
+    // tile rows are word aligned in both tiles and framebuffers
+    uint32_t word = value * 0x01010101u;
+    for (int32_t r = 0; r < rows; r++)
+    {
+        const uint32_t *row = (const uint32_t *)&data[r * stride];
+        for (int32_t i = 0; i < TILE_ROW_BYTES / 4; i++)
+        {
+            if (row[i] != word)
+            {
+                return false;
+            }
+        }
+    }
+    *fill = value;
+    return true;
+}
+
+
+static void fill_span(uint8_t *row, int32_t x0, int32_t x1, uint8_t fill)
+{
+    if (x0 % 2 && x0 < x1)
+    {
+        row[x0 / 2] = (row[x0 / 2] & 0x0F) | (fill & 0xF0);
+        x0++;
+    }
+    if (x1 % 2 && x0 < x1)
+    {
+        row[x1 / 2] = (row[x1 / 2] & 0xF0) | (fill & 0x0F);
+        x1--;
+    }
+    memset(&row[x0 / 2], fill, (x1 - x0) / 2);
+}
+
+
+static inline int32_t tile_rows(int32_t ty)
+{
+    return min(EPD_TILE_SIZE, EPD_HEIGHT - ty * EPD_TILE_SIZE);
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,153 @@
+/**
+ * Tiled 4 bit framebuffer, storing tiles of a single color as one value.
+ */
+
+#ifndef _EPD_TILES_H_
+#define _EPD_TILES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Width and height of a tile in pixels.
+ */
+#define EPD_TILE_SIZE 32
+
+/**
+ * @brief Bytes of pixel data in a materialized tile.
+ */
+#define EPD_TILE_BYTES (EPD_TILE_SIZE / 2 * EPD_TILE_SIZE)
+
+/**
+ * @brief Number of tile columns and rows covering the panel.
+ */
+#define EPD_TILES_X ((EPD_WIDTH + EPD_TILE_SIZE - 1) / EPD_TILE_SIZE)
+#define EPD_TILES_Y ((EPD_HEIGHT + EPD_TILE_SIZE - 1) / EPD_TILE_SIZE)
+
+#if EPD_WIDTH % EPD_TILE_SIZE != 0
+#error "the panel width must be a multiple of the tile size"
+#endif
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief A framebuffer split into `EPD_TILE_SIZE` square tiles.
+ *
+ * Tiles which contain a single color are stored as that color only. Pixel
+ * data is allocated just for tiles with actual content, so a mostly white
+ * clock face needs a few kilobytes instead of a full framebuffer.
+ */
+typedef struct
+{
+    /** Pixel data of every tile, row major, NULL for uniform tiles. */
+    uint8_t *data[EPD_TILES_X * EPD_TILES_Y];
+    /** Color of uniform tiles, as a byte of two equal pixels. */
+    uint8_t fill[EPD_TILES_X * EPD_TILES_Y];
+} EpdTiles;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Initialize a tiled framebuffer with every tile uniform.
+ *
+ * @note Must not be called on a tiled framebuffer which holds tile data,
+ *       use `epd_tiles_clear` instead.
+ *
+ * @param color The color, in the upper 4 bits.
+ */
+void epd_tiles_init(EpdTiles *tiles, uint8_t color);
+
+/**
+ * @brief Set every tile to a uniform color and release all tile data.
+ *        Runs in time proportional to the number of tiles.
+ *
+ * @param color The color, in the upper 4 bits.
+ */
+void epd_tiles_clear(EpdTiles *tiles, uint8_t color);
+
+/**
+ * @brief Draw a pixel to a tiled framebuffer.
+ *
+ * Coordinates are canvas coordinates, see `epd_set_rotation`. A uniform tile
+ * is only materialized if the pixel actually changes its color.
+ *
+ * @param color The color, in the upper 4 bits.
+ */
+void epd_tiles_draw_pixel(int32_t x, int32_t y, uint8_t color, EpdTiles *tiles);
+
+/**
+ * @brief Fill a rectangle in a tiled framebuffer.
+ *
+ * Tiles covered completely become uniform and release their data, so large
+ * fills do not cost any memory.
+ *
+ * @param color The color, in the upper 4 bits.
+ */
+void epd_tiles_fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color,
+                         EpdTiles *tiles);
+
+/**
+ * @brief Replace the content of a tiled framebuffer with a full 4 bit
+ *        framebuffer. Uniform tiles are detected and stored compactly.
+ */
+void epd_tiles_copy_from_framebuffer(EpdTiles *tiles, const uint8_t *framebuffer);
+
+/**
+ * @brief Expand a tiled framebuffer to a full 4 bit framebuffer.
+ */
+void epd_tiles_copy_to_framebuffer(const EpdTiles *tiles, uint8_t *framebuffer);
+
+/**
+ * @brief Release the data of tiles which became uniform again.
+ */
+void epd_tiles_compact(EpdTiles *tiles);
+
+/**
+ * @brief Fetch a panel row, `EPD_WIDTH / 2` bytes. Uniform tiles are
+ *        expanded with memset. Can be passed to `epd_draw_image_rows`.
+ *
+ * @param source The `EpdTiles` to read from.
+ */
+void IRAM_ATTR epd_tiles_get_row(const void *source, int32_t y, uint8_t *row);
+
+/**
+ * @brief Draw a tiled framebuffer to the display, see `epd_draw_image_rows`.
+ */
+void epd_tiles_draw_image(Rect_t area, const EpdTiles *tiles, DrawMode_t mode);
+
+/**
+ * @brief Number of bytes currently used by the tiled framebuffer, including
+ *        the tile table.
+ */
+size_t epd_tiles_memory(const EpdTiles *tiles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
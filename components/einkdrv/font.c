@@ -1,12 +1,14 @@
-
 /******************************************************************************/
 /***        include files                                                   ***/
 /******************************************************************************/
 
 #include "epd_driver.h"
+#include "glyph_cache.h"
+#include "sdf_font.h"
+#include "text_layout.h"
+#include "utf8.h"
 #include "zlib.h"
 
-#include <esp_assert.h>
 #include <esp_heap_caps.h>
 #include <esp_log.h>
 
@@ -19,18 +21,71 @@
 /***        macro definitions                                               ***/
 /******************************************************************************/
 
+/**
+ * @brief Size of the static arena backing the state of each of the two
+ *        inflate streams, which fits an inflate state of about 7 KB. Glyphs
+ *        are inflated in a single call, so no sliding window is allocated,
+ *        except for fonts with a preset dictionary: from the scratch of
+ *        `text_layout_write`, from the heap otherwise.
+ */
+#define INFLATE_ARENA_SIZE (8 * 1024)
+
+/**
+ * @brief Size of the window of the canvas stream, glyphs are compressed
+ *        with the default window size.
+ */
+#define CANVAS_WINDOW_SIZE (1 << MAX_WBITS)
+
+_Static_assert(TEXT_LAYOUT_WINDOW_SIZE == 1 << MAX_WBITS, "sliding window size differs");
+
+/**
+ * @brief Number of glyphs remembered as inflated into the canvas, see
+ *        `drawn_to_canvas`.
+ */
+#define CANVAS_GLYPH_HISTORY 8
+
 /******************************************************************************/
 /***        type definitions                                                ***/
 /******************************************************************************/
 
+/**
+ * @brief Caller memory that glyphs missing from the glyph cache are decoded
+ *        into, instead of allocated memory.
+ */
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+} GlyphScratch;
+
+/**
+ * @brief Internal memory serving the allocations of one inflate stream.
+ */
+typedef struct
+{
+    uint8_t data[INFLATE_ARENA_SIZE] __attribute__((aligned(8)));
+    size_t used;
+    uint8_t *window;  /* caller memory for the sliding window, or NULL */
+    bool window_used;
+} InflateArena;
+
+/**
+ * @brief Where `canvas_out` blends the inflated bitmap of a glyph.
+ */
 typedef struct
 {
-    uint8_t  mask;        /* char data will be bitwise AND with this */
-    uint8_t  lead;        /* start bytes of current char in utf-8 encoded character */
-    uint32_t beg;         /* beginning of codepoint range */
-    uint32_t end;         /* end of codepoint range */
-    int32_t  bits_stored; /* the number of bits from the codepoint that fits in char */
-} utf_t;
+    uint8_t *buffer;
+    int32_t buf_width;        /* bytes per buffer row */
+    int32_t buf_height;
+    int32_t x0;               /* position of the upper left glyph pixel */
+    int32_t y0;
+    int32_t width;            /* glyph size in pixels */
+    int32_t height;
+    int32_t byte_width;       /* glyph bytes per row */
+    uint32_t offset;          /* bitmap bytes received so far */
+    const ColorLut *color_lut;
+    const uint8_t *row_spans; /* of the glyph, or NULL */
+} CanvasSink;
 
 /******************************************************************************/
 /***        local function prototypes                                       ***/
@@ -46,27 +101,267 @@ static inline int32_t max(int32_t x, int32_t y)
     return x > y ? x : y;
 }
 
-static int32_t utf8_len(const uint8_t ch);
+/**
+ * @brief Bits per pixel of the glyph bitmaps of a font.
+ */
+static inline uint32_t bit_depth(const GFXfont *font)
+{
+    return font->bit_depth ? font->bit_depth : 4;
+}
 
-static uint32_t next_cp(uint8_t **string);
+/**
+ * @brief Are the glyph bitmaps of a font decoded into 4bpp bitmaps before
+ *        they are drawn, instead of being read from the font?
+ */
+static inline bool needs_decode(const GFXfont *font)
+{
+    return font->compressed || bit_depth(font) != 4;
+}
 
 static FontProperties font_properties_default();
 
+/**
+ * @brief Get the glyph of a code point, or the fallback glyph.
+ *
+ * @return The glyph, NULL if the font has neither.
+ */
+static GFXglyph *find_glyph(const GFXfont *font, uint32_t cp, const FontProperties *props);
+
+/**
+ * @brief Get the bounds of the bytes `string` to `end`, see `get_text_bounds`.
+ */
+static void measure_text(const GFXfont *font,
+                         const char *string,
+                         const char *end,
+                         int32_t *x,
+                         int32_t *y,
+                         int32_t *x1,
+                         int32_t *y1,
+                         int32_t *w,
+                         int32_t *h,
+                         const FontProperties *props);
+
+/**
+ * @brief Write the bytes `string` to `end`, see `write_mode`.
+ */
+static void write_text(const GFXfont *font,
+                       const char *string,
+                       const char *end,
+                       int32_t *cursor_x,
+                       int32_t *cursor_y,
+                       uint8_t *framebuffer,
+                       DrawMode_t mode,
+                       const FontProperties *properties);
+
+/**
+ * @brief Draw the glyphs of the bytes `string` to `end`, or of a shaped run
+ *        if `run` is set, which are known to cover the bounds (x1, y1, w, h).
+ */
+static void write_glyphs(const GFXfont *font,
+                         const char *string,
+                         const char *end,
+                         const TextRun *run,
+                         int32_t x1,
+                         int32_t y1,
+                         int32_t w,
+                         int32_t h,
+                         int32_t *cursor_x,
+                         int32_t *cursor_y,
+                         uint8_t *framebuffer,
+                         DrawMode_t mode,
+                         const FontProperties *props);
+
+/**
+ * @brief Draw the glyphs of the bytes `string` to `end` into a framebuffer,
+ *        decoding them into `scratch`.
+ */
+static void write_span(const GFXfont *font,
+                       const char *string,
+                       const char *end,
+                       int32_t *cursor_x,
+                       int32_t cursor_y,
+                       uint8_t *framebuffer,
+                       const FontProperties *props,
+                       const ColorLut *color_lut,
+                       bool rotated,
+                       const GlyphScratch *scratch);
+
+/**
+ * @brief Draw a glyph. If `rotated` is set, buffer is a full framebuffer
+ *        and the canvas rotation is applied to every pixel. With a `scratch`,
+ *        no memory is allocated for the glyph.
+ */
 static void IRAM_ATTR draw_char(const GFXfont *font,
                                 uint8_t *buffer,
                                 int32_t *cursor_x,
                                 int32_t cursor_y,
                                 uint16_t buf_width,
                                 uint16_t buf_height,
-                                uint32_t cp,
-                                const FontProperties *props);
+                                const GFXglyph *glyph,
+                                const ColorLut *color_lut,
+                                bool rotated,
+                                const GlyphScratch *scratch);
+
+/**
+ * @brief Draw a character to a 1bpp framebuffer, inking every pixel whose
+ *        blended color is darker than mid-gray.
+ */
+static void IRAM_ATTR draw_char_1bpp(const GFXfont *font,
+                                     uint8_t *framebuffer,
+                                     int32_t *cursor_x,
+                                     int32_t cursor_y,
+                                     uint32_t cp,
+                                     const FontProperties *props,
+                                     const ColorLut *color_lut);
+
+/**
+ * @brief Get the 4bpp bitmap of a glyph, decompressing it if needed.
+ *        Decompressed bitmaps are kept in the glyph cache when they fit.
+ *        Release it with `release_glyph_bitmap`.
+ */
+static uint8_t *get_glyph_bitmap(const GFXfont *font, const GFXglyph *glyph);
+
+static void release_glyph_bitmap(const GFXfont *font, uint8_t *bitmap);
+
+/**
+ * @brief Get the 4bpp bitmap of a glyph from the font, the glyph cache or
+ *        decoded into `scratch`. It needs no release.
+ *
+ * @return NULL if the glyph does not fit the scratch.
+ */
+static uint8_t *get_scratch_glyph_bitmap(const GFXfont *font, const GFXglyph *glyph,
+                                         const GlyphScratch *scratch);
+
+/**
+ * @brief Read one run of a `GLYPH_FORMAT_RLE` glyph.
+ *
+ * @return Pointer to the next run.
+ */
+static inline const uint8_t *next_run(const uint8_t *data, uint8_t *level, int32_t *count);
+
+/**
+ * @brief Decode a `GLYPH_FORMAT_RLE` glyph into a 4bpp bitmap.
+ */
+static void decode_rle_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap);
+
+/**
+ * @brief Draw a `GLYPH_FORMAT_RLE` glyph with its upper left corner at
+ *        (x0, y0), directly from the encoded runs. Background runs are
+ *        skipped and leave the buffer untouched.
+ */
+static void IRAM_ATTR draw_rle_glyph(const GFXfont *font, const GFXglyph *glyph,
+                                     int32_t x0, int32_t y0, uint8_t *buffer,
+                                     int32_t buf_width, int32_t buf_height,
+                                     const uint8_t *color_lut);
+
+/**
+ * @brief Blend `count` pixels of a glyph bitmap row, starting at pixel `src_x`,
+ *        into a 4bpp row at pixel `dst_x`. The span must be clipped already.
+ *        Two pixels are blended per byte, with the source shifted by a nibble
+ *        if its parity differs from the destination.
+ */
+static inline void blend_span(uint8_t *row, int32_t dst_x, const uint8_t *src,
+                              int32_t src_x, int32_t count, const ColorLut *color_lut);
+
+/**
+ * @brief Does a glyph bitmap span have zero coverage everywhere?
+ */
+static inline bool is_blank(const uint8_t *src, int32_t bytes);
+
+/**
+ * @brief Narrow the columns `x0` to `x1` (exclusive) of glyph row `y` to its
+ *        inked span, taken from the row spans of the font if it has them.
+ *
+ * @return false if nothing is left to draw.
+ */
+static inline bool clip_to_ink(const GFXfont *font, const GFXglyph *glyph, int32_t y,
+                               const uint8_t *src, int32_t *x0, int32_t *x1);
+
+/**
+ * @brief Set the pixels `x0` to `x1` (exclusive) of a 4bpp row to `color`.
+ */
+static inline void fill_nibbles(uint8_t *row, int32_t x0, int32_t x1, uint8_t color);
+
+/**
+ * @brief Decode a glyph of a compressed or low bit depth font into the 4bpp
+ *        `bitmap`.
+ */
+static bool decode_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap);
+
+/**
+ * @brief Expand the 1bpp or 2bpp bitmap of a glyph at `src` to 4bpp through
+ *        the expansion LUT. `src` may be the start of `bitmap`.
+ */
+static void expand_glyph(const GFXfont *font, const GFXglyph *glyph, const uint8_t *src,
+                         uint8_t *bitmap);
+
+/**
+ * @brief Decompress the data of a glyph with the long-lived inflate stream.
+ *
+ * @return true if exactly `size` bytes were decompressed.
+ */
+static bool inflate_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap,
+                          uint32_t size);
+
+/**
+ * @brief Inflate a raw deflate glyph without a preset dictionary straight
+ *        into the buffer described by `sink`, without a glyph bitmap.
+ *
+ * @return true if the whole glyph was inflated.
+ */
+static bool inflate_glyph_to_canvas(const GFXfont *font, const GFXglyph *glyph,
+                                    CanvasSink *sink);
+
+/**
+ * @brief `inflateBack` input callback. All input is passed up front, so
+ *        asking for more means the glyph data is truncated.
+ */
+static unsigned canvas_in(void *desc, z_const unsigned char **buf);
+
+/**
+ * @brief Remember a glyph as inflated into the canvas.
+ *
+ * @return true if it was inflated into the canvas recently already.
+ */
+static bool drawn_to_canvas(const GFXglyph *glyph);
+
+/**
+ * @brief Serve the sliding window of the inflate stream from `window`, caller
+ *        memory of `TEXT_LAYOUT_WINDOW_SIZE` bytes, or from the heap again if
+ *        NULL. The stream is ended, so it lets go of its current window.
+ */
+static void use_inflate_window(uint8_t *window);
+
+/**
+ * @brief `inflateBack` output callback, blends the inflated bitmap bytes
+ *        into the canvas. Rows beyond the glyph height are dropped.
+ */
+static int IRAM_ATTR canvas_out(void *desc, unsigned char *buf, unsigned len);
 
 /**
- * @brief Calculate the bounds of a character when drawn at (x, y), move the
+ * @brief zlib allocator serving the inflate state from the `InflateArena`
+ *        passed as `opaque`, and the sliding window from its caller memory
+ *        if it has some. Falls back to the heap once the arena is used up.
+ */
+static voidpf arena_alloc(voidpf opaque, uInt items, uInt size);
+
+/**
+ * @brief Give back memory of `arena_alloc`. zlib frees in the reverse order
+ *        of allocation, so arena memory is rolled back to the freed address.
+ */
+static void arena_free(voidpf opaque, voidpf address);
+
+/**
+ * @brief Map glyph coverage (0-15) to the blended output color.
+ */
+static void build_color_lut(const FontProperties *props, ColorLut *color_lut);
+
+/**
+ * @brief Calculate the bounds of a glyph when drawn at (x, y), move the
  *        cursor (*x) forward, adjust the given bounds.
  */
 static void get_char_bounds(const GFXfont *font,
-                            uint32_t cp,
+                            const GFXglyph *glyph,
                             int32_t *x,
                             int32_t *y,
                             int32_t *minx,
@@ -84,19 +379,45 @@ static void get_char_bounds(const GFXfont *font,
 /******************************************************************************/
 
 /**
- * @brief UTF-8 decode inspired from rosetta code
- *
- * https://rosettacode.org/wiki/UTF-8_encode_and_decode#C
- */
-static utf_t *utf[] = {
-    /*             mask        lead        beg      end       bits */
-    [0] = &(utf_t){0b00111111, 0b10000000, 0,       0,        6},
-    [1] = &(utf_t){0b01111111, 0b00000000, 0000,    0177,     7},
-    [2] = &(utf_t){0b00011111, 0b11000000, 0200,    03777,    5},
-    [3] = &(utf_t){0b00001111, 0b11100000, 04000,   0177777,  4},
-    [4] = &(utf_t){0b00000111, 0b11110000, 0200000, 04177777, 3},
-    &(utf_t){0},
-};
+ * @brief Inflate stream reused for all glyphs, reset between them.
+ */
+static z_stream inflate_stream;
+
+static bool inflate_ready = false;
+
+/**
+ * @brief Arenas of the inflate and the canvas stream. Their Huffman tables
+ *        are read for every code, so they stay in internal memory.
+ */
+static InflateArena inflate_arena;
+
+static InflateArena canvas_arena;
+
+/**
+ * @brief The 4bpp pixels of every byte of a 1bpp and a 2bpp glyph bitmap,
+ *        the first pixel in the lowest nibble. Built on first use.
+ */
+static uint32_t expand_lut_1bpp[256];
+
+static uint16_t expand_lut_2bpp[256];
+
+static bool expand_lut_ready = false;
+
+/**
+ * @brief Stream inflating glyphs into the canvas, and its window. The
+ *        window is written once per output byte and read back only for
+ *        matches, so it lives in PSRAM.
+ */
+static z_stream canvas_stream;
+
+static uint8_t *canvas_window = NULL;
+
+/**
+ * @brief Ring of the glyphs last inflated into the canvas.
+ */
+static const GFXglyph *canvas_glyphs[CANVAS_GLYPH_HISTORY];
+
+static uint32_t canvas_glyph_next = 0;
 
 /******************************************************************************/
 /***        exported functions                                              ***/
@@ -104,22 +425,59 @@ static utf_t *utf[] = {
 
 void get_glyph(const GFXfont *font, uint32_t code_point, GFXglyph **glyph)
 {
-    UnicodeInterval *intervals = font->intervals;
     *glyph = NULL;
-    for (int32_t i = 0; i < font->interval_count; i++)
+    if (font->glyph_pages && code_point / GLYPH_PAGE_SIZE < font->glyph_page_count)
     {
-        UnicodeInterval *interval = &intervals[i];
-        if (code_point >= interval->first && code_point <= interval->last)
+        const uint16_t *page = font->glyph_pages[code_point / GLYPH_PAGE_SIZE];
+        if (page && page[code_point % GLYPH_PAGE_SIZE])
         {
-            *glyph = &font->glyph[interval->offset + (code_point - interval->first)];
-            return;
+            *glyph = &font->glyph[page[code_point % GLYPH_PAGE_SIZE] - 1];
         }
+        return;
+    }
+
+    // intervals are sorted and do not overlap
+    UnicodeInterval *intervals = font->intervals;
+    uint32_t low = 0;
+    uint32_t high = font->interval_count;
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+        UnicodeInterval *interval = &intervals[mid];
         if (code_point < interval->first)
         {
+            high = mid;
+        }
+        else if (code_point > interval->last)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            *glyph = &font->glyph[interval->offset + (code_point - interval->first)];
             return;
         }
     }
-    return;
+}
+
+
+void prewarm_glyph_cache(const GFXfont *font, const char *string)
+{
+    if (!needs_decode(font))
+    {
+        return;
+    }
+
+    uint32_t c;
+    while ((c = utf8_next(&string)))
+    {
+        GFXglyph *glyph;
+        get_glyph(font, c, &glyph);
+        if (glyph)
+        {
+            release_glyph_bitmap(font, get_glyph_bitmap(font, glyph));
+        }
+    }
 }
 
 
@@ -142,109 +500,300 @@ void get_text_bounds(const GFXfont *font,
     {
         props = *properties;
     }
+    measure_text(font, string, string + strlen(string), x, y, x1, y1, w, h, &props);
+}
 
-    if (*string == '\0')
+
+bool text_run_shape(TextRun *run,
+                    const GFXfont *font,
+                    const char *string,
+                    const FontProperties *properties)
+{
+    return text_run_shape_lookup(run, font, NULL, NULL, string, properties);
+}
+
+
+bool text_run_shape_lookup(TextRun *run,
+                           const GFXfont *font,
+                           TextRunLookup lookup,
+                           const void *source,
+                           const char *string,
+                           const FontProperties *properties)
+{
+    run->font = font;
+    run->props = (properties == NULL) ? font_properties_default() : *properties;
+    run->glyph_count = 0;
+
+    // bounds relative to the origin, shifted to the position when used
+    int32_t minx = 100000, miny = 100000, maxx = -1, maxy = -1;
+    int32_t x = 0;
+    int32_t y = 0;
+    // decoded in blocks, as many code points as glyphs may still be added
+    const char *end = string + strlen(string);
+    uint32_t code_points[TEXT_RUN_MAX_GLYPHS];
+    uint32_t count = 0;
+    uint32_t i = 0;
+    while (run->glyph_count < TEXT_RUN_MAX_GLYPHS)
     {
-        *w = 0;
-        *h = 0;
-        *y1 = *y;
-        *x1 = *x;
-        return;
+        if (i == count)
+        {
+            count = utf8_decode(&string, end, code_points,
+                                TEXT_RUN_MAX_GLYPHS - run->glyph_count);
+            i = 0;
+            if (count == 0)
+            {
+                break;
+            }
+        }
+        uint32_t c = code_points[i++];
+        const GFXfont *glyph_font = font;
+        const GFXglyph *glyph = lookup ? lookup(source, c, &glyph_font)
+                                       : find_glyph(font, c, &run->props);
+        if (!glyph && lookup)
+        {
+            glyph = lookup(source, run->props.fallback_glyph, &glyph_font);
+        }
+        if (!glyph)
+        {
+            continue;
+        }
+        run->glyphs[run->glyph_count].font = glyph_font;
+        run->glyphs[run->glyph_count].glyph = glyph;
+        run->glyphs[run->glyph_count].x = x;
+        run->glyph_count++;
+        get_char_bounds(font, glyph, &x, &y, &minx, &miny, &maxx, &maxy, &run->props);
     }
-    int32_t minx = 100000, miny = 100000, maxx = -1, maxy = -1;
-    int32_t original_x = *x;
-    uint32_t c;
-    while ((c = next_cp((uint8_t **)&string)))
+    run->advance = x;
+    if (run->glyph_count == 0)
     {
-        get_char_bounds(font, c, x, y, &minx, &miny, &maxx, &maxy, &props);
+        run->x1 = 0;
+        run->y1 = 0;
+        run->w = 0;
+        run->h = 0;
     }
-    *x1 = min(original_x, minx);
-    *w = maxx - *x1;
-    *y1 = miny;
-    *h = maxy - miny;
+    else
+    {
+        run->x1 = min(0, minx);
+        run->w = maxx - run->x1;
+        run->y1 = miny;
+        run->h = maxy - miny;
+    }
+    return i == count && string == end;
 }
 
-void write_mode(const GFXfont *font,
-                const char *string,
-                int32_t *cursor_x,
-                int32_t *cursor_y,
-                uint8_t *framebuffer,
-                DrawMode_t mode,
-                const FontProperties *properties)
+
+void text_run_get_bounds(const TextRun *run,
+                         int32_t *x,
+                         int32_t *y,
+                         int32_t *x1,
+                         int32_t *y1,
+                         int32_t *w,
+                         int32_t *h)
 {
-    if (*string == '\0') return ;
+    *x1 = *x + run->x1;
+    *y1 = *y + run->y1;
+    *w = run->w;
+    *h = run->h;
+    *x += run->advance;
+}
 
-    FontProperties props = (properties == NULL) ? font_properties_default() \
-                                                : *properties;
 
-    int32_t x1 = 0, y1 = 0, w = 0, h = 0;
-    int32_t tmp_cur_x = *cursor_x;
-    int32_t tmp_cur_y = *cursor_y;
-    get_text_bounds(font, string, &tmp_cur_x, &tmp_cur_y, &x1, &y1, &w, &h, &props);
+void text_run_write(const TextRun *run,
+                    int32_t *cursor_x,
+                    int32_t *cursor_y,
+                    uint8_t *framebuffer,
+                    DrawMode_t mode)
+{
+    if (run->glyph_count == 0) return ;
 
-    uint8_t *buffer;
-    int32_t buf_width;
-    int32_t buf_height;
-    int32_t baseline_height = *cursor_y - y1;
+    write_glyphs(run->font, NULL, NULL, run, *cursor_x + run->x1, *cursor_y + run->y1, run->w, run->h,
+                 cursor_x, cursor_y, framebuffer, mode, &run->props);
+}
 
-    // The local cursor position:
-    // 0, if drawing to a local temporary buffer
-    // the given cursor position, if drawing to a full frame buffer
-    int32_t local_cursor_x = 0;
-    int32_t local_cursor_y = 0;
 
-    if (framebuffer == NULL)
-    {
-        buf_width = (w / 2 + w % 2);
-        buf_height = h;
-        buffer = (uint8_t *)malloc(buf_width * buf_height);
-        memset(buffer, 255, buf_width * buf_height);
-        local_cursor_y = buf_height - baseline_height;
-    }
-    else
+bool text_raster_init(TextRaster *raster, const TextRun *run, int32_t x, int32_t y)
+{
+    memset(raster, 0, sizeof(TextRaster));
+    raster->run = run;
+    raster->x = x;
+    raster->y = y;
+    build_color_lut(&run->props, &raster->color_lut);
+    if (epd_is_rotated())
     {
-        buf_width = EPD_WIDTH / 2;
-        buf_height = EPD_HEIGHT;
-        buffer = framebuffer;
-        local_cursor_x = *cursor_x;
-        local_cursor_y = *cursor_y;
+        return false;
     }
 
-    uint32_t c;
-
-    int32_t cursor_x_init = local_cursor_x;
-    int32_t cursor_y_init = local_cursor_y;
-
-    uint8_t bg = props.bg_color;
-    if (props.flags & DRAW_BACKGROUND)
+    // compressed glyphs are decoded once into one block, rows are then read
+    // in place however often they are fetched
+    size_t size = 0;
+    int32_t y0 = EPD_HEIGHT;
+    int32_t y1 = 0;
+    for (uint32_t i = 0; i < run->glyph_count; i++)
     {
-        for (int32_t l = 0; l < font->advance_y; l++)
+        const GFXglyph *glyph = run->glyphs[i].glyph;
+        if (needs_decode(run->glyphs[i].font))
         {
-            epd_draw_hline(local_cursor_x,
-                           local_cursor_y - (font->advance_y - baseline_height) + l,
-                           w,
-                           bg << 4,
-                           buffer);
+            size += (glyph->width / 2 + glyph->width % 2) * glyph->height;
+        }
+        if (glyph->width && glyph->height)
+        {
+            y0 = min(y0, y - glyph->top);
+            y1 = max(y1, y - glyph->top + glyph->height);
         }
     }
-    while ((c = next_cp((uint8_t **)&string)))
+    y0 = max(0, y0);
+    y1 = min(EPD_HEIGHT, y1);
+    raster->area = (Rect_t){.x = 0, .y = y0, .width = EPD_WIDTH, .height = max(0, y1 - y0)};
+
+    if (size)
     {
-        draw_char(font, buffer, &local_cursor_x, local_cursor_y, buf_width, buf_height, c, &props);
+        raster->data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        if (!raster->data)
+        {
+            raster->data = (uint8_t *)malloc(size);
+        }
+        if (!raster->data)
+        {
+            ESP_LOGE("font.c", "cannot allocate text raster!");
+            return false;
+        }
     }
 
-    *cursor_x += local_cursor_x - cursor_x_init;
-    *cursor_y += local_cursor_y - cursor_y_init;
+    size_t offset = 0;
+    for (uint32_t i = 0; i < run->glyph_count; i++)
+    {
+        const GFXfont *font = run->glyphs[i].font;
+        const GFXglyph *glyph = run->glyphs[i].glyph;
+        if (!needs_decode(font))
+        {
+            raster->bitmaps[i] = &font->bitmap[glyph->data_offset];
+            continue;
+        }
+        uint8_t *bitmap = &raster->data[offset];
+        uint32_t bitmap_size = (glyph->width / 2 + glyph->width % 2) * glyph->height;
+        uint8_t *cached = glyph_cache_lookup(font, glyph);
+        offset += bitmap_size;
+        if (cached)
+        {
+            memcpy(bitmap, cached, bitmap_size);
+        }
+        else if (!decode_glyph(font, glyph, bitmap))
+        {
+            text_raster_release(raster);
+            return false;
+        }
+        raster->bitmaps[i] = bitmap;
+    }
+    return true;
+}
 
-    if (framebuffer == NULL)
+
+void IRAM_ATTR text_raster_fetch_row(const void *source, int32_t y, uint8_t *row)
+{
+    const TextRaster *raster = (const TextRaster *)source;
+    const TextRun *run = raster->run;
+    memset(row, raster->color_lut.color[0] * 0x11, EPD_WIDTH / 2);
+
+    for (uint32_t i = 0; i < run->glyph_count; i++)
     {
-        Rect_t area = {
-            .x = x1,
-            .y = *cursor_y - h + baseline_height,
-            .width = w,
-            .height = h
-        };
-        epd_draw_image(area, buffer, mode);
-        free(buffer);
+        const GFXglyph *glyph = run->glyphs[i].glyph;
+        int32_t glyph_y = y - (raster->y - glyph->top);
+        if (glyph_y < 0 || glyph_y >= glyph->height)
+        {
+            continue;
+        }
+
+        int32_t byte_width = glyph->width / 2 + glyph->width % 2;
+        const uint8_t *src = &raster->bitmaps[i][glyph_y * byte_width];
+        int32_t start_pos = raster->x + run->glyphs[i].x + glyph->left;
+        int32_t x0 = max(0, -start_pos);
+        int32_t x1 = min(glyph->width, EPD_WIDTH - start_pos);
+        if (clip_to_ink(run->glyphs[i].font, glyph, glyph_y, src, &x0, &x1))
+        {
+            blend_span(row, start_pos + x0, src, x0, x1 - x0, &raster->color_lut);
+        }
+    }
+}
+
+
+void text_raster_release(TextRaster *raster)
+{
+    heap_caps_free(raster->data);
+    memset(raster, 0, sizeof(TextRaster));
+}
+
+
+void write_mode(const GFXfont *font,
+                const char *string,
+                int32_t *cursor_x,
+                int32_t *cursor_y,
+                uint8_t *framebuffer,
+                DrawMode_t mode,
+                const FontProperties *properties)
+{
+    write_text(font, string, string + strlen(string), cursor_x, cursor_y, framebuffer, mode,
+               properties);
+}
+
+
+void write_1bpp(const GFXfont *font,
+                const char *string,
+                int32_t *cursor_x,
+                int32_t *cursor_y,
+                uint8_t *framebuffer,
+                const FontProperties *properties)
+{
+    if (*string == '\0') return ;
+
+    FontProperties props = (properties == NULL) ? font_properties_default() \
+                                                : *properties;
+
+    if (props.flags & DRAW_BACKGROUND)
+    {
+        int32_t x1 = 0, y1 = 0, w = 0, h = 0;
+        int32_t tmp_cur_x = *cursor_x;
+        int32_t tmp_cur_y = *cursor_y;
+        get_text_bounds(font, string, &tmp_cur_x, &tmp_cur_y, &x1, &y1, &w, &h, &props);
+        int32_t baseline_height = *cursor_y - y1;
+        epd_fill_rect_1bpp(*cursor_x,
+                           *cursor_y - (font->advance_y - baseline_height),
+                           w,
+                           font->advance_y,
+                           props.bg_color << 4,
+                           framebuffer);
+    }
+
+    ColorLut color_lut;
+    build_color_lut(&props, &color_lut);
+
+    uint32_t c;
+    while ((c = utf8_next(&string)))
+    {
+        draw_char_1bpp(font, framebuffer, cursor_x, *cursor_y, c, &props, &color_lut);
+    }
+}
+
+
+void write_to_buffer(const GFXfont *font,
+                     const char *string,
+                     int32_t *cursor_x,
+                     int32_t cursor_y,
+                     uint8_t *buffer,
+                     int32_t buf_width,
+                     int32_t buf_height,
+                     const FontProperties *properties)
+{
+    FontProperties props = (properties == NULL) ? font_properties_default() \
+                                                : *properties;
+
+    ColorLut color_lut;
+    build_color_lut(&props, &color_lut);
+
+    uint32_t c;
+    while ((c = utf8_next(&string)))
+    {
+        draw_char(font, buffer, cursor_x, cursor_y, (buf_width + 1) / 2, buf_height,
+                  find_glyph(font, c, &props), &color_lut, false, NULL);
     }
 }
 
@@ -265,71 +814,254 @@ void write_string(const GFXfont *font,
                   int32_t *cursor_y,
                   uint8_t *framebuffer)
 {
-    char *token, *newstring, *tofree;
     if (string == NULL)
     {
         ESP_LOGE("font.c", "cannot draw a NULL string!");
         return;
     }
-    tofree = newstring = strdup(string);
-    if (newstring == NULL)
-    {
-        ESP_LOGE("font.c", "cannot allocate string copy!");
-        return;
-    }
 
-    // taken from the strsep manpage
+    // lines are drawn in place, without a copy of the string to split
     int32_t line_start = *cursor_x;
-    while ((token = strsep(&newstring, "\n")) != NULL)
+    const char *line = string;
+    while (line)
     {
+        const char *end = strchr(line, '\n');
         *cursor_x = line_start;
-        writeln(font, token, cursor_x, cursor_y, framebuffer);
+        write_text(font, line, end ? end : line + strlen(line), cursor_x, cursor_y,
+                   framebuffer, BLACK_ON_WHITE, NULL);
         *cursor_y += font->advance_y;
+        line = end ? end + 1 : NULL;
     }
+}
 
-    free(tofree);
+
+void text_layout_write(const TextLayout *layout, int32_t x, int32_t y,
+                       uint8_t *framebuffer, uint8_t *scratch, size_t scratch_size)
+{
+    if (framebuffer == NULL)
+    {
+        ESP_LOGE("font.c", "cannot write a layout without a framebuffer!");
+        return;
+    }
+
+    ColorLut color_lut;
+    build_color_lut(&layout->props, &color_lut);
+    GlyphScratch glyph_scratch = { .data = scratch, .size = scratch_size };
+    bool rotated = epd_is_rotated();
+
+    // fonts with a preset dictionary inflate through a sliding window, it is
+    // taken from the end of the scratch; without room for it, only cached
+    // glyphs are drawn
+    const GFXfont *font = layout->font;
+    bool window = font->compressed && font->format == GLYPH_FORMAT_RAW_DEFLATE &&
+                  font->dictionary;
+    if (window)
+    {
+        glyph_scratch.size = scratch_size >= TEXT_LAYOUT_WINDOW_SIZE
+                             ? scratch_size - TEXT_LAYOUT_WINDOW_SIZE : 0;
+        window = glyph_scratch.size > 0;
+    }
+    if (window)
+    {
+        use_inflate_window(&scratch[glyph_scratch.size]);
+    }
+
+    for (uint32_t i = 0; i < layout->line_count; i++)
+    {
+        const TextLine *line = &layout->lines[i];
+        int32_t cursor_x = x + line->x;
+        int32_t cursor_y = y + line->y;
+        write_span(layout->font, line->start, line->start + line->length, &cursor_x, cursor_y,
+                   framebuffer, &layout->props, &color_lut, rotated, &glyph_scratch);
+        if (line->ellipsis)
+        {
+            write_span(layout->font, layout->ellipsis, layout->ellipsis + strlen(layout->ellipsis),
+                       &cursor_x, cursor_y, framebuffer, &layout->props, &color_lut, rotated,
+                       &glyph_scratch);
+        }
+    }
+
+    // the scratch belongs to the caller, the stream must not keep using it
+    if (window)
+    {
+        use_inflate_window(NULL);
+    }
 }
 
 /******************************************************************************/
 /***        local functions                                                 ***/
 /******************************************************************************/
 
-static int32_t utf8_len(const uint8_t ch)
+static void measure_text(const GFXfont *font,
+                         const char *string,
+                         const char *end,
+                         int32_t *x,
+                         int32_t *y,
+                         int32_t *x1,
+                         int32_t *y1,
+                         int32_t *w,
+                         int32_t *h,
+                         const FontProperties *props)
 {
-    int32_t len = 0;
-    for (utf_t **u = utf; *u; ++u)
+    if (string == end)
     {
-        if ((ch & ~(*u)->mask) == (*u)->lead)
-        {
-            break;
-        }
-        ++len;
+        *w = 0;
+        *h = 0;
+        *y1 = *y;
+        *x1 = *x;
+        return;
     }
-    if (len > 4)
-    { /* Malformed leading byte */
-        assert("invalid unicode.");
+    int32_t minx = 100000, miny = 100000, maxx = -1, maxy = -1;
+    int32_t original_x = *x;
+    while (string < end)
+    {
+        uint32_t c = utf8_next(&string);
+        get_char_bounds(font, find_glyph(font, c, props), x, y, &minx, &miny, &maxx, &maxy,
+                        props);
     }
-    return len;
+    *x1 = min(original_x, minx);
+    *w = maxx - *x1;
+    *y1 = miny;
+    *h = maxy - miny;
 }
 
 
-static uint32_t next_cp(uint8_t **string)
+static void write_text(const GFXfont *font,
+                       const char *string,
+                       const char *end,
+                       int32_t *cursor_x,
+                       int32_t *cursor_y,
+                       uint8_t *framebuffer,
+                       DrawMode_t mode,
+                       const FontProperties *properties)
 {
-    if (**string == 0) return 0;
+    if (string == end) return ;
 
-    int32_t bytes = utf8_len(**string);
-    uint8_t *chr = *string;
-    *string += bytes;
-    int32_t shift = utf[0]->bits_stored * (bytes - 1);
-    uint32_t codep = (*chr++ & utf[bytes]->mask) << shift;
+    FontProperties props = (properties == NULL) ? font_properties_default() \
+                                                : *properties;
 
-    for (int32_t i = 1; i < bytes; ++i, ++chr)
+    int32_t x1 = 0, y1 = 0, w = 0, h = 0;
+    int32_t tmp_cur_x = *cursor_x;
+    int32_t tmp_cur_y = *cursor_y;
+    measure_text(font, string, end, &tmp_cur_x, &tmp_cur_y, &x1, &y1, &w, &h, &props);
+    write_glyphs(font, string, end, NULL, x1, y1, w, h, cursor_x, cursor_y, framebuffer, mode,
+                 &props);
+}
+
+
+static void write_span(const GFXfont *font,
+                       const char *string,
+                       const char *end,
+                       int32_t *cursor_x,
+                       int32_t cursor_y,
+                       uint8_t *framebuffer,
+                       const FontProperties *props,
+                       const ColorLut *color_lut,
+                       bool rotated,
+                       const GlyphScratch *scratch)
+{
+    while (string < end)
     {
-        shift -= utf[0]->bits_stored;
-        codep |= ((uint8_t)*chr & utf[0]->mask) << shift;
+        uint32_t c = utf8_next(&string);
+        draw_char(font, framebuffer, cursor_x, cursor_y, EPD_WIDTH / 2, EPD_HEIGHT,
+                  find_glyph(font, c, props), color_lut, rotated, scratch);
     }
+}
+
+
+static void write_glyphs(const GFXfont *font,
+                         const char *string,
+                         const char *end,
+                         const TextRun *run,
+                         int32_t x1,
+                         int32_t y1,
+                         int32_t w,
+                         int32_t h,
+                         int32_t *cursor_x,
+                         int32_t *cursor_y,
+                         uint8_t *framebuffer,
+                         DrawMode_t mode,
+                         const FontProperties *props)
+{
+    uint8_t *buffer;
+    int32_t buf_width;
+    int32_t buf_height;
+    int32_t baseline_height = *cursor_y - y1;
+
+    // The local cursor position:
+    // 0, if drawing to a local temporary buffer
+    // the given cursor position, if drawing to a full frame buffer
+    int32_t local_cursor_x = 0;
+    int32_t local_cursor_y = 0;
 
-    return codep;
+    if (framebuffer == NULL)
+    {
+        buf_width = (w / 2 + w % 2);
+        buf_height = h;
+        buffer = (uint8_t *)malloc(buf_width * buf_height);
+        memset(buffer, 255, buf_width * buf_height);
+        local_cursor_y = buf_height - baseline_height;
+    }
+    else
+    {
+        buf_width = EPD_WIDTH / 2;
+        buf_height = EPD_HEIGHT;
+        buffer = framebuffer;
+        local_cursor_x = *cursor_x;
+        local_cursor_y = *cursor_y;
+    }
+
+    int32_t cursor_x_init = local_cursor_x;
+    int32_t cursor_y_init = local_cursor_y;
+
+    ColorLut color_lut;
+    build_color_lut(props, &color_lut);
+
+    uint8_t bg = props->bg_color;
+    if (props->flags & DRAW_BACKGROUND)
+    {
+        for (int32_t l = 0; l < font->advance_y; l++)
+        {
+            epd_draw_hline(local_cursor_x,
+                           local_cursor_y - (font->advance_y - baseline_height) + l,
+                           w,
+                           bg << 4,
+                           buffer);
+        }
+    }
+    bool rotated = framebuffer != NULL && epd_is_rotated();
+    if (run)
+    {
+        for (uint32_t i = 0; i < run->glyph_count; i++)
+        {
+            draw_char(run->glyphs[i].font, buffer, &local_cursor_x, local_cursor_y, buf_width,
+                      buf_height, run->glyphs[i].glyph, &color_lut, rotated, NULL);
+        }
+    }
+    else
+    {
+        while (string < end)
+        {
+            uint32_t c = utf8_next(&string);
+            draw_char(font, buffer, &local_cursor_x, local_cursor_y, buf_width, buf_height,
+                      find_glyph(font, c, props), &color_lut, rotated, NULL);
+        }
+    }
+
+    *cursor_x += local_cursor_x - cursor_x_init;
+    *cursor_y += local_cursor_y - cursor_y_init;
+
+    if (framebuffer == NULL)
+    {
+        Rect_t area = {
+            .x = x1,
+            .y = *cursor_y - h + baseline_height,
+            .width = w,
+            .height = h
+        };
+        epd_draw_image(area, buffer, mode);
+        free(buffer);
+    }
 }
 
 
@@ -345,14 +1077,7 @@ static FontProperties font_properties_default()
 }
 
 
-static void IRAM_ATTR draw_char(const GFXfont *font,
-                                uint8_t *buffer,
-                                int32_t *cursor_x,
-                                int32_t cursor_y,
-                                uint16_t buf_width,
-                                uint16_t buf_height,
-                                uint32_t cp,
-                                const FontProperties *props)
+static GFXglyph *find_glyph(const GFXfont *font, uint32_t cp, const FontProperties *props)
 {
     GFXglyph *glyph;
     get_glyph(font, cp, &glyph);
@@ -361,84 +1086,697 @@ static void IRAM_ATTR draw_char(const GFXfont *font,
     {
         get_glyph(font, props->fallback_glyph, &glyph);
     }
+    return glyph;
+}
+
 
+static void IRAM_ATTR draw_char(const GFXfont *font,
+                                uint8_t *buffer,
+                                int32_t *cursor_x,
+                                int32_t cursor_y,
+                                uint16_t buf_width,
+                                uint16_t buf_height,
+                                const GFXglyph *glyph,
+                                const ColorLut *color_lut,
+                                bool rotated,
+                                const GlyphScratch *scratch)
+{
     if (!glyph)
     {
         return;
     }
 
-    uint32_t offset = glyph->data_offset;
     uint8_t width = glyph->width;
     uint8_t height = glyph->height;
     int32_t left = glyph->left;
 
+    if (!rotated && font->compressed && font->format == GLYPH_FORMAT_RLE)
+    {
+        draw_rle_glyph(font, glyph, *cursor_x + left, cursor_y - glyph->top, buffer,
+                       buf_width, buf_height, color_lut->color);
+        *cursor_x += glyph->advance_x;
+        return;
+    }
+
     int32_t byte_width = (width / 2 + width % 2);
-    unsigned long bitmap_size = byte_width * height;
     uint8_t *bitmap = NULL;
-    if (font->compressed)
+    if (!rotated && !scratch && font->compressed && font->format == GLYPH_FORMAT_RAW_DEFLATE &&
+        !font->dictionary && bit_depth(font) == 4)
     {
-        bitmap = (uint8_t *)malloc(bitmap_size);
-        uncompress(bitmap, &bitmap_size, &font->bitmap[offset], glyph->compressed_size);
+        // Glyphs missing from the cache are inflated directly into the canvas
+        // the first time, a glyph drawn again is decoded into the cache. Only
+        // 4bpp raw deflate fonts without a dictionary take this path, e.g.
+        // Quicksand_140 and Roboto_150: inflateBack cannot start from a
+        // preset dictionary. Layouts written with a scratch decode into it
+        // instead, as the canvas window would come from the heap.
+        bitmap = glyph_cache_lookup(font, glyph);
+        CanvasSink sink = {
+            .buffer = buffer,
+            .buf_width = buf_width,
+            .buf_height = buf_height,
+            .x0 = *cursor_x + left,
+            .y0 = cursor_y - glyph->top,
+            .width = width,
+            .height = height,
+            .byte_width = byte_width,
+            .offset = 0,
+            .color_lut = color_lut,
+            .row_spans = font->row_spans ? &font->bitmap[glyph->data_offset - 2 * height]
+                                         : NULL
+        };
+        if (!bitmap && !drawn_to_canvas(glyph) && inflate_glyph_to_canvas(font, glyph, &sink))
+        {
+            *cursor_x += glyph->advance_x;
+            return;
+        }
     }
-    else
+    if (!bitmap)
+    {
+        bitmap = scratch ? get_scratch_glyph_bitmap(font, glyph, scratch)
+                         : get_glyph_bitmap(font, glyph);
+    }
+    if (!bitmap)
     {
-        bitmap = &font->bitmap[offset];
+        return;
     }
 
-    uint8_t color_lut[16];
-    for (int32_t c = 0; c < 16; c++)
+    if (rotated)
     {
-        int32_t color_difference = (int32_t)props->fg_color - (int32_t)props->bg_color;
-        color_lut[c] = max(0, min(15, props->bg_color + c * color_difference / 15));
+        // rows and columns without ink are skipped like on the unrotated path
+        for (int32_t y = 0; y < height; y++)
+        {
+            uint8_t *src = &bitmap[y * byte_width];
+            int32_t span_x0 = 0;
+            int32_t span_x1 = width;
+            if (!clip_to_ink(font, glyph, y, src, &span_x0, &span_x1))
+            {
+                continue;
+            }
+            for (int32_t x = span_x0; x < span_x1; x++)
+            {
+                uint8_t bm = (x & 1) ? src[x / 2] >> 4 : src[x / 2] & 0xF;
+                epd_draw_pixel(*cursor_x + left + x, cursor_y - glyph->top + y,
+                               color_lut->color[bm] << 4, buffer);
+            }
+        }
+        if (!scratch)
+        {
+            release_glyph_bitmap(font, bitmap);
+        }
+        *cursor_x += glyph->advance_x;
+        return;
     }
 
-    for (int32_t y = 0; y < height; y++)
+    int32_t start_pos = *cursor_x + left;
+    int32_t x0 = max(0, -start_pos);
+    int32_t x1 = min(width, buf_width * 2 - start_pos);
+    for (int32_t y = 0; y < height && x0 < x1; y++)
     {
         int32_t yy = cursor_y - glyph->top + y;
-        if (yy < 0 || yy >= buf_height)
+        const uint8_t *src = &bitmap[y * byte_width];
+        int32_t span_x0 = x0;
+        int32_t span_x1 = x1;
+        if (yy < 0 || yy >= buf_height ||
+            !clip_to_ink(font, glyph, y, src, &span_x0, &span_x1))
         {
             continue;
         }
-        int32_t start_pos = *cursor_x + left;
-        bool byte_complete = start_pos % 2;
-        int32_t x = max(0, -start_pos);
-        int32_t max_x = min(start_pos + width, buf_width * 2);
-        for (int32_t xx = start_pos; xx < max_x; xx++)
+        blend_span(&buffer[yy * buf_width], start_pos + span_x0, src, span_x0,
+                   span_x1 - span_x0, color_lut);
+    }
+    if (!scratch)
+    {
+        release_glyph_bitmap(font, bitmap);
+    }
+    *cursor_x += glyph->advance_x;
+}
+
+
+static void IRAM_ATTR draw_char_1bpp(const GFXfont *font,
+                                     uint8_t *framebuffer,
+                                     int32_t *cursor_x,
+                                     int32_t cursor_y,
+                                     uint32_t cp,
+                                     const FontProperties *props,
+                                     const ColorLut *color_lut)
+{
+    GFXglyph *glyph = find_glyph(font, cp, props);
+    if (!glyph)
+    {
+        return;
+    }
+
+    int32_t byte_width = (glyph->width / 2 + glyph->width % 2);
+    uint8_t *bitmap = get_glyph_bitmap(font, glyph);
+    if (!bitmap)
+    {
+        return;
+    }
+
+    bool rotated = epd_is_rotated();
+    int32_t start_pos = *cursor_x + glyph->left;
+    for (int32_t y = 0; y < glyph->height; y++)
+    {
+        int32_t yy = cursor_y - glyph->top + y;
+        if (!rotated && (yy < 0 || yy >= EPD_HEIGHT))
+        {
+            continue;
+        }
+        uint8_t *row = &framebuffer[yy * EPD_WIDTH / 8];
+        uint8_t *src = &bitmap[y * byte_width];
+        for (int32_t x = 0; x < glyph->width; x++)
         {
-            uint32_t buf_pos = yy * buf_width + xx / 2;
-            uint8_t old = buffer[buf_pos];
-            uint8_t bm = bitmap[y * byte_width + x / 2];
-            if ((x & 1) == 0)
+            int32_t xx = start_pos + x;
+            uint8_t bm = (x & 1) ? src[x / 2] >> 4 : src[x / 2] & 0xF;
+            if (rotated)
+            {
+                epd_draw_pixel_1bpp(xx, yy, color_lut->color[bm] << 4, framebuffer);
+                continue;
+            }
+            if (xx < 0 || xx >= EPD_WIDTH)
             {
-                bm = bm & 0xF;
+                continue;
+            }
+            if (color_lut->color[bm] < 8)
+            {
+                row[xx / 8] |= 1 << (xx % 8);
             }
             else
             {
-                bm = bm >> 4;
+                row[xx / 8] &= ~(1 << (xx % 8));
             }
+        }
+    }
+    release_glyph_bitmap(font, bitmap);
+    *cursor_x += glyph->advance_x;
+}
+
+
+static uint8_t *get_glyph_bitmap(const GFXfont *font, const GFXglyph *glyph)
+{
+    if (!needs_decode(font))
+    {
+        return &font->bitmap[glyph->data_offset];
+    }
+
+    uint8_t *bitmap = glyph_cache_lookup(font, glyph);
+    if (bitmap)
+    {
+        return bitmap;
+    }
 
-            if ((xx & 1) == 0)
+    unsigned long bitmap_size = (glyph->width / 2 + glyph->width % 2) * glyph->height;
+    bool cached = true;
+    bitmap = glyph_cache_insert(font, glyph, bitmap_size);
+    if (bitmap == NULL)
+    {
+        // too large for the cache budget, decompress for this use only
+        cached = false;
+        bitmap = (uint8_t *)malloc(bitmap_size);
+    }
+    if (bitmap == NULL)
+    {
+        ESP_LOGE("font.c", "cannot allocate glyph bitmap!");
+        return NULL;
+    }
+    if (!decode_glyph(font, glyph, bitmap))
+    {
+        if (cached)
+        {
+            glyph_cache_remove(font, glyph);
+        }
+        else
+        {
+            free(bitmap);
+        }
+        return NULL;
+    }
+    return bitmap;
+}
+
+
+static bool decode_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap)
+{
+    uint32_t depth = bit_depth(font);
+    if (!font->compressed)
+    {
+        expand_glyph(font, glyph, &font->bitmap[glyph->data_offset], bitmap);
+    }
+    else if (font->format == GLYPH_FORMAT_RLE)
+    {
+        decode_rle_glyph(font, glyph, bitmap);
+    }
+    else if (font->format == GLYPH_FORMAT_SDF)
+    {
+        sdf_render_glyph(font, glyph, bitmap);
+    }
+    else
+    {
+        // low bit depth glyphs are inflated to the start of the bitmap and
+        // expanded in place
+        uint32_t size = (glyph->width * depth + 7) / 8 * glyph->height;
+        if (!inflate_glyph(font, glyph, bitmap, size))
+        {
+            ESP_LOGE("font.c", "cannot decompress glyph bitmap!");
+            return false;
+        }
+        if (depth != 4)
+        {
+            expand_glyph(font, glyph, bitmap, bitmap);
+        }
+    }
+    return true;
+}
+
+
+static void expand_glyph(const GFXfont *font, const GFXglyph *glyph, const uint8_t *src,
+                         uint8_t *bitmap)
+{
+    if (!expand_lut_ready)
+    {
+        for (uint32_t byte = 0; byte < 256; byte++)
+        {
+            uint32_t pixels_1bpp = 0;
+            uint32_t pixels_2bpp = 0;
+            for (uint32_t i = 0; i < 8; i++)
             {
-                buffer[buf_pos] = (old & 0xF0) | color_lut[bm];
+                pixels_1bpp |= ((byte >> i) & 1) * 15 << (4 * i);
             }
-            else
+            for (uint32_t i = 0; i < 4; i++)
             {
-                buffer[buf_pos] = (old & 0x0F) | (color_lut[bm] << 4);
+                pixels_2bpp |= ((byte >> (2 * i)) & 3) * 5 << (4 * i);
             }
-            byte_complete = !byte_complete;
-            x++;
+            expand_lut_1bpp[byte] = pixels_1bpp;
+            expand_lut_2bpp[byte] = pixels_2bpp;
         }
+        expand_lut_ready = true;
     }
-    if (font->compressed)
+
+    uint32_t depth = bit_depth(font);
+    int32_t ratio = 4 / depth;
+    int32_t packed_width = (glyph->width * depth + 7) / 8;
+    int32_t byte_width = glyph->width / 2 + glyph->width % 2;
+
+    // from the end, so expanding in place never overwrites unread bytes
+    for (int32_t y = glyph->height - 1; y >= 0; y--)
+    {
+        const uint8_t *packed = &src[y * packed_width];
+        uint8_t *row = &bitmap[y * byte_width];
+        for (int32_t x = packed_width - 1; x >= 0; x--)
+        {
+            uint32_t pixels = depth == 1 ? expand_lut_1bpp[packed[x]]
+                                         : expand_lut_2bpp[packed[x]];
+            for (int32_t i = min(ratio, byte_width - x * ratio) - 1; i >= 0; i--)
+            {
+                row[x * ratio + i] = pixels >> (8 * i);
+            }
+        }
+    }
+}
+
+
+static void release_glyph_bitmap(const GFXfont *font, uint8_t *bitmap)
+{
+    if (needs_decode(font) && bitmap && !glyph_cache_owns(bitmap))
     {
         free(bitmap);
     }
-    *cursor_x += glyph->advance_x;
+}
+
+
+static uint8_t *get_scratch_glyph_bitmap(const GFXfont *font, const GFXglyph *glyph,
+                                         const GlyphScratch *scratch)
+{
+    if (!needs_decode(font))
+    {
+        return &font->bitmap[glyph->data_offset];
+    }
+
+    uint8_t *bitmap = glyph_cache_lookup(font, glyph);
+    if (bitmap)
+    {
+        return bitmap;
+    }
+    size_t bitmap_size = (glyph->width / 2 + glyph->width % 2) * glyph->height;
+    if (bitmap_size > scratch->size)
+    {
+        ESP_LOGE("font.c", "glyph of %u bytes does not fit the scratch!", (unsigned)bitmap_size);
+        return NULL;
+    }
+    return decode_glyph(font, glyph, scratch->data) ? scratch->data : NULL;
+}
+
+
+static bool inflate_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap,
+                          uint32_t size)
+{
+    // raw deflate data has no header to parse and no checksum to verify
+    bool raw = font->format == GLYPH_FORMAT_RAW_DEFLATE;
+    int32_t window_bits = raw ? -MAX_WBITS : MAX_WBITS;
+    if (!inflate_ready)
+    {
+        inflate_stream.zalloc = arena_alloc;
+        inflate_stream.zfree = arena_free;
+        inflate_stream.opaque = &inflate_arena;
+        inflate_stream.next_in = Z_NULL;
+        inflate_stream.avail_in = 0;
+        if (inflateInit2(&inflate_stream, window_bits) != Z_OK)
+        {
+            return false;
+        }
+        inflate_ready = true;
+    }
+    else if (inflateReset2(&inflate_stream, window_bits) != Z_OK)
+    {
+        return false;
+    }
+
+    // all glyphs of a font are compressed against the same preset dictionary
+    if (raw && font->dictionary &&
+        inflateSetDictionary(&inflate_stream, font->dictionary, font->dictionary_size) != Z_OK)
+    {
+        return false;
+    }
+
+    inflate_stream.next_in = &font->bitmap[glyph->data_offset];
+    inflate_stream.avail_in = glyph->compressed_size;
+    inflate_stream.next_out = bitmap;
+    inflate_stream.avail_out = size;
+    // glyphs taller than 255 rows only fill their truncated bitmap
+    int32_t ret = inflate(&inflate_stream, Z_FINISH);
+    if (ret != Z_STREAM_END)
+    {
+        // an unfinished stream keeps a window allocated from the heap,
+        // ending it gives that back
+        inflateEnd(&inflate_stream);
+        inflate_ready = false;
+    }
+    return (ret == Z_STREAM_END || ret == Z_BUF_ERROR) && inflate_stream.avail_out == 0;
+}
+
+
+static bool inflate_glyph_to_canvas(const GFXfont *font, const GFXglyph *glyph,
+                                    CanvasSink *sink)
+{
+    if (!canvas_window)
+    {
+        canvas_window = (uint8_t *)heap_caps_malloc(CANVAS_WINDOW_SIZE, MALLOC_CAP_SPIRAM);
+        if (!canvas_window)
+        {
+            return false;
+        }
+        canvas_stream.zalloc = arena_alloc;
+        canvas_stream.zfree = arena_free;
+        canvas_stream.opaque = &canvas_arena;
+        if (inflateBackInit(&canvas_stream, MAX_WBITS, canvas_window) != Z_OK)
+        {
+            heap_caps_free(canvas_window);
+            canvas_window = NULL;
+            return false;
+        }
+    }
+
+    canvas_stream.next_in = &font->bitmap[glyph->data_offset];
+    canvas_stream.avail_in = glyph->compressed_size;
+    return inflateBack(&canvas_stream, canvas_in, NULL, canvas_out, sink) == Z_STREAM_END;
+}
+
+
+static bool drawn_to_canvas(const GFXglyph *glyph)
+{
+    for (int32_t i = 0; i < CANVAS_GLYPH_HISTORY; i++)
+    {
+        if (canvas_glyphs[i] == glyph)
+        {
+            return true;
+        }
+    }
+    canvas_glyphs[canvas_glyph_next] = glyph;
+    canvas_glyph_next = (canvas_glyph_next + 1) % CANVAS_GLYPH_HISTORY;
+    return false;
+}
+
+
+static unsigned canvas_in(void *desc, z_const unsigned char **buf)
+{
+    return 0;
+}
+
+
+static int IRAM_ATTR canvas_out(void *desc, unsigned char *buf, unsigned len)
+{
+    CanvasSink *sink = (CanvasSink *)desc;
+    int32_t max_x = sink->buf_width * 2;
+    while (len)
+    {
+        int32_t y = sink->offset / sink->byte_width;
+        int32_t col = sink->offset % sink->byte_width;
+        int32_t count = min(len, sink->byte_width - col);
+        int32_t yy = sink->y0 + y;
+        if (y >= sink->height)
+        {
+            // glyphs taller than 255 rows are cut off like their bitmaps
+            return 0;
+        }
+
+        if (yy >= 0 && yy < sink->buf_height && (sink->row_spans || !is_blank(buf, count)))
+        {
+            // pixels of this chunk, clipped to the buffer and the inked span
+            int32_t x0 = max(2 * col, -sink->x0);
+            int32_t x1 = min(min(2 * (col + count), sink->width), max_x - sink->x0);
+            if (sink->row_spans)
+            {
+                x0 = max(x0, sink->row_spans[2 * y]);
+                x1 = min(x1, sink->row_spans[2 * y + 1]);
+            }
+            if (x0 < x1)
+            {
+                blend_span(&sink->buffer[yy * sink->buf_width], sink->x0 + x0, buf,
+                           x0 - 2 * col, x1 - x0, sink->color_lut);
+            }
+        }
+        buf += count;
+        len -= count;
+        sink->offset += count;
+    }
+    return 0;
+}
+
+
+static void use_inflate_window(uint8_t *window)
+{
+    if (inflate_ready)
+    {
+        inflateEnd(&inflate_stream);
+        inflate_ready = false;
+    }
+    inflate_arena.window = window;
+}
+
+
+static voidpf arena_alloc(voidpf opaque, uInt items, uInt size)
+{
+    InflateArena *arena = (InflateArena *)opaque;
+    size_t bytes = ((size_t)items * size + 7) & ~(size_t)7;
+    if (arena->window && !arena->window_used && bytes == TEXT_LAYOUT_WINDOW_SIZE)
+    {
+        arena->window_used = true;
+        return arena->window;
+    }
+    if (arena->used + bytes <= INFLATE_ARENA_SIZE)
+    {
+        voidpf address = &arena->data[arena->used];
+        arena->used += bytes;
+        return address;
+    }
+    return malloc(bytes);
+}
+
+
+static void arena_free(voidpf opaque, voidpf address)
+{
+    InflateArena *arena = (InflateArena *)opaque;
+    uint8_t *p = (uint8_t *)address;
+    if (arena->window_used && p == arena->window)
+    {
+        arena->window_used = false;
+    }
+    else if (p >= arena->data && p < arena->data + INFLATE_ARENA_SIZE)
+    {
+        arena->used = p - arena->data;
+    }
+    else
+    {
+        free(address);
+    }
+}
+
+
+static inline const uint8_t *next_run(const uint8_t *data, uint8_t *level, int32_t *count)
+{
+    *level = *data >> 4;
+    *count = (*data & 0xF) + 1;
+    data++;
+    if (*count == 16)
+    {
+        *count += *data++;
+    }
+    return data;
+}
+
+
+static void decode_rle_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap)
+{
+    const uint8_t *data = &font->bitmap[glyph->data_offset];
+    int32_t byte_width = glyph->width / 2 + glyph->width % 2;
+    memset(bitmap, 0, byte_width * glyph->height);
+    for (int32_t y = 0; y < glyph->height; y++)
+    {
+        uint8_t *row = &bitmap[y * byte_width];
+        for (int32_t x = 0; x < glyph->width;)
+        {
+            uint8_t level;
+            int32_t count;
+            data = next_run(data, &level, &count);
+            if (level)
+            {
+                fill_nibbles(row, x, x + count, level);
+            }
+            x += count;
+        }
+    }
+}
+
+
+static void IRAM_ATTR draw_rle_glyph(const GFXfont *font, const GFXglyph *glyph,
+                                     int32_t x0, int32_t y0, uint8_t *buffer,
+                                     int32_t buf_width, int32_t buf_height,
+                                     const uint8_t *color_lut)
+{
+    const uint8_t *data = &font->bitmap[glyph->data_offset];
+    int32_t max_x = buf_width * 2;
+    for (int32_t y = 0; y < glyph->height; y++)
+    {
+        int32_t yy = y0 + y;
+        bool visible = yy >= 0 && yy < buf_height;
+        uint8_t *row = &buffer[yy * buf_width];
+        for (int32_t x = 0; x < glyph->width;)
+        {
+            uint8_t level;
+            int32_t count;
+            data = next_run(data, &level, &count);
+            if (level && visible)
+            {
+                fill_nibbles(row, max(x0 + x, 0), min(x0 + x + count, max_x),
+                             color_lut[level]);
+            }
+            x += count;
+        }
+    }
+}
+
+
+static inline void blend_span(uint8_t *row, int32_t dst_x, const uint8_t *src,
+                              int32_t src_x, int32_t count, const ColorLut *color_lut)
+{
+    if (dst_x & 1)
+    {
+        uint8_t bm = (src_x & 1) ? src[src_x / 2] >> 4 : src[src_x / 2] & 0xF;
+        row[dst_x / 2] = (row[dst_x / 2] & 0x0F) | (color_lut->color[bm] << 4);
+        dst_x++;
+        src_x++;
+        count--;
+    }
+
+    uint8_t *dst = &row[dst_x / 2];
+    const uint8_t *s = &src[src_x / 2];
+    int32_t pairs = count / 2;
+    if (src_x & 1)
+    {
+        for (int32_t i = 0; i < pairs; i++, s++)
+        {
+            *dst++ = color_lut->pair[(uint8_t)((s[0] >> 4) | (s[1] << 4))];
+        }
+    }
+    else
+    {
+        for (int32_t i = 0; i < pairs; i++)
+        {
+            *dst++ = color_lut->pair[*s++];
+        }
+    }
+
+    if (count & 1)
+    {
+        src_x += 2 * pairs;
+        uint8_t bm = (src_x & 1) ? src[src_x / 2] >> 4 : src[src_x / 2] & 0xF;
+        *dst = (*dst & 0xF0) | color_lut->color[bm];
+    }
+}
+
+
+static inline bool is_blank(const uint8_t *src, int32_t bytes)
+{
+    for (int32_t i = 0; i < bytes; i++)
+    {
+        if (src[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static inline bool clip_to_ink(const GFXfont *font, const GFXglyph *glyph, int32_t y,
+                               const uint8_t *src, int32_t *x0, int32_t *x1)
+{
+    if (!font->row_spans)
+    {
+        return *x0 < *x1 && !is_blank(src, glyph->width / 2 + glyph->width % 2);
+    }
+    const uint8_t *span = &font->bitmap[glyph->data_offset - 2 * (glyph->height - y)];
+    *x0 = max(*x0, span[0]);
+    *x1 = min(*x1, span[1]);
+    return *x0 < *x1;
+}
+
+
+static inline void fill_nibbles(uint8_t *row, int32_t x0, int32_t x1, uint8_t color)
+{
+    if (x0 % 2 && x0 < x1)
+    {
+        row[x0 / 2] = (row[x0 / 2] & 0x0F) | (color << 4);
+        x0++;
+    }
+    if (x1 % 2 && x0 < x1)
+    {
+        row[x1 / 2] = (row[x1 / 2] & 0xF0) | color;
+        x1--;
+    }
+    if (x0 < x1)
+    {
+        memset(&row[x0 / 2], color * 0x11, (x1 - x0) / 2);
+    }
+}
+
+
+static void build_color_lut(const FontProperties *props, ColorLut *color_lut)
+{
+    int32_t color_difference = (int32_t)props->fg_color - (int32_t)props->bg_color;
+    for (int32_t c = 0; c < 16; c++)
+    {
+        color_lut->color[c] = max(0, min(15, props->bg_color + c * color_difference / 15));
+    }
+    for (int32_t b = 0; b < 256; b++)
+    {
+        color_lut->pair[b] = color_lut->color[b & 0xF] | (color_lut->color[b >> 4] << 4);
+    }
 }
 
 
 static void get_char_bounds(const GFXfont *font,
-                            uint32_t cp,
+                            const GFXglyph *glyph,
                             int32_t *x,
                             int32_t *y,
                             int32_t *minx,
@@ -447,14 +1785,6 @@ static void get_char_bounds(const GFXfont *font,
                             int32_t *maxy,
                             const FontProperties *props)
 {
-    GFXglyph *glyph;
-    get_glyph(font, cp, &glyph);
-
-    if (!glyph)
-    {
-        get_glyph(font, props->fallback_glyph, &glyph);
-    }
-
     if (!glyph) return ;
 
     int32_t x1 = *x + glyph->left;
@@ -0,0 +1,424 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "font_file.h"
+
+#include <esp_log.h>
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <esp_partition.h>
+#endif
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FONT_FILE_MAGIC 0x31465045 /* "EPF1" */
+#define FONT_RECORD_ROW_SPANS 0x0001 /* glyph bitmaps are preceded by row spans */
+#define FONT_RECORD_BIT_DEPTH_SHIFT 8 /* flag bits 8-11 hold the bit depth, 0 for 4 */
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Start of a container, followed by the font index.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t font_count;
+    uint32_t size;         /* of the whole container */
+    uint32_t reserved;
+} FontFileHeader;
+
+typedef struct
+{
+    char name[FONT_FILE_NAME_SIZE];
+    uint32_t offset;       /* of the font record within the container */
+    uint32_t size;
+} FontFileEntry;
+
+/**
+ * @brief Start of a font, offsets are relative to it and 4 byte aligned.
+ */
+typedef struct
+{
+    uint32_t glyph_count;
+    uint32_t interval_count;
+    uint32_t glyph_offset;      /* GFXglyph[glyph_count] */
+    uint32_t interval_offset;   /* UnicodeInterval[interval_count] */
+    uint32_t bitmap_offset;
+    uint32_t bitmap_size;
+    uint32_t dictionary_offset;
+    uint32_t dictionary_size;   /* 0 without a dictionary */
+    uint32_t page_offset;       /* uint32_t[page_count] page offsets, 0 for a NULL page */
+    uint32_t page_count;
+    int16_t ascender;
+    int16_t descender;
+    uint16_t advance_y;
+    uint8_t compressed;
+    uint8_t format;
+    uint8_t digit_advance;
+    uint8_t tabular_figures;
+    int16_t box_left;
+    int16_t box_top;
+    int16_t box_right;
+    int16_t box_bottom;
+    uint16_t flags;             /* FONT_RECORD_* */
+} FontRecord;
+
+// the glyph table is used in place, fontconvert.py writes this layout
+_Static_assert(sizeof(GFXglyph) == 16, "GFXglyph layout differs from the font container");
+_Static_assert(sizeof(UnicodeInterval) == 12, "UnicodeInterval layout differs from the font container");
+_Static_assert(sizeof(FontRecord) == 60, "FontRecord layout differs from the font container");
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+/**
+ * @brief Map the container from a partition or, on the host, from a file.
+ */
+static bool map_container(FontFile *file, const char *location);
+
+/**
+ * @brief Is the range of `count` elements of `size` bytes at `offset` within
+ *        a block of `limit` bytes?
+ */
+static inline bool in_range(uint32_t offset, uint32_t count, uint32_t size, uint32_t limit);
+
+/**
+ * @brief Check that all tables of a font record stay within the record and
+ *        all glyphs within the bitmaps.
+ */
+static bool check_record(const uint8_t *record, uint32_t record_size);
+
+/**
+ * @brief Check that everything the decoder of a glyph reads, its row spans
+ *        and its bitmap in the format of the record, stays within the bitmaps.
+ */
+static bool check_glyph(const FontRecord *r, const GFXglyph *glyph, const uint8_t *bitmaps);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+bool font_file_open(FontFile *file, const char *location)
+{
+    memset(file, 0, sizeof(FontFile));
+    if (!map_container(file, location))
+    {
+        ESP_LOGE("font_file.c", "cannot map font container %s!", location);
+        return false;
+    }
+
+    const FontFileHeader *header = (const FontFileHeader *)file->data;
+    if (header->magic != FONT_FILE_MAGIC || header->version != FONT_FILE_VERSION ||
+        !in_range(sizeof(FontFileHeader), header->font_count, sizeof(FontFileEntry), file->size))
+    {
+        ESP_LOGE("font_file.c", "%s holds no font container of version %d!", location,
+                 FONT_FILE_VERSION);
+        font_file_close(file);
+        return false;
+    }
+    file->font_count = header->font_count;
+    return true;
+}
+
+
+bool font_file_get_font(const FontFile *file, const char *name, GFXfont *font)
+{
+    const FontFileEntry *entries = (const FontFileEntry *)&file->data[sizeof(FontFileHeader)];
+    const FontFileEntry *entry = NULL;
+    for (uint32_t i = 0; i < file->font_count && !entry; i++)
+    {
+        if (strncmp(entries[i].name, name, FONT_FILE_NAME_SIZE) == 0)
+        {
+            entry = &entries[i];
+        }
+    }
+    if (!entry)
+    {
+        ESP_LOGE("font_file.c", "font %s not found!", name);
+        return false;
+    }
+
+    const uint8_t *record = &file->data[entry->offset];
+    if (!in_range(entry->offset, entry->size, 1, file->size) || entry->offset % 4 ||
+        !check_record(record, entry->size))
+    {
+        ESP_LOGE("font_file.c", "font %s is corrupted!", name);
+        return false;
+    }
+
+    const FontRecord *r = (const FontRecord *)record;
+    memset(font, 0, sizeof(GFXfont));
+    font->bitmap = (uint8_t *)&record[r->bitmap_offset];
+    font->glyph = (GFXglyph *)&record[r->glyph_offset];
+    font->intervals = (UnicodeInterval *)&record[r->interval_offset];
+    font->interval_count = r->interval_count;
+    font->compressed = r->compressed;
+    font->advance_y = r->advance_y;
+    font->ascender = r->ascender;
+    font->descender = r->descender;
+    font->format = r->format;
+    if (r->dictionary_size)
+    {
+        font->dictionary = (uint8_t *)&record[r->dictionary_offset];
+        font->dictionary_size = r->dictionary_size;
+    }
+    font->metrics.digit_advance = r->digit_advance;
+    font->metrics.tabular_figures = r->tabular_figures;
+    font->metrics.box_left = r->box_left;
+    font->metrics.box_top = r->box_top;
+    font->metrics.box_right = r->box_right;
+    font->metrics.box_bottom = r->box_bottom;
+    font->row_spans = r->flags & FONT_RECORD_ROW_SPANS;
+    font->bit_depth = (r->flags >> FONT_RECORD_BIT_DEPTH_SHIFT) & 0xF;
+
+    // pages are used in place, only the table of pointers to them is built;
+    // without memory for it glyphs are still found by the binary search
+    if (r->page_count)
+    {
+        const uint32_t *page_offsets = (const uint32_t *)&record[r->page_offset];
+        uint16_t **pages = (uint16_t **)malloc(r->page_count * sizeof(uint16_t *));
+        for (uint32_t i = 0; pages && i < r->page_count; i++)
+        {
+            pages[i] = page_offsets[i] ? (uint16_t *)&record[page_offsets[i]] : NULL;
+        }
+        font->glyph_pages = pages;
+        font->glyph_page_count = pages ? r->page_count : 0;
+    }
+    return true;
+}
+
+
+void font_file_release_font(GFXfont *font)
+{
+    free(font->glyph_pages);
+    font->glyph_pages = NULL;
+    font->glyph_page_count = 0;
+}
+
+
+void font_file_close(FontFile *file)
+{
+    if (file->mapped)
+    {
+#if CONFIG_IDF_TARGET_LINUX
+        munmap((void *)file->data, file->size);
+#else
+        esp_partition_munmap(file->map_handle);
+#endif
+    }
+    memset(file, 0, sizeof(FontFile));
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static bool map_container(FontFile *file, const char *location)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    int fd = open(location, O_RDONLY);
+    struct stat info;
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(FontFileHeader))
+    {
+        close(fd);
+        return false;
+    }
+    void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+    file->data = (const uint8_t *)data;
+    file->size = info.st_size;
+    file->mapped = true;
+    return true;
+#else
+    const esp_partition_t *partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, location);
+    FontFileHeader header;
+    if (!partition ||
+        esp_partition_read(partition, 0, &header, sizeof(FontFileHeader)) != ESP_OK)
+    {
+        return false;
+    }
+
+    // an erased partition reads as 0xFF, map the header only to report it
+    uint32_t size = header.size <= partition->size && header.size >= sizeof(FontFileHeader)
+                    ? header.size : sizeof(FontFileHeader);
+    const void *data;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, size, ESP_PARTITION_MMAP_DATA, &data, &handle) != ESP_OK)
+    {
+        return false;
+    }
+    file->data = (const uint8_t *)data;
+    file->size = size;
+    file->map_handle = handle;
+    file->mapped = true;
+    return true;
+#endif
+}
+
+
+static inline bool in_range(uint32_t offset, uint32_t count, uint32_t size, uint32_t limit)
+{
+    return offset <= limit && count <= (limit - offset) / size;
+}
+
+
+static bool check_record(const uint8_t *record, uint32_t record_size)
+{
+    if (record_size < sizeof(FontRecord))
+    {
+        return false;
+    }
+    const FontRecord *r = (const FontRecord *)record;
+    uint32_t depth = (r->flags >> FONT_RECORD_BIT_DEPTH_SHIFT) & 0xF;
+    if ((depth != 0 && depth != 1 && depth != 2 && depth != 4) ||
+        (depth && depth != 4 && r->compressed && r->format == GLYPH_FORMAT_RLE) ||
+        !in_range(r->glyph_offset, r->glyph_count, sizeof(GFXglyph), record_size) ||
+        !in_range(r->interval_offset, r->interval_count, sizeof(UnicodeInterval), record_size) ||
+        !in_range(r->bitmap_offset, r->bitmap_size, 1, record_size) ||
+        !in_range(r->dictionary_offset, r->dictionary_size, 1, record_size) ||
+        !in_range(r->page_offset, r->page_count, sizeof(uint32_t), record_size) ||
+        (r->glyph_offset | r->interval_offset | r->page_offset) % 4 ||
+        r->format > GLYPH_FORMAT_RLE)
+    {
+        return false;
+    }
+
+    const UnicodeInterval *intervals = (const UnicodeInterval *)&record[r->interval_offset];
+    for (uint32_t i = 0; i < r->interval_count; i++)
+    {
+        if (intervals[i].last < intervals[i].first ||
+            !in_range(intervals[i].offset, intervals[i].last - intervals[i].first + 1, 1,
+                      r->glyph_count))
+        {
+            return false;
+        }
+    }
+
+    const GFXglyph *glyphs = (const GFXglyph *)&record[r->glyph_offset];
+    for (uint32_t i = 0; i < r->glyph_count; i++)
+    {
+        if (!check_glyph(r, &glyphs[i], &record[r->bitmap_offset]))
+        {
+            return false;
+        }
+    }
+
+    const uint32_t *page_offsets = (const uint32_t *)&record[r->page_offset];
+    for (uint32_t i = 0; i < r->page_count; i++)
+    {
+        if (page_offsets[i] &&
+            (page_offsets[i] % 2 ||
+             !in_range(page_offsets[i], GLYPH_PAGE_SIZE, sizeof(uint16_t), record_size)))
+        {
+            return false;
+        }
+        const uint16_t *page = (const uint16_t *)&record[page_offsets[i]];
+        for (uint32_t j = 0; page_offsets[i] && j < GLYPH_PAGE_SIZE; j++)
+        {
+            if (page[j] > r->glyph_count)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+static bool check_glyph(const FontRecord *r, const GFXglyph *glyph, const uint8_t *bitmaps)
+{
+    uint32_t spans = r->flags & FONT_RECORD_ROW_SPANS ? 2 * glyph->height : 0;
+    if (glyph->data_offset < spans || glyph->data_offset > r->bitmap_size)
+    {
+        return false;
+    }
+
+    uint32_t available = r->bitmap_size - glyph->data_offset;
+    if (!r->compressed)
+    {
+        // rows are read in full at the bit depth of the font
+        uint32_t depth = (r->flags >> FONT_RECORD_BIT_DEPTH_SHIFT) & 0xF;
+        uint32_t byte_width = (glyph->width * (depth ? depth : 4) + 7) / 8;
+        return byte_width * glyph->height <= available;
+    }
+    if (glyph->compressed_size > available)
+    {
+        return false;
+    }
+    if (r->format != GLYPH_FORMAT_RLE)
+    {
+        // inflate stops at the end of the compressed data
+        return true;
+    }
+
+    // the decoder reads runs until every row is covered, they must end
+    // within the compressed data and exactly at the end of each row
+    const uint8_t *data = &bitmaps[glyph->data_offset];
+    uint32_t size = glyph->compressed_size;
+    uint32_t pos = 0;
+    for (uint32_t y = 0; y < glyph->height; y++)
+    {
+        uint32_t x = 0;
+        while (x < glyph->width)
+        {
+            if (pos == size)
+            {
+                return false;
+            }
+            uint32_t count = (data[pos] & 0xF) + 1;
+            pos++;
+            if (count == 16)
+            {
+                if (pos == size)
+                {
+                    return false;
+                }
+                count += data[pos++];
+            }
+            x += count;
+        }
+        if (x != glyph->width)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,101 @@
+/**
+ * Fonts read from a binary container in flash instead of compiled headers.
+ */
+
+#ifndef _FONT_FILE_H_
+#define _FONT_FILE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Size of a font name in the container index, including the
+ *        terminating zero.
+ */
+#define FONT_FILE_NAME_SIZE 32
+
+/**
+ * @brief Container version understood by this driver.
+ */
+#define FONT_FILE_VERSION 1
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief A font container mapped into memory.
+ *
+ * The container is written by `fontconvert.py --binary`. It starts with a
+ * header and an index of the fonts by name. Every font holds its glyph table,
+ * unicode intervals, bitmaps, dictionary and page table laid out like the
+ * structures of a compiled header, so fonts are used in place.
+ */
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t font_count;
+    /** Mapping of the container, valid if `mapped` is set. */
+    uint32_t map_handle;
+    bool mapped;
+} FontFile;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Map a font container and check its index.
+ *
+ * @param location Label of the data partition holding the container. On the
+ *                 linux host target, the path of the container file.
+ *
+ * @return false if the container cannot be mapped or is invalid.
+ */
+bool font_file_open(FontFile *file, const char *location);
+
+/**
+ * @brief Set up `font` as a view of a font in the container, no glyph data
+ *        is copied. The view is valid until the container is closed.
+ *
+ * @return false if the container has no valid font of this name.
+ */
+bool font_file_get_font(const FontFile *file, const char *name, GFXfont *font);
+
+/**
+ * @brief Release the page table of a font view.
+ */
+void font_file_release_font(GFXfont *font);
+
+/**
+ * @brief Unmap a font container.
+ */
+void font_file_close(FontFile *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
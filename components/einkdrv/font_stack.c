@@ -0,0 +1,221 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "font_stack.h"
+
+#include <esp_log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static int compare_code_points(const void *a, const void *b);
+
+/**
+ * @brief `TextRunLookup` of a font stack.
+ */
+static const GFXglyph *lookup_glyph(const void *stack, uint32_t code_point,
+                                    const GFXfont **font);
+
+/**
+ * @brief Add the code points from `first` to `last` to the index, extending
+ *        the previous range if it continues with the next glyph of the same
+ *        font.
+ */
+static void add_range(FontStack *stack, uint32_t first, uint32_t last,
+                      const GFXglyph *glyph, uint32_t font);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+bool font_stack_init(FontStack *stack, const GFXfont *const *fonts, uint32_t count)
+{
+    memset(stack, 0, sizeof(FontStack));
+    if (count > FONT_STACK_MAX_FONTS)
+    {
+        ESP_LOGE("font_stack.c", "at most %d fonts can be stacked!", FONT_STACK_MAX_FONTS);
+        return false;
+    }
+
+    // every interval start and end splits the code points into segments
+    // which are covered by the same fonts throughout
+    uint32_t boundary_count = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        stack->fonts[i] = fonts[i];
+        boundary_count += 2 * fonts[i]->interval_count;
+    }
+    stack->font_count = count;
+
+    // without intervals there is nothing to index, every lookup misses
+    if (boundary_count == 0)
+    {
+        return true;
+    }
+
+    uint32_t *boundaries = (uint32_t *)malloc(boundary_count * sizeof(uint32_t));
+    stack->ranges = (FontStackRange *)malloc(boundary_count * sizeof(FontStackRange));
+    if (!boundaries || !stack->ranges)
+    {
+        ESP_LOGE("font_stack.c", "cannot allocate font stack index!");
+        free(boundaries);
+        font_stack_release(stack);
+        return false;
+    }
+
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        for (uint32_t j = 0; j < fonts[i]->interval_count; j++)
+        {
+            boundaries[n++] = fonts[i]->intervals[j].first;
+            boundaries[n++] = fonts[i]->intervals[j].last + 1;
+        }
+    }
+    qsort(boundaries, n, sizeof(uint32_t), compare_code_points);
+
+    // the intervals of each font are sorted, so one cursor per font walks
+    // them along with the segments
+    uint32_t cursors[FONT_STACK_MAX_FONTS] = {0};
+    for (uint32_t b = 0; b + 1 < n; b++)
+    {
+        uint32_t first = boundaries[b];
+        if (first == boundaries[b + 1])
+        {
+            continue;
+        }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const GFXfont *font = fonts[i];
+            while (cursors[i] < font->interval_count && font->intervals[cursors[i]].last < first)
+            {
+                cursors[i]++;
+            }
+            const UnicodeInterval *interval = &font->intervals[cursors[i]];
+            if (cursors[i] < font->interval_count && interval->first <= first)
+            {
+                add_range(stack, first, boundaries[b + 1] - 1,
+                          &font->glyph[interval->offset + first - interval->first], i);
+                break;
+            }
+        }
+    }
+    free(boundaries);
+
+    // there is at least one interval, so at least one range was added
+    FontStackRange *ranges = (FontStackRange *)realloc(stack->ranges,
+                                                       stack->range_count * sizeof(FontStackRange));
+    if (ranges)
+    {
+        stack->ranges = ranges;
+    }
+    return true;
+}
+
+
+const GFXglyph *font_stack_get_glyph(const FontStack *stack, uint32_t code_point,
+                                     const GFXfont **font)
+{
+    uint32_t low = 0;
+    uint32_t high = stack->range_count;
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+        const FontStackRange *range = &stack->ranges[mid];
+        if (code_point < range->first)
+        {
+            high = mid;
+        }
+        else if (code_point > range->last)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            if (font)
+            {
+                *font = stack->fonts[range->font];
+            }
+            return &range->glyph[code_point - range->first];
+        }
+    }
+    return NULL;
+}
+
+
+bool font_stack_shape(TextRun *run, const FontStack *stack, const char *string,
+                      const FontProperties *props)
+{
+    return text_run_shape_lookup(run, stack->fonts[0], lookup_glyph, stack, string, props);
+}
+
+
+void font_stack_release(FontStack *stack)
+{
+    free(stack->ranges);
+    memset(stack, 0, sizeof(FontStack));
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static int compare_code_points(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+
+static const GFXglyph *lookup_glyph(const void *stack, uint32_t code_point,
+                                    const GFXfont **font)
+{
+    return font_stack_get_glyph((const FontStack *)stack, code_point, font);
+}
+
+
+static void add_range(FontStack *stack, uint32_t first, uint32_t last,
+                      const GFXglyph *glyph, uint32_t font)
+{
+    if (stack->range_count > 0)
+    {
+        FontStackRange *previous = &stack->ranges[stack->range_count - 1];
+        if (previous->font == font && previous->last + 1 == first &&
+            &previous->glyph[first - previous->first] == glyph)
+        {
+            previous->last = last;
+            return;
+        }
+    }
+    FontStackRange *range = &stack->ranges[stack->range_count++];
+    range->first = first;
+    range->last = last;
+    range->glyph = glyph;
+    range->font = font;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,106 @@
+/**
+ * Several fonts used as one, e.g. a text face followed by symbol fonts.
+ */
+
+#ifndef _FONT_STACK_H_
+#define _FONT_STACK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Maximum number of fonts in a stack.
+ */
+#define FONT_STACK_MAX_FONTS 8
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Code points drawn with consecutive glyphs of one font.
+ */
+typedef struct
+{
+    uint32_t first;
+    uint32_t last;
+    const GFXglyph *glyph; /** Glyph of `first` */
+    uint32_t font;         /** Index of the font in the stack */
+} FontStackRange;
+
+/**
+ * @brief Fonts ordered by descending priority. A code point is drawn with
+ *        the first font having a glyph for it.
+ *
+ * The intervals of all fonts are merged into one sorted index of ranges when
+ * the stack is set up, so finding a glyph is a single binary search, however
+ * many fonts the stack has.
+ */
+typedef struct
+{
+    const GFXfont *fonts[FONT_STACK_MAX_FONTS];
+    uint32_t font_count;
+    FontStackRange *ranges;
+    uint32_t range_count;
+} FontStack;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Set up a stack of `count` fonts and build its index.
+ *
+ * @return false if there are too many fonts or no memory for the index.
+ */
+bool font_stack_init(FontStack *stack, const GFXfont *const *fonts, uint32_t count);
+
+/**
+ * @brief Get the glyph for a code point, NULL if no font of the stack has one.
+ *
+ * @param font Set to the font the glyph belongs to, may be NULL.
+ */
+const GFXglyph *font_stack_get_glyph(const FontStack *stack, uint32_t code_point,
+                                     const GFXfont **font);
+
+/**
+ * @brief Decode a string and look up its glyphs in the stack, like
+ *        `text_run_shape`. Runs keep the font of every glyph, they are
+ *        measured with the metrics of the first font.
+ *
+ * @return false if the string was cut off after `TEXT_RUN_MAX_GLYPHS`.
+ */
+bool font_stack_shape(TextRun *run, const FontStack *stack, const char *string,
+                      const FontProperties *props);
+
+/**
+ * @brief Free the index of a stack.
+ */
+void font_stack_release(FontStack *stack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,440 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "glyph_atlas.h"
+#include "utf8.h"
+
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_partition.h>
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Marks a stored atlas, change it along with the image layout.
+ */
+#define ATLAS_MAGIC 0x32415447 /* "GTA2" */
+
+/**
+ * @brief Version of the sprite rendering, bump it whenever the same glyph
+ *        data renders to different sprites, e.g. after a change to the
+ *        blending or the glyph decoding.
+ */
+#define ATLAS_VERSION 1
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Start of an atlas image, followed by the sprite table and the
+ *        sprite data.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;      /* ATLAS_VERSION the sprites were rendered with */
+    uint32_t key;          /* hash of everything the sprites are rendered from */
+    uint32_t sprite_count;
+    uint32_t size;         /* of the whole image */
+} AtlasHeader;
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static inline int32_t min(int32_t x, int32_t y)
+{
+    return x < y ? x : y;
+}
+
+static inline int32_t max(int32_t x, int32_t y)
+{
+    return x > y ? x : y;
+}
+
+/**
+ * @brief Decode the next character of `string` and copy its UTF-8 bytes to
+ *        `utf8`.
+ *
+ * @return Pointer to the following character.
+ */
+static const char *next_char(const char *string, char *utf8, uint32_t *code_point);
+
+static uint32_t hash_bytes(uint32_t hash, const void *data, size_t size);
+
+/**
+ * @brief Hash the font-wide settings the glyphs are decoded with.
+ */
+static uint32_t hash_font(uint32_t hash, const GFXfont *font);
+
+/**
+ * @brief Hash the stored bitmap of a glyph, including its row spans.
+ *        `GLYPH_FORMAT_SDF` fields are not part of the font bitmap and are
+ *        covered by the glyph metrics only.
+ */
+static uint32_t hash_glyph_data(uint32_t hash, const GFXfont *font, const GFXglyph *glyph);
+
+/**
+ * @brief Bytes per row of the sprite of a glyph starting at pixel `parity`.
+ */
+static inline int32_t sprite_byte_width(const GFXglyph *glyph, int32_t parity);
+
+static const GlyphSprite *find_sprite(const GlyphAtlas *atlas, uint32_t code_point);
+
+/**
+ * @brief Render all sprites into a new atlas image.
+ *
+ * @return The image, NULL if out of memory.
+ */
+static uint8_t *render_image(const AtlasHeader *header, const GFXfont *font,
+                             const char *chars, const FontProperties *props);
+
+/**
+ * @brief Map the atlas partition if it holds an image with the given header.
+ */
+static bool map_image(GlyphAtlas *atlas, const esp_partition_t *partition,
+                      const AtlasHeader *header);
+
+static void use_image(GlyphAtlas *atlas, const uint8_t *image);
+
+/**
+ * @brief Copy one sprite row to a framebuffer row, `dst` being the byte of
+ *        its first (possibly padding) pixel. Padding nibbles are kept.
+ */
+static inline void blit_row(uint8_t *dst, const uint8_t *src, int32_t lo, int32_t hi,
+                            int32_t byte_width, bool head, bool tail);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+bool glyph_atlas_init(GlyphAtlas *atlas, const GFXfont *font, const char *chars,
+                      const FontProperties *props, const char *partition_label)
+{
+    memset(atlas, 0, sizeof(GlyphAtlas));
+    atlas->font = font;
+
+    // the key covers the glyph metrics and bitmaps, a changed font renders
+    // a new atlas
+    AtlasHeader header = {.magic = ATLAS_MAGIC, .version = ATLAS_VERSION};
+    uint32_t data_size = 0;
+    uint32_t hash = hash_font(2166136261u, font);
+    if (props)
+    {
+        uint8_t colors[2] = {props->fg_color, props->bg_color};
+        hash = hash_bytes(hash, colors, sizeof(colors));
+    }
+    const char *next = chars;
+    while (*next)
+    {
+        char utf8[5];
+        uint32_t code_point;
+        GFXglyph *glyph;
+        next = next_char(next, utf8, &code_point);
+        get_glyph(font, code_point, &glyph);
+        if (!glyph || header.sprite_count == GLYPH_ATLAS_MAX_GLYPHS)
+        {
+            continue;
+        }
+        hash = hash_bytes(hash, &code_point, sizeof(code_point));
+        hash = hash_bytes(hash, glyph, sizeof(GFXglyph));
+        hash = hash_glyph_data(hash, font, glyph);
+        data_size += glyph->height * (sprite_byte_width(glyph, 0) + sprite_byte_width(glyph, 1));
+        header.sprite_count++;
+    }
+    header.key = hash;
+    header.size = sizeof(AtlasHeader) + header.sprite_count * sizeof(GlyphSprite) + data_size;
+
+    const esp_partition_t *partition = NULL;
+    if (partition_label)
+    {
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                             partition_label);
+        if (partition && partition->size < header.size)
+        {
+            ESP_LOGE("glyph_atlas.c", "atlas of %" PRIu32 " bytes does not fit partition %s!",
+                     header.size, partition_label);
+            partition = NULL;
+        }
+    }
+    if (partition && map_image(atlas, partition, &header))
+    {
+        return true;
+    }
+
+    uint8_t *image = render_image(&header, font, chars, props);
+    if (!image)
+    {
+        ESP_LOGE("glyph_atlas.c", "cannot allocate glyph atlas!");
+        return false;
+    }
+    if (partition)
+    {
+        size_t erase_size = (header.size + partition->erase_size - 1) / partition->erase_size
+                            * partition->erase_size;
+        if (esp_partition_erase_range(partition, 0, erase_size) != ESP_OK ||
+            esp_partition_write(partition, 0, image, header.size) != ESP_OK)
+        {
+            ESP_LOGE("glyph_atlas.c", "cannot store glyph atlas in partition %s!",
+                     partition_label);
+        }
+    }
+    atlas->image = image;
+    use_image(atlas, image);
+    return true;
+}
+
+
+bool glyph_atlas_write(const GlyphAtlas *atlas, const char *string, int32_t *cursor_x,
+                       int32_t cursor_y, uint8_t *framebuffer)
+{
+    if (!atlas->data || epd_is_rotated())
+    {
+        return false;
+    }
+
+    char utf8[5];
+    uint32_t code_point;
+    for (const char *next = string; *next;)
+    {
+        next = next_char(next, utf8, &code_point);
+        if (!find_sprite(atlas, code_point))
+        {
+            return false;
+        }
+    }
+
+    for (const char *next = string; *next;)
+    {
+        next = next_char(next, utf8, &code_point);
+        const GlyphSprite *sprite = find_sprite(atlas, code_point);
+        GFXglyph *glyph;
+        get_glyph(atlas->font, code_point, &glyph);
+
+        // sprites start at a byte boundary, a leading padding pixel for odd x
+        int32_t x = *cursor_x + glyph->left;
+        int32_t parity = x & 1;
+        int32_t byte_width = sprite_byte_width(glyph, parity);
+        int32_t dst_byte = (x - parity) / 2;
+        int32_t lo = max(0, -dst_byte);
+        int32_t hi = min(byte_width, EPD_WIDTH / 2 - dst_byte);
+        bool head = parity;
+        bool tail = (parity + glyph->width) & 1;
+        const uint8_t *src = &atlas->data[sprite->offset[parity]];
+
+        int32_t y0 = cursor_y - glyph->top;
+        for (int32_t y = max(0, -y0); y < glyph->height && y0 + y < EPD_HEIGHT &&
+                                      glyph->width && lo < hi; y++)
+        {
+            blit_row(&framebuffer[(y0 + y) * EPD_WIDTH / 2 + dst_byte], &src[y * byte_width],
+                     lo, hi, byte_width, head, tail);
+        }
+        *cursor_x += glyph->advance_x;
+    }
+    return true;
+}
+
+
+void glyph_atlas_release(GlyphAtlas *atlas)
+{
+    if (atlas->mapped)
+    {
+        esp_partition_munmap(atlas->map_handle);
+    }
+    heap_caps_free(atlas->image);
+    memset(atlas, 0, sizeof(GlyphAtlas));
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static const char *next_char(const char *string, char *utf8, uint32_t *code_point)
+{
+    const char *next = string;
+    *code_point = utf8_next(&next);
+    memcpy(utf8, string, next - string);
+    utf8[next - string] = '\0';
+    return next;
+}
+
+
+static uint32_t hash_bytes(uint32_t hash, const void *data, size_t size)
+{
+    // FNV-1a
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+
+static uint32_t hash_font(uint32_t hash, const GFXfont *font)
+{
+    uint8_t settings[4] = {font->compressed, font->format, font->bit_depth, font->row_spans};
+    hash = hash_bytes(hash, settings, sizeof(settings));
+    if (font->dictionary)
+    {
+        hash = hash_bytes(hash, font->dictionary, font->dictionary_size);
+    }
+    return hash;
+}
+
+
+static uint32_t hash_glyph_data(uint32_t hash, const GFXfont *font, const GFXglyph *glyph)
+{
+    if (font->compressed && font->format == GLYPH_FORMAT_SDF)
+    {
+        return hash;
+    }
+
+    uint32_t depth = font->bit_depth ? font->bit_depth : 4;
+    uint32_t size = font->compressed ? glyph->compressed_size
+                                     : glyph->height * ((glyph->width * depth + 7) / 8);
+    uint32_t spans = font->row_spans ? 2 * glyph->height : 0;
+    return hash_bytes(hash, &font->bitmap[glyph->data_offset - spans], spans + size);
+}
+
+
+static inline int32_t sprite_byte_width(const GFXglyph *glyph, int32_t parity)
+{
+    return (parity + glyph->width + 1) / 2;
+}
+
+
+static const GlyphSprite *find_sprite(const GlyphAtlas *atlas, uint32_t code_point)
+{
+    for (uint32_t i = 0; i < atlas->sprite_count; i++)
+    {
+        if (atlas->sprites[i].code_point == code_point)
+        {
+            return &atlas->sprites[i];
+        }
+    }
+    return NULL;
+}
+
+
+static uint8_t *render_image(const AtlasHeader *header, const GFXfont *font,
+                             const char *chars, const FontProperties *props)
+{
+    uint8_t *image = (uint8_t *)heap_caps_malloc(header->size, MALLOC_CAP_SPIRAM);
+    if (!image)
+    {
+        image = (uint8_t *)malloc(header->size);
+    }
+    if (!image)
+    {
+        return NULL;
+    }
+
+    memcpy(image, header, sizeof(AtlasHeader));
+    GlyphSprite *sprites = (GlyphSprite *)&image[sizeof(AtlasHeader)];
+    uint8_t *data = (uint8_t *)&sprites[header->sprite_count];
+    uint8_t background = (props ? props->bg_color : 15) * 0x11;
+    uint32_t offset = 0;
+    uint32_t count = 0;
+
+    const char *next = chars;
+    while (*next && count < header->sprite_count)
+    {
+        char utf8[5];
+        uint32_t code_point;
+        GFXglyph *glyph;
+        next = next_char(next, utf8, &code_point);
+        get_glyph(font, code_point, &glyph);
+        if (!glyph)
+        {
+            continue;
+        }
+
+        GlyphSprite *sprite = &sprites[count++];
+        sprite->code_point = code_point;
+        for (int32_t parity = 0; parity < 2; parity++)
+        {
+            int32_t size = glyph->height * sprite_byte_width(glyph, parity);
+            int32_t cursor_x = parity - glyph->left;
+            sprite->offset[parity] = offset;
+            memset(&data[offset], background, size);
+            write_to_buffer(font, utf8, &cursor_x, glyph->top, &data[offset],
+                            parity + glyph->width, glyph->height, props);
+            offset += size;
+        }
+    }
+    return image;
+}
+
+
+static bool map_image(GlyphAtlas *atlas, const esp_partition_t *partition,
+                      const AtlasHeader *header)
+{
+    AtlasHeader stored;
+    if (esp_partition_read(partition, 0, &stored, sizeof(AtlasHeader)) != ESP_OK ||
+        memcmp(&stored, header, sizeof(AtlasHeader)) != 0)
+    {
+        return false;
+    }
+
+    const void *image;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, header->size, ESP_PARTITION_MMAP_DATA, &image,
+                           &handle) != ESP_OK)
+    {
+        return false;
+    }
+    atlas->map_handle = handle;
+    atlas->mapped = true;
+    use_image(atlas, (const uint8_t *)image);
+    return true;
+}
+
+
+static void use_image(GlyphAtlas *atlas, const uint8_t *image)
+{
+    const AtlasHeader *header = (const AtlasHeader *)image;
+    atlas->sprite_count = header->sprite_count;
+    atlas->sprites = (const GlyphSprite *)&image[sizeof(AtlasHeader)];
+    atlas->data = (const uint8_t *)&atlas->sprites[header->sprite_count];
+}
+
+
+static inline void blit_row(uint8_t *dst, const uint8_t *src, int32_t lo, int32_t hi,
+                            int32_t byte_width, bool head, bool tail)
+{
+    if (head && lo == 0)
+    {
+        dst[0] = (dst[0] & 0x0F) | (src[0] & 0xF0);
+        lo = 1;
+    }
+    if (tail && hi == byte_width)
+    {
+        hi--;
+        dst[hi] = (dst[hi] & 0xF0) | (src[hi] & 0x0F);
+    }
+    if (lo < hi)
+    {
+        memcpy(&dst[lo], &src[lo], hi - lo);
+    }
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
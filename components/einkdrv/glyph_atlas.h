@@ -0,0 +1,112 @@
+/**
+ * Pre-rendered glyph sprites, blitted to a 4 bit framebuffer row by row.
+ */
+
+#ifndef _GLYPH_ATLAS_H_
+#define _GLYPH_ATLAS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Maximum number of glyphs in an atlas.
+ */
+#define GLYPH_ATLAS_MAX_GLYPHS 32
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Location of the sprites of one glyph within the atlas data.
+ */
+typedef struct
+{
+    uint32_t code_point;
+    /** Offset of the sprite for glyphs starting at an even and an odd pixel. */
+    uint32_t offset[2];
+} GlyphSprite;
+
+/**
+ * @brief Glyphs of a font, already blended to their final 4 bit colors.
+ *
+ * Every glyph is rendered twice, starting at the low and at the high nibble
+ * of a byte, so drawing it at any position only copies whole rows.
+ */
+typedef struct
+{
+    const GFXfont *font;
+    const GlyphSprite *sprites;
+    uint32_t sprite_count;
+    const uint8_t *data;
+    /** Atlas image in RAM, NULL if it is mapped from flash. */
+    uint8_t *image;
+    /** Mapping of the atlas partition, valid if `mapped` is set. */
+    uint32_t map_handle;
+    bool mapped;
+} GlyphAtlas;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Load the atlas for the glyphs of `chars`, rendering it if needed.
+ *
+ * An atlas stored in the data partition `partition_label` is mapped if it
+ * was rendered from the same font, characters and colors. Otherwise it is
+ * rendered into RAM and written to the partition, so the work is done only
+ * once and not on every wake. Without a partition, the atlas stays in RAM.
+ *
+ * @param props Font properties for blending, NULL for the defaults.
+ * @param partition_label Label of the atlas partition, may be NULL.
+ *
+ * @return false if the atlas could not be loaded or rendered.
+ */
+bool glyph_atlas_init(GlyphAtlas *atlas, const GFXfont *font, const char *chars,
+                      const FontProperties *props, const char *partition_label);
+
+/**
+ * @brief Write text to a 4 bit framebuffer from the atlas.
+ *
+ * Glyph boxes are copied including their background, so the result matches
+ * `writeln` on a buffer filled with the background color. Nothing is drawn
+ * if a character has no sprite or the canvas is rotated, the caller then has
+ * to fall back to `writeln`.
+ *
+ * @return true if the text was drawn.
+ */
+bool glyph_atlas_write(const GlyphAtlas *atlas, const char *string, int32_t *cursor_x,
+                       int32_t cursor_y, uint8_t *framebuffer);
+
+/**
+ * @brief Release the memory or flash mapping of an atlas.
+ */
+void glyph_atlas_release(GlyphAtlas *atlas);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,225 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "glyph_cache.h"
+
+#include <esp_heap_caps.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+typedef struct
+{
+    const GFXfont *font;   /* NULL for a free entry */
+    const GFXglyph *glyph; /* identifies the code point within the font */
+    uint8_t *bitmap;
+    size_t size;
+    uint32_t last_used;    /* value of `use_count` at the last lookup */
+} CacheEntry;
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static CacheEntry *find_entry(const GFXfont *font, const GFXglyph *glyph);
+
+/**
+ * @brief Drop the least recently used glyph.
+ *
+ * @return The now free entry, NULL if the cache was empty.
+ */
+static CacheEntry *evict_lru();
+
+static void release_entry(CacheEntry *entry);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static CacheEntry entries[GLYPH_CACHE_ENTRIES];
+
+static size_t budget = GLYPH_CACHE_DEFAULT_BUDGET;
+
+static uint32_t use_count;
+
+static GlyphCacheStats stats;
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+uint8_t *glyph_cache_lookup(const GFXfont *font, const GFXglyph *glyph)
+{
+    CacheEntry *entry = find_entry(font, glyph);
+    if (!entry)
+    {
+        return NULL;
+    }
+    stats.hits++;
+    entry->last_used = ++use_count;
+    return entry->bitmap;
+}
+
+
+uint8_t *glyph_cache_insert(const GFXfont *font, const GFXglyph *glyph, size_t size)
+{
+    if (size > budget)
+    {
+        return NULL;
+    }
+    glyph_cache_remove(font, glyph);
+
+    while (stats.bytes + size > budget)
+    {
+        evict_lru();
+    }
+    CacheEntry *entry = find_entry(NULL, NULL);
+    if (!entry)
+    {
+        entry = evict_lru();
+    }
+
+    // large glyphs go to PSRAM, fall back to internal memory without it
+    uint8_t *bitmap = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (!bitmap)
+    {
+        bitmap = (uint8_t *)malloc(size);
+    }
+    if (!bitmap)
+    {
+        return NULL;
+    }
+
+    entry->font = font;
+    entry->glyph = glyph;
+    entry->bitmap = bitmap;
+    entry->size = size;
+    entry->last_used = ++use_count;
+    stats.misses++;
+    stats.entries++;
+    stats.bytes += size;
+    return bitmap;
+}
+
+
+void glyph_cache_remove(const GFXfont *font, const GFXglyph *glyph)
+{
+    CacheEntry *entry = find_entry(font, glyph);
+    if (entry)
+    {
+        release_entry(entry);
+    }
+}
+
+
+bool glyph_cache_owns(const uint8_t *bitmap)
+{
+    for (int32_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].font && entries[i].bitmap == bitmap)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void glyph_cache_set_budget(size_t bytes)
+{
+    budget = bytes;
+    while (stats.bytes > budget)
+    {
+        evict_lru();
+    }
+}
+
+
+void glyph_cache_clear()
+{
+    for (int32_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].font)
+        {
+            release_entry(&entries[i]);
+        }
+    }
+}
+
+
+void glyph_cache_get_stats(GlyphCacheStats *out)
+{
+    *out = stats;
+}
+
+
+void glyph_cache_reset_stats()
+{
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static CacheEntry *find_entry(const GFXfont *font, const GFXglyph *glyph)
+{
+    for (int32_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].font == font && entries[i].glyph == glyph)
+        {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+
+static CacheEntry *evict_lru()
+{
+    CacheEntry *lru = NULL;
+    for (int32_t i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+    {
+        // compare ages, so a wrapping use_count keeps the order
+        if (entries[i].font &&
+            (!lru || use_count - entries[i].last_used > use_count - lru->last_used))
+        {
+            lru = &entries[i];
+        }
+    }
+    if (lru)
+    {
+        release_entry(lru);
+        stats.evictions++;
+    }
+    return lru;
+}
+
+
+static void release_entry(CacheEntry *entry)
+{
+    heap_caps_free(entry->bitmap);
+    stats.entries--;
+    stats.bytes -= entry->size;
+    memset(entry, 0, sizeof(CacheEntry));
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,129 @@
+/**
+ * Cache for decompressed glyph bitmaps of compressed fonts.
+ */
+
+#ifndef _GLYPH_CACHE_H_
+#define _GLYPH_CACHE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Byte budget used until `glyph_cache_set_budget` is called. Sized for
+ *        the glyphs a clock update inserts: all 46 glyphs of the subset
+ *        Quicksand_28 (24429 bytes decoded) and all of Quicksand_18 (21547
+ *        bytes), plus two Quicksand_140 digits drawn twice (at most 15614
+ *        bytes each). Other Quicksand_140 glyphs are inflated straight into
+ *        the canvas and never cached.
+ *
+ * @note Prewarming `GLYPH_CACHE_DIGITS` of Quicksand_140 takes 136009 bytes,
+ *       raise the budget first.
+ */
+#define GLYPH_CACHE_DEFAULT_BUDGET (80 * 1024)
+
+/**
+ * @brief Maximum number of cached glyphs, independent of their size.
+ */
+#define GLYPH_CACHE_ENTRIES 64
+
+/**
+ * @brief The characters needed to display the time.
+ */
+#define GLYPH_CACHE_DIGITS "0123456789:"
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Glyph cache statistics, counted since the last reset.
+ */
+typedef struct
+{
+    uint32_t hits;      /** Lookups served from the cache */
+    uint32_t misses;    /** Glyphs decompressed into the cache */
+    uint32_t evictions; /** Glyphs dropped to stay within the budget */
+    uint32_t entries;   /** Number of glyphs currently cached */
+    size_t   bytes;     /** Bytes of bitmap data currently cached */
+} GlyphCacheStats;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Find the decompressed bitmap of a glyph, counting a hit. Misses
+ *        are counted by `glyph_cache_insert`, so lookups which decode the
+ *        glyph elsewhere do not count as misses.
+ *
+ * @return The bitmap, NULL if the glyph is not cached.
+ */
+uint8_t *glyph_cache_lookup(const GFXfont *font, const GFXglyph *glyph);
+
+/**
+ * @brief Reserve cache memory for the bitmap of a glyph, evicting the least
+ *        recently used glyphs as needed, and count a miss. The caller fills
+ *        in the bitmap.
+ *
+ * @return The bitmap buffer owned by the cache, NULL if the bitmap does not
+ *         fit the budget or no memory is left.
+ */
+uint8_t *glyph_cache_insert(const GFXfont *font, const GFXglyph *glyph, size_t size);
+
+/**
+ * @brief Drop a glyph from the cache, e.g. if its bitmap could not be filled.
+ */
+void glyph_cache_remove(const GFXfont *font, const GFXglyph *glyph);
+
+/**
+ * @brief Does the cache own this bitmap buffer?
+ */
+bool glyph_cache_owns(const uint8_t *bitmap);
+
+/**
+ * @brief Change the byte budget, evicting glyphs if it shrinks.
+ *        A budget of 0 disables caching.
+ */
+void glyph_cache_set_budget(size_t bytes);
+
+/**
+ * @brief Drop all cached glyphs.
+ */
+void glyph_cache_clear();
+
+/**
+ * @brief Get the current statistics.
+ */
+void glyph_cache_get_stats(GlyphCacheStats *stats);
+
+/**
+ * @brief Reset the hit, miss and eviction counters.
+ */
+void glyph_cache_reset_stats();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,260 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "sdf_font.h"
+#include "glyph_cache.h"
+
+#include <esp_attr.h>
+#include <esp_log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Characters whose boxes make up the layout metrics, like the
+ *        default of `fontconvert.py --metrics-class`.
+ */
+#define SDF_METRICS_CLASS "0123456789:"
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static inline int32_t min(int32_t x, int32_t y)
+{
+    return x < y ? x : y;
+}
+
+/**
+ * @brief Convert 1/64 texels to pixels at a 16.16 scale, rounding down.
+ */
+static inline int32_t floor_pixels(int32_t value, uint32_t scale);
+
+/**
+ * @brief Convert 1/64 texels to pixels at a 16.16 scale, rounding up.
+ */
+static inline int32_t ceil_pixels(int32_t value, uint32_t scale);
+
+/**
+ * @brief Set the layout metrics of an instance font from its glyph boxes.
+ */
+static void compute_metrics(SdfInstance *instance);
+
+static inline int32_t clamp(int32_t x, int32_t low, int32_t high)
+{
+    return x < low ? low : (x > high ? high : x);
+}
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+bool sdf_instance_init(SdfInstance *instance, const SdfFont *sdf, uint16_t size)
+{
+    memset(instance, 0, sizeof(SdfInstance));
+    for (uint32_t i = 0; i < sdf->interval_count; i++)
+    {
+        instance->glyph_count += sdf->intervals[i].last - sdf->intervals[i].first + 1;
+    }
+    if (instance->glyph_count == 0)
+    {
+        ESP_LOGE("sdf_font.c", "font has no glyphs!");
+        return false;
+    }
+    instance->glyphs = (GFXglyph *)malloc(instance->glyph_count * sizeof(GFXglyph));
+    if (!instance->glyphs)
+    {
+        ESP_LOGE("sdf_font.c", "cannot allocate glyph table!");
+        return false;
+    }
+    instance->sdf = sdf;
+    instance->scale = ((uint32_t)size << 16) / sdf->size;
+
+    uint32_t scale = instance->scale;
+    for (uint32_t i = 0; i < instance->glyph_count; i++)
+    {
+        const SdfGlyph *src = &sdf->glyph[i];
+        GFXglyph *glyph = &instance->glyphs[i];
+        int32_t left = floor_pixels(src->left, scale);
+        int32_t top = ceil_pixels(src->top, scale);
+        int32_t width = src->width ? ceil_pixels(src->right, scale) - left : 0;
+        int32_t height = src->height ? top - floor_pixels(src->bottom, scale) : 0;
+        int32_t advance = (int32_t)(((int64_t)src->advance_x * scale + (1 << 21)) >> 22);
+        if (width > UINT8_MAX || height > UINT8_MAX || advance > UINT8_MAX)
+        {
+            ESP_LOGE("sdf_font.c", "glyphs are too large at size %d!", size);
+            sdf_instance_release(instance);
+            return false;
+        }
+        glyph->width = width;
+        glyph->height = height;
+        glyph->advance_x = advance;
+        glyph->left = left;
+        glyph->top = top;
+        glyph->compressed_size = 0;
+        glyph->data_offset = src->data_offset;
+    }
+
+    // glyphs are rendered on demand and kept in the glyph cache like
+    // decompressed ones
+    GFXfont *font = &instance->font;
+    font->bitmap = (uint8_t *)sdf->field;
+    font->glyph = instance->glyphs;
+    font->intervals = (UnicodeInterval *)sdf->intervals;
+    font->interval_count = sdf->interval_count;
+    font->compressed = true;
+    // only multi-line text uses the line height, it is capped at large sizes
+    font->advance_y = min(ceil_pixels(sdf->advance_y, scale), UINT8_MAX);
+    font->ascender = ceil_pixels(sdf->ascender, scale);
+    font->descender = floor_pixels(sdf->descender, scale);
+    font->format = GLYPH_FORMAT_SDF;
+    compute_metrics(instance);
+    return true;
+}
+
+
+void IRAM_ATTR sdf_render_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap)
+{
+    const SdfInstance *instance = (const SdfInstance *)font;
+    const SdfFont *sdf = instance->sdf;
+    const SdfGlyph *src = &sdf->glyph[glyph - font->glyph];
+    const uint8_t *field = &sdf->field[src->data_offset];
+    int32_t byte_width = glyph->width / 2 + glyph->width % 2;
+    memset(bitmap, 0, byte_width * glyph->height);
+
+    // pixel centers are mapped to field coordinates relative to the center
+    // of the first texel, in 16.16 fixed point
+    int32_t step = ((uint64_t)1 << 32) / instance->scale;
+    int32_t field_left = (src->left >> 6) - sdf->spread;
+    int32_t field_top = ((src->top + 63) >> 6) + sdf->spread;
+    int32_t u0 = (((int64_t)(2 * glyph->left + 1) * step) >> 1) - (field_left << 16) - 0x8000;
+
+    // one texel of distance spans `scale` pixels, the 15 coverage levels
+    // ramp up over one pixel around the outline
+    int32_t gain = ((uint64_t)30 * sdf->spread * instance->scale) >> 16;
+
+    // the ink box lies `spread` texels within the field, samples rounded
+    // beyond it are clamped to the border texels, which are outside
+    for (int32_t y = 0; y < glyph->height; y++)
+    {
+        int32_t v = (((int64_t)(2 * (y - glyph->top) + 1) * step) >> 1) + (field_top << 16) - 0x8000;
+        int32_t fv = (v >> 8) & 0xFF;
+        const uint8_t *row0 = &field[clamp(v >> 16, 0, src->height - 2) * src->width];
+        const uint8_t *row1 = row0 + src->width;
+
+        uint8_t *dst = &bitmap[y * byte_width];
+        int32_t u = u0;
+        for (int32_t x = 0; x < glyph->width; x++, u += step)
+        {
+            int32_t column = clamp(u >> 16, 0, src->width - 2);
+            int32_t fu = (u >> 8) & 0xFF;
+            int32_t top = row0[column] * (256 - fu) + row0[column + 1] * fu;
+            int32_t bottom = row1[column] * (256 - fu) + row1[column + 1] * fu;
+            int32_t value = (top * (256 - fv) + bottom * fv) >> 8;
+
+            int32_t level = ((gain * (value - (SDF_EDGE_VALUE << 8))) >> 16) + 8;
+            if (level <= 0)
+            {
+                continue;
+            }
+            level = min(level, 15);
+            dst[x / 2] |= (x & 1) ? level << 4 : level;
+        }
+    }
+}
+
+
+void sdf_instance_release(SdfInstance *instance)
+{
+    for (uint32_t i = 0; instance->glyphs && i < instance->glyph_count; i++)
+    {
+        glyph_cache_remove(&instance->font, &instance->glyphs[i]);
+    }
+    free(instance->glyphs);
+    memset(instance, 0, sizeof(SdfInstance));
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static inline int32_t floor_pixels(int32_t value, uint32_t scale)
+{
+    return (int32_t)(((int64_t)value * scale) >> 22);
+}
+
+
+static inline int32_t ceil_pixels(int32_t value, uint32_t scale)
+{
+    return -floor_pixels(-value, scale);
+}
+
+
+static void compute_metrics(SdfInstance *instance)
+{
+    GFXfont *font = &instance->font;
+    FontMetrics *metrics = &font->metrics;
+    bool first_digit = true;
+    bool first_box = true;
+    for (const char *c = SDF_METRICS_CLASS; *c; c++)
+    {
+        GFXglyph *glyph;
+        get_glyph(font, *c, &glyph);
+        if (!glyph)
+        {
+            continue;
+        }
+        if (*c >= '0' && *c <= '9')
+        {
+            metrics->tabular_figures = first_digit ||
+                                       (metrics->tabular_figures &&
+                                        metrics->digit_advance == glyph->advance_x);
+            if (glyph->advance_x > metrics->digit_advance)
+            {
+                metrics->digit_advance = glyph->advance_x;
+            }
+            first_digit = false;
+        }
+        int32_t left = glyph->left;
+        int32_t right = glyph->left + glyph->width;
+        int32_t bottom = glyph->height - glyph->top;
+        if (first_box || left < metrics->box_left)
+        {
+            metrics->box_left = left;
+        }
+        if (first_box || glyph->top > metrics->box_top)
+        {
+            metrics->box_top = glyph->top;
+        }
+        if (first_box || right > metrics->box_right)
+        {
+            metrics->box_right = right;
+        }
+        if (first_box || bottom > metrics->box_bottom)
+        {
+            metrics->box_bottom = bottom;
+        }
+        first_box = false;
+    }
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
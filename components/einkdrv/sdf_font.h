@@ -0,0 +1,121 @@
+/**
+ * Fonts stored as signed distance fields, drawn at any size from one asset.
+ */
+
+#ifndef _SDF_FONT_H_
+#define _SDF_FONT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Field value on the outline of a glyph. Larger values are inside.
+ */
+#define SDF_EDGE_VALUE 128
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Glyph of an `SdfFont`. The ink box is given in 1/64 texels relative
+ *        to the cursor, with y pointing up. The field covers the ink box
+ *        widened to whole texels and by `spread` texels on every side.
+ */
+typedef struct
+{
+    uint8_t width;        /** Field dimensions in texels */
+    uint8_t height;
+    uint16_t advance_x;   /** Distance to advance cursor, in 1/64 texels */
+    int16_t left;         /** Ink box */
+    int16_t top;
+    int16_t right;
+    int16_t bottom;
+    uint32_t data_offset; /** Offset of the field into `SdfFont->field` */
+} SdfGlyph;
+
+/**
+ * @brief Font generated by `fontconvert.py --sdf`. One texel of the fields
+ *        is one pixel of the font at `size`. A texel holds
+ *        `SDF_EDGE_VALUE + distance * 128 / spread`, clamped to a byte, with
+ *        the distance to the outline in texels, positive inside. Vertical
+ *        metrics are given in 1/64 texels.
+ */
+typedef struct
+{
+    const uint8_t *field;             /** Distance fields, one byte per texel */
+    const SdfGlyph *glyph;
+    const UnicodeInterval *intervals;
+    uint32_t interval_count;
+    uint16_t size;                    /** Font size the fields were sampled at */
+    uint8_t spread;                   /** Distance in texels at which the field saturates */
+    int32_t advance_y;
+    int32_t ascender;
+    int32_t descender;
+} SdfFont;
+
+/**
+ * @brief An `SdfFont` at one size. `font` is drawn like any other font; its
+ *        glyphs are rendered from the fields when they are missing from the
+ *        glyph cache.
+ */
+typedef struct
+{
+    GFXfont font;       /** Must stay the first member, glyphs find the instance through it */
+    const SdfFont *sdf;
+    GFXglyph *glyphs;   /** Glyph boxes at the instance size */
+    uint32_t glyph_count;
+    uint32_t scale;     /** Pixels per texel, 16.16 fixed point */
+} SdfInstance;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Set up a font of `size`, in the units `fontconvert.py` takes, and
+ *        compute its glyph boxes and layout metrics.
+ *
+ * @return false if the font has no glyphs, if out of memory or if glyphs
+ *         do not fit the `GFXglyph` limits of 255 pixels at this size.
+ */
+bool sdf_instance_init(SdfInstance *instance, const SdfFont *sdf, uint16_t size);
+
+/**
+ * @brief Render a glyph of an instance font into a 4bpp bitmap of the glyph
+ *        size, sampling the field bilinearly in fixed point.
+ */
+void sdf_render_glyph(const GFXfont *font, const GFXglyph *glyph, uint8_t *bitmap);
+
+/**
+ * @brief Free the glyph table of an instance and drop its glyphs from the
+ *        glyph cache.
+ */
+void sdf_instance_release(SdfInstance *instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
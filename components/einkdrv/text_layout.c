@@ -0,0 +1,262 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "text_layout.h"
+#include "utf8.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static inline int32_t max(int32_t x, int32_t y)
+{
+    return x > y ? x : y;
+}
+
+/**
+ * @brief Cursor movement of a code point, with the fallback glyph if the
+ *        font has no glyph for it.
+ */
+static int32_t glyph_advance(const GFXfont *font, uint32_t code_point,
+                             const FontProperties *props);
+
+/**
+ * @brief Find the end of the line starting at `start`, at a newline, at
+ *        the last space fitting `width` or at the last code point fitting it.
+ *
+ * @param advance Set to the cursor movement over the line.
+ * @param next    Set to the start of the next line, NULL at the end of the
+ *                string.
+ * @param wrapped Set if the line was broken to fit the width.
+ * @return The end of the line, without trailing spaces.
+ */
+static const char *break_line(const GFXfont *font, const char *start, int32_t width,
+                              const FontProperties *props, int32_t *advance,
+                              const char **next, bool *wrapped);
+
+/**
+ * @brief Find the end of the longest part of the line starting at `start`
+ *        which fits `width`, without trailing spaces.
+ */
+static const char *fit_line(const GFXfont *font, const char *start, int32_t width,
+                            const FontProperties *props, int32_t *advance);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+bool text_layout_init(TextLayout *layout, const GFXfont *font, const char *string,
+                      const TextLayoutOptions *options, const FontProperties *props,
+                      TextLine *lines, uint32_t line_capacity)
+{
+    memset(layout, 0, sizeof(TextLayout));
+    layout->font = font;
+    // the defaults of font.c
+    layout->props = props ? *props : (FontProperties){.fg_color = 0, .bg_color = 15};
+    layout->ellipsis = options->ellipsis;
+    layout->lines = lines;
+
+    uint32_t max_lines = line_capacity;
+    if (options->max_lines && options->max_lines < max_lines)
+    {
+        max_lines = options->max_lines;
+    }
+    int32_t ellipsis_advance = 0;
+    for (const char *s = options->ellipsis; s && *s;)
+    {
+        ellipsis_advance += glyph_advance(font, utf8_next(&s), &layout->props);
+    }
+
+    const char *start = *string ? string : NULL;
+    bool complete = true;
+    int32_t widest = 0;
+    while (start)
+    {
+        if (layout->line_count == max_lines)
+        {
+            complete = false;
+            break;
+        }
+        TextLine *line = &lines[layout->line_count++];
+        memset(line, 0, sizeof(TextLine));
+        const char *next;
+        bool wrapped;
+        const char *end = break_line(font, start, options->width, &layout->props,
+                                     &line->advance, &next, &wrapped);
+
+        // the last line makes room for the ellipsis if more text follows
+        if (next && layout->line_count == max_lines && options->ellipsis)
+        {
+            int32_t width = options->width ? max(0, options->width - ellipsis_advance) : 0;
+            end = fit_line(font, start, width, &layout->props, &line->advance);
+            line->advance += ellipsis_advance;
+            line->ellipsis = true;
+        }
+        line->start = start;
+        line->length = end - start;
+        widest = max(widest, line->advance);
+
+        // a wrapped line continues after the spaces it was broken at
+        while (wrapped && next && *next == ' ')
+        {
+            next++;
+        }
+        start = next;
+    }
+
+    int32_t line_height = font->advance_y + options->line_spacing;
+    layout->width = options->width ? options->width : widest;
+    layout->height = layout->line_count * line_height;
+    for (uint32_t i = 0; i < layout->line_count; i++)
+    {
+        TextLine *line = &lines[i];
+        int32_t space = layout->width - line->advance;
+        line->x = options->align == TEXT_ALIGN_CENTER ? space / 2
+                  : options->align == TEXT_ALIGN_RIGHT ? space : 0;
+        line->y = i * line_height;
+    }
+    return complete;
+}
+
+
+size_t text_layout_scratch_size(const GFXfont *font)
+{
+    if (!font->compressed && (!font->bit_depth || font->bit_depth == 4))
+    {
+        return 0;
+    }
+    size_t size = 0;
+    for (uint32_t i = 0; i < font->interval_count; i++)
+    {
+        const UnicodeInterval *interval = &font->intervals[i];
+        for (uint32_t j = 0; j <= interval->last - interval->first; j++)
+        {
+            const GFXglyph *glyph = &font->glyph[interval->offset + j];
+            size_t bitmap_size = (glyph->width / 2 + glyph->width % 2) * glyph->height;
+            size = bitmap_size > size ? bitmap_size : size;
+        }
+    }
+    if (font->compressed && font->format == GLYPH_FORMAT_RAW_DEFLATE && font->dictionary)
+    {
+        size += TEXT_LAYOUT_WINDOW_SIZE;
+    }
+    return size;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static int32_t glyph_advance(const GFXfont *font, uint32_t code_point,
+                             const FontProperties *props)
+{
+    GFXglyph *glyph;
+    get_glyph(font, code_point, &glyph);
+    if (!glyph)
+    {
+        get_glyph(font, props->fallback_glyph, &glyph);
+    }
+    return glyph ? glyph->advance_x : 0;
+}
+
+
+static const char *break_line(const GFXfont *font, const char *start, int32_t width,
+                              const FontProperties *props, int32_t *advance,
+                              const char **next, bool *wrapped)
+{
+    const char *s = start;
+    const char *end = start;
+    const char *break_end = start;
+    const char *break_next = NULL;
+    int32_t x = 0;
+    int32_t break_advance = 0;
+    *advance = 0;
+    *wrapped = true;
+
+    while (*s && *s != '\n')
+    {
+        const char *character = s;
+        uint32_t c = utf8_next(&s);
+        int32_t glyph_x = x + glyph_advance(font, c, props);
+        if (c == ' ')
+        {
+            // a line can be broken before the space, if it has text
+            if (end > start)
+            {
+                break_end = end;
+                break_advance = *advance;
+                break_next = s;
+            }
+            x = glyph_x;
+            continue;
+        }
+
+        // every line gets at least one code point, however narrow the width
+        if (width > 0 && glyph_x > width && end > start)
+        {
+            if (break_next)
+            {
+                *advance = break_advance;
+                *next = break_next;
+                return break_end;
+            }
+            *next = character;
+            return end;
+        }
+        x = glyph_x;
+        end = s;
+        *advance = x;
+    }
+    // a trailing newline ends the text rather than starting an empty line
+    *next = *s == '\n' && s[1] ? s + 1 : NULL;
+    *wrapped = false;
+    return end;
+}
+
+
+static const char *fit_line(const GFXfont *font, const char *start, int32_t width,
+                            const FontProperties *props, int32_t *advance)
+{
+    const char *s = start;
+    const char *end = start;
+    int32_t x = 0;
+    *advance = 0;
+    while (*s && *s != '\n')
+    {
+        uint32_t c = utf8_next(&s);
+        x += glyph_advance(font, c, props);
+        if (width > 0 && x > width)
+        {
+            break;
+        }
+        if (c != ' ')
+        {
+            end = s;
+            *advance = x;
+        }
+    }
+    return end;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,138 @@
+/**
+ * Multi-line text laid out and drawn without heap allocations.
+ */
+
+#ifndef _TEXT_LAYOUT_H_
+#define _TEXT_LAYOUT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Scratch bytes `text_layout_write` takes for the sliding window when
+ *        decoding glyphs of a font with a preset dictionary.
+ */
+#define TEXT_LAYOUT_WINDOW_SIZE (32 * 1024)
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Horizontal alignment of the lines within the layout box.
+ */
+typedef enum
+{
+    TEXT_ALIGN_LEFT = 0,
+    TEXT_ALIGN_CENTER = 1,
+    TEXT_ALIGN_RIGHT = 2,
+} TextAlign;
+
+/**
+ * @brief How a string is broken into lines. All 0 breaks at newlines only.
+ */
+typedef struct
+{
+    int32_t width;        /** Wrap lines to this width, 0 to break at newlines only */
+    uint32_t max_lines;   /** Cut the text off after this many lines, 0 for no limit */
+    TextAlign align;
+    int32_t line_spacing; /** Pixels added to the `advance_y` of the font between base lines */
+    const char *ellipsis; /** Ends the last line if the text is cut off, NULL for none */
+} TextLayoutOptions;
+
+/**
+ * @brief A line of a layout, pointing into the laid out string.
+ */
+typedef struct
+{
+    const char *start;
+    uint32_t length;  /** Bytes of the line, without the break and trailing spaces */
+    int32_t x;        /** Cursor position of the line relative to the layout */
+    int32_t y;        /** Base line relative to the first base line */
+    int32_t advance;  /** Cursor movement over the line, including the ellipsis */
+    bool ellipsis;    /** Draw the ellipsis after the line */
+} TextLine;
+
+/**
+ * @brief A string broken into lines held in caller memory. The string and
+ *        the lines must outlive the layout.
+ */
+typedef struct
+{
+    const GFXfont *font;
+    FontProperties props;
+    const char *ellipsis;
+    TextLine *lines;
+    uint32_t line_count;
+    int32_t width;    /** Width of the box the lines are aligned in */
+    int32_t height;   /** `line_count` times the line height */
+} TextLayout;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Break a string into at most `line_capacity` lines.
+ *
+ * Lines are broken at newlines and, if a width is set, at the last space
+ * before the width is exceeded, or within a word that does not fit a line on
+ * its own. Spaces at a line break and a trailing newline are dropped. If
+ * the string does not fit the lines, the last line is shortened to fit the
+ * ellipsis.
+ *
+ * Set font properties to NULL to use the defaults.
+ *
+ * @return false if the string was cut off.
+ */
+bool text_layout_init(TextLayout *layout, const GFXfont *font, const char *string,
+                      const TextLayoutOptions *options, const FontProperties *props,
+                      TextLine *lines, uint32_t line_capacity);
+
+/**
+ * @brief Size of a scratch buffer that can hold the decoded bitmap of every
+ *        glyph of a font, plus `TEXT_LAYOUT_WINDOW_SIZE` for fonts with a
+ *        preset dictionary, 0 for uncompressed fonts.
+ */
+size_t text_layout_scratch_size(const GFXfont *font);
+
+/**
+ * @brief Write a layout to a framebuffer, with the left edge of its box at
+ *        `x` and the first base line at `y`.
+ *
+ * Glyphs missing from the glyph cache are decoded into `scratch`, which
+ * should be `text_layout_scratch_size` bytes large; no memory is allocated,
+ * the sliding window of fonts with a preset dictionary is taken from the
+ * scratch as well. Glyphs that do not fit the scratch are skipped. `DRAW_BACKGROUND` is not
+ * applied.
+ */
+void text_layout_write(const TextLayout *layout, int32_t x, int32_t y,
+                       uint8_t *framebuffer, uint8_t *scratch, size_t scratch_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,144 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "utf8.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief The high bit of every byte of a machine word.
+ */
+#define WORD_HIGH_BITS ((size_t)-1 / 0xFF * 0x80)
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Decoding of a sequence by its lead byte. The second byte is
+ *        restricted to rule out overlong forms, surrogates and code points
+ *        beyond U+10FFFF; all further bytes are plain continuation bytes.
+ */
+typedef struct
+{
+    uint8_t length; /* 0 for bytes which cannot start a sequence */
+    uint8_t low;    /* range of the second byte */
+    uint8_t high;
+} LeadByte;
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+/**
+ * @brief Decode the sequence starting with a non-ASCII byte at `*s`, from at
+ *        most `available` bytes.
+ */
+static inline uint32_t decode_sequence(const uint8_t **s, size_t available);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/**
+ * @brief Lead bytes 0x80 to 0xFF, following table 3-7 of the Unicode
+ *        standard. Continuation bytes, 0xC0, 0xC1 and 0xF5 up are invalid.
+ */
+static const LeadByte lead_bytes[128] = {
+    [0xC2 - 0x80 ... 0xDF - 0x80] = {2, 0x80, 0xBF},
+    [0xE0 - 0x80]                 = {3, 0xA0, 0xBF},
+    [0xE1 - 0x80 ... 0xEC - 0x80] = {3, 0x80, 0xBF},
+    [0xED - 0x80]                 = {3, 0x80, 0x9F},
+    [0xEE - 0x80 ... 0xEF - 0x80] = {3, 0x80, 0xBF},
+    [0xF0 - 0x80]                 = {4, 0x90, 0xBF},
+    [0xF1 - 0x80 ... 0xF3 - 0x80] = {4, 0x80, 0xBF},
+    [0xF4 - 0x80]                 = {4, 0x80, 0x8F},
+};
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+uint32_t utf8_decode_sequence(const char *string, uint32_t *length)
+{
+    // the terminator fails every continuation byte check, so the sequence
+    // is never read past it
+    const uint8_t *s = (const uint8_t *)string;
+    uint32_t code_point = decode_sequence(&s, SIZE_MAX);
+    *length = (const char *)s - string;
+    return code_point;
+}
+
+
+uint32_t utf8_decode(const char **string, const char *end, uint32_t *code_points,
+                     uint32_t count)
+{
+    const uint8_t *s = (const uint8_t *)*string;
+    const uint8_t *e = (const uint8_t *)end;
+    uint32_t n = 0;
+
+    while (n < count && s < e)
+    {
+        if ((size_t)(e - s) >= sizeof(size_t) && count - n >= sizeof(size_t))
+        {
+            size_t word;
+            memcpy(&word, s, sizeof(size_t));
+            if (!(word & WORD_HIGH_BITS))
+            {
+                for (uint32_t i = 0; i < sizeof(size_t); i++)
+                {
+                    code_points[n + i] = s[i];
+                }
+                n += sizeof(size_t);
+                s += sizeof(size_t);
+                continue;
+            }
+        }
+        code_points[n++] = *s < 0x80 ? *s++ : decode_sequence(&s, e - s);
+    }
+    *string = (const char *)s;
+    return n;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static inline uint32_t decode_sequence(const uint8_t **s, size_t available)
+{
+    const uint8_t *p = *s;
+    const LeadByte *lead = &lead_bytes[p[0] - 0x80];
+    if (lead->length == 0 || available < 2 || p[1] < lead->low || p[1] > lead->high)
+    {
+        *s = p + 1;
+        return UTF8_REPLACEMENT_CHARACTER;
+    }
+
+    uint32_t code_point = ((p[0] & (0x7F >> lead->length)) << 6) | (p[1] & 0x3F);
+    for (uint32_t i = 2; i < lead->length; i++)
+    {
+        if (i >= available || (p[i] & 0xC0) != 0x80)
+        {
+            *s = p + i;
+            return UTF8_REPLACEMENT_CHARACTER;
+        }
+        code_point = (code_point << 6) | (p[i] & 0x3F);
+    }
+    *s = p + lead->length;
+    return code_point;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,90 @@
+/**
+ * Validating UTF-8 decoder for drawn text.
+ */
+
+#ifndef _UTF8_H_
+#define _UTF8_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Code point decoded in place of malformed input.
+ */
+#define UTF8_REPLACEMENT_CHARACTER 0xFFFD
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Decode the multi-byte sequence at `string` for `utf8_next`.
+ *
+ * @param length Set to the number of bytes decoded.
+ */
+uint32_t utf8_decode_sequence(const char *string, uint32_t *length);
+
+/**
+ * @brief Decode the next code point of a zero terminated string and advance
+ *        the string past it.
+ *
+ * Overlong forms, surrogates, code points beyond U+10FFFF, stray continuation
+ * bytes and sequences cut short decode as one `UTF8_REPLACEMENT_CHARACTER`
+ * per maximal invalid subpart, as recommended by the Unicode standard.
+ * Decoding resumes at the first byte not belonging to it, so the terminator
+ * is never skipped.
+ *
+ * @return The code point, 0 at the end of the string.
+ */
+static inline uint32_t utf8_next(const char **string)
+{
+    uint8_t c = (uint8_t)**string;
+    if (c < 0x80)
+    {
+        // the terminator is not consumed
+        *string += c != 0;
+        return c;
+    }
+    uint32_t length;
+    uint32_t code_point = utf8_decode_sequence(*string, &length);
+    *string += length;
+    return code_point;
+}
+
+/**
+ * @brief Decode up to `count` code points of the bytes from `*string` to
+ *        `end` like `utf8_next`, advancing the string past them. Runs of
+ *        ASCII characters are decoded a machine word at a time.
+ *
+ * @return The number of code points decoded, less than `count` only at `end`.
+ */
+uint32_t utf8_decode(const char **string, const char *end, uint32_t *code_points,
+                     uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -1,19 +1,82 @@
 #include "display.h"
+#include <epd_diff.h>
 #include <epd_driver.h>
+#include <glyph_atlas.h>
+#include <glyph_cache.h>
 #include <Quicksand_140.h>
 #include <Quicksand_28.h>
 #include <Quicksand_18.h>
 #include <batt_icon.h>
+#include <esp_app_desc.h>
 #include <esp_log.h>
+#include <esp_partition.h>
+#include <esp_timer.h>
 #include <stdlib.h>
 #include <string.h>
 #include <esp_heap_caps.h>
 
 #define TAG "display"
 
-// Global framebuffer
+#define FB_SIZE (EPD_WIDTH / 2 * EPD_HEIGHT)
+
+// Orientation of the clock face on the panel. Rotation is applied while
+// drawing, the layers and the framebuffer always stay in panel layout.
+#define DISPLAY_ROTATION EPD_ROT_LANDSCAPE
+#define DISPLAY_MIRROR   false
+
+// Data partition keeping the pre-rendered clock digits over deep sleep
+#define TIME_ATLAS_PARTITION "atlas"
+
+// Data partition keeping the static layer over deep sleep
+#define STATIC_LAYER_PARTITION "layers"
+#define STATIC_LAYER_MAGIC     0x5259414c // "LAYR"
+
+// Most areas a partial refresh clears, the surplus is merged into the last one
+#define MAX_DIRTY_RECTS 8
+
+// Header in front of the static layer in its partition
+typedef struct {
+    uint32_t magic;
+    uint32_t key;
+} StoredLayerHeader;
+
+// Global framebuffer, composed from the layers below before every refresh
 static uint8_t *framebuffer = NULL;
 
+// Static layer: date, timezone line and battery icon, which change at most
+// once a day. Dynamic layer: the time, only its area is kept up to date.
+// White (0xF) is transparent in the dynamic layer.
+static uint8_t *static_layer  = NULL;
+static uint8_t *dynamic_layer = NULL;
+static Rect_t dynamic_area;
+
+// Static layer stored in flash, mapped read-only while it is in use
+static const StoredLayerHeader *stored_layer = NULL;
+static esp_partition_mmap_handle_t stored_layer_handle;
+
+// Key of the static layer and position and string of the time currently shown
+// on the panel, kept over deep sleep. A key of 0 means the panel content is
+// unknown.
+RTC_DATA_ATTR static uint32_t panel_static_hash = 0;
+RTC_DATA_ATTR static char panel_time[8];
+RTC_DATA_ATTR static int32_t panel_time_x;
+RTC_DATA_ATTR static int32_t panel_time_y;
+
+// Clock digits blended to their final colors, copied row by row
+static GlyphAtlas time_atlas;
+static bool time_atlas_ready = false;
+
+// Shaped strings: the time changes on every call, the others are kept with
+// the hash of the string they were shaped from
+static TextRun time_run;
+static TextRun panel_time_run;
+static TextRun widest_time_run;
+static TextRun date_run;
+static TextRun timezone_run;
+static uint32_t widest_time_hash  = 0;
+static uint32_t date_run_hash     = 0;
+static uint32_t timezone_run_hash = 0;
+
 // Font properties for all text rendering
 static const FontProperties font_props = {
     .fg_color       = 15,
@@ -22,24 +85,244 @@ static const FontProperties font_props = {
     .flags          = 0,
 };
 
+static uint8_t *
+alloc_layer(uint8_t *layer, const char *name)
+{
+    // Each pixel is 4 bits (half byte)
+    if (layer == NULL) {
+        layer = heap_caps_malloc(FB_SIZE, MALLOC_CAP_SPIRAM);
+    }
+    if (layer == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %s (%d bytes)", name, FB_SIZE);
+    }
+    return layer;
+}
+
+static inline int32_t
+clamp(int32_t v, int32_t lo, int32_t hi)
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// Fill an area of a layer in panel coordinates, rounded out to whole bytes
+// (2 pixels)
+static void
+layer_fill(uint8_t *layer, Rect_t area, uint8_t value)
+{
+    int32_t x0 = clamp(area.x, 0, EPD_WIDTH) / 2;
+    int32_t x1 = (clamp(area.x + area.width, 0, EPD_WIDTH) + 1) / 2;
+    int32_t y0 = clamp(area.y, 0, EPD_HEIGHT);
+    int32_t y1 = clamp(area.y + area.height, 0, EPD_HEIGHT);
+
+    for (int32_t y = y0; y < y1 && x1 > x0; y++) {
+        memset(&layer[y * EPD_WIDTH / 2 + x0], value, x1 - x0);
+    }
+}
+
+// Overlay 8 pixels of `above` onto `below`: every nibble of `above` which is
+// not white replaces the one below it.
+static inline uint32_t
+overlay_blend(uint32_t below, uint32_t above)
+{
+    uint32_t ink  = ~above;
+    uint32_t mask = (((ink & 0x77777777) + 0x77777777) | ink) & 0x88888888;
+    mask          = (mask >> 3) * 0xF;
+    return (below & ~mask) | (above & mask);
+}
+
+// Round an area out to whole 32 bit words (8 pixels) and clip it to the panel
+static Rect_t
+align_to_words(Rect_t area)
+{
+    int32_t x0 = clamp(area.x, 0, EPD_WIDTH) & ~7;
+    int32_t x1 = (clamp(area.x + area.width, 0, EPD_WIDTH) + 7) & ~7;
+    int32_t y0 = clamp(area.y, 0, EPD_HEIGHT);
+    int32_t y1 = clamp(area.y + area.height, 0, EPD_HEIGHT);
+    return (Rect_t){ .x = x0, .y = y0, .width = x1 - x0, .height = y1 - y0 };
+}
+
+// Compose the static and the dynamic layer into a word aligned area of the
+// framebuffer: the static layer is copied, then the ink of the dynamic layer
+// is blended on top where the area overlaps the dynamic area.
+static void
+compose_area(const uint8_t *below_layer, Rect_t area)
+{
+    int32_t w0 = area.x / 8;
+    int32_t w1 = (area.x + area.width) / 8;
+    int32_t d0 = dynamic_area.x / 8 > w0 ? dynamic_area.x / 8 : w0;
+    int32_t d1 = (dynamic_area.x + dynamic_area.width) / 8 < w1
+                     ? (dynamic_area.x + dynamic_area.width) / 8 : w1;
+
+    for (int32_t y = area.y; y < area.y + area.height; y++) {
+        const uint32_t *below = (const uint32_t *)&below_layer[y * EPD_WIDTH / 2];
+        const uint32_t *above = (const uint32_t *)&dynamic_layer[y * EPD_WIDTH / 2];
+        uint32_t *out         = (uint32_t *)&framebuffer[y * EPD_WIDTH / 2];
+        memcpy(&out[w0], &below[w0], (w1 - w0) * sizeof(uint32_t));
+        if (y < dynamic_area.y || y >= dynamic_area.y + dynamic_area.height) {
+            continue;
+        }
+        for (int32_t w = d0; w < d1; w++) {
+            if (above[w] != 0xFFFFFFFF) {
+                out[w] = overlay_blend(out[w], above[w]);
+            }
+        }
+    }
+}
+
+static uint32_t
+hash_str(uint32_t hash, const char *str)
+{
+    // FNV-1a
+    for (; *str; str++) {
+        hash = (hash ^ (uint8_t)*str) * 16777619u;
+    }
+    return hash;
+}
+
+// Shape a string unless the run already holds it
+static const TextRun *
+shape_cached(TextRun *run, uint32_t *hash, const GFXfont *font, const char *str)
+{
+    uint32_t str_hash = hash_str(2166136261u, str);
+    if (str_hash != *hash || run->font != font) {
+        text_run_shape(run, font, str, NULL);
+        *hash = str_hash;
+    }
+    return run;
+}
+
+// Largest box any "HH:MM" time can cover, from the font metrics. Fonts
+// without metrics fall back to measuring a string of wide digits.
+static void
+get_max_time_bounds(int32_t *width, int32_t *height)
+{
+    const FontMetrics *metrics = &Quicksand_140.metrics;
+    GFXglyph *colon;
+    get_glyph(&Quicksand_140, ':', &colon);
+
+    if (metrics->digit_advance == 0 || colon == NULL) {
+        shape_cached(&widest_time_run, &widest_time_hash, &Quicksand_140, "88:88");
+        *width  = widest_time_run.w;
+        *height = widest_time_run.h;
+        return;
+    }
+    // Three digits and the colon advance the cursor, the last glyph may
+    // reach beyond its advance
+    int32_t left = metrics->box_left < 0 ? metrics->box_left : 0;
+    *width  = 3 * metrics->digit_advance + colon->advance_x + metrics->box_right - left;
+    *height = metrics->box_top + metrics->box_bottom;
+}
+
+static int32_t
+draw_time_run(const char *time_str, const TextRun *run, int32_t x, int32_t y, uint8_t *layer)
+{
+    int32_t original_x = x;
+    if (!time_atlas_ready || !glyph_atlas_write(&time_atlas, time_str, &x, y, layer)) {
+        text_run_write(run, &x, &y, layer, BLACK_ON_WHITE);
+    }
+    return x - original_x;
+}
+
+// Map the static layer stored in flash, NULL if there is none
+static const StoredLayerHeader *
+map_stored_layer(void)
+{
+    const esp_partition_t *partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, STATIC_LAYER_PARTITION);
+    if (partition == NULL || partition->size < sizeof(StoredLayerHeader) + FB_SIZE) {
+        return NULL;
+    }
+
+    const void *image;
+    if (esp_partition_mmap(partition, 0, sizeof(StoredLayerHeader) + FB_SIZE,
+                           ESP_PARTITION_MMAP_DATA, &image, &stored_layer_handle) != ESP_OK) {
+        return NULL;
+    }
+    const StoredLayerHeader *header = image;
+    if (header->magic != STATIC_LAYER_MAGIC) {
+        esp_partition_munmap(stored_layer_handle);
+        return NULL;
+    }
+    return header;
+}
+
+static void
+unmap_stored_layer(void)
+{
+    if (stored_layer != NULL) {
+        esp_partition_munmap(stored_layer_handle);
+        stored_layer = NULL;
+    }
+}
+
+// Replace the static layer stored in flash. The header is written last, so an
+// interrupted write leaves no valid layer behind.
+static void
+store_static_layer(uint32_t key)
+{
+    const esp_partition_t *partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, STATIC_LAYER_PARTITION);
+    if (partition == NULL || partition->size < sizeof(StoredLayerHeader) + FB_SIZE) {
+        return;
+    }
+
+    unmap_stored_layer();
+    StoredLayerHeader header = { .magic = STATIC_LAYER_MAGIC, .key = key };
+    size_t erase_size = (sizeof(StoredLayerHeader) + FB_SIZE + partition->erase_size - 1) /
+                        partition->erase_size * partition->erase_size;
+    if (esp_partition_erase_range(partition, 0, erase_size) != ESP_OK ||
+        esp_partition_write(partition, sizeof(StoredLayerHeader), static_layer, FB_SIZE) != ESP_OK ||
+        esp_partition_write(partition, 0, &header, sizeof(StoredLayerHeader)) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to store static layer in partition %s", STATIC_LAYER_PARTITION);
+    }
+}
+
+// Key of the static layer: its inputs and the firmware, which holds the fonts
+// and the layout it is rendered with
+static uint32_t
+static_layer_key(const char *date_str, const char *timezone_str, bool show_battery_icon)
+{
+    const esp_app_desc_t *app = esp_app_get_description();
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(app->app_elf_sha256); i++) {
+        hash = (hash ^ app->app_elf_sha256[i]) * 16777619u;
+    }
+    hash = hash_str(hash_str(hash, date_str), timezone_str != NULL ? timezone_str : "");
+    hash = (hash ^ show_battery_icon) * 16777619u;
+    return hash != 0 ? hash : 1;
+}
+
 void
 display_init(void)
 {
     epd_init();
-    
-    // Allocate framebuffer: EPD_WIDTH / 2 * EPD_HEIGHT bytes
-    // Each pixel is 4 bits (half byte)
-    size_t fb_size = EPD_WIDTH / 2 * EPD_HEIGHT;
-    framebuffer = heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM);
-    if (framebuffer == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate framebuffer (%d bytes)", fb_size);
+    epd_set_rotation(DISPLAY_ROTATION, DISPLAY_MIRROR);
+
+    framebuffer   = alloc_layer(framebuffer, "framebuffer");
+    static_layer  = alloc_layer(static_layer, "static layer");
+    dynamic_layer = alloc_layer(dynamic_layer, "dynamic layer");
+    if (framebuffer == NULL || static_layer == NULL || dynamic_layer == NULL) {
         return;
     }
-    
-    // Clear framebuffer
-    memset(framebuffer, 0xFF, fb_size);
-    
-    ESP_LOGI(TAG, "Display initialized with framebuffer (%d bytes)", fb_size);
+
+    // The layers are cleared where they are drawn to
+    memset(framebuffer, 0xFF, FB_SIZE);
+    dynamic_area = (Rect_t){ 0 };
+
+    // Every wake starts from scratch, like after a reset: only the RTC
+    // variables and the flash partitions are kept
+    unmap_stored_layer();
+    widest_time_hash  = 0;
+    date_run_hash     = 0;
+    timezone_run_hash = 0;
+
+    // Rendered on first boot only, later wakes map it from flash
+    if (!time_atlas_ready) {
+        time_atlas_ready = glyph_atlas_init(&time_atlas, &Quicksand_140, GLYPH_CACHE_DIGITS,
+                                            NULL, TIME_ATLAS_PARTITION);
+    }
+
+    ESP_LOGI(TAG, "Display initialized with framebuffer and layers (3 x %d bytes)", FB_SIZE);
 }
 
 void
@@ -93,9 +376,8 @@ display_get_timezone_bounds(const char *timezone_str, int32_t *width,
 int32_t
 display_draw_time(const char *time_str, int32_t x, int32_t y)
 {
-    int32_t original_x = x;
-    writeln((GFXfont *)&Quicksand_140, time_str, &x, &y, framebuffer);
-    return x - original_x;
+    text_run_shape(&time_run, &Quicksand_140, time_str, NULL);
+    return draw_time_run(time_str, &time_run, x, y, framebuffer);
 }
 
 int32_t
@@ -119,109 +401,189 @@ display_draw_time_and_date(const char *time_str, const char *date_str,
                            const char *timezone_str, bool full_clear,
                            bool show_battery_icon)
 {
-    // Cached maximum possible time width for clearing partial refresh area.
-    // We use a representative widest string composed of the widest digit glyphs.
-    int32_t max_time_w = 0;
-    int32_t max_time_h = 0;
-    static const char *WIDEST_TIME_STR = "88:88"; // Digits '8' typically widest
-    // Get dimensions for all elements
-    int32_t time_w, time_h;
-    int32_t date_w, date_h;
-    int32_t timezone_w = 0, timezone_h = 0;
-
-    display_get_time_bounds(time_str, &time_w, &time_h);
-    display_get_date_bounds(date_str, &date_w, &date_h);
+    int64_t start_us = esp_timer_get_time();
+    int32_t canvas_w = epd_rotated_display_width();
+    int32_t canvas_h = epd_rotated_display_height();
 
+    // Every string is shaped once and measured and drawn from its run
+    text_run_shape(&time_run, &Quicksand_140, time_str, NULL);
+    shape_cached(&date_run, &date_run_hash, &Quicksand_28, date_str);
     if (timezone_str != NULL) {
-        display_get_timezone_bounds(timezone_str, &timezone_w, &timezone_h);
+        shape_cached(&timezone_run, &timezone_run_hash, &Quicksand_18, timezone_str);
     }
 
+    // Get dimensions for all elements
+    int32_t time_w     = time_run.w;
+    int32_t date_w     = date_run.w, date_h = date_run.h;
+    int32_t timezone_w = timezone_str != NULL ? timezone_run.w : 0;
+    int32_t timezone_h = timezone_str != NULL ? timezone_run.h : 0;
+
+    // Maximum possible time box for clearing the partial refresh area
+    int32_t max_time_w, max_time_h;
+    get_max_time_bounds(&max_time_w, &max_time_h);
+    ESP_LOGI(TAG, "Computed max time bounds: w=%d h=%d", max_time_w, max_time_h);
+
     // Calculate vertical spacing and layout
     const int32_t time_to_date_spacing     = 60;
     const int32_t date_to_timezone_spacing = 30;
 
-    int32_t total_h = time_h + time_to_date_spacing + date_h;
+    // The layout uses the maximum time height, so the date line does not
+    // move with the digits being displayed.
+    int32_t total_h = max_time_h + time_to_date_spacing + date_h;
     if (timezone_str != NULL) {
         total_h += date_to_timezone_spacing + timezone_h;
     }
 
     // Calculate Y positions (baseline positions)
-    int32_t time_y     = (EPD_HEIGHT - total_h) / 2 + time_h;
+    int32_t time_y     = (canvas_h - total_h) / 2 + max_time_h;
     int32_t date_y     = time_y + time_to_date_spacing + date_h;
     int32_t timezone_y = date_y + date_to_timezone_spacing + timezone_h;
 
     // Calculate X positions (centered)
-    int32_t time_x     = (EPD_WIDTH - time_w) / 2;
-    int32_t date_x     = (EPD_WIDTH - date_w) / 2;
-    int32_t timezone_x = (EPD_WIDTH - timezone_w) / 2;
-
-    display_get_time_bounds(WIDEST_TIME_STR, &max_time_w, &max_time_h);
-    ESP_LOGI(TAG, "Computed max time bounds: w=%d h=%d for '%s'", max_time_w, max_time_h, WIDEST_TIME_STR);
+    int32_t time_x     = (canvas_w - time_w) / 2;
+    int32_t date_x     = (canvas_w - date_w) / 2;
+    int32_t timezone_x = (canvas_w - timezone_w) / 2;
+
+    // Area any time can cover, around the centered widest time string
+    int32_t max_time_x = (canvas_w - max_time_w) / 2;
+    Rect_t time_area = {
+        .x      = max_time_x - 40,
+        .y      = time_y - max_time_h - 20,
+        .width  = max_time_w + 80,
+        .height = max_time_h + 40,
+    };
 
-    if (full_clear) {
-        // Full screen refresh
-        ESP_LOGI(TAG, "Full screen refresh");
-        
-        // Clear framebuffer
-        memset(framebuffer, 0xFF, EPD_WIDTH / 2 * EPD_HEIGHT);
-        
-        // Draw all elements to framebuffer
-        display_draw_time(time_str, time_x, time_y);
-        display_draw_date(date_str, date_x, date_y);
+    // The panel content is unknown after a reset or an error message, and
+    // the time moves with the number of lines below it
+    uint32_t static_hash = static_layer_key(date_str, timezone_str, show_battery_icon);
+    if ((panel_static_hash == 0 || panel_time[0] == '\0' || panel_time_y != time_y) &&
+        !full_clear) {
+        ESP_LOGI(TAG, "Panel content unknown, forcing full refresh");
+        full_clear = true;
+    }
 
+    // Changed areas of the panel, in panel coordinates like the layers
+    Rect_t dirty[MAX_DIRTY_RECTS];
+    int32_t dirty_count = 0;
+
+    // The static layer is re-rendered only if its inputs changed since it
+    // was stored, otherwise it is used straight from flash
+    stored_layer = map_stored_layer();
+    const uint8_t *static_view = static_layer;
+    bool static_rendered = false;
+    if (stored_layer != NULL && stored_layer->key == static_hash) {
+        static_view = (const uint8_t *)&stored_layer[1];
+    } else {
+        memset(static_layer, 0xFF, FB_SIZE);
+        text_run_write(&date_run, &date_x, &date_y, static_layer, BLACK_ON_WHITE);
         if (timezone_str != NULL) {
-            display_draw_timezone(timezone_str, timezone_x, timezone_y, framebuffer);
+            text_run_write(&timezone_run, &timezone_x, &timezone_y, static_layer, BLACK_ON_WHITE);
         }
+        if (show_battery_icon) {
+            display_draw_icon(&batt, 20, 20, static_layer);
+        }
+        static_rendered = true;
+    }
 
-        // Clear display and write framebuffer
-        epd_clear_area_cycles(epd_full_screen(), 2, 20);
-    } else {
-        // Partial refresh - clear a fixed maximum area for any time change to avoid ghosting
-        // Center position for widest time string
-        int32_t max_time_x = (EPD_WIDTH - max_time_w) / 2;
-
-        // Use max_time_h (should match time_h, but we rely on widest precomputed metrics)
-        Rect_t area = {
-            .x      = max_time_x - 40,
-            .y      = time_y - max_time_h - 20,
-            .width  = max_time_w + 80,
-            .height = max_time_h + 40,
-        };
+    // Changed static content is found by comparing with the stored layer
+    // shown on the panel, without it only a full refresh is safe
+    if (!full_clear && static_hash != panel_static_hash) {
+        if (stored_layer != NULL && stored_layer->key == panel_static_hash) {
+            dirty_count += epd_diff((const uint8_t *)&stored_layer[1], static_layer,
+                                    dirty, MAX_DIRTY_RECTS / 2);
+        } else {
+            ESP_LOGI(TAG, "Static content changed, forcing full refresh");
+            full_clear = true;
+        }
+    }
+    if (static_rendered) {
+        store_static_layer(static_hash);
+    }
 
-        ESP_LOGI(TAG, "Partial refresh - time only (fixed max area)");
+    // Draw new time to the dynamic layer
+    dynamic_area = align_to_words(epd_rotate_area(time_area));
+    layer_fill(dynamic_layer, dynamic_area, 0xFF);
+    draw_time_run(time_str, &time_run, time_x, time_y, dynamic_layer);
+
+    // Changed digits are found by comparing with the time shown on the panel,
+    // drawn to the framebuffer which is cleared afterwards
+    if (!full_clear) {
+        text_run_shape(&panel_time_run, &Quicksand_140, panel_time, NULL);
+        draw_time_run(panel_time, &panel_time_run, panel_time_x, panel_time_y, framebuffer);
+        dirty_count += epd_diff_area(framebuffer, dynamic_layer, dynamic_area,
+                                     &dirty[dirty_count], MAX_DIRTY_RECTS - dirty_count);
+        layer_fill(framebuffer, dynamic_area, 0xFF);
+    }
 
-        // Clear only the time area in framebuffer (rest stays from previous full draw)
-        epd_fill_rect(area.x, area.y, area.width, area.height, 0xFF, framebuffer);
+    // Areas are composed and cleared in whole 32 bit words. Everything outside
+    // them stays white in the framebuffer, so a partial refresh does not
+    // darken untouched content again.
+    for (int32_t i = 0; i < dirty_count; i++) {
+        dirty[i] = align_to_words(dirty[i]);
+    }
+    if (full_clear) {
+        compose_area(static_view, epd_full_screen());
+    }
+    for (int32_t i = 0; i < dirty_count; i++) {
+        compose_area(static_view, dirty[i]);
+    }
 
-        // Draw new time to framebuffer at absolute position
-        display_draw_time(time_str, time_x, time_y);
+    GlyphCacheStats cache_stats;
+    glyph_cache_get_stats(&cache_stats);
+    ESP_LOGI(TAG, "Rendered in %lld us (static layer %s, glyph cache %u hits / %u misses)",
+             esp_timer_get_time() - start_us, static_rendered ? "redrawn" : "stored",
+             (unsigned)cache_stats.hits, (unsigned)cache_stats.misses);
 
-        // Perform partial update cycles on that area then push new framebuffer
-        epd_clear_area_cycles(area, 1, 20);
+    if (full_clear) {
+        // Full screen refresh
+        ESP_LOGI(TAG, "Full screen refresh");
+        epd_clear_area_cycles(epd_full_screen(), 2, 20);
+        epd_draw_grayscale_image(epd_full_screen(), framebuffer);
+    } else if (dirty_count > 0) {
+        // Partial update cycles on the changed areas only
+        ESP_LOGI(TAG, "Partial refresh - %d changed areas", (int)dirty_count);
+        for (int32_t i = 0; i < dirty_count; i++) {
+            epd_clear_area_cycles(dirty[i], 1, 20);
+        }
+        epd_draw_grayscale_image(epd_full_screen(), framebuffer);
     }
+    unmap_stored_layer();
 
-    // Draw battery icon if battery is low
-    if (show_battery_icon) {
-        display_draw_icon(&batt, 20, 20, framebuffer);
+    // Leave the framebuffer white for the next update
+    if (full_clear) {
+        memset(framebuffer, 0xFF, FB_SIZE);
+    }
+    for (int32_t i = 0; i < dirty_count; i++) {
+        layer_fill(framebuffer, dirty[i], 0xFF);
     }
 
-    epd_draw_grayscale_image(epd_full_screen(), framebuffer);
+    // Remember what the panel shows for the next wake
+    panel_static_hash = static_hash;
+    panel_time_x      = time_x;
+    panel_time_y      = time_y;
+    if (strlen(time_str) < sizeof(panel_time)) {
+        strcpy(panel_time, time_str);
+    } else {
+        panel_time[0] = '\0';
+    }
 }
 
 void display_draw_error(const char *str)
 {
     ESP_LOGI(TAG, "Drawing error message: %s", str);
     
-    // Clear framebuffer
-    memset(framebuffer, 0xFF, EPD_WIDTH / 2 * EPD_HEIGHT);
+    // Clear framebuffer, the next clock update has to redraw everything
+    memset(framebuffer, 0xFF, FB_SIZE);
+    panel_static_hash = 0;
+    panel_time[0]     = '\0';
 
     // Get text dimensions
     int32_t width, height;
     display_get_date_bounds(str, &width, &height);
 
     // Calculate centered position
-    int32_t x = (EPD_WIDTH - width) / 2;
-    int32_t y = (EPD_HEIGHT / 2) + (height / 2);
+    int32_t x = (epd_rotated_display_width() - width) / 2;
+    int32_t y = (epd_rotated_display_height() / 2) + (height / 2);
 
     // Draw the error text to framebuffer using date font (Quicksand_28)
     display_draw_date(str, x, y);
@@ -16,6 +16,11 @@ void display_poweroff(void);
 
 /**
  * @brief Draw time and date on the display
+ *
+ * The date line, timezone line and battery icon form a static layer, which is
+ * kept in flash and re-rendered only when one of them changes. The time is
+ * drawn to a dynamic layer on top. A partial refresh clears only the areas in
+ * which the composed image differs from what the panel shows.
  * 
  * @param time_str Time string (e.g., "14:30")
  * @param date_str Date string (e.g., "Monday, January 1 2024")
@@ -4,20 +4,51 @@ import zlib
 import sys
 import re
 import math
+import heapq
 import argparse
-from collections import namedtuple
+import os
+import struct
+from collections import namedtuple, Counter
 
 parser = argparse.ArgumentParser(description="Generate a header file from a font to be used with epdiy.")
 parser.add_argument("name", action="store", help="name of the font.")
 parser.add_argument("size", type=int, help="font size to use.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="compress glyph bitmaps.")
+parser.add_argument("--format", dest="format", choices=["raw", "zlib", "rle"], default="raw",
+                    help="encoding of compressed glyph bitmaps: raw deflate (default), zlib streams or run-length.")
+parser.add_argument("--dictionary", dest="dictionary", type=int, default=1024,
+                    help="size of the preset dictionary shared by all glyphs of a raw deflate font, 0 to disable.")
+parser.add_argument("--metrics-class", dest="metrics_class", default="0123456789:",
+                    help="characters whose glyph boxes are united into the box of the font metrics.")
+parser.add_argument("--page-index", dest="page_index", type=lambda v: int(v, 0), default=0,
+                    help="generate a glyph page table for direct lookup of code points below this value, e.g. 0x10000.")
+parser.add_argument("--binary", dest="binary", default=None,
+                    help="add the font to this font container instead of printing a header, see font_file.h.")
+parser.add_argument("--chars", dest="chars", default=None,
+                    help="only convert these characters instead of the intervals below, see fontsubset.py.")
+parser.add_argument("--bit-depth", dest="bit_depth", type=int, choices=[1, 2, 4], default=4,
+                    help="bits of coverage stored per glyph pixel.")
+parser.add_argument("--row-spans", dest="row_spans", action="store_true",
+                    help="store the first and last inked column of every glyph row, so only those are drawn.")
+parser.add_argument("--sdf", dest="sdf", action="store_true",
+                    help="generate signed distance fields sampled at size, to be drawn at any size, see sdf_font.h.")
+parser.add_argument("--sdf-spread", dest="sdf_spread", type=int, default=4,
+                    help="distance in texels covered by the distance fields.")
+parser.add_argument("--sdf-oversample", dest="sdf_oversample", type=int, default=8,
+                    help="resolution of the outlines the distance fields are measured on, relative to size.")
 args = parser.parse_args()
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "compressed_size", "data_offset", "code_point"])
+SdfGlyphProps = namedtuple("SdfGlyphProps", ["width", "height", "advance_x", "left", "top", "right", "bottom", "data_offset", "code_point"])
 
 font_stack = [freetype.Face(f) for f in args.fontstack]
 compress = args.compress
+glyph_format = {
+    "raw": "GLYPH_FORMAT_RAW_DEFLATE",
+    "zlib": "GLYPH_FORMAT_ZLIB",
+    "rle": "GLYPH_FORMAT_RLE",
+}[args.format]
 size = args.size
 font_name = args.name
 
@@ -34,6 +65,15 @@ intervals = [
     # (0x1F600, 0x1F680),
 ]
 
+# a subset merges consecutive code points into intervals
+if args.chars:
+    intervals = []
+    for code_point in sorted(set(ord(c) for c in args.chars)):
+        if intervals and intervals[-1][1] == code_point - 1:
+            intervals[-1] = (intervals[-1][0], code_point)
+        else:
+            intervals.append((code_point, code_point))
+
 
 def norm_floor(val):
     return int(math.floor(val / (1 << 6)))
@@ -53,6 +93,213 @@ def chunks(l, n):
 total_size = 0
 total_packed = 0
 all_glyphs = []
+all_spans = []
+
+def compress_glyph(packed, raw, zdict=None):
+    # raw deflate saves the zlib header and adler32 trailer per glyph
+    wbits = -zlib.MAX_WBITS if raw else zlib.MAX_WBITS
+    if zdict:
+        compressor = zlib.compressobj(zlib.Z_BEST_COMPRESSION, zlib.DEFLATED, wbits,
+                                      zdict=zdict)
+    else:
+        compressor = zlib.compressobj(zlib.Z_BEST_COMPRESSION, zlib.DEFLATED, wbits)
+    return compressor.compress(packed) + compressor.flush()
+
+def quantize(value, depth):
+    """
+    Coverage level of an 8 bit FreeType value at the given bit depth.
+    """
+    if depth == 4:
+        return value >> 4
+    return (value * ((1 << depth) - 1) + 127) // 255
+
+def trim_glyph(bitmap, depth):
+    """
+    Coverage levels of the box of the pixels inked at the bit depth, as rows,
+    and the column and row it starts at in the bitmap.
+    """
+    levels = [[quantize(bitmap.buffer[y * bitmap.width + x], depth) for x in range(bitmap.width)]
+              for y in range(bitmap.rows)]
+    rows = [y for y, row in enumerate(levels) if any(row)]
+    columns = [x for x in range(bitmap.width) if any(row[x] for row in levels)]
+    if not rows:
+        return [], 0, 0
+    return ([row[columns[0]:columns[-1] + 1] for row in levels[rows[0]:rows[-1] + 1]],
+            columns[0], rows[0])
+
+def pack_levels(rows, depth):
+    """
+    Pack coverage levels 8 / depth per byte, the first pixel in the lowest
+    bits. Rows start at a byte.
+    """
+    per_byte = 8 // depth
+    pixels = bytearray()
+    for row in rows:
+        for x in range(0, len(row), per_byte):
+            byte = 0
+            for i, level in enumerate(row[x:x + per_byte]):
+                byte |= level << (i * depth)
+            pixels.append(byte)
+    return bytes(pixels)
+
+def row_spans(rows):
+    """
+    The first inked column and the end of the last one of every row, 0, 0
+    for blank rows, see GFXfont->row_spans.
+    """
+    spans = bytearray()
+    for row in rows:
+        inked = [x for x, level in enumerate(row) if level]
+        spans += bytes([inked[0], inked[-1] + 1]) if inked else bytes(2)
+    return bytes(spans)
+
+def rle_encode(packed, width):
+    """
+    Encode runs of equal coverage per row: level in the upper nibble, run
+    length - 1 in the lower one, length 16 is extended by the next byte.
+    """
+    byte_width = (width + 1) // 2
+    encoded = bytearray()
+    if byte_width == 0:
+        return bytes(encoded)
+    for row_start in range(0, len(packed), byte_width):
+        row = packed[row_start:row_start + byte_width]
+        levels = [(row[x // 2] >> 4) if x % 2 else (row[x // 2] & 0xF) for x in range(width)]
+        x = 0
+        while x < width:
+            count = 1
+            while x + count < width and levels[x + count] == levels[x] and count < 16 + 255:
+                count += 1
+            if count < 16:
+                encoded.append(levels[x] << 4 | (count - 1))
+            else:
+                encoded.extend([levels[x] << 4 | 15, count - 16])
+            x += count
+    return bytes(encoded)
+
+def build_dictionary(glyphs, size, segment=32, d=6):
+    """
+    Greedily pick glyph segments covering the byte patterns shared by the most
+    glyphs. Uniform patterns are skipped, deflate encodes runs well on its own.
+    The best segments go last, where matches are cheapest to reference.
+    """
+    def dmers(data):
+        return {data[i:i + d] for i in range(len(data) - d + 1)
+                if data[i:i + d].count(data[i]) != d}
+
+    frequency = Counter()
+    for g in glyphs:
+        frequency.update(dmers(g))
+
+    candidates = []
+    for g in glyphs:
+        for start in range(0, max(1, len(g) - segment + 1), segment // 4):
+            s = g[start:start + segment]
+            candidates.append((s, dmers(s)))
+
+    # scores only drop as patterns get covered, so stale heap entries are
+    # re-scored lazily
+    covered = set()
+    heap = [(-sum(frequency[m] for m in ms), i) for i, (s, ms) in enumerate(candidates)]
+    heapq.heapify(heap)
+    chosen = []
+    total = 0
+    while heap and total < size:
+        score, i = heapq.heappop(heap)
+        segment_data, ms = candidates[i]
+        current = sum(frequency[m] for m in ms - covered)
+        if current != -score:
+            heapq.heappush(heap, (-current, i))
+            continue
+        if current <= len(glyphs) // 8:
+            break
+        covered |= ms
+        chosen.append(segment_data)
+        total += len(segment_data)
+    return b"".join(reversed(chosen))[-size:]
+
+# font container layout, see font_file.c
+FONT_FILE_MAGIC = 0x31465045
+FONT_FILE_VERSION = 1
+FONT_FILE_NAME_SIZE = 32
+FONT_FILE_HEADER = "<IHHII"
+FONT_FILE_ENTRY = f"<{FONT_FILE_NAME_SIZE}sII"
+FONT_RECORD = "<10IhhHBBBBhhhhH"
+FONT_RECORD_ROW_SPANS = 1
+FONT_RECORD_BIT_DEPTH_SHIFT = 8
+# GFXglyph and UnicodeInterval as laid out on the ESP32, used in place
+GLYPH_STRUCT = "<BBBxhhHxxI"
+INTERVAL_STRUCT = "<III"
+
+def align(data, n=4):
+    return data + bytes(-len(data) % n)
+
+def font_record():
+    """
+    The font as one record of a container: the record header, followed by
+    the glyph table, intervals, page table, dictionary and bitmaps.
+    """
+    glyph_table = b"".join(struct.pack(GLYPH_STRUCT, *p[:-1]) for p in glyph_props)
+    interval_table = b""
+    offset = 0
+    for i_start, i_end in intervals:
+        interval_table += struct.pack(INTERVAL_STRUCT, i_start, i_end, offset)
+        offset += i_end - i_start + 1
+
+    glyph_offset = struct.calcsize(FONT_RECORD)
+    interval_offset = glyph_offset + len(glyph_table)
+    page_offset = interval_offset + len(interval_table)
+    page_data = b""
+    page_offsets = []
+    for page in range(page_count):
+        if page in pages:
+            page_offsets.append(page_offset + page_count * 4 + len(page_data))
+            page_data += struct.pack(f"<{PAGE_SIZE}H", *pages[page])
+        else:
+            page_offsets.append(0)
+    page_table = struct.pack(f"<{page_count}I", *page_offsets) + page_data
+    dictionary_offset = page_offset + len(page_table)
+    bitmap_offset = dictionary_offset + len(dictionary)
+
+    header = struct.pack(FONT_RECORD,
+        len(glyph_props), len(intervals), glyph_offset, interval_offset,
+        bitmap_offset, len(glyph_data), dictionary_offset, len(dictionary),
+        page_offset, page_count,
+        norm_ceil(face.size.ascender), norm_floor(face.size.descender), norm_ceil(face.size.height),
+        1 if compress else 0, {"zlib": 0, "raw": 1, "rle": 2}[args.format],
+        *metrics, (FONT_RECORD_ROW_SPANS if args.row_spans else 0) |
+                  args.bit_depth << FONT_RECORD_BIT_DEPTH_SHIFT)
+    return header + glyph_table + interval_table + page_table + dictionary + bytes(glyph_data)
+
+def write_container(path, record):
+    """
+    Add the font to a container, replacing a font of the same name.
+    """
+    fonts = {}
+    if os.path.exists(path):
+        with open(path, "rb") as f:
+            data = f.read()
+        magic, version, count, _, _ = struct.unpack_from(FONT_FILE_HEADER, data)
+        if magic != FONT_FILE_MAGIC or version != FONT_FILE_VERSION:
+            raise ValueError(f"{path} is no font container of version {FONT_FILE_VERSION}!")
+        for i in range(count):
+            name, offset, size = struct.unpack_from(FONT_FILE_ENTRY, data,
+                struct.calcsize(FONT_FILE_HEADER) + i * struct.calcsize(FONT_FILE_ENTRY))
+            fonts[name.rstrip(b"\0").decode()] = data[offset:offset + size]
+    if len(font_name.encode()) >= FONT_FILE_NAME_SIZE:
+        raise ValueError(f"font name {font_name} is too long for a container!")
+    fonts[font_name] = record
+
+    index = b""
+    body = b""
+    body_offset = struct.calcsize(FONT_FILE_HEADER) + len(fonts) * struct.calcsize(FONT_FILE_ENTRY)
+    for name, data in fonts.items():
+        index += struct.pack(FONT_FILE_ENTRY, name.encode(), body_offset + len(body), len(data))
+        body += align(data)
+    header = struct.pack(FONT_FILE_HEADER, FONT_FILE_MAGIC, FONT_FILE_VERSION, len(fonts),
+                         body_offset + len(body), 0)
+    with open(path, "wb") as f:
+        f.write(header + index + body)
 
 def load_glyph(code_point):
     face_index = 0
@@ -67,44 +314,206 @@ def load_glyph(code_point):
         print (f"falling back to font {face_index} for {chr(code_point)}.", file=sys.stderr)
     raise ValueError(f"code point {code_point} not found in font stack!")
 
+INF = 1e20
+
+def squared_distances_1d(f):
+    """
+    Squared distance of every element to the nearest element, where element
+    q is `f[q]` away itself: the lower envelope of parabolas (Felzenszwalb
+    and Huttenlocher).
+    """
+    n = len(f)
+    v = [0] * n
+    z = [0.0] * (n + 1)
+    k = 0
+    z[0] = -INF
+    z[1] = INF
+    for q in range(1, n):
+        while True:
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k])
+            if s > z[k]:
+                break
+            k -= 1
+        k += 1
+        v[k] = q
+        z[k] = s
+        z[k + 1] = INF
+    d = [0] * n
+    k = 0
+    for q in range(n):
+        while z[k + 1] < q:
+            k += 1
+        d[q] = (q - v[k]) ** 2 + f[v[k]]
+    return d
+
+def squared_distances(mask, width, height, rows):
+    """
+    Squared distance of the cells of the given rows to the nearest set cell
+    of a mask.
+    """
+    columns = [squared_distances_1d([0 if mask[y * width + x] else INF for y in range(height)])
+               for x in range(width)]
+    return {y: squared_distances_1d([columns[x][y] for x in range(width)]) for y in rows}
+
+def sdf_glyph(face, code_point):
+    """
+    Glyph properties and distance field, see SdfGlyph. The outline is taken
+    from the glyph rendered at `sdf_oversample` times the size and the
+    distances are measured to the centers of its pixels.
+    """
+    oversample = args.sdf_oversample
+    spread = args.sdf_spread
+    bitmap = face.glyph.bitmap
+    advance = (face.glyph.advance.x + oversample // 2) // oversample
+    if bitmap.width == 0 or bitmap.rows == 0:
+        return SdfGlyphProps(0, 0, advance, 0, 0, 0, 0, 0, code_point), b""
+
+    # the ink box in 1/64 texels and the field around it, as sdf_font.c
+    # derives it
+    left = round(face.glyph.bitmap_left * 64 / oversample)
+    top = round(face.glyph.bitmap_top * 64 / oversample)
+    right = round((face.glyph.bitmap_left + bitmap.width) * 64 / oversample)
+    bottom = round((face.glyph.bitmap_top - bitmap.rows) * 64 / oversample)
+    field_left = (left >> 6) - spread
+    field_top = ((top + 63) >> 6) + spread
+    width = ((right + 63) >> 6) + spread - field_left
+    height = field_top - (bottom >> 6) + spread
+    if width > 255 or height > 255:
+        raise ValueError(f"field of {chr(code_point)} is too large, use a smaller size!")
+
+    grid_width = width * oversample
+    grid_height = height * oversample
+    x0 = face.glyph.bitmap_left - field_left * oversample
+    y0 = field_top * oversample - face.glyph.bitmap_top
+    inside = bytearray(grid_width * grid_height)
+    for y in range(bitmap.rows):
+        for x in range(bitmap.width):
+            gx = x0 + x
+            gy = y0 + y
+            if bitmap.buffer[y * bitmap.width + x] >= 128 and 0 <= gx < grid_width and 0 <= gy < grid_height:
+                inside[gy * grid_width + gx] = 1
+    outside = bytes(1 - c for c in inside)
+
+    rows = [j * oversample + oversample // 2 for j in range(height)]
+    to_inside = squared_distances(inside, grid_width, grid_height, rows)
+    to_outside = squared_distances(outside, grid_width, grid_height, rows)
+    field = bytearray()
+    for gy in rows:
+        for i in range(width):
+            gx = i * oversample + oversample // 2
+            if inside[gy * grid_width + gx]:
+                distance = math.sqrt(to_outside[gy][gx]) - 0.5
+            else:
+                distance = 0.5 - math.sqrt(to_inside[gy][gx])
+            value = round(128 + distance / oversample * 128 / spread)
+            field.append(min(255, max(0, value)))
+    return SdfGlyphProps(width, height, advance, left, top, right, bottom, 0, code_point), bytes(field)
+
+def write_sdf_font():
+    """
+    Print the header of an SdfFont, see sdf_font.h.
+    """
+    for face in font_stack:
+        face.set_char_size((size * args.sdf_oversample) << 6, (size * args.sdf_oversample) << 6, 150, 150)
+
+    glyphs = []
+    field = bytearray()
+    for i_start, i_end in intervals:
+        for code_point in range(i_start, i_end + 1):
+            props, data = sdf_glyph(load_glyph(code_point), code_point)
+            glyphs.append(props._replace(data_offset = len(field)))
+            field += data
+    print("fields", len(field), file=sys.stderr)
+
+    face = load_glyph(ord('|'))
+    def texels(val):
+        return round(val / args.sdf_oversample)
+
+    print("#pragma once")
+    print("#include \"sdf_font.h\"")
+    print(f"const uint8_t {font_name}Field[{len(field)}] = {{")
+    for c in chunks(field, 16):
+        print ("    " + " ".join(f"0x{b:02X}," for b in c))
+    print ("};");
+
+    print(f"const SdfGlyph {font_name}Glyphs[] = {{")
+    for g in glyphs:
+        print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {chr(g.code_point) if g.code_point != 92 else '<backslash>'}")
+    print ("};");
+
+    print(f"const UnicodeInterval {font_name}Intervals[] = {{")
+    offset = 0
+    for i_start, i_end in intervals:
+        print (f"    {{ 0x{i_start:X}, 0x{i_end:X}, 0x{offset:X} }},")
+        offset += i_end - i_start + 1
+    print ("};");
+
+    print(f"const SdfFont {font_name} = {{")
+    print(f"    {font_name}Field,")
+    print(f"    {font_name}Glyphs,")
+    print(f"    {font_name}Intervals,")
+    print(f"    {len(intervals)},")
+    print(f"    {size},")
+    print(f"    {args.sdf_spread},")
+    print(f"    {texels(face.size.height)},")
+    print(f"    {texels(face.size.ascender)},")
+    print(f"    {texels(face.size.descender)},")
+    print("};")
+
+if args.bit_depth != 4 and (args.sdf or (compress and args.format == "rle")):
+    raise ValueError("only bitmaps of deflate or uncompressed fonts have a lower bit depth!")
+
+if args.sdf:
+    if args.compress or args.binary:
+        raise ValueError("distance fields are neither compressed nor stored in containers!")
+    write_sdf_font()
+    sys.exit(0)
+
 for i_start, i_end in intervals:
     for code_point in range(i_start, i_end + 1):
         face = load_glyph(code_point)
-        bitmap = face.glyph.bitmap
-        pixels = []
-        px = 0
-        for i, v in enumerate(bitmap.buffer):
-            y = i / bitmap.width
-            x = i % bitmap.width
-            if x % 2 == 0:
-                px = (v >> 4)
-            else:
-                px = px | (v & 0xF0)
-                pixels.append(px);
-                px = 0
-            # eol
-            if x == bitmap.width - 1 and bitmap.width % 2 > 0:
-                pixels.append(px)
-                px = 0
-
-        packed = bytes(pixels);
+        # rows and columns without ink after quantizing are not stored
+        rows, x_offset, y_offset = trim_glyph(face.glyph.bitmap, args.bit_depth)
+        packed = pack_levels(rows, args.bit_depth)
         total_packed += len(packed)
-        compressed = packed
-        if compress:
-            compressed = zlib.compress(packed)
 
         glyph = GlyphProps(
-            width = bitmap.width,
-            height = bitmap.rows,
+            width = len(rows[0]) if rows else 0,
+            height = len(rows),
             advance_x = norm_floor(face.glyph.advance.x),
-            left = face.glyph.bitmap_left,
-            top = face.glyph.bitmap_top,
-            compressed_size = len(compressed),
-            data_offset = total_size,
+            left = face.glyph.bitmap_left + x_offset,
+            top = face.glyph.bitmap_top - y_offset,
+            compressed_size = len(packed),
+            data_offset = 0,
             code_point = code_point,
         )
-        total_size += len(compressed)
-        all_glyphs.append((glyph, compressed))
+        all_glyphs.append((glyph, packed))
+        all_spans.append(row_spans(rows))
+
+# a preset dictionary makes inflate maintain its 32 KB window, so it is only
+# kept if it saves a noticeable share of the font size
+dictionary = b""
+if compress and args.format == "rle":
+    all_glyphs = [(props, rle_encode(packed, props.width)) for props, packed in all_glyphs]
+elif compress:
+    raw = args.format == "raw"
+    compressed = [compress_glyph(packed, raw) for _, packed in all_glyphs]
+    if raw and args.dictionary > 0:
+        candidate = build_dictionary([packed for _, packed in all_glyphs], args.dictionary)
+        with_dictionary = [compress_glyph(packed, raw, candidate) for _, packed in all_glyphs]
+        saved = sum(map(len, compressed)) - sum(map(len, with_dictionary)) - len(candidate)
+        print("dictionary saves", saved, file=sys.stderr)
+        if candidate and saved > sum(map(len, compressed)) // 50:
+            dictionary = candidate
+            compressed = with_dictionary
+    all_glyphs = [(props, data) for (props, _), data in zip(all_glyphs, compressed)]
+
+# row spans precede the data of their glyph
+for index, (props, data) in enumerate(all_glyphs):
+    spans = all_spans[index] if args.row_spans else b""
+    all_glyphs[index] = (props._replace(compressed_size = len(data),
+                                        data_offset = total_size + len(spans)), spans + data)
+    total_size += len(spans) + len(data)
 
 # pipe seems to be a good heuristic for the "real" descender
 face = load_glyph(ord('|'))
@@ -117,7 +526,37 @@ for index, glyph in enumerate(all_glyphs):
     glyph_props.append(props)
 
 print("total", total_packed, file=sys.stderr)
-print("compressed", total_size, file=sys.stderr)
+print("compressed", total_size + len(dictionary), file=sys.stderr)
+
+# layout metrics, so the clock does not have to measure strings
+digit_advances = [p.advance_x for p, _ in all_glyphs if chr(p.code_point) in "0123456789"]
+box_glyphs = [p for p, _ in all_glyphs if chr(p.code_point) in args.metrics_class]
+metrics = [
+    max(digit_advances, default=0),
+    1 if len(set(digit_advances)) == 1 else 0,
+    min((p.left for p in box_glyphs), default=0),
+    max((p.top for p in box_glyphs), default=0),
+    max((p.left + p.width for p in box_glyphs), default=0),
+    max((p.height - p.top for p in box_glyphs), default=0),
+]
+
+# page table for direct lookup, 256 code points per page
+PAGE_SIZE = 256
+pages = {}
+glyph_index = 0
+for i_start, i_end in intervals:
+    for code_point in range(i_start, i_end + 1):
+        if code_point < args.page_index:
+            pages.setdefault(code_point // PAGE_SIZE, [0] * PAGE_SIZE)[code_point % PAGE_SIZE] = glyph_index + 1
+        glyph_index += 1
+page_count = max(pages) + 1 if pages else 0
+if pages:
+    print("page index", page_count * 4 + len(pages) * PAGE_SIZE * 2, "bytes", file=sys.stderr)
+
+if args.binary:
+    write_container(args.binary, font_record())
+    print("container", args.binary, os.path.getsize(args.binary), "bytes", file=sys.stderr)
+    sys.exit(0)
 
 print("#pragma once")
 print("#include \"epd_driver.h\"")
@@ -126,6 +565,12 @@ for c in chunks(glyph_data, 16):
     print ("    " + " ".join(f"0x{b:02X}," for b in c))
 print ("};");
 
+if dictionary:
+    print(f"const uint8_t {font_name}Dictionary[{len(dictionary)}] = {{")
+    for c in chunks(dictionary, 16):
+        print ("    " + " ".join(f"0x{b:02X}," for b in c))
+    print ("};");
+
 print(f"const GFXglyph {font_name}Glyphs[] = {{")
 for i, g in enumerate(glyph_props):
     print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {chr(g.code_point) if g.code_point != 92 else '<backslash>'}")
@@ -138,6 +583,17 @@ for i_start, i_end in intervals:
     offset += i_end - i_start + 1
 print ("};");
 
+for page in sorted(pages):
+    print(f"const uint16_t {font_name}GlyphPage{page:X}[{PAGE_SIZE}] = {{")
+    for c in chunks(pages[page], 16):
+        print ("    " + " ".join(f"{i}," for i in c))
+    print ("};");
+if pages:
+    print(f"const uint16_t *const {font_name}GlyphPages[{page_count}] = {{")
+    for page in range(page_count):
+        print(f"    {font_name}GlyphPage{page:X}," if page in pages else "    NULL,")
+    print ("};");
+
 print(f"const GFXfont {font_name} = {{")
 print(f"    (uint8_t*){font_name}Bitmaps,")
 print(f"    (GFXglyph*){font_name}Glyphs,")
@@ -147,4 +603,12 @@ print(f"    {1 if compress else 0},")
 print(f"    {norm_ceil(face.size.height)},")
 print(f"    {norm_ceil(face.size.ascender)},")
 print(f"    {norm_floor(face.size.descender)},")
+print(f"    {glyph_format},")
+print(f"    (uint8_t*){font_name}Dictionary," if dictionary else "    NULL,")
+print(f"    {len(dictionary)},")
+print(f"    (uint16_t**){font_name}GlyphPages," if pages else "    NULL,")
+print(f"    {page_count},")
+print("    { " + ", ".join(str(m) for m in metrics) + " },")
+print(f"    {1 if args.row_spans else 0},")
+print(f"    {args.bit_depth},")
 print("};")
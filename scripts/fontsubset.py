@@ -0,0 +1,280 @@
+#!python3
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+parser = argparse.ArgumentParser(description="Reduce the font headers to the characters the firmware draws with them.")
+parser.add_argument("--manifest", dest="manifest", default=os.path.join(os.path.dirname(__file__), "fonts.json"),
+                    help="fonts and the strings they are used for, fonts.json by default.")
+parser.add_argument("--root", dest="root", default=os.path.join(os.path.dirname(__file__), ".."),
+                    help="directory the manifest paths are relative to, the repository by default.")
+parser.add_argument("--from-headers", dest="from_headers", action="store_true",
+                    help="drop unused glyphs from the existing headers instead of running fontconvert.py.")
+parser.add_argument("--dry-run", dest="dry_run", action="store_true",
+                    help="only report the characters and the flash saved, do not write headers.")
+args = parser.parse_args()
+
+# named character classes for text which is not known at build time
+CLASSES = {
+    "digits": "0123456789",
+    "upper": "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+    "lower": "abcdefghijklmnopqrstuvwxyz",
+    "punctuation": "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~",
+    "space": " ",
+}
+CLASSES["ascii"] = "".join(chr(c) for c in range(32, 127))
+
+# characters printf conversions may produce, %s and %c print other literals
+CONVERSIONS = {
+    "d": "0123456789-", "i": "0123456789-", "u": "0123456789",
+    "x": "0123456789abcdef", "X": "0123456789ABCDEF", "o": "01234567",
+    "f": "0123456789-.", "e": "0123456789-.e+", "g": "0123456789-.e+",
+    "%": "%", "s": "", "c": "", "p": "0123456789abcdefx",
+}
+CONVERSION = re.compile(r"%[-+ #0]*(?:\*|\d+)?(?:\.(?:\*|\d+))?(?:hh|h|ll|l|j|z|t|L)?([diuxXofegscp%])")
+
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+ESCAPE = re.compile(r"\\(x[0-9A-Fa-f]+|[0-7]{1,3}|.)")
+SIMPLE_ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "0": "\0", "\\": "\\", "\"": "\"", "'": "'"}
+
+# sizes of the header arrays as laid out on the ESP32
+GLYPH_SIZE = 16
+INTERVAL_SIZE = 12
+PAGE_SIZE = 256
+
+
+def strip_comments(source):
+    # keeps string literals intact, comment markers in them are left alone
+    pattern = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:[^"\\\n]|\\.)*"|\'(?:[^\'\\\n]|\\.)*\'', re.S)
+    return pattern.sub(lambda m: m.group(0) if m.group(0)[0] in "\"'" else " ", source)
+
+
+def matching(source, start, opening, closing):
+    """
+    Index after the bracket closing the one at `start`.
+    """
+    depth = 0
+    for match in re.finditer(r'"(?:[^"\\\n]|\\.)*"|\'(?:[^\'\\\n]|\\.)*\'|[' + re.escape(opening + closing) + "]",
+                             source[start:]):
+        token = match.group(0)
+        if token == opening:
+            depth += 1
+        elif token == closing:
+            depth -= 1
+            if depth == 0:
+                return start + match.end()
+    raise ValueError(f"unbalanced {opening}{closing} in source")
+
+
+def unescape(literal):
+    def replace(match):
+        escape = match.group(1)
+        if escape[0] == "x":
+            return chr(int(escape[1:], 16))
+        if escape[0] in "01234567" and escape != "0":
+            return chr(int(escape, 8))
+        return SIMPLE_ESCAPES.get(escape, escape)
+    return ESCAPE.sub(replace, literal)
+
+
+def literal_chars(code):
+    """
+    Characters of all string literals in `code`, format strings contribute
+    the characters their conversions may print.
+    """
+    chars = set()
+    for match in LITERAL.finditer(code):
+        text = unescape(match.group(1))
+        if "%" in text:
+            for conversion in CONVERSION.finditer(text):
+                chars.update(CONVERSIONS[conversion.group(1)])
+            text = CONVERSION.sub("", text)
+        chars.update(c for c in text if ord(c) >= 32)
+    return chars
+
+
+def source_chars(use):
+    with open(os.path.join(args.root, use["file"]), encoding="utf-8") as f:
+        source = strip_comments(f.read())
+
+    if "function" in use:
+        # the body of the function definition
+        definition = re.search(r"\b" + re.escape(use["function"]) + r"\s*\([^;{}]*\)\s*\{", source)
+        if not definition:
+            raise ValueError(f"function {use['function']} not found in {use['file']}")
+        start = definition.end() - 1
+        return literal_chars(source[start:matching(source, start, "{", "}")])
+
+    if "call" in use:
+        # the arguments of every call
+        chars = set()
+        for call in re.finditer(r"\b" + re.escape(use["call"]) + r"\s*\(", source):
+            start = call.end() - 1
+            chars |= literal_chars(source[start:matching(source, start, "(", ")")])
+        return chars
+
+    return literal_chars(source)
+
+
+def used_chars(font):
+    chars = set(font.get("chars", ""))
+    for name in font.get("classes", []):
+        chars.update(CLASSES[name])
+    for use in font.get("sources", []):
+        chars |= source_chars(use)
+    return "".join(sorted(chars))
+
+
+def array_block(header, name):
+    """
+    Match of the definition of array `name` in a font header, group 1 holds
+    its elements.
+    """
+    return re.search(r"^const [^\n]*\b" + re.escape(name) + r"\[[^\n]*\{\n(.*?)^\};\n", header, re.S | re.M)
+
+
+def flash_size(header):
+    """
+    Bytes a font header occupies in flash, without the GFXfont itself.
+    """
+    size = 0
+    for match in re.finditer(r"^const (\w+)\s*(\*\s*const\s+)?\w+\[(\d*)\] = \{\n(.*?)^\};\n",
+                             header, re.S | re.M):
+        element_type, pointer, count, body = match.groups()
+        if not count:
+            count = len(re.findall(r"^\s*\{", body, re.M))
+        element_size = 4 if pointer else {
+            "uint8_t": 1, "uint16_t": 2, "GFXglyph": GLYPH_SIZE, "UnicodeInterval": INTERVAL_SIZE,
+        }[element_type]
+        size += int(count) * element_size
+    return size
+
+
+def glyph_count(header):
+    return len(re.findall(r"^    \{ -?\d+, -?\d+, -?\d+, -?\d+, -?\d+, \d+, \d+ \},", header, re.M))
+
+
+def chunks(l, n):
+    for i in range(0, len(l), n):
+        yield l[i:i + n]
+
+
+def subset_header(header, name, chars):
+    """
+    Drop the glyphs of characters not in `chars` from a generated header.
+    Glyph bitmaps are encoded independently, so the others are only moved.
+    """
+    bitmaps = array_block(header, f"{name}Bitmaps")
+    glyphs = array_block(header, f"{name}Glyphs")
+    intervals = array_block(header, f"{name}Intervals")
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-F]{2})", bitmaps.group(1)))
+    glyph_lines = glyphs.group(1).splitlines()
+    code_points = []
+    for start, end, _ in re.findall(r"\{ 0x([0-9A-F]+), 0x([0-9A-F]+), 0x([0-9A-F]+) \}", intervals.group(1)):
+        code_points.extend(range(int(start, 16), int(end, 16) + 1))
+
+    # glyph data is stored in glyph order, each ends where the next starts,
+    # row spans take up 2 bytes per row before the data of their glyph
+    glyph_fields = [[int(v) for v in re.match(r"\s*\{([^}]*)\}", l).group(1).split(",")] for l in glyph_lines]
+    font = re.search(r"^const GFXfont " + re.escape(name) + r" = \{\n(.*?)^\};\n", header, re.S | re.M)
+    font_fields = font.group(1).splitlines()
+    spans = len(font_fields) > 14 and font_fields[14].strip(" ,") == "1"
+    offsets = [g[6] - (2 * g[1] if spans else 0) for g in glyph_fields] + [len(data)]
+
+    wanted = {ord(c) for c in chars}
+    missing = wanted - set(code_points)
+    if missing:
+        print(f"{name}: no glyphs for {''.join(sorted(chr(c) for c in missing))!r}", file=sys.stderr)
+
+    new_data = bytearray()
+    new_glyphs = []
+    new_intervals = []
+    kept = []
+    for index, code_point in enumerate(code_points):
+        if code_point not in wanted:
+            continue
+        fields = glyph_fields[index]
+        fields[6] = len(new_data) + fields[6] - offsets[index]
+        new_data += data[offsets[index]:offsets[index + 1]]
+        comment = glyph_lines[index][glyph_lines[index].index("},") + 2:]
+        new_glyphs.append("    { " + ", ".join(str(v) for v in fields) + " }," + comment)
+        if new_intervals and new_intervals[-1][1] == code_point - 1:
+            new_intervals[-1][1] = code_point
+        else:
+            new_intervals.append([code_point, code_point, len(kept)])
+        kept.append(code_point)
+
+    header = header.replace(bitmaps.group(0),
+        f"const uint8_t {name}Bitmaps[{len(new_data)}] = {{\n"
+        + "".join("    " + " ".join(f"0x{b:02X}," for b in c) + "\n" for c in chunks(new_data, 16))
+        + "};\n")
+    header = header.replace(glyphs.group(1), "\n".join(new_glyphs) + "\n")
+    header = header.replace(intervals.group(1),
+        "".join(f"    {{ 0x{s:X}, 0x{e:X}, 0x{o:X} }},\n" for s, e, o in new_intervals))
+
+    # rebuild a page table over the range it covered before
+    font = re.search(r"^const GFXfont " + re.escape(name) + r" = \{\n(.*?)^\};\n", header, re.S | re.M)
+    fields = font.group(1).splitlines()
+    page_count = int(fields[12].strip(" ,"))
+    header = re.sub(r"^const uint16_t (\*const )?" + re.escape(name) + r"GlyphPages?\w*\[.*?^\};\n", "",
+                    header, flags=re.S | re.M)
+    pages = {}
+    for index, code_point in enumerate(kept):
+        if code_point < page_count * PAGE_SIZE:
+            pages.setdefault(code_point // PAGE_SIZE, [0] * PAGE_SIZE)[code_point % PAGE_SIZE] = index + 1
+    page_count = max(pages) + 1 if pages else 0
+    page_text = ""
+    for page in sorted(pages):
+        page_text += f"const uint16_t {name}GlyphPage{page:X}[{PAGE_SIZE}] = {{\n"
+        page_text += "".join("    " + " ".join(f"{i}," for i in c) + "\n" for c in chunks(pages[page], 16))
+        page_text += "};\n"
+    if pages:
+        page_text += f"const uint16_t *const {name}GlyphPages[{page_count}] = {{\n"
+        page_text += "".join(f"    {name}GlyphPage{page:X},\n" if page in pages else "    NULL,\n"
+                             for page in range(page_count))
+        page_text += "};\n"
+
+    fields[3] = f"    {len(new_intervals)},"
+    fields[11] = f"    (uint16_t**){name}GlyphPages," if pages else "    NULL,"
+    fields[12] = f"    {page_count},"
+    font = re.search(r"^const GFXfont " + re.escape(name) + r" = \{\n(.*?)^\};\n", header, re.S | re.M)
+    return (header[:font.start()] + page_text + f"const GFXfont {name} = {{\n"
+            + "\n".join(fields) + "\n};\n" + header[font.end():])
+
+
+def convert(font, chars):
+    fontconvert = os.path.join(os.path.dirname(__file__), "fontconvert.py")
+    command = [sys.executable, fontconvert, font["name"], str(font["size"])]
+    command += [os.path.join(args.root, f) for f in font["fontstack"]]
+    command += font.get("options", []) + ["--chars", chars]
+    return subprocess.run(command, check=True, stdout=subprocess.PIPE, text=True).stdout
+
+
+with open(args.manifest, encoding="utf-8") as f:
+    manifest = json.load(f)
+
+total_saved = 0
+for font in manifest["fonts"]:
+    path = os.path.join(args.root, font["header"])
+    with open(path, encoding="utf-8") as f:
+        header = f.read()
+    chars = used_chars(font)
+
+    if args.from_headers or "fontstack" not in font:
+        subset = subset_header(header, font["name"], chars)
+    else:
+        subset = convert(font, chars)
+
+    saved = flash_size(header) - flash_size(subset)
+    total_saved += saved
+    print(f"{font['name']}: {glyph_count(header)} -> {glyph_count(subset)} glyphs, "
+          f"{flash_size(header)} -> {flash_size(subset)} bytes, saves {saved} bytes")
+    print(f"    {chars!r}")
+    if not args.dry_run and subset != header:
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(subset)
+
+print(f"total: saves {total_saved} bytes of flash")
@@ -0,0 +1,179 @@
+/**
+ * Pixels per second of the glyph blend for 140 pt digits drawn from the glyph
+ * cache, at even and odd start columns, against the former loop that blends
+ * one pixel per iteration and builds the color LUT for every character.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "Quicksand_140.h"
+#include "epd_driver.h"
+#include "glyph_cache.h"
+#include "host_test.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FB_SIZE    (EPD_WIDTH / 2 * EPD_HEIGHT)
+#define ITERATIONS 500
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static inline int32_t min(int32_t x, int32_t y)
+{
+    return x < y ? x : y;
+}
+
+static inline int32_t max(int32_t x, int32_t y)
+{
+    return x > y ? x : y;
+}
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static uint8_t framebuffer[FB_SIZE];
+static uint8_t reference[FB_SIZE];
+
+static const char *const lines[] = {"01234", "56789"};
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void build_color_lut(const FontProperties *props, uint8_t *color_lut)
+{
+    int32_t color_difference = (int32_t)props->fg_color - (int32_t)props->bg_color;
+    for (int32_t c = 0; c < 16; c++)
+    {
+        color_lut[c] = max(0, min(15, props->bg_color + c * color_difference / 15));
+    }
+}
+
+
+// the blend loop of draw_char before the byte pair path, on a cached glyph
+static void blend_per_pixel(const GFXglyph *glyph, const uint8_t *bitmap, int32_t *cursor_x,
+                            int32_t cursor_y, uint8_t *buffer, const FontProperties *props)
+{
+    uint8_t color_lut[16];
+    build_color_lut(props, color_lut);
+
+    int32_t buf_width = EPD_WIDTH / 2;
+    int32_t byte_width = (glyph->width / 2 + glyph->width % 2);
+    for (int32_t y = 0; y < glyph->height; y++)
+    {
+        int32_t yy = cursor_y - glyph->top + y;
+        if (yy < 0 || yy >= EPD_HEIGHT)
+        {
+            continue;
+        }
+        int32_t start_pos = *cursor_x + glyph->left;
+        int32_t x = max(0, -start_pos);
+        int32_t max_x = min(start_pos + glyph->width, EPD_WIDTH);
+        for (int32_t xx = start_pos + x; xx < max_x; xx++)
+        {
+            uint32_t buf_pos = yy * buf_width + xx / 2;
+            uint8_t old = buffer[buf_pos];
+            uint8_t bm = bitmap[y * byte_width + x / 2];
+            bm = (x & 1) ? bm >> 4 : bm & 0xF;
+            if ((xx & 1) == 0)
+            {
+                buffer[buf_pos] = (old & 0xF0) | color_lut[bm];
+            }
+            else
+            {
+                buffer[buf_pos] = (old & 0x0F) | (color_lut[bm] << 4);
+            }
+            x++;
+        }
+    }
+    *cursor_x += glyph->advance_x;
+}
+
+
+static int64_t draw_writeln(int32_t x0, uint8_t *buffer)
+{
+    int64_t start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        for (size_t l = 0; l < sizeof(lines) / sizeof(lines[0]); l++)
+        {
+            int32_t x = x0, y = 200 + 220 * l;
+            writeln((GFXfont *)&Quicksand_140, lines[l], &x, &y, buffer);
+        }
+    }
+    return host_time_ns() - start;
+}
+
+
+static int64_t draw_per_pixel(int32_t x0, uint8_t *buffer)
+{
+    FontProperties props = {.fg_color = 0, .bg_color = 15};
+    int64_t start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        for (size_t l = 0; l < sizeof(lines) / sizeof(lines[0]); l++)
+        {
+            int32_t x = x0, y = 200 + 220 * l;
+            for (const char *c = lines[l]; *c; c++)
+            {
+                GFXglyph *glyph;
+                get_glyph((GFXfont *)&Quicksand_140, *c, &glyph);
+                const uint8_t *bitmap = glyph_cache_lookup(&Quicksand_140, glyph);
+                blend_per_pixel(glyph, bitmap, &x, y, buffer, &props);
+            }
+        }
+    }
+    return host_time_ns() - start;
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    glyph_cache_set_budget(1024 * 1024);
+    prewarm_glyph_cache(&Quicksand_140, GLYPH_CACHE_DIGITS);
+
+    int64_t pixels = 0;
+    for (size_t l = 0; l < sizeof(lines) / sizeof(lines[0]); l++)
+    {
+        for (const char *c = lines[l]; *c; c++)
+        {
+            GFXglyph *glyph;
+            get_glyph((GFXfont *)&Quicksand_140, *c, &glyph);
+            pixels += glyph->width * glyph->height;
+        }
+    }
+    pixels *= ITERATIONS;
+
+    // an even and an odd start column, so both source parities are measured
+    const int32_t xs[] = {40, 41};
+    for (size_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++)
+    {
+        memset(framebuffer, 0xFF, FB_SIZE);
+        memset(reference, 0xFF, FB_SIZE);
+        int64_t blend_ns = draw_writeln(xs[i], framebuffer);
+        int64_t pixel_ns = draw_per_pixel(xs[i], reference);
+        if (memcmp(framebuffer, reference, FB_SIZE) != 0)
+        {
+            printf("x %d: per pixel blend differs\n", xs[i]);
+        }
+        printf("x %d  byte pairs %7.1f Mpx/s  per pixel %7.1f Mpx/s  (%lld px)\n", xs[i],
+               pixels * 1000.0 / blend_ns, pixels * 1000.0 / pixel_ns, (long long)pixels);
+    }
+    return 0;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,99 @@
+/**
+ * Per-wake CPU time of display_draw_time_and_date() over two hours of minute
+ * wakes, including a battery warning and a date change. Every wake starts
+ * like after deep sleep: empty glyph cache and display_init().
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "display.h"
+#include "epd_driver.h"
+#include "glyph_cache.h"
+#include "host_stubs.h"
+#include "host_test.h"
+
+#include <stdio.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define WAKES 121
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static int64_t cleared_pixels;
+static int32_t panel_updates;
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+void __wrap_epd_clear_area_cycles(Rect_t area, int32_t cycles, int32_t cycle_time)
+{
+    (void)cycle_time;
+    cleared_pixels += (int64_t)area.width * area.height * cycles;
+}
+
+
+void __wrap_epd_draw_grayscale_image(Rect_t area, uint8_t *data)
+{
+    (void)area;
+    (void)data;
+    panel_updates++;
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    host_flash_reset();
+
+    int64_t full_ns = 0, partial_ns = 0;
+    int32_t full_wakes = 0, partial_wakes = 0;
+    for (int32_t wake = 0; wake < WAKES; wake++)
+    {
+        // 23:00 to 01:00, battery low from 23:47
+        int32_t minutes = (23 * 60 + wake) % (24 * 60);
+        char time_str[8];
+        snprintf(time_str, sizeof(time_str), "%02d:%02d", minutes / 60, minutes % 60);
+        const char *date_str = wake < 60 ? "Monday, January 1 2024" : "Tuesday, January 2 2024";
+        bool full_clear = wake == 0 || minutes % 30 == 0;
+        bool battery_low = wake >= 47;
+
+        int64_t start = host_time_ns();
+        glyph_cache_clear();
+        display_init();
+        display_draw_time_and_date(time_str, date_str, NULL, full_clear, battery_low);
+        int64_t elapsed = host_time_ns() - start;
+
+        if (full_clear)
+        {
+            full_ns += elapsed;
+            full_wakes++;
+        }
+        else
+        {
+            partial_ns += elapsed;
+            partial_wakes++;
+        }
+    }
+
+    printf("full wakes    %4d  %8.1f us/wake\n", full_wakes, full_ns / 1000.0 / full_wakes);
+    printf("partial wakes %4d  %8.1f us/wake\n", partial_wakes,
+           partial_ns / 1000.0 / partial_wakes);
+    printf("panel updates %4d  %8.0f cleared pixels/wake\n", panel_updates,
+           (double)cleared_pixels / WAKES);
+    printf("flash writes  %4u\n", (unsigned)host_flash_writes());
+    return 0;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,117 @@
+/**
+ * epd_diff() throughput on 960x540 framebuffers for typical damage patterns,
+ * compared with a plain byte loop.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_diff.h"
+#include "host_test.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FB_SIZE    (EPD_WIDTH / 2 * EPD_HEIGHT)
+#define MAX_RECTS  8
+#define ITERATIONS 2000
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static uint32_t prev_words[FB_SIZE / 4];
+static uint32_t next_words[FB_SIZE / 4];
+static uint8_t *const prev = (uint8_t *)prev_words;
+static uint8_t *const next = (uint8_t *)next_words;
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void fill(uint8_t *fb, Rect_t area, uint8_t color)
+{
+    for (int32_t y = area.y; y < area.y + area.height; y++)
+    {
+        memset(&fb[y * EPD_WIDTH / 2 + area.x / 2], color * 0x11, area.width / 2);
+    }
+}
+
+
+/**
+ * @brief Bounding box of all changes, one byte at a time.
+ */
+static int32_t byte_diff(Rect_t *rect)
+{
+    int32_t x0 = EPD_WIDTH, y0 = EPD_HEIGHT, x1 = -1, y1 = -1;
+    for (int32_t y = 0; y < EPD_HEIGHT; y++)
+    {
+        for (int32_t x = 0; x < EPD_WIDTH / 2; x++)
+        {
+            if (prev[y * EPD_WIDTH / 2 + x] != next[y * EPD_WIDTH / 2 + x])
+            {
+                x0 = 2 * x < x0 ? 2 * x : x0;
+                x1 = 2 * x + 1 > x1 ? 2 * x + 1 : x1;
+                y0 = y < y0 ? y : y0;
+                y1 = y;
+            }
+        }
+    }
+    *rect = (Rect_t){.x = x0, .y = y0, .width = x1 - x0 + 1, .height = y1 - y0 + 1};
+    return x1 >= 0;
+}
+
+
+static void run(const char *name)
+{
+    Rect_t rects[MAX_RECTS];
+    volatile int32_t sink = 0;
+
+    int64_t start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        sink += epd_diff(prev, next, rects, MAX_RECTS);
+    }
+    int64_t diff_ns = (host_time_ns() - start) / ITERATIONS;
+
+    start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        sink += byte_diff(rects);
+    }
+    int64_t byte_ns = (host_time_ns() - start) / ITERATIONS;
+
+    printf("%-22s epd_diff %7.1f us  (%6.2f GB/s)   byte loop %7.1f us\n", name,
+           diff_ns / 1000.0, 2.0 * FB_SIZE / diff_ns, byte_ns / 1000.0);
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    memset(prev, 0xFF, FB_SIZE);
+    memset(next, 0xFF, FB_SIZE);
+    run("identical");
+
+    fill(prev, (Rect_t){.x = 300, .y = 150, .width = 360, .height = 140}, 0x0);
+    memcpy(next, prev, FB_SIZE);
+    fill(next, (Rect_t){.x = 560, .y = 170, .width = 80, .height = 100}, 0xF);
+    run("one digit changed");
+
+    fill(next, (Rect_t){.x = 320, .y = 170, .width = 300, .height = 100}, 0xF);
+    run("all digits changed");
+
+    memset(next, 0x00, FB_SIZE);
+    run("full frame changed");
+    return 0;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,115 @@
+/**
+ * Memory and clear time of the tiled framebuffer against a full 4 bit
+ * framebuffer, for an empty panel, the date line alone, the clock face and a
+ * full-screen pattern.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "Quicksand_140.h"
+#include "Quicksand_28.h"
+#include "epd_tiles.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FB_SIZE    (EPD_WIDTH / 2 * EPD_HEIGHT)
+#define ITERATIONS 200
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static uint8_t framebuffer[FB_SIZE];
+static uint8_t scratch[FB_SIZE];
+static EpdTiles tiles;
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void run(const char *name)
+{
+    static uint8_t row[EPD_WIDTH / 2];
+
+    // clearing a tiled framebuffer also releases its tile data, so every
+    // round starts from the layout again
+    int64_t clear_ns = 0;
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        epd_tiles_copy_from_framebuffer(&tiles, framebuffer);
+        int64_t start = host_time_ns();
+        epd_tiles_clear(&tiles, 0xF0);
+        clear_ns += host_time_ns() - start;
+    }
+
+    int64_t start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        memset(scratch + (i & 1), 0xFF, FB_SIZE - 1);
+    }
+    int64_t memset_ns = host_time_ns() - start;
+
+    epd_tiles_copy_from_framebuffer(&tiles, framebuffer);
+    start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        for (int32_t y = 0; y < EPD_HEIGHT; y++)
+        {
+            epd_tiles_get_row(&tiles, y, row);
+        }
+    }
+    int64_t rows_ns = host_time_ns() - start;
+    epd_tiles_copy_to_framebuffer(&tiles, scratch);
+    if (memcmp(scratch, framebuffer, FB_SIZE) != 0)
+    {
+        printf("%s: tiled framebuffer differs\n", name);
+    }
+
+    printf("%-12s %7zu bytes (framebuffer %d)  clear %6.2f us (memset %6.2f us)  "
+           "frame of rows %6.1f us\n",
+           name, epd_tiles_memory(&tiles), FB_SIZE, clear_ns / 1000.0 / ITERATIONS,
+           memset_ns / 1000.0 / ITERATIONS, rows_ns / 1000.0 / ITERATIONS);
+    epd_tiles_clear(&tiles, 0xF0);
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    epd_tiles_init(&tiles, 0xF0);
+
+    memset(framebuffer, 0xFF, FB_SIZE);
+    run("empty");
+
+    memset(framebuffer, 0xFF, FB_SIZE);
+    int32_t x = 280, y = 400;
+    writeln((GFXfont *)&Quicksand_28, "Monday, January 1 2024", &x, &y, framebuffer);
+    run("date line");
+
+    x = 130;
+    y = 300;
+    writeln((GFXfont *)&Quicksand_140, "12:34", &x, &y, framebuffer);
+    run("clock face");
+
+    uint32_t seed = 1;
+    for (int32_t i = 0; i < FB_SIZE; i++)
+    {
+        framebuffer[i] = host_random(&seed);
+    }
+    run("noise");
+    return 0;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,161 @@
+/**
+ * Code point lookup in a synthetic font of 6185 glyphs in 2000 intervals,
+ * printable ASCII followed by short CJK-like ranges, by the former linear
+ * scan, the binary search and the page table of `fontconvert.py --page-index`.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define GLYPH_COUNT    6185
+#define INTERVAL_COUNT 2000
+#define CJK_FIRST      0x4E00
+#define LOOKUPS        4096
+#define ITERATIONS     200
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static GFXglyph glyphs[GLYPH_COUNT];
+static UnicodeInterval intervals[INTERVAL_COUNT];
+static uint32_t code_points[LOOKUPS];
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+// ASCII, then 1999 ranges of 3 or 4 code points with gaps of 1 to 32
+static void generate_font(GFXfont *font)
+{
+    uint32_t seed = 1;
+    intervals[0] = (UnicodeInterval){0x20, 0x7E, 0};
+    uint32_t offset = 95;
+    uint32_t next = CJK_FIRST;
+    uint32_t longer = GLYPH_COUNT - 95 - 3 * (INTERVAL_COUNT - 1);
+    for (uint32_t i = 1; i < INTERVAL_COUNT; i++)
+    {
+        uint32_t length = i <= longer ? 4 : 3;
+        intervals[i] = (UnicodeInterval){next, next + length - 1, offset};
+        offset += length;
+        next += length + 1 + host_random(&seed) % 32;
+    }
+    for (uint32_t i = 0; i < GLYPH_COUNT; i++)
+    {
+        glyphs[i].data_offset = i;
+    }
+
+    *font = (GFXfont){.glyph = glyphs, .intervals = intervals, .interval_count = INTERVAL_COUNT};
+}
+
+
+// pages for all code points of the font, as fontconvert.py emits them
+static void build_pages(GFXfont *font)
+{
+    uint32_t last = intervals[INTERVAL_COUNT - 1].last;
+    font->glyph_page_count = last / GLYPH_PAGE_SIZE + 1;
+    font->glyph_pages = calloc(font->glyph_page_count, sizeof(uint16_t *));
+    for (uint32_t i = 0; i < INTERVAL_COUNT; i++)
+    {
+        for (uint32_t cp = intervals[i].first; cp <= intervals[i].last; cp++)
+        {
+            uint16_t **page = &font->glyph_pages[cp / GLYPH_PAGE_SIZE];
+            if (!*page)
+            {
+                *page = calloc(GLYPH_PAGE_SIZE, sizeof(uint16_t));
+            }
+            (*page)[cp % GLYPH_PAGE_SIZE] = intervals[i].offset + (cp - intervals[i].first) + 1;
+        }
+    }
+}
+
+
+// get_glyph before the binary search
+static void get_glyph_linear(const GFXfont *font, uint32_t code_point, GFXglyph **glyph)
+{
+    UnicodeInterval *intervals = font->intervals;
+    *glyph = NULL;
+    for (uint32_t i = 0; i < font->interval_count; i++)
+    {
+        UnicodeInterval *interval = &intervals[i];
+        if (code_point >= interval->first && code_point <= interval->last)
+        {
+            *glyph = &font->glyph[interval->offset + (code_point - interval->first)];
+            return;
+        }
+        if (code_point < interval->first)
+        {
+            return;
+        }
+    }
+}
+
+
+static double run(const GFXfont *font,
+                  void (*lookup)(const GFXfont *, uint32_t, GFXglyph **), uint32_t *sum)
+{
+    *sum = 0;
+    int64_t start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        for (int32_t j = 0; j < LOOKUPS; j++)
+        {
+            GFXglyph *glyph;
+            lookup(font, code_points[j], &glyph);
+            *sum += glyph ? glyph->data_offset + 1 : 0;
+        }
+    }
+    return (double)(host_time_ns() - start) / ITERATIONS / LOOKUPS;
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    GFXfont font;
+    generate_font(&font);
+
+    // code points within the intervals, some misses in the gaps between them
+    uint32_t seed = 2;
+    uint32_t last = intervals[INTERVAL_COUNT - 1].last;
+    for (int32_t i = 0; i < LOOKUPS; i++)
+    {
+        const UnicodeInterval *interval = &intervals[host_random(&seed) % INTERVAL_COUNT];
+        uint32_t length = interval->last - interval->first + 1;
+        code_points[i] = i % 8 ? interval->first + host_random(&seed) % length
+                               : CJK_FIRST + host_random(&seed) % (last - CJK_FIRST);
+    }
+
+    uint32_t linear_sum, binary_sum, page_sum;
+    double linear_ns = run(&font, get_glyph_linear, &linear_sum);
+    double binary_ns = run(&font, get_glyph, &binary_sum);
+    build_pages(&font);
+    double page_ns = run(&font, get_glyph, &page_sum);
+
+    printf("%d glyphs in %d intervals, %d random lookups\n", GLYPH_COUNT, INTERVAL_COUNT,
+           LOOKUPS);
+    printf("linear scan %7.1f ns\nbinary      %7.1f ns\npage table  %7.1f ns\n", linear_ns,
+           binary_ns, page_ns);
+    if (binary_sum != linear_sum || page_sum != linear_sum)
+    {
+        printf("lookups differ\n");
+        return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
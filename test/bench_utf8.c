@@ -0,0 +1,105 @@
+/**
+ * Decoding speed of utf8_decode, which takes ASCII runs a word at a time,
+ * against utf8_next called per code point, for ASCII, Latin and CJK text.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "host_test.h"
+#include "utf8.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define TEXT_SIZE  (64 * 1024)
+#define BLOCK      64
+#define ITERATIONS 200
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static char text[TEXT_SIZE + 1];
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void fill(const char *sample)
+{
+    size_t length = strlen(sample);
+    size_t size = 0;
+    while (size + length <= TEXT_SIZE)
+    {
+        memcpy(&text[size], sample, length);
+        size += length;
+    }
+    text[size] = '\0';
+}
+
+
+static void run(const char *name, const char *sample)
+{
+    fill(sample);
+    size_t size = strlen(text);
+    const char *end = text + size;
+
+    uint32_t decode_sum = 0;
+    int64_t start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        const char *string = text;
+        uint32_t code_points[BLOCK];
+        uint32_t n;
+        while ((n = utf8_decode(&string, end, code_points, BLOCK)))
+        {
+            for (uint32_t j = 0; j < n; j++)
+            {
+                decode_sum += code_points[j];
+            }
+        }
+    }
+    int64_t decode_ns = host_time_ns() - start;
+
+    uint32_t next_sum = 0;
+    start = host_time_ns();
+    for (int32_t i = 0; i < ITERATIONS; i++)
+    {
+        const char *string = text;
+        uint32_t c;
+        while ((c = utf8_next(&string)))
+        {
+            next_sum += c;
+        }
+    }
+    int64_t next_ns = host_time_ns() - start;
+
+    printf("%-6s utf8_decode %7.1f MB/s  utf8_next %7.1f MB/s\n", name,
+           (double)size * ITERATIONS * 1000 / decode_ns,
+           (double)size * ITERATIONS * 1000 / next_ns);
+    if (decode_sum != next_sum)
+    {
+        printf("%s: decoders differ\n", name);
+    }
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    run("ASCII", "Monday, January 1 2024 12:30 ");
+    run("Latin", "Sonnabend, 1. M\xC3\xA4rz \xE2\x80\x93 d\xC3\xA9j\xC3\xA0 vu ");
+    run("CJK", "\xE6\x98\x9F\xE6\x9C\x9F\xE4\xB8\x80 1\xE6\x9C\x88 1\xE6\x97\xA5 ");
+    return 0;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,289 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "host_stubs.h"
+
+#include "ed047tc1.h"
+#include "epd_driver.h"
+
+#include <esp_app_desc.h>
+#include <esp_partition.h>
+#include <freertos/FreeRTOS.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define PARTITION_COUNT (sizeof(partitions) / sizeof(partitions[0]))
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/**
+ * @brief data partitions of partitions.csv, backed by `flash`.
+ */
+static esp_partition_t partitions[] = {
+    {ESP_PARTITION_TYPE_DATA, 0x40, 0x000000, 512 * 1024, 4096, "atlas"},
+    {ESP_PARTITION_TYPE_DATA, 0x41, 0x080000, 1024 * 1024, 4096, "fonts"},
+    {ESP_PARTITION_TYPE_DATA, 0x42, 0x180000, 256 * 1024, 4096, "layers"},
+};
+
+static uint8_t flash[0x1C0000];
+static bool flash_erased;
+static uint32_t flash_writes;
+
+static uint8_t row_buffers[2][EPD_WIDTH / 4];
+static int32_t current_buffer;
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+void host_flash_reset()
+{
+    memset(flash, 0xFF, sizeof(flash));
+    flash_erased = true;
+    flash_writes = 0;
+}
+
+
+uint32_t host_flash_writes()
+{
+    return flash_writes;
+}
+
+
+const esp_app_desc_t *esp_app_get_description()
+{
+    static const esp_app_desc_t app = {.project_name = "host"};
+    return &app;
+}
+
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+    if (!flash_erased)
+    {
+        host_flash_reset();
+    }
+    for (size_t i = 0; i < PARTITION_COUNT; i++)
+    {
+        if (partitions[i].type == type &&
+            (subtype == ESP_PARTITION_SUBTYPE_ANY || partitions[i].subtype == subtype) &&
+            (!label || strcmp(partitions[i].label, label) == 0))
+        {
+            return &partitions[i];
+        }
+    }
+    return NULL;
+}
+
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle)
+{
+    (void)memory;
+    if (offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_ptr = &flash[partition->address + offset];
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+    (void)handle;
+}
+
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset,
+                                    size_t size)
+{
+    if (offset % partition->erase_size || size % partition->erase_size ||
+        offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(&flash[partition->address + offset], 0xFF, size);
+    return ESP_OK;
+}
+
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t offset,
+                              const void *src, size_t size)
+{
+    if (offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    // like NOR flash, a write can only clear bits
+    uint8_t *dst = &flash[partition->address + offset];
+    for (size_t i = 0; i < size; i++)
+    {
+        dst[i] &= ((const uint8_t *)src)[i];
+    }
+    flash_writes++;
+    return ESP_OK;
+}
+
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t offset, void *dst,
+                             size_t size)
+{
+    if (offset + size > partition->size)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(dst, &flash[partition->address + offset], size);
+    return ESP_OK;
+}
+
+
+void epd_base_init(uint32_t epd_row_width)
+{
+    (void)epd_row_width;
+}
+
+
+void epd_poweron()
+{
+}
+
+
+void epd_poweroff()
+{
+}
+
+
+void epd_poweroff_all()
+{
+}
+
+
+void epd_start_frame()
+{
+}
+
+
+void epd_end_frame()
+{
+}
+
+
+void epd_output_row(uint32_t output_time_dus)
+{
+    (void)output_time_dus;
+}
+
+
+void epd_skip()
+{
+}
+
+
+uint8_t *epd_get_current_buffer()
+{
+    return row_buffers[current_buffer];
+}
+
+
+void epd_switch_buffer()
+{
+    current_buffer ^= 1;
+}
+
+
+void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+
+
+QueueHandle_t xQueueCreate(int length, int item_size)
+{
+    (void)length;
+    return calloc(1, item_size);
+}
+
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    (void)queue;
+    (void)item;
+    (void)ticks;
+    return 1;
+}
+
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    (void)queue;
+    (void)item;
+    (void)ticks;
+    return 1;
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+    static int semaphore;
+    return &semaphore;
+}
+
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    (void)semaphore;
+    (void)ticks;
+    return 1;
+}
+
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    (void)semaphore;
+    return 1;
+}
+
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    (void)semaphore;
+}
+
+
+BaseType_t xTaskCreatePinnedToCore(void (*task)(void *), const char *name, int stack_depth,
+                                   void *param, int priority, TaskHandle_t *handle, int core)
+{
+    // the panel is not driven on the host, the output tasks are never run
+    (void)task;
+    (void)name;
+    (void)stack_depth;
+    (void)param;
+    (void)priority;
+    (void)core;
+    *handle = NULL;
+    return 1;
+}
+
+
+void vTaskDelete(TaskHandle_t task)
+{
+    (void)task;
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,40 @@
+/**
+ * Host replacements for the panel bus, FreeRTOS and the flash partitions, so
+ * the einkdrv component and the display code can be exercised on a PC.
+ */
+
+#ifndef _HOST_STUBS_H_
+#define _HOST_STUBS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Erase all RAM backed partitions and reset the flash statistics.
+ */
+void host_flash_reset();
+
+/**
+ * @brief Number of esp_partition_write() calls since the last reset.
+ */
+uint32_t host_flash_writes();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,76 @@
+/**
+ * Minimal assertion and timing helpers shared by the host tests and
+ * benchmarks.
+ */
+
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Report a failed condition and count it, the test keeps running.
+ */
+#define CHECK(cond)                                                           \
+    do                                                                        \
+    {                                                                         \
+        if (!(cond))                                                          \
+        {                                                                     \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+                    #cond);                                                   \
+            host_test_failures++;                                             \
+        }                                                                     \
+    } while (0)
+
+/**
+ * @brief Exit status of a test, non-zero if any CHECK() failed.
+ */
+#define TEST_RESULT() (host_test_failures ? 1 : 0)
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+static int host_test_failures;
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Monotonic time in nanoseconds.
+ */
+static inline int64_t host_time_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+/**
+ * @brief Deterministic xorshift random numbers, so failures are reproducible.
+ */
+static inline uint32_t host_random(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
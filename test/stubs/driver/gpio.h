@@ -0,0 +1,6 @@
+/**
+ * Host stand-in for the ESP-IDF header of the same name, the panel GPIOs are
+ * not driven on the host.
+ */
+
+#pragma once
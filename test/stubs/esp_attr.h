@@ -0,0 +1,11 @@
+/**
+ * Host stand-in for the ESP-IDF header of the same name, placement attributes
+ * have no meaning on the host.
+ */
+
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define EXT_RAM_BSS_ATTR
@@ -0,0 +1,14 @@
+/**
+ * Host stand-in for the ESP-IDF header of the same name, all levels go to
+ * stderr.
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, ...) (fprintf(stderr, "%s: ", tag), fprintf(stderr, __VA_ARGS__), \
+                            fprintf(stderr, "\n"))
+#define ESP_LOGW ESP_LOGE
+#define ESP_LOGI ESP_LOGE
+#define ESP_LOGD ESP_LOGE
@@ -0,0 +1,28 @@
+/**
+ * Host stand-in for the FreeRTOS header of the same name, see host_stubs.c.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef void *QueueHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void *TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define portMAX_DELAY   0xffffffff
+#define pdMS_TO_TICKS(ms) (ms)
+
+void vTaskDelay(TickType_t ticks);
+QueueHandle_t xQueueCreate(int length, int item_size);
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+BaseType_t xTaskCreatePinnedToCore(void (*task)(void *), const char *name, int stack_depth,
+                                   void *param, int priority, TaskHandle_t *handle, int core);
+void vTaskDelete(TaskHandle_t task);
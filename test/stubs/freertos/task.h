@@ -0,0 +1,7 @@
+/**
+ * Host stand-in for the FreeRTOS header of the same name.
+ */
+
+#pragma once
+
+#include "FreeRTOS.h"
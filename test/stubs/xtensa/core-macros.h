@@ -0,0 +1,5 @@
+/**
+ * Host stand-in for the Xtensa header of the same name.
+ */
+
+#pragma once
@@ -0,0 +1,89 @@
+/**
+ * Glyphs inflated straight into the canvas must look exactly like glyphs drawn
+ * from the glyph cache, and glyphs drawn again must end up in the cache.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "Quicksand_140.h"
+#include "Roboto_150.h"
+#include "epd_driver.h"
+#include "glyph_cache.h"
+#include "host_test.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FB_SIZE (EPD_WIDTH / 2 * EPD_HEIGHT)
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static uint8_t canvas[FB_SIZE];
+static uint8_t cached[FB_SIZE];
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void draw(const GFXfont *font, const char *str, uint8_t *framebuffer)
+{
+    // odd and even start columns, partly outside the framebuffer
+    const int32_t xs[] = {-31, 101, 514};
+    memset(framebuffer, 0xFF, FB_SIZE);
+    for (size_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++)
+    {
+        int32_t x = xs[i];
+        int32_t y = 200 + 150 * i;
+        writeln((GFXfont *)font, str, &x, &y, framebuffer);
+    }
+}
+
+
+static void test_font(const GFXfont *font)
+{
+    GlyphCacheStats stats;
+
+    // "0" and "7" are drawn twice, the second time from the cache
+    glyph_cache_clear();
+    int32_t x = 0, y = 200;
+    memset(canvas, 0xFF, FB_SIZE);
+    writeln((GFXfont *)font, "07:3", &x, &y, canvas);
+    glyph_cache_get_stats(&stats);
+    CHECK(stats.entries == 0);
+    x = 0;
+    writeln((GFXfont *)font, "07", &x, &y, canvas);
+    glyph_cache_get_stats(&stats);
+    CHECK(stats.entries == 2);
+
+    // every glyph is drawn at three positions: once inflated into the canvas
+    // and then from the cache, against all of them from the cache
+    glyph_cache_clear();
+    draw(font, "0123456789:", canvas);
+    glyph_cache_clear();
+    prewarm_glyph_cache(font, GLYPH_CACHE_DIGITS);
+    draw(font, "0123456789:", cached);
+    CHECK(memcmp(canvas, cached, FB_SIZE) == 0);
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    glyph_cache_set_budget(1024 * 1024);
+    test_font(&Quicksand_140);
+    test_font(&Roboto_150);
+    return TEST_RESULT();
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,223 @@
+/**
+ * Partial refreshes of the layered clock face against full refreshes of the
+ * same content, on a model of the panel: clearing turns an area white, drawing
+ * can only darken pixels, and drawing ink twice without clearing in between
+ * darkens it beyond its level.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "display.h"
+#include "epd_driver.h"
+#include "glyph_cache.h"
+#include "host_stubs.h"
+#include "host_test.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FB_SIZE (EPD_WIDTH / 2 * EPD_HEIGHT)
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static uint8_t panel[FB_SIZE];
+static bool inked[EPD_WIDTH * EPD_HEIGHT];
+static int32_t overdriven_pixels;
+static uint8_t last_image[FB_SIZE];
+static int32_t panel_updates;
+static int64_t cleared_pixels;
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+void __wrap_epd_clear_area_cycles(Rect_t area, int32_t cycles, int32_t cycle_time)
+{
+    (void)cycles;
+    (void)cycle_time;
+    for (int32_t y = area.y; y < area.y + area.height; y++)
+    {
+        for (int32_t x = area.x; x < area.x + area.width; x++)
+        {
+            panel[y * EPD_WIDTH / 2 + x / 2] |= x & 1 ? 0xF0 : 0x0F;
+            inked[y * EPD_WIDTH + x] = false;
+        }
+    }
+    cleared_pixels += (int64_t)area.width * area.height;
+}
+
+
+void __wrap_epd_draw_grayscale_image(Rect_t area, uint8_t *data)
+{
+    CHECK(area.x == 0 && area.y == 0 && area.width == EPD_WIDTH && area.height == EPD_HEIGHT);
+    for (int32_t i = 0; i < EPD_WIDTH * EPD_HEIGHT; i++)
+    {
+        uint8_t ink = i & 1 ? data[i / 2] >> 4 : data[i / 2] & 0x0F;
+        if (ink != 0xF)
+        {
+            overdriven_pixels += inked[i];
+            inked[i] = true;
+        }
+    }
+    for (int32_t i = 0; i < FB_SIZE; i++)
+    {
+        uint8_t lo = (panel[i] & 0x0F) < (data[i] & 0x0F) ? panel[i] & 0x0F : data[i] & 0x0F;
+        uint8_t hi = (panel[i] & 0xF0) < (data[i] & 0xF0) ? panel[i] & 0xF0 : data[i] & 0xF0;
+        panel[i] = hi | lo;
+    }
+    memcpy(last_image, data, FB_SIZE);
+    panel_updates++;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+/**
+ * @brief One wake: an empty glyph cache and display_init() like after deep
+ *        sleep.
+ */
+static void wake(const char *time_str, const char *date_str, const char *timezone_str,
+                 bool full_clear, bool battery_low)
+{
+    glyph_cache_clear();
+    display_init();
+    display_draw_time_and_date(time_str, date_str, timezone_str, full_clear, battery_low);
+}
+
+
+/**
+ * @brief A partial refresh must leave the panel exactly like a full refresh
+ *        of the same content.
+ */
+static void check_partial(const char *time_str, const char *date_str, const char *timezone_str,
+                          bool battery_low)
+{
+    static uint8_t partial[FB_SIZE];
+
+    wake(time_str, date_str, timezone_str, false, battery_low);
+    memcpy(partial, panel, FB_SIZE);
+    wake(time_str, date_str, timezone_str, true, battery_low);
+
+    bool same = memcmp(partial, last_image, FB_SIZE) == 0;
+    if (!same)
+    {
+        fprintf(stderr, "partial refresh to %s differs from a full refresh\n", time_str);
+    }
+    CHECK(same);
+}
+
+
+static void test_minutes()
+{
+    const char *date = "Monday, January 1 2024";
+    wake("23:00", date, NULL, true, false);
+
+    // every minute of an hour, which also moves the centered time
+    for (int32_t minute = 1; minute < 60; minute++)
+    {
+        char time_str[8];
+        snprintf(time_str, sizeof(time_str), "23:%02d", minute);
+        check_partial(time_str, date, NULL, false);
+    }
+    check_partial("00:00", "Tuesday, January 2 2024", NULL, false);
+}
+
+
+static void test_partial_area()
+{
+    const char *date = "Monday, January 1 2024";
+    wake("10:10", date, NULL, true, false);
+
+    // only the time is cleared, not the date line below it
+    cleared_pixels = 0;
+    wake("10:18", date, NULL, false, false);
+    int32_t after_digit = panel_updates;
+    CHECK(cleared_pixels > 0 && cleared_pixels < EPD_WIDTH * EPD_HEIGHT / 2);
+
+    // nothing changed, nothing to refresh
+    wake("10:18", date, NULL, false, false);
+    CHECK(panel_updates == after_digit);
+}
+
+
+static void test_static_layer()
+{
+    const char *date = "Wednesday, January 3 2024";
+    wake("08:00", date, NULL, true, false);
+    uint32_t writes = host_flash_writes();
+
+    // the static layer is kept in flash while its inputs stay the same
+    wake("08:01", date, NULL, false, false);
+    wake("08:02", date, NULL, false, false);
+    CHECK(host_flash_writes() == writes);
+
+    // the battery icon appears with a partial refresh of its area only
+    cleared_pixels = 0;
+    check_partial("08:03", date, NULL, true);
+    CHECK(host_flash_writes() > writes);
+
+    // and disappears again while the time stays the same
+    check_partial("08:03", date, NULL, false);
+
+    // a timezone line moves the time, which needs a full refresh
+    int32_t updates = panel_updates;
+    wake("08:04", date, "Quito 19:04", false, true);
+    CHECK(panel_updates == updates + 1);
+    check_partial("08:05", date, "Quito 19:05", true);
+}
+
+
+static void test_error()
+{
+    const char *date = "Thursday, January 4 2024";
+    wake("09:00", date, NULL, true, false);
+
+    // the error message clears the panel inside the driver, which the model
+    // does not see
+    int32_t overdriven = overdriven_pixels;
+    display_draw_error("RTC Error");
+    overdriven_pixels = overdriven;
+    for (int32_t i = 0; i < EPD_WIDTH * EPD_HEIGHT; i++)
+    {
+        uint8_t ink = i & 1 ? last_image[i / 2] >> 4 : last_image[i / 2] & 0x0F;
+        inked[i] = ink != 0xF;
+    }
+    memcpy(panel, last_image, FB_SIZE);
+
+    // the panel shows the error, the next update must not be partial
+    int64_t before = cleared_pixels;
+    wake("09:01", date, NULL, false, false);
+    CHECK(cleared_pixels - before == EPD_WIDTH * EPD_HEIGHT);
+    check_partial("09:02", date, NULL, false);
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    host_flash_reset();
+    test_minutes();
+    test_partial_area();
+    test_static_layer();
+    test_error();
+    if (overdriven_pixels)
+    {
+        fprintf(stderr, "%d pixels drawn twice without clearing\n", overdriven_pixels);
+    }
+    CHECK(overdriven_pixels == 0);
+    return TEST_RESULT();
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
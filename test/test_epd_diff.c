@@ -0,0 +1,327 @@
+/**
+ * epd_diff() against a per-pixel reference on synthetic damage patterns.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_diff.h"
+#include "host_test.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FB_SIZE   (EPD_WIDTH / 2 * EPD_HEIGHT)
+#define MAX_RECTS 16
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static uint32_t prev_words[FB_SIZE / 4];
+static uint32_t next_words[FB_SIZE / 4];
+static uint8_t *const prev = (uint8_t *)prev_words;
+static uint8_t *const next = (uint8_t *)next_words;
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void set_pixel(uint8_t *fb, int32_t x, int32_t y, uint8_t color)
+{
+    uint8_t *byte = &fb[y * EPD_WIDTH / 2 + x / 2];
+    *byte = x & 1 ? (*byte & 0x0F) | (color << 4) : (*byte & 0xF0) | color;
+}
+
+
+static uint8_t get_pixel(const uint8_t *fb, int32_t x, int32_t y)
+{
+    uint8_t byte = fb[y * EPD_WIDTH / 2 + x / 2];
+    return x & 1 ? byte >> 4 : byte & 0x0F;
+}
+
+
+static void fill(uint8_t *fb, Rect_t area, uint8_t color)
+{
+    for (int32_t y = area.y; y < area.y + area.height; y++)
+    {
+        for (int32_t x = area.x; x < area.x + area.width; x++)
+        {
+            set_pixel(fb, x, y, color);
+        }
+    }
+}
+
+
+static void reset()
+{
+    memset(prev, 0xFF, FB_SIZE);
+    memset(next, 0xFF, FB_SIZE);
+}
+
+
+/**
+ * @brief Pixel by pixel implementation of the documented behaviour.
+ */
+static int32_t reference_diff(Rect_t *rects)
+{
+    int32_t count = 0;
+    int32_t last_changed = -EPD_DIFF_MERGE_GAP - 2;
+    for (int32_t y = 0; y < EPD_HEIGHT; y++)
+    {
+        int32_t first = -1, last = -1;
+        for (int32_t x = 0; x < EPD_WIDTH; x++)
+        {
+            if (get_pixel(prev, x, y) != get_pixel(next, x, y))
+            {
+                first = first < 0 ? x : first;
+                last = x;
+            }
+        }
+        if (first < 0)
+        {
+            continue;
+        }
+        if (count && y - last_changed - 1 <= EPD_DIFF_MERGE_GAP)
+        {
+            Rect_t *r = &rects[count - 1];
+            int32_t x1 = r->x + r->width > last + 1 ? r->x + r->width : last + 1;
+            r->x = first < r->x ? first : r->x;
+            r->width = x1 - r->x;
+            r->height = y - r->y + 1;
+        }
+        else
+        {
+            rects[count++] = (Rect_t){.x = first, .y = y, .width = last - first + 1,
+                                      .height = 1};
+        }
+        last_changed = y;
+    }
+    return count;
+}
+
+
+static bool covered(const Rect_t *rects, int32_t count, int32_t x, int32_t y)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (x >= rects[i].x && x < rects[i].x + rects[i].width &&
+            y >= rects[i].y && y < rects[i].y + rects[i].height)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief epd_diff() must match the reference exactly.
+ */
+static void check_exact(const char *name)
+{
+    Rect_t expected[EPD_HEIGHT];
+    Rect_t rects[MAX_RECTS];
+    int32_t expected_count = reference_diff(expected);
+    int32_t count = epd_diff(prev, next, rects, MAX_RECTS);
+
+    bool same = expected_count == count;
+    for (int32_t i = 0; same && i < count; i++)
+    {
+        same = memcmp(&expected[i], &rects[i], sizeof(Rect_t)) == 0;
+    }
+    if (!same)
+    {
+        fprintf(stderr, "%s: %d rects, expected %d\n", name, count, expected_count);
+    }
+    CHECK(same);
+}
+
+
+/**
+ * @brief With too few rectangles the result must still cover every change.
+ */
+static void check_covers(const char *name, int32_t max_rects)
+{
+    Rect_t rects[MAX_RECTS];
+    int32_t count = epd_diff(prev, next, rects, max_rects);
+    CHECK(count <= max_rects);
+
+    int32_t missed = 0;
+    for (int32_t y = 0; y < EPD_HEIGHT; y++)
+    {
+        for (int32_t x = 0; x < EPD_WIDTH; x++)
+        {
+            if (get_pixel(prev, x, y) != get_pixel(next, x, y) &&
+                !covered(rects, count, x, y))
+            {
+                missed++;
+            }
+        }
+    }
+    if (missed)
+    {
+        fprintf(stderr, "%s: %d changed pixels not covered\n", name, missed);
+    }
+    CHECK(missed == 0);
+}
+
+
+static void test_identical()
+{
+    Rect_t rects[MAX_RECTS];
+    reset();
+    CHECK(epd_diff(prev, next, rects, MAX_RECTS) == 0);
+
+    // equal but non-blank content
+    fill(prev, (Rect_t){.x = 100, .y = 100, .width = 300, .height = 50}, 0x3);
+    fill(next, (Rect_t){.x = 100, .y = 100, .width = 300, .height = 50}, 0x3);
+    CHECK(epd_diff(prev, next, rects, MAX_RECTS) == 0);
+}
+
+
+static void test_single_pixels()
+{
+    // every nibble position of a 128 bit block, plus the frame corners
+    const int32_t xs[] = {0, 1, 7, 8, 31, 32, 33, 479, 480, 926, 927, 928, 958, 959};
+    const int32_t ys[] = {0, 1, 270, EPD_HEIGHT - 1};
+    for (size_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++)
+    {
+        for (size_t j = 0; j < sizeof(ys) / sizeof(ys[0]); j++)
+        {
+            Rect_t rects[MAX_RECTS];
+            reset();
+            set_pixel(next, xs[i], ys[j], 0x0);
+            int32_t count = epd_diff(prev, next, rects, MAX_RECTS);
+            CHECK(count == 1);
+            CHECK(rects[0].x == xs[i] && rects[0].y == ys[j]);
+            CHECK(rects[0].width == 1 && rects[0].height == 1);
+        }
+    }
+
+    // a change to a single grey level bit is still a change
+    Rect_t rects[MAX_RECTS];
+    reset();
+    set_pixel(next, 501, 33, 0xE);
+    CHECK(epd_diff(prev, next, rects, MAX_RECTS) == 1);
+    CHECK(rects[0].x == 501 && rects[0].width == 1);
+}
+
+
+static void test_blocks()
+{
+    reset();
+    fill(next, (Rect_t){.x = 13, .y = 20, .width = 101, .height = 40}, 0x0);
+    check_exact("one block");
+
+    // two blocks side by side share rows and become one rectangle
+    reset();
+    fill(next, (Rect_t){.x = 10, .y = 20, .width = 20, .height = 40}, 0x0);
+    fill(next, (Rect_t){.x = 900, .y = 30, .width = 59, .height = 40}, 0x0);
+    check_exact("side by side");
+
+    // the clock case: one digit replaced by another in the same cell
+    reset();
+    fill(prev, (Rect_t){.x = 300, .y = 150, .width = 90, .height = 140}, 0x0);
+    fill(next, (Rect_t){.x = 300, .y = 150, .width = 90, .height = 140}, 0x0);
+    fill(next, (Rect_t){.x = 320, .y = 170, .width = 50, .height = 100}, 0xF);
+    check_exact("digit");
+}
+
+
+static void test_merge_gap()
+{
+    Rect_t rects[MAX_RECTS];
+
+    // exactly EPD_DIFF_MERGE_GAP unchanged rows in between: merged
+    reset();
+    fill(next, (Rect_t){.x = 50, .y = 100, .width = 10, .height = 5}, 0x0);
+    fill(next, (Rect_t){.x = 70, .y = 105 + EPD_DIFF_MERGE_GAP, .width = 10, .height = 5}, 0x0);
+    CHECK(epd_diff(prev, next, rects, MAX_RECTS) == 1);
+    CHECK(rects[0].x == 50 && rects[0].width == 30);
+    CHECK(rects[0].y == 100 && rects[0].height == 10 + EPD_DIFF_MERGE_GAP);
+    check_exact("gap merged");
+
+    // one row more: two rectangles
+    reset();
+    fill(next, (Rect_t){.x = 50, .y = 100, .width = 10, .height = 5}, 0x0);
+    fill(next, (Rect_t){.x = 70, .y = 106 + EPD_DIFF_MERGE_GAP, .width = 10, .height = 5}, 0x0);
+    CHECK(epd_diff(prev, next, rects, MAX_RECTS) == 2);
+    check_exact("gap split");
+}
+
+
+static void test_overflow()
+{
+    // 27 separate stripes into 1, 4 and MAX_RECTS rectangles
+    reset();
+    for (int32_t i = 0; i < 27; i++)
+    {
+        fill(next, (Rect_t){.x = 17 * i, .y = 20 * i, .width = 5 + i, .height = 3}, 0x0);
+    }
+    check_covers("overflow 1", 1);
+    check_covers("overflow 4", 4);
+    check_covers("overflow 16", MAX_RECTS);
+
+    Rect_t rects[MAX_RECTS];
+    CHECK(epd_diff(prev, next, rects, MAX_RECTS) == MAX_RECTS);
+}
+
+
+static void test_random()
+{
+    uint32_t seed = 0x2545F491;
+    for (int32_t round = 0; round < 200; round++)
+    {
+        reset();
+        int32_t blobs = host_random(&seed) % 12;
+        for (int32_t i = 0; i < blobs; i++)
+        {
+            Rect_t area = {.x = host_random(&seed) % EPD_WIDTH,
+                           .y = host_random(&seed) % EPD_HEIGHT};
+            area.width = 1 + host_random(&seed) % (EPD_WIDTH - area.x < 64 ?
+                                                    EPD_WIDTH - area.x : 64);
+            area.height = 1 + host_random(&seed) % (EPD_HEIGHT - area.y < 32 ?
+                                                     EPD_HEIGHT - area.y : 32);
+            fill(host_random(&seed) & 1 ? next : prev, area, host_random(&seed) & 0xF);
+        }
+        // sparse single pixels as left by anti-aliased glyph edges
+        int32_t dots = host_random(&seed) % 8;
+        for (int32_t i = 0; i < dots; i++)
+        {
+            set_pixel(next, host_random(&seed) % EPD_WIDTH, host_random(&seed) % EPD_HEIGHT,
+                      host_random(&seed) & 0xF);
+        }
+
+        Rect_t expected[EPD_HEIGHT];
+        if (reference_diff(expected) <= MAX_RECTS)
+        {
+            check_exact("random");
+        }
+        check_covers("random", 1 + round % MAX_RECTS);
+    }
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    test_identical();
+    test_single_pixels();
+    test_blocks();
+    test_merge_gap();
+    test_overflow();
+    test_random();
+    return TEST_RESULT();
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
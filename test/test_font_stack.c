@@ -0,0 +1,56 @@
+/**
+ * Runs shaped from a font stack take every glyph from the first font that has
+ * it, and a stack of one font shapes like the font itself.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "Quicksand_18.h"
+#include "Quicksand_28.h"
+#include "font_stack.h"
+#include "host_test.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    const GFXfont *fonts[] = {&Quicksand_28, &Quicksand_18};
+    FontStack stack;
+    TextRun run, expected;
+
+    // the subset of Quicksand_28 lacks 'B' and '?', the euro sign is in
+    // neither font and drawn as the fallback
+    CHECK(font_stack_init(&stack, fonts, 2));
+    FontProperties props = {.fg_color = 0, .bg_color = 15, .fallback_glyph = '?'};
+    CHECK(font_stack_shape(&run, &stack, "Bay 7?\xE2\x82\xAC", &props));
+    const GFXfont *glyph_fonts[] = {&Quicksand_18, &Quicksand_28, &Quicksand_28, &Quicksand_28,
+                                    &Quicksand_28, &Quicksand_18, &Quicksand_18};
+    CHECK(run.glyph_count == 7);
+    for (uint32_t i = 0; i < run.glyph_count && i < 7; i++)
+    {
+        CHECK(run.glyphs[i].font == glyph_fonts[i]);
+    }
+    CHECK(run.glyphs[6].glyph == run.glyphs[5].glyph);
+    CHECK(run.font == &Quicksand_28);
+    font_stack_release(&stack);
+
+    // unused glyph slots are left as they are
+    memset(&run, 0, sizeof(TextRun));
+    memset(&expected, 0, sizeof(TextRun));
+    CHECK(font_stack_init(&stack, fonts, 1));
+    CHECK(font_stack_shape(&run, &stack, "Monday, 12:30", NULL));
+    CHECK(text_run_shape(&expected, &Quicksand_28, "Monday, 12:30", NULL));
+    CHECK(memcmp(&run, &expected, sizeof(TextRun)) == 0);
+    font_stack_release(&stack);
+    return TEST_RESULT();
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,73 @@
+/**
+ * An atlas stored in flash is mapped again for the same font and rendered
+ * anew once the glyph bitmaps change, even if the glyph metrics stay the same.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "glyph_atlas.h"
+#include "host_stubs.h"
+#include "host_test.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+// 'A', 3x2 pixels of 4 bit coverage
+static uint8_t bitmap[] = {0xF0, 0x0F, 0x0F, 0x0F};
+static GFXglyph glyphs[] = {{3, 2, 4, 0, 2, 0, 0}};
+static UnicodeInterval intervals[] = {{'A', 'A', 0}};
+static GFXfont font = {.bitmap = bitmap, .glyph = glyphs, .intervals = intervals,
+                       .interval_count = 1, .advance_y = 4, .ascender = 2};
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static bool draw(uint8_t *row)
+{
+    GlyphAtlas atlas;
+    CHECK(glyph_atlas_init(&atlas, &font, "A", NULL, "atlas"));
+    bool mapped = atlas.mapped;
+
+    static uint8_t framebuffer[EPD_WIDTH / 2 * EPD_HEIGHT];
+    memset(framebuffer, 0xFF, sizeof(framebuffer));
+    int32_t x = 0;
+    CHECK(glyph_atlas_write(&atlas, "A", &x, 2, framebuffer));
+    memcpy(row, framebuffer, 2);
+    glyph_atlas_release(&atlas);
+    return mapped;
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    uint8_t first[2], second[2];
+    host_flash_reset();
+
+    // rendered and stored once, then mapped
+    CHECK(!draw(first));
+    uint32_t writes = host_flash_writes();
+    CHECK(writes > 0);
+    CHECK(draw(second));
+    CHECK(host_flash_writes() == writes);
+    CHECK(memcmp(first, second, sizeof(first)) == 0);
+
+    // same metrics, different bitmap
+    bitmap[0] = 0x0F;
+    CHECK(!draw(second));
+    CHECK(host_flash_writes() > writes);
+    CHECK(memcmp(first, second, sizeof(first)) != 0);
+    return TEST_RESULT();
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,109 @@
+/**
+ * text_layout_write allocates no memory, also for fonts with a preset
+ * dictionary whose sliding window is taken from the scratch, and draws the
+ * same pixels as writeln. Linked with malloc and calloc wrapped.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "Quicksand_140.h"
+#include "Quicksand_28.h"
+#include "glyph_cache.h"
+#include "host_test.h"
+#include "text_layout.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define FB_SIZE (EPD_WIDTH / 2 * EPD_HEIGHT)
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static uint8_t framebuffer[FB_SIZE];
+static uint8_t expected[FB_SIZE];
+
+static uint32_t allocations;
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+
+
+void *__wrap_malloc(size_t size)
+{
+    allocations++;
+    return __real_malloc(size);
+}
+
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    allocations++;
+    return __real_calloc(n, size);
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void test_font(const GFXfont *font, const char *string)
+{
+    TextLine lines[4];
+    TextLayout layout;
+    TextLayoutOptions options = {0};
+    CHECK(text_layout_init(&layout, font, string, &options, NULL, lines, 4));
+    size_t scratch_size = text_layout_scratch_size(font);
+    uint8_t *scratch = malloc(scratch_size);
+
+    // first with the inflate streams not set up yet, then after writeln set
+    // them up with windows from the heap
+    for (int32_t round = 0; round < 2; round++)
+    {
+        glyph_cache_clear();
+        memset(framebuffer, 0xFF, FB_SIZE);
+        allocations = 0;
+        text_layout_write(&layout, 20, 300, framebuffer, scratch, scratch_size);
+        CHECK(allocations == 0);
+
+        glyph_cache_clear();
+        memset(expected, 0xFF, FB_SIZE);
+        int32_t x = 20, y = 300;
+        writeln((GFXfont *)font, string, &x, &y, expected);
+        CHECK(memcmp(framebuffer, expected, FB_SIZE) == 0);
+    }
+
+    // the stream lets go of the scratch window and draws from the heap again
+    memset(scratch, 0, scratch_size);
+    memset(framebuffer, 0xFF, FB_SIZE);
+    int32_t x = 20, y = 300;
+    writeln((GFXfont *)font, string, &x, &y, framebuffer);
+    CHECK(memcmp(framebuffer, expected, FB_SIZE) == 0);
+    free(scratch);
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    CHECK(Quicksand_28.dictionary != NULL);
+    test_font(&Quicksand_28, "Monday, January 1");
+    test_font(&Quicksand_140, "12:30");
+    return TEST_RESULT();
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,295 @@
+/**
+ * utf8_decode and utf8_next against a reference decoder built from the
+ * encodings of all scalar values: every byte string up to 3 bytes, the
+ * examples of the Unicode standard and random strings of mixed bytes.
+ * Malformed input must decode as one U+FFFD per maximal subpart.
+ */
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "host_test.h"
+#include "utf8.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+#define MAX_BYTES   64
+#define FUZZ_ROUNDS 200000
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/**
+ * @brief Byte strings of 1 to 3 bytes which start the encoding of some scalar
+ *        value, and those which are a whole encoding, as bit sets indexed by
+ *        the bytes in big endian order.
+ */
+static uint8_t prefixes[3][(1 << 24) / 8];
+static uint8_t complete[3][(1 << 24) / 8];
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static uint32_t encode(uint32_t cp, uint8_t *bytes)
+{
+    if (cp < 0x80)
+    {
+        bytes[0] = cp;
+        return 1;
+    }
+    if (cp < 0x800)
+    {
+        bytes[0] = 0xC0 | cp >> 6;
+        bytes[1] = 0x80 | (cp & 0x3F);
+        return 2;
+    }
+    if (cp < 0x10000)
+    {
+        bytes[0] = 0xE0 | cp >> 12;
+        bytes[1] = 0x80 | (cp >> 6 & 0x3F);
+        bytes[2] = 0x80 | (cp & 0x3F);
+        return 3;
+    }
+    bytes[0] = 0xF0 | cp >> 18;
+    bytes[1] = 0x80 | (cp >> 12 & 0x3F);
+    bytes[2] = 0x80 | (cp >> 6 & 0x3F);
+    bytes[3] = 0x80 | (cp & 0x3F);
+    return 4;
+}
+
+
+static inline bool test_bit(const uint8_t *set, uint32_t i)
+{
+    return set[i / 8] >> (i % 8) & 1;
+}
+
+
+static void build_reference()
+{
+    for (uint32_t cp = 0; cp <= 0x10FFFF; cp++)
+    {
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+        {
+            continue;
+        }
+        uint8_t bytes[4];
+        uint32_t length = encode(cp, bytes);
+        uint32_t key = 0;
+        for (uint32_t i = 0; i < length && i < 3; i++)
+        {
+            key = key << 8 | bytes[i];
+            prefixes[i][key / 8] |= 1 << (key % 8);
+        }
+        if (length <= 3)
+        {
+            complete[length - 1][key / 8] |= 1 << (key % 8);
+        }
+    }
+}
+
+
+// decode by the longest prefix of the input that starts a valid encoding
+static uint32_t reference_decode(const uint8_t *s, uint32_t available, uint32_t *length)
+{
+    uint32_t key = 0;
+    uint32_t valid = 0;
+    while (valid < available && valid < 4)
+    {
+        uint32_t next = key << 8 | s[valid];
+        // all 4 byte strings starting with a valid 3 byte prefix of a 4 byte
+        // encoding are complete if the last byte is a continuation byte
+        bool is_prefix = valid < 3 ? test_bit(prefixes[valid], next)
+                                   : (s[0] >= 0xF0 && (s[3] & 0xC0) == 0x80);
+        if (!is_prefix)
+        {
+            break;
+        }
+        key = next;
+        valid++;
+        if (valid < 4 ? test_bit(complete[valid - 1], key) : true)
+        {
+            *length = valid;
+            uint32_t cp = s[0] & (valid == 1 ? 0x7F : 0x7F >> valid);
+            for (uint32_t i = 1; i < valid; i++)
+            {
+                cp = cp << 6 | (s[i] & 0x3F);
+            }
+            return cp;
+        }
+    }
+    *length = valid ? valid : 1;
+    return UTF8_REPLACEMENT_CHARACTER;
+}
+
+
+static uint32_t reference_decode_all(const uint8_t *s, uint32_t size, uint32_t *code_points)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < size;)
+    {
+        uint32_t length;
+        code_points[n++] = reference_decode(&s[i], size - i, &length);
+        i += length;
+    }
+    return n;
+}
+
+
+// utf8_decode with blocks of `count` code points, against the reference
+static bool check_decode(const uint8_t *s, uint32_t size, uint32_t count)
+{
+    uint32_t expected[MAX_BYTES];
+    uint32_t actual[MAX_BYTES];
+    uint32_t expected_count = reference_decode_all(s, size, expected);
+
+    const char *string = (const char *)s;
+    const char *end = string + size;
+    uint32_t n = 0;
+    while (string < end)
+    {
+        uint32_t decoded = utf8_decode(&string, end, &actual[n], count);
+        if (decoded == 0 || (decoded < count && string != end))
+        {
+            return false;
+        }
+        n += decoded;
+    }
+    return string == end && n == expected_count &&
+           memcmp(actual, expected, n * sizeof(uint32_t)) == 0;
+}
+
+
+// utf8_next up to the terminator, against the reference
+static bool check_next(const uint8_t *s, uint32_t size)
+{
+    char string[MAX_BYTES + 1];
+    uint32_t expected[MAX_BYTES];
+    size = strnlen((const char *)s, size);
+    memcpy(string, s, size);
+    string[size] = '\0';
+    uint32_t expected_count = reference_decode_all(s, size, expected);
+
+    const char *next = string;
+    for (uint32_t i = 0; i < expected_count; i++)
+    {
+        if (utf8_next(&next) != expected[i])
+        {
+            return false;
+        }
+    }
+    return utf8_next(&next) == 0 && next == string + size && utf8_next(&next) == 0;
+}
+
+
+static void test_examples()
+{
+    const struct
+    {
+        const char *bytes;
+        uint32_t code_points[16];
+        uint32_t count;
+    } examples[] = {
+        // table 3-8 of the Unicode standard
+        {"\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64",
+         {0x61, 0xFFFD, 0xFFFD, 0xFFFD, 0x62, 0xFFFD, 0x63, 0xFFFD, 0xFFFD, 0x64}, 10},
+        // overlong, surrogate and beyond U+10FFFF, every byte is replaced
+        {"\xC0\xAF", {0xFFFD, 0xFFFD}, 2},
+        {"\xE0\x80\xAF", {0xFFFD, 0xFFFD, 0xFFFD}, 3},
+        {"\xF0\x80\x80\xAF", {0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD}, 4},
+        {"\xED\xA0\x80", {0xFFFD, 0xFFFD, 0xFFFD}, 3},
+        {"\xF4\x90\x80\x80", {0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD}, 4},
+        // cut short, by the end or by the next character
+        {"\xE2\x82", {0xFFFD}, 1},
+        {"\xF0\x9F\x98", {0xFFFD}, 1},
+        {"\xF0\x9F\x98" "A", {0xFFFD, 'A'}, 2},
+        {"\xE2\x82\xE2\x82\xAC", {0xFFFD, 0x20AC}, 2},
+        // boundaries
+        {"\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF", {0x80, 0x7FF, 0x800, 0xFFFF}, 4},
+        {"\xF0\x90\x80\x80\xF4\x8F\xBF\xBF", {0x10000, 0x10FFFF}, 2},
+    };
+
+    for (size_t i = 0; i < sizeof(examples) / sizeof(examples[0]); i++)
+    {
+        const char *string = examples[i].bytes;
+        const char *end = string + strlen(string);
+        uint32_t code_points[16];
+        CHECK(utf8_decode(&string, end, code_points, 16) == examples[i].count);
+        CHECK(string == end);
+        CHECK(memcmp(code_points, examples[i].code_points,
+                     examples[i].count * sizeof(uint32_t)) == 0);
+
+        const uint8_t *bytes = (const uint8_t *)examples[i].bytes;
+        CHECK(check_next(bytes, strlen(examples[i].bytes)));
+    }
+}
+
+
+static void test_short_strings()
+{
+    uint32_t failures = 0;
+    uint8_t s[3];
+    for (uint32_t i = 0; i < 1 << 24; i++)
+    {
+        s[0] = i >> 16;
+        s[1] = i >> 8;
+        s[2] = i;
+        failures += !check_decode(s, 3, 3) + !check_next(s, 3);
+        if (i < 1 << 16)
+        {
+            s[0] = i >> 8;
+            s[1] = i;
+            failures += !check_decode(s, 2, 2) + !check_next(s, 2);
+        }
+    }
+    CHECK(failures == 0);
+}
+
+
+static void test_random_strings()
+{
+    // ASCII runs for the word path, mixed with continuation and lead bytes
+    static const uint8_t bytes[] = {'a', 'b', ' ', 0x00, 0x7F, 0x80, 0x8F, 0x90, 0x9F,
+                                    0xA0, 0xBF, 0xC0, 0xC1, 0xC2, 0xDF, 0xE0, 0xE1,
+                                    0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF4, 0xF5, 0xFF};
+    uint32_t seed = 1;
+    uint32_t failures = 0;
+    for (uint32_t round = 0; round < FUZZ_ROUNDS; round++)
+    {
+        uint8_t s[MAX_BYTES];
+        uint32_t size = host_random(&seed) % (MAX_BYTES + 1);
+        uint32_t ascii = host_random(&seed) % 4;
+        for (uint32_t i = 0; i < size; i++)
+        {
+            uint32_t r = host_random(&seed);
+            s[i] = r % 4 < ascii ? 'a' + r / 4 % 26 : bytes[r / 4 % sizeof(bytes)];
+        }
+        uint32_t count = 1 + host_random(&seed) % MAX_BYTES;
+        failures += !check_decode(s, size, count) + !check_next(s, size);
+    }
+    CHECK(failures == 0);
+}
+
+/******************************************************************************/
+/***        main                                                            ***/
+/******************************************************************************/
+
+int main()
+{
+    build_reference();
+    test_examples();
+    test_short_strings();
+    test_random_strings();
+    return TEST_RESULT();
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/